@@ -0,0 +1,1988 @@
+// auto-generated file, do not edit
+// invoked with script type 'autotest' and delimiter '/'
+// the following types need to be defined externally:
+//      typedef ...(autotest_function_t)(...);
+//      typedef struct {
+//          unsigned int id;        // script identification number
+//          autotest_function_t * api;    // pointer to function API
+//          const char * name;      // script name
+//          ...
+//      } autotest_t;
+//      typedef struct {
+//          unsigned int id;        // package identification number
+//          unsigned int index;     // index of first script
+//          unsigned int n;         // number of scripts in package
+//          const char * name;      // name of package
+//      } package_t;
+
+#ifndef __LIQUID_AUTOSCRIPT_INCLUDE_H__
+#define __LIQUID_AUTOSCRIPT_INCLUDE_H__
+
+#define AUTOSCRIPT_VERSION "0.3.1"
+
+// number of packages
+#define NUM_PACKAGES (111)
+
+// number of scripts
+#define NUM_AUTOSCRIPTS (863)
+
+// function declarations
+// autotest/null_autotest.c
+autotest_function_t autotest_null;
+// src/agc/tests/agc_crcf_autotest.c
+autotest_function_t autotest_agc_crcf_dc_gain_control;
+autotest_function_t autotest_agc_crcf_ac_gain_control;
+autotest_function_t autotest_agc_crcf_rssi_sinusoid;
+autotest_function_t autotest_agc_crcf_rssi_noise;
+// src/audio/tests/cvsd_autotest.c
+autotest_function_t autotest_cvsd_rmse_sine;
+// src/buffer/tests/cbuffer_autotest.c
+autotest_function_t autotest_cbufferf;
+autotest_function_t autotest_cbuffercf;
+autotest_function_t autotest_cbufferf_flow;
+// src/buffer/tests/spscbuffer_autotest.c
+autotest_function_t autotest_spscbufferf_wrap;
+autotest_function_t autotest_spscbufferf_wrap_duplicated;
+autotest_function_t autotest_spscbuffercf_partial;
+autotest_function_t autotest_spscbufferf_close;
+autotest_function_t autotest_spscbufferf_threads_block;
+autotest_function_t autotest_spscbufferf_threads_spin;
+autotest_function_t autotest_spscbufferf_threads_block_duplicated;
+autotest_function_t autotest_spscbufferf_threads_spin_duplicated;
+// src/buffer/tests/wdelay_autotest.c
+autotest_function_t autotest_wdelayf;
+autotest_function_t autotest_wdelayf_write;
+// src/buffer/tests/window_autotest.c
+autotest_function_t autotest_windowf;
+autotest_function_t autotest_windowcf_layout_linear;
+autotest_function_t autotest_windowcf_layout_duplicated;
+autotest_function_t autotest_windowcf_layout_mirrored;
+autotest_function_t autotest_windowcf_layout_auto;
+autotest_function_t autotest_windowcf_layout_one;
+autotest_function_t autotest_windowcf_layout_page;
+autotest_function_t autotest_windowcf_layout_linear_page;
+// src/channel/tests/channel_cccf_autotest.c
+autotest_function_t autotest_channel_cccf_randgen;
+autotest_function_t autotest_channel_cccf_awgn;
+autotest_function_t autotest_channel_cccf_block;
+// src/dotprod/tests/dotprod_rrrf_autotest.c
+autotest_function_t autotest_dotprod_rrrf_basic;
+autotest_function_t autotest_dotprod_rrrf_uneven;
+autotest_function_t autotest_dotprod_rrrf_struct;
+autotest_function_t autotest_dotprod_rrrf_struct_align;
+autotest_function_t autotest_dotprod_rrrf_rand01;
+autotest_function_t autotest_dotprod_rrrf_rand02;
+autotest_function_t autotest_dotprod_rrrf_struct_lengths;
+autotest_function_t autotest_dotprod_rrrf_struct_vs_ordinal;
+autotest_function_t autotest_dotprod_rrrf_execute_block;
+// src/dotprod/tests/dotprod_crcf_autotest.c
+autotest_function_t autotest_dotprod_crcf_rand01;
+autotest_function_t autotest_dotprod_crcf_rand02;
+autotest_function_t autotest_dotprod_crcf_struct_vs_ordinal;
+autotest_function_t autotest_dotprod_crcf_execute_block;
+autotest_function_t autotest_dotprod_crcf_execute_split;
+autotest_function_t autotest_dotprod_crcf_execute_block_split;
+// src/dotprod/tests/dotprod_cccf_autotest.c
+autotest_function_t autotest_dotprod_cccf_rand16;
+autotest_function_t autotest_dotprod_cccf_struct_lengths;
+autotest_function_t autotest_dotprod_cccf_struct_vs_ordinal;
+autotest_function_t autotest_dotprod_cccf_execute_block;
+autotest_function_t autotest_dotprod_cccf_execute_split;
+autotest_function_t autotest_dotprod_cccf_execute_block_split;
+// src/dotprod/tests/sumsqf_autotest.c
+autotest_function_t autotest_sumsqf_3;
+autotest_function_t autotest_sumsqf_4;
+autotest_function_t autotest_sumsqf_7;
+autotest_function_t autotest_sumsqf_8;
+autotest_function_t autotest_sumsqf_15;
+autotest_function_t autotest_sumsqf_16;
+// src/dotprod/tests/sumsqcf_autotest.c
+autotest_function_t autotest_sumsqcf_3;
+autotest_function_t autotest_sumsqcf_4;
+autotest_function_t autotest_sumsqcf_7;
+autotest_function_t autotest_sumsqcf_8;
+autotest_function_t autotest_sumsqcf_15;
+autotest_function_t autotest_sumsqcf_16;
+// src/equalization/tests/eqlms_cccf_autotest.c
+autotest_function_t autotest_eqlms_cccf_blind;
+autotest_function_t autotest_eqlms_cccf_decisiondirected;
+autotest_function_t autotest_eqlms_cccf_block_fd_filter;
+autotest_function_t autotest_eqlms_cccf_block_td;
+autotest_function_t autotest_eqlms_cccf_block_fd;
+autotest_function_t autotest_eqlms_cccf_block_fd_long;
+autotest_function_t autotest_eqlms_cccf_block_size;
+// src/equalization/tests/eqlms_rrrf_autotest.c
+autotest_function_t autotest_eqlms_rrrf_block_fd_filter;
+autotest_function_t autotest_eqlms_rrrf_block_td;
+autotest_function_t autotest_eqlms_rrrf_block_fd;
+autotest_function_t autotest_eqlms_rrrf_block_fd_long;
+// src/equalization/tests/eqrls_cccf_autotest.c
+autotest_function_t autotest_eqrls_cccf_ftf;
+autotest_function_t autotest_eqrls_cccf_ftf_long;
+autotest_function_t autotest_eqrls_cccf_iqr;
+// src/equalization/tests/eqrls_rrrf_autotest.c
+autotest_function_t autotest_eqrls_rrrf_01;
+autotest_function_t autotest_eqrls_rrrf_ftf;
+autotest_function_t autotest_eqrls_rrrf_ftf_long;
+autotest_function_t autotest_eqrls_rrrf_iqr;
+autotest_function_t autotest_eqrls_rrrf_iqr_long;
+autotest_function_t autotest_eqrls_rrrf_ftf_rescue;
+autotest_function_t autotest_eqrls_rrrf_train_types;
+// src/fec/tests/crc_autotest.c
+autotest_function_t autotest_reverse_byte;
+autotest_function_t autotest_reverse_uint16;
+autotest_function_t autotest_reverse_uint32;
+autotest_function_t autotest_checksum;
+autotest_function_t autotest_crc8;
+autotest_function_t autotest_crc16;
+autotest_function_t autotest_crc24;
+autotest_function_t autotest_crc32;
+autotest_function_t autotest_crc_reference;
+autotest_function_t autotest_crc_streaming;
+// src/fec/tests/fec_autotest.c
+autotest_function_t autotest_fec_r3;
+autotest_function_t autotest_fec_r5;
+autotest_function_t autotest_fec_h74;
+autotest_function_t autotest_fec_h84;
+autotest_function_t autotest_fec_h128;
+autotest_function_t autotest_fec_g2412;
+autotest_function_t autotest_fec_secded2216;
+autotest_function_t autotest_fec_secded3932;
+autotest_function_t autotest_fec_secded7264;
+autotest_function_t autotest_fec_v27;
+autotest_function_t autotest_fec_v29;
+autotest_function_t autotest_fec_v39;
+autotest_function_t autotest_fec_v615;
+autotest_function_t autotest_fec_v27p23;
+autotest_function_t autotest_fec_v27p34;
+autotest_function_t autotest_fec_v27p45;
+autotest_function_t autotest_fec_v27p56;
+autotest_function_t autotest_fec_v27p67;
+autotest_function_t autotest_fec_v27p78;
+autotest_function_t autotest_fec_v29p23;
+autotest_function_t autotest_fec_v29p34;
+autotest_function_t autotest_fec_v29p45;
+autotest_function_t autotest_fec_v29p56;
+autotest_function_t autotest_fec_v29p67;
+autotest_function_t autotest_fec_v29p78;
+autotest_function_t autotest_fec_rs8;
+autotest_function_t autotest_fec_ldpc12;
+autotest_function_t autotest_fec_ldpc23;
+autotest_function_t autotest_fec_ldpc34;
+autotest_function_t autotest_fec_ldpc56;
+// src/fec/tests/fec_conv_autotest.c
+autotest_function_t autotest_fec_conv_v27_hard;
+autotest_function_t autotest_fec_conv_v29_hard;
+autotest_function_t autotest_fec_conv_v39_hard;
+autotest_function_t autotest_fec_conv_v615_hard;
+autotest_function_t autotest_fec_conv_v27p34_hard;
+autotest_function_t autotest_fec_conv_v29p23_hard;
+autotest_function_t autotest_fec_conv_v27_soft;
+autotest_function_t autotest_fec_conv_v29_soft;
+autotest_function_t autotest_fec_conv_v39_soft;
+autotest_function_t autotest_fec_conv_v615_soft;
+autotest_function_t autotest_fec_conv_viterbi_blocks;
+autotest_function_t autotest_fec_conv_viterbi_kernels_v27;
+autotest_function_t autotest_fec_conv_viterbi_kernels_v29;
+autotest_function_t autotest_fec_conv_viterbi_kernels_v39;
+autotest_function_t autotest_fec_conv_viterbi_kernels_v615;
+autotest_function_t autotest_fec_conv_v27_exact;
+autotest_function_t autotest_fec_conv_v27p23_exact;
+autotest_function_t autotest_fec_conv_v27p34_exact;
+autotest_function_t autotest_fec_conv_v27p45_exact;
+autotest_function_t autotest_fec_conv_v27p56_exact;
+autotest_function_t autotest_fec_conv_v27p67_exact;
+autotest_function_t autotest_fec_conv_v27p78_exact;
+autotest_function_t autotest_fec_conv_v29p23_exact;
+autotest_function_t autotest_fec_conv_v29p78_exact;
+// src/fec/tests/fec_soft_autotest.c
+autotest_function_t autotest_fecsoft_r3;
+autotest_function_t autotest_fecsoft_r5;
+autotest_function_t autotest_fecsoft_h74;
+autotest_function_t autotest_fecsoft_h84;
+autotest_function_t autotest_fecsoft_h128;
+autotest_function_t autotest_fecsoft_v27;
+autotest_function_t autotest_fecsoft_v29;
+autotest_function_t autotest_fecsoft_v39;
+autotest_function_t autotest_fecsoft_v615;
+autotest_function_t autotest_fecsoft_v27p23;
+autotest_function_t autotest_fecsoft_v27p34;
+autotest_function_t autotest_fecsoft_v27p45;
+autotest_function_t autotest_fecsoft_v27p56;
+autotest_function_t autotest_fecsoft_v27p67;
+autotest_function_t autotest_fecsoft_v27p78;
+autotest_function_t autotest_fecsoft_v29p23;
+autotest_function_t autotest_fecsoft_v29p34;
+autotest_function_t autotest_fecsoft_v29p45;
+autotest_function_t autotest_fecsoft_v29p56;
+autotest_function_t autotest_fecsoft_v29p67;
+autotest_function_t autotest_fecsoft_v29p78;
+autotest_function_t autotest_fecsoft_rs8;
+autotest_function_t autotest_fecsoft_ldpc12;
+autotest_function_t autotest_fecsoft_ldpc23;
+autotest_function_t autotest_fecsoft_ldpc34;
+autotest_function_t autotest_fecsoft_ldpc56;
+// src/fec/tests/fec_golay2412_autotest.c
+autotest_function_t autotest_golay2412_codec;
+autotest_function_t autotest_golay2412_gentab;
+// src/fec/tests/fec_hamming74_autotest.c
+autotest_function_t autotest_hamming74_codec;
+autotest_function_t autotest_hamming74_codec_soft;
+// src/fec/tests/fec_hamming84_autotest.c
+autotest_function_t autotest_hamming84_codec;
+autotest_function_t autotest_hamming84_codec_soft;
+// src/fec/tests/fec_hamming128_autotest.c
+autotest_function_t autotest_hamming128_codec;
+autotest_function_t autotest_hamming128_codec_soft;
+autotest_function_t autotest_hamming128_gentab;
+autotest_function_t autotest_hamming128_codec_soft_ml;
+// src/fec/tests/fec_hamming1511_autotest.c
+autotest_function_t autotest_hamming1511_codec;
+// src/fec/tests/fec_hamming3126_autotest.c
+autotest_function_t autotest_hamming3126_codec;
+// src/fec/tests/fec_ldpc_autotest.c
+autotest_function_t autotest_fec_ldpc_codeword_r12_z27;
+autotest_function_t autotest_fec_ldpc_codeword_r23_z54;
+autotest_function_t autotest_fec_ldpc_codeword_r34_z81;
+autotest_function_t autotest_fec_ldpc_codeword_r56_z81;
+autotest_function_t autotest_fec_ldpc_codeword_r12_z675;
+autotest_function_t autotest_fec_ldpc_awgn_r12;
+autotest_function_t autotest_fec_ldpc_awgn_r23;
+autotest_function_t autotest_fec_ldpc_awgn_r34;
+autotest_function_t autotest_fec_ldpc_awgn_r56;
+autotest_function_t autotest_fec_ldpc_kernels_r12_z27;
+autotest_function_t autotest_fec_ldpc_kernels_r23_z54;
+autotest_function_t autotest_fec_ldpc_kernels_r56_z81;
+autotest_function_t autotest_fec_ldpc_kernels_r34_z675;
+autotest_function_t autotest_fec_ldpc_sumproduct;
+autotest_function_t autotest_fec_ldpc_length_n1;
+autotest_function_t autotest_fec_ldpc_length_n57;
+autotest_function_t autotest_fec_ldpc_length_n1000;
+autotest_function_t autotest_fec_ldpc_length_n10000;
+// src/fec/tests/fec_reedsolomon_autotest.c
+autotest_function_t autotest_reedsolomon_223_255;
+autotest_function_t autotest_reedsolomon_codeword;
+autotest_function_t autotest_reedsolomon_errors_k223;
+autotest_function_t autotest_reedsolomon_errors_k100;
+autotest_function_t autotest_reedsolomon_errors_k1;
+autotest_function_t autotest_reedsolomon_kernels_r32_k223;
+autotest_function_t autotest_reedsolomon_kernels_r32_k1;
+autotest_function_t autotest_reedsolomon_kernels_r16_k100;
+autotest_function_t autotest_reedsolomon_kernels_r7_k31;
+autotest_function_t autotest_reedsolomon_1024;
+// src/fec/tests/fec_rep3_autotest.c
+autotest_function_t autotest_rep3_codec;
+// src/fec/tests/fec_rep5_autotest.c
+autotest_function_t autotest_rep5_codec;
+// src/fec/tests/fec_secded2216_autotest.c
+autotest_function_t autotest_secded2216_codec_e0;
+autotest_function_t autotest_secded2216_codec_e1;
+autotest_function_t autotest_secded2216_codec_e2;
+// src/fec/tests/fec_secded3932_autotest.c
+autotest_function_t autotest_secded3932_codec_e0;
+autotest_function_t autotest_secded3932_codec_e1;
+autotest_function_t autotest_secded3932_codec_e2;
+// src/fec/tests/fec_secded7264_autotest.c
+autotest_function_t autotest_secded7264_codec_e0;
+autotest_function_t autotest_secded7264_codec_e1;
+autotest_function_t autotest_secded7264_codec_e2;
+// src/fec/tests/interleaver_autotest.c
+autotest_function_t autotest_interleaver_hard_8;
+autotest_function_t autotest_interleaver_hard_16;
+autotest_function_t autotest_interleaver_hard_64;
+autotest_function_t autotest_interleaver_hard_256;
+autotest_function_t autotest_interleaver_soft_8;
+autotest_function_t autotest_interleaver_soft_16;
+autotest_function_t autotest_interleaver_soft_64;
+autotest_function_t autotest_interleaver_soft_256;
+autotest_function_t autotest_interleaver_hard_output;
+autotest_function_t autotest_interleaver_hard_soft_d0;
+autotest_function_t autotest_interleaver_hard_soft_d1;
+autotest_function_t autotest_interleaver_hard_soft_d2;
+autotest_function_t autotest_interleaver_hard_soft_d3;
+autotest_function_t autotest_interleaver_hard_soft_d4;
+autotest_function_t autotest_interleaver_block;
+// src/fec/tests/packetizer_autotest.c
+autotest_function_t autotest_packetizer_n16_0_0;
+autotest_function_t autotest_packetizer_n16_0_1;
+autotest_function_t autotest_packetizer_n16_0_2;
+// src/fft/tests/fft_small_autotest.c
+autotest_function_t autotest_fft_3;
+autotest_function_t autotest_fft_5;
+autotest_function_t autotest_fft_6;
+autotest_function_t autotest_fft_7;
+autotest_function_t autotest_fft_9;
+// src/fft/tests/fft_radix2_autotest.c
+autotest_function_t autotest_fft_2;
+autotest_function_t autotest_fft_4;
+autotest_function_t autotest_fft_8;
+autotest_function_t autotest_fft_16;
+autotest_function_t autotest_fft_32;
+autotest_function_t autotest_fft_64;
+// src/fft/tests/fft_composite_autotest.c
+autotest_function_t autotest_fft_10;
+autotest_function_t autotest_fft_21;
+autotest_function_t autotest_fft_22;
+autotest_function_t autotest_fft_24;
+autotest_function_t autotest_fft_26;
+autotest_function_t autotest_fft_30;
+autotest_function_t autotest_fft_35;
+autotest_function_t autotest_fft_36;
+autotest_function_t autotest_fft_48;
+autotest_function_t autotest_fft_63;
+autotest_function_t autotest_fft_92;
+autotest_function_t autotest_fft_96;
+autotest_function_t autotest_fft_120;
+autotest_function_t autotest_fft_130;
+autotest_function_t autotest_fft_192;
+// src/fft/tests/fft_prime_autotest.c
+autotest_function_t autotest_fft_17;
+autotest_function_t autotest_fft_43;
+autotest_function_t autotest_fft_79;
+autotest_function_t autotest_fft_157;
+autotest_function_t autotest_fft_317;
+autotest_function_t autotest_fft_509;
+// src/fft/tests/fft_r2r_autotest.c
+autotest_function_t autotest_fft_r2r_REDFT00_n8;
+autotest_function_t autotest_fft_r2r_REDFT10_n8;
+autotest_function_t autotest_fft_r2r_REDFT01_n8;
+autotest_function_t autotest_fft_r2r_REDFT11_n8;
+autotest_function_t autotest_fft_r2r_RODFT00_n8;
+autotest_function_t autotest_fft_r2r_RODFT10_n8;
+autotest_function_t autotest_fft_r2r_RODFT01_n8;
+autotest_function_t autotest_fft_r2r_RODFT11_n8;
+autotest_function_t autotest_fft_r2r_REDFT00_n32;
+autotest_function_t autotest_fft_r2r_REDFT10_n32;
+autotest_function_t autotest_fft_r2r_REDFT01_n32;
+autotest_function_t autotest_fft_r2r_REDFT11_n32;
+autotest_function_t autotest_fft_r2r_RODFT00_n32;
+autotest_function_t autotest_fft_r2r_RODFT10_n32;
+autotest_function_t autotest_fft_r2r_RODFT01_n32;
+autotest_function_t autotest_fft_r2r_RODFT11_n32;
+autotest_function_t autotest_fft_r2r_REDFT00_n27;
+autotest_function_t autotest_fft_r2r_REDFT10_n27;
+autotest_function_t autotest_fft_r2r_REDFT01_n27;
+autotest_function_t autotest_fft_r2r_REDFT11_n27;
+autotest_function_t autotest_fft_r2r_RODFT00_n27;
+autotest_function_t autotest_fft_r2r_RODFT10_n27;
+autotest_function_t autotest_fft_r2r_RODFT01_n27;
+autotest_function_t autotest_fft_r2r_RODFT11_n27;
+// src/fft/tests/fft_shift_autotest.c
+autotest_function_t autotest_fft_shift_4;
+autotest_function_t autotest_fft_shift_8;
+// src/fft/tests/fft_batch_autotest.c
+autotest_function_t autotest_fft_radix2_1024;
+autotest_function_t autotest_fft_radix2_2048;
+autotest_function_t autotest_fft_execute_arrays;
+autotest_function_t autotest_fft_batch_contiguous;
+autotest_function_t autotest_fft_batch_inplace;
+autotest_function_t autotest_fft_batch_strided;
+autotest_function_t autotest_fft_batch_transpose;
+autotest_function_t autotest_fft_batch_padded;
+// src/filter/tests/autocorr_autotest.c
+autotest_function_t autotest_autocorr_cccf_block_w1_d1;
+autotest_function_t autotest_autocorr_cccf_block_w4_d2;
+autotest_function_t autotest_autocorr_cccf_block_w16_d5;
+autotest_function_t autotest_autocorr_cccf_block_w64_d64;
+autotest_function_t autotest_autocorr_cccf_block_w100_d7;
+autotest_function_t autotest_autocorr_rrrf_block_w1_d1;
+autotest_function_t autotest_autocorr_rrrf_block_w4_d2;
+autotest_function_t autotest_autocorr_rrrf_block_w16_d5;
+autotest_function_t autotest_autocorr_rrrf_block_w64_d64;
+autotest_function_t autotest_autocorr_rrrf_block_w100_d7;
+// src/filter/tests/fftfilt_xxxf_autotest.c
+autotest_function_t autotest_fftfilt_rrrf_data_h4x256;
+autotest_function_t autotest_fftfilt_rrrf_data_h7x256;
+autotest_function_t autotest_fftfilt_rrrf_data_h13x256;
+autotest_function_t autotest_fftfilt_rrrf_data_h23x256;
+autotest_function_t autotest_fftfilt_crcf_data_h4x256;
+autotest_function_t autotest_fftfilt_crcf_data_h7x256;
+autotest_function_t autotest_fftfilt_crcf_data_h13x256;
+autotest_function_t autotest_fftfilt_crcf_data_h23x256;
+autotest_function_t autotest_fftfilt_cccf_data_h4x256;
+autotest_function_t autotest_fftfilt_cccf_data_h7x256;
+autotest_function_t autotest_fftfilt_cccf_data_h13x256;
+autotest_function_t autotest_fftfilt_cccf_data_h23x256;
+// src/filter/tests/filter_crosscorr_autotest.c
+autotest_function_t autotest_filter_crosscorr_rrrf;
+// src/filter/tests/firdecim_xxxf_autotest.c
+autotest_function_t autotest_firdecim_rrrf_data_M2h4x20;
+autotest_function_t autotest_firdecim_rrrf_data_M3h7x30;
+autotest_function_t autotest_firdecim_rrrf_data_M4h13x40;
+autotest_function_t autotest_firdecim_rrrf_data_M5h23x50;
+autotest_function_t autotest_firdecim_crcf_data_M2h4x20;
+autotest_function_t autotest_firdecim_crcf_data_M3h7x30;
+autotest_function_t autotest_firdecim_crcf_data_M4h13x40;
+autotest_function_t autotest_firdecim_crcf_data_M5h23x50;
+autotest_function_t autotest_firdecim_cccf_data_M2h4x20;
+autotest_function_t autotest_firdecim_cccf_data_M3h7x30;
+autotest_function_t autotest_firdecim_cccf_data_M4h13x40;
+autotest_function_t autotest_firdecim_cccf_data_M5h23x50;
+// src/filter/tests/firdes_autotest.c
+autotest_function_t autotest_liquid_firdes_rcos;
+autotest_function_t autotest_liquid_firdes_rrcos;
+autotest_function_t autotest_liquid_firdes_rkaiser;
+// src/filter/tests/firdespm_autotest.c
+autotest_function_t autotest_firdespm_bandpass_n24;
+autotest_function_t autotest_firdespm_bandpass_n32;
+// src/filter/tests/firfilt_xxxf_autotest.c
+autotest_function_t autotest_firfilt_rrrf_data_h4x8;
+autotest_function_t autotest_firfilt_rrrf_data_h7x16;
+autotest_function_t autotest_firfilt_rrrf_data_h13x32;
+autotest_function_t autotest_firfilt_rrrf_data_h23x64;
+autotest_function_t autotest_firfilt_crcf_data_h4x8;
+autotest_function_t autotest_firfilt_crcf_data_h7x16;
+autotest_function_t autotest_firfilt_crcf_data_h13x32;
+autotest_function_t autotest_firfilt_crcf_data_h23x64;
+autotest_function_t autotest_firfilt_cccf_data_h4x8;
+autotest_function_t autotest_firfilt_cccf_data_h7x16;
+autotest_function_t autotest_firfilt_cccf_data_h13x32;
+autotest_function_t autotest_firfilt_cccf_data_h23x64;
+// src/filter/tests/firhilb_autotest.c
+autotest_function_t autotest_firhilbf_decim;
+autotest_function_t autotest_firhilbf_interp;
+// src/filter/tests/firinterp_autotest.c
+autotest_function_t autotest_firinterp_rrrf_generic;
+autotest_function_t autotest_firinterp_crcf_generic;
+// src/filter/tests/firpfb_autotest.c
+autotest_function_t autotest_firpfb_impulse_response;
+// src/filter/tests/groupdelay_autotest.c
+autotest_function_t autotest_fir_groupdelay_n3;
+autotest_function_t autotest_iir_groupdelay_n3;
+autotest_function_t autotest_iir_groupdelay_n8;
+autotest_function_t autotest_iir_groupdelay_sos_n8;
+// src/filter/tests/iirdes_autotest.c
+autotest_function_t autotest_iirdes_butter_2;
+autotest_function_t autotest_iirdes_cplxpair_n6;
+autotest_function_t autotest_iirdes_cplxpair_n20;
+autotest_function_t autotest_iirdes_dzpk2sosf;
+autotest_function_t autotest_iirdes_isstable_n2_yes;
+autotest_function_t autotest_iirdes_isstable_n2_no;
+// src/filter/tests/iirfilt_xxxf_autotest.c
+autotest_function_t autotest_iirfilt_rrrf_h3x64;
+autotest_function_t autotest_iirfilt_rrrf_h5x64;
+autotest_function_t autotest_iirfilt_rrrf_h7x64;
+autotest_function_t autotest_iirfilt_crcf_h3x64;
+autotest_function_t autotest_iirfilt_crcf_h5x64;
+autotest_function_t autotest_iirfilt_crcf_h7x64;
+autotest_function_t autotest_iirfilt_cccf_h3x64;
+autotest_function_t autotest_iirfilt_cccf_h5x64;
+autotest_function_t autotest_iirfilt_cccf_h7x64;
+// src/filter/tests/iirfiltsos_rrrf_autotest.c
+autotest_function_t autotest_iirfiltsos_impulse_n2;
+autotest_function_t autotest_iirfiltsos_step_n2;
+// src/filter/tests/msresamp_crcf_autotest.c
+autotest_function_t autotest_msresamp_crcf;
+// src/filter/tests/resamp_crcf_autotest.c
+autotest_function_t autotest_resamp_crcf;
+// src/filter/tests/resamp2_crcf_autotest.c
+autotest_function_t autotest_resamp2_analysis;
+autotest_function_t autotest_resamp2_synthesis;
+// src/filter/tests/symsync_crcf_autotest.c
+autotest_function_t autotest_symsync_crcf_scenario_0;
+autotest_function_t autotest_symsync_crcf_scenario_1;
+autotest_function_t autotest_symsync_crcf_scenario_2;
+autotest_function_t autotest_symsync_crcf_scenario_3;
+// src/filter/tests/symsync_rrrf_autotest.c
+autotest_function_t autotest_symsync_rrrf_scenario_0;
+autotest_function_t autotest_symsync_rrrf_scenario_1;
+autotest_function_t autotest_symsync_rrrf_scenario_2;
+autotest_function_t autotest_symsync_rrrf_scenario_3;
+// src/framing/tests/bpacketsync_autotest.c
+autotest_function_t autotest_bpacketsync;
+// src/framing/tests/bsync_autotest.c
+autotest_function_t autotest_bsync_rrrf_15;
+autotest_function_t autotest_bsync_crcf_15;
+// src/framing/tests/detector_autotest.c
+autotest_function_t autotest_detector_cccf_n64;
+autotest_function_t autotest_detector_cccf_n83;
+autotest_function_t autotest_detector_cccf_n128;
+autotest_function_t autotest_detector_cccf_n167;
+autotest_function_t autotest_detector_cccf_n256;
+autotest_function_t autotest_detector_cccf_n335;
+autotest_function_t autotest_detector_cccf_n512;
+autotest_function_t autotest_detector_cccf_n671;
+autotest_function_t autotest_detector_cccf_n1024;
+autotest_function_t autotest_detector_cccf_n1341;
+// src/framing/tests/flexframesync_autotest.c
+autotest_function_t autotest_flexframesync;
+autotest_function_t autotest_flexframesync_reconfig;
+autotest_function_t autotest_flexframesync_threads;
+// src/framing/tests/framecache_autotest.c
+autotest_function_t autotest_framecache;
+// src/framing/tests/framesync64_autotest.c
+autotest_function_t autotest_framesync64;
+autotest_function_t autotest_framesync64_threads;
+// src/framing/tests/qdetector_cccf_autotest.c
+autotest_function_t autotest_qdetector_cccf_linear_n64;
+autotest_function_t autotest_qdetector_cccf_linear_n83;
+autotest_function_t autotest_qdetector_cccf_linear_n128;
+autotest_function_t autotest_qdetector_cccf_linear_n167;
+autotest_function_t autotest_qdetector_cccf_linear_n256;
+autotest_function_t autotest_qdetector_cccf_linear_n335;
+autotest_function_t autotest_qdetector_cccf_linear_n512;
+autotest_function_t autotest_qdetector_cccf_linear_n671;
+autotest_function_t autotest_qdetector_cccf_linear_n1024;
+autotest_function_t autotest_qdetector_cccf_linear_n1341;
+autotest_function_t autotest_qdetector_cccf_gmsk_n64;
+autotest_function_t autotest_qdetector_cccf_gmsk_n83;
+autotest_function_t autotest_qdetector_cccf_gmsk_n128;
+autotest_function_t autotest_qdetector_cccf_gmsk_n167;
+autotest_function_t autotest_qdetector_cccf_gmsk_n256;
+autotest_function_t autotest_qdetector_cccf_gmsk_n335;
+autotest_function_t autotest_qdetector_cccf_gmsk_n512;
+autotest_function_t autotest_qdetector_cccf_gmsk_n671;
+autotest_function_t autotest_qdetector_cccf_gmsk_n1024;
+autotest_function_t autotest_qdetector_cccf_gmsk_n1341;
+// src/framing/tests/qpacketmodem_autotest.c
+autotest_function_t autotest_qpacketmodem_bpsk;
+autotest_function_t autotest_qpacketmodem_qpsk;
+autotest_function_t autotest_qpacketmodem_psk8;
+autotest_function_t autotest_qpacketmodem_qam16;
+autotest_function_t autotest_qpacketmodem_sqam32;
+autotest_function_t autotest_qpacketmodem_qam64;
+autotest_function_t autotest_qpacketmodem_sqam128;
+autotest_function_t autotest_qpacketmodem_qam256;
+// src/framing/tests/qpilotsync_autotest.c
+autotest_function_t autotest_qpilotsync_100_16;
+autotest_function_t autotest_qpilotsync_200_20;
+autotest_function_t autotest_qpilotsync_300_24;
+autotest_function_t autotest_qpilotsync_400_28;
+autotest_function_t autotest_qpilotsync_500_32;
+// src/math/tests/kbd_autotest.c
+autotest_function_t autotest_kbd_n16;
+autotest_function_t autotest_kbd_n32;
+autotest_function_t autotest_kbd_n48;
+// src/math/tests/math_autotest.c
+autotest_function_t autotest_Q;
+autotest_function_t autotest_sincf;
+autotest_function_t autotest_nextpow2;
+// src/math/tests/math_bessel_autotest.c
+autotest_function_t autotest_lnbesselif;
+autotest_function_t autotest_besselif;
+autotest_function_t autotest_besseli0f;
+autotest_function_t autotest_besseljf;
+autotest_function_t autotest_besselj0f;
+// src/math/tests/math_gamma_autotest.c
+autotest_function_t autotest_gamma;
+autotest_function_t autotest_lngamma;
+autotest_function_t autotest_uppergamma;
+autotest_function_t autotest_factorial;
+autotest_function_t autotest_nchoosek;
+// src/math/tests/math_complex_autotest.c
+autotest_function_t autotest_cexpf;
+autotest_function_t autotest_clogf;
+autotest_function_t autotest_csqrtf;
+autotest_function_t autotest_casinf;
+autotest_function_t autotest_cacosf;
+autotest_function_t autotest_catanf;
+// src/math/tests/polynomial_autotest.c
+autotest_function_t autotest_polyf_fit_q3n3;
+autotest_function_t autotest_polyf_expandroots_4;
+autotest_function_t autotest_polyf_expandroots_11;
+autotest_function_t autotest_polycf_expandroots_4;
+autotest_function_t autotest_polyf_expandroots2_3;
+autotest_function_t autotest_polyf_mul_2_3;
+autotest_function_t autotest_poly_expandbinomial_n6;
+autotest_function_t autotest_poly_binomial_expand_pm_m6_k1;
+autotest_function_t autotest_poly_expandbinomial_pm_m5_k2;
+autotest_function_t autotest_polyf_findroots;
+// src/matrix/tests/matrixcf_autotest.c
+autotest_function_t autotest_matrixcf_add;
+autotest_function_t autotest_matrixcf_aug;
+autotest_function_t autotest_matrixcf_chol;
+autotest_function_t autotest_matrixcf_inv;
+autotest_function_t autotest_matrixcf_linsolve;
+autotest_function_t autotest_matrixcf_ludecomp_crout;
+autotest_function_t autotest_matrixcf_ludecomp_doolittle;
+autotest_function_t autotest_matrixcf_mul;
+autotest_function_t autotest_matrixcf_qrdecomp;
+autotest_function_t autotest_matrixcf_transmul;
+// src/matrix/tests/matrixf_autotest.c
+autotest_function_t autotest_matrixf_add;
+autotest_function_t autotest_matrixf_aug;
+autotest_function_t autotest_matrixf_cgsolve;
+autotest_function_t autotest_matrixf_chol;
+autotest_function_t autotest_matrixf_gramschmidt;
+autotest_function_t autotest_matrixf_inv;
+autotest_function_t autotest_matrixf_linsolve;
+autotest_function_t autotest_matrixf_ludecomp_crout;
+autotest_function_t autotest_matrixf_ludecomp_doolittle;
+autotest_function_t autotest_matrixf_mul;
+autotest_function_t autotest_matrixf_qrdecomp;
+autotest_function_t autotest_matrixf_transmul;
+// src/matrix/tests/smatrixb_autotest.c
+autotest_function_t autotest_smatrixb_vmul;
+autotest_function_t autotest_smatrixb_mul;
+autotest_function_t autotest_smatrixb_mulf;
+autotest_function_t autotest_smatrixb_vmulf;
+// src/matrix/tests/smatrixf_autotest.c
+autotest_function_t autotest_smatrixf_vmul;
+autotest_function_t autotest_smatrixf_mul;
+// src/matrix/tests/smatrixi_autotest.c
+autotest_function_t autotest_smatrixi_vmul;
+autotest_function_t autotest_smatrixi_mul;
+// src/modem/tests/freqmodem_autotest.c
+autotest_function_t autotest_freqmodem_kf_0_02;
+autotest_function_t autotest_freqmodem_kf_0_04;
+autotest_function_t autotest_freqmodem_kf_0_08;
+// src/modem/tests/fskmodem_autotest.c
+autotest_function_t autotest_fskmodem_norm_M2;
+autotest_function_t autotest_fskmodem_norm_M4;
+autotest_function_t autotest_fskmodem_norm_M8;
+autotest_function_t autotest_fskmodem_norm_M16;
+autotest_function_t autotest_fskmodem_norm_M32;
+autotest_function_t autotest_fskmodem_norm_M64;
+autotest_function_t autotest_fskmodem_norm_M128;
+autotest_function_t autotest_fskmodem_norm_M256;
+autotest_function_t autotest_fskmodem_norm_M512;
+autotest_function_t autotest_fskmodem_norm_M1024;
+autotest_function_t autotest_fskmodem_misc_M2;
+autotest_function_t autotest_fskmodem_misc_M4;
+autotest_function_t autotest_fskmodem_misc_M8;
+autotest_function_t autotest_fskmodem_misc_M16;
+autotest_function_t autotest_fskmodem_misc_M32;
+autotest_function_t autotest_fskmodem_misc_M64;
+autotest_function_t autotest_fskmodem_misc_M128;
+autotest_function_t autotest_fskmodem_misc_M256;
+autotest_function_t autotest_fskmodem_misc_M512;
+autotest_function_t autotest_fskmodem_misc_M1024;
+// src/modem/tests/modem_autotest.c
+autotest_function_t autotest_mod_demod_psk2;
+autotest_function_t autotest_mod_demod_psk4;
+autotest_function_t autotest_mod_demod_psk8;
+autotest_function_t autotest_mod_demod_psk16;
+autotest_function_t autotest_mod_demod_psk32;
+autotest_function_t autotest_mod_demod_psk64;
+autotest_function_t autotest_mod_demod_psk128;
+autotest_function_t autotest_mod_demod_psk256;
+autotest_function_t autotest_mod_demod_dpsk2;
+autotest_function_t autotest_mod_demod_dpsk4;
+autotest_function_t autotest_mod_demod_dpsk8;
+autotest_function_t autotest_mod_demod_dpsk16;
+autotest_function_t autotest_mod_demod_dpsk32;
+autotest_function_t autotest_mod_demod_dpsk64;
+autotest_function_t autotest_mod_demod_dpsk128;
+autotest_function_t autotest_mod_demod_dpsk256;
+autotest_function_t autotest_mod_demod_ask2;
+autotest_function_t autotest_mod_demod_ask4;
+autotest_function_t autotest_mod_demod_ask8;
+autotest_function_t autotest_mod_demod_ask16;
+autotest_function_t autotest_mod_demod_ask32;
+autotest_function_t autotest_mod_demod_ask64;
+autotest_function_t autotest_mod_demod_ask128;
+autotest_function_t autotest_mod_demod_ask256;
+autotest_function_t autotest_mod_demod_qam4;
+autotest_function_t autotest_mod_demod_qam8;
+autotest_function_t autotest_mod_demod_qam16;
+autotest_function_t autotest_mod_demod_qam32;
+autotest_function_t autotest_mod_demod_qam64;
+autotest_function_t autotest_mod_demod_qam128;
+autotest_function_t autotest_mod_demod_qam256;
+autotest_function_t autotest_mod_demod_apsk4;
+autotest_function_t autotest_mod_demod_apsk8;
+autotest_function_t autotest_mod_demod_apsk16;
+autotest_function_t autotest_mod_demod_apsk32;
+autotest_function_t autotest_mod_demod_apsk64;
+autotest_function_t autotest_mod_demod_apsk128;
+autotest_function_t autotest_mod_demod_apsk256;
+autotest_function_t autotest_mod_demod_bpsk;
+autotest_function_t autotest_mod_demod_qpsk;
+autotest_function_t autotest_mod_demod_ook;
+autotest_function_t autotest_mod_demod_sqam32;
+autotest_function_t autotest_mod_demod_sqam128;
+autotest_function_t autotest_mod_demod_V29;
+autotest_function_t autotest_mod_demod_arb16opt;
+autotest_function_t autotest_mod_demod_arb32opt;
+autotest_function_t autotest_mod_demod_arb64opt;
+autotest_function_t autotest_mod_demod_arb128opt;
+autotest_function_t autotest_mod_demod_arb256opt;
+autotest_function_t autotest_mod_demod_arb64vt;
+// src/modem/tests/modem_block_autotest.c
+autotest_function_t autotest_modem_block_psk2;
+autotest_function_t autotest_modem_block_psk8;
+autotest_function_t autotest_modem_block_psk64;
+autotest_function_t autotest_modem_block_psk256;
+autotest_function_t autotest_modem_block_dpsk4;
+autotest_function_t autotest_modem_block_dpsk16;
+autotest_function_t autotest_modem_block_ask2;
+autotest_function_t autotest_modem_block_ask8;
+autotest_function_t autotest_modem_block_ask64;
+autotest_function_t autotest_modem_block_qam4;
+autotest_function_t autotest_modem_block_qam8;
+autotest_function_t autotest_modem_block_qam32;
+autotest_function_t autotest_modem_block_qam64;
+autotest_function_t autotest_modem_block_qam256;
+autotest_function_t autotest_modem_block_apsk4;
+autotest_function_t autotest_modem_block_apsk16;
+autotest_function_t autotest_modem_block_apsk64;
+autotest_function_t autotest_modem_block_apsk256;
+autotest_function_t autotest_modem_block_bpsk;
+autotest_function_t autotest_modem_block_qpsk;
+autotest_function_t autotest_modem_block_ook;
+autotest_function_t autotest_modem_block_sqam32;
+autotest_function_t autotest_modem_block_sqam128;
+autotest_function_t autotest_modem_block_V29;
+autotest_function_t autotest_modem_block_arb64vt;
+// src/modem/tests/modem_demodllr_autotest.c
+autotest_function_t autotest_demodllr_maxlog_bpsk;
+autotest_function_t autotest_demodllr_maxlog_qpsk;
+autotest_function_t autotest_demodllr_maxlog_ask4;
+autotest_function_t autotest_demodllr_maxlog_ask16;
+autotest_function_t autotest_demodllr_maxlog_qam4;
+autotest_function_t autotest_demodllr_maxlog_qam8;
+autotest_function_t autotest_demodllr_maxlog_qam16;
+autotest_function_t autotest_demodllr_maxlog_qam32;
+autotest_function_t autotest_demodllr_maxlog_qam64;
+autotest_function_t autotest_demodllr_maxlog_qam256;
+autotest_function_t autotest_demodllr_maxlog_psk2;
+autotest_function_t autotest_demodllr_maxlog_psk8;
+autotest_function_t autotest_demodllr_maxlog_psk32;
+autotest_function_t autotest_demodllr_maxlog_apsk32;
+autotest_function_t autotest_demodllr_maxlog_sqam32;
+autotest_function_t autotest_demodllr_maxlog_arb16opt;
+autotest_function_t autotest_demodllr_exact_qpsk;
+autotest_function_t autotest_demodllr_exact_ask8;
+autotest_function_t autotest_demodllr_exact_qam16;
+autotest_function_t autotest_demodllr_exact_qam128;
+autotest_function_t autotest_demodllr_exact_psk16;
+autotest_function_t autotest_demodllr_exact_apsk16;
+autotest_function_t autotest_demodllr_dpsk2;
+autotest_function_t autotest_demodllr_dpsk8;
+autotest_function_t autotest_demodllr8;
+// src/modem/tests/modem_demodsoft_autotest.c
+autotest_function_t autotest_demodsoft_psk2;
+autotest_function_t autotest_demodsoft_psk4;
+autotest_function_t autotest_demodsoft_psk8;
+autotest_function_t autotest_demodsoft_psk16;
+autotest_function_t autotest_demodsoft_psk32;
+autotest_function_t autotest_demodsoft_psk64;
+autotest_function_t autotest_demodsoft_psk128;
+autotest_function_t autotest_demodsoft_psk256;
+autotest_function_t autotest_demodsoft_dpsk2;
+autotest_function_t autotest_demodsoft_dpsk4;
+autotest_function_t autotest_demodsoft_dpsk8;
+autotest_function_t autotest_demodsoft_dpsk16;
+autotest_function_t autotest_demodsoft_dpsk32;
+autotest_function_t autotest_demodsoft_dpsk64;
+autotest_function_t autotest_demodsoft_dpsk128;
+autotest_function_t autotest_demodsoft_dpsk256;
+autotest_function_t autotest_demodsoft_ask2;
+autotest_function_t autotest_demodsoft_ask4;
+autotest_function_t autotest_demodsoft_ask8;
+autotest_function_t autotest_demodsoft_ask16;
+autotest_function_t autotest_demodsoft_ask32;
+autotest_function_t autotest_demodsoft_ask64;
+autotest_function_t autotest_demodsoft_ask128;
+autotest_function_t autotest_demodsoft_ask256;
+autotest_function_t autotest_demodsoft_qam4;
+autotest_function_t autotest_demodsoft_qam8;
+autotest_function_t autotest_demodsoft_qam16;
+autotest_function_t autotest_demodsoft_qam32;
+autotest_function_t autotest_demodsoft_qam64;
+autotest_function_t autotest_demodsoft_qam128;
+autotest_function_t autotest_demodsoft_qam256;
+autotest_function_t autotest_demodsoft_apsk4;
+autotest_function_t autotest_demodsoft_apsk8;
+autotest_function_t autotest_demodsoft_apsk16;
+autotest_function_t autotest_demodsoft_apsk32;
+autotest_function_t autotest_demodsoft_apsk64;
+autotest_function_t autotest_demodsoft_apsk128;
+autotest_function_t autotest_demodsoft_apsk256;
+autotest_function_t autotest_demodsoft_bpsk;
+autotest_function_t autotest_demodsoft_qpsk;
+autotest_function_t autotest_demodsoft_ook;
+autotest_function_t autotest_demodsoft_sqam32;
+autotest_function_t autotest_demodsoft_sqam128;
+autotest_function_t autotest_demodsoft_V29;
+autotest_function_t autotest_demodsoft_arb16opt;
+autotest_function_t autotest_demodsoft_arb32opt;
+autotest_function_t autotest_demodsoft_arb64opt;
+autotest_function_t autotest_demodsoft_arb128opt;
+autotest_function_t autotest_demodsoft_arb256opt;
+autotest_function_t autotest_demodsoft_arb64vt;
+autotest_function_t autotest_unpack_soft_bits_block;
+// src/modem/tests/modem_demodstats_autotest.c
+autotest_function_t autotest_demodstats_psk2;
+autotest_function_t autotest_demodstats_psk4;
+autotest_function_t autotest_demodstats_psk8;
+autotest_function_t autotest_demodstats_psk16;
+autotest_function_t autotest_demodstats_psk32;
+autotest_function_t autotest_demodstats_psk64;
+autotest_function_t autotest_demodstats_psk128;
+autotest_function_t autotest_demodstats_psk256;
+autotest_function_t autotest_demodstats_dpsk2;
+autotest_function_t autotest_demodstats_dpsk4;
+autotest_function_t autotest_demodstats_dpsk8;
+autotest_function_t autotest_demodstats_dpsk16;
+autotest_function_t autotest_demodstats_dpsk32;
+autotest_function_t autotest_demodstats_dpsk64;
+autotest_function_t autotest_demodstats_dpsk128;
+autotest_function_t autotest_demodstats_dpsk256;
+autotest_function_t autotest_demodstats_ask2;
+autotest_function_t autotest_demodstats_ask4;
+autotest_function_t autotest_demodstats_ask8;
+autotest_function_t autotest_demodstats_ask16;
+autotest_function_t autotest_demodstats_ask32;
+autotest_function_t autotest_demodstats_ask64;
+autotest_function_t autotest_demodstats_ask128;
+autotest_function_t autotest_demodstats_ask256;
+autotest_function_t autotest_demodstats_qam4;
+autotest_function_t autotest_demodstats_qam8;
+autotest_function_t autotest_demodstats_qam16;
+autotest_function_t autotest_demodstats_qam32;
+autotest_function_t autotest_demodstats_qam64;
+autotest_function_t autotest_demodstats_qam128;
+autotest_function_t autotest_demodstats_qam256;
+autotest_function_t autotest_demodstats_apsk4;
+autotest_function_t autotest_demodstats_apsk8;
+autotest_function_t autotest_demodstats_apsk16;
+autotest_function_t autotest_demodstats_apsk32;
+autotest_function_t autotest_demodstats_apsk64;
+autotest_function_t autotest_demodstats_apsk128;
+autotest_function_t autotest_demodstats_apsk256;
+autotest_function_t autotest_demodstats_bpsk;
+autotest_function_t autotest_demodstats_qpsk;
+autotest_function_t autotest_demodstats_ook;
+autotest_function_t autotest_demodstats_sqam32;
+autotest_function_t autotest_demodstats_sqam128;
+autotest_function_t autotest_demodstats_V29;
+autotest_function_t autotest_demodstats_arb16opt;
+autotest_function_t autotest_demodstats_arb32opt;
+autotest_function_t autotest_demodstats_arb64opt;
+autotest_function_t autotest_demodstats_arb128opt;
+autotest_function_t autotest_demodstats_arb256opt;
+autotest_function_t autotest_demodstats_arb64vt;
+// src/multichannel/tests/firpfbch2_crcf_autotest.c
+autotest_function_t autotest_firpfbch2_crcf_n8;
+autotest_function_t autotest_firpfbch2_crcf_n16;
+autotest_function_t autotest_firpfbch2_crcf_n32;
+autotest_function_t autotest_firpfbch2_crcf_n64;
+autotest_function_t autotest_firpfbch2_crcf_mask_analyzer_few;
+autotest_function_t autotest_firpfbch2_crcf_mask_analyzer_many;
+autotest_function_t autotest_firpfbch2_crcf_mask_synthesizer_few;
+autotest_function_t autotest_firpfbch2_crcf_mask_synthesizer_many;
+autotest_function_t autotest_firpfbch2_crcf_mask_block_analyzer_few;
+autotest_function_t autotest_firpfbch2_crcf_mask_block_analyzer_many;
+autotest_function_t autotest_firpfbch2_crcf_mask_block_synthesizer_few;
+autotest_function_t autotest_firpfbch2_crcf_mask_block_synthesizer_many;
+autotest_function_t autotest_firpfbch2_crcf_mask_clear_analyzer;
+autotest_function_t autotest_firpfbch2_crcf_mask_clear_synthesizer;
+// src/multichannel/tests/firpfbch_block_autotest.c
+autotest_function_t autotest_firpfbch_crcf_block_analyzer_n8;
+autotest_function_t autotest_firpfbch_crcf_block_analyzer_n10;
+autotest_function_t autotest_firpfbch_crcf_block_synthesizer_n8;
+autotest_function_t autotest_firpfbch_crcf_block_synthesizer_n10;
+autotest_function_t autotest_firpfbch2_crcf_block_analyzer_n8;
+autotest_function_t autotest_firpfbch2_crcf_block_analyzer_n10;
+autotest_function_t autotest_firpfbch2_crcf_block_synthesizer_n8;
+autotest_function_t autotest_firpfbch2_crcf_block_synthesizer_n10;
+// src/multichannel/tests/firpfbch_crcf_synthesizer_autotest.c
+autotest_function_t autotest_firpfbch_crcf_synthesis;
+// src/multichannel/tests/firpfbch_crcf_analyzer_autotest.c
+autotest_function_t autotest_firpfbch_crcf_analysis;
+// src/multichannel/tests/ofdmframesync_autotest.c
+autotest_function_t autotest_ofdmframesync_acquire_n64;
+autotest_function_t autotest_ofdmframesync_acquire_n128;
+autotest_function_t autotest_ofdmframesync_acquire_n256;
+autotest_function_t autotest_ofdmframesync_acquire_n512;
+// src/nco/tests/nco_crcf_frequency_autotest.c
+autotest_function_t autotest_nco_crcf_frequency;
+autotest_function_t autotest_vco_crcf_frequency;
+// src/nco/tests/nco_crcf_mix_autotest.c
+autotest_function_t autotest_nco_crcf_mix_block_nco;
+autotest_function_t autotest_nco_crcf_mix_block_interp;
+autotest_function_t autotest_nco_crcf_mix_block_vco;
+autotest_function_t autotest_nco_crcf_mix_block_down;
+autotest_function_t autotest_nco_crcf_accuracy_nco;
+autotest_function_t autotest_nco_crcf_accuracy_interp;
+autotest_function_t autotest_nco_crcf_accuracy_vco;
+autotest_function_t autotest_nco_crcf_constrain;
+// src/nco/tests/nco_crcf_phase_autotest.c
+autotest_function_t autotest_nco_crcf_phase;
+autotest_function_t autotest_vco_crcf_phase;
+autotest_function_t autotest_nco_basic;
+autotest_function_t autotest_nco_mixing;
+autotest_function_t autotest_nco_block_mixing;
+// src/nco/tests/nco_crcf_pll_autotest.c
+autotest_function_t autotest_vco_crcf_pll_phase;
+autotest_function_t autotest_nco_crcf_pll_phase;
+// src/nco/tests/unwrap_phase_autotest.c
+autotest_function_t autotest_nco_unwrap_phase;
+// src/optim/tests/gradsearch_autotest.c
+autotest_function_t autotest_gradsearch_rosenbrock;
+autotest_function_t autotest_gradsearch_maxutility;
+// src/quantization/tests/compand_autotest.c
+autotest_function_t autotest_compand_float;
+autotest_function_t autotest_compand_cfloat;
+// src/quantization/tests/quantize_autotest.c
+autotest_function_t autotest_quantize_float_n8;
+// src/random/tests/randgen_autotest.c
+autotest_function_t autotest_randgen_seed;
+autotest_function_t autotest_randgen_block;
+autotest_function_t autotest_randgen_uniform;
+autotest_function_t autotest_randgen_gauss;
+autotest_function_t autotest_randgen_cgauss;
+autotest_function_t autotest_randgen_ricek;
+autotest_function_t autotest_randgen_nakm;
+// src/random/tests/scramble_autotest.c
+autotest_function_t autotest_scramble_n16;
+autotest_function_t autotest_scramble_n64;
+autotest_function_t autotest_scramble_n256;
+autotest_function_t autotest_scramble_n11;
+autotest_function_t autotest_scramble_n33;
+autotest_function_t autotest_scramble_n277;
+autotest_function_t autotest_scramble_soft_n16;
+autotest_function_t autotest_scramble_soft_n64;
+autotest_function_t autotest_scramble_soft_n256;
+autotest_function_t autotest_scramble_soft_n11;
+autotest_function_t autotest_scramble_soft_n33;
+autotest_function_t autotest_scramble_soft_n277;
+// src/sequence/tests/bsequence_autotest.c
+autotest_function_t autotest_bsequence_init;
+autotest_function_t autotest_bsequence_correlate;
+autotest_function_t autotest_bsequence_add;
+autotest_function_t autotest_bsequence_mul;
+autotest_function_t autotest_bsequence_accumulate;
+autotest_function_t autotest_bsequence_correlate_long;
+// src/sequence/tests/complementary_codes_autotest.c
+autotest_function_t autotest_complementary_code_n8;
+autotest_function_t autotest_complementary_code_n16;
+autotest_function_t autotest_complementary_code_n32;
+autotest_function_t autotest_complementary_code_n64;
+autotest_function_t autotest_complementary_code_n128;
+autotest_function_t autotest_complementary_code_n256;
+autotest_function_t autotest_complementary_code_n512;
+// src/sequence/tests/msequence_autotest.c
+autotest_function_t autotest_bsequence_init_msequence;
+autotest_function_t autotest_msequence_m2;
+autotest_function_t autotest_msequence_m3;
+autotest_function_t autotest_msequence_m4;
+autotest_function_t autotest_msequence_m5;
+autotest_function_t autotest_msequence_m6;
+autotest_function_t autotest_msequence_m7;
+autotest_function_t autotest_msequence_m8;
+autotest_function_t autotest_msequence_m9;
+autotest_function_t autotest_msequence_m10;
+autotest_function_t autotest_msequence_m11;
+autotest_function_t autotest_msequence_m12;
+autotest_function_t autotest_msequence_generate_m2;
+autotest_function_t autotest_msequence_generate_m5;
+autotest_function_t autotest_msequence_generate_m8;
+autotest_function_t autotest_msequence_generate_m9;
+autotest_function_t autotest_msequence_generate_m15;
+autotest_function_t autotest_bsequence_init_msequence_length;
+// src/utility/tests/bshift_array_autotest.c
+autotest_function_t autotest_lbshift;
+autotest_function_t autotest_rbshift;
+autotest_function_t autotest_lbcircshift;
+autotest_function_t autotest_rbcircshift;
+// src/utility/tests/count_bits_autotest.c
+autotest_function_t autotest_count_ones;
+autotest_function_t autotest_count_ones_mod2;
+autotest_function_t autotest_bdotprod;
+autotest_function_t autotest_count_leading_zeros;
+autotest_function_t autotest_msb_index;
+// src/utility/tests/pack_bytes_autotest.c
+autotest_function_t autotest_pack_array;
+autotest_function_t autotest_unpack_array;
+autotest_function_t autotest_repack_array;
+autotest_function_t autotest_pack_bytes_01;
+autotest_function_t autotest_unpack_bytes_01;
+autotest_function_t autotest_repack_bytes_01;
+autotest_function_t autotest_repack_bytes_02;
+autotest_function_t autotest_repack_bytes_03;
+autotest_function_t autotest_repack_bytes_04_uneven;
+autotest_function_t autotest_pack_array_block;
+autotest_function_t autotest_pack_bytes_random;
+autotest_function_t autotest_repack_bytes_random;
+// src/utility/tests/shift_array_autotest.c
+autotest_function_t autotest_lshift;
+autotest_function_t autotest_rshift;
+autotest_function_t autotest_lcircshift;
+autotest_function_t autotest_rcircshift;
+
+// array of scripts
+autotest_t scripts[NUM_AUTOSCRIPTS] = {
+    {.id =    0, .api = &autotest_null,                                       .name = "null"},
+    {.id =    1, .api = &autotest_agc_crcf_dc_gain_control,                   .name = "agc_crcf_dc_gain_control"},
+    {.id =    2, .api = &autotest_agc_crcf_ac_gain_control,                   .name = "agc_crcf_ac_gain_control"},
+    {.id =    3, .api = &autotest_agc_crcf_rssi_sinusoid,                     .name = "agc_crcf_rssi_sinusoid"},
+    {.id =    4, .api = &autotest_agc_crcf_rssi_noise,                        .name = "agc_crcf_rssi_noise"},
+    {.id =    5, .api = &autotest_cvsd_rmse_sine,                             .name = "cvsd_rmse_sine"},
+    {.id =    6, .api = &autotest_cbufferf,                                   .name = "cbufferf"},
+    {.id =    7, .api = &autotest_cbuffercf,                                  .name = "cbuffercf"},
+    {.id =    8, .api = &autotest_cbufferf_flow,                              .name = "cbufferf_flow"},
+    {.id =    9, .api = &autotest_spscbufferf_wrap,                           .name = "spscbufferf_wrap"},
+    {.id =   10, .api = &autotest_spscbufferf_wrap_duplicated,                .name = "spscbufferf_wrap_duplicated"},
+    {.id =   11, .api = &autotest_spscbuffercf_partial,                       .name = "spscbuffercf_partial"},
+    {.id =   12, .api = &autotest_spscbufferf_close,                          .name = "spscbufferf_close"},
+    {.id =   13, .api = &autotest_spscbufferf_threads_block,                  .name = "spscbufferf_threads_block"},
+    {.id =   14, .api = &autotest_spscbufferf_threads_spin,                   .name = "spscbufferf_threads_spin"},
+    {.id =   15, .api = &autotest_spscbufferf_threads_block_duplicated,       .name = "spscbufferf_threads_block_duplicated"},
+    {.id =   16, .api = &autotest_spscbufferf_threads_spin_duplicated,        .name = "spscbufferf_threads_spin_duplicated"},
+    {.id =   17, .api = &autotest_wdelayf,                                    .name = "wdelayf"},
+    {.id =   18, .api = &autotest_wdelayf_write,                              .name = "wdelayf_write"},
+    {.id =   19, .api = &autotest_windowf,                                    .name = "windowf"},
+    {.id =   20, .api = &autotest_windowcf_layout_linear,                     .name = "windowcf_layout_linear"},
+    {.id =   21, .api = &autotest_windowcf_layout_duplicated,                 .name = "windowcf_layout_duplicated"},
+    {.id =   22, .api = &autotest_windowcf_layout_mirrored,                   .name = "windowcf_layout_mirrored"},
+    {.id =   23, .api = &autotest_windowcf_layout_auto,                       .name = "windowcf_layout_auto"},
+    {.id =   24, .api = &autotest_windowcf_layout_one,                        .name = "windowcf_layout_one"},
+    {.id =   25, .api = &autotest_windowcf_layout_page,                       .name = "windowcf_layout_page"},
+    {.id =   26, .api = &autotest_windowcf_layout_linear_page,                .name = "windowcf_layout_linear_page"},
+    {.id =   27, .api = &autotest_channel_cccf_randgen,                       .name = "channel_cccf_randgen"},
+    {.id =   28, .api = &autotest_channel_cccf_awgn,                          .name = "channel_cccf_awgn"},
+    {.id =   29, .api = &autotest_channel_cccf_block,                         .name = "channel_cccf_block"},
+    {.id =   30, .api = &autotest_dotprod_rrrf_basic,                         .name = "dotprod_rrrf_basic"},
+    {.id =   31, .api = &autotest_dotprod_rrrf_uneven,                        .name = "dotprod_rrrf_uneven"},
+    {.id =   32, .api = &autotest_dotprod_rrrf_struct,                        .name = "dotprod_rrrf_struct"},
+    {.id =   33, .api = &autotest_dotprod_rrrf_struct_align,                  .name = "dotprod_rrrf_struct_align"},
+    {.id =   34, .api = &autotest_dotprod_rrrf_rand01,                        .name = "dotprod_rrrf_rand01"},
+    {.id =   35, .api = &autotest_dotprod_rrrf_rand02,                        .name = "dotprod_rrrf_rand02"},
+    {.id =   36, .api = &autotest_dotprod_rrrf_struct_lengths,                .name = "dotprod_rrrf_struct_lengths"},
+    {.id =   37, .api = &autotest_dotprod_rrrf_struct_vs_ordinal,             .name = "dotprod_rrrf_struct_vs_ordinal"},
+    {.id =   38, .api = &autotest_dotprod_rrrf_execute_block,                 .name = "dotprod_rrrf_execute_block"},
+    {.id =   39, .api = &autotest_dotprod_crcf_rand01,                        .name = "dotprod_crcf_rand01"},
+    {.id =   40, .api = &autotest_dotprod_crcf_rand02,                        .name = "dotprod_crcf_rand02"},
+    {.id =   41, .api = &autotest_dotprod_crcf_struct_vs_ordinal,             .name = "dotprod_crcf_struct_vs_ordinal"},
+    {.id =   42, .api = &autotest_dotprod_crcf_execute_block,                 .name = "dotprod_crcf_execute_block"},
+    {.id =   43, .api = &autotest_dotprod_crcf_execute_split,                 .name = "dotprod_crcf_execute_split"},
+    {.id =   44, .api = &autotest_dotprod_crcf_execute_block_split,           .name = "dotprod_crcf_execute_block_split"},
+    {.id =   45, .api = &autotest_dotprod_cccf_rand16,                        .name = "dotprod_cccf_rand16"},
+    {.id =   46, .api = &autotest_dotprod_cccf_struct_lengths,                .name = "dotprod_cccf_struct_lengths"},
+    {.id =   47, .api = &autotest_dotprod_cccf_struct_vs_ordinal,             .name = "dotprod_cccf_struct_vs_ordinal"},
+    {.id =   48, .api = &autotest_dotprod_cccf_execute_block,                 .name = "dotprod_cccf_execute_block"},
+    {.id =   49, .api = &autotest_dotprod_cccf_execute_split,                 .name = "dotprod_cccf_execute_split"},
+    {.id =   50, .api = &autotest_dotprod_cccf_execute_block_split,           .name = "dotprod_cccf_execute_block_split"},
+    {.id =   51, .api = &autotest_sumsqf_3,                                   .name = "sumsqf_3"},
+    {.id =   52, .api = &autotest_sumsqf_4,                                   .name = "sumsqf_4"},
+    {.id =   53, .api = &autotest_sumsqf_7,                                   .name = "sumsqf_7"},
+    {.id =   54, .api = &autotest_sumsqf_8,                                   .name = "sumsqf_8"},
+    {.id =   55, .api = &autotest_sumsqf_15,                                  .name = "sumsqf_15"},
+    {.id =   56, .api = &autotest_sumsqf_16,                                  .name = "sumsqf_16"},
+    {.id =   57, .api = &autotest_sumsqcf_3,                                  .name = "sumsqcf_3"},
+    {.id =   58, .api = &autotest_sumsqcf_4,                                  .name = "sumsqcf_4"},
+    {.id =   59, .api = &autotest_sumsqcf_7,                                  .name = "sumsqcf_7"},
+    {.id =   60, .api = &autotest_sumsqcf_8,                                  .name = "sumsqcf_8"},
+    {.id =   61, .api = &autotest_sumsqcf_15,                                 .name = "sumsqcf_15"},
+    {.id =   62, .api = &autotest_sumsqcf_16,                                 .name = "sumsqcf_16"},
+    {.id =   63, .api = &autotest_eqlms_cccf_blind,                           .name = "eqlms_cccf_blind"},
+    {.id =   64, .api = &autotest_eqlms_cccf_decisiondirected,                .name = "eqlms_cccf_decisiondirected"},
+    {.id =   65, .api = &autotest_eqlms_cccf_block_fd_filter,                 .name = "eqlms_cccf_block_fd_filter"},
+    {.id =   66, .api = &autotest_eqlms_cccf_block_td,                        .name = "eqlms_cccf_block_td"},
+    {.id =   67, .api = &autotest_eqlms_cccf_block_fd,                        .name = "eqlms_cccf_block_fd"},
+    {.id =   68, .api = &autotest_eqlms_cccf_block_fd_long,                   .name = "eqlms_cccf_block_fd_long"},
+    {.id =   69, .api = &autotest_eqlms_cccf_block_size,                      .name = "eqlms_cccf_block_size"},
+    {.id =   70, .api = &autotest_eqlms_rrrf_block_fd_filter,                 .name = "eqlms_rrrf_block_fd_filter"},
+    {.id =   71, .api = &autotest_eqlms_rrrf_block_td,                        .name = "eqlms_rrrf_block_td"},
+    {.id =   72, .api = &autotest_eqlms_rrrf_block_fd,                        .name = "eqlms_rrrf_block_fd"},
+    {.id =   73, .api = &autotest_eqlms_rrrf_block_fd_long,                   .name = "eqlms_rrrf_block_fd_long"},
+    {.id =   74, .api = &autotest_eqrls_cccf_ftf,                             .name = "eqrls_cccf_ftf"},
+    {.id =   75, .api = &autotest_eqrls_cccf_ftf_long,                        .name = "eqrls_cccf_ftf_long"},
+    {.id =   76, .api = &autotest_eqrls_cccf_iqr,                             .name = "eqrls_cccf_iqr"},
+    {.id =   77, .api = &autotest_eqrls_rrrf_01,                              .name = "eqrls_rrrf_01"},
+    {.id =   78, .api = &autotest_eqrls_rrrf_ftf,                             .name = "eqrls_rrrf_ftf"},
+    {.id =   79, .api = &autotest_eqrls_rrrf_ftf_long,                        .name = "eqrls_rrrf_ftf_long"},
+    {.id =   80, .api = &autotest_eqrls_rrrf_iqr,                             .name = "eqrls_rrrf_iqr"},
+    {.id =   81, .api = &autotest_eqrls_rrrf_iqr_long,                        .name = "eqrls_rrrf_iqr_long"},
+    {.id =   82, .api = &autotest_eqrls_rrrf_ftf_rescue,                      .name = "eqrls_rrrf_ftf_rescue"},
+    {.id =   83, .api = &autotest_eqrls_rrrf_train_types,                     .name = "eqrls_rrrf_train_types"},
+    {.id =   84, .api = &autotest_reverse_byte,                               .name = "reverse_byte"},
+    {.id =   85, .api = &autotest_reverse_uint16,                             .name = "reverse_uint16"},
+    {.id =   86, .api = &autotest_reverse_uint32,                             .name = "reverse_uint32"},
+    {.id =   87, .api = &autotest_checksum,                                   .name = "checksum"},
+    {.id =   88, .api = &autotest_crc8,                                       .name = "crc8"},
+    {.id =   89, .api = &autotest_crc16,                                      .name = "crc16"},
+    {.id =   90, .api = &autotest_crc24,                                      .name = "crc24"},
+    {.id =   91, .api = &autotest_crc32,                                      .name = "crc32"},
+    {.id =   92, .api = &autotest_crc_reference,                              .name = "crc_reference"},
+    {.id =   93, .api = &autotest_crc_streaming,                              .name = "crc_streaming"},
+    {.id =   94, .api = &autotest_fec_r3,                                     .name = "fec_r3"},
+    {.id =   95, .api = &autotest_fec_r5,                                     .name = "fec_r5"},
+    {.id =   96, .api = &autotest_fec_h74,                                    .name = "fec_h74"},
+    {.id =   97, .api = &autotest_fec_h84,                                    .name = "fec_h84"},
+    {.id =   98, .api = &autotest_fec_h128,                                   .name = "fec_h128"},
+    {.id =   99, .api = &autotest_fec_g2412,                                  .name = "fec_g2412"},
+    {.id =  100, .api = &autotest_fec_secded2216,                             .name = "fec_secded2216"},
+    {.id =  101, .api = &autotest_fec_secded3932,                             .name = "fec_secded3932"},
+    {.id =  102, .api = &autotest_fec_secded7264,                             .name = "fec_secded7264"},
+    {.id =  103, .api = &autotest_fec_v27,                                    .name = "fec_v27"},
+    {.id =  104, .api = &autotest_fec_v29,                                    .name = "fec_v29"},
+    {.id =  105, .api = &autotest_fec_v39,                                    .name = "fec_v39"},
+    {.id =  106, .api = &autotest_fec_v615,                                   .name = "fec_v615"},
+    {.id =  107, .api = &autotest_fec_v27p23,                                 .name = "fec_v27p23"},
+    {.id =  108, .api = &autotest_fec_v27p34,                                 .name = "fec_v27p34"},
+    {.id =  109, .api = &autotest_fec_v27p45,                                 .name = "fec_v27p45"},
+    {.id =  110, .api = &autotest_fec_v27p56,                                 .name = "fec_v27p56"},
+    {.id =  111, .api = &autotest_fec_v27p67,                                 .name = "fec_v27p67"},
+    {.id =  112, .api = &autotest_fec_v27p78,                                 .name = "fec_v27p78"},
+    {.id =  113, .api = &autotest_fec_v29p23,                                 .name = "fec_v29p23"},
+    {.id =  114, .api = &autotest_fec_v29p34,                                 .name = "fec_v29p34"},
+    {.id =  115, .api = &autotest_fec_v29p45,                                 .name = "fec_v29p45"},
+    {.id =  116, .api = &autotest_fec_v29p56,                                 .name = "fec_v29p56"},
+    {.id =  117, .api = &autotest_fec_v29p67,                                 .name = "fec_v29p67"},
+    {.id =  118, .api = &autotest_fec_v29p78,                                 .name = "fec_v29p78"},
+    {.id =  119, .api = &autotest_fec_rs8,                                    .name = "fec_rs8"},
+    {.id =  120, .api = &autotest_fec_ldpc12,                                 .name = "fec_ldpc12"},
+    {.id =  121, .api = &autotest_fec_ldpc23,                                 .name = "fec_ldpc23"},
+    {.id =  122, .api = &autotest_fec_ldpc34,                                 .name = "fec_ldpc34"},
+    {.id =  123, .api = &autotest_fec_ldpc56,                                 .name = "fec_ldpc56"},
+    {.id =  124, .api = &autotest_fec_conv_v27_hard,                          .name = "fec_conv_v27_hard"},
+    {.id =  125, .api = &autotest_fec_conv_v29_hard,                          .name = "fec_conv_v29_hard"},
+    {.id =  126, .api = &autotest_fec_conv_v39_hard,                          .name = "fec_conv_v39_hard"},
+    {.id =  127, .api = &autotest_fec_conv_v615_hard,                         .name = "fec_conv_v615_hard"},
+    {.id =  128, .api = &autotest_fec_conv_v27p34_hard,                       .name = "fec_conv_v27p34_hard"},
+    {.id =  129, .api = &autotest_fec_conv_v29p23_hard,                       .name = "fec_conv_v29p23_hard"},
+    {.id =  130, .api = &autotest_fec_conv_v27_soft,                          .name = "fec_conv_v27_soft"},
+    {.id =  131, .api = &autotest_fec_conv_v29_soft,                          .name = "fec_conv_v29_soft"},
+    {.id =  132, .api = &autotest_fec_conv_v39_soft,                          .name = "fec_conv_v39_soft"},
+    {.id =  133, .api = &autotest_fec_conv_v615_soft,                         .name = "fec_conv_v615_soft"},
+    {.id =  134, .api = &autotest_fec_conv_viterbi_blocks,                    .name = "fec_conv_viterbi_blocks"},
+    {.id =  135, .api = &autotest_fec_conv_viterbi_kernels_v27,               .name = "fec_conv_viterbi_kernels_v27"},
+    {.id =  136, .api = &autotest_fec_conv_viterbi_kernels_v29,               .name = "fec_conv_viterbi_kernels_v29"},
+    {.id =  137, .api = &autotest_fec_conv_viterbi_kernels_v39,               .name = "fec_conv_viterbi_kernels_v39"},
+    {.id =  138, .api = &autotest_fec_conv_viterbi_kernels_v615,              .name = "fec_conv_viterbi_kernels_v615"},
+    {.id =  139, .api = &autotest_fec_conv_v27_exact,                         .name = "fec_conv_v27_exact"},
+    {.id =  140, .api = &autotest_fec_conv_v27p23_exact,                      .name = "fec_conv_v27p23_exact"},
+    {.id =  141, .api = &autotest_fec_conv_v27p34_exact,                      .name = "fec_conv_v27p34_exact"},
+    {.id =  142, .api = &autotest_fec_conv_v27p45_exact,                      .name = "fec_conv_v27p45_exact"},
+    {.id =  143, .api = &autotest_fec_conv_v27p56_exact,                      .name = "fec_conv_v27p56_exact"},
+    {.id =  144, .api = &autotest_fec_conv_v27p67_exact,                      .name = "fec_conv_v27p67_exact"},
+    {.id =  145, .api = &autotest_fec_conv_v27p78_exact,                      .name = "fec_conv_v27p78_exact"},
+    {.id =  146, .api = &autotest_fec_conv_v29p23_exact,                      .name = "fec_conv_v29p23_exact"},
+    {.id =  147, .api = &autotest_fec_conv_v29p78_exact,                      .name = "fec_conv_v29p78_exact"},
+    {.id =  148, .api = &autotest_fecsoft_r3,                                 .name = "fecsoft_r3"},
+    {.id =  149, .api = &autotest_fecsoft_r5,                                 .name = "fecsoft_r5"},
+    {.id =  150, .api = &autotest_fecsoft_h74,                                .name = "fecsoft_h74"},
+    {.id =  151, .api = &autotest_fecsoft_h84,                                .name = "fecsoft_h84"},
+    {.id =  152, .api = &autotest_fecsoft_h128,                               .name = "fecsoft_h128"},
+    {.id =  153, .api = &autotest_fecsoft_v27,                                .name = "fecsoft_v27"},
+    {.id =  154, .api = &autotest_fecsoft_v29,                                .name = "fecsoft_v29"},
+    {.id =  155, .api = &autotest_fecsoft_v39,                                .name = "fecsoft_v39"},
+    {.id =  156, .api = &autotest_fecsoft_v615,                               .name = "fecsoft_v615"},
+    {.id =  157, .api = &autotest_fecsoft_v27p23,                             .name = "fecsoft_v27p23"},
+    {.id =  158, .api = &autotest_fecsoft_v27p34,                             .name = "fecsoft_v27p34"},
+    {.id =  159, .api = &autotest_fecsoft_v27p45,                             .name = "fecsoft_v27p45"},
+    {.id =  160, .api = &autotest_fecsoft_v27p56,                             .name = "fecsoft_v27p56"},
+    {.id =  161, .api = &autotest_fecsoft_v27p67,                             .name = "fecsoft_v27p67"},
+    {.id =  162, .api = &autotest_fecsoft_v27p78,                             .name = "fecsoft_v27p78"},
+    {.id =  163, .api = &autotest_fecsoft_v29p23,                             .name = "fecsoft_v29p23"},
+    {.id =  164, .api = &autotest_fecsoft_v29p34,                             .name = "fecsoft_v29p34"},
+    {.id =  165, .api = &autotest_fecsoft_v29p45,                             .name = "fecsoft_v29p45"},
+    {.id =  166, .api = &autotest_fecsoft_v29p56,                             .name = "fecsoft_v29p56"},
+    {.id =  167, .api = &autotest_fecsoft_v29p67,                             .name = "fecsoft_v29p67"},
+    {.id =  168, .api = &autotest_fecsoft_v29p78,                             .name = "fecsoft_v29p78"},
+    {.id =  169, .api = &autotest_fecsoft_rs8,                                .name = "fecsoft_rs8"},
+    {.id =  170, .api = &autotest_fecsoft_ldpc12,                             .name = "fecsoft_ldpc12"},
+    {.id =  171, .api = &autotest_fecsoft_ldpc23,                             .name = "fecsoft_ldpc23"},
+    {.id =  172, .api = &autotest_fecsoft_ldpc34,                             .name = "fecsoft_ldpc34"},
+    {.id =  173, .api = &autotest_fecsoft_ldpc56,                             .name = "fecsoft_ldpc56"},
+    {.id =  174, .api = &autotest_golay2412_codec,                            .name = "golay2412_codec"},
+    {.id =  175, .api = &autotest_golay2412_gentab,                           .name = "golay2412_gentab"},
+    {.id =  176, .api = &autotest_hamming74_codec,                            .name = "hamming74_codec"},
+    {.id =  177, .api = &autotest_hamming74_codec_soft,                       .name = "hamming74_codec_soft"},
+    {.id =  178, .api = &autotest_hamming84_codec,                            .name = "hamming84_codec"},
+    {.id =  179, .api = &autotest_hamming84_codec_soft,                       .name = "hamming84_codec_soft"},
+    {.id =  180, .api = &autotest_hamming128_codec,                           .name = "hamming128_codec"},
+    {.id =  181, .api = &autotest_hamming128_codec_soft,                      .name = "hamming128_codec_soft"},
+    {.id =  182, .api = &autotest_hamming128_gentab,                          .name = "hamming128_gentab"},
+    {.id =  183, .api = &autotest_hamming128_codec_soft_ml,                   .name = "hamming128_codec_soft_ml"},
+    {.id =  184, .api = &autotest_hamming1511_codec,                          .name = "hamming1511_codec"},
+    {.id =  185, .api = &autotest_hamming3126_codec,                          .name = "hamming3126_codec"},
+    {.id =  186, .api = &autotest_fec_ldpc_codeword_r12_z27,                  .name = "fec_ldpc_codeword_r12_z27"},
+    {.id =  187, .api = &autotest_fec_ldpc_codeword_r23_z54,                  .name = "fec_ldpc_codeword_r23_z54"},
+    {.id =  188, .api = &autotest_fec_ldpc_codeword_r34_z81,                  .name = "fec_ldpc_codeword_r34_z81"},
+    {.id =  189, .api = &autotest_fec_ldpc_codeword_r56_z81,                  .name = "fec_ldpc_codeword_r56_z81"},
+    {.id =  190, .api = &autotest_fec_ldpc_codeword_r12_z675,                 .name = "fec_ldpc_codeword_r12_z675"},
+    {.id =  191, .api = &autotest_fec_ldpc_awgn_r12,                          .name = "fec_ldpc_awgn_r12"},
+    {.id =  192, .api = &autotest_fec_ldpc_awgn_r23,                          .name = "fec_ldpc_awgn_r23"},
+    {.id =  193, .api = &autotest_fec_ldpc_awgn_r34,                          .name = "fec_ldpc_awgn_r34"},
+    {.id =  194, .api = &autotest_fec_ldpc_awgn_r56,                          .name = "fec_ldpc_awgn_r56"},
+    {.id =  195, .api = &autotest_fec_ldpc_kernels_r12_z27,                   .name = "fec_ldpc_kernels_r12_z27"},
+    {.id =  196, .api = &autotest_fec_ldpc_kernels_r23_z54,                   .name = "fec_ldpc_kernels_r23_z54"},
+    {.id =  197, .api = &autotest_fec_ldpc_kernels_r56_z81,                   .name = "fec_ldpc_kernels_r56_z81"},
+    {.id =  198, .api = &autotest_fec_ldpc_kernels_r34_z675,                  .name = "fec_ldpc_kernels_r34_z675"},
+    {.id =  199, .api = &autotest_fec_ldpc_sumproduct,                        .name = "fec_ldpc_sumproduct"},
+    {.id =  200, .api = &autotest_fec_ldpc_length_n1,                         .name = "fec_ldpc_length_n1"},
+    {.id =  201, .api = &autotest_fec_ldpc_length_n57,                        .name = "fec_ldpc_length_n57"},
+    {.id =  202, .api = &autotest_fec_ldpc_length_n1000,                      .name = "fec_ldpc_length_n1000"},
+    {.id =  203, .api = &autotest_fec_ldpc_length_n10000,                     .name = "fec_ldpc_length_n10000"},
+    {.id =  204, .api = &autotest_reedsolomon_223_255,                        .name = "reedsolomon_223_255"},
+    {.id =  205, .api = &autotest_reedsolomon_codeword,                       .name = "reedsolomon_codeword"},
+    {.id =  206, .api = &autotest_reedsolomon_errors_k223,                    .name = "reedsolomon_errors_k223"},
+    {.id =  207, .api = &autotest_reedsolomon_errors_k100,                    .name = "reedsolomon_errors_k100"},
+    {.id =  208, .api = &autotest_reedsolomon_errors_k1,                      .name = "reedsolomon_errors_k1"},
+    {.id =  209, .api = &autotest_reedsolomon_kernels_r32_k223,               .name = "reedsolomon_kernels_r32_k223"},
+    {.id =  210, .api = &autotest_reedsolomon_kernels_r32_k1,                 .name = "reedsolomon_kernels_r32_k1"},
+    {.id =  211, .api = &autotest_reedsolomon_kernels_r16_k100,               .name = "reedsolomon_kernels_r16_k100"},
+    {.id =  212, .api = &autotest_reedsolomon_kernels_r7_k31,                 .name = "reedsolomon_kernels_r7_k31"},
+    {.id =  213, .api = &autotest_reedsolomon_1024,                           .name = "reedsolomon_1024"},
+    {.id =  214, .api = &autotest_rep3_codec,                                 .name = "rep3_codec"},
+    {.id =  215, .api = &autotest_rep5_codec,                                 .name = "rep5_codec"},
+    {.id =  216, .api = &autotest_secded2216_codec_e0,                        .name = "secded2216_codec_e0"},
+    {.id =  217, .api = &autotest_secded2216_codec_e1,                        .name = "secded2216_codec_e1"},
+    {.id =  218, .api = &autotest_secded2216_codec_e2,                        .name = "secded2216_codec_e2"},
+    {.id =  219, .api = &autotest_secded3932_codec_e0,                        .name = "secded3932_codec_e0"},
+    {.id =  220, .api = &autotest_secded3932_codec_e1,                        .name = "secded3932_codec_e1"},
+    {.id =  221, .api = &autotest_secded3932_codec_e2,                        .name = "secded3932_codec_e2"},
+    {.id =  222, .api = &autotest_secded7264_codec_e0,                        .name = "secded7264_codec_e0"},
+    {.id =  223, .api = &autotest_secded7264_codec_e1,                        .name = "secded7264_codec_e1"},
+    {.id =  224, .api = &autotest_secded7264_codec_e2,                        .name = "secded7264_codec_e2"},
+    {.id =  225, .api = &autotest_interleaver_hard_8,                         .name = "interleaver_hard_8"},
+    {.id =  226, .api = &autotest_interleaver_hard_16,                        .name = "interleaver_hard_16"},
+    {.id =  227, .api = &autotest_interleaver_hard_64,                        .name = "interleaver_hard_64"},
+    {.id =  228, .api = &autotest_interleaver_hard_256,                       .name = "interleaver_hard_256"},
+    {.id =  229, .api = &autotest_interleaver_soft_8,                         .name = "interleaver_soft_8"},
+    {.id =  230, .api = &autotest_interleaver_soft_16,                        .name = "interleaver_soft_16"},
+    {.id =  231, .api = &autotest_interleaver_soft_64,                        .name = "interleaver_soft_64"},
+    {.id =  232, .api = &autotest_interleaver_soft_256,                       .name = "interleaver_soft_256"},
+    {.id =  233, .api = &autotest_interleaver_hard_output,                    .name = "interleaver_hard_output"},
+    {.id =  234, .api = &autotest_interleaver_hard_soft_d0,                   .name = "interleaver_hard_soft_d0"},
+    {.id =  235, .api = &autotest_interleaver_hard_soft_d1,                   .name = "interleaver_hard_soft_d1"},
+    {.id =  236, .api = &autotest_interleaver_hard_soft_d2,                   .name = "interleaver_hard_soft_d2"},
+    {.id =  237, .api = &autotest_interleaver_hard_soft_d3,                   .name = "interleaver_hard_soft_d3"},
+    {.id =  238, .api = &autotest_interleaver_hard_soft_d4,                   .name = "interleaver_hard_soft_d4"},
+    {.id =  239, .api = &autotest_interleaver_block,                          .name = "interleaver_block"},
+    {.id =  240, .api = &autotest_packetizer_n16_0_0,                         .name = "packetizer_n16_0_0"},
+    {.id =  241, .api = &autotest_packetizer_n16_0_1,                         .name = "packetizer_n16_0_1"},
+    {.id =  242, .api = &autotest_packetizer_n16_0_2,                         .name = "packetizer_n16_0_2"},
+    {.id =  243, .api = &autotest_fft_3,                                      .name = "fft_3"},
+    {.id =  244, .api = &autotest_fft_5,                                      .name = "fft_5"},
+    {.id =  245, .api = &autotest_fft_6,                                      .name = "fft_6"},
+    {.id =  246, .api = &autotest_fft_7,                                      .name = "fft_7"},
+    {.id =  247, .api = &autotest_fft_9,                                      .name = "fft_9"},
+    {.id =  248, .api = &autotest_fft_2,                                      .name = "fft_2"},
+    {.id =  249, .api = &autotest_fft_4,                                      .name = "fft_4"},
+    {.id =  250, .api = &autotest_fft_8,                                      .name = "fft_8"},
+    {.id =  251, .api = &autotest_fft_16,                                     .name = "fft_16"},
+    {.id =  252, .api = &autotest_fft_32,                                     .name = "fft_32"},
+    {.id =  253, .api = &autotest_fft_64,                                     .name = "fft_64"},
+    {.id =  254, .api = &autotest_fft_10,                                     .name = "fft_10"},
+    {.id =  255, .api = &autotest_fft_21,                                     .name = "fft_21"},
+    {.id =  256, .api = &autotest_fft_22,                                     .name = "fft_22"},
+    {.id =  257, .api = &autotest_fft_24,                                     .name = "fft_24"},
+    {.id =  258, .api = &autotest_fft_26,                                     .name = "fft_26"},
+    {.id =  259, .api = &autotest_fft_30,                                     .name = "fft_30"},
+    {.id =  260, .api = &autotest_fft_35,                                     .name = "fft_35"},
+    {.id =  261, .api = &autotest_fft_36,                                     .name = "fft_36"},
+    {.id =  262, .api = &autotest_fft_48,                                     .name = "fft_48"},
+    {.id =  263, .api = &autotest_fft_63,                                     .name = "fft_63"},
+    {.id =  264, .api = &autotest_fft_92,                                     .name = "fft_92"},
+    {.id =  265, .api = &autotest_fft_96,                                     .name = "fft_96"},
+    {.id =  266, .api = &autotest_fft_120,                                    .name = "fft_120"},
+    {.id =  267, .api = &autotest_fft_130,                                    .name = "fft_130"},
+    {.id =  268, .api = &autotest_fft_192,                                    .name = "fft_192"},
+    {.id =  269, .api = &autotest_fft_17,                                     .name = "fft_17"},
+    {.id =  270, .api = &autotest_fft_43,                                     .name = "fft_43"},
+    {.id =  271, .api = &autotest_fft_79,                                     .name = "fft_79"},
+    {.id =  272, .api = &autotest_fft_157,                                    .name = "fft_157"},
+    {.id =  273, .api = &autotest_fft_317,                                    .name = "fft_317"},
+    {.id =  274, .api = &autotest_fft_509,                                    .name = "fft_509"},
+    {.id =  275, .api = &autotest_fft_r2r_REDFT00_n8,                         .name = "fft_r2r_REDFT00_n8"},
+    {.id =  276, .api = &autotest_fft_r2r_REDFT10_n8,                         .name = "fft_r2r_REDFT10_n8"},
+    {.id =  277, .api = &autotest_fft_r2r_REDFT01_n8,                         .name = "fft_r2r_REDFT01_n8"},
+    {.id =  278, .api = &autotest_fft_r2r_REDFT11_n8,                         .name = "fft_r2r_REDFT11_n8"},
+    {.id =  279, .api = &autotest_fft_r2r_RODFT00_n8,                         .name = "fft_r2r_RODFT00_n8"},
+    {.id =  280, .api = &autotest_fft_r2r_RODFT10_n8,                         .name = "fft_r2r_RODFT10_n8"},
+    {.id =  281, .api = &autotest_fft_r2r_RODFT01_n8,                         .name = "fft_r2r_RODFT01_n8"},
+    {.id =  282, .api = &autotest_fft_r2r_RODFT11_n8,                         .name = "fft_r2r_RODFT11_n8"},
+    {.id =  283, .api = &autotest_fft_r2r_REDFT00_n32,                        .name = "fft_r2r_REDFT00_n32"},
+    {.id =  284, .api = &autotest_fft_r2r_REDFT10_n32,                        .name = "fft_r2r_REDFT10_n32"},
+    {.id =  285, .api = &autotest_fft_r2r_REDFT01_n32,                        .name = "fft_r2r_REDFT01_n32"},
+    {.id =  286, .api = &autotest_fft_r2r_REDFT11_n32,                        .name = "fft_r2r_REDFT11_n32"},
+    {.id =  287, .api = &autotest_fft_r2r_RODFT00_n32,                        .name = "fft_r2r_RODFT00_n32"},
+    {.id =  288, .api = &autotest_fft_r2r_RODFT10_n32,                        .name = "fft_r2r_RODFT10_n32"},
+    {.id =  289, .api = &autotest_fft_r2r_RODFT01_n32,                        .name = "fft_r2r_RODFT01_n32"},
+    {.id =  290, .api = &autotest_fft_r2r_RODFT11_n32,                        .name = "fft_r2r_RODFT11_n32"},
+    {.id =  291, .api = &autotest_fft_r2r_REDFT00_n27,                        .name = "fft_r2r_REDFT00_n27"},
+    {.id =  292, .api = &autotest_fft_r2r_REDFT10_n27,                        .name = "fft_r2r_REDFT10_n27"},
+    {.id =  293, .api = &autotest_fft_r2r_REDFT01_n27,                        .name = "fft_r2r_REDFT01_n27"},
+    {.id =  294, .api = &autotest_fft_r2r_REDFT11_n27,                        .name = "fft_r2r_REDFT11_n27"},
+    {.id =  295, .api = &autotest_fft_r2r_RODFT00_n27,                        .name = "fft_r2r_RODFT00_n27"},
+    {.id =  296, .api = &autotest_fft_r2r_RODFT10_n27,                        .name = "fft_r2r_RODFT10_n27"},
+    {.id =  297, .api = &autotest_fft_r2r_RODFT01_n27,                        .name = "fft_r2r_RODFT01_n27"},
+    {.id =  298, .api = &autotest_fft_r2r_RODFT11_n27,                        .name = "fft_r2r_RODFT11_n27"},
+    {.id =  299, .api = &autotest_fft_shift_4,                                .name = "fft_shift_4"},
+    {.id =  300, .api = &autotest_fft_shift_8,                                .name = "fft_shift_8"},
+    {.id =  301, .api = &autotest_fft_radix2_1024,                            .name = "fft_radix2_1024"},
+    {.id =  302, .api = &autotest_fft_radix2_2048,                            .name = "fft_radix2_2048"},
+    {.id =  303, .api = &autotest_fft_execute_arrays,                         .name = "fft_execute_arrays"},
+    {.id =  304, .api = &autotest_fft_batch_contiguous,                       .name = "fft_batch_contiguous"},
+    {.id =  305, .api = &autotest_fft_batch_inplace,                          .name = "fft_batch_inplace"},
+    {.id =  306, .api = &autotest_fft_batch_strided,                          .name = "fft_batch_strided"},
+    {.id =  307, .api = &autotest_fft_batch_transpose,                        .name = "fft_batch_transpose"},
+    {.id =  308, .api = &autotest_fft_batch_padded,                           .name = "fft_batch_padded"},
+    {.id =  309, .api = &autotest_autocorr_cccf_block_w1_d1,                  .name = "autocorr_cccf_block_w1_d1"},
+    {.id =  310, .api = &autotest_autocorr_cccf_block_w4_d2,                  .name = "autocorr_cccf_block_w4_d2"},
+    {.id =  311, .api = &autotest_autocorr_cccf_block_w16_d5,                 .name = "autocorr_cccf_block_w16_d5"},
+    {.id =  312, .api = &autotest_autocorr_cccf_block_w64_d64,                .name = "autocorr_cccf_block_w64_d64"},
+    {.id =  313, .api = &autotest_autocorr_cccf_block_w100_d7,                .name = "autocorr_cccf_block_w100_d7"},
+    {.id =  314, .api = &autotest_autocorr_rrrf_block_w1_d1,                  .name = "autocorr_rrrf_block_w1_d1"},
+    {.id =  315, .api = &autotest_autocorr_rrrf_block_w4_d2,                  .name = "autocorr_rrrf_block_w4_d2"},
+    {.id =  316, .api = &autotest_autocorr_rrrf_block_w16_d5,                 .name = "autocorr_rrrf_block_w16_d5"},
+    {.id =  317, .api = &autotest_autocorr_rrrf_block_w64_d64,                .name = "autocorr_rrrf_block_w64_d64"},
+    {.id =  318, .api = &autotest_autocorr_rrrf_block_w100_d7,                .name = "autocorr_rrrf_block_w100_d7"},
+    {.id =  319, .api = &autotest_fftfilt_rrrf_data_h4x256,                   .name = "fftfilt_rrrf_data_h4x256"},
+    {.id =  320, .api = &autotest_fftfilt_rrrf_data_h7x256,                   .name = "fftfilt_rrrf_data_h7x256"},
+    {.id =  321, .api = &autotest_fftfilt_rrrf_data_h13x256,                  .name = "fftfilt_rrrf_data_h13x256"},
+    {.id =  322, .api = &autotest_fftfilt_rrrf_data_h23x256,                  .name = "fftfilt_rrrf_data_h23x256"},
+    {.id =  323, .api = &autotest_fftfilt_crcf_data_h4x256,                   .name = "fftfilt_crcf_data_h4x256"},
+    {.id =  324, .api = &autotest_fftfilt_crcf_data_h7x256,                   .name = "fftfilt_crcf_data_h7x256"},
+    {.id =  325, .api = &autotest_fftfilt_crcf_data_h13x256,                  .name = "fftfilt_crcf_data_h13x256"},
+    {.id =  326, .api = &autotest_fftfilt_crcf_data_h23x256,                  .name = "fftfilt_crcf_data_h23x256"},
+    {.id =  327, .api = &autotest_fftfilt_cccf_data_h4x256,                   .name = "fftfilt_cccf_data_h4x256"},
+    {.id =  328, .api = &autotest_fftfilt_cccf_data_h7x256,                   .name = "fftfilt_cccf_data_h7x256"},
+    {.id =  329, .api = &autotest_fftfilt_cccf_data_h13x256,                  .name = "fftfilt_cccf_data_h13x256"},
+    {.id =  330, .api = &autotest_fftfilt_cccf_data_h23x256,                  .name = "fftfilt_cccf_data_h23x256"},
+    {.id =  331, .api = &autotest_filter_crosscorr_rrrf,                      .name = "filter_crosscorr_rrrf"},
+    {.id =  332, .api = &autotest_firdecim_rrrf_data_M2h4x20,                 .name = "firdecim_rrrf_data_M2h4x20"},
+    {.id =  333, .api = &autotest_firdecim_rrrf_data_M3h7x30,                 .name = "firdecim_rrrf_data_M3h7x30"},
+    {.id =  334, .api = &autotest_firdecim_rrrf_data_M4h13x40,                .name = "firdecim_rrrf_data_M4h13x40"},
+    {.id =  335, .api = &autotest_firdecim_rrrf_data_M5h23x50,                .name = "firdecim_rrrf_data_M5h23x50"},
+    {.id =  336, .api = &autotest_firdecim_crcf_data_M2h4x20,                 .name = "firdecim_crcf_data_M2h4x20"},
+    {.id =  337, .api = &autotest_firdecim_crcf_data_M3h7x30,                 .name = "firdecim_crcf_data_M3h7x30"},
+    {.id =  338, .api = &autotest_firdecim_crcf_data_M4h13x40,                .name = "firdecim_crcf_data_M4h13x40"},
+    {.id =  339, .api = &autotest_firdecim_crcf_data_M5h23x50,                .name = "firdecim_crcf_data_M5h23x50"},
+    {.id =  340, .api = &autotest_firdecim_cccf_data_M2h4x20,                 .name = "firdecim_cccf_data_M2h4x20"},
+    {.id =  341, .api = &autotest_firdecim_cccf_data_M3h7x30,                 .name = "firdecim_cccf_data_M3h7x30"},
+    {.id =  342, .api = &autotest_firdecim_cccf_data_M4h13x40,                .name = "firdecim_cccf_data_M4h13x40"},
+    {.id =  343, .api = &autotest_firdecim_cccf_data_M5h23x50,                .name = "firdecim_cccf_data_M5h23x50"},
+    {.id =  344, .api = &autotest_liquid_firdes_rcos,                         .name = "liquid_firdes_rcos"},
+    {.id =  345, .api = &autotest_liquid_firdes_rrcos,                        .name = "liquid_firdes_rrcos"},
+    {.id =  346, .api = &autotest_liquid_firdes_rkaiser,                      .name = "liquid_firdes_rkaiser"},
+    {.id =  347, .api = &autotest_firdespm_bandpass_n24,                      .name = "firdespm_bandpass_n24"},
+    {.id =  348, .api = &autotest_firdespm_bandpass_n32,                      .name = "firdespm_bandpass_n32"},
+    {.id =  349, .api = &autotest_firfilt_rrrf_data_h4x8,                     .name = "firfilt_rrrf_data_h4x8"},
+    {.id =  350, .api = &autotest_firfilt_rrrf_data_h7x16,                    .name = "firfilt_rrrf_data_h7x16"},
+    {.id =  351, .api = &autotest_firfilt_rrrf_data_h13x32,                   .name = "firfilt_rrrf_data_h13x32"},
+    {.id =  352, .api = &autotest_firfilt_rrrf_data_h23x64,                   .name = "firfilt_rrrf_data_h23x64"},
+    {.id =  353, .api = &autotest_firfilt_crcf_data_h4x8,                     .name = "firfilt_crcf_data_h4x8"},
+    {.id =  354, .api = &autotest_firfilt_crcf_data_h7x16,                    .name = "firfilt_crcf_data_h7x16"},
+    {.id =  355, .api = &autotest_firfilt_crcf_data_h13x32,                   .name = "firfilt_crcf_data_h13x32"},
+    {.id =  356, .api = &autotest_firfilt_crcf_data_h23x64,                   .name = "firfilt_crcf_data_h23x64"},
+    {.id =  357, .api = &autotest_firfilt_cccf_data_h4x8,                     .name = "firfilt_cccf_data_h4x8"},
+    {.id =  358, .api = &autotest_firfilt_cccf_data_h7x16,                    .name = "firfilt_cccf_data_h7x16"},
+    {.id =  359, .api = &autotest_firfilt_cccf_data_h13x32,                   .name = "firfilt_cccf_data_h13x32"},
+    {.id =  360, .api = &autotest_firfilt_cccf_data_h23x64,                   .name = "firfilt_cccf_data_h23x64"},
+    {.id =  361, .api = &autotest_firhilbf_decim,                             .name = "firhilbf_decim"},
+    {.id =  362, .api = &autotest_firhilbf_interp,                            .name = "firhilbf_interp"},
+    {.id =  363, .api = &autotest_firinterp_rrrf_generic,                     .name = "firinterp_rrrf_generic"},
+    {.id =  364, .api = &autotest_firinterp_crcf_generic,                     .name = "firinterp_crcf_generic"},
+    {.id =  365, .api = &autotest_firpfb_impulse_response,                    .name = "firpfb_impulse_response"},
+    {.id =  366, .api = &autotest_fir_groupdelay_n3,                          .name = "fir_groupdelay_n3"},
+    {.id =  367, .api = &autotest_iir_groupdelay_n3,                          .name = "iir_groupdelay_n3"},
+    {.id =  368, .api = &autotest_iir_groupdelay_n8,                          .name = "iir_groupdelay_n8"},
+    {.id =  369, .api = &autotest_iir_groupdelay_sos_n8,                      .name = "iir_groupdelay_sos_n8"},
+    {.id =  370, .api = &autotest_iirdes_butter_2,                            .name = "iirdes_butter_2"},
+    {.id =  371, .api = &autotest_iirdes_cplxpair_n6,                         .name = "iirdes_cplxpair_n6"},
+    {.id =  372, .api = &autotest_iirdes_cplxpair_n20,                        .name = "iirdes_cplxpair_n20"},
+    {.id =  373, .api = &autotest_iirdes_dzpk2sosf,                           .name = "iirdes_dzpk2sosf"},
+    {.id =  374, .api = &autotest_iirdes_isstable_n2_yes,                     .name = "iirdes_isstable_n2_yes"},
+    {.id =  375, .api = &autotest_iirdes_isstable_n2_no,                      .name = "iirdes_isstable_n2_no"},
+    {.id =  376, .api = &autotest_iirfilt_rrrf_h3x64,                         .name = "iirfilt_rrrf_h3x64"},
+    {.id =  377, .api = &autotest_iirfilt_rrrf_h5x64,                         .name = "iirfilt_rrrf_h5x64"},
+    {.id =  378, .api = &autotest_iirfilt_rrrf_h7x64,                         .name = "iirfilt_rrrf_h7x64"},
+    {.id =  379, .api = &autotest_iirfilt_crcf_h3x64,                         .name = "iirfilt_crcf_h3x64"},
+    {.id =  380, .api = &autotest_iirfilt_crcf_h5x64,                         .name = "iirfilt_crcf_h5x64"},
+    {.id =  381, .api = &autotest_iirfilt_crcf_h7x64,                         .name = "iirfilt_crcf_h7x64"},
+    {.id =  382, .api = &autotest_iirfilt_cccf_h3x64,                         .name = "iirfilt_cccf_h3x64"},
+    {.id =  383, .api = &autotest_iirfilt_cccf_h5x64,                         .name = "iirfilt_cccf_h5x64"},
+    {.id =  384, .api = &autotest_iirfilt_cccf_h7x64,                         .name = "iirfilt_cccf_h7x64"},
+    {.id =  385, .api = &autotest_iirfiltsos_impulse_n2,                      .name = "iirfiltsos_impulse_n2"},
+    {.id =  386, .api = &autotest_iirfiltsos_step_n2,                         .name = "iirfiltsos_step_n2"},
+    {.id =  387, .api = &autotest_msresamp_crcf,                              .name = "msresamp_crcf"},
+    {.id =  388, .api = &autotest_resamp_crcf,                                .name = "resamp_crcf"},
+    {.id =  389, .api = &autotest_resamp2_analysis,                           .name = "resamp2_analysis"},
+    {.id =  390, .api = &autotest_resamp2_synthesis,                          .name = "resamp2_synthesis"},
+    {.id =  391, .api = &autotest_symsync_crcf_scenario_0,                    .name = "symsync_crcf_scenario_0"},
+    {.id =  392, .api = &autotest_symsync_crcf_scenario_1,                    .name = "symsync_crcf_scenario_1"},
+    {.id =  393, .api = &autotest_symsync_crcf_scenario_2,                    .name = "symsync_crcf_scenario_2"},
+    {.id =  394, .api = &autotest_symsync_crcf_scenario_3,                    .name = "symsync_crcf_scenario_3"},
+    {.id =  395, .api = &autotest_symsync_rrrf_scenario_0,                    .name = "symsync_rrrf_scenario_0"},
+    {.id =  396, .api = &autotest_symsync_rrrf_scenario_1,                    .name = "symsync_rrrf_scenario_1"},
+    {.id =  397, .api = &autotest_symsync_rrrf_scenario_2,                    .name = "symsync_rrrf_scenario_2"},
+    {.id =  398, .api = &autotest_symsync_rrrf_scenario_3,                    .name = "symsync_rrrf_scenario_3"},
+    {.id =  399, .api = &autotest_bpacketsync,                                .name = "bpacketsync"},
+    {.id =  400, .api = &autotest_bsync_rrrf_15,                              .name = "bsync_rrrf_15"},
+    {.id =  401, .api = &autotest_bsync_crcf_15,                              .name = "bsync_crcf_15"},
+    {.id =  402, .api = &autotest_detector_cccf_n64,                          .name = "detector_cccf_n64"},
+    {.id =  403, .api = &autotest_detector_cccf_n83,                          .name = "detector_cccf_n83"},
+    {.id =  404, .api = &autotest_detector_cccf_n128,                         .name = "detector_cccf_n128"},
+    {.id =  405, .api = &autotest_detector_cccf_n167,                         .name = "detector_cccf_n167"},
+    {.id =  406, .api = &autotest_detector_cccf_n256,                         .name = "detector_cccf_n256"},
+    {.id =  407, .api = &autotest_detector_cccf_n335,                         .name = "detector_cccf_n335"},
+    {.id =  408, .api = &autotest_detector_cccf_n512,                         .name = "detector_cccf_n512"},
+    {.id =  409, .api = &autotest_detector_cccf_n671,                         .name = "detector_cccf_n671"},
+    {.id =  410, .api = &autotest_detector_cccf_n1024,                        .name = "detector_cccf_n1024"},
+    {.id =  411, .api = &autotest_detector_cccf_n1341,                        .name = "detector_cccf_n1341"},
+    {.id =  412, .api = &autotest_flexframesync,                              .name = "flexframesync"},
+    {.id =  413, .api = &autotest_flexframesync_reconfig,                     .name = "flexframesync_reconfig"},
+    {.id =  414, .api = &autotest_flexframesync_threads,                      .name = "flexframesync_threads"},
+    {.id =  415, .api = &autotest_framecache,                                 .name = "framecache"},
+    {.id =  416, .api = &autotest_framesync64,                                .name = "framesync64"},
+    {.id =  417, .api = &autotest_framesync64_threads,                        .name = "framesync64_threads"},
+    {.id =  418, .api = &autotest_qdetector_cccf_linear_n64,                  .name = "qdetector_cccf_linear_n64"},
+    {.id =  419, .api = &autotest_qdetector_cccf_linear_n83,                  .name = "qdetector_cccf_linear_n83"},
+    {.id =  420, .api = &autotest_qdetector_cccf_linear_n128,                 .name = "qdetector_cccf_linear_n128"},
+    {.id =  421, .api = &autotest_qdetector_cccf_linear_n167,                 .name = "qdetector_cccf_linear_n167"},
+    {.id =  422, .api = &autotest_qdetector_cccf_linear_n256,                 .name = "qdetector_cccf_linear_n256"},
+    {.id =  423, .api = &autotest_qdetector_cccf_linear_n335,                 .name = "qdetector_cccf_linear_n335"},
+    {.id =  424, .api = &autotest_qdetector_cccf_linear_n512,                 .name = "qdetector_cccf_linear_n512"},
+    {.id =  425, .api = &autotest_qdetector_cccf_linear_n671,                 .name = "qdetector_cccf_linear_n671"},
+    {.id =  426, .api = &autotest_qdetector_cccf_linear_n1024,                .name = "qdetector_cccf_linear_n1024"},
+    {.id =  427, .api = &autotest_qdetector_cccf_linear_n1341,                .name = "qdetector_cccf_linear_n1341"},
+    {.id =  428, .api = &autotest_qdetector_cccf_gmsk_n64,                    .name = "qdetector_cccf_gmsk_n64"},
+    {.id =  429, .api = &autotest_qdetector_cccf_gmsk_n83,                    .name = "qdetector_cccf_gmsk_n83"},
+    {.id =  430, .api = &autotest_qdetector_cccf_gmsk_n128,                   .name = "qdetector_cccf_gmsk_n128"},
+    {.id =  431, .api = &autotest_qdetector_cccf_gmsk_n167,                   .name = "qdetector_cccf_gmsk_n167"},
+    {.id =  432, .api = &autotest_qdetector_cccf_gmsk_n256,                   .name = "qdetector_cccf_gmsk_n256"},
+    {.id =  433, .api = &autotest_qdetector_cccf_gmsk_n335,                   .name = "qdetector_cccf_gmsk_n335"},
+    {.id =  434, .api = &autotest_qdetector_cccf_gmsk_n512,                   .name = "qdetector_cccf_gmsk_n512"},
+    {.id =  435, .api = &autotest_qdetector_cccf_gmsk_n671,                   .name = "qdetector_cccf_gmsk_n671"},
+    {.id =  436, .api = &autotest_qdetector_cccf_gmsk_n1024,                  .name = "qdetector_cccf_gmsk_n1024"},
+    {.id =  437, .api = &autotest_qdetector_cccf_gmsk_n1341,                  .name = "qdetector_cccf_gmsk_n1341"},
+    {.id =  438, .api = &autotest_qpacketmodem_bpsk,                          .name = "qpacketmodem_bpsk"},
+    {.id =  439, .api = &autotest_qpacketmodem_qpsk,                          .name = "qpacketmodem_qpsk"},
+    {.id =  440, .api = &autotest_qpacketmodem_psk8,                          .name = "qpacketmodem_psk8"},
+    {.id =  441, .api = &autotest_qpacketmodem_qam16,                         .name = "qpacketmodem_qam16"},
+    {.id =  442, .api = &autotest_qpacketmodem_sqam32,                        .name = "qpacketmodem_sqam32"},
+    {.id =  443, .api = &autotest_qpacketmodem_qam64,                         .name = "qpacketmodem_qam64"},
+    {.id =  444, .api = &autotest_qpacketmodem_sqam128,                       .name = "qpacketmodem_sqam128"},
+    {.id =  445, .api = &autotest_qpacketmodem_qam256,                        .name = "qpacketmodem_qam256"},
+    {.id =  446, .api = &autotest_qpilotsync_100_16,                          .name = "qpilotsync_100_16"},
+    {.id =  447, .api = &autotest_qpilotsync_200_20,                          .name = "qpilotsync_200_20"},
+    {.id =  448, .api = &autotest_qpilotsync_300_24,                          .name = "qpilotsync_300_24"},
+    {.id =  449, .api = &autotest_qpilotsync_400_28,                          .name = "qpilotsync_400_28"},
+    {.id =  450, .api = &autotest_qpilotsync_500_32,                          .name = "qpilotsync_500_32"},
+    {.id =  451, .api = &autotest_kbd_n16,                                    .name = "kbd_n16"},
+    {.id =  452, .api = &autotest_kbd_n32,                                    .name = "kbd_n32"},
+    {.id =  453, .api = &autotest_kbd_n48,                                    .name = "kbd_n48"},
+    {.id =  454, .api = &autotest_Q,                                          .name = "Q"},
+    {.id =  455, .api = &autotest_sincf,                                      .name = "sincf"},
+    {.id =  456, .api = &autotest_nextpow2,                                   .name = "nextpow2"},
+    {.id =  457, .api = &autotest_lnbesselif,                                 .name = "lnbesselif"},
+    {.id =  458, .api = &autotest_besselif,                                   .name = "besselif"},
+    {.id =  459, .api = &autotest_besseli0f,                                  .name = "besseli0f"},
+    {.id =  460, .api = &autotest_besseljf,                                   .name = "besseljf"},
+    {.id =  461, .api = &autotest_besselj0f,                                  .name = "besselj0f"},
+    {.id =  462, .api = &autotest_gamma,                                      .name = "gamma"},
+    {.id =  463, .api = &autotest_lngamma,                                    .name = "lngamma"},
+    {.id =  464, .api = &autotest_uppergamma,                                 .name = "uppergamma"},
+    {.id =  465, .api = &autotest_factorial,                                  .name = "factorial"},
+    {.id =  466, .api = &autotest_nchoosek,                                   .name = "nchoosek"},
+    {.id =  467, .api = &autotest_cexpf,                                      .name = "cexpf"},
+    {.id =  468, .api = &autotest_clogf,                                      .name = "clogf"},
+    {.id =  469, .api = &autotest_csqrtf,                                     .name = "csqrtf"},
+    {.id =  470, .api = &autotest_casinf,                                     .name = "casinf"},
+    {.id =  471, .api = &autotest_cacosf,                                     .name = "cacosf"},
+    {.id =  472, .api = &autotest_catanf,                                     .name = "catanf"},
+    {.id =  473, .api = &autotest_polyf_fit_q3n3,                             .name = "polyf_fit_q3n3"},
+    {.id =  474, .api = &autotest_polyf_expandroots_4,                        .name = "polyf_expandroots_4"},
+    {.id =  475, .api = &autotest_polyf_expandroots_11,                       .name = "polyf_expandroots_11"},
+    {.id =  476, .api = &autotest_polycf_expandroots_4,                       .name = "polycf_expandroots_4"},
+    {.id =  477, .api = &autotest_polyf_expandroots2_3,                       .name = "polyf_expandroots2_3"},
+    {.id =  478, .api = &autotest_polyf_mul_2_3,                              .name = "polyf_mul_2_3"},
+    {.id =  479, .api = &autotest_poly_expandbinomial_n6,                     .name = "poly_expandbinomial_n6"},
+    {.id =  480, .api = &autotest_poly_binomial_expand_pm_m6_k1,              .name = "poly_binomial_expand_pm_m6_k1"},
+    {.id =  481, .api = &autotest_poly_expandbinomial_pm_m5_k2,               .name = "poly_expandbinomial_pm_m5_k2"},
+    {.id =  482, .api = &autotest_polyf_findroots,                            .name = "polyf_findroots"},
+    {.id =  483, .api = &autotest_matrixcf_add,                               .name = "matrixcf_add"},
+    {.id =  484, .api = &autotest_matrixcf_aug,                               .name = "matrixcf_aug"},
+    {.id =  485, .api = &autotest_matrixcf_chol,                              .name = "matrixcf_chol"},
+    {.id =  486, .api = &autotest_matrixcf_inv,                               .name = "matrixcf_inv"},
+    {.id =  487, .api = &autotest_matrixcf_linsolve,                          .name = "matrixcf_linsolve"},
+    {.id =  488, .api = &autotest_matrixcf_ludecomp_crout,                    .name = "matrixcf_ludecomp_crout"},
+    {.id =  489, .api = &autotest_matrixcf_ludecomp_doolittle,                .name = "matrixcf_ludecomp_doolittle"},
+    {.id =  490, .api = &autotest_matrixcf_mul,                               .name = "matrixcf_mul"},
+    {.id =  491, .api = &autotest_matrixcf_qrdecomp,                          .name = "matrixcf_qrdecomp"},
+    {.id =  492, .api = &autotest_matrixcf_transmul,                          .name = "matrixcf_transmul"},
+    {.id =  493, .api = &autotest_matrixf_add,                                .name = "matrixf_add"},
+    {.id =  494, .api = &autotest_matrixf_aug,                                .name = "matrixf_aug"},
+    {.id =  495, .api = &autotest_matrixf_cgsolve,                            .name = "matrixf_cgsolve"},
+    {.id =  496, .api = &autotest_matrixf_chol,                               .name = "matrixf_chol"},
+    {.id =  497, .api = &autotest_matrixf_gramschmidt,                        .name = "matrixf_gramschmidt"},
+    {.id =  498, .api = &autotest_matrixf_inv,                                .name = "matrixf_inv"},
+    {.id =  499, .api = &autotest_matrixf_linsolve,                           .name = "matrixf_linsolve"},
+    {.id =  500, .api = &autotest_matrixf_ludecomp_crout,                     .name = "matrixf_ludecomp_crout"},
+    {.id =  501, .api = &autotest_matrixf_ludecomp_doolittle,                 .name = "matrixf_ludecomp_doolittle"},
+    {.id =  502, .api = &autotest_matrixf_mul,                                .name = "matrixf_mul"},
+    {.id =  503, .api = &autotest_matrixf_qrdecomp,                           .name = "matrixf_qrdecomp"},
+    {.id =  504, .api = &autotest_matrixf_transmul,                           .name = "matrixf_transmul"},
+    {.id =  505, .api = &autotest_smatrixb_vmul,                              .name = "smatrixb_vmul"},
+    {.id =  506, .api = &autotest_smatrixb_mul,                               .name = "smatrixb_mul"},
+    {.id =  507, .api = &autotest_smatrixb_mulf,                              .name = "smatrixb_mulf"},
+    {.id =  508, .api = &autotest_smatrixb_vmulf,                             .name = "smatrixb_vmulf"},
+    {.id =  509, .api = &autotest_smatrixf_vmul,                              .name = "smatrixf_vmul"},
+    {.id =  510, .api = &autotest_smatrixf_mul,                               .name = "smatrixf_mul"},
+    {.id =  511, .api = &autotest_smatrixi_vmul,                              .name = "smatrixi_vmul"},
+    {.id =  512, .api = &autotest_smatrixi_mul,                               .name = "smatrixi_mul"},
+    {.id =  513, .api = &autotest_freqmodem_kf_0_02,                          .name = "freqmodem_kf_0_02"},
+    {.id =  514, .api = &autotest_freqmodem_kf_0_04,                          .name = "freqmodem_kf_0_04"},
+    {.id =  515, .api = &autotest_freqmodem_kf_0_08,                          .name = "freqmodem_kf_0_08"},
+    {.id =  516, .api = &autotest_fskmodem_norm_M2,                           .name = "fskmodem_norm_M2"},
+    {.id =  517, .api = &autotest_fskmodem_norm_M4,                           .name = "fskmodem_norm_M4"},
+    {.id =  518, .api = &autotest_fskmodem_norm_M8,                           .name = "fskmodem_norm_M8"},
+    {.id =  519, .api = &autotest_fskmodem_norm_M16,                          .name = "fskmodem_norm_M16"},
+    {.id =  520, .api = &autotest_fskmodem_norm_M32,                          .name = "fskmodem_norm_M32"},
+    {.id =  521, .api = &autotest_fskmodem_norm_M64,                          .name = "fskmodem_norm_M64"},
+    {.id =  522, .api = &autotest_fskmodem_norm_M128,                         .name = "fskmodem_norm_M128"},
+    {.id =  523, .api = &autotest_fskmodem_norm_M256,                         .name = "fskmodem_norm_M256"},
+    {.id =  524, .api = &autotest_fskmodem_norm_M512,                         .name = "fskmodem_norm_M512"},
+    {.id =  525, .api = &autotest_fskmodem_norm_M1024,                        .name = "fskmodem_norm_M1024"},
+    {.id =  526, .api = &autotest_fskmodem_misc_M2,                           .name = "fskmodem_misc_M2"},
+    {.id =  527, .api = &autotest_fskmodem_misc_M4,                           .name = "fskmodem_misc_M4"},
+    {.id =  528, .api = &autotest_fskmodem_misc_M8,                           .name = "fskmodem_misc_M8"},
+    {.id =  529, .api = &autotest_fskmodem_misc_M16,                          .name = "fskmodem_misc_M16"},
+    {.id =  530, .api = &autotest_fskmodem_misc_M32,                          .name = "fskmodem_misc_M32"},
+    {.id =  531, .api = &autotest_fskmodem_misc_M64,                          .name = "fskmodem_misc_M64"},
+    {.id =  532, .api = &autotest_fskmodem_misc_M128,                         .name = "fskmodem_misc_M128"},
+    {.id =  533, .api = &autotest_fskmodem_misc_M256,                         .name = "fskmodem_misc_M256"},
+    {.id =  534, .api = &autotest_fskmodem_misc_M512,                         .name = "fskmodem_misc_M512"},
+    {.id =  535, .api = &autotest_fskmodem_misc_M1024,                        .name = "fskmodem_misc_M1024"},
+    {.id =  536, .api = &autotest_mod_demod_psk2,                             .name = "mod_demod_psk2"},
+    {.id =  537, .api = &autotest_mod_demod_psk4,                             .name = "mod_demod_psk4"},
+    {.id =  538, .api = &autotest_mod_demod_psk8,                             .name = "mod_demod_psk8"},
+    {.id =  539, .api = &autotest_mod_demod_psk16,                            .name = "mod_demod_psk16"},
+    {.id =  540, .api = &autotest_mod_demod_psk32,                            .name = "mod_demod_psk32"},
+    {.id =  541, .api = &autotest_mod_demod_psk64,                            .name = "mod_demod_psk64"},
+    {.id =  542, .api = &autotest_mod_demod_psk128,                           .name = "mod_demod_psk128"},
+    {.id =  543, .api = &autotest_mod_demod_psk256,                           .name = "mod_demod_psk256"},
+    {.id =  544, .api = &autotest_mod_demod_dpsk2,                            .name = "mod_demod_dpsk2"},
+    {.id =  545, .api = &autotest_mod_demod_dpsk4,                            .name = "mod_demod_dpsk4"},
+    {.id =  546, .api = &autotest_mod_demod_dpsk8,                            .name = "mod_demod_dpsk8"},
+    {.id =  547, .api = &autotest_mod_demod_dpsk16,                           .name = "mod_demod_dpsk16"},
+    {.id =  548, .api = &autotest_mod_demod_dpsk32,                           .name = "mod_demod_dpsk32"},
+    {.id =  549, .api = &autotest_mod_demod_dpsk64,                           .name = "mod_demod_dpsk64"},
+    {.id =  550, .api = &autotest_mod_demod_dpsk128,                          .name = "mod_demod_dpsk128"},
+    {.id =  551, .api = &autotest_mod_demod_dpsk256,                          .name = "mod_demod_dpsk256"},
+    {.id =  552, .api = &autotest_mod_demod_ask2,                             .name = "mod_demod_ask2"},
+    {.id =  553, .api = &autotest_mod_demod_ask4,                             .name = "mod_demod_ask4"},
+    {.id =  554, .api = &autotest_mod_demod_ask8,                             .name = "mod_demod_ask8"},
+    {.id =  555, .api = &autotest_mod_demod_ask16,                            .name = "mod_demod_ask16"},
+    {.id =  556, .api = &autotest_mod_demod_ask32,                            .name = "mod_demod_ask32"},
+    {.id =  557, .api = &autotest_mod_demod_ask64,                            .name = "mod_demod_ask64"},
+    {.id =  558, .api = &autotest_mod_demod_ask128,                           .name = "mod_demod_ask128"},
+    {.id =  559, .api = &autotest_mod_demod_ask256,                           .name = "mod_demod_ask256"},
+    {.id =  560, .api = &autotest_mod_demod_qam4,                             .name = "mod_demod_qam4"},
+    {.id =  561, .api = &autotest_mod_demod_qam8,                             .name = "mod_demod_qam8"},
+    {.id =  562, .api = &autotest_mod_demod_qam16,                            .name = "mod_demod_qam16"},
+    {.id =  563, .api = &autotest_mod_demod_qam32,                            .name = "mod_demod_qam32"},
+    {.id =  564, .api = &autotest_mod_demod_qam64,                            .name = "mod_demod_qam64"},
+    {.id =  565, .api = &autotest_mod_demod_qam128,                           .name = "mod_demod_qam128"},
+    {.id =  566, .api = &autotest_mod_demod_qam256,                           .name = "mod_demod_qam256"},
+    {.id =  567, .api = &autotest_mod_demod_apsk4,                            .name = "mod_demod_apsk4"},
+    {.id =  568, .api = &autotest_mod_demod_apsk8,                            .name = "mod_demod_apsk8"},
+    {.id =  569, .api = &autotest_mod_demod_apsk16,                           .name = "mod_demod_apsk16"},
+    {.id =  570, .api = &autotest_mod_demod_apsk32,                           .name = "mod_demod_apsk32"},
+    {.id =  571, .api = &autotest_mod_demod_apsk64,                           .name = "mod_demod_apsk64"},
+    {.id =  572, .api = &autotest_mod_demod_apsk128,                          .name = "mod_demod_apsk128"},
+    {.id =  573, .api = &autotest_mod_demod_apsk256,                          .name = "mod_demod_apsk256"},
+    {.id =  574, .api = &autotest_mod_demod_bpsk,                             .name = "mod_demod_bpsk"},
+    {.id =  575, .api = &autotest_mod_demod_qpsk,                             .name = "mod_demod_qpsk"},
+    {.id =  576, .api = &autotest_mod_demod_ook,                              .name = "mod_demod_ook"},
+    {.id =  577, .api = &autotest_mod_demod_sqam32,                           .name = "mod_demod_sqam32"},
+    {.id =  578, .api = &autotest_mod_demod_sqam128,                          .name = "mod_demod_sqam128"},
+    {.id =  579, .api = &autotest_mod_demod_V29,                              .name = "mod_demod_V29"},
+    {.id =  580, .api = &autotest_mod_demod_arb16opt,                         .name = "mod_demod_arb16opt"},
+    {.id =  581, .api = &autotest_mod_demod_arb32opt,                         .name = "mod_demod_arb32opt"},
+    {.id =  582, .api = &autotest_mod_demod_arb64opt,                         .name = "mod_demod_arb64opt"},
+    {.id =  583, .api = &autotest_mod_demod_arb128opt,                        .name = "mod_demod_arb128opt"},
+    {.id =  584, .api = &autotest_mod_demod_arb256opt,                        .name = "mod_demod_arb256opt"},
+    {.id =  585, .api = &autotest_mod_demod_arb64vt,                          .name = "mod_demod_arb64vt"},
+    {.id =  586, .api = &autotest_modem_block_psk2,                           .name = "modem_block_psk2"},
+    {.id =  587, .api = &autotest_modem_block_psk8,                           .name = "modem_block_psk8"},
+    {.id =  588, .api = &autotest_modem_block_psk64,                          .name = "modem_block_psk64"},
+    {.id =  589, .api = &autotest_modem_block_psk256,                         .name = "modem_block_psk256"},
+    {.id =  590, .api = &autotest_modem_block_dpsk4,                          .name = "modem_block_dpsk4"},
+    {.id =  591, .api = &autotest_modem_block_dpsk16,                         .name = "modem_block_dpsk16"},
+    {.id =  592, .api = &autotest_modem_block_ask2,                           .name = "modem_block_ask2"},
+    {.id =  593, .api = &autotest_modem_block_ask8,                           .name = "modem_block_ask8"},
+    {.id =  594, .api = &autotest_modem_block_ask64,                          .name = "modem_block_ask64"},
+    {.id =  595, .api = &autotest_modem_block_qam4,                           .name = "modem_block_qam4"},
+    {.id =  596, .api = &autotest_modem_block_qam8,                           .name = "modem_block_qam8"},
+    {.id =  597, .api = &autotest_modem_block_qam32,                          .name = "modem_block_qam32"},
+    {.id =  598, .api = &autotest_modem_block_qam64,                          .name = "modem_block_qam64"},
+    {.id =  599, .api = &autotest_modem_block_qam256,                         .name = "modem_block_qam256"},
+    {.id =  600, .api = &autotest_modem_block_apsk4,                          .name = "modem_block_apsk4"},
+    {.id =  601, .api = &autotest_modem_block_apsk16,                         .name = "modem_block_apsk16"},
+    {.id =  602, .api = &autotest_modem_block_apsk64,                         .name = "modem_block_apsk64"},
+    {.id =  603, .api = &autotest_modem_block_apsk256,                        .name = "modem_block_apsk256"},
+    {.id =  604, .api = &autotest_modem_block_bpsk,                           .name = "modem_block_bpsk"},
+    {.id =  605, .api = &autotest_modem_block_qpsk,                           .name = "modem_block_qpsk"},
+    {.id =  606, .api = &autotest_modem_block_ook,                            .name = "modem_block_ook"},
+    {.id =  607, .api = &autotest_modem_block_sqam32,                         .name = "modem_block_sqam32"},
+    {.id =  608, .api = &autotest_modem_block_sqam128,                        .name = "modem_block_sqam128"},
+    {.id =  609, .api = &autotest_modem_block_V29,                            .name = "modem_block_V29"},
+    {.id =  610, .api = &autotest_modem_block_arb64vt,                        .name = "modem_block_arb64vt"},
+    {.id =  611, .api = &autotest_demodllr_maxlog_bpsk,                       .name = "demodllr_maxlog_bpsk"},
+    {.id =  612, .api = &autotest_demodllr_maxlog_qpsk,                       .name = "demodllr_maxlog_qpsk"},
+    {.id =  613, .api = &autotest_demodllr_maxlog_ask4,                       .name = "demodllr_maxlog_ask4"},
+    {.id =  614, .api = &autotest_demodllr_maxlog_ask16,                      .name = "demodllr_maxlog_ask16"},
+    {.id =  615, .api = &autotest_demodllr_maxlog_qam4,                       .name = "demodllr_maxlog_qam4"},
+    {.id =  616, .api = &autotest_demodllr_maxlog_qam8,                       .name = "demodllr_maxlog_qam8"},
+    {.id =  617, .api = &autotest_demodllr_maxlog_qam16,                      .name = "demodllr_maxlog_qam16"},
+    {.id =  618, .api = &autotest_demodllr_maxlog_qam32,                      .name = "demodllr_maxlog_qam32"},
+    {.id =  619, .api = &autotest_demodllr_maxlog_qam64,                      .name = "demodllr_maxlog_qam64"},
+    {.id =  620, .api = &autotest_demodllr_maxlog_qam256,                     .name = "demodllr_maxlog_qam256"},
+    {.id =  621, .api = &autotest_demodllr_maxlog_psk2,                       .name = "demodllr_maxlog_psk2"},
+    {.id =  622, .api = &autotest_demodllr_maxlog_psk8,                       .name = "demodllr_maxlog_psk8"},
+    {.id =  623, .api = &autotest_demodllr_maxlog_psk32,                      .name = "demodllr_maxlog_psk32"},
+    {.id =  624, .api = &autotest_demodllr_maxlog_apsk32,                     .name = "demodllr_maxlog_apsk32"},
+    {.id =  625, .api = &autotest_demodllr_maxlog_sqam32,                     .name = "demodllr_maxlog_sqam32"},
+    {.id =  626, .api = &autotest_demodllr_maxlog_arb16opt,                   .name = "demodllr_maxlog_arb16opt"},
+    {.id =  627, .api = &autotest_demodllr_exact_qpsk,                        .name = "demodllr_exact_qpsk"},
+    {.id =  628, .api = &autotest_demodllr_exact_ask8,                        .name = "demodllr_exact_ask8"},
+    {.id =  629, .api = &autotest_demodllr_exact_qam16,                       .name = "demodllr_exact_qam16"},
+    {.id =  630, .api = &autotest_demodllr_exact_qam128,                      .name = "demodllr_exact_qam128"},
+    {.id =  631, .api = &autotest_demodllr_exact_psk16,                       .name = "demodllr_exact_psk16"},
+    {.id =  632, .api = &autotest_demodllr_exact_apsk16,                      .name = "demodllr_exact_apsk16"},
+    {.id =  633, .api = &autotest_demodllr_dpsk2,                             .name = "demodllr_dpsk2"},
+    {.id =  634, .api = &autotest_demodllr_dpsk8,                             .name = "demodllr_dpsk8"},
+    {.id =  635, .api = &autotest_demodllr8,                                  .name = "demodllr8"},
+    {.id =  636, .api = &autotest_demodsoft_psk2,                             .name = "demodsoft_psk2"},
+    {.id =  637, .api = &autotest_demodsoft_psk4,                             .name = "demodsoft_psk4"},
+    {.id =  638, .api = &autotest_demodsoft_psk8,                             .name = "demodsoft_psk8"},
+    {.id =  639, .api = &autotest_demodsoft_psk16,                            .name = "demodsoft_psk16"},
+    {.id =  640, .api = &autotest_demodsoft_psk32,                            .name = "demodsoft_psk32"},
+    {.id =  641, .api = &autotest_demodsoft_psk64,                            .name = "demodsoft_psk64"},
+    {.id =  642, .api = &autotest_demodsoft_psk128,                           .name = "demodsoft_psk128"},
+    {.id =  643, .api = &autotest_demodsoft_psk256,                           .name = "demodsoft_psk256"},
+    {.id =  644, .api = &autotest_demodsoft_dpsk2,                            .name = "demodsoft_dpsk2"},
+    {.id =  645, .api = &autotest_demodsoft_dpsk4,                            .name = "demodsoft_dpsk4"},
+    {.id =  646, .api = &autotest_demodsoft_dpsk8,                            .name = "demodsoft_dpsk8"},
+    {.id =  647, .api = &autotest_demodsoft_dpsk16,                           .name = "demodsoft_dpsk16"},
+    {.id =  648, .api = &autotest_demodsoft_dpsk32,                           .name = "demodsoft_dpsk32"},
+    {.id =  649, .api = &autotest_demodsoft_dpsk64,                           .name = "demodsoft_dpsk64"},
+    {.id =  650, .api = &autotest_demodsoft_dpsk128,                          .name = "demodsoft_dpsk128"},
+    {.id =  651, .api = &autotest_demodsoft_dpsk256,                          .name = "demodsoft_dpsk256"},
+    {.id =  652, .api = &autotest_demodsoft_ask2,                             .name = "demodsoft_ask2"},
+    {.id =  653, .api = &autotest_demodsoft_ask4,                             .name = "demodsoft_ask4"},
+    {.id =  654, .api = &autotest_demodsoft_ask8,                             .name = "demodsoft_ask8"},
+    {.id =  655, .api = &autotest_demodsoft_ask16,                            .name = "demodsoft_ask16"},
+    {.id =  656, .api = &autotest_demodsoft_ask32,                            .name = "demodsoft_ask32"},
+    {.id =  657, .api = &autotest_demodsoft_ask64,                            .name = "demodsoft_ask64"},
+    {.id =  658, .api = &autotest_demodsoft_ask128,                           .name = "demodsoft_ask128"},
+    {.id =  659, .api = &autotest_demodsoft_ask256,                           .name = "demodsoft_ask256"},
+    {.id =  660, .api = &autotest_demodsoft_qam4,                             .name = "demodsoft_qam4"},
+    {.id =  661, .api = &autotest_demodsoft_qam8,                             .name = "demodsoft_qam8"},
+    {.id =  662, .api = &autotest_demodsoft_qam16,                            .name = "demodsoft_qam16"},
+    {.id =  663, .api = &autotest_demodsoft_qam32,                            .name = "demodsoft_qam32"},
+    {.id =  664, .api = &autotest_demodsoft_qam64,                            .name = "demodsoft_qam64"},
+    {.id =  665, .api = &autotest_demodsoft_qam128,                           .name = "demodsoft_qam128"},
+    {.id =  666, .api = &autotest_demodsoft_qam256,                           .name = "demodsoft_qam256"},
+    {.id =  667, .api = &autotest_demodsoft_apsk4,                            .name = "demodsoft_apsk4"},
+    {.id =  668, .api = &autotest_demodsoft_apsk8,                            .name = "demodsoft_apsk8"},
+    {.id =  669, .api = &autotest_demodsoft_apsk16,                           .name = "demodsoft_apsk16"},
+    {.id =  670, .api = &autotest_demodsoft_apsk32,                           .name = "demodsoft_apsk32"},
+    {.id =  671, .api = &autotest_demodsoft_apsk64,                           .name = "demodsoft_apsk64"},
+    {.id =  672, .api = &autotest_demodsoft_apsk128,                          .name = "demodsoft_apsk128"},
+    {.id =  673, .api = &autotest_demodsoft_apsk256,                          .name = "demodsoft_apsk256"},
+    {.id =  674, .api = &autotest_demodsoft_bpsk,                             .name = "demodsoft_bpsk"},
+    {.id =  675, .api = &autotest_demodsoft_qpsk,                             .name = "demodsoft_qpsk"},
+    {.id =  676, .api = &autotest_demodsoft_ook,                              .name = "demodsoft_ook"},
+    {.id =  677, .api = &autotest_demodsoft_sqam32,                           .name = "demodsoft_sqam32"},
+    {.id =  678, .api = &autotest_demodsoft_sqam128,                          .name = "demodsoft_sqam128"},
+    {.id =  679, .api = &autotest_demodsoft_V29,                              .name = "demodsoft_V29"},
+    {.id =  680, .api = &autotest_demodsoft_arb16opt,                         .name = "demodsoft_arb16opt"},
+    {.id =  681, .api = &autotest_demodsoft_arb32opt,                         .name = "demodsoft_arb32opt"},
+    {.id =  682, .api = &autotest_demodsoft_arb64opt,                         .name = "demodsoft_arb64opt"},
+    {.id =  683, .api = &autotest_demodsoft_arb128opt,                        .name = "demodsoft_arb128opt"},
+    {.id =  684, .api = &autotest_demodsoft_arb256opt,                        .name = "demodsoft_arb256opt"},
+    {.id =  685, .api = &autotest_demodsoft_arb64vt,                          .name = "demodsoft_arb64vt"},
+    {.id =  686, .api = &autotest_unpack_soft_bits_block,                     .name = "unpack_soft_bits_block"},
+    {.id =  687, .api = &autotest_demodstats_psk2,                            .name = "demodstats_psk2"},
+    {.id =  688, .api = &autotest_demodstats_psk4,                            .name = "demodstats_psk4"},
+    {.id =  689, .api = &autotest_demodstats_psk8,                            .name = "demodstats_psk8"},
+    {.id =  690, .api = &autotest_demodstats_psk16,                           .name = "demodstats_psk16"},
+    {.id =  691, .api = &autotest_demodstats_psk32,                           .name = "demodstats_psk32"},
+    {.id =  692, .api = &autotest_demodstats_psk64,                           .name = "demodstats_psk64"},
+    {.id =  693, .api = &autotest_demodstats_psk128,                          .name = "demodstats_psk128"},
+    {.id =  694, .api = &autotest_demodstats_psk256,                          .name = "demodstats_psk256"},
+    {.id =  695, .api = &autotest_demodstats_dpsk2,                           .name = "demodstats_dpsk2"},
+    {.id =  696, .api = &autotest_demodstats_dpsk4,                           .name = "demodstats_dpsk4"},
+    {.id =  697, .api = &autotest_demodstats_dpsk8,                           .name = "demodstats_dpsk8"},
+    {.id =  698, .api = &autotest_demodstats_dpsk16,                          .name = "demodstats_dpsk16"},
+    {.id =  699, .api = &autotest_demodstats_dpsk32,                          .name = "demodstats_dpsk32"},
+    {.id =  700, .api = &autotest_demodstats_dpsk64,                          .name = "demodstats_dpsk64"},
+    {.id =  701, .api = &autotest_demodstats_dpsk128,                         .name = "demodstats_dpsk128"},
+    {.id =  702, .api = &autotest_demodstats_dpsk256,                         .name = "demodstats_dpsk256"},
+    {.id =  703, .api = &autotest_demodstats_ask2,                            .name = "demodstats_ask2"},
+    {.id =  704, .api = &autotest_demodstats_ask4,                            .name = "demodstats_ask4"},
+    {.id =  705, .api = &autotest_demodstats_ask8,                            .name = "demodstats_ask8"},
+    {.id =  706, .api = &autotest_demodstats_ask16,                           .name = "demodstats_ask16"},
+    {.id =  707, .api = &autotest_demodstats_ask32,                           .name = "demodstats_ask32"},
+    {.id =  708, .api = &autotest_demodstats_ask64,                           .name = "demodstats_ask64"},
+    {.id =  709, .api = &autotest_demodstats_ask128,                          .name = "demodstats_ask128"},
+    {.id =  710, .api = &autotest_demodstats_ask256,                          .name = "demodstats_ask256"},
+    {.id =  711, .api = &autotest_demodstats_qam4,                            .name = "demodstats_qam4"},
+    {.id =  712, .api = &autotest_demodstats_qam8,                            .name = "demodstats_qam8"},
+    {.id =  713, .api = &autotest_demodstats_qam16,                           .name = "demodstats_qam16"},
+    {.id =  714, .api = &autotest_demodstats_qam32,                           .name = "demodstats_qam32"},
+    {.id =  715, .api = &autotest_demodstats_qam64,                           .name = "demodstats_qam64"},
+    {.id =  716, .api = &autotest_demodstats_qam128,                          .name = "demodstats_qam128"},
+    {.id =  717, .api = &autotest_demodstats_qam256,                          .name = "demodstats_qam256"},
+    {.id =  718, .api = &autotest_demodstats_apsk4,                           .name = "demodstats_apsk4"},
+    {.id =  719, .api = &autotest_demodstats_apsk8,                           .name = "demodstats_apsk8"},
+    {.id =  720, .api = &autotest_demodstats_apsk16,                          .name = "demodstats_apsk16"},
+    {.id =  721, .api = &autotest_demodstats_apsk32,                          .name = "demodstats_apsk32"},
+    {.id =  722, .api = &autotest_demodstats_apsk64,                          .name = "demodstats_apsk64"},
+    {.id =  723, .api = &autotest_demodstats_apsk128,                         .name = "demodstats_apsk128"},
+    {.id =  724, .api = &autotest_demodstats_apsk256,                         .name = "demodstats_apsk256"},
+    {.id =  725, .api = &autotest_demodstats_bpsk,                            .name = "demodstats_bpsk"},
+    {.id =  726, .api = &autotest_demodstats_qpsk,                            .name = "demodstats_qpsk"},
+    {.id =  727, .api = &autotest_demodstats_ook,                             .name = "demodstats_ook"},
+    {.id =  728, .api = &autotest_demodstats_sqam32,                          .name = "demodstats_sqam32"},
+    {.id =  729, .api = &autotest_demodstats_sqam128,                         .name = "demodstats_sqam128"},
+    {.id =  730, .api = &autotest_demodstats_V29,                             .name = "demodstats_V29"},
+    {.id =  731, .api = &autotest_demodstats_arb16opt,                        .name = "demodstats_arb16opt"},
+    {.id =  732, .api = &autotest_demodstats_arb32opt,                        .name = "demodstats_arb32opt"},
+    {.id =  733, .api = &autotest_demodstats_arb64opt,                        .name = "demodstats_arb64opt"},
+    {.id =  734, .api = &autotest_demodstats_arb128opt,                       .name = "demodstats_arb128opt"},
+    {.id =  735, .api = &autotest_demodstats_arb256opt,                       .name = "demodstats_arb256opt"},
+    {.id =  736, .api = &autotest_demodstats_arb64vt,                         .name = "demodstats_arb64vt"},
+    {.id =  737, .api = &autotest_firpfbch2_crcf_n8,                          .name = "firpfbch2_crcf_n8"},
+    {.id =  738, .api = &autotest_firpfbch2_crcf_n16,                         .name = "firpfbch2_crcf_n16"},
+    {.id =  739, .api = &autotest_firpfbch2_crcf_n32,                         .name = "firpfbch2_crcf_n32"},
+    {.id =  740, .api = &autotest_firpfbch2_crcf_n64,                         .name = "firpfbch2_crcf_n64"},
+    {.id =  741, .api = &autotest_firpfbch2_crcf_mask_analyzer_few,           .name = "firpfbch2_crcf_mask_analyzer_few"},
+    {.id =  742, .api = &autotest_firpfbch2_crcf_mask_analyzer_many,          .name = "firpfbch2_crcf_mask_analyzer_many"},
+    {.id =  743, .api = &autotest_firpfbch2_crcf_mask_synthesizer_few,        .name = "firpfbch2_crcf_mask_synthesizer_few"},
+    {.id =  744, .api = &autotest_firpfbch2_crcf_mask_synthesizer_many,       .name = "firpfbch2_crcf_mask_synthesizer_many"},
+    {.id =  745, .api = &autotest_firpfbch2_crcf_mask_block_analyzer_few,     .name = "firpfbch2_crcf_mask_block_analyzer_few"},
+    {.id =  746, .api = &autotest_firpfbch2_crcf_mask_block_analyzer_many,    .name = "firpfbch2_crcf_mask_block_analyzer_many"},
+    {.id =  747, .api = &autotest_firpfbch2_crcf_mask_block_synthesizer_few,  .name = "firpfbch2_crcf_mask_block_synthesizer_few"},
+    {.id =  748, .api = &autotest_firpfbch2_crcf_mask_block_synthesizer_many, .name = "firpfbch2_crcf_mask_block_synthesizer_many"},
+    {.id =  749, .api = &autotest_firpfbch2_crcf_mask_clear_analyzer,         .name = "firpfbch2_crcf_mask_clear_analyzer"},
+    {.id =  750, .api = &autotest_firpfbch2_crcf_mask_clear_synthesizer,      .name = "firpfbch2_crcf_mask_clear_synthesizer"},
+    {.id =  751, .api = &autotest_firpfbch_crcf_block_analyzer_n8,            .name = "firpfbch_crcf_block_analyzer_n8"},
+    {.id =  752, .api = &autotest_firpfbch_crcf_block_analyzer_n10,           .name = "firpfbch_crcf_block_analyzer_n10"},
+    {.id =  753, .api = &autotest_firpfbch_crcf_block_synthesizer_n8,         .name = "firpfbch_crcf_block_synthesizer_n8"},
+    {.id =  754, .api = &autotest_firpfbch_crcf_block_synthesizer_n10,        .name = "firpfbch_crcf_block_synthesizer_n10"},
+    {.id =  755, .api = &autotest_firpfbch2_crcf_block_analyzer_n8,           .name = "firpfbch2_crcf_block_analyzer_n8"},
+    {.id =  756, .api = &autotest_firpfbch2_crcf_block_analyzer_n10,          .name = "firpfbch2_crcf_block_analyzer_n10"},
+    {.id =  757, .api = &autotest_firpfbch2_crcf_block_synthesizer_n8,        .name = "firpfbch2_crcf_block_synthesizer_n8"},
+    {.id =  758, .api = &autotest_firpfbch2_crcf_block_synthesizer_n10,       .name = "firpfbch2_crcf_block_synthesizer_n10"},
+    {.id =  759, .api = &autotest_firpfbch_crcf_synthesis,                    .name = "firpfbch_crcf_synthesis"},
+    {.id =  760, .api = &autotest_firpfbch_crcf_analysis,                     .name = "firpfbch_crcf_analysis"},
+    {.id =  761, .api = &autotest_ofdmframesync_acquire_n64,                  .name = "ofdmframesync_acquire_n64"},
+    {.id =  762, .api = &autotest_ofdmframesync_acquire_n128,                 .name = "ofdmframesync_acquire_n128"},
+    {.id =  763, .api = &autotest_ofdmframesync_acquire_n256,                 .name = "ofdmframesync_acquire_n256"},
+    {.id =  764, .api = &autotest_ofdmframesync_acquire_n512,                 .name = "ofdmframesync_acquire_n512"},
+    {.id =  765, .api = &autotest_nco_crcf_frequency,                         .name = "nco_crcf_frequency"},
+    {.id =  766, .api = &autotest_vco_crcf_frequency,                         .name = "vco_crcf_frequency"},
+    {.id =  767, .api = &autotest_nco_crcf_mix_block_nco,                     .name = "nco_crcf_mix_block_nco"},
+    {.id =  768, .api = &autotest_nco_crcf_mix_block_interp,                  .name = "nco_crcf_mix_block_interp"},
+    {.id =  769, .api = &autotest_nco_crcf_mix_block_vco,                     .name = "nco_crcf_mix_block_vco"},
+    {.id =  770, .api = &autotest_nco_crcf_mix_block_down,                    .name = "nco_crcf_mix_block_down"},
+    {.id =  771, .api = &autotest_nco_crcf_accuracy_nco,                      .name = "nco_crcf_accuracy_nco"},
+    {.id =  772, .api = &autotest_nco_crcf_accuracy_interp,                   .name = "nco_crcf_accuracy_interp"},
+    {.id =  773, .api = &autotest_nco_crcf_accuracy_vco,                      .name = "nco_crcf_accuracy_vco"},
+    {.id =  774, .api = &autotest_nco_crcf_constrain,                         .name = "nco_crcf_constrain"},
+    {.id =  775, .api = &autotest_nco_crcf_phase,                             .name = "nco_crcf_phase"},
+    {.id =  776, .api = &autotest_vco_crcf_phase,                             .name = "vco_crcf_phase"},
+    {.id =  777, .api = &autotest_nco_basic,                                  .name = "nco_basic"},
+    {.id =  778, .api = &autotest_nco_mixing,                                 .name = "nco_mixing"},
+    {.id =  779, .api = &autotest_nco_block_mixing,                           .name = "nco_block_mixing"},
+    {.id =  780, .api = &autotest_vco_crcf_pll_phase,                         .name = "vco_crcf_pll_phase"},
+    {.id =  781, .api = &autotest_nco_crcf_pll_phase,                         .name = "nco_crcf_pll_phase"},
+    {.id =  782, .api = &autotest_nco_unwrap_phase,                           .name = "nco_unwrap_phase"},
+    {.id =  783, .api = &autotest_gradsearch_rosenbrock,                      .name = "gradsearch_rosenbrock"},
+    {.id =  784, .api = &autotest_gradsearch_maxutility,                      .name = "gradsearch_maxutility"},
+    {.id =  785, .api = &autotest_compand_float,                              .name = "compand_float"},
+    {.id =  786, .api = &autotest_compand_cfloat,                             .name = "compand_cfloat"},
+    {.id =  787, .api = &autotest_quantize_float_n8,                          .name = "quantize_float_n8"},
+    {.id =  788, .api = &autotest_randgen_seed,                               .name = "randgen_seed"},
+    {.id =  789, .api = &autotest_randgen_block,                              .name = "randgen_block"},
+    {.id =  790, .api = &autotest_randgen_uniform,                            .name = "randgen_uniform"},
+    {.id =  791, .api = &autotest_randgen_gauss,                              .name = "randgen_gauss"},
+    {.id =  792, .api = &autotest_randgen_cgauss,                             .name = "randgen_cgauss"},
+    {.id =  793, .api = &autotest_randgen_ricek,                              .name = "randgen_ricek"},
+    {.id =  794, .api = &autotest_randgen_nakm,                               .name = "randgen_nakm"},
+    {.id =  795, .api = &autotest_scramble_n16,                               .name = "scramble_n16"},
+    {.id =  796, .api = &autotest_scramble_n64,                               .name = "scramble_n64"},
+    {.id =  797, .api = &autotest_scramble_n256,                              .name = "scramble_n256"},
+    {.id =  798, .api = &autotest_scramble_n11,                               .name = "scramble_n11"},
+    {.id =  799, .api = &autotest_scramble_n33,                               .name = "scramble_n33"},
+    {.id =  800, .api = &autotest_scramble_n277,                              .name = "scramble_n277"},
+    {.id =  801, .api = &autotest_scramble_soft_n16,                          .name = "scramble_soft_n16"},
+    {.id =  802, .api = &autotest_scramble_soft_n64,                          .name = "scramble_soft_n64"},
+    {.id =  803, .api = &autotest_scramble_soft_n256,                         .name = "scramble_soft_n256"},
+    {.id =  804, .api = &autotest_scramble_soft_n11,                          .name = "scramble_soft_n11"},
+    {.id =  805, .api = &autotest_scramble_soft_n33,                          .name = "scramble_soft_n33"},
+    {.id =  806, .api = &autotest_scramble_soft_n277,                         .name = "scramble_soft_n277"},
+    {.id =  807, .api = &autotest_bsequence_init,                             .name = "bsequence_init"},
+    {.id =  808, .api = &autotest_bsequence_correlate,                        .name = "bsequence_correlate"},
+    {.id =  809, .api = &autotest_bsequence_add,                              .name = "bsequence_add"},
+    {.id =  810, .api = &autotest_bsequence_mul,                              .name = "bsequence_mul"},
+    {.id =  811, .api = &autotest_bsequence_accumulate,                       .name = "bsequence_accumulate"},
+    {.id =  812, .api = &autotest_bsequence_correlate_long,                   .name = "bsequence_correlate_long"},
+    {.id =  813, .api = &autotest_complementary_code_n8,                      .name = "complementary_code_n8"},
+    {.id =  814, .api = &autotest_complementary_code_n16,                     .name = "complementary_code_n16"},
+    {.id =  815, .api = &autotest_complementary_code_n32,                     .name = "complementary_code_n32"},
+    {.id =  816, .api = &autotest_complementary_code_n64,                     .name = "complementary_code_n64"},
+    {.id =  817, .api = &autotest_complementary_code_n128,                    .name = "complementary_code_n128"},
+    {.id =  818, .api = &autotest_complementary_code_n256,                    .name = "complementary_code_n256"},
+    {.id =  819, .api = &autotest_complementary_code_n512,                    .name = "complementary_code_n512"},
+    {.id =  820, .api = &autotest_bsequence_init_msequence,                   .name = "bsequence_init_msequence"},
+    {.id =  821, .api = &autotest_msequence_m2,                               .name = "msequence_m2"},
+    {.id =  822, .api = &autotest_msequence_m3,                               .name = "msequence_m3"},
+    {.id =  823, .api = &autotest_msequence_m4,                               .name = "msequence_m4"},
+    {.id =  824, .api = &autotest_msequence_m5,                               .name = "msequence_m5"},
+    {.id =  825, .api = &autotest_msequence_m6,                               .name = "msequence_m6"},
+    {.id =  826, .api = &autotest_msequence_m7,                               .name = "msequence_m7"},
+    {.id =  827, .api = &autotest_msequence_m8,                               .name = "msequence_m8"},
+    {.id =  828, .api = &autotest_msequence_m9,                               .name = "msequence_m9"},
+    {.id =  829, .api = &autotest_msequence_m10,                              .name = "msequence_m10"},
+    {.id =  830, .api = &autotest_msequence_m11,                              .name = "msequence_m11"},
+    {.id =  831, .api = &autotest_msequence_m12,                              .name = "msequence_m12"},
+    {.id =  832, .api = &autotest_msequence_generate_m2,                      .name = "msequence_generate_m2"},
+    {.id =  833, .api = &autotest_msequence_generate_m5,                      .name = "msequence_generate_m5"},
+    {.id =  834, .api = &autotest_msequence_generate_m8,                      .name = "msequence_generate_m8"},
+    {.id =  835, .api = &autotest_msequence_generate_m9,                      .name = "msequence_generate_m9"},
+    {.id =  836, .api = &autotest_msequence_generate_m15,                     .name = "msequence_generate_m15"},
+    {.id =  837, .api = &autotest_bsequence_init_msequence_length,            .name = "bsequence_init_msequence_length"},
+    {.id =  838, .api = &autotest_lbshift,                                    .name = "lbshift"},
+    {.id =  839, .api = &autotest_rbshift,                                    .name = "rbshift"},
+    {.id =  840, .api = &autotest_lbcircshift,                                .name = "lbcircshift"},
+    {.id =  841, .api = &autotest_rbcircshift,                                .name = "rbcircshift"},
+    {.id =  842, .api = &autotest_count_ones,                                 .name = "count_ones"},
+    {.id =  843, .api = &autotest_count_ones_mod2,                            .name = "count_ones_mod2"},
+    {.id =  844, .api = &autotest_bdotprod,                                   .name = "bdotprod"},
+    {.id =  845, .api = &autotest_count_leading_zeros,                        .name = "count_leading_zeros"},
+    {.id =  846, .api = &autotest_msb_index,                                  .name = "msb_index"},
+    {.id =  847, .api = &autotest_pack_array,                                 .name = "pack_array"},
+    {.id =  848, .api = &autotest_unpack_array,                               .name = "unpack_array"},
+    {.id =  849, .api = &autotest_repack_array,                               .name = "repack_array"},
+    {.id =  850, .api = &autotest_pack_bytes_01,                              .name = "pack_bytes_01"},
+    {.id =  851, .api = &autotest_unpack_bytes_01,                            .name = "unpack_bytes_01"},
+    {.id =  852, .api = &autotest_repack_bytes_01,                            .name = "repack_bytes_01"},
+    {.id =  853, .api = &autotest_repack_bytes_02,                            .name = "repack_bytes_02"},
+    {.id =  854, .api = &autotest_repack_bytes_03,                            .name = "repack_bytes_03"},
+    {.id =  855, .api = &autotest_repack_bytes_04_uneven,                     .name = "repack_bytes_04_uneven"},
+    {.id =  856, .api = &autotest_pack_array_block,                           .name = "pack_array_block"},
+    {.id =  857, .api = &autotest_pack_bytes_random,                          .name = "pack_bytes_random"},
+    {.id =  858, .api = &autotest_repack_bytes_random,                        .name = "repack_bytes_random"},
+    {.id =  859, .api = &autotest_lshift,                                     .name = "lshift"},
+    {.id =  860, .api = &autotest_rshift,                                     .name = "rshift"},
+    {.id =  861, .api = &autotest_lcircshift,                                 .name = "lcircshift"},
+    {.id =  862, .api = &autotest_rcircshift,                                 .name = "rcircshift"}
+};
+
+// array of packages
+package_t packages[NUM_PACKAGES] = {
+    {.id =    0, .index =    0, .num_scripts =    1, .name = "null"},
+    {.id =    1, .index =    1, .num_scripts =    4, .name = "agc_crcf"},
+    {.id =    2, .index =    5, .num_scripts =    1, .name = "cvsd"},
+    {.id =    3, .index =    6, .num_scripts =    3, .name = "cbuffer"},
+    {.id =    4, .index =    9, .num_scripts =    8, .name = "spscbuffer"},
+    {.id =    5, .index =   17, .num_scripts =    2, .name = "wdelay"},
+    {.id =    6, .index =   19, .num_scripts =    8, .name = "window"},
+    {.id =    7, .index =   27, .num_scripts =    3, .name = "channel_cccf"},
+    {.id =    8, .index =   30, .num_scripts =    9, .name = "dotprod_rrrf"},
+    {.id =    9, .index =   39, .num_scripts =    6, .name = "dotprod_crcf"},
+    {.id =   10, .index =   45, .num_scripts =    6, .name = "dotprod_cccf"},
+    {.id =   11, .index =   51, .num_scripts =    6, .name = "sumsqf"},
+    {.id =   12, .index =   57, .num_scripts =    6, .name = "sumsqcf"},
+    {.id =   13, .index =   63, .num_scripts =    7, .name = "eqlms_cccf"},
+    {.id =   14, .index =   70, .num_scripts =    4, .name = "eqlms_rrrf"},
+    {.id =   15, .index =   74, .num_scripts =    3, .name = "eqrls_cccf"},
+    {.id =   16, .index =   77, .num_scripts =    7, .name = "eqrls_rrrf"},
+    {.id =   17, .index =   84, .num_scripts =   10, .name = "crc"},
+    {.id =   18, .index =   94, .num_scripts =   30, .name = "fec"},
+    {.id =   19, .index =  124, .num_scripts =   24, .name = "fec_conv"},
+    {.id =   20, .index =  148, .num_scripts =   26, .name = "fec_soft"},
+    {.id =   21, .index =  174, .num_scripts =    2, .name = "fec_golay2412"},
+    {.id =   22, .index =  176, .num_scripts =    2, .name = "fec_hamming74"},
+    {.id =   23, .index =  178, .num_scripts =    2, .name = "fec_hamming84"},
+    {.id =   24, .index =  180, .num_scripts =    4, .name = "fec_hamming128"},
+    {.id =   25, .index =  184, .num_scripts =    1, .name = "fec_hamming1511"},
+    {.id =   26, .index =  185, .num_scripts =    1, .name = "fec_hamming3126"},
+    {.id =   27, .index =  186, .num_scripts =   18, .name = "fec_ldpc"},
+    {.id =   28, .index =  204, .num_scripts =   10, .name = "fec_reedsolomon"},
+    {.id =   29, .index =  214, .num_scripts =    1, .name = "fec_rep3"},
+    {.id =   30, .index =  215, .num_scripts =    1, .name = "fec_rep5"},
+    {.id =   31, .index =  216, .num_scripts =    3, .name = "fec_secded2216"},
+    {.id =   32, .index =  219, .num_scripts =    3, .name = "fec_secded3932"},
+    {.id =   33, .index =  222, .num_scripts =    3, .name = "fec_secded7264"},
+    {.id =   34, .index =  225, .num_scripts =   15, .name = "interleaver"},
+    {.id =   35, .index =  240, .num_scripts =    3, .name = "packetizer"},
+    {.id =   36, .index =  243, .num_scripts =    5, .name = "fft_small"},
+    {.id =   37, .index =  248, .num_scripts =    6, .name = "fft_radix2"},
+    {.id =   38, .index =  254, .num_scripts =   15, .name = "fft_composite"},
+    {.id =   39, .index =  269, .num_scripts =    6, .name = "fft_prime"},
+    {.id =   40, .index =  275, .num_scripts =   24, .name = "fft_r2r"},
+    {.id =   41, .index =  299, .num_scripts =    2, .name = "fft_shift"},
+    {.id =   42, .index =  301, .num_scripts =    8, .name = "fft_batch"},
+    {.id =   43, .index =  309, .num_scripts =   10, .name = "autocorr"},
+    {.id =   44, .index =  319, .num_scripts =   12, .name = "fftfilt_xxxf"},
+    {.id =   45, .index =  331, .num_scripts =    1, .name = "filter_crosscorr"},
+    {.id =   46, .index =  332, .num_scripts =   12, .name = "firdecim_xxxf"},
+    {.id =   47, .index =  344, .num_scripts =    3, .name = "firdes"},
+    {.id =   48, .index =  347, .num_scripts =    2, .name = "firdespm"},
+    {.id =   49, .index =  349, .num_scripts =   12, .name = "firfilt_xxxf"},
+    {.id =   50, .index =  361, .num_scripts =    2, .name = "firhilb"},
+    {.id =   51, .index =  363, .num_scripts =    2, .name = "firinterp"},
+    {.id =   52, .index =  365, .num_scripts =    1, .name = "firpfb"},
+    {.id =   53, .index =  366, .num_scripts =    4, .name = "groupdelay"},
+    {.id =   54, .index =  370, .num_scripts =    6, .name = "iirdes"},
+    {.id =   55, .index =  376, .num_scripts =    9, .name = "iirfilt_xxxf"},
+    {.id =   56, .index =  385, .num_scripts =    2, .name = "iirfiltsos_rrrf"},
+    {.id =   57, .index =  387, .num_scripts =    1, .name = "msresamp_crcf"},
+    {.id =   58, .index =  388, .num_scripts =    1, .name = "resamp_crcf"},
+    {.id =   59, .index =  389, .num_scripts =    2, .name = "resamp2_crcf"},
+    {.id =   60, .index =  391, .num_scripts =    4, .name = "symsync_crcf"},
+    {.id =   61, .index =  395, .num_scripts =    4, .name = "symsync_rrrf"},
+    {.id =   62, .index =  399, .num_scripts =    1, .name = "bpacketsync"},
+    {.id =   63, .index =  400, .num_scripts =    2, .name = "bsync"},
+    {.id =   64, .index =  402, .num_scripts =   10, .name = "detector"},
+    {.id =   65, .index =  412, .num_scripts =    3, .name = "flexframesync"},
+    {.id =   66, .index =  415, .num_scripts =    1, .name = "framecache"},
+    {.id =   67, .index =  416, .num_scripts =    2, .name = "framesync64"},
+    {.id =   68, .index =  418, .num_scripts =   20, .name = "qdetector_cccf"},
+    {.id =   69, .index =  438, .num_scripts =    8, .name = "qpacketmodem"},
+    {.id =   70, .index =  446, .num_scripts =    5, .name = "qpilotsync"},
+    {.id =   71, .index =  451, .num_scripts =    3, .name = "kbd"},
+    {.id =   72, .index =  454, .num_scripts =    3, .name = "math"},
+    {.id =   73, .index =  457, .num_scripts =    5, .name = "math_bessel"},
+    {.id =   74, .index =  462, .num_scripts =    5, .name = "math_gamma"},
+    {.id =   75, .index =  467, .num_scripts =    6, .name = "math_complex"},
+    {.id =   76, .index =  473, .num_scripts =   10, .name = "polynomial"},
+    {.id =   77, .index =  483, .num_scripts =   10, .name = "matrixcf"},
+    {.id =   78, .index =  493, .num_scripts =   12, .name = "matrixf"},
+    {.id =   79, .index =  505, .num_scripts =    4, .name = "smatrixb"},
+    {.id =   80, .index =  509, .num_scripts =    2, .name = "smatrixf"},
+    {.id =   81, .index =  511, .num_scripts =    2, .name = "smatrixi"},
+    {.id =   82, .index =  513, .num_scripts =    3, .name = "freqmodem"},
+    {.id =   83, .index =  516, .num_scripts =   20, .name = "fskmodem"},
+    {.id =   84, .index =  536, .num_scripts =   50, .name = "modem"},
+    {.id =   85, .index =  586, .num_scripts =   25, .name = "modem_block"},
+    {.id =   86, .index =  611, .num_scripts =   25, .name = "modem_demodllr"},
+    {.id =   87, .index =  636, .num_scripts =   51, .name = "modem_demodsoft"},
+    {.id =   88, .index =  687, .num_scripts =   50, .name = "modem_demodstats"},
+    {.id =   89, .index =  737, .num_scripts =   14, .name = "firpfbch2_crcf"},
+    {.id =   90, .index =  751, .num_scripts =    8, .name = "firpfbch_block"},
+    {.id =   91, .index =  759, .num_scripts =    1, .name = "firpfbch_crcf_synthesizer"},
+    {.id =   92, .index =  760, .num_scripts =    1, .name = "firpfbch_crcf_analyzer"},
+    {.id =   93, .index =  761, .num_scripts =    4, .name = "ofdmframesync"},
+    {.id =   94, .index =  765, .num_scripts =    2, .name = "nco_crcf_frequency"},
+    {.id =   95, .index =  767, .num_scripts =    8, .name = "nco_crcf_mix"},
+    {.id =   96, .index =  775, .num_scripts =    5, .name = "nco_crcf_phase"},
+    {.id =   97, .index =  780, .num_scripts =    2, .name = "nco_crcf_pll"},
+    {.id =   98, .index =  782, .num_scripts =    1, .name = "unwrap_phase"},
+    {.id =   99, .index =  783, .num_scripts =    2, .name = "gradsearch"},
+    {.id =  100, .index =  785, .num_scripts =    2, .name = "compand"},
+    {.id =  101, .index =  787, .num_scripts =    1, .name = "quantize"},
+    {.id =  102, .index =  788, .num_scripts =    7, .name = "randgen"},
+    {.id =  103, .index =  795, .num_scripts =   12, .name = "scramble"},
+    {.id =  104, .index =  807, .num_scripts =    6, .name = "bsequence"},
+    {.id =  105, .index =  813, .num_scripts =    7, .name = "complementary_codes"},
+    {.id =  106, .index =  820, .num_scripts =   18, .name = "msequence"},
+    {.id =  107, .index =  838, .num_scripts =    4, .name = "bshift_array"},
+    {.id =  108, .index =  842, .num_scripts =    5, .name = "count_bits"},
+    {.id =  109, .index =  847, .num_scripts =   12, .name = "pack_bytes"},
+    {.id =  110, .index =  859, .num_scripts =    4, .name = "shift_array"}
+};
+
+#endif // __LIQUID_AUTOSCRIPT_INCLUDE_H__
+
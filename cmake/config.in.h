@@ -3,8 +3,11 @@
 #define SIZEOF_UNSIGNED_INT ${SIZEOF_UNSIGNED_INT}
 
 #cmakedefine01 HAVE_FFTW3_H
+#cmakedefine01 HAVE_PTHREAD_H
+#cmakedefine01 HAVE_MEMFD_CREATE
 
 #cmakedefine01 HAVE_MMINTRIN_H
 #cmakedefine01 HAVE_XMMINTRIN_H
 #cmakedefine01 HAVE_EMMINTRIN_H
 #cmakedefine01 HAVE_PMMINTRIN_H
+#cmakedefine01 HAVE_IMMINTRIN_H
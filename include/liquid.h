@@ -87,6 +87,10 @@ int liquid_libversion_number(void);
 LIQUID_DEFINE_COMPLEX(float,  liquid_float_complex);
 LIQUID_DEFINE_COMPLEX(double, liquid_double_complex);
 
+// reentrant pseudo-random number generator (see MODULE : random),
+// declared here as several modules accept generator objects
+typedef struct randgen_s * randgen;
+
 // 
 // MODULE : agc (automatic gain control)
 //
@@ -284,12 +288,104 @@ void CBUFFER(_release)(CBUFFER()    _q,                         \
 LIQUID_CBUFFER_DEFINE_API(CBUFFER_MANGLE_FLOAT,  float)
 LIQUID_CBUFFER_DEFINE_API(CBUFFER_MANGLE_CFLOAT, liquid_float_complex)
 
+// lock-free single-producer/single-consumer ring buffer
+#define SPSCBUFFER_MANGLE_FLOAT(name)  LIQUID_CONCAT(spscbufferf,  name)
+#define SPSCBUFFER_MANGLE_CFLOAT(name) LIQUID_CONCAT(spscbuffercf, name)
+
+// behavior of acquire_write()/acquire_read() when short of space/data
+typedef enum {
+    LIQUID_SPSCBUFFER_NOWAIT=0, // return immediately with what is available
+    LIQUID_SPSCBUFFER_SPIN,     // busy-wait, yielding the processor
+    LIQUID_SPSCBUFFER_BLOCK     // spin briefly, then sleep until woken
+} liquid_spscbuffer_wait;
+
+// large macro
+//   SPSCBUFFER : name-mangling macro
+//   T          : data type
+#define LIQUID_SPSCBUFFER_DEFINE_API(SPSCBUFFER,T)              \
+typedef struct SPSCBUFFER(_s) * SPSCBUFFER();                   \
+                                                                \
+/* create buffer holding at least _max_size elements; the   */  \
+/* size is rounded up to a power of two and a whole page    */  \
+SPSCBUFFER() SPSCBUFFER(_create)(unsigned int _max_size);       \
+                                                                \
+/* destroy buffer object, freeing all internal memory       */  \
+void SPSCBUFFER(_destroy)(SPSCBUFFER() _q);                     \
+                                                                \
+/* print buffer object properties                           */  \
+void SPSCBUFFER(_print)(SPSCBUFFER() _q);                       \
+                                                                \
+/* clear contents and re-open buffer (not thread-safe)      */  \
+void SPSCBUFFER(_reset)(SPSCBUFFER() _q);                       \
+                                                                \
+/* set wait mode for acquire_write() and acquire_read()     */  \
+void SPSCBUFFER(_set_wait)(SPSCBUFFER()           _q,           \
+                           liquid_spscbuffer_wait _wait);       \
+                                                                \
+/* get the maximum number of elements the buffer can hold   */  \
+unsigned int SPSCBUFFER(_max_size)(SPSCBUFFER() _q);            \
+                                                                \
+/* get the number of elements available to read             */  \
+unsigned int SPSCBUFFER(_size)(SPSCBUFFER() _q);                \
+                                                                \
+/* get the number of elements which can be written          */  \
+unsigned int SPSCBUFFER(_space_available)(SPSCBUFFER() _q);     \
+                                                                \
+/* is ring mirrored in virtual memory (no copy on commit)?  */  \
+int SPSCBUFFER(_is_mirrored)(SPSCBUFFER() _q);                  \
+                                                                \
+/* reserve contiguous space for writing (producer only);    */  \
+/* returns number of elements reserved, fewer than _n when  */  \
+/* short of space and not waiting, zero once closed         */  \
+/*  _q  : buffer object                                     */  \
+/*  _n  : number of elements requested, _n <= max_size      */  \
+/*  _v  : pointer to reserved space                         */  \
+unsigned int SPSCBUFFER(_acquire_write)(SPSCBUFFER() _q,        \
+                                        unsigned int _n,        \
+                                        T **         _v);       \
+                                                                \
+/* publish _n elements written to reserved space            */  \
+void SPSCBUFFER(_commit)(SPSCBUFFER() _q,                       \
+                         unsigned int _n);                      \
+                                                                \
+/* get contiguous run of elements (consumer only); returns  */  \
+/* number of elements available, fewer than _n when short   */  \
+/* of data and not waiting, or when closed                  */  \
+/*  _q  : buffer object                                     */  \
+/*  _n  : number of elements requested, _n <= max_size      */  \
+/*  _v  : pointer to elements                               */  \
+unsigned int SPSCBUFFER(_acquire_read)(SPSCBUFFER() _q,         \
+                                       unsigned int _n,         \
+                                       T **         _v);        \
+                                                                \
+/* release _n elements which have been read                 */  \
+void SPSCBUFFER(_release)(SPSCBUFFER() _q,                      \
+                          unsigned int _n);                     \
+                                                                \
+/* close buffer (producer): waiting calls return, reader    */  \
+/* drains remaining elements, further writes are refused    */  \
+void SPSCBUFFER(_close)(SPSCBUFFER() _q);                       \
+                                                                \
+/* is buffer closed?                                        */  \
+int SPSCBUFFER(_is_closed)(SPSCBUFFER() _q);                    \
+
+LIQUID_SPSCBUFFER_DEFINE_API(SPSCBUFFER_MANGLE_FLOAT,  float)
+LIQUID_SPSCBUFFER_DEFINE_API(SPSCBUFFER_MANGLE_CFLOAT, liquid_float_complex)
+
 
 
 // Windowing functions
 #define WINDOW_MANGLE_FLOAT(name)  LIQUID_CONCAT(windowf,  name)
 #define WINDOW_MANGLE_CFLOAT(name) LIQUID_CONCAT(windowcf, name)
 
+// window memory layout; all layouts present the window contiguously
+typedef enum {
+    LIQUID_WINDOW_AUTO=0,       // default (duplicated)
+    LIQUID_WINDOW_LINEAR,       // 2^m + len - 1 array, moved back on wrap
+    LIQUID_WINDOW_DUPLICATED,   // ring stored twice; two stores per push
+    LIQUID_WINDOW_MIRRORED      // ring mapped twice in virtual memory
+} liquid_window_layout;
+
 // large macro
 //   WINDOW : name-mangling macro
 //   T      : data type
@@ -300,6 +396,12 @@ typedef struct WINDOW(_s) * WINDOW();                           \
 /* create window buffer object of length _n                 */  \
 WINDOW() WINDOW(_create)(unsigned int _n);                      \
                                                                 \
+/* create window buffer object of length _n with a given    */  \
+/* memory layout; mirrored falls back to duplicated where   */  \
+/* unsupported                                              */  \
+WINDOW() WINDOW(_create_layout)(unsigned int         _n,        \
+                                liquid_window_layout _layout);  \
+                                                                \
 /* recreate window buffer object with new length            */  \
 /*  _q      : old window object                             */  \
 /*  _n      : new window length                             */  \
@@ -317,6 +419,9 @@ void WINDOW(_debug_print)(WINDOW() _q);                         \
 /* clear/reset window object (initialize to zeros)          */  \
 void WINDOW(_clear)(WINDOW() _q);                               \
                                                                 \
+/* get memory layout in use                                 */  \
+liquid_window_layout WINDOW(_get_layout)(WINDOW() _q);          \
+                                                                \
 /* read window buffer contents                              */  \
 /*  _q      : window object                                 */  \
 /*  _v      : output pointer (set to internal array)        */  \
@@ -391,6 +496,14 @@ void WDELAY(_read)(WDELAY() _q,                                 \
 /*  _v  :   new value to be added to buffer                 */  \
 void WDELAY(_push)(WDELAY() _q,                                 \
                    T        _v);                                \
+                                                                \
+/* push array of samples into delay buffer object           */  \
+/*  _q  :   delay buffer object                             */  \
+/*  _v  :   input array [size: _n x 1]                      */  \
+/*  _n  :   number of input samples                         */  \
+void WDELAY(_write)(WDELAY()     _q,                            \
+                    T *          _v,                            \
+                    unsigned int _n);                           \
 
 // Define wdelay APIs
 LIQUID_WDELAY_DEFINE_API(WDELAY_MANGLE_FLOAT,  float)
@@ -427,6 +540,14 @@ void CHANNEL(_destroy)(CHANNEL() _q);                           \
 /* print channel object internals to standard output        */  \
 void CHANNEL(_print)(CHANNEL() _q);                             \
                                                                 \
+/* set random number generator used for noise and fading;   */  \
+/* the generator is not owned by the channel object and     */  \
+/* must outlive it                                          */  \
+/*  _q      : channel object                                */  \
+/*  _rng    : generator object (NULL for internal)          */  \
+void CHANNEL(_set_randgen)(CHANNEL() _q,                        \
+                           randgen   _rng);                     \
+                                                                \
 /* apply additive white Gausss noise impairment             */  \
 /*  _q              : channel object                        */  \
 /*  _noise_floor_dB : noise floor power spectral density    */  \
@@ -539,6 +660,19 @@ void DOTPROD(_print)(DOTPROD() _q);                             \
 void DOTPROD(_execute)(DOTPROD() _q,                            \
                        TI *      _x,                            \
                        TO *      _y);                           \
+                                                                \
+/* execute dot product on block of lagged inputs, computing */  \
+/* _y[k] = dot(_v, _x + k*_stride) for k in [0,_n)          */  \
+/*  _q      : dotprod object                                */  \
+/*  _x      : input array [size: (_n-1)*_stride + len x 1]  */  \
+/*  _stride : input step between outputs, _stride > 0       */  \
+/*  _n      : number of outputs                             */  \
+/*  _y      : output array [size: _n x 1]                   */  \
+void DOTPROD(_execute_block)(DOTPROD()    _q,                   \
+                             TI *         _x,                   \
+                             unsigned int _stride,              \
+                             unsigned int _n,                   \
+                             TO *         _y);                  \
 
 LIQUID_DOTPROD_DEFINE_API(DOTPROD_MANGLE_RRRF,
                           float,
@@ -555,6 +689,41 @@ LIQUID_DOTPROD_DEFINE_API(DOTPROD_MANGLE_CRCF,
                           float,
                           liquid_float_complex)
 
+// split-complex (planar) input methods for complex dot products
+//   DOTPROD    : name-mangling macro
+//   TO         : output data type
+#define LIQUID_DOTPROD_DEFINE_SPLIT_API(DOTPROD,TO)             \
+                                                                \
+/* execute dot product on split-complex (planar) input with */  \
+/* real and imaginary components in separate arrays         */  \
+/*  _q      : dotprod object                                */  \
+/*  _xi     : input array, real part [size: _n x 1]         */  \
+/*  _xq     : input array, imag part [size: _n x 1]         */  \
+/*  _y      : output sample pointer                         */  \
+void DOTPROD(_execute_split)(DOTPROD() _q,                      \
+                             float *   _xi,                     \
+                             float *   _xq,                     \
+                             TO *      _y);                     \
+                                                                \
+/* execute dot product on block of lagged split-complex     */  \
+/* inputs, computing _y[k] = dot(_v, _x + k*_stride) for k  */  \
+/* in [0,_n) where _x = _xi + j _xq                         */  \
+/*  _q      : dotprod object                                */  \
+/*  _xi     : input array, real part                        */  \
+/*  _xq     : input array, imag part                        */  \
+/*  _stride : input step between outputs, _stride > 0       */  \
+/*  _n      : number of outputs                             */  \
+/*  _y      : output array [size: _n x 1]                   */  \
+void DOTPROD(_execute_block_split)(DOTPROD()    _q,             \
+                                   float *      _xi,            \
+                                   float *      _xq,            \
+                                   unsigned int _stride,        \
+                                   unsigned int _n,             \
+                                   TO *         _y);            \
+
+LIQUID_DOTPROD_DEFINE_SPLIT_API(DOTPROD_MANGLE_CCCF, liquid_float_complex)
+LIQUID_DOTPROD_DEFINE_SPLIT_API(DOTPROD_MANGLE_CRCF, liquid_float_complex)
+
 // 
 // sum squared methods
 //
@@ -626,6 +795,11 @@ float EQLMS(_get_bw)(EQLMS() _q);                               \
 void  EQLMS(_set_bw)(EQLMS() _q,                                \
                      float   _lambda);                          \
                                                                 \
+/* get/set number of samples per weight update (block LMS)  */  \
+unsigned int EQLMS(_get_block_size)(EQLMS() _q);                \
+void         EQLMS(_set_block_size)(EQLMS()      _q,            \
+                                    unsigned int _block_size);  \
+                                                                \
 /* push sample into equalizer internal buffer               */  \
 void EQLMS(_push)(EQLMS() _q,                                   \
                   T       _x);                                  \
@@ -658,6 +832,21 @@ void EQLMS(_execute_block)(EQLMS()      _q,                     \
                            unsigned int _n,                     \
                            T *          _y);                    \
                                                                 \
+/* execute equalizer with block of samples, adapting the    */  \
+/* weights once every _h_len samples with frequency-domain  */  \
+/* block LMS (overlap-save, per-bin step normalization)     */  \
+/*  _q      :   equalizer object                            */  \
+/*  _x      :   input sample array [size: _n x 1]           */  \
+/*  _d      :   desired output [size: _n x 1], NULL: blind  */  \
+/*  _n      :   input sample array length, multiple of      */  \
+/*              the filter length                           */  \
+/*  _y      :   output sample array [size: _n x 1]          */  \
+void EQLMS(_execute_block_fd)(EQLMS()      _q,                  \
+                              T *          _x,                  \
+                              T *          _d,                  \
+                              unsigned int _n,                  \
+                              T *          _y);                 \
+                                                                \
 /* step through one cycle of equalizer training             */  \
 /*  _q      :   equalizer object                            */  \
 /*  _d      :   desired output                              */  \
@@ -698,6 +887,13 @@ LIQUID_EQLMS_DEFINE_API(EQLMS_MANGLE_CCCF, liquid_float_complex);
 #define EQRLS_MANGLE_RRRF(name)     LIQUID_CONCAT(eqrls_rrrf,name)
 #define EQRLS_MANGLE_CCCF(name)     LIQUID_CONCAT(eqrls_cccf,name)
 
+// RLS algorithm
+typedef enum {
+    LIQUID_EQRLS_CONVENTIONAL=0,    // inverse correlation matrix, O(p^2)
+    LIQUID_EQRLS_FTF,               // fast transversal filter, O(p)
+    LIQUID_EQRLS_IQR,               // inverse QR decomposition, O(p^2)
+} liquid_eqrls_type;
+
 // large macro
 //   EQRLS  : name-mangling macro
 //   T      : data type
@@ -710,6 +906,16 @@ typedef struct EQRLS(_s) * EQRLS();                             \
 EQRLS() EQRLS(_create)(T *          _h,                         \
                        unsigned int _p);                        \
                                                                 \
+/* create RLS EQ using specific algorithm; the fast         */  \
+/* transversal filter (FTF) requires exactly one push()     */  \
+/* per step()                                               */  \
+/*  _type   : algorithm, e.g. LIQUID_EQRLS_FTF              */  \
+/*  _h      : filter coefficients (NULL for {1,0,0...})     */  \
+/*  _p      : filter length                                 */  \
+EQRLS() EQRLS(_create_type)(liquid_eqrls_type _type,            \
+                            T *               _h,               \
+                            unsigned int      _p);              \
+                                                                \
 /* re-create RLS EQ initialized with external coefficients  */  \
 /*  _q  : initial equalizer object                          */  \
 /*  _h  : filter coefficients (NULL for {1,0,0...})         */  \
@@ -727,6 +933,9 @@ void EQRLS(_print)(EQRLS() _q);                                 \
 /* reset equalizer object, clearing internal state          */  \
 void EQRLS(_reset)(EQRLS() _q);                                 \
                                                                 \
+/* get RLS algorithm type                                   */  \
+liquid_eqrls_type EQRLS(_get_type)(EQRLS() _q);                 \
+                                                                \
 /* get/set equalizer learning rate                          */  \
 float EQRLS(_get_bw)(EQRLS() _q);                               \
 void  EQRLS(_set_bw)(EQRLS() _q,                                \
@@ -840,9 +1049,34 @@ int crc_check_key(crc_scheme      _scheme,
 // get size of key (bytes)
 unsigned int crc_sizeof_key(crc_scheme _scheme);
 
+// initialize running error-detection state, for computing keys over
+// messages which arrive in portions, viz.
+//  state = crc_init(scheme);
+//  state = crc_update(scheme, state, msg0, n0);
+//  state = crc_update(scheme, state, msg1, n1);
+//  key   = crc_finalize(scheme, state);
+//  _scheme     :   error-detection scheme
+unsigned int crc_init(crc_scheme _scheme);
+
+// update running error-detection state with a portion of the message
+//  _scheme     :   error-detection scheme
+//  _state      :   running state from crc_init() or crc_update()
+//  _msg        :   input data message portion, [size: _n x 1]
+//  _n          :   input data message portion size
+unsigned int crc_update(crc_scheme      _scheme,
+                        unsigned int    _state,
+                        unsigned char * _msg,
+                        unsigned int    _n);
+
+// finalize running error-detection state, returning key
+//  _scheme     :   error-detection scheme
+//  _state      :   running state from crc_init() or crc_update()
+unsigned int crc_finalize(crc_scheme   _scheme,
+                          unsigned int _state);
+
 
 // available FEC schemes
-#define LIQUID_FEC_NUM_SCHEMES  28
+#define LIQUID_FEC_NUM_SCHEMES  32
 typedef enum {
     LIQUID_FEC_UNKNOWN=0,       // unknown/unsupported scheme
     LIQUID_FEC_NONE,            // no error-correction
@@ -879,7 +1113,13 @@ typedef enum {
     LIQUID_FEC_CONV_V29P78,     // r7/8, K=9, dfree=4
 
     // Reed-Solomon codes
-    LIQUID_FEC_RS_M8            // m=8, n=255, k=223
+    LIQUID_FEC_RS_M8,           // m=8, n=255, k=223
+
+    // quasi-cyclic LDPC codes, n=24*Z for Z in {27,54,81,675,2700}
+    LIQUID_FEC_LDPC_R12,        // r1/2
+    LIQUID_FEC_LDPC_R23,        // r2/3
+    LIQUID_FEC_LDPC_R34,        // r3/4
+    LIQUID_FEC_LDPC_R56         // r5/6
 } fec_scheme;
 
 // pretty names for fec schemes
@@ -1108,6 +1348,46 @@ void interleaver_decode_soft(interleaver _q,
                              unsigned char * _msg_enc,
                              unsigned char * _msg_dec);
 
+// execute forward interleaver (encoder) on a block of packets
+//  _q          :   interleaver object
+//  _msg_dec    :   decoded messages [size: _num_packets*n x 1]
+//  _msg_enc    :   encoded messages [size: _num_packets*n x 1]
+//  _num_packets:   number of packets
+void interleaver_encode_block(interleaver     _q,
+                              unsigned char * _msg_dec,
+                              unsigned char * _msg_enc,
+                              unsigned int    _num_packets);
+
+// execute forward interleaver (encoder) on soft bits of a block of packets
+//  _q          :   interleaver object
+//  _msg_dec    :   decoded messages [size: 8*_num_packets*n x 1]
+//  _msg_enc    :   encoded messages [size: 8*_num_packets*n x 1]
+//  _num_packets:   number of packets
+void interleaver_encode_soft_block(interleaver     _q,
+                                   unsigned char * _msg_dec,
+                                   unsigned char * _msg_enc,
+                                   unsigned int    _num_packets);
+
+// execute reverse interleaver (decoder) on a block of packets
+//  _q          :   interleaver object
+//  _msg_enc    :   encoded messages [size: _num_packets*n x 1]
+//  _msg_dec    :   decoded messages [size: _num_packets*n x 1]
+//  _num_packets:   number of packets
+void interleaver_decode_block(interleaver     _q,
+                              unsigned char * _msg_enc,
+                              unsigned char * _msg_dec,
+                              unsigned int    _num_packets);
+
+// execute reverse interleaver (decoder) on soft bits of a block of packets
+//  _q          :   interleaver object
+//  _msg_enc    :   encoded messages [size: 8*_num_packets*n x 1]
+//  _msg_dec    :   decoded messages [size: 8*_num_packets*n x 1]
+//  _num_packets:   number of packets
+void interleaver_decode_soft_block(interleaver     _q,
+                                   unsigned char * _msg_enc,
+                                   unsigned char * _msg_dec,
+                                   unsigned int    _num_packets);
+
 
 
 //
@@ -1173,6 +1453,28 @@ FFT(plan) FFT(_create_plan_r2r_1d)(unsigned int _n,             \
                                    int          _type,          \
                                    int          _flags);        \
                                                                 \
+/* create plan for many same-size complex transforms        */  \
+/*  _n      :   transform size                              */  \
+/*  _howmany:   number of transforms                        */  \
+/*  _x      :   pointer to input array                      */  \
+/*  _istride:   stride between samples of one input         */  \
+/*  _idist  :   distance between successive inputs          */  \
+/*  _y      :   pointer to output array                     */  \
+/*  _ostride:   stride between samples of one output        */  \
+/*  _odist  :   distance between successive outputs         */  \
+/*  _dir    :   direction (e.g. LIQUID_FFT_FORWARD)         */  \
+/*  _flags  :   options, optimization                       */  \
+FFT(plan) FFT(_create_plan_batch)(unsigned int _n,              \
+                                  unsigned int _howmany,        \
+                                  TC *         _x,              \
+                                  unsigned int _istride,        \
+                                  unsigned int _idist,          \
+                                  TC *         _y,              \
+                                  unsigned int _ostride,        \
+                                  unsigned int _odist,          \
+                                  int          _dir,            \
+                                  int          _flags);         \
+                                                                \
 /* destroy transform                                        */  \
 void FFT(_destroy_plan)(FFT(plan) _p);                          \
                                                                 \
@@ -1182,6 +1484,14 @@ void FFT(_print_plan)(FFT(plan) _p);                            \
 /* run the transform                                        */  \
 void FFT(_execute)(FFT(plan) _p);                               \
                                                                 \
+/* run the transform on new arrays with the same layout     */  \
+/*  _p      :   complex transform plan                      */  \
+/*  _x      :   pointer to input array                      */  \
+/*  _y      :   pointer to output array                     */  \
+void FFT(_execute_arrays)(FFT(plan) _p,                         \
+                          TC *      _x,                         \
+                          TC *      _y);                        \
+                                                                \
 /* object-independent methods */                                \
                                                                 \
 /* perform n-point FFT allocating plan internally           */  \
@@ -2088,6 +2398,30 @@ LIQUID_FIRFILT_DEFINE_API(FIRFILT_MANGLE_CCCF,
                           liquid_float_complex,
                           liquid_float_complex)
 
+// split-complex (planar) input methods for complex filters
+//   FIRFILT    : name-mangling macro
+#define LIQUID_FIRFILT_DEFINE_SPLIT_API(FIRFILT)                \
+                                                                \
+/* execute the filter on a block of split-complex (planar)  */  \
+/* input samples, with real and imaginary components in     */  \
+/* separate arrays; shares its state with the interleaved   */  \
+/* methods, and input and output buffers may be the same    */  \
+/*  _q      : filter object                                 */  \
+/*  _xi     : input array, real part [size: _n x 1]         */  \
+/*  _xq     : input array, imag part [size: _n x 1]         */  \
+/*  _n      : number of input, output samples               */  \
+/*  _yi     : output array, real part [size: _n x 1]        */  \
+/*  _yq     : output array, imag part [size: _n x 1]        */  \
+void FIRFILT(_execute_block_split)(FIRFILT()    _q,             \
+                                   float *      _xi,            \
+                                   float *      _xq,            \
+                                   unsigned int _n,             \
+                                   float *      _yi,            \
+                                   float *      _yq);           \
+
+LIQUID_FIRFILT_DEFINE_SPLIT_API(FIRFILT_MANGLE_CRCF)
+LIQUID_FIRFILT_DEFINE_SPLIT_API(FIRFILT_MANGLE_CCCF)
+
 //
 // FIR Hilbert transform
 //  2:1 real-to-complex decimator
@@ -3552,6 +3886,17 @@ void framesync64_execute(framesync64            _q,
                          liquid_float_complex * _x,
                          unsigned int           _n);
 
+// set number of threads decoding payloads (0: decode in sample loop,
+// the default); callbacks are then invoked from a decoder thread, one
+// at a time and in the order frames were received
+//  _q           :   frame synchronizer object
+//  _num_threads :   number of decoder threads
+void framesync64_set_num_threads(framesync64  _q,
+                                 unsigned int _num_threads);
+
+// block until all frames pending on decoder threads have been delivered
+void framesync64_wait(framesync64 _q);
+
 // enable/disable debugging
 void framesync64_debug_enable(framesync64 _q);
 void framesync64_debug_disable(framesync64 _q);
@@ -3658,6 +4003,17 @@ void flexframesync_execute(flexframesync          _q,
 void             flexframesync_reset_framedatastats(flexframesync _q);
 framedatastats_s flexframesync_get_framedatastats  (flexframesync _q);
 
+// set number of threads decoding payloads (0: decode in sample loop,
+// the default); callbacks are then invoked from a decoder thread, one
+// at a time and in the order frames were received
+//  _q           :   frame synchronizer object
+//  _num_threads :   number of decoder threads
+void flexframesync_set_num_threads(flexframesync _q,
+                                   unsigned int  _num_threads);
+
+// block until all frames pending on decoder threads have been delivered
+void flexframesync_wait(flexframesync _q);
+
 // enable/disable debugging
 void flexframesync_debug_enable(flexframesync _q);
 void flexframesync_debug_disable(flexframesync _q);
@@ -4182,6 +4538,14 @@ void MSOURCE(_print)(MSOURCE() _q);                             \
 /* reset msrouce object                                     */  \
 void MSOURCE(_reset)(MSOURCE() _q);                             \
                                                                 \
+/* set random number generator used for noise sources; the  */  \
+/* generator is not owned by the msource object and must    */  \
+/* outlive it                                               */  \
+/*  _q      :   msource object                              */  \
+/*  _rng    :   generator object (NULL for internal)        */  \
+void MSOURCE(_set_randgen)(MSOURCE() _q,                        \
+                           randgen   _rng);                     \
+                                                                \
 /* add signal sources                                       */  \
 int MSOURCE(_add_tone) (MSOURCE() _q);                          \
 int MSOURCE(_add_noise)(MSOURCE() _q, float _bandwidth);        \
@@ -5164,6 +5528,16 @@ void liquid_unpack_soft_bits(unsigned int _sym_in,
                              unsigned int _bps,
                              unsigned char * _soft_bits);
 
+// unpack block of symbols into soft bits
+//  _sym_in     :   input symbols, values in [0,2^_bps) [size: _n x 1]
+//  _n          :   number of input symbols
+//  _bps        :   bits per symbol
+//  _soft_bits  :   soft output bits [size: _n*_bps x 1]
+void liquid_unpack_soft_bits_block(unsigned int *  _sym_in,
+                                   unsigned int    _n,
+                                   unsigned int    _bps,
+                                   unsigned char * _soft_bits);
+
 
 //
 // Linear modem
@@ -5171,6 +5545,12 @@ void liquid_unpack_soft_bits(unsigned int _sym_in,
 
 #define LIQUID_MODEM_MANGLE_FLOAT(name) LIQUID_CONCAT(modem,name)
 
+// log-likelihood ratio computation for block soft demodulation
+typedef enum {
+    LIQUID_MODEM_LLR_MAXLOG=0,  // max-log approximation (nearest points)
+    LIQUID_MODEM_LLR_EXACT      // exact log-MAP (all points)
+} liquid_modem_llr;
+
 // Macro    :   MODEM
 //  MODEM   :   name-mangling macro
 //  T       :   primitive data type
@@ -5214,6 +5594,16 @@ void MODEM(_modulate)(MODEM()      _q,                          \
                       unsigned int _s,                          \
                       TC *         _y);                         \
                                                                 \
+/* modulate a block of symbols                              */  \
+/*  _q  :   modem object                                    */  \
+/*  _s  :   input symbols [size: _n x 1]                    */  \
+/*  _n  :   number of input symbols                         */  \
+/*  _y  :   output samples [size: _n x 1]                   */  \
+void MODEM(_modulate_block)(MODEM()        _q,                  \
+                            unsigned int * _s,                  \
+                            unsigned int   _n,                  \
+                            TC *           _y);                 \
+                                                                \
 /* generic hard-decision demodulation function              */  \
 /*  _q  :   modem object                                    */  \
 /*  _x  :   input sample                                    */  \
@@ -5222,6 +5612,22 @@ void MODEM(_demodulate)(MODEM()        _q,                      \
                         TC             _x,                      \
                         unsigned int * _s);                     \
                                                                 \
+/* hard-decision demodulation of a block of samples; phase  */  \
+/* error and EVM of each sample are written when requested  */  \
+/* and the demodulator state reflects the last sample       */  \
+/*  _q          :   modem object                            */  \
+/*  _x          :   input samples [size: _n x 1]            */  \
+/*  _n          :   number of input samples                 */  \
+/*  _s          :   output symbols [size: _n x 1]           */  \
+/*  _phase_error:   output phase error (ignored if NULL)    */  \
+/*  _evm        :   output EVM (ignored if NULL)            */  \
+void MODEM(_demodulate_block)(MODEM()        _q,                \
+                              TC *           _x,                \
+                              unsigned int   _n,                \
+                              unsigned int * _s,                \
+                              T *            _phase_error,      \
+                              T *            _evm);             \
+                                                                \
 /* generic soft-decision demodulation function              */  \
 /*  _q          :   modem object                            */  \
 /*  _x          :   input sample                            */  \
@@ -5232,6 +5638,33 @@ void MODEM(_demodulate_soft)(MODEM()         _q,                \
                              unsigned int  * _s,                \
                              unsigned char * _soft_bits);       \
                                                                 \
+/* soft-decision demodulation of a block of samples to      */  \
+/* log-likelihood ratios, ln(P(b=1)/P(b=0)), with the most  */  \
+/* significant bit of each symbol first; demodulator state  */  \
+/* (phase error, EVM) is not updated                        */  \
+/*  _q          :   modem object                            */  \
+/*  _x          :   input samples [size: _n x 1]            */  \
+/*  _n          :   number of input samples                 */  \
+/*  _noise_var  :   noise variance E{|n|^2}, _noise_var > 0 */  \
+/*  _method     :   LLR method (max-log or exact)           */  \
+/*  _llr        :   output LLRs [size: _n*bps x 1]          */  \
+void MODEM(_demodulate_llr)(MODEM()          _q,                \
+                            TC *             _x,                \
+                            unsigned int     _n,                \
+                            T                _noise_var,        \
+                            liquid_modem_llr _method,           \
+                            T *              _llr);             \
+                                                                \
+/* soft-decision demodulation of a block of samples to      */  \
+/* 8-bit LLRs, round(_scale*LLR) saturated to [-127,127]    */  \
+void MODEM(_demodulate_llr8)(MODEM()          _q,               \
+                             TC *             _x,               \
+                             unsigned int     _n,               \
+                             T                _noise_var,       \
+                             liquid_modem_llr _method,          \
+                             T                _scale,           \
+                             signed char *    _llr);            \
+                                                                \
 /* get demodulator's estimated transmit sample */               \
 void MODEM(_get_demodulator_sample)(MODEM() _q,                 \
                                     TC *    _x_hat);            \
@@ -5676,6 +6109,26 @@ void FIRPFBCH(_synthesizer_execute)(FIRPFBCH() _q,              \
 void FIRPFBCH(_analyzer_execute)(FIRPFBCH() _q,                 \
                                  TI *       _x,                 \
                                  TO *       _y);                \
+                                                                \
+/* execute filterbank as synthesizer on many frames         */  \
+/*  _q      : filterbank channelizer object                 */  \
+/*  _x      : channelized input, [_n x num_channels]        */  \
+/*  _n      : number of frames                              */  \
+/*  _y      : output time series, [_n x num_channels]       */  \
+void FIRPFBCH(_synthesizer_execute_block)(FIRPFBCH()   _q,      \
+                                          TI *         _x,      \
+                                          unsigned int _n,      \
+                                          TO *         _y);     \
+                                                                \
+/* execute filterbank as analyzer on many frames            */  \
+/*  _q      : filterbank channelizer object                 */  \
+/*  _x      : input time series, [_n x num_channels]        */  \
+/*  _n      : number of frames                              */  \
+/*  _y      : channelized output, [_n x num_channels]       */  \
+void FIRPFBCH(_analyzer_execute_block)(FIRPFBCH()   _q,         \
+                                       TI *         _x,         \
+                                       unsigned int _n,         \
+                                       TO *         _y);        \
 
 
 LIQUID_FIRPFBCH_DEFINE_API(FIRPFBCH_MANGLE_CRCF,
@@ -5733,14 +6186,37 @@ void FIRPFBCH2(_reset)(FIRPFBCH2() _q);                         \
 /* print firpfbch2 object internals                         */  \
 void FIRPFBCH2(_print)(FIRPFBCH2() _q);                         \
                                                                 \
+/* set channel mask; only channels with a non-zero entry    */  \
+/* are produced (analyzer) or accepted (synthesizer),       */  \
+/* packed in increasing channel order; the transform is     */  \
+/* computed directly when only a few channels are active    */  \
+/*  _q      :   filterbank object                           */  \
+/*  _mask   :   channel mask [size: M x 1], NULL for all    */  \
+void FIRPFBCH2(_set_channel_mask)(FIRPFBCH2()     _q,           \
+                                  unsigned char * _mask);       \
+                                                                \
+/* get number of active channels, K                         */  \
+unsigned int FIRPFBCH2(_get_num_active)(FIRPFBCH2() _q);        \
+                                                                \
 /* execute filterbank channelizer                           */  \
-/* LIQUID_ANALYZER:     input: M/2, output: M               */  \
-/* LIQUID_SYNTHESIZER:  input: M,   output: M/2             */  \
+/* LIQUID_ANALYZER:     input: M/2, output: K               */  \
+/* LIQUID_SYNTHESIZER:  input: K,   output: M/2             */  \
 /*  _x      :   channelizer input                           */  \
 /*  _y      :   channelizer output                          */  \
 void FIRPFBCH2(_execute)(FIRPFBCH2() _q,                        \
                          TI *        _x,                        \
                          TO *        _y);                       \
+                                                                \
+/* execute filterbank channelizer on many inputs            */  \
+/* LIQUID_ANALYZER:     input: _n*M/2, output: _n*K         */  \
+/* LIQUID_SYNTHESIZER:  input: _n*K,   output: _n*M/2       */  \
+/*  _x      :   channelizer input                           */  \
+/*  _n      :   number of executions                        */  \
+/*  _y      :   channelizer output                          */  \
+void FIRPFBCH2(_execute_block)(FIRPFBCH2()  _q,                 \
+                               TI *         _x,                 \
+                               unsigned int _n,                 \
+                               TO *         _y);                \
 
 
 LIQUID_FIRPFBCH2_DEFINE_API(FIRPFBCH2_MANGLE_CRCF,
@@ -5886,6 +6362,16 @@ NCO() NCO(_create)(liquid_ncotype _type);                       \
 void NCO(_destroy)(NCO() _q);                                   \
 void NCO(_print)(NCO() _q);                                     \
                                                                 \
+/* set sine table size and interpolation (LIQUID_NCO    */      \
+/* type only); phase is held as a 32-bit fixed-point    */      \
+/* value and the table indexed with its upper bits      */      \
+/*  _q      :   nco object                              */      \
+/*  _nbits  :   table length is 2^_nbits, 4 <= _nbits <= 16 */  \
+/*  _interp :   linearly interpolate between entries?   */      \
+void NCO(_set_table)(NCO()        _q,                           \
+                     unsigned int _nbits,                       \
+                     int          _interp);                     \
+                                                                \
 /* set phase/frequency to zero, reset pll filter        */      \
 void NCO(_reset)(NCO() _q);                                     \
                                                                 \
@@ -6325,6 +6811,55 @@ float randricekf_cdf(float _x, float _K, float _omega);
 float randricekf_pdf(float _x, float _K, float _omega);
 
 
+// Reentrant pseudo-random number generator (xoshiro256**) with
+// independent state per object, suitable for running simulations on
+// several threads concurrently (type declared at top of file)
+
+// create random number generator object
+//  _seed   :   initial seed
+randgen randgen_create(unsigned int _seed);
+void randgen_destroy(randgen _q);
+void randgen_print(randgen _q);
+
+// reset generator to its initial seed
+void randgen_reset(randgen _q);
+
+// set generator seed
+void randgen_set_seed(randgen _q, unsigned int _seed);
+
+// advance generator by 2^128 steps; generators created with the same
+// seed and jumped a different number of times produce non-overlapping
+// sequences
+void randgen_jump(randgen _q);
+
+// generate single random values
+unsigned int         randgen_uint   (randgen _q);   // 32 random bits
+float                randgen_uniform(randgen _q);   // uniform, (0,1]
+float                randgen_gauss  (randgen _q);   // Gauss, N(0,1)
+liquid_float_complex randgen_cgauss (randgen _q);   // complex Gauss, CN(0,1)
+
+// generate blocks of random values
+//  _q      :   random number generator object
+//  _x      :   output array [size: _n x 1]
+//  _n      :   output array length
+void randgen_uniform_block(randgen _q, float * _x, unsigned int _n);
+void randgen_gauss_block  (randgen _q, float * _x, unsigned int _n);
+void randgen_cgauss_block (randgen _q, liquid_float_complex * _x, unsigned int _n);
+
+// generate block of Rice-K random values (see randricekf)
+void randgen_ricek_block(randgen      _q,
+                         float        _K,
+                         float        _omega,
+                         float *      _x,
+                         unsigned int _n);
+
+// generate block of Nakagami-m random values (see randnakmf)
+void randgen_nakm_block(randgen      _q,
+                        float        _m,
+                        float        _omega,
+                        float *      _x,
+                        unsigned int _n);
+
 // Data scrambler : whiten data sequence
 void scramble_data(unsigned char * _x, unsigned int _len);
 void unscramble_data(unsigned char * _x, unsigned int _len);
@@ -6440,6 +6975,15 @@ unsigned int msequence_advance(msequence _ms);
 unsigned int msequence_generate_symbol(msequence _ms,
                                        unsigned int _bps);
 
+// generate block of pseudo-random bits packed into bytes (msb first),
+// equivalent to _n calls to msequence_generate_symbol(_ms,8)
+//  _ms     :   m-sequence object
+//  _y      :   output bytes [size: _n x 1]
+//  _n      :   number of bytes to generate
+void msequence_generate_block(msequence       _ms,
+                              unsigned char * _y,
+                              unsigned int    _n);
+
 // reset msequence shift register to original state, typically '1'
 void msequence_reset(msequence _ms);
 
@@ -6488,6 +7032,36 @@ void liquid_unpack_array(unsigned char * _src,
                          unsigned int _b,
                          unsigned char * _sym_out);
 
+// pack block of symbols into binary array; bits beyond the end of
+// the array are discarded
+//  _src        :   source array [size: _n x 1]
+//  _n          :   input source array length
+//  _k          :   bit index of first symbol in _src
+//  _b          :   number of bits in each input symbol
+//  _sym_in     :   input symbols [size: _num_symbols x 1]
+//  _num_symbols:   number of input symbols
+void liquid_pack_array_block(unsigned char * _src,
+                             unsigned int    _n,
+                             unsigned int    _k,
+                             unsigned int    _b,
+                             unsigned char * _sym_in,
+                             unsigned int    _num_symbols);
+
+// unpack block of symbols from binary array; bits beyond the end of
+// the array are read as zeros
+//  _src        :   source array [size: _n x 1]
+//  _n          :   input source array length
+//  _k          :   bit index of first symbol in _src
+//  _b          :   number of bits in each output symbol
+//  _sym_out    :   output symbols [size: _num_symbols x 1]
+//  _num_symbols:   number of output symbols
+void liquid_unpack_array_block(unsigned char * _src,
+                               unsigned int    _n,
+                               unsigned int    _k,
+                               unsigned int    _b,
+                               unsigned char * _sym_out,
+                               unsigned int    _num_symbols);
+
 // pack one-bit symbols into bytes (8-bit symbols)
 //  _sym_in             :   input symbols array [size: _sym_in_len x 1]
 //  _sym_in_len         :   number of input symbols
@@ -6695,6 +7269,20 @@ void VECTOR(_normalize)(T *          _x,                        \
 LIQUID_VECTOR_DEFINE_API(VECTOR_MANGLE_RF, float,                float);
 LIQUID_VECTOR_DEFINE_API(VECTOR_MANGLE_CF, liquid_float_complex, float);
 
+// split complex vector into separate real and imaginary (planar)
+// arrays: xi[i] = real{ x[i] }, xq[i] = imag{ x[i] }
+void liquid_vectorcf_split(liquid_float_complex * _x,
+                           unsigned int           _n,
+                           float *                _xi,
+                           float *                _xq);
+
+// join separate real and imaginary (planar) arrays into complex
+// vector: x[i] = xi[i] + j xq[i]
+void liquid_vectorcf_join(float *                _xi,
+                          float *                _xq,
+                          unsigned int           _n,
+                          liquid_float_complex * _x);
+
 // 
 // mixed types
 //
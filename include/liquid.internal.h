@@ -36,12 +36,10 @@
 #include "config.h"
 
 #include <complex.h>
+#include <stddef.h>
+#include <stdint.h>
 #include "liquid.h"
 
-#if defined HAVE_FEC_H && defined HAVE_LIBFEC
-#  define LIBFEC_ENABLED 1
-#endif
-
 
 //
 // Debugging macros
@@ -68,11 +66,52 @@
 // MODULE : buffer
 //
 
+// mirrored (double-mapped) memory; p[i] and p[i+_n] alias
+size_t liquid_mirror_pagesize();
+void * liquid_mirror_alloc(size_t _n);
+void   liquid_mirror_free(void * _p, size_t _n);
+
+// enable/disable mirrored allocations, e.g. to exercise the fallback
+// storage of objects created from here on (not thread-safe)
+void   liquid_mirror_set_enabled(int _enabled);
 
 //
 // MODULE : dotprod
 //
 
+// Kernels for instruction-set extensions beyond the compile-time
+// baseline are built with per-function target attributes and selected
+// at run time when the dotprod object is created.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && HAVE_IMMINTRIN_H
+#  define LIQUID_SIMD_DISPATCH 1
+#else
+#  define LIQUID_SIMD_DISPATCH 0
+#endif
+
+// x86 SIMD extension levels
+typedef enum {
+    LIQUID_SIMD_BASELINE=0, // compile-time extensions (MMX/SSE)
+    LIQUID_SIMD_AVX2,       // AVX2 with fused multiply-add
+    LIQUID_SIMD_AVX512,     // AVX-512 foundation
+} liquid_simd_level;
+
+// get highest SIMD extension level supported by the host processor,
+// limited to that set with liquid_simd_set_level()
+liquid_simd_level liquid_simd_get_level();
+
+// limit SIMD extension level selected by objects created from here
+// on, e.g. to exercise lower kernels on capable hosts (not thread-safe)
+void liquid_simd_set_level(liquid_simd_level _level);
+
+// get string name of SIMD extension level
+const char * liquid_simd_level_str(liquid_simd_level _level);
+
+// is carry-less multiplication (PCLMULQDQ) supported by the host processor?
+int liquid_simd_has_pclmul();
+
+// is population count (POPCNT) supported by the host processor?
+int liquid_simd_has_popcnt();
+
 
 //
 // MODULE : fec (forward error-correction)
@@ -86,11 +125,142 @@
 #define CRC32_POLY 0x04C11DB7
 
 unsigned int checksum_generate_key(unsigned char * _msg, unsigned int _msg_len);
+unsigned int checksum_sum(unsigned char * _msg, unsigned int _msg_len);
 unsigned int crc8_generate_key(unsigned char * _msg, unsigned int _msg_len);
 unsigned int crc16_generate_key(unsigned char * _msg, unsigned int _msg_len);
 unsigned int crc24_generate_key(unsigned char * _msg, unsigned int _msg_len);
 unsigned int crc32_generate_key(unsigned char * _msg, unsigned int _msg_len);
 
+// slice-by-8 tables and carry-less multiplication folding constants
+// for reflected CRC polynomials (see sandbox/crc_gentab.c)
+extern const unsigned int liquid_crc8_gentab[8][256];
+extern const unsigned int liquid_crc16_gentab[8][256];
+extern const unsigned int liquid_crc24_gentab[8][256];
+extern const unsigned int liquid_crc32_gentab[8][256];
+extern const unsigned long long int liquid_crc8_fold[4];
+extern const unsigned long long int liquid_crc16_fold[4];
+extern const unsigned long long int liquid_crc24_fold[4];
+extern const unsigned long long int liquid_crc32_fold[4];
+
+// update cyclic redundancy check register, folding long messages
+//  _crc    :   shift register state
+//  _msg    :   input data message [size: _n x 1]
+//  _n      :   input data message size
+//  _tab    :   slice-by-8 tables [size: 8 x 256]
+//  _k      :   folding constants [size: 4 x 1]
+unsigned int crc_update_fold(unsigned int                   _crc,
+                             unsigned char *                _msg,
+                             unsigned int                   _n,
+                             const unsigned int (*_tab)[256],
+                             const unsigned long long int * _k);
+
+
+// Viterbi decoder for convolutional codes (8-bit soft symbols)
+typedef struct fec_conv_viterbi_s * fec_conv_viterbi;
+
+// create Viterbi decoder object
+//  _K          :   constraint length, 7 <= _K <= 15
+//  _R          :   inverse code rate, 1 <= _R <= 6
+//  _poly       :   generator polynomials [size: _R x 1]
+//  _num_bits   :   maximum number of decoded bits (excluding tail)
+fec_conv_viterbi fec_conv_viterbi_create(unsigned int _K,
+                                         unsigned int _R,
+                                         int *        _poly,
+                                         unsigned int _num_bits);
+void fec_conv_viterbi_destroy(fec_conv_viterbi _q);
+void fec_conv_viterbi_reset(fec_conv_viterbi _q);
+
+// run add-compare-select over _n trellis steps of _R soft symbols each
+void fec_conv_viterbi_update(fec_conv_viterbi _q,
+                             unsigned char *  _syms,
+                             unsigned int     _n);
+
+// trace back from _endstate, writing _nbits decoded bits (msb-first)
+void fec_conv_viterbi_chainback(fec_conv_viterbi _q,
+                                unsigned char *  _data,
+                                unsigned int     _nbits,
+                                unsigned int     _endstate);
+
+// add-compare-select kernels
+typedef enum {
+    FEC_CONV_VITERBI_KERNEL_PORT=0, // portable C
+    FEC_CONV_VITERBI_KERNEL_SSE2,   // SSE2 (compile time)
+    FEC_CONV_VITERBI_KERNEL_AVX2,   // AVX2 (run time)
+} fec_conv_viterbi_kernel;
+
+// select kernel, returning 1 if it is available on this build and
+// host processor, 0 otherwise (kernel is left unchanged)
+int fec_conv_viterbi_set_kernel(fec_conv_viterbi        _q,
+                                fec_conv_viterbi_kernel _kernel);
+
+// copy path metrics [size: 2^(K-1) x 1] and decisions of all trellis
+// steps so far [size: step*2^(K-1)/32 x 1]
+void fec_conv_viterbi_get_metrics(fec_conv_viterbi _q,
+                                  int16_t *        _metrics);
+void fec_conv_viterbi_get_decisions(fec_conv_viterbi _q,
+                                    uint32_t *       _decisions);
+
+// Reed-Solomon codec over GF(2^8) (systematic, parity appended)
+typedef struct fec_rs_codec_s * fec_rs_codec;
+
+// create Reed-Solomon codec object
+//  _gfpoly     :   field generator polynomial (degree 8), e.g. 0x11d
+//  _fcr        :   first consecutive root of the code generator (index)
+//  _prim       :   primitive element used to generate roots (index)
+//  _nroots     :   number of parity symbols, 0 < _nroots < 255
+fec_rs_codec fec_rs_codec_create(unsigned int _gfpoly,
+                                 unsigned int _fcr,
+                                 unsigned int _prim,
+                                 unsigned int _nroots);
+void fec_rs_codec_destroy(fec_rs_codec _q);
+
+// compute _nroots parity symbols for _k data symbols (_k <= 255-_nroots);
+// shorter blocks are implicitly padded with leading zeros
+void fec_rs_codec_encode(fec_rs_codec    _q,
+                         unsigned char * _data,
+                         unsigned int    _k,
+                         unsigned char * _parity);
+
+// correct block of _k data symbols followed by _nroots parity symbols
+// in place, returning the number of corrected symbols or -1 if the block
+// could not be decoded (block is left unchanged)
+int fec_rs_codec_decode(fec_rs_codec    _q,
+                        unsigned char * _block,
+                        unsigned int    _k);
+
+// number of block columns in LDPC base matrices
+#define FEC_LDPC_NB_COLS (24)
+
+// quasi-cyclic LDPC codec (systematic, layered min-sum decoding)
+typedef struct fec_ldpc_codec_s * fec_ldpc_codec;
+
+// create LDPC codec object
+//  _kb     :   systematic block columns: 12, 16, 18, 20 (r1/2, 2/3, 3/4, 5/6)
+//  _Z      :   circulant size, codeword length is 24*_Z bits (_Z >= 24)
+fec_ldpc_codec fec_ldpc_codec_create(unsigned int _kb,
+                                     unsigned int _Z);
+void fec_ldpc_codec_destroy(fec_ldpc_codec _q);
+
+// get codeword length, number of information bits
+unsigned int fec_ldpc_codec_get_n(fec_ldpc_codec _q);
+unsigned int fec_ldpc_codec_get_k(fec_ldpc_codec _q);
+
+// generate expanded parity-check matrix [size: (n-k) x n], e.g. for
+// use with smatrixb_vmul() or fec_sumproduct()
+smatrixb fec_ldpc_codec_get_H(fec_ldpc_codec _q);
+
+// compute n-k parity bits for k information bits (one bit per byte)
+void fec_ldpc_codec_encode(fec_ldpc_codec  _q,
+                           unsigned char * _msg,
+                           unsigned char * _parity);
+
+// decode n log-likelihood ratios (positive for zero) into k information
+// bits, returning the number of iterations needed to satisfy all parity
+// checks, or -1 if the decoder did not converge
+int fec_ldpc_codec_decode(fec_ldpc_codec  _q,
+                          signed char *   _llr,
+                          unsigned int    _max_iterations,
+                          unsigned char * _msg);
 
 // fec : basic object
 struct fec_s {
@@ -106,21 +276,13 @@ struct fec_s {
 
     // convolutional : internal memory structure
     unsigned char * enc_bits;
-    void * vp;      // decoder object
+    fec_conv_viterbi vp;    // Viterbi decoder object
     int * poly;     // polynomial
     unsigned int R; // primitive rate, inverted (e.g. R=3 for 1/3)
     unsigned int K; // constraint length
     unsigned int P; // puncturing rate (e.g. p=3 for 3/4)
     int * puncturing_matrix;
 
-    // viterbi decoder function pointers
-    void*(*create_viterbi)(int);
-    //void (*set_viterbi_polynomial)(int*);
-    int  (*init_viterbi)(void*,int);
-    int  (*update_viterbi_blk)(void*,unsigned char*,int);
-    int  (*chainback_viterbi)(void*,unsigned char*,unsigned int,unsigned int);
-    void (*delete_viterbi)(void*);
-
     // Reed-Solomon
     int symsize;    // symbol size (bits per symbol)
     int genpoly;    // generator polynomial
@@ -131,7 +293,7 @@ struct fec_s {
     unsigned int rspad; // number of implicit padded symbols
     int nn;         // 2^symsize - 1
     int kk;         // nn - nroots
-    void * rs;      // Reed-Solomon internal object
+    fec_rs_codec rs;    // Reed-Solomon internal codec object
 
     // Reed-Solomon decoder
     unsigned int num_blocks;    // number of blocks: ceil(dec_msg_len / nn)
@@ -140,9 +302,13 @@ struct fec_s {
     unsigned int res_block_len; // residual bytes in last block
     unsigned int pad;           // padding for each block
     unsigned char * tblock;     // decoder input sequence [size: 1 x n]
-    int * errlocs;              // error locations [size: 1 x n]
-    int * derrlocs;             // decoded error locations [size: 1 x n]
-    int erasures;               // number of erasures
+
+    // LDPC (shares block lengths with Reed-Solomon)
+    unsigned int ldpc_kb;       // systematic block columns
+    unsigned int ldpc_Z;        // circulant size for current length
+    fec_ldpc_codec ldpc;        // internal codec object
+    signed char * ldpc_llr;     // decoder input [size: 1 x n]
+    unsigned char * ldpc_bits;  // codeword bits [size: 1 x n]
 
     // encode function pointer
     void (*encode_func)(fec _q,
@@ -167,6 +333,7 @@ struct fec_s {
 int fec_scheme_is_convolutional(fec_scheme _scheme);
 int fec_scheme_is_punctured(fec_scheme _scheme);
 int fec_scheme_is_reedsolomon(fec_scheme _scheme);
+int fec_scheme_is_ldpc(fec_scheme _scheme);
 int fec_scheme_is_hamming(fec_scheme _scheme);
 int fec_scheme_is_repeat(fec_scheme _scheme);
 
@@ -264,6 +431,7 @@ unsigned char fecsoft_hamming84_decode(unsigned char * _soft_bits);
 unsigned int fec_hamming128_encode_symbol(unsigned int _sym_dec);
 unsigned int fec_hamming128_decode_symbol(unsigned int _sym_enc);
 extern unsigned short int hamming128_enc_gentab[256];   // encoding table
+extern unsigned char hamming128_dec_gentab[4096];       // decoding table
 
 fec fec_hamming128_create(void *_opts);
 void fec_hamming128_destroy(fec _q);
@@ -311,6 +479,13 @@ unsigned int golay2412_matrix_mul(unsigned int   _v,
 // search for p[i] such that w(v+p[i]) <= 2, return -1 on fail
 int golay2412_parity_search(unsigned int _v);
 
+// estimate error vector from 12-bit syndrome
+unsigned int golay2412_estimate_ehat(unsigned int _s);
+
+// look-up tables (see sandbox/fec_golay2412_gentab.c)
+extern unsigned short int golay2412_enc_gentab[2][64];  // parity
+extern unsigned short int golay2412_dec_gentab[4096];   // message correction
+
 fec fec_golay2412_create(void *_opts);
 void fec_golay2412_destroy(fec _q);
 void fec_golay2412_print(fec _q);
@@ -355,6 +530,10 @@ extern unsigned char secded2216_P[12];
 // syndrome vectors of errors with weight exactly equal to 1
 extern unsigned char secded2216_syndrome_w1[22];
 
+// look-up tables (see sandbox/fec_secded_gentab.c)
+extern unsigned char secded2216_parity_gentab[2][256];
+extern unsigned char secded2216_ehat_gentab[64];
+
 fec fec_secded2216_create(void *_opts);
 void fec_secded2216_destroy(fec _q);
 void fec_secded2216_print(fec _q);
@@ -399,6 +578,10 @@ extern unsigned char secded3932_P[28];
 // syndrome vectors of errors with weight exactly equal to 1
 extern unsigned char secded3932_syndrome_w1[39];
 
+// look-up tables (see sandbox/fec_secded_gentab.c)
+extern unsigned char secded3932_parity_gentab[4][256];
+extern unsigned char secded3932_ehat_gentab[128];
+
 fec fec_secded3932_create(void *_opts);
 void fec_secded3932_destroy(fec _q);
 void fec_secded3932_print(fec _q);
@@ -440,6 +623,10 @@ int fec_secded7264_decode_symbol(unsigned char * _sym_enc,
 extern unsigned char secded7264_P[64];
 extern unsigned char secded7264_syndrome_w1[72];
 
+// look-up tables (see sandbox/fec_secded_gentab.c)
+extern unsigned char secded7264_parity_gentab[8][256];
+extern unsigned char secded7264_ehat_gentab[256];
+
 fec fec_secded7264_create(void *_opts);
 void fec_secded7264_destroy(fec _q);
 void fec_secded7264_print(fec _q);
@@ -570,6 +757,7 @@ unsigned int fec_rs_get_enc_msg_len(unsigned int _dec_msg_len,
 
 
 fec fec_rs_create(fec_scheme _fs);
+void fec_rs_destroy(fec _q);
 void fec_rs_init_p8(fec _q);
 void fec_rs_setlength(fec _q,
                       unsigned int _dec_msg_len);
@@ -582,6 +770,36 @@ void fec_rs_decode(fec _q,
                    unsigned char * _msg_enc,
                    unsigned char * _msg_dec);
 
+// LDPC
+
+// compute encoded message length for LDPC codes
+//  _dec_msg_len    :   decoded message length (bytes)
+//  _kb             :   systematic block columns
+unsigned int fec_ldpc_get_enc_msg_len(unsigned int _dec_msg_len,
+                                      unsigned int _kb);
+
+// select circulant size for message length
+unsigned int fec_ldpc_get_lifting(unsigned int _dec_msg_len,
+                                  unsigned int _kb);
+
+fec fec_ldpc_create(fec_scheme _fs);
+void fec_ldpc_destroy(fec _q);
+unsigned int fec_ldpc_get_kb(fec_scheme _scheme);
+void fec_ldpc_setlength(fec _q,
+                        unsigned int _dec_msg_len);
+void fec_ldpc_encode(fec _q,
+                     unsigned int _dec_msg_len,
+                     unsigned char * _msg_dec,
+                     unsigned char * _msg_enc);
+void fec_ldpc_decode(fec _q,
+                     unsigned int _dec_msg_len,
+                     unsigned char * _msg_enc,
+                     unsigned char * _msg_dec);
+void fec_ldpc_decode_soft(fec _q,
+                          unsigned int _dec_msg_len,
+                          unsigned char * _msg_enc,
+                          unsigned char * _msg_dec);
+
 // phi(x) = -logf( tanhf( x/2 ) )
 float sumproduct_phi(float _x);
 
@@ -669,6 +887,7 @@ typedef enum {
     LIQUID_FFT_METHOD_RADER,        // Rader's method for FFTs of prime length
     LIQUID_FFT_METHOD_RADER2,       // Rader's method for FFTs of prime length (alternate)
     LIQUID_FFT_METHOD_DFT,          // regular discrete Fourier transform
+    LIQUID_FFT_METHOD_BATCH,        // many transforms sharing one sub-plan
 } liquid_fft_method;
 
 // Macro    :   FFT (internal)
@@ -703,6 +922,7 @@ FFT(_destroy_t) FFT(_destroy_plan_radix2);                      \
 FFT(_destroy_t) FFT(_destroy_plan_mixed_radix);                 \
 FFT(_destroy_t) FFT(_destroy_plan_rader);                       \
 FFT(_destroy_t) FFT(_destroy_plan_rader2);                      \
+FFT(_destroy_t) FFT(_destroy_plan_batch);                       \
                                                                 \
 /* FFT execute methods */                                       \
 FFT(_execute_t) FFT(_execute_dft);                              \
@@ -710,6 +930,7 @@ FFT(_execute_t) FFT(_execute_radix2);                           \
 FFT(_execute_t) FFT(_execute_mixed_radix);                      \
 FFT(_execute_t) FFT(_execute_rader);                            \
 FFT(_execute_t) FFT(_execute_rader2);                           \
+FFT(_execute_t) FFT(_execute_batch);                            \
                                                                 \
 /* specific codelets for small DFTs */                          \
 FFT(_execute_t) FFT(_execute_dft_2);                            \
@@ -760,6 +981,8 @@ LIQUID_FFT_DEFINE_INTERNAL_API(LIQUID_FFT_MANGLE_FLOAT, float, liquid_float_comp
 #   include <fftw3.h>
 #   define FFT_PLAN             fftwf_plan
 #   define FFT_CREATE_PLAN      fftwf_plan_dft_1d
+#   define FFT_CREATE_PLAN_BATCH(n,howmany,x,y,dir,flags) \
+        fftwf_plan_many_dft(1,(int[]){(int)(n)},howmany,x,NULL,1,n,y,NULL,1,n,dir,flags)
 #   define FFT_DESTROY_PLAN     fftwf_destroy_plan
 #   define FFT_EXECUTE          fftwf_execute
 #   define FFT_DIR_FORWARD      FFTW_FORWARD
@@ -768,6 +991,8 @@ LIQUID_FFT_DEFINE_INTERNAL_API(LIQUID_FFT_MANGLE_FLOAT, float, liquid_float_comp
 #else
 #   define FFT_PLAN             fftplan
 #   define FFT_CREATE_PLAN      fft_create_plan
+#   define FFT_CREATE_PLAN_BATCH(n,howmany,x,y,dir,flags) \
+        fft_create_plan_batch(n,howmany,x,1,n,y,1,n,dir,flags)
 #   define FFT_DESTROY_PLAN     fft_destroy_plan
 #   define FFT_EXECUTE          fft_execute
 #   define FFT_DIR_FORWARD      LIQUID_FFT_FORWARD
@@ -796,6 +1021,36 @@ float estimate_req_filter_len_Herrmann(float _df,
                                        float _As);
 
 
+// firpfb
+#define LIQUID_FIRPFB_DEFINE_INTERNAL_API(FIRPFB,TO,TC,TI)      \
+                                                                \
+/* execute filter on external buffer rather than internal   */  \
+/* window, e.g. for block processing by a parent object     */  \
+/*  _q      : firpfb object                                 */  \
+/*  _i      : index of filter to use                        */  \
+/*  _x      : most recent input samples, oldest first       */  \
+/*            [size: h_len/num_filters x 1]                 */  \
+/*  _y      : pointer to output sample                      */  \
+void FIRPFB(_execute_buffer)(FIRPFB()     _q,                   \
+                             unsigned int _i,                   \
+                             TI *         _x,                   \
+                             TO *         _y);
+
+LIQUID_FIRPFB_DEFINE_INTERNAL_API(FIRPFB_MANGLE_RRRF,
+                                  float,
+                                  float,
+                                  float)
+
+LIQUID_FIRPFB_DEFINE_INTERNAL_API(FIRPFB_MANGLE_CRCF,
+                                  liquid_float_complex,
+                                  float,
+                                  liquid_float_complex)
+
+LIQUID_FIRPFB_DEFINE_INTERNAL_API(FIRPFB_MANGLE_CCCF,
+                                  liquid_float_complex,
+                                  liquid_float_complex,
+                                  liquid_float_complex)
+
 // fir_farrow
 #define LIQUID_FIRFARROW_DEFINE_INTERNAL_API(FIRFARROW,TO,TC,TI)  \
 void FIRFARROW(_genpoly)(FIRFARROW() _q);
@@ -1112,6 +1367,84 @@ void bpacketsync_decode_payload(bpacketsync _q);
 void bpacketsync_reconfig(bpacketsync _q);
 
 
+//
+// framecache : payload modems and packetizers retained across frames
+//
+
+// default number of each object type retained
+#define FRAMECACHE_CAPACITY (8)
+
+typedef struct framecache_s * framecache;
+
+// create/destroy frame cache; destroying releases all cached objects
+framecache framecache_create(unsigned int _capacity);
+void framecache_destroy(framecache _q);
+
+// get modem for scheme, creating it (or replacing the least-recently
+// used entry) if not cached; object remains owned by the cache
+modem framecache_get_modem(framecache        _q,
+                           modulation_scheme _ms);
+
+// get packetizer for configuration, creating it (or replacing the
+// least-recently used entry) if not cached
+packetizer framecache_get_packetizer(framecache   _q,
+                                     unsigned int _n,
+                                     crc_scheme   _crc,
+                                     fec_scheme   _fec0,
+                                     fec_scheme   _fec1);
+
+// get number of cached objects
+unsigned int framecache_get_num_modems(framecache _q);
+unsigned int framecache_get_num_packetizers(framecache _q);
+
+
+//
+// framepipe : pipelined frame decoding on worker threads
+//
+
+typedef struct framepipe_s * framepipe;
+
+// create/destroy decoder state owned by one worker
+typedef void * (*framepipe_worker_create_callback)(void * _userdata);
+typedef void   (*framepipe_worker_destroy_callback)(void * _worker);
+
+// decode job using worker state (runs concurrently on workers)
+typedef void (*framepipe_decode_callback)(void * _userdata,
+                                          void * _worker,
+                                          void * _job);
+
+// deliver decoded job (runs one at a time, in submission order)
+typedef void (*framepipe_deliver_callback)(void * _userdata,
+                                           void * _job);
+
+// create frame pipeline with _num_threads workers (0: decode inline on
+// submit) and _num_jobs slots of _job_size bytes each
+framepipe framepipe_create(unsigned int                      _num_threads,
+                           unsigned int                      _num_jobs,
+                           unsigned int                      _job_size,
+                           framepipe_worker_create_callback  _worker_create,
+                           framepipe_worker_destroy_callback _worker_destroy,
+                           framepipe_decode_callback         _decode,
+                           framepipe_deliver_callback        _deliver,
+                           void *                            _userdata);
+void framepipe_destroy(framepipe _q);
+
+unsigned int framepipe_get_num_threads(framepipe _q);
+unsigned int framepipe_get_num_jobs(framepipe _q);
+void * framepipe_get_job(framepipe _q, unsigned int _i);
+
+// get free job slot (blocking while all are pending), then submit it
+void * framepipe_acquire(framepipe _q);
+void framepipe_submit(framepipe _q);
+
+// block until all submitted jobs have been delivered
+void framepipe_wait(framepipe _q);
+
+// lock/unlock against concurrent delivery (recursive)
+void framepipe_lock(framepipe _q);
+void framepipe_unlock(framepipe _q);
+
+
 // 
 // flexframe
 //
@@ -1122,8 +1455,8 @@ void bpacketsync_reconfig(bpacketsync _q);
 // header description
 // NOTE: The flexframe header can be improved with crc24, secded7264, v29
 //       which also generates a 54-byte frame. Improves header decoding
-//       by about 1 dB (99% probability of decoding with SNR = -1 dB);
-//       however this requires that the 'libfec' libraries are installed.
+//       by about 1 dB (99% probability of decoding with SNR = -1 dB),
+//       but changing it would break compatibility with the protocol.
 #define FLEXFRAME_H_USER    (14)                    // user-defined array
 #define FLEXFRAME_H_DEC     (FLEXFRAME_H_USER+6)    // decoded length
 #define FLEXFRAME_H_CRC     (LIQUID_CRC_32)         // header CRC
@@ -1387,6 +1720,70 @@ void MODEM(_demodulate_soft_table)(MODEM()         _q,          \
                                    unsigned int *  _sym_out,    \
                                    unsigned char * _soft_bits); \
                                                                 \
+/* describe scheme as Gray-coded levels on one or both     */  \
+/* axes; returns number of axes (zero if not separable)     */  \
+unsigned int MODEM(_pam_axes)(MODEM()        _q,                \
+                              unsigned int * _comp,             \
+                              T *            _sign,             \
+                              unsigned int * _m,                \
+                              T *            _alpha);           \
+                                                                \
+/* block LLR kernels: one axis of Gray-coded levels, PSK,   */  \
+/* and search over all constellation points                 */  \
+void MODEM(_llr_pam_maxlog)(T *          _x,                    \
+                            unsigned int _n,                    \
+                            unsigned int _comp,                 \
+                            T            _scale,                \
+                            unsigned int _m,                    \
+                            T            _gain,                 \
+                            T *          _llr,                  \
+                            unsigned int _stride);              \
+void MODEM(_llr_pam_exact)(T *          _x,                     \
+                           unsigned int _n,                     \
+                           unsigned int _comp,                  \
+                           T            _scale,                 \
+                           unsigned int _m,                     \
+                           T            _gain,                  \
+                           T *          _llr,                   \
+                           unsigned int _stride);               \
+void MODEM(_llr_psk_maxlog)(TC *         _x,                    \
+                            unsigned int _n,                    \
+                            unsigned int _m,                    \
+                            T            _gain,                 \
+                            T *          _llr);                 \
+void MODEM(_llr_search)(TC *             _c,                    \
+                        unsigned int     _m,                    \
+                        TC *             _x,                    \
+                        unsigned int     _n,                    \
+                        T                _gain,                 \
+                        liquid_modem_llr _method,               \
+                        T *              _llr);                 \
+                                                                \
+/* constellation table for block methods, created when the  */  \
+/* scheme does not keep one (NULL for differential schemes) */  \
+TC * MODEM(_block_map)(MODEM() _q);                             \
+                                                                \
+/* block hard-decision slicers                              */  \
+void MODEM(_slice_pam)(T *            _x,                       \
+                       unsigned int   _n,                       \
+                       unsigned int   _num,                     \
+                       unsigned int * _comp,                    \
+                       T *            _scale,                   \
+                       unsigned int * _m,                       \
+                       unsigned int * _s);                      \
+void MODEM(_slice_psk)(MODEM()        _q,                       \
+                       TC *           _x,                       \
+                       unsigned int   _n,                       \
+                       unsigned int * _s);                      \
+void MODEM(_slice_apsk)(MODEM()        _q,                      \
+                        TC *           _x,                      \
+                        unsigned int   _n,                      \
+                        unsigned int * _s);                     \
+void MODEM(_slice_search)(MODEM()        _q,                    \
+                          TC *           _x,                    \
+                          unsigned int   _n,                    \
+                          unsigned int * _s);                   \
+                                                                \
 /* Demodulate a linear symbol constellation using dynamic   */  \
 /* threshold calculation                                    */  \
 /*  _v      :   input value             */                      \
@@ -1542,12 +1939,12 @@ void ofdmframesync_rxsymbol(ofdmframesync _q);
 //
 
 
-// Numerically-controlled oscillator, floating point phase precision
+// Numerically-controlled oscillator, 32-bit fixed-point phase
 #define LIQUID_NCO_DEFINE_INTERNAL_API(NCO,T,TC)                \
                                                                 \
-/* constrain phase/frequency to be in [-pi,pi)          */      \
-void NCO(_constrain_phase)(NCO() _q);                           \
-void NCO(_constrain_frequency)(NCO() _q);                       \
+/* convert phase/frequency [radians] to fixed-point     */      \
+/* value, wrapping to [0,2 pi) as 2^32 : 2 pi            */      \
+uint32_t NCO(_constrain)(T _theta);                             \
                                                                 \
 /* compute trigonometric functions for nco/vco type     */      \
 void NCO(_compute_sincos_nco)(NCO() _q);                        \
@@ -1754,11 +2151,19 @@ struct msequence_s {
     unsigned int n;     // length of sequence, n = (2^m)-1
     unsigned int v;     // shift register
     unsigned int b;     // return bit
+
+    // next 64 output bits (first bit in msb) as a linear function of
+    // the shift register, split into its low and high bytes
+    uint64_t * jump;    // [size: 2 x 256]
 };
 
 // Default msequence generator objects
 extern struct msequence_s msequence_default[16];
 
+// generate next 64 bits of sequence, first bit in most-significant
+// position; equivalent to 64 calls to msequence_advance()
+uint64_t msequence_generate_word(msequence _ms);
+
 
 //
 // MODULE : utility
@@ -1797,6 +2202,47 @@ extern const unsigned char liquid_c_ones[256];
     liquid_c_ones[ ((x)>>16) & 0xff ] +         \
     liquid_c_ones[ ((x)>>24) & 0xff ])
 
+// number of ones in a 64-bit word (parallel bit count)
+static inline unsigned int liquid_count_ones_uint64(uint64_t _x)
+{
+    _x = _x - ((_x >> 1) & 0x5555555555555555ULL);
+    _x = (_x & 0x3333333333333333ULL) + ((_x >> 2) & 0x3333333333333333ULL);
+    _x = (_x + (_x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return (unsigned int)((_x * 0x0101010101010101ULL) >> 56);
+}
+
+// spread the bits of a byte into the least-significant bit of each byte
+// of a 64-bit word, most-significant bit first (lowest byte),
+// e.g. 0xa0 -> 0x0000000000000101
+static inline uint64_t liquid_spread_bits_uint8(unsigned char _b)
+{
+    return (((uint64_t)_b * 0x8040201008040201ULL) >> 7) & 0x0101010101010101ULL;
+}
+
+// gather the least-significant bit of each byte of a 64-bit word into a
+// byte; inverse of liquid_spread_bits_uint8()
+static inline unsigned char liquid_gather_bits_uint64(uint64_t _x)
+{
+    return (unsigned char)(((_x & 0x0101010101010101ULL) * 0x8040201008040201ULL) >> 56);
+}
+
+// load/store 8 bytes, first byte in the least-significant position
+static inline uint64_t liquid_load_le64(const unsigned char * _p)
+{
+    return  (uint64_t)_p[0]        | ((uint64_t)_p[1] <<  8) |
+           ((uint64_t)_p[2] << 16) | ((uint64_t)_p[3] << 24) |
+           ((uint64_t)_p[4] << 32) | ((uint64_t)_p[5] << 40) |
+           ((uint64_t)_p[6] << 48) | ((uint64_t)_p[7] << 56);
+}
+
+static inline void liquid_store_le64(unsigned char * _p, uint64_t _x)
+{
+    _p[0] = (unsigned char)(_x      ); _p[1] = (unsigned char)(_x >>  8);
+    _p[2] = (unsigned char)(_x >> 16); _p[3] = (unsigned char)(_x >> 24);
+    _p[4] = (unsigned char)(_x >> 32); _p[5] = (unsigned char)(_x >> 40);
+    _p[6] = (unsigned char)(_x >> 48); _p[7] = (unsigned char)(_x >> 56);
+}
+
 
 // number of ones in a byte, modulo 2
 //  0   0000 0000   :   0
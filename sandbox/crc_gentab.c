@@ -23,45 +23,90 @@
 //
 // CRC table generator
 //
+// Prints the slice-by-8 lookup tables for the (reflected) CRC-8, -16,
+// -24 and -32 polynomials used in src/fec/src/crc_gentab.c as well as
+// the carry-less multiplication folding constants x^E mod P, stored
+// bit-reflected and shifted left by one (33-bit reflected form).
+//
 
 #include <stdio.h>
 #include <stdlib.h>
 
-// generator polynomial
-#define CRC32_POLY 0xEDB88320 // 0x04C11DB7
-
-int main() {
-    unsigned int crc;
-    unsigned int mask;
-    unsigned int crcpoly = CRC32_POLY;
+#include "liquid.internal.h"
 
-    unsigned int crc_gentab[256];
-
-    // generate table
+// print slice-by-8 tables for reflected polynomial
+void crc_gentab_print(const char * _name, unsigned int _poly_rev)
+{
+    unsigned int tab[8][256];
     unsigned int i, j;
     for (i=0; i<256; i++) {
-        crc = i;
-        for (j=0; j<8; j++) {
-            mask = -(crc & 0x01);
-            crc = (crc >> 1) ^ (crcpoly & mask);
+        unsigned int crc = i;
+        for (j=0; j<8; j++)
+            crc = (crc >> 1) ^ (_poly_rev & -(crc & 1));
+        tab[0][i] = crc;
+    }
+    for (j=1; j<8; j++) {
+        for (i=0; i<256; i++)
+            tab[j][i] = (tab[j-1][i] >> 8) ^ tab[0][tab[j-1][i] & 0xff];
+    }
+
+    printf("const unsigned int liquid_%s_gentab[8][256] = {\n", _name);
+    for (j=0; j<8; j++) {
+        printf("  {");
+        for (i=0; i<256; i++) {
+            if ((i%6)==0) printf("\n    ");
+            printf("0x%.8x%s", tab[j][i], i==255 ? "" : ", ");
         }
-        crc_gentab[i] = crc;
+        printf("}%s\n", j==7 ? "" : ",");
     }
+    printf("};\n\n");
+}
 
-    printf("\n");
-    printf("unsigned char crc_gentab[%u] = {\n    ", 256);
-    for (i=0; i<256; i++) {
-        printf("0x%.2x", crc_gentab[i]);
-        if (i==255)
-            printf("};\n");
-        else if (((i+1)%8)==0)
-            printf(",\n    ");
-        else
-            printf(", ");
+// compute x^_e mod P (normal form, degree _w) as 33-bit reflected value
+unsigned long long int crc_gentab_fold(unsigned int _poly,
+                                       unsigned int _w,
+                                       unsigned int _e)
+{
+    // start with x^0 and multiply by x, _e times
+    unsigned long long int r = 1, top = 1ULL << _w;
+    unsigned int i;
+    for (i=0; i<_e; i++) {
+        r <<= 1;
+        if (r & top)
+            r ^= top | _poly;
     }
+    // reflect: coefficient of x^i moves to bit 32-i
+    unsigned long long int k = 0;
+    for (i=0; i<_w; i++) {
+        if ((r >> i) & 1)
+            k |= 1ULL << (32-i);
+    }
+    return k;
+}
+
+int main() {
+    unsigned int  polys[4] = {CRC8_POLY, CRC16_POLY, CRC24_POLY, CRC32_POLY};
+    unsigned int  widths[4] = {8, 16, 24, 32};
+    const char *  names[4] = {"crc8", "crc16", "crc24", "crc32"};
+    unsigned int i;
 
-    // test it...
+    printf("// slice-by-8 tables\n");
+    for (i=0; i<4; i++) {
+        unsigned int rev = liquid_reverse_uint32(polys[i]) >> (32 - widths[i]);
+        crc_gentab_print(names[i], rev);
+    }
+
+    // folding constants: four 128-bit lanes (distance 512 bits) and a
+    // single lane (distance 128 bits), {x^(D+32), x^(D-32)} mod P
+    printf("// folding constants {k1,k2,k3,k4}\n");
+    for (i=0; i<4; i++) {
+        printf("const unsigned long long int liquid_%s_fold[4] = {\n", names[i]);
+        printf("    0x%.9llx, 0x%.9llx, 0x%.9llx, 0x%.9llx};\n\n",
+            crc_gentab_fold(polys[i], widths[i], 512+32),
+            crc_gentab_fold(polys[i], widths[i], 512-32),
+            crc_gentab_fold(polys[i], widths[i], 128+32),
+            crc_gentab_fold(polys[i], widths[i], 128-32));
+    }
 
     return 0;
 }
-
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Golay(24,12) code table generator
+//
+// Prints the parity table (two 6-bit halves of the 12-bit message) and
+// the error-correction table indexed by the 12-bit syndrome used in
+// src/fec/src/fec_golay2412_gentab.c
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "liquid.internal.h"
+
+int main()
+{
+    unsigned int i, j;
+
+    // parity of each 6-bit half of message
+    printf("// parity table: p(m) = T[0][m >> 6] ^ T[1][m & 0x3f]\n");
+    printf("unsigned short int golay2412_enc_gentab[2][64] = {\n");
+    for (j=0; j<2; j++) {
+        printf("  {");
+        for (i=0; i<64; i++) {
+            unsigned int m = j==0 ? i << 6 : i;
+            unsigned int p = golay2412_matrix_mul(m, golay2412_P, 12);
+            if ((i%8)==0) printf("\n    ");
+            printf("0x%.4x%s", p, i==63 ? "" : ", ");
+        }
+        printf("}%s\n", j==1 ? "" : ",");
+    }
+    printf("};\n\n");
+
+    // message part of estimated error vector for each syndrome
+    printf("// message correction table indexed by syndrome\n");
+    printf("unsigned short int golay2412_dec_gentab[4096] = {\n    ");
+    for (i=0; i<4096; i++) {
+        printf("0x%.4x", golay2412_estimate_ehat(i) & 0x0fff);
+        if (i != 4095)
+            printf(", ");
+        else
+            printf("};");
+
+        if ( ((i+1)%8) == 0 && i != 4095)
+            printf("\n    ");
+    }
+    printf("\n");
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// SEC-DED (22,16), (39,32) and (72,64) code table generator
+//
+// Prints the per-byte parity tables and the syndrome-to-error-location
+// tables used in src/fec/src/fec_secded_gentab.c
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "liquid.internal.h"
+
+// print parity and error location tables for a SEC-DED code
+//  _name   :   code name, e.g. "secded7264"
+//  _P      :   parity matrix [size: _m x _k bytes]
+//  _w1     :   syndromes of weight-1 errors [size: 8*_k + _m]
+//  _k      :   number of message bytes
+//  _m      :   number of parity bits
+void secded_print_gentab(const char *    _name,
+                         unsigned char * _P,
+                         unsigned char * _w1,
+                         unsigned int    _k,
+                         unsigned int    _m)
+{
+    unsigned int i, j, x;
+
+    // parity contribution of each message byte
+    printf("// parity table: p(v) = T[0][v[0]] ^ T[1][v[1]] ^ ...\n");
+    printf("unsigned char %s_parity_gentab[%u][256] = {\n", _name, _k);
+    for (j=0; j<_k; j++) {
+        printf("  {");
+        for (x=0; x<256; x++) {
+            unsigned char p = 0;
+            for (i=0; i<_m; i++)
+                p |= (liquid_c_ones[_P[_k*i+j] & x] & 1) << (_m-i-1);
+            if ((x%16)==0) printf("\n    ");
+            printf("0x%.2x%s", p, x==255 ? "" : ", ");
+        }
+        printf("}%s\n", j==_k-1 ? "" : ",");
+    }
+    printf("};\n\n");
+
+    // error location (0xff if none) for each syndrome
+    unsigned int n = 8*_k + _m;
+    printf("// error location table indexed by syndrome (0xff: no single error)\n");
+    printf("unsigned char %s_ehat_gentab[%u] = {\n    ", _name, 1<<_m);
+    for (x=0; x<(1u<<_m); x++) {
+        unsigned char loc = 0xff;
+        for (i=0; i<n; i++) {
+            if (x != 0 && _w1[i] == x) {
+                loc = i;
+                break;
+            }
+        }
+        printf("0x%.2x", loc);
+        if (x != (1u<<_m)-1)
+            printf(", ");
+        else
+            printf("};");
+
+        if ( ((x+1)%16) == 0 && x != (1u<<_m)-1)
+            printf("\n    ");
+    }
+    printf("\n");
+}
+
+int main()
+{
+    printf("//\n// SEC-DED (22,16)\n//\n\n");
+    secded_print_gentab("secded2216", secded2216_P, secded2216_syndrome_w1, 2, 6);
+
+    printf("\n//\n// SEC-DED (39,32)\n//\n\n");
+    secded_print_gentab("secded3932", secded3932_P, secded3932_syndrome_w1, 4, 7);
+
+    printf("\n//\n// SEC-DED (72,64)\n//\n\n");
+    secded_print_gentab("secded7264", secded7264_P, secded7264_syndrome_w1, 8, 8);
+
+    return 0;
+}
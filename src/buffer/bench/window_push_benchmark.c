@@ -23,24 +23,25 @@
 #include <sys/resource.h>
 #include "liquid.h"
 
-#define WINDOW_PUSH_BENCH_API(N)        \
+#define WINDOW_PUSH_BENCH_API(N,L)      \
 (   struct rusage *_start,              \
     struct rusage *_finish,             \
     unsigned long int *_num_iterations) \
-{ window_push_bench(_start, _finish, _num_iterations, N); }
+{ window_push_bench(_start, _finish, _num_iterations, N, L); }
 
 // Helper function to keep code base small
 void window_push_bench(struct rusage *_start,
                        struct rusage *_finish,
                        unsigned long int *_num_iterations,
-                       unsigned int _n)
+                       unsigned int _n,
+                       liquid_window_layout _layout)
 {
     // normalize number of iterations
     *_num_iterations *= 8;
     if (*_num_iterations < 1) *_num_iterations = 1;
 
     // initialize port
-    windowcf w = windowcf_create(_n);
+    windowcf w = windowcf_create_layout(_n, _layout);
 
     unsigned long int i;
 
@@ -60,9 +61,14 @@ void window_push_bench(struct rusage *_start,
 }
 
 // 
-void benchmark_windowcf_push_n16     WINDOW_PUSH_BENCH_API(16)
-void benchmark_windowcf_push_n32     WINDOW_PUSH_BENCH_API(32)
-void benchmark_windowcf_push_n64     WINDOW_PUSH_BENCH_API(64)
-void benchmark_windowcf_push_n128    WINDOW_PUSH_BENCH_API(128)
-void benchmark_windowcf_push_n256    WINDOW_PUSH_BENCH_API(256)
+void benchmark_windowcf_push_n16     WINDOW_PUSH_BENCH_API(16, LIQUID_WINDOW_AUTO)
+void benchmark_windowcf_push_n32     WINDOW_PUSH_BENCH_API(32, LIQUID_WINDOW_AUTO)
+void benchmark_windowcf_push_n64     WINDOW_PUSH_BENCH_API(64, LIQUID_WINDOW_AUTO)
+void benchmark_windowcf_push_n128    WINDOW_PUSH_BENCH_API(128, LIQUID_WINDOW_AUTO)
+void benchmark_windowcf_push_n256    WINDOW_PUSH_BENCH_API(256, LIQUID_WINDOW_AUTO)
+
+// memory layouts
+void benchmark_windowcf_push_n1024_linear     WINDOW_PUSH_BENCH_API(1024, LIQUID_WINDOW_LINEAR)
+void benchmark_windowcf_push_n1024_duplicated WINDOW_PUSH_BENCH_API(1024, LIQUID_WINDOW_DUPLICATED)
+void benchmark_windowcf_push_n1024_mirrored   WINDOW_PUSH_BENCH_API(1024, LIQUID_WINDOW_MIRRORED)
 
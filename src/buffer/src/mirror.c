@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// mirrored (double-mapped) memory: the same physical pages mapped
+// twice into adjacent virtual address ranges, so that p[i] and p[i+n]
+// alias and any window of up to n bytes is contiguous regardless of
+// where it starts
+//
+
+#define _GNU_SOURCE
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "liquid.internal.h"
+
+#if HAVE_MEMFD_CREATE
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// mirrored allocations enabled?
+static int liquid_mirror_enabled = 1;
+
+// enable/disable mirrored allocations, e.g. to exercise the fallback
+// storage of objects created from here on (not thread-safe)
+void liquid_mirror_set_enabled(int _enabled)
+{
+    liquid_mirror_enabled = _enabled;
+}
+
+// system page size; mirrored allocations must be a multiple of it
+size_t liquid_mirror_pagesize()
+{
+#if HAVE_MEMFD_CREATE
+    long page_size = sysconf(_SC_PAGESIZE);
+    return page_size > 0 ? (size_t)page_size : 4096;
+#else
+    return 4096;
+#endif
+}
+
+// allocate _n bytes mapped twice (2*_n bytes of address space);
+// returns NULL if mirroring is not supported, disabled, or mapping fails
+//  _n      :   size in bytes, multiple of liquid_mirror_pagesize()
+void * liquid_mirror_alloc(size_t _n)
+{
+#if HAVE_MEMFD_CREATE
+    if (!liquid_mirror_enabled || _n == 0 || (_n % liquid_mirror_pagesize()) != 0)
+        return NULL;
+
+    // anonymous shared memory object backing both views
+    int fd = memfd_create("liquid-mirror", MFD_CLOEXEC);
+    if (fd < 0)
+        return NULL;
+    if (ftruncate(fd, _n) != 0) {
+        close(fd);
+        return NULL;
+    }
+
+    // reserve contiguous address space, then map object into each half
+    uint8_t * p = (uint8_t*) mmap(NULL, 2*_n, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
+        close(fd);
+        return NULL;
+    }
+    void * p0 = mmap(p,    _n, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    void * p1 = mmap(p+_n, _n, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    close(fd);
+    if (p0 != (void*)p || p1 != (void*)(p+_n)) {
+        munmap(p, 2*_n);
+        return NULL;
+    }
+    return p;
+#else
+    return NULL;
+#endif
+}
+
+// free memory allocated with liquid_mirror_alloc()
+//  _p      :   pointer returned by liquid_mirror_alloc()
+//  _n      :   size in bytes, as given to liquid_mirror_alloc()
+void liquid_mirror_free(void * _p,
+                        size_t _n)
+{
+#if HAVE_MEMFD_CREATE
+    if (_p != NULL)
+        munmap(_p, 2*_n);
+#endif
+}
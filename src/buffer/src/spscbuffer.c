@@ -0,0 +1,414 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// single-producer/single-consumer ring buffer
+//
+// One thread writes while another reads, with no locks on the fast
+// path: each side owns one counter and publishes it with release
+// semantics. Writers and readers reserve contiguous runs of elements
+// in place (acquire/commit, acquire/release) rather than copying in
+// and out. Where the platform supports it the ring is mapped twice
+// into adjacent address space so runs which wrap around the end are
+// still contiguous; otherwise each element is stored twice and commit
+// copies written elements to their mirror image.
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "liquid.internal.h"
+
+#if HAVE_PTHREAD_H
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+// padding to keep producer and consumer counters on separate lines
+#define SPSCBUFFER_CACHE_LINE   (64)
+
+// number of spin iterations between yielding the processor
+#define SPSCBUFFER_SPIN_COUNT   (256)
+
+#if defined(__x86_64__) || defined(__i386__)
+#  define SPSCBUFFER_PAUSE()    __builtin_ia32_pause()
+#else
+#  define SPSCBUFFER_PAUSE()
+#endif
+
+struct SPSCBUFFER(_s) {
+    T *          v;             // storage [size: 2*capacity x 1]
+    unsigned int capacity;      // number of elements, power of two
+    unsigned int mask;          // capacity - 1
+    size_t       num_bytes;     // mirrored mapping size, 0 if not mirrored
+    liquid_spscbuffer_wait wait;// wait mode
+
+    // written by producer only
+    char pad0[SPSCBUFFER_CACHE_LINE];
+    unsigned long int head;     // number of elements committed
+    int writer_waiting;         // producer is blocked
+
+    // written by consumer only
+    char pad1[SPSCBUFFER_CACHE_LINE];
+    unsigned long int tail;     // number of elements released
+    int reader_waiting;         // consumer is blocked
+
+    char pad2[SPSCBUFFER_CACHE_LINE];
+    int closed;                 // no more elements will be written
+#if HAVE_PTHREAD_H
+    pthread_mutex_t mutex;      // protects sleeping
+    pthread_cond_t  cond;       // signals counter change
+#endif
+};
+
+// check if _n elements can be read (_reader) or written
+int SPSCBUFFER(_ready)(SPSCBUFFER() _q,
+                       int          _reader,
+                       unsigned int _n);
+
+// wait until _n elements can be read (_reader) or written, or the
+// buffer is closed
+void SPSCBUFFER(_wait_ready)(SPSCBUFFER() _q,
+                             int          _reader,
+                             unsigned int _n);
+
+// wake other side if it is blocked on _flag
+void SPSCBUFFER(_notify)(SPSCBUFFER() _q,
+                         int *        _flag);
+
+// create ring buffer object holding at least _max_size elements
+SPSCBUFFER() SPSCBUFFER(_create)(unsigned int _max_size)
+{
+    // validate input
+    if (_max_size == 0) {
+        fprintf(stderr,"error: spscbuffer%s_create(), max size must be greater than zero\n", EXTENSION);
+        exit(1);
+    }
+
+    // create main object
+    SPSCBUFFER() q = (SPSCBUFFER()) malloc(sizeof(struct SPSCBUFFER(_s)));
+    memset(q, 0x00, sizeof(struct SPSCBUFFER(_s)));
+
+    // round capacity up to power of two, and to a whole number of
+    // pages so the ring can be mirrored
+    unsigned int page_len = liquid_mirror_pagesize() / sizeof(T);
+    q->capacity = 1;
+    while (q->capacity < _max_size || q->capacity < page_len)
+        q->capacity <<= 1;
+    q->mask = q->capacity - 1;
+
+    // try mirrored mapping, falling back to duplicated storage
+    q->num_bytes = q->capacity * sizeof(T);
+    q->v = (T*) liquid_mirror_alloc(q->num_bytes);
+    if (q->v == NULL) {
+        q->num_bytes = 0;
+        q->v = (T*) malloc(2*q->capacity*sizeof(T));
+    }
+
+    q->wait = LIQUID_SPSCBUFFER_NOWAIT;
+#if HAVE_PTHREAD_H
+    pthread_mutex_init(&q->mutex, NULL);
+    pthread_cond_init(&q->cond, NULL);
+#endif
+
+    // reset object
+    SPSCBUFFER(_reset)(q);
+
+    // return main object
+    return q;
+}
+
+// destroy object, freeing all internal memory
+void SPSCBUFFER(_destroy)(SPSCBUFFER() _q)
+{
+    // free internal memory
+    if (_q->num_bytes > 0)
+        liquid_mirror_free(_q->v, _q->num_bytes);
+    else
+        free(_q->v);
+
+#if HAVE_PTHREAD_H
+    pthread_mutex_destroy(&_q->mutex);
+    pthread_cond_destroy(&_q->cond);
+#endif
+
+    // free main object
+    free(_q);
+}
+
+// print object properties
+void SPSCBUFFER(_print)(SPSCBUFFER() _q)
+{
+    printf("spscbuffer%s [capacity: %u, mirrored: %s, elements: %u]\n",
+            EXTENSION,
+            _q->capacity,
+            _q->num_bytes > 0 ? "yes" : "no",
+            SPSCBUFFER(_size)(_q));
+}
+
+// clear contents and re-open buffer; not thread-safe
+void SPSCBUFFER(_reset)(SPSCBUFFER() _q)
+{
+    _q->head           = 0;
+    _q->tail           = 0;
+    _q->closed         = 0;
+    _q->writer_waiting = 0;
+    _q->reader_waiting = 0;
+}
+
+// set wait mode for acquire_write() and acquire_read()
+void SPSCBUFFER(_set_wait)(SPSCBUFFER()           _q,
+                           liquid_spscbuffer_wait _wait)
+{
+    if (_wait != LIQUID_SPSCBUFFER_NOWAIT &&
+        _wait != LIQUID_SPSCBUFFER_SPIN &&
+        _wait != LIQUID_SPSCBUFFER_BLOCK)
+    {
+        fprintf(stderr,"error: spscbuffer%s_set_wait(), invalid wait mode %d\n", EXTENSION, _wait);
+        exit(1);
+    }
+    _q->wait = _wait;
+}
+
+// get number of elements the buffer can hold
+unsigned int SPSCBUFFER(_max_size)(SPSCBUFFER() _q)
+{
+    return _q->capacity;
+}
+
+// get number of elements available to read
+unsigned int SPSCBUFFER(_size)(SPSCBUFFER() _q)
+{
+    unsigned long int tail = __atomic_load_n(&_q->tail, __ATOMIC_ACQUIRE);
+    unsigned long int head = __atomic_load_n(&_q->head, __ATOMIC_ACQUIRE);
+    return (unsigned int)(head - tail);
+}
+
+// get number of elements which can be written
+unsigned int SPSCBUFFER(_space_available)(SPSCBUFFER() _q)
+{
+    return _q->capacity - SPSCBUFFER(_size)(_q);
+}
+
+// is ring mirrored in virtual memory (no copy on commit)?
+int SPSCBUFFER(_is_mirrored)(SPSCBUFFER() _q)
+{
+    return _q->num_bytes > 0;
+}
+
+// reserve contiguous space for writing (producer); returns number of
+// elements reserved, fewer than _n if the buffer is short of space
+// (and not waiting) or closed
+//  _q      :   buffer object
+//  _n      :   number of elements requested, _n <= max_size
+//  _v      :   pointer to reserved space
+unsigned int SPSCBUFFER(_acquire_write)(SPSCBUFFER() _q,
+                                        unsigned int _n,
+                                        T **         _v)
+{
+    if (_n > _q->capacity) {
+        fprintf(stderr,"error: spscbuffer%s_acquire_write(), requested %u exceeds capacity %u\n",
+                EXTENSION, _n, _q->capacity);
+        exit(1);
+    }
+
+    if (_q->wait != LIQUID_SPSCBUFFER_NOWAIT)
+        SPSCBUFFER(_wait_ready)(_q, 0, _n);
+
+    // nothing may be written once closed
+    if (__atomic_load_n(&_q->closed, __ATOMIC_ACQUIRE)) {
+        *_v = _q->v + (_q->head & _q->mask);
+        return 0;
+    }
+
+    unsigned long int tail = __atomic_load_n(&_q->tail, __ATOMIC_ACQUIRE);
+    unsigned int num_free = _q->capacity - (unsigned int)(_q->head - tail);
+
+    *_v = _q->v + (_q->head & _q->mask);
+    return _n < num_free ? _n : num_free;
+}
+
+// publish elements written to reserved space (producer)
+//  _q      :   buffer object
+//  _n      :   number of elements written
+void SPSCBUFFER(_commit)(SPSCBUFFER() _q,
+                         unsigned int _n)
+{
+    unsigned long int tail = __atomic_load_n(&_q->tail, __ATOMIC_ACQUIRE);
+    if (_n > _q->capacity - (unsigned int)(_q->head - tail)) {
+        fprintf(stderr,"error: spscbuffer%s_commit(), cannot commit %u elements; only %u free\n",
+                EXTENSION, _n, _q->capacity - (unsigned int)(_q->head - tail));
+        exit(1);
+    }
+
+    // without mirrored mapping, copy elements to their mirror image
+    if (_q->num_bytes == 0 && _n > 0) {
+        unsigned int i0 = _q->head & _q->mask;
+        unsigned int n0 = _q->capacity - i0;
+        if (_n <= n0) {
+            memcpy(_q->v + i0 + _q->capacity, _q->v + i0, _n*sizeof(T));
+        } else {
+            memcpy(_q->v + i0 + _q->capacity, _q->v + i0, n0*sizeof(T));
+            memcpy(_q->v, _q->v + _q->capacity, (_n-n0)*sizeof(T));
+        }
+    }
+
+    __atomic_store_n(&_q->head, _q->head + _n, __ATOMIC_RELEASE);
+
+    if (_q->wait == LIQUID_SPSCBUFFER_BLOCK)
+        SPSCBUFFER(_notify)(_q, &_q->reader_waiting);
+}
+
+// get contiguous run of elements for reading (consumer); returns
+// number of elements available, fewer than _n if the buffer is short
+// of elements (and not waiting) or closed
+//  _q      :   buffer object
+//  _n      :   number of elements requested, _n <= max_size
+//  _v      :   pointer to elements
+unsigned int SPSCBUFFER(_acquire_read)(SPSCBUFFER() _q,
+                                       unsigned int _n,
+                                       T **         _v)
+{
+    if (_n > _q->capacity) {
+        fprintf(stderr,"error: spscbuffer%s_acquire_read(), requested %u exceeds capacity %u\n",
+                EXTENSION, _n, _q->capacity);
+        exit(1);
+    }
+
+    if (_q->wait != LIQUID_SPSCBUFFER_NOWAIT)
+        SPSCBUFFER(_wait_ready)(_q, 1, _n);
+
+    unsigned long int head = __atomic_load_n(&_q->head, __ATOMIC_ACQUIRE);
+    unsigned int num_available = (unsigned int)(head - _q->tail);
+
+    *_v = _q->v + (_q->tail & _q->mask);
+    return _n < num_available ? _n : num_available;
+}
+
+// release elements which have been read (consumer)
+//  _q      :   buffer object
+//  _n      :   number of elements to release
+void SPSCBUFFER(_release)(SPSCBUFFER() _q,
+                          unsigned int _n)
+{
+    unsigned long int head = __atomic_load_n(&_q->head, __ATOMIC_ACQUIRE);
+    if (_n > (unsigned int)(head - _q->tail)) {
+        fprintf(stderr,"error: spscbuffer%s_release(), cannot release %u elements; only %u available\n",
+                EXTENSION, _n, (unsigned int)(head - _q->tail));
+        exit(1);
+    }
+
+    __atomic_store_n(&_q->tail, _q->tail + _n, __ATOMIC_RELEASE);
+
+    if (_q->wait == LIQUID_SPSCBUFFER_BLOCK)
+        SPSCBUFFER(_notify)(_q, &_q->writer_waiting);
+}
+
+// close buffer (producer): waiting reader returns with remaining
+// elements, and waiting writer returns with no space
+void SPSCBUFFER(_close)(SPSCBUFFER() _q)
+{
+    __atomic_store_n(&_q->closed, 1, __ATOMIC_RELEASE);
+#if HAVE_PTHREAD_H
+    pthread_mutex_lock(&_q->mutex);
+    pthread_cond_broadcast(&_q->cond);
+    pthread_mutex_unlock(&_q->mutex);
+#endif
+}
+
+// is buffer closed?
+int SPSCBUFFER(_is_closed)(SPSCBUFFER() _q)
+{
+    return __atomic_load_n(&_q->closed, __ATOMIC_ACQUIRE);
+}
+
+// 
+// internal methods
+//
+
+// check if _n elements can be read (_reader) or written
+int SPSCBUFFER(_ready)(SPSCBUFFER() _q,
+                       int          _reader,
+                       unsigned int _n)
+{
+    if (__atomic_load_n(&_q->closed, __ATOMIC_ACQUIRE))
+        return 1;
+
+    unsigned int size = SPSCBUFFER(_size)(_q);
+    return _reader ? size >= _n : _q->capacity - size >= _n;
+}
+
+// wait until _n elements can be read (_reader) or written, or the
+// buffer is closed
+void SPSCBUFFER(_wait_ready)(SPSCBUFFER() _q,
+                             int          _reader,
+                             unsigned int _n)
+{
+    // spin first; for short waits this avoids a system call
+    unsigned int i;
+    for (i=0; i<SPSCBUFFER_SPIN_COUNT; i++) {
+        if (SPSCBUFFER(_ready)(_q, _reader, _n))
+            return;
+        SPSCBUFFER_PAUSE();
+    }
+
+#if HAVE_PTHREAD_H
+    if (_q->wait == LIQUID_SPSCBUFFER_BLOCK) {
+        // flag must be visible before re-checking counters, and the
+        // other side checks the flag after publishing its counter, so
+        // at least one of the two sees the other's update
+        int * flag = _reader ? &_q->reader_waiting : &_q->writer_waiting;
+        pthread_mutex_lock(&_q->mutex);
+        __atomic_store_n(flag, 1, __ATOMIC_SEQ_CST);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        while (!SPSCBUFFER(_ready)(_q, _reader, _n))
+            pthread_cond_wait(&_q->cond, &_q->mutex);
+        __atomic_store_n(flag, 0, __ATOMIC_SEQ_CST);
+        pthread_mutex_unlock(&_q->mutex);
+        return;
+    }
+#endif
+
+    // spin, yielding the processor between rounds
+    while (!SPSCBUFFER(_ready)(_q, _reader, _n)) {
+        for (i=0; i<SPSCBUFFER_SPIN_COUNT; i++)
+            SPSCBUFFER_PAUSE();
+#if HAVE_PTHREAD_H
+        sched_yield();
+#endif
+    }
+}
+
+// wake other side if it is blocked on _flag
+void SPSCBUFFER(_notify)(SPSCBUFFER() _q,
+                         int *        _flag)
+{
+#if HAVE_PTHREAD_H
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(_flag, __ATOMIC_RELAXED)) {
+        pthread_mutex_lock(&_q->mutex);
+        pthread_cond_broadcast(&_q->cond);
+        pthread_mutex_unlock(&_q->mutex);
+    }
+#endif
+}
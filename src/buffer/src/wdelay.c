@@ -33,6 +33,8 @@
 struct WDELAY(_s) {
     T * v;                      // allocated array pointer
     unsigned int delay;         // length of window
+    unsigned int n;             // ring length, 2^m >= delay
+    unsigned int mask;          // n-1
     unsigned int read_index;
 };
 
@@ -45,8 +47,14 @@ WDELAY() WDELAY(_create)(unsigned int _delay)
     // set internal values
     q->delay = _delay;
 
+    // power-of-two ring so indices wrap with a mask
+    q->n = 1;
+    while (q->n < q->delay)
+        q->n <<= 1;
+    q->mask = q->n - 1;
+
     // allocte memory
-    q->v = (T*) malloc((q->delay)*sizeof(T));
+    q->v = (T*) malloc((q->n)*sizeof(T));
     q->read_index = 0;
 
     // clear window
@@ -66,7 +74,7 @@ WDELAY() WDELAY(_recreate)(WDELAY()     _q,
     T * vtmp = (T*) malloc(_q->delay * sizeof(T));
     unsigned int i;
     for (i=0; i<_q->delay; i++)
-        vtmp[i] = _q->v[ (i + _q->read_index) % _q->delay ];
+        vtmp[i] = _q->v[ (i + _q->read_index) & _q->mask ];
     
     // destroy object and re-create it
     WDELAY(_destroy)(_q);
@@ -99,7 +107,7 @@ void WDELAY(_print)(WDELAY() _q)
     printf("wdelay [%u elements] :\n", _q->delay);
     unsigned int i, j;
     for (i=0; i<_q->delay; i++) {
-        j = (i + _q->read_index) % _q->delay;
+        j = (i + _q->read_index) & _q->mask;
         printf("%4u", i);
         BUFFER_PRINT_VALUE(_q->v[j]);
         printf("\n");
@@ -110,7 +118,7 @@ void WDELAY(_print)(WDELAY() _q)
 void WDELAY(_clear)(WDELAY() _q)
 {
     _q->read_index = 0;
-    memset(_q->v, 0, (_q->delay)*sizeof(T));
+    memset(_q->v, 0, (_q->n)*sizeof(T));
 }
 
 // read delayed sample from delay buffer object
@@ -129,13 +137,35 @@ void WDELAY(_read)(WDELAY() _q,
 void WDELAY(_push)(WDELAY() _q,
                    T        _v)
 {
-    // append value to end of buffer
-    _q->v[_q->read_index] = _v;
-
-    // increment index
-    _q->read_index++;
+    // append value 'delay' samples ahead of the read index
+    _q->v[(_q->read_index + _q->delay) & _q->mask] = _v;
 
-    // wrap around pointer
-    _q->read_index %= _q->delay;
+    // increment index, wrapping around
+    _q->read_index = (_q->read_index + 1) & _q->mask;
 }
 
+// push array of samples into delay buffer object
+//  _q  :   delay buffer object
+//  _v  :   input array [size: _n x 1]
+//  _n  :   number of input samples
+void WDELAY(_write)(WDELAY()     _q,
+                    T *          _v,
+                    unsigned int _n)
+{
+    // only the last ring length of input survives
+    unsigned int num_skip = _n > _q->n ? _n - _q->n : 0;
+    unsigned int i = (_q->read_index + _q->delay + num_skip) & _q->mask;
+    _q->read_index = (_q->read_index + _n) & _q->mask;
+    _v += num_skip;
+    _n -= num_skip;
+
+    // copy runs up to end of ring
+    while (_n > 0) {
+        unsigned int num_copy = _q->n - i;
+        num_copy = num_copy < _n ? num_copy : _n;
+        memmove(_q->v + i, _v, num_copy*sizeof(T));
+        i = (i + num_copy) & _q->mask;
+        _v += num_copy;
+        _n -= num_copy;
+    }
+}
@@ -39,16 +39,36 @@ struct WINDOW(_s) {
     unsigned int num_allocated; // number of elements allocated
                                 // in memory
     unsigned int read_index;
+    liquid_window_layout layout;// memory layout
+    size_t num_bytes;           // size of mirrored mapping (bytes)
 };
 
 // create window buffer object of length _n
 WINDOW() WINDOW(_create)(unsigned int _n)
+{
+    return WINDOW(_create_layout)(_n, LIQUID_WINDOW_AUTO);
+}
+
+// create window buffer object of length _n with a particular
+// memory layout
+//  _n      : window length
+//  _layout : memory layout (see liquid_window_layout)
+WINDOW() WINDOW(_create_layout)(unsigned int         _n,
+                                liquid_window_layout _layout)
 {
     // validate input
     if (_n == 0) {
         fprintf(stderr,"error: window%s_create(), window size must be greater than zero\n",
                 EXTENSION);
         exit(1);
+    } else if (_layout != LIQUID_WINDOW_AUTO &&
+               _layout != LIQUID_WINDOW_LINEAR &&
+               _layout != LIQUID_WINDOW_DUPLICATED &&
+               _layout != LIQUID_WINDOW_MIRRORED)
+    {
+        fprintf(stderr,"error: window%s_create_layout(), invalid layout %d\n",
+                EXTENSION, _layout);
+        exit(1);
     }
 
     // create initial object
@@ -59,12 +79,40 @@ WINDOW() WINDOW(_create)(unsigned int _n)
     q->m    = liquid_msb_index(_n); // effectively floor(log2(len))+1
     q->n    = 1<<(q->m);            // 2^m
     q->mask = q->n - 1;             // bit mask
+    q->num_bytes = 0;
+
+    // store ring twice unless mirroring is explicitly requested: a
+    // mirrored mapping is shared memory (also across fork()) and costs
+    // extra mappings per object
+    if (_layout == LIQUID_WINDOW_AUTO)
+        _layout = LIQUID_WINDOW_DUPLICATED;
+
+    if (_layout == LIQUID_WINDOW_MIRRORED) {
+        // ring size must be a whole number of pages
+        size_t page_size = liquid_mirror_pagesize();
+        while (q->n*sizeof(T) < page_size)
+            q->n <<= 1;
+        q->mask = q->n - 1;
+        q->num_bytes = q->n*sizeof(T);
+        q->v = (T*) liquid_mirror_alloc(q->num_bytes);
+        if (q->v == NULL) {
+            // not supported; store elements twice instead
+            q->num_bytes = 0;
+            q->n    = 1<<(q->m);
+            q->mask = q->n - 1;
+            _layout = LIQUID_WINDOW_DUPLICATED;
+        }
+    }
+    q->layout = _layout;
 
-    // number of elements to allocate to memory
-    q->num_allocated = q->n + q->len - 1;
+    // number of elements to allocate to memory: linear layout keeps
+    // len-1 elements of history past the end of the ring; others
+    // keep (or map) a full copy of it
+    q->num_allocated = _layout == LIQUID_WINDOW_LINEAR ? q->n + q->len - 1 : 2*q->n;
 
     // allocte memory
-    q->v = (T*) malloc((q->num_allocated)*sizeof(T));
+    if (q->num_bytes == 0)
+        q->v = (T*) malloc((q->num_allocated)*sizeof(T));
     q->read_index = 0;
 
     // clear window
@@ -85,7 +133,7 @@ WINDOW() WINDOW(_recreate)(WINDOW() _q, unsigned int _n)
         return _q;
 
     // create new window
-    WINDOW() w = WINDOW(_create)(_n);
+    WINDOW() w = WINDOW(_create_layout)(_n, _q->layout);
 
     // copy old values
     T* r;
@@ -114,7 +162,10 @@ WINDOW() WINDOW(_recreate)(WINDOW() _q, unsigned int _n)
 void WINDOW(_destroy)(WINDOW() _q)
 {
     // free internal memory array
-    free(_q->v);
+    if (_q->num_bytes > 0)
+        liquid_mirror_free(_q->v, _q->num_bytes);
+    else
+        free(_q->v);
 
     // free main object memory
     free(_q);
@@ -163,8 +214,15 @@ void WINDOW(_clear)(WINDOW() _q)
     // reset read index
     _q->read_index = 0;
 
-    // clear all allocated memory
-    memset(_q->v, 0, (_q->num_allocated)*sizeof(T));
+    // clear all allocated memory (mirrored mapping aliases upper half)
+    unsigned int num_clear = _q->num_bytes > 0 ? _q->n : _q->num_allocated;
+    memset(_q->v, 0, num_clear*sizeof(T));
+}
+
+// get memory layout (never LIQUID_WINDOW_AUTO)
+liquid_window_layout WINDOW(_get_layout)(WINDOW() _q)
+{
+    return _q->layout;
 }
 
 // read window buffer contents
@@ -205,12 +263,22 @@ void WINDOW(_push)(WINDOW() _q, T _v)
     // wrap around pointer
     _q->read_index &= _q->mask;
 
-    // if pointer wraps around, copy excess memory
-    if (_q->read_index == 0)
-        memmove(_q->v, _q->v + _q->n, (_q->len-1)*sizeof(T));
+    if (_q->layout == LIQUID_WINDOW_LINEAR) {
+        // if pointer wraps around, copy excess memory
+        if (_q->read_index == 0)
+            memmove(_q->v, _q->v + _q->n, (_q->len-1)*sizeof(T));
 
-    // append value to end of buffer
-    _q->v[_q->read_index + _q->len - 1] = _v;
+        // append value to end of buffer
+        _q->v[_q->read_index + _q->len - 1] = _v;
+        return;
+    }
+
+    // store value in ring and its image one ring length later
+    // (aliased when mirrored); window never needs moving
+    unsigned int i = (_q->read_index + _q->len - 1) & _q->mask;
+    _q->v[i] = _v;
+    if (_q->layout == LIQUID_WINDOW_DUPLICATED)
+        _q->v[i + _q->n] = _v;
 }
 
 // write array of elements onto window buffer
@@ -221,9 +289,40 @@ void WINDOW(_write)(WINDOW()     _q,
                     T *          _v,
                     unsigned int _n)
 {
-    // TODO make this more efficient
-    unsigned int i;
-    for (i=0; i<_n; i++)
-        WINDOW(_push)(_q, _v[i]);
-}
+    if (_q->layout == LIQUID_WINDOW_LINEAR) {
+        // copy runs up to the point the window wraps
+        while (_n > 0) {
+            unsigned int num_copy = _q->mask - _q->read_index;
+            if (num_copy == 0) {
+                WINDOW(_push)(_q, *_v++);
+                _n--;
+                continue;
+            }
+            num_copy = num_copy < _n ? num_copy : _n;
+            memmove(_q->v + _q->read_index + _q->len, _v, num_copy*sizeof(T));
+            _q->read_index += num_copy;
+            _v += num_copy;
+            _n -= num_copy;
+        }
+        return;
+    }
 
+    // only the last ring length of input survives
+    unsigned int num_skip = _n > _q->n ? _n - _q->n : 0;
+    unsigned int i = (_q->read_index + _q->len + num_skip) & _q->mask;
+    _q->read_index = (_q->read_index + _n) & _q->mask;
+    _v += num_skip;
+    _n -= num_skip;
+
+    // copy runs up to end of ring
+    while (_n > 0) {
+        unsigned int num_copy = _q->n - i;
+        num_copy = num_copy < _n ? num_copy : _n;
+        memmove(_q->v + i, _v, num_copy*sizeof(T));
+        if (_q->layout == LIQUID_WINDOW_DUPLICATED)
+            memmove(_q->v + i + _q->n, _v, num_copy*sizeof(T));
+        i = (i + num_copy) & _q->mask;
+        _v += num_copy;
+        _n -= num_copy;
+    }
+}
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// single-producer/single-consumer ring buffer autotest
+//
+
+#include <stdlib.h>
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+#if HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+
+// create buffer with mirrored or duplicated (fallback) storage
+spscbufferf spscbuffer_autotest_create(unsigned int _max_size,
+                                       int          _mirrored)
+{
+    liquid_mirror_set_enabled(_mirrored);
+    spscbufferf q = spscbufferf_create(_max_size);
+    liquid_mirror_set_enabled(1);
+
+#if HAVE_MEMFD_CREATE
+    CONTEND_EQUALITY(spscbufferf_is_mirrored(q), _mirrored);
+#else
+    CONTEND_EQUALITY(spscbufferf_is_mirrored(q), 0);
+#endif
+    return q;
+}
+
+// write/read through the ring, checking that runs which wrap around
+// the end of the storage are contiguous
+void spscbuffer_autotest_wrap(int _mirrored)
+{
+    spscbufferf q = spscbuffer_autotest_create(100, _mirrored);
+    unsigned int n = spscbufferf_max_size(q);
+    CONTEND_GREATER_THAN(n, 99);
+    CONTEND_EQUALITY(n & (n-1), 0);
+    CONTEND_EQUALITY(spscbufferf_size(q), 0);
+    CONTEND_EQUALITY(spscbufferf_space_available(q), n);
+
+    float * w;
+    float * r;
+    unsigned int i, k;
+    float x = 0.0f;   // next value to write
+    float y = 0.0f;   // next value expected
+    for (k=0; k<7; k++) {
+        // odd sizes so each pass starts at a different offset
+        unsigned int num_write = n - 3 - k;
+        CONTEND_EQUALITY(spscbufferf_acquire_write(q, num_write, &w), num_write);
+        for (i=0; i<num_write; i++)
+            w[i] = x++;
+        spscbufferf_commit(q, num_write);
+        CONTEND_EQUALITY(spscbufferf_size(q), num_write);
+
+        // read back in one contiguous run
+        CONTEND_EQUALITY(spscbufferf_acquire_read(q, n, &r), num_write);
+        for (i=0; i<num_write; i++)
+            CONTEND_EQUALITY(r[i], y++);
+        spscbufferf_release(q, num_write);
+        CONTEND_EQUALITY(spscbufferf_size(q), 0);
+    }
+
+    spscbufferf_destroy(q);
+}
+
+void autotest_spscbufferf_wrap()            { spscbuffer_autotest_wrap(1); }
+void autotest_spscbufferf_wrap_duplicated() { spscbuffer_autotest_wrap(0); }
+
+// partial reservations when short of space or data
+void autotest_spscbuffercf_partial()
+{
+    spscbuffercf q = spscbuffercf_create(64);
+    unsigned int n = spscbuffercf_max_size(q);
+
+    float complex * w;
+    float complex * r;
+    unsigned int i;
+
+    // nothing to read
+    CONTEND_EQUALITY(spscbuffercf_acquire_read(q, 1, &r), 0);
+
+    // fill all but 10 slots
+    CONTEND_EQUALITY(spscbuffercf_acquire_write(q, n-10, &w), n-10);
+    for (i=0; i<n-10; i++)
+        w[i] = i + _Complex_I*(float)(n-i);
+    spscbuffercf_commit(q, n-10);
+
+    // request more than is free
+    CONTEND_EQUALITY(spscbuffercf_acquire_write(q, 20, &w), 10);
+    spscbuffercf_commit(q, 0);
+
+    // request less than is available, then the remainder
+    CONTEND_EQUALITY(spscbuffercf_acquire_read(q, 5, &r), 5);
+    for (i=0; i<5; i++)
+        CONTEND_EQUALITY(r[i], i + _Complex_I*(float)(n-i));
+    spscbuffercf_release(q, 5);
+    CONTEND_EQUALITY(spscbuffercf_acquire_read(q, n, &r), n-15);
+    CONTEND_EQUALITY(r[0], 5 + _Complex_I*(float)(n-5));
+    spscbuffercf_release(q, n-15);
+
+    spscbuffercf_destroy(q);
+}
+
+// closing the buffer drains remaining elements and refuses writes
+void autotest_spscbufferf_close()
+{
+    spscbufferf q = spscbufferf_create(16);
+    spscbufferf_set_wait(q, LIQUID_SPSCBUFFER_BLOCK);
+    unsigned int n = spscbufferf_max_size(q);
+
+    float * w;
+    float * r;
+    CONTEND_EQUALITY(spscbufferf_acquire_write(q, 3, &w), 3);
+    w[0] = 1.0f; w[1] = 2.0f; w[2] = 3.0f;
+    spscbufferf_commit(q, 3);
+    spscbufferf_close(q);
+    CONTEND_EQUALITY(spscbufferf_is_closed(q), 1);
+
+    // write refused; blocking read returns what remains
+    CONTEND_EQUALITY(spscbufferf_acquire_write(q, 1, &w), 0);
+    CONTEND_EQUALITY(spscbufferf_acquire_read(q, n, &r), 3);
+    CONTEND_EQUALITY(r[2], 3.0f);
+    spscbufferf_release(q, 3);
+    CONTEND_EQUALITY(spscbufferf_acquire_read(q, n, &r), 0);
+
+    // reset re-opens buffer
+    spscbufferf_reset(q);
+    CONTEND_EQUALITY(spscbufferf_is_closed(q), 0);
+    CONTEND_EQUALITY(spscbufferf_acquire_write(q, 1, &w), 1);
+
+    spscbufferf_destroy(q);
+}
+
+#if HAVE_PTHREAD_H
+// number of elements passed between threads
+#define SPSCBUFFER_AUTOTEST_NUM (1<<20)
+
+// producer thread: write counting sequence in irregular chunks
+void * spscbuffer_autotest_producer(void * _arg)
+{
+    spscbufferf q = (spscbufferf) _arg;
+    unsigned int max_write = spscbufferf_max_size(q) / 2;
+    unsigned int seed = 1;
+    unsigned int i, n = 0;
+    float * w;
+    while (n < SPSCBUFFER_AUTOTEST_NUM) {
+        seed = seed*1103515245 + 12345;
+        unsigned int num_write = 1 + (seed >> 16) % max_write;
+        if (num_write > SPSCBUFFER_AUTOTEST_NUM - n)
+            num_write = SPSCBUFFER_AUTOTEST_NUM - n;
+        num_write = spscbufferf_acquire_write(q, num_write, &w);
+        for (i=0; i<num_write; i++)
+            w[i] = (float)(n++ & 0xffff);
+        spscbufferf_commit(q, num_write);
+    }
+    spscbufferf_close(q);
+    return NULL;
+}
+
+// pass sequence between two threads and check order at the consumer
+void spscbuffer_autotest_threads(liquid_spscbuffer_wait _wait,
+                                 int                    _mirrored)
+{
+    spscbufferf q = spscbuffer_autotest_create(1024, _mirrored);
+    spscbufferf_set_wait(q, _wait);
+    unsigned int max_read = spscbufferf_max_size(q) / 3;
+
+    pthread_t producer;
+    pthread_create(&producer, NULL, spscbuffer_autotest_producer, q);
+
+    // consume, checking order
+    unsigned int i, n = 0, num_errors = 0;
+    unsigned int seed = 7;
+    float * r;
+    while (1) {
+        seed = seed*1103515245 + 12345;
+        unsigned int num_read = spscbufferf_acquire_read(q, 1 + (seed >> 16) % max_read, &r);
+        if (num_read == 0 && spscbufferf_is_closed(q) && spscbufferf_size(q) == 0)
+            break;
+        for (i=0; i<num_read; i++)
+            num_errors += r[i] != (float)(n++ & 0xffff);
+        spscbufferf_release(q, num_read);
+    }
+    pthread_join(producer, NULL);
+
+    CONTEND_EQUALITY(n, SPSCBUFFER_AUTOTEST_NUM);
+    CONTEND_EQUALITY(num_errors, 0);
+
+    spscbufferf_destroy(q);
+}
+
+#else
+void spscbuffer_autotest_threads(liquid_spscbuffer_wait _wait,
+                                 int                    _mirrored)
+{
+    AUTOTEST_WARN("spscbuffer threaded test skipped (no pthread support)");
+}
+#endif
+
+void autotest_spscbufferf_threads_block()            { spscbuffer_autotest_threads(LIQUID_SPSCBUFFER_BLOCK, 1); }
+void autotest_spscbufferf_threads_spin()             { spscbuffer_autotest_threads(LIQUID_SPSCBUFFER_SPIN,  1); }
+void autotest_spscbufferf_threads_block_duplicated() { spscbuffer_autotest_threads(LIQUID_SPSCBUFFER_BLOCK, 0); }
+void autotest_spscbufferf_threads_spin_duplicated()  { spscbuffer_autotest_threads(LIQUID_SPSCBUFFER_SPIN,  0); }
@@ -85,3 +85,43 @@ void autotest_wdelayf()
     wdelayf_destroy(w);
 }
 
+
+// block write matches individual pushes
+void autotest_wdelayf_write()
+{
+    wdelayf q0 = wdelayf_create(5);
+    wdelayf q1 = wdelayf_create(5);
+
+    float x[40];
+    unsigned int i, k, n = 0;
+    for (i=0; i<40; i++)
+        x[i] = (float)(i+1);
+
+    // block sizes below, at and beyond ring length
+    unsigned int num_write[6] = {3, 1, 8, 0, 13, 2};
+    for (k=0; k<6; k++) {
+        wdelayf_write(q1, x + n, num_write[k]);
+        for (i=0; i<num_write[k]; i++)
+            wdelayf_push(q0, x[n+i]);
+        n += num_write[k];
+
+        float y0, y1;
+        wdelayf_read(q0, &y0);
+        wdelayf_read(q1, &y1);
+        CONTEND_EQUALITY(y0, y1);
+        CONTEND_EQUALITY(y0, n > 4 ? (float)(n-4) : 0.0f);
+    }
+
+    // drain remaining contents
+    for (i=0; i<5; i++) {
+        float y0, y1;
+        wdelayf_push(q0, 0.0f);
+        wdelayf_push(q1, 0.0f);
+        wdelayf_read(q0, &y0);
+        wdelayf_read(q1, &y1);
+        CONTEND_EQUALITY(y0, y1);
+    }
+
+    wdelayf_destroy(q0);
+    wdelayf_destroy(q1);
+}
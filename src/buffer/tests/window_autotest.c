@@ -141,3 +141,74 @@ void autotest_windowf()
     printf("done.\n");
 }
 
+
+// push and write random blocks through window with a particular
+// layout, comparing contents against a simple shift register
+void window_layout_test(unsigned int         _n,
+                        liquid_window_layout _layout)
+{
+    windowcf q = windowcf_create_layout(_n, _layout);
+    if (_layout == LIQUID_WINDOW_AUTO) {
+        CONTEND_EQUALITY(windowcf_get_layout(q), LIQUID_WINDOW_DUPLICATED);
+    } else if (_layout != LIQUID_WINDOW_MIRRORED) {
+        CONTEND_EQUALITY(windowcf_get_layout(q), _layout);
+    }
+    CONTEND_INEQUALITY(windowcf_get_layout(q), LIQUID_WINDOW_AUTO);
+
+    float complex buf[3*_n+7];  // reference: latest _n values
+    float complex x[3*_n+7];    // input block
+    float complex * r;
+    unsigned int i, j, k;
+    for (i=0; i<_n; i++)
+        buf[i] = 0.0f;
+
+    unsigned int seed = 1;
+    float complex v = 0.0f;
+    for (k=0; k<40; k++) {
+        seed = seed*1103515245 + 12345;
+        unsigned int num_write = (seed >> 16) % (3*_n+7);
+
+        for (i=0; i<num_write; i++)
+            x[i] = (v += 1.0f - 0.5f*_Complex_I);
+        if (k % 3 == 0) {
+            for (i=0; i<num_write; i++)
+                windowcf_push(q, x[i]);
+        } else {
+            windowcf_write(q, x, num_write);
+        }
+
+        // update reference
+        for (i=0; i<num_write; i++) {
+            for (j=0; j<_n-1; j++)
+                buf[j] = buf[j+1];
+            buf[_n-1] = x[i];
+        }
+
+        windowcf_read(q, &r);
+        CONTEND_SAME_DATA(r, buf, _n*sizeof(float complex));
+    }
+
+    // clear
+    windowcf_clear(q);
+    windowcf_read(q, &r);
+    for (i=0; i<_n; i++)
+        CONTEND_EQUALITY(r[i], 0.0f);
+
+    // recreate keeps layout and latest values
+    liquid_window_layout layout = windowcf_get_layout(q);
+    windowcf_write(q, buf, _n);
+    q = windowcf_recreate(q, _n+5);
+    CONTEND_EQUALITY(windowcf_get_layout(q), layout);
+    windowcf_read(q, &r);
+    CONTEND_SAME_DATA(r+5, buf, _n*sizeof(float complex));
+
+    windowcf_destroy(q);
+}
+
+void autotest_windowcf_layout_linear()     { window_layout_test(  10, LIQUID_WINDOW_LINEAR);     }
+void autotest_windowcf_layout_duplicated() { window_layout_test(  10, LIQUID_WINDOW_DUPLICATED); }
+void autotest_windowcf_layout_mirrored()   { window_layout_test(  10, LIQUID_WINDOW_MIRRORED);   }
+void autotest_windowcf_layout_auto()       { window_layout_test(  10, LIQUID_WINDOW_AUTO);       }
+void autotest_windowcf_layout_one()        { window_layout_test(   1, LIQUID_WINDOW_AUTO);       }
+void autotest_windowcf_layout_page()       { window_layout_test( 700, LIQUID_WINDOW_AUTO);       }
+void autotest_windowcf_layout_linear_page(){ window_layout_test( 700, LIQUID_WINDOW_LINEAR);     }
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small
+//  _awgn       :   enable additive noise?
+//  _all        :   enable all other impairments?
+void channel_cccf_bench(struct rusage *     _start,
+                        struct rusage *     _finish,
+                        unsigned long int * _num_iterations,
+                        int                 _awgn,
+                        int                 _all)
+{
+    unsigned long int i;
+    unsigned int n = 1024;  // block size
+
+    channel_cccf q = channel_cccf_create();
+    if (_awgn)
+        channel_cccf_add_awgn(q, -60.0f, 30.0f);
+    if (_all) {
+        channel_cccf_add_carrier_offset(q, 0.01f, 0.3f);
+        channel_cccf_add_multipath     (q, NULL, 11);
+        channel_cccf_add_shadowing     (q, 1.0f, 0.1f);
+        channel_cccf_add_resamp        (q, 0.0f, 1.01f);
+    }
+
+    float complex * x = (float complex*) malloc(  n*sizeof(float complex));
+    float complex * y = (float complex*) malloc(2*n*sizeof(float complex));
+    for (i=0; i<n; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+    unsigned int ny;
+
+    // scale number of iterations by block size
+    *_num_iterations /= n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        channel_cccf_execute(q, x, n, y, &ny);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= n;
+
+    channel_cccf_destroy(q);
+    free(x);
+    free(y);
+}
+
+#define CHANNEL_CCCF_BENCHMARK_API(AWGN,ALL)    \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ channel_cccf_bench(_start, _finish, _num_iterations, AWGN, ALL); }
+
+//
+// Channel benchmark prototypes
+//
+void benchmark_channel_cccf_none    CHANNEL_CCCF_BENCHMARK_API(0, 0)
+void benchmark_channel_cccf_awgn    CHANNEL_CCCF_BENCHMARK_API(1, 0)
+void benchmark_channel_cccf_all     CHANNEL_CCCF_BENCHMARK_API(1, 1)
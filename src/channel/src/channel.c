@@ -29,13 +29,15 @@
 #include <stdio.h>
 #include <math.h>
 
+// number of samples processed by each impairment in a single pass
+#define CHANNEL_BLOCK_LEN   (256)
+
 // portable structured channel object
 struct CHANNEL(_s) {
     // sample rate
     int             enabled_resamp;     // resampler enabled?
     unsigned int    resamp_m;           // resampling filter semi-length
     float           resamp_rate;        // resampling rate
-    TO              resamp_buf[8];      // resampling buffer
     RESAMP()        resamp;             // resampling filter
 
     // additive white Gauss noise
@@ -53,15 +55,25 @@ struct CHANNEL(_s) {
 
     // multi-path channel
     int             enabled_multipath;  // enable multi-path channel filter?
-    FIRFILT()       channel_filter;     // multi-path channel filter object
+    DOTPROD()       channel_filter;     // multi-path channel filter object
     TC *            h;                  // multi-path channel filter coefficients
+    TC *            hr;                 // coefficients in reverse order
     unsigned int    h_len;              // multi-path channel filter length
+    TO *            channel_buf;        // multi-path channel filter buffer
 
     // shadowing channel
     int             enabled_shadowing;  // enable shadowing?
     IIRFILT()       shadowing_filter;   // shadowing filter object
     float           shadowing_std;      // shadowing standard deviation
     float           shadowing_fd;       // shadowing Doppler frequency
+    float           shadowing_buf[CHANNEL_BLOCK_LEN];   // shadowing gain
+
+    // noise buffer for a single block
+    TO              awgn_buf[CHANNEL_BLOCK_LEN];
+
+    // random number generation
+    randgen         rng_internal;       // internal generator (owned)
+    randgen         rng;                // active generator
 };
 
 // create structured channel object with default parameters
@@ -97,9 +109,16 @@ CHANNEL() CHANNEL(_create_delay)(unsigned int _m)
     q->h_len            = 1;
     q->h                = (TC*) malloc(q->h_len*sizeof(TC));
     q->h[0]             = 1.0f;
-    q->channel_filter   = FIRFILT(_create)(q->h, q->h_len);
+    q->hr               = (TC*) malloc(q->h_len*sizeof(TC));
+    q->channel_filter   = DOTPROD(_create)(q->h, q->h_len);
+    q->channel_buf      = (TO*) malloc((q->h_len - 1 + CHANNEL_BLOCK_LEN)*sizeof(TO));
     q->shadowing_filter = NULL;
 
+    // internal random number generator, seeded from rand() so that
+    // separate channel objects see independent noise
+    q->rng_internal     = randgen_create(rand());
+    q->rng              = q->rng_internal;
+
     // return object
     return q;
 }
@@ -109,10 +128,13 @@ void CHANNEL(_destroy)(CHANNEL() _q)
 {
     // destroy internal objects
     NCO(_destroy)(_q->nco);
-    FIRFILT(_destroy)(_q->channel_filter);
+    DOTPROD(_destroy)(_q->channel_filter);
+    free(_q->channel_buf);
     if (_q->shadowing_filter != NULL)
         IIRFILT(_destroy)(_q->shadowing_filter);
     free(_q->h);
+    free(_q->hr);
+    randgen_destroy(_q->rng_internal);
 
     // free main object memory
     free(_q);
@@ -129,6 +151,16 @@ void CHANNEL(_print)(CHANNEL() _q)
     if (_q->enabled_shadowing)  printf("  shadowing: std=%.3fdB, fd=%.3f\n", _q->shadowing_std, _q->shadowing_fd);
 }
 
+// set random number generator used for noise and fading; the generator
+// is not owned by the channel and must outlive it
+//  _q      : channel object
+//  _rng    : random number generator (NULL for internal generator)
+void CHANNEL(_set_randgen)(CHANNEL() _q,
+                           randgen   _rng)
+{
+    _q->rng = (_rng == NULL) ? _q->rng_internal : _rng;
+}
+
 // apply additive white Gausss noise impairment
 //  _q              : channel object
 //  _noise_floor_dB : noise floor power spectral density
@@ -218,8 +250,14 @@ void CHANNEL(_add_multipath)(CHANNEL()    _q,
 
     // set values appropriately
     // TODO: test for types other than float complex
-    if (_q->h_len != _h_len)
-        _q->h = (TC*) realloc(_q->h, _h_len*sizeof(TC));
+    if (_q->h_len != _h_len) {
+        _q->h  = (TC*) realloc(_q->h,  _h_len*sizeof(TC));
+        _q->hr = (TC*) realloc(_q->hr, _h_len*sizeof(TC));
+
+        // re-allocate and clear filter buffer
+        _q->channel_buf = (TO*) realloc(_q->channel_buf, (_h_len - 1 + CHANNEL_BLOCK_LEN)*sizeof(TO));
+        memset(_q->channel_buf, 0x00, (_h_len - 1)*sizeof(TO));
+    }
 
     // update length
     _q->h_len = _h_len;
@@ -242,8 +280,11 @@ void CHANNEL(_add_multipath)(CHANNEL()    _q,
         memmove(_q->h, _h, _q->h_len*sizeof(TC));
     }
 
-    // re-create channel filter
-    _q->channel_filter = FIRFILT(_recreate)(_q->channel_filter, _q->h, _q->h_len);
+    // re-create channel filter, loading coefficients in reverse order
+    unsigned int i;
+    for (i=0; i<_q->h_len; i++)
+        _q->hr[i] = _q->h[_q->h_len - i - 1];
+    _q->channel_filter = DOTPROD(_recreate)(_q->channel_filter, _q->hr, _q->h_len);
 }
 
 // apply slowly-varying shadowing impairment
@@ -287,7 +328,9 @@ unsigned int CHANNEL(_get_delay)(CHANNEL() _q)
     return 2*RESAMP(_get_delay)(_q->resamp) + 1;
 }
 
-// apply channel impairments on input array
+// apply channel impairments on input array; each enabled impairment
+// runs over a block of samples at a time, with noise drawn from the
+// generator in the same order as if processing one sample at a time
 //  _q      : channel object
 //  _x      : input array [size: _nx x 1]
 //  _nx     : input array length
@@ -301,48 +344,65 @@ void CHANNEL(_execute)(CHANNEL()      _q,
 {
     unsigned int i;
     unsigned int j;
-    unsigned int num_resamp;    // resampler output length
-    unsigned int n=0;           // number of output samples
-
-    // apply channel effects on each input sample
-    for (i=0; i<_nx; i++) {
-
-        // apply resampler (always push through resampling filter)
-        RESAMP(_execute)(_q->resamp, _x[i], _q->resamp_buf, &num_resamp);
-
-        // run resulting resampled result through remaining channel objects
-        for (j=0; j<num_resamp; j++) {
-            // apply filter
-            if (_q->enabled_multipath) {
-                FIRFILT(_push)(   _q->channel_filter,  _q->resamp_buf[j]);
-                FIRFILT(_execute)(_q->channel_filter, &_y[n]);
-            } else
-                _y[n] = _q->resamp_buf[j];
-
-            // apply shadowing if enabled
-            if (_q->enabled_shadowing) {
-                // TODO: use type-specific value other than float
-                float g = 0;
-                IIRFILT(_execute)(_q->shadowing_filter, randnf()*_q->shadowing_std, &g);
+    unsigned int n;             // number of output samples
+    unsigned int m;             // number of samples in block
+
+    // apply resampler (always push through resampling filter)
+    RESAMP(_execute_block)(_q->resamp, _x, _nx, _y, &n);
+
+    // run resampled result through remaining channel objects
+    for (i=0; i<n; i+=m) {
+        m = (n - i) < CHANNEL_BLOCK_LEN ? n - i : CHANNEL_BLOCK_LEN;
+        TO * y = _y + i;
+
+        // apply filter
+        if (_q->enabled_multipath) {
+            // append block to filter buffer and compute each output
+            memmove(_q->channel_buf + _q->h_len - 1, y, m*sizeof(TO));
+            for (j=0; j<m; j++)
+                DOTPROD(_execute)(_q->channel_filter, _q->channel_buf + j, &y[j]);
+
+            // retain most recent samples for next block
+            memmove(_q->channel_buf, _q->channel_buf + m, (_q->h_len - 1)*sizeof(TO));
+        }
+
+        // generate random values for block
+        if (_q->enabled_shadowing && _q->enabled_awgn) {
+            // interleave to preserve order of samples drawn
+            for (j=0; j<m; j++) {
+                _q->shadowing_buf[j] = randgen_gauss (_q->rng);
+                _q->awgn_buf[j]      = randgen_cgauss(_q->rng);
+            }
+        } else if (_q->enabled_shadowing) {
+            randgen_gauss_block(_q->rng, _q->shadowing_buf, m);
+        } else if (_q->enabled_awgn) {
+            randgen_cgauss_block(_q->rng, _q->awgn_buf, m);
+        }
+
+        // apply shadowing if enabled
+        if (_q->enabled_shadowing) {
+            // TODO: use type-specific value other than float
+            for (j=0; j<m; j++)
+                _q->shadowing_buf[j] *= _q->shadowing_std;
+            IIRFILT(_execute_block)(_q->shadowing_filter, _q->shadowing_buf, m, _q->shadowing_buf);
+            for (j=0; j<m; j++) {
+                float g = _q->shadowing_buf[j];
                 g /= _q->shadowing_fd * 6.9f;
                 g = powf(10.0f, g/20.0f);
-                _y[n] *= g;
+                y[j] *= g;
             }
+        }
 
-            // apply carrier if enabled
-            if (_q->enabled_carrier) {
-                NCO(_mix_up)(_q->nco, _y[n], &_y[n]);
-                NCO(_step)  (_q->nco);
-            }
+        // apply carrier if enabled
+        if (_q->enabled_carrier)
+            NCO(_mix_block_up)(_q->nco, y, y, m);
 
-            // apply AWGN if enabled
-            if (_q->enabled_awgn) {
-                _y[n] *= _q->gamma;
-                _y[n] += _q->nstd * ( randnf() + _Complex_I*randnf() ) * M_SQRT1_2;
+        // apply AWGN if enabled
+        if (_q->enabled_awgn) {
+            for (j=0; j<m; j++) {
+                y[j] *= _q->gamma;
+                y[j] += _q->nstd * _q->awgn_buf[j];
             }
-
-            // increment output sample counter
-            n++;
         }
     }
 
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+//
+// AUTOTEST: channels sharing a generator seed produce identical output
+//
+void autotest_channel_cccf_randgen()
+{
+    unsigned int n = 400;
+    float complex x[n], y0[n], y1[n];
+    unsigned int i, ny0, ny1;
+    for (i=0; i<n; i++)
+        x[i] = cexpf(_Complex_I*0.1f*i);
+
+    randgen r0 = randgen_create(42);
+    randgen r1 = randgen_create(42);
+
+    channel_cccf q0 = channel_cccf_create();
+    channel_cccf q1 = channel_cccf_create();
+    channel_cccf_add_awgn     (q0, -30.0f, 20.0f);
+    channel_cccf_add_awgn     (q1, -30.0f, 20.0f);
+    channel_cccf_add_shadowing(q0, 1.0f, 0.1f);
+    channel_cccf_add_shadowing(q1, 1.0f, 0.1f);
+    channel_cccf_set_randgen  (q0, r0);
+    channel_cccf_set_randgen  (q1, r1);
+
+    channel_cccf_execute(q0, x, n, y0, &ny0);
+    channel_cccf_execute(q1, x, n, y1, &ny1);
+    CONTEND_EQUALITY(ny0, n);
+    CONTEND_EQUALITY(ny1, n);
+    CONTEND_SAME_DATA(y0, y1, n*sizeof(float complex));
+
+    channel_cccf_destroy(q0);
+    channel_cccf_destroy(q1);
+    randgen_destroy(r0);
+    randgen_destroy(r1);
+}
+
+//
+// AUTOTEST: noise power of AWGN channel
+//
+void autotest_channel_cccf_awgn()
+{
+    unsigned int n = 20000;
+    float complex * x = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y = (float complex*) malloc(n*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<n; i++)
+        x[i] = 0.0f;
+
+    float noise_floor = -40.0f;
+    channel_cccf q = channel_cccf_create();
+    channel_cccf_add_awgn(q, noise_floor, 10.0f);
+    channel_cccf_execute(q, x, n, y, NULL);
+
+    float e = 0.0f;
+    for (i=0; i<n; i++)
+        e += crealf(y[i]*conjf(y[i]));
+    CONTEND_DELTA(10*log10f(e/n), noise_floor, 0.2f);
+
+    channel_cccf_destroy(q);
+    free(x);
+    free(y);
+}
+
+//
+// AUTOTEST: block execution matches per-sample reference, regardless
+// of how the input is split across calls
+//
+void autotest_channel_cccf_block()
+{
+    unsigned int n = 2000;
+    unsigned int m = 7;             // resampling filter delay
+    float complex h[5] = {1.0f, 0.2f-0.1f*_Complex_I, 0.0f, -0.05f, 0.01f*_Complex_I};
+    float complex * x  = (float complex*) malloc(  n*sizeof(float complex));
+    float complex * y0 = (float complex*) malloc(2*n*sizeof(float complex));
+    float complex * y1 = (float complex*) malloc(2*n*sizeof(float complex));
+    unsigned int i, j, k, ny0=0, ny1=0;
+    for (i=0; i<n; i++)
+        x[i] = cexpf(_Complex_I*0.1f*i) + 0.1f*randnf();
+
+    // channel with all impairments enabled, executed in irregular blocks
+    randgen r0 = randgen_create(7);
+    channel_cccf q = channel_cccf_create_delay(m);
+    channel_cccf_add_resamp        (q, 0.0f, 1.01f);
+    channel_cccf_add_multipath     (q, h, 5);
+    channel_cccf_add_shadowing     (q, 2.0f, 0.05f);
+    channel_cccf_add_carrier_offset(q, 0.03f, 0.7f);
+    channel_cccf_add_awgn          (q, -20.0f, 15.0f);
+    channel_cccf_set_randgen       (q, r0);
+    for (i=0; i<n; i+=k) {
+        k = 1 + (i % 613);
+        if (i+k > n) k = n-i;
+        channel_cccf_execute(q, x+i, k, y0+ny0, &j);
+        ny0 += j;
+    }
+
+    // reference: process one sample at a time
+    randgen        r1  = randgen_create(7);
+    resamp_crcf    rs  = resamp_crcf_create(1.01f, m, 0.45f, 50.0f, 64);
+    firfilt_cccf   mp  = firfilt_cccf_create(h, 5);
+    float          a[2] = {1.0f, 0.05f-1.0f};
+    float          b[2] = {0.05f, 0.0f};
+    iirfilt_rrrf   sh  = iirfilt_rrrf_create(b,2,a,2);
+    nco_crcf       nco = nco_crcf_create(LIQUID_VCO);
+    nco_crcf_set_frequency(nco, 0.03f);
+    nco_crcf_set_phase    (nco, 0.7f);
+    float nstd  = powf(10.0f, -20.0f/20.0f);
+    float gamma = powf(10.0f, (15.0f-20.0f)/20.0f);
+    float complex v[8];
+    for (i=0; i<n; i++) {
+        resamp_crcf_execute(rs, x[i], v, &k);
+        for (j=0; j<k; j++) {
+            float complex y;
+            firfilt_cccf_push(mp, v[j]);
+            firfilt_cccf_execute(mp, &y);
+
+            float g;
+            iirfilt_rrrf_execute(sh, randgen_gauss(r1)*2.0f, &g);
+            g /= 0.05f * 6.9f;
+            y *= powf(10.0f, g/20.0f);
+
+            nco_crcf_mix_up(nco, y, &y);
+            nco_crcf_step(nco);
+
+            y *= gamma;
+            y += nstd * randgen_cgauss(r1);
+            y1[ny1++] = y;
+        }
+    }
+
+    CONTEND_EQUALITY(ny0, ny1);
+    CONTEND_SAME_DATA(y0, y1, ny1*sizeof(float complex));
+
+    channel_cccf_destroy(q);
+    resamp_crcf_destroy(rs);
+    firfilt_cccf_destroy(mp);
+    iirfilt_rrrf_destroy(sh);
+    nco_crcf_destroy(nco);
+    randgen_destroy(r0);
+    randgen_destroy(r1);
+    free(x);
+    free(y0);
+    free(y1);
+}
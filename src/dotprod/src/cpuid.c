@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Run-time detection of x86 SIMD extensions (baseline on other targets)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "liquid.internal.h"
+
+// highest SIMD extension level which may be selected
+static liquid_simd_level liquid_simd_level_max = LIQUID_SIMD_AVX512;
+
+// get highest SIMD extension level supported by the host processor,
+// limited to that set with liquid_simd_set_level()
+liquid_simd_level liquid_simd_get_level()
+{
+    liquid_simd_level level = LIQUID_SIMD_BASELINE;
+#if LIQUID_SIMD_DISPATCH
+    // initialize cpu model (required if called before constructors)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f"))
+        level = LIQUID_SIMD_AVX512;
+    else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        level = LIQUID_SIMD_AVX2;
+#endif
+    return level < liquid_simd_level_max ? level : liquid_simd_level_max;
+}
+
+// limit SIMD extension level selected by objects created from here
+// on, e.g. to exercise lower kernels on capable hosts (not thread-safe)
+void liquid_simd_set_level(liquid_simd_level _level)
+{
+    if (_level != LIQUID_SIMD_BASELINE &&
+        _level != LIQUID_SIMD_AVX2 &&
+        _level != LIQUID_SIMD_AVX512)
+    {
+        fprintf(stderr,"error: liquid_simd_set_level(), invalid level %d\n", _level);
+        exit(1);
+    }
+    liquid_simd_level_max = _level;
+}
+
+// is carry-less multiplication (PCLMULQDQ) supported by the host processor?
+int liquid_simd_has_pclmul()
+{
+#if LIQUID_SIMD_DISPATCH
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("pclmul");
+#else
+    return 0;
+#endif
+}
+
+// is population count (POPCNT) supported by the host processor?
+int liquid_simd_has_popcnt()
+{
+#if LIQUID_SIMD_DISPATCH
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("popcnt");
+#else
+    return 0;
+#endif
+}
+
+// get string name of SIMD extension level
+const char * liquid_simd_level_str(liquid_simd_level _level)
+{
+    switch (_level) {
+    case LIQUID_SIMD_BASELINE:  return "mmx";
+    case LIQUID_SIMD_AVX2:      return "avx2";
+    case LIQUID_SIMD_AVX512:    return "avx512";
+    default:;
+    }
+    return "unknown";
+}
+
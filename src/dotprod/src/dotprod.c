@@ -166,3 +166,115 @@ void DOTPROD(_execute)(DOTPROD() _q,
     DOTPROD(_run4)(_q->h, _x, _q->n, _y);
 }
 
+// execute structured dot product on a block of lagged inputs,
+// computing four outputs per pass so that each coefficient is
+// loaded once for all four
+//  _q      :   dot product object
+//  _x      :   input array [size: (_n-1)*_stride + _q->n x 1]
+//  _stride :   input step between consecutive outputs
+//  _n      :   number of outputs
+//  _y      :   output array [size: _n x 1]
+void DOTPROD(_execute_block)(DOTPROD()    _q,
+                             TI *         _x,
+                             unsigned int _stride,
+                             unsigned int _n,
+                             TO *         _y)
+{
+    unsigned int i;
+    unsigned int k;
+    for (k=0; k+4<=_n; k+=4) {
+        // set input pointers for each output
+        TI * x0 = _x + (k+0)*_stride;
+        TI * x1 = _x + (k+1)*_stride;
+        TI * x2 = _x + (k+2)*_stride;
+        TI * x3 = _x + (k+3)*_stride;
+
+        // initialize accumulators
+        TO r0 = 0;
+        TO r1 = 0;
+        TO r2 = 0;
+        TO r3 = 0;
+
+        for (i=0; i<_q->n; i++) {
+            TC h = _q->h[i];
+            r0 += h * x0[i];
+            r1 += h * x1[i];
+            r2 += h * x2[i];
+            r3 += h * x3[i];
+        }
+
+        _y[k+0] = r0;
+        _y[k+1] = r1;
+        _y[k+2] = r2;
+        _y[k+3] = r3;
+    }
+
+    // clean up remaining outputs
+    for ( ; k<_n; k++)
+        DOTPROD(_run4)(_q->h, _x + k*_stride, _q->n, &_y[k]);
+}
+
+
+#if TI_COMPLEX
+// execute structured dot product on split-complex (planar) input
+//  _q      :   dotprod object
+//  _xi     :   input array, real part [size: _q->n x 1]
+//  _xq     :   input array, imaginary part [size: _q->n x 1]
+//  _y      :   output sample pointer
+void DOTPROD(_execute_split)(DOTPROD() _q,
+                             float *   _xi,
+                             float *   _xq,
+                             TO *      _y)
+{
+    // accumulate real and imaginary input components separately
+    TC ri = 0;
+    TC rq = 0;
+
+    // t = 4*(floor(_n/4))
+    unsigned int t=(_q->n>>2)<<2; 
+
+    // compute dotprod in groups of 4
+    unsigned int i;
+    for (i=0; i<t; i+=4) {
+        ri += _q->h[i  ] * _xi[i  ];
+        ri += _q->h[i+1] * _xi[i+1];
+        ri += _q->h[i+2] * _xi[i+2];
+        ri += _q->h[i+3] * _xi[i+3];
+
+        rq += _q->h[i  ] * _xq[i  ];
+        rq += _q->h[i+1] * _xq[i+1];
+        rq += _q->h[i+2] * _xq[i+2];
+        rq += _q->h[i+3] * _xq[i+3];
+    }
+
+    // clean up remaining
+    for ( ; i<_q->n; i++) {
+        ri += _q->h[i] * _xi[i];
+        rq += _q->h[i] * _xq[i];
+    }
+
+    // combine: sum{ h (xi + j xq) } = sum{ h xi } + j sum{ h xq }
+    *_y = ri + _Complex_I*rq;
+}
+
+// execute structured dot product on a block of lagged split-complex
+// (planar) inputs
+//  _q      :   dotprod object
+//  _xi     :   input array, real part [size: (_n-1)*_stride + _q->n x 1]
+//  _xq     :   input array, imaginary part [size: (_n-1)*_stride + _q->n x 1]
+//  _stride :   input step between consecutive outputs
+//  _n      :   number of outputs
+//  _y      :   output array [size: _n x 1]
+void DOTPROD(_execute_block_split)(DOTPROD()    _q,
+                                   float *      _xi,
+                                   float *      _xq,
+                                   unsigned int _stride,
+                                   unsigned int _n,
+                                   TO *         _y)
+{
+    unsigned int k;
+    for (k=0; k<_n; k++)
+        DOTPROD(_execute_split)(_q, _xi + k*_stride, _xq + k*_stride, &_y[k]);
+}
+#endif
+
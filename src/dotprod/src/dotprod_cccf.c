@@ -32,4 +32,6 @@
 #define TC              float complex
 #define TI              float complex
 
+#define TI_COMPLEX      1
+
 #include "dotprod.c"
@@ -49,6 +49,10 @@
 #include <pmmintrin.h>  // SSE3
 #endif
 
+#if LIQUID_SIMD_DISPATCH
+#include <immintrin.h>  // AVX2, FMA, AVX-512 (selected at run time)
+#endif
+
 #define DEBUG_DOTPROD_CCCF_MMX   0
 
 // forward declaration of internal methods
@@ -60,6 +64,70 @@ void dotprod_cccf_execute_mmx4(dotprod_cccf    _q,
                                float complex * _x,
                                float complex * _y);
 
+void dotprod_cccf_execute_block_mmx(dotprod_cccf    _q,
+                                    float complex * _x,
+                                    unsigned int    _stride,
+                                    unsigned int    _n,
+                                    float complex * _y);
+
+void dotprod_cccf_execute_split_mmx(dotprod_cccf    _q,
+                                    float *         _xi,
+                                    float *         _xq,
+                                    float complex * _y);
+
+void dotprod_cccf_execute_block_split_mmx(dotprod_cccf    _q,
+                                          float *         _xi,
+                                          float *         _xq,
+                                          unsigned int    _stride,
+                                          unsigned int    _n,
+                                          float complex * _y);
+
+#if LIQUID_SIMD_DISPATCH
+void dotprod_cccf_execute_avx2(dotprod_cccf    _q,
+                               float complex * _x,
+                               float complex * _y);
+
+void dotprod_cccf_execute_avx512(dotprod_cccf    _q,
+                                 float complex * _x,
+                                 float complex * _y);
+
+void dotprod_cccf_execute_block_avx2(dotprod_cccf    _q,
+                                     float complex * _x,
+                                     unsigned int    _stride,
+                                     unsigned int    _n,
+                                     float complex * _y);
+
+void dotprod_cccf_execute_block_avx512(dotprod_cccf    _q,
+                                       float complex * _x,
+                                       unsigned int    _stride,
+                                       unsigned int    _n,
+                                       float complex * _y);
+
+void dotprod_cccf_execute_split_avx2(dotprod_cccf    _q,
+                                     float *         _xi,
+                                     float *         _xq,
+                                     float complex * _y);
+
+void dotprod_cccf_execute_split_avx512(dotprod_cccf    _q,
+                                       float *         _xi,
+                                       float *         _xq,
+                                       float complex * _y);
+
+void dotprod_cccf_execute_block_split_avx2(dotprod_cccf    _q,
+                                           float *         _xi,
+                                           float *         _xq,
+                                           unsigned int    _stride,
+                                           unsigned int    _n,
+                                           float complex * _y);
+
+void dotprod_cccf_execute_block_split_avx512(dotprod_cccf    _q,
+                                             float *         _xi,
+                                             float *         _xq,
+                                             unsigned int    _stride,
+                                             unsigned int    _n,
+                                             float complex * _y);
+#endif
+
 // basic dot product (ordinal calculation)
 void dotprod_cccf_run(float complex * _h,
                       float complex * _x,
@@ -109,6 +177,29 @@ struct dotprod_cccf_s {
     unsigned int n;     // length
     float * hi;         // in-phase
     float * hq;         // quadrature
+    float * hpi;        // in-phase, not repeated (planar input)
+    float * hpq;        // quadrature, not repeated (planar input)
+
+    // SIMD extension level and kernel, selected at run time
+    liquid_simd_level level;
+    void (*execute_func)(dotprod_cccf    _q,
+                         float complex * _x,
+                         float complex * _y);
+    void (*execute_block_func)(dotprod_cccf    _q,
+                               float complex * _x,
+                               unsigned int    _stride,
+                               unsigned int    _n,
+                               float complex * _y);
+    void (*execute_split_func)(dotprod_cccf    _q,
+                               float *         _xi,
+                               float *         _xq,
+                               float complex * _y);
+    void (*execute_block_split_func)(dotprod_cccf    _q,
+                                     float *         _xi,
+                                     float *         _xq,
+                                     unsigned int    _stride,
+                                     unsigned int    _n,
+                                     float complex * _y);
 };
 
 dotprod_cccf dotprod_cccf_create(float complex * _h,
@@ -117,9 +208,11 @@ dotprod_cccf dotprod_cccf_create(float complex * _h,
     dotprod_cccf q = (dotprod_cccf)malloc(sizeof(struct dotprod_cccf_s));
     q->n = _n;
 
-    // allocate memory for coefficients, 16-byte aligned
-    q->hi = (float*) _mm_malloc( 2*q->n*sizeof(float), 16 );
-    q->hq = (float*) _mm_malloc( 2*q->n*sizeof(float), 16 );
+    // allocate memory for coefficients, 64-byte aligned (AVX-512)
+    q->hi = (float*) _mm_malloc( 2*q->n*sizeof(float), 64 );
+    q->hq = (float*) _mm_malloc( 2*q->n*sizeof(float), 64 );
+    q->hpi = (float*) _mm_malloc( q->n*sizeof(float), 64 );
+    q->hpq = (float*) _mm_malloc( q->n*sizeof(float), 64 );
 
     // set coefficients, repeated
     //  hi = { crealf(_h[0]), crealf(_h[0]), ... crealf(_h[n-1]), crealf(_h[n-1])}
@@ -133,6 +226,35 @@ dotprod_cccf dotprod_cccf_create(float complex * _h,
         q->hq[2*i+1] = cimagf(_h[i]);
     }
 
+    // set coefficients for split-complex input (not repeated)
+    liquid_vectorcf_split(_h, q->n, q->hpi, q->hpq);
+
+    // select kernel based on length and host processor
+    q->level = LIQUID_SIMD_BASELINE;
+    q->execute_func = q->n < 32 ? dotprod_cccf_execute_mmx :
+                                  dotprod_cccf_execute_mmx4;
+    q->execute_block_func = dotprod_cccf_execute_block_mmx;
+    q->execute_split_func = dotprod_cccf_execute_split_mmx;
+    q->execute_block_split_func = dotprod_cccf_execute_block_split_mmx;
+#if LIQUID_SIMD_DISPATCH
+    q->level = liquid_simd_get_level();
+    switch (q->level) {
+    case LIQUID_SIMD_AVX512:
+        q->execute_func       = dotprod_cccf_execute_avx512;
+        q->execute_block_func = dotprod_cccf_execute_block_avx512;
+        q->execute_split_func = dotprod_cccf_execute_split_avx512;
+        q->execute_block_split_func = dotprod_cccf_execute_block_split_avx512;
+        break;
+    case LIQUID_SIMD_AVX2:
+        q->execute_func       = dotprod_cccf_execute_avx2;
+        q->execute_block_func = dotprod_cccf_execute_block_avx2;
+        q->execute_split_func = dotprod_cccf_execute_split_avx2;
+        q->execute_block_split_func = dotprod_cccf_execute_block_split_avx2;
+        break;
+    default:;
+    }
+#endif
+
     // return object
     return q;
 }
@@ -152,12 +274,15 @@ void dotprod_cccf_destroy(dotprod_cccf _q)
 {
     _mm_free(_q->hi);
     _mm_free(_q->hq);
+    _mm_free(_q->hpi);
+    _mm_free(_q->hpq);
     free(_q);
 }
 
 void dotprod_cccf_print(dotprod_cccf _q)
 {
-    printf("dotprod_cccf [mmx, %u coefficients]\n", _q->n);
+    printf("dotprod_cccf [%s, %u coefficients]\n",
+            liquid_simd_level_str(_q->level), _q->n);
     unsigned int i;
     for (i=0; i<_q->n; i++)
         printf("  %3u : %12.9f +j%12.9f\n", i, _q->hi[i], _q->hq[i]);
@@ -171,12 +296,57 @@ void dotprod_cccf_execute(dotprod_cccf    _q,
                           float complex * _x,
                           float complex * _y)
 {
-    // switch based on size
-    if (_q->n < 32) {
-        dotprod_cccf_execute_mmx(_q, _x, _y);
-    } else {
-        dotprod_cccf_execute_mmx4(_q, _x, _y);
-    }
+    // invoke kernel selected at creation
+    _q->execute_func(_q, _x, _y);
+}
+
+// execute structured dot product on a block of lagged inputs
+//  _q      :   dotprod object
+//  _x      :   input array [size: (_n-1)*_stride + _q->n x 1]
+//  _stride :   input step between consecutive outputs
+//  _n      :   number of outputs
+//  _y      :   output array [size: _n x 1]
+void dotprod_cccf_execute_block(dotprod_cccf    _q,
+                                float complex * _x,
+                                unsigned int    _stride,
+                                unsigned int    _n,
+                                float complex * _y)
+{
+    // invoke kernel selected at creation
+    _q->execute_block_func(_q, _x, _stride, _n, _y);
+}
+
+// execute structured dot product on split-complex (planar) input
+//  _q      :   dot product object
+//  _xi     :   input array, real part [size: _q->n x 1]
+//  _xq     :   input array, imaginary part [size: _q->n x 1]
+//  _y      :   output sample pointer
+void dotprod_cccf_execute_split(dotprod_cccf    _q,
+                                float *         _xi,
+                                float *         _xq,
+                                float complex * _y)
+{
+    // invoke kernel selected at creation
+    _q->execute_split_func(_q, _xi, _xq, _y);
+}
+
+// execute structured dot product on a block of lagged split-complex
+// (planar) inputs
+//  _q      :   dot product object
+//  _xi     :   input array, real part [size: (_n-1)*_stride + _q->n x 1]
+//  _xq     :   input array, imaginary part [size: (_n-1)*_stride + _q->n x 1]
+//  _stride :   input step between consecutive outputs
+//  _n      :   number of outputs
+//  _y      :   output array [size: _n x 1]
+void dotprod_cccf_execute_block_split(dotprod_cccf    _q,
+                                      float *         _xi,
+                                      float *         _xq,
+                                      unsigned int    _stride,
+                                      unsigned int    _n,
+                                      float complex * _y)
+{
+    // invoke kernel selected at creation
+    _q->execute_block_split_func(_q, _xi, _xq, _stride, _n, _y);
 }
 
 // use MMX/SSE extensions
@@ -380,3 +550,852 @@ void dotprod_cccf_execute_mmx4(dotprod_cccf    _q,
     *_y = total;
 }
 
+// use MMX/SSE extensions, computing four outputs per pass so that
+// each coefficient vector is loaded once for all four; the real and
+// imaginary coefficient products are accumulated separately and
+// combined once per output (see dotprod_cccf_execute_mmx)
+void dotprod_cccf_execute_block_mmx(dotprod_cccf    _q,
+                                    float complex * _x,
+                                    unsigned int    _stride,
+                                    unsigned int    _n,
+                                    float complex * _y)
+{
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    __m128 v;                       // input vector
+    __m128 hi, hq;                  // coefficients vectors
+    __m128 si0, si1, si2, si3;      // products with real coefficients
+    __m128 sq0, sq1, sq2, sq3;      // products with imag coefficients
+
+    // sign mask to negate even (real) elements: {-0, 0, -0, 0}
+    const __m128 neg = _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f);
+
+    // t = 4*(floor(n/4))
+    unsigned int t = (n >> 2) << 2;
+
+    // aligned output array
+    float w[8] __attribute__((aligned(16)));
+
+    unsigned int i;
+    unsigned int k;
+    for (k=0; k+4<=_n; k+=4) {
+        // type cast inputs for each output as floating point arrays
+        float * x0 = (float*) (_x + (k+0)*_stride);
+        float * x1 = (float*) (_x + (k+1)*_stride);
+        float * x2 = (float*) (_x + (k+2)*_stride);
+        float * x3 = (float*) (_x + (k+3)*_stride);
+
+        // load zeros into sum registers
+        si0 = si1 = si2 = si3 = _mm_setzero_ps();
+        sq0 = sq1 = sq2 = sq3 = _mm_setzero_ps();
+
+        for (i=0; i<t; i+=4) {
+            // load coefficients into registers (aligned)
+            hi = _mm_load_ps(&_q->hi[i]);
+            hq = _mm_load_ps(&_q->hq[i]);
+
+            // load inputs (unaligned), multiply, and accumulate
+            v = _mm_loadu_ps(&x0[i]);
+            si0 = _mm_add_ps(si0, _mm_mul_ps(v, hi));
+            sq0 = _mm_add_ps(sq0, _mm_mul_ps(v, hq));
+
+            v = _mm_loadu_ps(&x1[i]);
+            si1 = _mm_add_ps(si1, _mm_mul_ps(v, hi));
+            sq1 = _mm_add_ps(sq1, _mm_mul_ps(v, hq));
+
+            v = _mm_loadu_ps(&x2[i]);
+            si2 = _mm_add_ps(si2, _mm_mul_ps(v, hi));
+            sq2 = _mm_add_ps(sq2, _mm_mul_ps(v, hq));
+
+            v = _mm_loadu_ps(&x3[i]);
+            si3 = _mm_add_ps(si3, _mm_mul_ps(v, hi));
+            sq3 = _mm_add_ps(sq3, _mm_mul_ps(v, hq));
+        }
+
+        // swap quadrature products and combine: {re, im, re, im}
+        sq0 = _mm_shuffle_ps(sq0, sq0, _MM_SHUFFLE(2,3,0,1));
+        sq1 = _mm_shuffle_ps(sq1, sq1, _MM_SHUFFLE(2,3,0,1));
+        sq2 = _mm_shuffle_ps(sq2, sq2, _MM_SHUFFLE(2,3,0,1));
+        sq3 = _mm_shuffle_ps(sq3, sq3, _MM_SHUFFLE(2,3,0,1));
+        si0 = _mm_add_ps(si0, _mm_xor_ps(sq0, neg));
+        si1 = _mm_add_ps(si1, _mm_xor_ps(sq1, neg));
+        si2 = _mm_add_ps(si2, _mm_xor_ps(sq2, neg));
+        si3 = _mm_add_ps(si3, _mm_xor_ps(sq3, neg));
+
+        // add upper and lower halves, pairing outputs:
+        // {re0, im0, re1, im1}, {re2, im2, re3, im3}
+        si0 = _mm_add_ps(_mm_movelh_ps(si0, si1), _mm_movehl_ps(si1, si0));
+        si2 = _mm_add_ps(_mm_movelh_ps(si2, si3), _mm_movehl_ps(si3, si2));
+        _mm_store_ps(&w[0], si0);
+        _mm_store_ps(&w[4], si2);
+
+        // set return values
+        _y[k+0] = w[0] + w[1]*_Complex_I;
+        _y[k+1] = w[2] + w[3]*_Complex_I;
+        _y[k+2] = w[4] + w[5]*_Complex_I;
+        _y[k+3] = w[6] + w[7]*_Complex_I;
+
+        // cleanup
+        for (i=t/2; i<_q->n; i++) {
+            float complex h = _q->hi[2*i] + _q->hq[2*i]*_Complex_I;
+            _y[k+0] += _x[(k+0)*_stride + i] * h;
+            _y[k+1] += _x[(k+1)*_stride + i] * h;
+            _y[k+2] += _x[(k+2)*_stride + i] * h;
+            _y[k+3] += _x[(k+3)*_stride + i] * h;
+        }
+    }
+
+    // clean up remaining outputs
+    for ( ; k<_n; k++)
+        _q->execute_func(_q, _x + k*_stride, &_y[k]);
+}
+
+// use MMX/SSE extensions on split-complex (planar) input; the
+// complex product needs no shuffling as the real and imaginary
+// components are already in separate registers:
+//
+// yi = sum{ hi*xi - hq*xq },  yq = sum{ hi*xq + hq*xi }
+void dotprod_cccf_execute_split_mmx(dotprod_cccf    _q,
+                                    float *         _xi,
+                                    float *         _xq,
+                                    float complex * _y)
+{
+    // load zeros into sum registers
+    __m128 sii = _mm_setzero_ps();  // sum{ hi*xi }
+    __m128 sqq = _mm_setzero_ps();  // sum{ hq*xq }
+    __m128 sq  = _mm_setzero_ps();  // sum{ hi*xq + hq*xi }
+
+    // t = 4*(floor(_n/4))
+    unsigned int t = (_q->n >> 2) << 2;
+
+    unsigned int i;
+    for (i=0; i<t; i+=4) {
+        // load coefficients (aligned) and inputs (unaligned)
+        __m128 hi = _mm_load_ps(&_q->hpi[i]);
+        __m128 hq = _mm_load_ps(&_q->hpq[i]);
+        __m128 xi = _mm_loadu_ps(&_xi[i]);
+        __m128 xq = _mm_loadu_ps(&_xq[i]);
+
+        // multiply/accumulate
+        sii = _mm_add_ps(sii, _mm_mul_ps(hi, xi));
+        sqq = _mm_add_ps(sqq, _mm_mul_ps(hq, xq));
+        sq  = _mm_add_ps(sq,  _mm_add_ps(_mm_mul_ps(hi, xq), _mm_mul_ps(hq, xi)));
+    }
+    __m128 si = _mm_sub_ps(sii, sqq);
+
+    // unload packed arrays
+    float wi[4] __attribute__((aligned(16)));
+    float wq[4] __attribute__((aligned(16)));
+    _mm_store_ps(wi, si);
+    _mm_store_ps(wq, sq);
+    float ri = wi[0] + wi[1] + wi[2] + wi[3];
+    float rq = wq[0] + wq[1] + wq[2] + wq[3];
+
+    // cleanup
+    for ( ; i<_q->n; i++) {
+        ri += _q->hpi[i]*_xi[i] - _q->hpq[i]*_xq[i];
+        rq += _q->hpi[i]*_xq[i] + _q->hpq[i]*_xi[i];
+    }
+
+    // set return value
+    *_y = ri + rq*_Complex_I;
+}
+
+// use MMX/SSE extensions on a block of lagged split-complex (planar)
+// inputs, one output at a time
+void dotprod_cccf_execute_block_split_mmx(dotprod_cccf    _q,
+                                          float *         _xi,
+                                          float *         _xq,
+                                          unsigned int    _stride,
+                                          unsigned int    _n,
+                                          float complex * _y)
+{
+    unsigned int k;
+    for (k=0; k<_n; k++)
+        dotprod_cccf_execute_split_mmx(_q, _xi + k*_stride, _xq + k*_stride, &_y[k]);
+}
+
+#if LIQUID_SIMD_DISPATCH
+// use AVX2/FMA extensions, unrolled loop; accumulate real and imaginary
+// coefficient products separately and combine once at the end:
+//
+// sumi = { x[0].real * h[0].real, x[0].imag * h[0].real, ... }
+// sumq = { x[0].real * h[0].imag, x[0].imag * h[0].imag, ... }
+//
+// y = addsub(sumi, swap(sumq))
+//   = { sum(xr*hr - xi*hi), sum(xi*hr + xr*hi), ... }
+__attribute__((target("avx2,fma")))
+void dotprod_cccf_execute_avx2(dotprod_cccf    _q,
+                               float complex * _x,
+                               float complex * _y)
+{
+    // type cast input as floating point array
+    float * x = (float*) _x;
+
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    __m256 v0, v1;  // input vectors
+
+    // load zeros into sum registers
+    __m256 sumi0 = _mm256_setzero_ps();
+    __m256 sumi1 = _mm256_setzero_ps();
+    __m256 sumq0 = _mm256_setzero_ps();
+    __m256 sumq1 = _mm256_setzero_ps();
+
+    // r = 16*floor(n/16), t = 8*floor(n/8)
+    unsigned int r = (n >> 4) << 4;
+    unsigned int t = (n >> 3) << 3;
+
+    unsigned int i;
+    for (i=0; i<r; i+=16) {
+        // load inputs into register (unaligned)
+        v0 = _mm256_loadu_ps(&x[i+0]);
+        v1 = _mm256_loadu_ps(&x[i+8]);
+
+        // multiply/accumulate with coefficients (aligned)
+        sumi0 = _mm256_fmadd_ps(v0, _mm256_load_ps(&_q->hi[i+0]), sumi0);
+        sumi1 = _mm256_fmadd_ps(v1, _mm256_load_ps(&_q->hi[i+8]), sumi1);
+        sumq0 = _mm256_fmadd_ps(v0, _mm256_load_ps(&_q->hq[i+0]), sumq0);
+        sumq1 = _mm256_fmadd_ps(v1, _mm256_load_ps(&_q->hq[i+8]), sumq1);
+    }
+
+    // remaining group of 8
+    for ( ; i<t; i+=8) {
+        v0 = _mm256_loadu_ps(&x[i]);
+        sumi0 = _mm256_fmadd_ps(v0, _mm256_load_ps(&_q->hi[i]), sumi0);
+        sumq0 = _mm256_fmadd_ps(v0, _mm256_load_ps(&_q->hq[i]), sumq0);
+    }
+
+    // swap quadrature products and combine using add/sub
+    sumi0 = _mm256_add_ps(sumi0, sumi1);
+    sumq0 = _mm256_add_ps(sumq0, sumq1);
+    sumq0 = _mm256_permute_ps(sumq0, _MM_SHUFFLE(2,3,0,1));
+    sumi0 = _mm256_addsub_ps(sumi0, sumq0);
+
+    // fold down into [re, im]
+    __m128 s = _mm_add_ps( _mm256_castps256_ps128(sumi0), _mm256_extractf128_ps(sumi0, 1) );
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+
+    // unload packed array
+    float w[4] __attribute__((aligned(16)));
+    _mm_store_ps(w, s);
+    float complex total = w[0] + w[1] * _Complex_I;
+
+    // cleanup
+    for (i=t/2; i<_q->n; i++)
+        total += _x[i] * ( _q->hi[2*i] + _q->hq[2*i]*_Complex_I );
+
+    // set return value
+    *_y = total;
+}
+
+// use AVX-512 extensions, unrolled loop with masked tail
+__attribute__((target("avx512f")))
+void dotprod_cccf_execute_avx512(dotprod_cccf    _q,
+                                 float complex * _x,
+                                 float complex * _y)
+{
+    // type cast input as floating point array
+    float * x = (float*) _x;
+
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    __m512 v0, v1;  // input vectors
+
+    // load zeros into sum registers
+    __m512 sumi0 = _mm512_setzero_ps();
+    __m512 sumi1 = _mm512_setzero_ps();
+    __m512 sumq0 = _mm512_setzero_ps();
+    __m512 sumq1 = _mm512_setzero_ps();
+
+    // r = 32*floor(n/32), t = 16*floor(n/16)
+    unsigned int r = (n >> 5) << 5;
+    unsigned int t = (n >> 4) << 4;
+
+    unsigned int i;
+    for (i=0; i<r; i+=32) {
+        // load inputs into register (unaligned)
+        v0 = _mm512_loadu_ps(&x[i+ 0]);
+        v1 = _mm512_loadu_ps(&x[i+16]);
+
+        // multiply/accumulate with coefficients (aligned)
+        sumi0 = _mm512_fmadd_ps(v0, _mm512_load_ps(&_q->hi[i+ 0]), sumi0);
+        sumi1 = _mm512_fmadd_ps(v1, _mm512_load_ps(&_q->hi[i+16]), sumi1);
+        sumq0 = _mm512_fmadd_ps(v0, _mm512_load_ps(&_q->hq[i+ 0]), sumq0);
+        sumq1 = _mm512_fmadd_ps(v1, _mm512_load_ps(&_q->hq[i+16]), sumq1);
+    }
+
+    // remaining group of 16
+    for ( ; i<t; i+=16) {
+        v0 = _mm512_loadu_ps(&x[i]);
+        sumi0 = _mm512_fmadd_ps(v0, _mm512_load_ps(&_q->hi[i]), sumi0);
+        sumq0 = _mm512_fmadd_ps(v0, _mm512_load_ps(&_q->hq[i]), sumq0);
+    }
+
+    // cleanup with masked loads (no memory is touched beyond the mask)
+    if (i < n) {
+        __mmask16 m = (__mmask16)((1u << (n - i)) - 1);
+        v0 = _mm512_maskz_loadu_ps(m, &x[i]);
+        sumi1 = _mm512_fmadd_ps(v0, _mm512_maskz_loadu_ps(m, &_q->hi[i]), sumi1);
+        sumq1 = _mm512_fmadd_ps(v0, _mm512_maskz_loadu_ps(m, &_q->hq[i]), sumq1);
+    }
+
+    // fold down into 8-element registers
+    sumi0 = _mm512_add_ps(sumi0, sumi1);
+    sumq0 = _mm512_add_ps(sumq0, sumq1);
+    __m256 si = _mm256_add_ps( _mm512_castps512_ps256(sumi0),
+        _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(sumi0), 1)) );
+    __m256 sq = _mm256_add_ps( _mm512_castps512_ps256(sumq0),
+        _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(sumq0), 1)) );
+
+    // swap quadrature products and combine using add/sub
+    sq = _mm256_permute_ps(sq, _MM_SHUFFLE(2,3,0,1));
+    si = _mm256_addsub_ps(si, sq);
+
+    // fold down into [re, im]
+    __m128 s = _mm_add_ps( _mm256_castps256_ps128(si), _mm256_extractf128_ps(si, 1) );
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+
+    // unload packed array
+    float w[4] __attribute__((aligned(16)));
+    _mm_store_ps(w, s);
+
+    // set return value
+    *_y = w[0] + w[1] * _Complex_I;
+}
+// use AVX2/FMA extensions, computing four outputs per pass
+__attribute__((target("avx2,fma")))
+void dotprod_cccf_execute_block_avx2(dotprod_cccf    _q,
+                                     float complex * _x,
+                                     unsigned int    _stride,
+                                     unsigned int    _n,
+                                     float complex * _y)
+{
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    __m256 v;                       // input vector
+    __m256 hi, hq;                  // coefficients vectors
+    __m256 si0, si1, si2, si3;      // products with real coefficients
+    __m256 sq0, sq1, sq2, sq3;      // products with imag coefficients
+
+    // t = 8*floor(n/8)
+    unsigned int t = (n >> 3) << 3;
+
+    // aligned output array
+    float w[8] __attribute__((aligned(16)));
+
+    unsigned int i;
+    unsigned int k;
+    for (k=0; k+4<=_n; k+=4) {
+        // type cast inputs for each output as floating point arrays
+        float * x0 = (float*) (_x + (k+0)*_stride);
+        float * x1 = (float*) (_x + (k+1)*_stride);
+        float * x2 = (float*) (_x + (k+2)*_stride);
+        float * x3 = (float*) (_x + (k+3)*_stride);
+
+        // load zeros into sum registers
+        si0 = si1 = si2 = si3 = _mm256_setzero_ps();
+        sq0 = sq1 = sq2 = sq3 = _mm256_setzero_ps();
+
+        for (i=0; i<t; i+=8) {
+            // load coefficients into registers (aligned)
+            hi = _mm256_load_ps(&_q->hi[i]);
+            hq = _mm256_load_ps(&_q->hq[i]);
+
+            // load inputs (unaligned), multiply, and accumulate
+            v = _mm256_loadu_ps(&x0[i]);
+            si0 = _mm256_fmadd_ps(v, hi, si0);
+            sq0 = _mm256_fmadd_ps(v, hq, sq0);
+
+            v = _mm256_loadu_ps(&x1[i]);
+            si1 = _mm256_fmadd_ps(v, hi, si1);
+            sq1 = _mm256_fmadd_ps(v, hq, sq1);
+
+            v = _mm256_loadu_ps(&x2[i]);
+            si2 = _mm256_fmadd_ps(v, hi, si2);
+            sq2 = _mm256_fmadd_ps(v, hq, sq2);
+
+            v = _mm256_loadu_ps(&x3[i]);
+            si3 = _mm256_fmadd_ps(v, hi, si3);
+            sq3 = _mm256_fmadd_ps(v, hq, sq3);
+        }
+
+        // swap quadrature products and combine using add/sub
+        si0 = _mm256_addsub_ps(si0, _mm256_permute_ps(sq0, _MM_SHUFFLE(2,3,0,1)));
+        si1 = _mm256_addsub_ps(si1, _mm256_permute_ps(sq1, _MM_SHUFFLE(2,3,0,1)));
+        si2 = _mm256_addsub_ps(si2, _mm256_permute_ps(sq2, _MM_SHUFFLE(2,3,0,1)));
+        si3 = _mm256_addsub_ps(si3, _mm256_permute_ps(sq3, _MM_SHUFFLE(2,3,0,1)));
+
+        // fold each into 4-element register
+        __m128 v0 = _mm_add_ps(_mm256_castps256_ps128(si0), _mm256_extractf128_ps(si0, 1));
+        __m128 v1 = _mm_add_ps(_mm256_castps256_ps128(si1), _mm256_extractf128_ps(si1, 1));
+        __m128 v2 = _mm_add_ps(_mm256_castps256_ps128(si2), _mm256_extractf128_ps(si2, 1));
+        __m128 v3 = _mm_add_ps(_mm256_castps256_ps128(si3), _mm256_extractf128_ps(si3, 1));
+
+        // add upper and lower halves, pairing outputs
+        v0 = _mm_add_ps(_mm_movelh_ps(v0, v1), _mm_movehl_ps(v1, v0));
+        v2 = _mm_add_ps(_mm_movelh_ps(v2, v3), _mm_movehl_ps(v3, v2));
+        _mm_store_ps(&w[0], v0);
+        _mm_store_ps(&w[4], v2);
+
+        // set return values
+        _y[k+0] = w[0] + w[1]*_Complex_I;
+        _y[k+1] = w[2] + w[3]*_Complex_I;
+        _y[k+2] = w[4] + w[5]*_Complex_I;
+        _y[k+3] = w[6] + w[7]*_Complex_I;
+
+        // cleanup
+        for (i=t/2; i<_q->n; i++) {
+            float complex h = _q->hi[2*i] + _q->hq[2*i]*_Complex_I;
+            _y[k+0] += _x[(k+0)*_stride + i] * h;
+            _y[k+1] += _x[(k+1)*_stride + i] * h;
+            _y[k+2] += _x[(k+2)*_stride + i] * h;
+            _y[k+3] += _x[(k+3)*_stride + i] * h;
+        }
+    }
+
+    // clean up remaining outputs
+    for ( ; k<_n; k++)
+        dotprod_cccf_execute_avx2(_q, _x + k*_stride, &_y[k]);
+}
+
+// use AVX-512 extensions, computing four outputs per pass with
+// masked tail
+__attribute__((target("avx512f")))
+void dotprod_cccf_execute_block_avx512(dotprod_cccf    _q,
+                                       float complex * _x,
+                                       unsigned int    _stride,
+                                       unsigned int    _n,
+                                       float complex * _y)
+{
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    __m512 v;                       // input vector
+    __m512 hi, hq;                  // coefficients vectors
+    __m512 si0, si1, si2, si3;      // products with real coefficients
+    __m512 sq0, sq1, sq2, sq3;      // products with imag coefficients
+
+    // t = 16*floor(n/16), tail mask for remaining coefficients
+    unsigned int t = (n >> 4) << 4;
+    __mmask16 m = (__mmask16)((1u << (n - t)) - 1);
+
+    unsigned int i;
+    unsigned int k;
+    for (k=0; k+4<=_n; k+=4) {
+        // type cast inputs for each output as floating point arrays
+        float * x0 = (float*) (_x + (k+0)*_stride);
+        float * x1 = (float*) (_x + (k+1)*_stride);
+        float * x2 = (float*) (_x + (k+2)*_stride);
+        float * x3 = (float*) (_x + (k+3)*_stride);
+
+        // load zeros into sum registers
+        si0 = si1 = si2 = si3 = _mm512_setzero_ps();
+        sq0 = sq1 = sq2 = sq3 = _mm512_setzero_ps();
+
+        for (i=0; i<t; i+=16) {
+            // load coefficients into registers (aligned)
+            hi = _mm512_load_ps(&_q->hi[i]);
+            hq = _mm512_load_ps(&_q->hq[i]);
+
+            // load inputs (unaligned), multiply, and accumulate
+            v = _mm512_loadu_ps(&x0[i]);
+            si0 = _mm512_fmadd_ps(v, hi, si0);
+            sq0 = _mm512_fmadd_ps(v, hq, sq0);
+
+            v = _mm512_loadu_ps(&x1[i]);
+            si1 = _mm512_fmadd_ps(v, hi, si1);
+            sq1 = _mm512_fmadd_ps(v, hq, sq1);
+
+            v = _mm512_loadu_ps(&x2[i]);
+            si2 = _mm512_fmadd_ps(v, hi, si2);
+            sq2 = _mm512_fmadd_ps(v, hq, sq2);
+
+            v = _mm512_loadu_ps(&x3[i]);
+            si3 = _mm512_fmadd_ps(v, hi, si3);
+            sq3 = _mm512_fmadd_ps(v, hq, sq3);
+        }
+
+        // cleanup with masked loads
+        if (m) {
+            hi = _mm512_maskz_loadu_ps(m, &_q->hi[t]);
+            hq = _mm512_maskz_loadu_ps(m, &_q->hq[t]);
+
+            v = _mm512_maskz_loadu_ps(m, &x0[t]);
+            si0 = _mm512_fmadd_ps(v, hi, si0);
+            sq0 = _mm512_fmadd_ps(v, hq, sq0);
+
+            v = _mm512_maskz_loadu_ps(m, &x1[t]);
+            si1 = _mm512_fmadd_ps(v, hi, si1);
+            sq1 = _mm512_fmadd_ps(v, hq, sq1);
+
+            v = _mm512_maskz_loadu_ps(m, &x2[t]);
+            si2 = _mm512_fmadd_ps(v, hi, si2);
+            sq2 = _mm512_fmadd_ps(v, hq, sq2);
+
+            v = _mm512_maskz_loadu_ps(m, &x3[t]);
+            si3 = _mm512_fmadd_ps(v, hi, si3);
+            sq3 = _mm512_fmadd_ps(v, hq, sq3);
+        }
+
+        // swap quadrature products and combine: even (real) elements
+        // take the difference, odd (imaginary) elements the sum
+        __m512 d;
+        d = _mm512_permute_ps(sq0, _MM_SHUFFLE(2,3,0,1));
+        si0 = _mm512_mask_sub_ps(_mm512_add_ps(si0, d), 0x5555, si0, d);
+        d = _mm512_permute_ps(sq1, _MM_SHUFFLE(2,3,0,1));
+        si1 = _mm512_mask_sub_ps(_mm512_add_ps(si1, d), 0x5555, si1, d);
+        d = _mm512_permute_ps(sq2, _MM_SHUFFLE(2,3,0,1));
+        si2 = _mm512_mask_sub_ps(_mm512_add_ps(si2, d), 0x5555, si2, d);
+        d = _mm512_permute_ps(sq3, _MM_SHUFFLE(2,3,0,1));
+        si3 = _mm512_mask_sub_ps(_mm512_add_ps(si3, d), 0x5555, si3, d);
+
+        // fold each into 8-element register
+        __m256 u0 = _mm256_add_ps(_mm512_castps512_ps256(si0),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(si0), 1)));
+        __m256 u1 = _mm256_add_ps(_mm512_castps512_ps256(si1),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(si1), 1)));
+        __m256 u2 = _mm256_add_ps(_mm512_castps512_ps256(si2),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(si2), 1)));
+        __m256 u3 = _mm256_add_ps(_mm512_castps512_ps256(si3),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(si3), 1)));
+
+        // fold each into 4-element register
+        __m128 v0 = _mm_add_ps(_mm256_castps256_ps128(u0), _mm256_extractf128_ps(u0, 1));
+        __m128 v1 = _mm_add_ps(_mm256_castps256_ps128(u1), _mm256_extractf128_ps(u1, 1));
+        __m128 v2 = _mm_add_ps(_mm256_castps256_ps128(u2), _mm256_extractf128_ps(u2, 1));
+        __m128 v3 = _mm_add_ps(_mm256_castps256_ps128(u3), _mm256_extractf128_ps(u3, 1));
+
+        // add upper and lower halves, pairing outputs, and store
+        // directly as interleaved complex values
+        v0 = _mm_add_ps(_mm_movelh_ps(v0, v1), _mm_movehl_ps(v1, v0));
+        v2 = _mm_add_ps(_mm_movelh_ps(v2, v3), _mm_movehl_ps(v3, v2));
+        _mm_storeu_ps((float*)&_y[k+0], v0);
+        _mm_storeu_ps((float*)&_y[k+2], v2);
+    }
+
+    // clean up remaining outputs
+    for ( ; k<_n; k++)
+        dotprod_cccf_execute_avx512(_q, _x + k*_stride, &_y[k]);
+}
+
+// use AVX2/FMA extensions on split-complex (planar) input
+__attribute__((target("avx2,fma")))
+void dotprod_cccf_execute_split_avx2(dotprod_cccf    _q,
+                                     float *         _xi,
+                                     float *         _xq,
+                                     float complex * _y)
+{
+    // load zeros into sum registers
+    __m256 si0 = _mm256_setzero_ps();
+    __m256 sq0 = _mm256_setzero_ps();
+    __m256 si1 = _mm256_setzero_ps();
+    __m256 sq1 = _mm256_setzero_ps();
+
+    // r = 16*floor(n/16), t = 8*floor(n/8)
+    unsigned int r = (_q->n >> 4) << 4;
+    unsigned int t = (_q->n >> 3) << 3;
+
+    unsigned int i;
+    for (i=0; i<r; i+=16) {
+        // multiply/accumulate: inputs unaligned, coefficients aligned
+        __m256 hi0 = _mm256_load_ps(&_q->hpi[i  ]);
+        __m256 hq0 = _mm256_load_ps(&_q->hpq[i  ]);
+        __m256 hi1 = _mm256_load_ps(&_q->hpi[i+8]);
+        __m256 hq1 = _mm256_load_ps(&_q->hpq[i+8]);
+        __m256 xi0 = _mm256_loadu_ps(&_xi[i  ]);
+        __m256 xq0 = _mm256_loadu_ps(&_xq[i  ]);
+        __m256 xi1 = _mm256_loadu_ps(&_xi[i+8]);
+        __m256 xq1 = _mm256_loadu_ps(&_xq[i+8]);
+        si0 = _mm256_fnmadd_ps(hq0, xq0, _mm256_fmadd_ps(hi0, xi0, si0));
+        sq0 = _mm256_fmadd_ps (hq0, xi0, _mm256_fmadd_ps(hi0, xq0, sq0));
+        si1 = _mm256_fnmadd_ps(hq1, xq1, _mm256_fmadd_ps(hi1, xi1, si1));
+        sq1 = _mm256_fmadd_ps (hq1, xi1, _mm256_fmadd_ps(hi1, xq1, sq1));
+    }
+
+    // remaining group of 8
+    for ( ; i<t; i+=8) {
+        __m256 hi = _mm256_load_ps(&_q->hpi[i]);
+        __m256 hq = _mm256_load_ps(&_q->hpq[i]);
+        __m256 xi = _mm256_loadu_ps(&_xi[i]);
+        __m256 xq = _mm256_loadu_ps(&_xq[i]);
+        si0 = _mm256_fnmadd_ps(hq, xq, _mm256_fmadd_ps(hi, xi, si0));
+        sq0 = _mm256_fmadd_ps (hq, xi, _mm256_fmadd_ps(hi, xq, sq0));
+    }
+
+    // fold down into 4-element registers
+    si0 = _mm256_add_ps(si0, si1);
+    sq0 = _mm256_add_ps(sq0, sq1);
+    __m128 si = _mm_add_ps( _mm256_castps256_ps128(si0), _mm256_extractf128_ps(si0, 1) );
+    __m128 sq = _mm_add_ps( _mm256_castps256_ps128(sq0), _mm256_extractf128_ps(sq0, 1) );
+
+    // unload packed arrays
+    float wi[4] __attribute__((aligned(16)));
+    float wq[4] __attribute__((aligned(16)));
+    _mm_store_ps(wi, si);
+    _mm_store_ps(wq, sq);
+    float ri = wi[0] + wi[1] + wi[2] + wi[3];
+    float rq = wq[0] + wq[1] + wq[2] + wq[3];
+
+    // cleanup
+    for ( ; i<_q->n; i++) {
+        ri += _q->hpi[i]*_xi[i] - _q->hpq[i]*_xq[i];
+        rq += _q->hpi[i]*_xq[i] + _q->hpq[i]*_xi[i];
+    }
+
+    // set return value
+    *_y = ri + rq*_Complex_I;
+}
+
+// use AVX-512 extensions on split-complex (planar) input with
+// masked tail
+__attribute__((target("avx512f")))
+void dotprod_cccf_execute_split_avx512(dotprod_cccf    _q,
+                                       float *         _xi,
+                                       float *         _xq,
+                                       float complex * _y)
+{
+    // load zeros into sum registers
+    __m512 si0 = _mm512_setzero_ps();
+    __m512 sq0 = _mm512_setzero_ps();
+    __m512 si1 = _mm512_setzero_ps();
+    __m512 sq1 = _mm512_setzero_ps();
+
+    // r = 32*floor(n/32), t = 16*floor(n/16)
+    unsigned int r = (_q->n >> 5) << 5;
+    unsigned int t = (_q->n >> 4) << 4;
+
+    unsigned int i;
+    for (i=0; i<r; i+=32) {
+        // multiply/accumulate: inputs unaligned, coefficients aligned
+        __m512 hi0 = _mm512_load_ps(&_q->hpi[i   ]);
+        __m512 hq0 = _mm512_load_ps(&_q->hpq[i   ]);
+        __m512 hi1 = _mm512_load_ps(&_q->hpi[i+16]);
+        __m512 hq1 = _mm512_load_ps(&_q->hpq[i+16]);
+        __m512 xi0 = _mm512_loadu_ps(&_xi[i   ]);
+        __m512 xq0 = _mm512_loadu_ps(&_xq[i   ]);
+        __m512 xi1 = _mm512_loadu_ps(&_xi[i+16]);
+        __m512 xq1 = _mm512_loadu_ps(&_xq[i+16]);
+        si0 = _mm512_fnmadd_ps(hq0, xq0, _mm512_fmadd_ps(hi0, xi0, si0));
+        sq0 = _mm512_fmadd_ps (hq0, xi0, _mm512_fmadd_ps(hi0, xq0, sq0));
+        si1 = _mm512_fnmadd_ps(hq1, xq1, _mm512_fmadd_ps(hi1, xi1, si1));
+        sq1 = _mm512_fmadd_ps (hq1, xi1, _mm512_fmadd_ps(hi1, xq1, sq1));
+    }
+
+    // remaining group of 16
+    for ( ; i<t; i+=16) {
+        __m512 hi = _mm512_load_ps(&_q->hpi[i]);
+        __m512 hq = _mm512_load_ps(&_q->hpq[i]);
+        __m512 xi = _mm512_loadu_ps(&_xi[i]);
+        __m512 xq = _mm512_loadu_ps(&_xq[i]);
+        si0 = _mm512_fnmadd_ps(hq, xq, _mm512_fmadd_ps(hi, xi, si0));
+        sq0 = _mm512_fmadd_ps (hq, xi, _mm512_fmadd_ps(hi, xq, sq0));
+    }
+
+    // cleanup with masked loads (no memory is touched beyond the mask)
+    if (i < _q->n) {
+        __mmask16 m = (__mmask16)((1u << (_q->n - i)) - 1);
+        __m512 hi = _mm512_maskz_loadu_ps(m, &_q->hpi[i]);
+        __m512 hq = _mm512_maskz_loadu_ps(m, &_q->hpq[i]);
+        __m512 xi = _mm512_maskz_loadu_ps(m, &_xi[i]);
+        __m512 xq = _mm512_maskz_loadu_ps(m, &_xq[i]);
+        si1 = _mm512_fnmadd_ps(hq, xq, _mm512_fmadd_ps(hi, xi, si1));
+        sq1 = _mm512_fmadd_ps (hq, xi, _mm512_fmadd_ps(hi, xq, sq1));
+    }
+
+    // set return value
+    *_y = _mm512_reduce_add_ps(_mm512_add_ps(si0, si1)) +
+          _mm512_reduce_add_ps(_mm512_add_ps(sq0, sq1))*_Complex_I;
+}
+
+// use AVX2/FMA extensions on a block of lagged split-complex (planar)
+// inputs, computing four outputs per pass so that each coefficient
+// vector is loaded once for all four
+__attribute__((target("avx2,fma")))
+void dotprod_cccf_execute_block_split_avx2(dotprod_cccf    _q,
+                                           float *         _xi,
+                                           float *         _xq,
+                                           unsigned int    _stride,
+                                           unsigned int    _n,
+                                           float complex * _y)
+{
+    // t = 8*floor(n/8)
+    unsigned int t = (_q->n >> 3) << 3;
+
+    unsigned int i, j, k;
+    for (k=0; k+4<=_n; k+=4) {
+        // input pointers for each of the four outputs
+        float * x0i = _xi + (k  )*_stride;   float * x0q = _xq + (k  )*_stride;
+        float * x1i = _xi + (k+1)*_stride;   float * x1q = _xq + (k+1)*_stride;
+        float * x2i = _xi + (k+2)*_stride;   float * x2q = _xq + (k+2)*_stride;
+        float * x3i = _xi + (k+3)*_stride;   float * x3q = _xq + (k+3)*_stride;
+
+        // load zeros into sum registers
+        __m256 si0 = _mm256_setzero_ps(), sq0 = _mm256_setzero_ps();
+        __m256 si1 = _mm256_setzero_ps(), sq1 = _mm256_setzero_ps();
+        __m256 si2 = _mm256_setzero_ps(), sq2 = _mm256_setzero_ps();
+        __m256 si3 = _mm256_setzero_ps(), sq3 = _mm256_setzero_ps();
+
+        for (i=0; i<t; i+=8) {
+            // multiply/accumulate: inputs unaligned, coefficients aligned
+            __m256 hi = _mm256_load_ps(&_q->hpi[i]);
+            __m256 hq = _mm256_load_ps(&_q->hpq[i]);
+            __m256 xi0 = _mm256_loadu_ps(x0i + i);
+            __m256 xq0 = _mm256_loadu_ps(x0q + i);
+            __m256 xi1 = _mm256_loadu_ps(x1i + i);
+            __m256 xq1 = _mm256_loadu_ps(x1q + i);
+            __m256 xi2 = _mm256_loadu_ps(x2i + i);
+            __m256 xq2 = _mm256_loadu_ps(x2q + i);
+            __m256 xi3 = _mm256_loadu_ps(x3i + i);
+            __m256 xq3 = _mm256_loadu_ps(x3q + i);
+            si0 = _mm256_fnmadd_ps(hq, xq0, _mm256_fmadd_ps(hi, xi0, si0));
+            sq0 = _mm256_fmadd_ps (hq, xi0, _mm256_fmadd_ps(hi, xq0, sq0));
+            si1 = _mm256_fnmadd_ps(hq, xq1, _mm256_fmadd_ps(hi, xi1, si1));
+            sq1 = _mm256_fmadd_ps (hq, xi1, _mm256_fmadd_ps(hi, xq1, sq1));
+            si2 = _mm256_fnmadd_ps(hq, xq2, _mm256_fmadd_ps(hi, xi2, si2));
+            sq2 = _mm256_fmadd_ps (hq, xi2, _mm256_fmadd_ps(hi, xq2, sq2));
+            si3 = _mm256_fnmadd_ps(hq, xq3, _mm256_fmadd_ps(hi, xi3, si3));
+            sq3 = _mm256_fmadd_ps (hq, xi3, _mm256_fmadd_ps(hi, xq3, sq3));
+        }
+
+        // horizontal sums: { s0, s1, s2, s3 } in a single register
+        __m256 ui = _mm256_hadd_ps(_mm256_hadd_ps(si0, si1), _mm256_hadd_ps(si2, si3));
+        __m256 uq = _mm256_hadd_ps(_mm256_hadd_ps(sq0, sq1), _mm256_hadd_ps(sq2, sq3));
+
+        // unload packed arrays
+        float ri[4] __attribute__((aligned(16)));
+        float rq[4] __attribute__((aligned(16)));
+        _mm_store_ps(ri, _mm_add_ps(_mm256_castps256_ps128(ui), _mm256_extractf128_ps(ui, 1)));
+        _mm_store_ps(rq, _mm_add_ps(_mm256_castps256_ps128(uq), _mm256_extractf128_ps(uq, 1)));
+
+        // cleanup
+        float * x_i[4] = {x0i, x1i, x2i, x3i};
+        float * x_q[4] = {x0q, x1q, x2q, x3q};
+        for ( ; i<_q->n; i++) {
+            for (j=0; j<4; j++) {
+                float xi = x_i[j][i];
+                float xq = x_q[j][i];
+                ri[j] += _q->hpi[i]*xi - _q->hpq[i]*xq;
+                rq[j] += _q->hpi[i]*xq + _q->hpq[i]*xi;
+            }
+        }
+
+        // set return values
+        for (j=0; j<4; j++)
+            _y[k+j] = ri[j] + rq[j]*_Complex_I;
+    }
+
+    // clean up remaining outputs
+    for ( ; k<_n; k++)
+        dotprod_cccf_execute_split_avx2(_q, _xi + k*_stride, _xq + k*_stride, &_y[k]);
+}
+
+// fold 16-element register down to 8 elements
+__attribute__((target("avx512f")))
+static inline __m256 dotprod_cccf_fold_avx512(__m512 _s)
+{
+    return _mm256_add_ps(_mm512_castps512_ps256(_s),
+        _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(_s), 1)));
+}
+
+// use AVX-512 extensions on a block of lagged split-complex (planar)
+// inputs, computing four outputs per pass with masked tail
+__attribute__((target("avx512f")))
+void dotprod_cccf_execute_block_split_avx512(dotprod_cccf    _q,
+                                             float *         _xi,
+                                             float *         _xq,
+                                             unsigned int    _stride,
+                                             unsigned int    _n,
+                                             float complex * _y)
+{
+    // t = 16*floor(n/16)
+    unsigned int t = (_q->n >> 4) << 4;
+
+    unsigned int i, k;
+    for (k=0; k+4<=_n; k+=4) {
+        // input pointers for each of the four outputs
+        float * x0i = _xi + (k  )*_stride;   float * x0q = _xq + (k  )*_stride;
+        float * x1i = _xi + (k+1)*_stride;   float * x1q = _xq + (k+1)*_stride;
+        float * x2i = _xi + (k+2)*_stride;   float * x2q = _xq + (k+2)*_stride;
+        float * x3i = _xi + (k+3)*_stride;   float * x3q = _xq + (k+3)*_stride;
+
+        // load zeros into sum registers
+        __m512 si0 = _mm512_setzero_ps(), sq0 = _mm512_setzero_ps();
+        __m512 si1 = _mm512_setzero_ps(), sq1 = _mm512_setzero_ps();
+        __m512 si2 = _mm512_setzero_ps(), sq2 = _mm512_setzero_ps();
+        __m512 si3 = _mm512_setzero_ps(), sq3 = _mm512_setzero_ps();
+
+        for (i=0; i<t; i+=16) {
+            // multiply/accumulate: inputs unaligned, coefficients aligned
+            __m512 hi = _mm512_load_ps(&_q->hpi[i]);
+            __m512 hq = _mm512_load_ps(&_q->hpq[i]);
+            __m512 xi0 = _mm512_loadu_ps(x0i + i);
+            __m512 xq0 = _mm512_loadu_ps(x0q + i);
+            __m512 xi1 = _mm512_loadu_ps(x1i + i);
+            __m512 xq1 = _mm512_loadu_ps(x1q + i);
+            __m512 xi2 = _mm512_loadu_ps(x2i + i);
+            __m512 xq2 = _mm512_loadu_ps(x2q + i);
+            __m512 xi3 = _mm512_loadu_ps(x3i + i);
+            __m512 xq3 = _mm512_loadu_ps(x3q + i);
+            si0 = _mm512_fnmadd_ps(hq, xq0, _mm512_fmadd_ps(hi, xi0, si0));
+            sq0 = _mm512_fmadd_ps (hq, xi0, _mm512_fmadd_ps(hi, xq0, sq0));
+            si1 = _mm512_fnmadd_ps(hq, xq1, _mm512_fmadd_ps(hi, xi1, si1));
+            sq1 = _mm512_fmadd_ps (hq, xi1, _mm512_fmadd_ps(hi, xq1, sq1));
+            si2 = _mm512_fnmadd_ps(hq, xq2, _mm512_fmadd_ps(hi, xi2, si2));
+            sq2 = _mm512_fmadd_ps (hq, xi2, _mm512_fmadd_ps(hi, xq2, sq2));
+            si3 = _mm512_fnmadd_ps(hq, xq3, _mm512_fmadd_ps(hi, xi3, si3));
+            sq3 = _mm512_fmadd_ps (hq, xi3, _mm512_fmadd_ps(hi, xq3, sq3));
+        }
+
+        // cleanup with masked loads (no memory is touched beyond the mask)
+        if (i < _q->n) {
+            __mmask16 m = (__mmask16)((1u << (_q->n - i)) - 1);
+            __m512 hi = _mm512_maskz_loadu_ps(m, &_q->hpi[i]);
+            __m512 hq = _mm512_maskz_loadu_ps(m, &_q->hpq[i]);
+            __m512 xi0 = _mm512_maskz_loadu_ps(m, x0i + i);
+            __m512 xq0 = _mm512_maskz_loadu_ps(m, x0q + i);
+            __m512 xi1 = _mm512_maskz_loadu_ps(m, x1i + i);
+            __m512 xq1 = _mm512_maskz_loadu_ps(m, x1q + i);
+            __m512 xi2 = _mm512_maskz_loadu_ps(m, x2i + i);
+            __m512 xq2 = _mm512_maskz_loadu_ps(m, x2q + i);
+            __m512 xi3 = _mm512_maskz_loadu_ps(m, x3i + i);
+            __m512 xq3 = _mm512_maskz_loadu_ps(m, x3q + i);
+            si0 = _mm512_fnmadd_ps(hq, xq0, _mm512_fmadd_ps(hi, xi0, si0));
+            sq0 = _mm512_fmadd_ps (hq, xi0, _mm512_fmadd_ps(hi, xq0, sq0));
+            si1 = _mm512_fnmadd_ps(hq, xq1, _mm512_fmadd_ps(hi, xi1, si1));
+            sq1 = _mm512_fmadd_ps (hq, xi1, _mm512_fmadd_ps(hi, xq1, sq1));
+            si2 = _mm512_fnmadd_ps(hq, xq2, _mm512_fmadd_ps(hi, xi2, si2));
+            sq2 = _mm512_fmadd_ps (hq, xi2, _mm512_fmadd_ps(hi, xq2, sq2));
+            si3 = _mm512_fnmadd_ps(hq, xq3, _mm512_fmadd_ps(hi, xi3, si3));
+            sq3 = _mm512_fmadd_ps (hq, xi3, _mm512_fmadd_ps(hi, xq3, sq3));
+        }
+
+        // fold each sum down to 8 elements, then horizontal sums:
+        // { s0, s1, s2, s3 } in a single register
+        __m256 ui = _mm256_hadd_ps(
+            _mm256_hadd_ps(dotprod_cccf_fold_avx512(si0), dotprod_cccf_fold_avx512(si1)),
+            _mm256_hadd_ps(dotprod_cccf_fold_avx512(si2), dotprod_cccf_fold_avx512(si3)));
+        __m256 uq = _mm256_hadd_ps(
+            _mm256_hadd_ps(dotprod_cccf_fold_avx512(sq0), dotprod_cccf_fold_avx512(sq1)),
+            _mm256_hadd_ps(dotprod_cccf_fold_avx512(sq2), dotprod_cccf_fold_avx512(sq3)));
+
+        // unload packed arrays and set return values
+        float ri[4] __attribute__((aligned(16)));
+        float rq[4] __attribute__((aligned(16)));
+        _mm_store_ps(ri, _mm_add_ps(_mm256_castps256_ps128(ui), _mm256_extractf128_ps(ui, 1)));
+        _mm_store_ps(rq, _mm_add_ps(_mm256_castps256_ps128(uq), _mm256_extractf128_ps(uq, 1)));
+        _y[k  ] = ri[0] + rq[0]*_Complex_I;
+        _y[k+1] = ri[1] + rq[1]*_Complex_I;
+        _y[k+2] = ri[2] + rq[2]*_Complex_I;
+        _y[k+3] = ri[3] + rq[3]*_Complex_I;
+    }
+
+    // clean up remaining outputs
+    for ( ; k<_n; k++)
+        dotprod_cccf_execute_split_avx512(_q, _xi + k*_stride, _xq + k*_stride, &_y[k]);
+}
+#endif
@@ -32,6 +32,10 @@
 
 #include "liquid.internal.h"
 
+#if LIQUID_SIMD_DISPATCH
+#include <immintrin.h>  // AVX2, FMA, AVX-512 (selected at run time)
+#endif
+
 #define DEBUG_DOTPROD_CRCF_MMX   0
 
 // forward declaration of internal methods
@@ -41,6 +45,65 @@ void dotprod_crcf_execute_mmx(dotprod_crcf    _q,
 void dotprod_crcf_execute_mmx4(dotprod_crcf    _q,
                                float complex * _x,
                                float complex * _y);
+void dotprod_crcf_execute_block_mmx(dotprod_crcf    _q,
+                                    float complex * _x,
+                                    unsigned int    _stride,
+                                    unsigned int    _n,
+                                    float complex * _y);
+
+void dotprod_crcf_execute_split_mmx(dotprod_crcf    _q,
+                                    float *         _xi,
+                                    float *         _xq,
+                                    float complex * _y);
+
+void dotprod_crcf_execute_block_split_mmx(dotprod_crcf    _q,
+                                          float *         _xi,
+                                          float *         _xq,
+                                          unsigned int    _stride,
+                                          unsigned int    _n,
+                                          float complex * _y);
+#if LIQUID_SIMD_DISPATCH
+void dotprod_crcf_execute_avx2(dotprod_crcf    _q,
+                               float complex * _x,
+                               float complex * _y);
+void dotprod_crcf_execute_avx512(dotprod_crcf    _q,
+                                 float complex * _x,
+                                 float complex * _y);
+void dotprod_crcf_execute_block_avx2(dotprod_crcf    _q,
+                                     float complex * _x,
+                                     unsigned int    _stride,
+                                     unsigned int    _n,
+                                     float complex * _y);
+void dotprod_crcf_execute_block_avx512(dotprod_crcf    _q,
+                                       float complex * _x,
+                                       unsigned int    _stride,
+                                       unsigned int    _n,
+                                       float complex * _y);
+
+void dotprod_crcf_execute_split_avx2(dotprod_crcf    _q,
+                                     float *         _xi,
+                                     float *         _xq,
+                                     float complex * _y);
+
+void dotprod_crcf_execute_split_avx512(dotprod_crcf    _q,
+                                       float *         _xi,
+                                       float *         _xq,
+                                       float complex * _y);
+
+void dotprod_crcf_execute_block_split_avx2(dotprod_crcf    _q,
+                                           float *         _xi,
+                                           float *         _xq,
+                                           unsigned int    _stride,
+                                           unsigned int    _n,
+                                           float complex * _y);
+
+void dotprod_crcf_execute_block_split_avx512(dotprod_crcf    _q,
+                                             float *         _xi,
+                                             float *         _xq,
+                                             unsigned int    _stride,
+                                             unsigned int    _n,
+                                             float complex * _y);
+#endif
 
 // basic dot product (ordinal calculation)
 void dotprod_crcf_run(float *         _h,
@@ -90,6 +153,28 @@ void dotprod_crcf_run4(float *         _h,
 struct dotprod_crcf_s {
     unsigned int n;     // length
     float * h;          // coefficients array
+    float * hp;         // coefficients array, not repeated (planar input)
+
+    // SIMD extension level and kernel, selected at run time
+    liquid_simd_level level;
+    void (*execute_func)(dotprod_crcf    _q,
+                         float complex * _x,
+                         float complex * _y);
+    void (*execute_block_func)(dotprod_crcf    _q,
+                               float complex * _x,
+                               unsigned int    _stride,
+                               unsigned int    _n,
+                               float complex * _y);
+    void (*execute_split_func)(dotprod_crcf    _q,
+                               float *         _xi,
+                               float *         _xq,
+                               float complex * _y);
+    void (*execute_block_split_func)(dotprod_crcf    _q,
+                                     float *         _xi,
+                                     float *         _xq,
+                                     unsigned int    _stride,
+                                     unsigned int    _n,
+                                     float complex * _y);
 };
 
 dotprod_crcf dotprod_crcf_create(float *      _h,
@@ -98,8 +183,9 @@ dotprod_crcf dotprod_crcf_create(float *      _h,
     dotprod_crcf q = (dotprod_crcf)malloc(sizeof(struct dotprod_crcf_s));
     q->n = _n;
 
-    // allocate memory for coefficients, 16-byte aligned
-    q->h = (float*) _mm_malloc( 2*q->n*sizeof(float), 16 );
+    // allocate memory for coefficients, 64-byte aligned (AVX-512)
+    q->h  = (float*) _mm_malloc( 2*q->n*sizeof(float), 64 );
+    q->hp = (float*) _mm_malloc(   q->n*sizeof(float), 64 );
 
     // set coefficients, repeated
     //  h = { _h[0], _h[0], _h[1], _h[1], ... _h[n-1], _h[n-1]}
@@ -109,6 +195,35 @@ dotprod_crcf dotprod_crcf_create(float *      _h,
         q->h[2*i+1] = _h[i];
     }
 
+    // set coefficients for split-complex input (not repeated)
+    memmove(q->hp, _h, q->n*sizeof(float));
+
+    // select kernel based on length and host processor
+    q->level = LIQUID_SIMD_BASELINE;
+    q->execute_func = q->n < 32 ? dotprod_crcf_execute_mmx :
+                                  dotprod_crcf_execute_mmx4;
+    q->execute_block_func = dotprod_crcf_execute_block_mmx;
+    q->execute_split_func = dotprod_crcf_execute_split_mmx;
+    q->execute_block_split_func = dotprod_crcf_execute_block_split_mmx;
+#if LIQUID_SIMD_DISPATCH
+    q->level = liquid_simd_get_level();
+    switch (q->level) {
+    case LIQUID_SIMD_AVX512:
+        q->execute_func       = dotprod_crcf_execute_avx512;
+        q->execute_block_func = dotprod_crcf_execute_block_avx512;
+        q->execute_split_func = dotprod_crcf_execute_split_avx512;
+        q->execute_block_split_func = dotprod_crcf_execute_block_split_avx512;
+        break;
+    case LIQUID_SIMD_AVX2:
+        q->execute_func       = dotprod_crcf_execute_avx2;
+        q->execute_block_func = dotprod_crcf_execute_block_avx2;
+        q->execute_split_func = dotprod_crcf_execute_split_avx2;
+        q->execute_block_split_func = dotprod_crcf_execute_block_split_avx2;
+        break;
+    default:;
+    }
+#endif
+
     // return object
     return q;
 }
@@ -127,6 +242,7 @@ dotprod_crcf dotprod_crcf_recreate(dotprod_crcf _q,
 void dotprod_crcf_destroy(dotprod_crcf _q)
 {
     _mm_free(_q->h);
+    _mm_free(_q->hp);
     free(_q);
 }
 
@@ -134,7 +250,8 @@ void dotprod_crcf_print(dotprod_crcf _q)
 {
     // print coefficients to screen, skipping odd entries (due
     // to repeated coefficients)
-    printf("dotprod_crcf [mmx, %u coefficients]\n", _q->n);
+    printf("dotprod_crcf [%s, %u coefficients]\n",
+            liquid_simd_level_str(_q->level), _q->n);
     unsigned int i;
     for (i=0; i<_q->n; i++)
         printf("  %3u : %12.9f\n", i, _q->h[2*i]);
@@ -145,12 +262,57 @@ void dotprod_crcf_execute(dotprod_crcf    _q,
                           float complex * _x,
                           float complex * _y)
 {
-    // switch based on size
-    if (_q->n < 32) {
-        dotprod_crcf_execute_mmx(_q, _x, _y);
-    } else {
-        dotprod_crcf_execute_mmx4(_q, _x, _y);
-    }
+    // invoke kernel selected at creation
+    _q->execute_func(_q, _x, _y);
+}
+
+// execute structured dot product on a block of lagged inputs
+//  _q      :   dot product object
+//  _x      :   input array [size: (_n-1)*_stride + _q->n x 1]
+//  _stride :   input step between consecutive outputs
+//  _n      :   number of outputs
+//  _y      :   output array [size: _n x 1]
+void dotprod_crcf_execute_block(dotprod_crcf    _q,
+                                float complex * _x,
+                                unsigned int    _stride,
+                                unsigned int    _n,
+                                float complex * _y)
+{
+    // invoke kernel selected at creation
+    _q->execute_block_func(_q, _x, _stride, _n, _y);
+}
+
+// execute structured dot product on split-complex (planar) input
+//  _q      :   dot product object
+//  _xi     :   input array, real part [size: _q->n x 1]
+//  _xq     :   input array, imaginary part [size: _q->n x 1]
+//  _y      :   output sample pointer
+void dotprod_crcf_execute_split(dotprod_crcf    _q,
+                                float *         _xi,
+                                float *         _xq,
+                                float complex * _y)
+{
+    // invoke kernel selected at creation
+    _q->execute_split_func(_q, _xi, _xq, _y);
+}
+
+// execute structured dot product on a block of lagged split-complex
+// (planar) inputs
+//  _q      :   dot product object
+//  _xi     :   input array, real part [size: (_n-1)*_stride + _q->n x 1]
+//  _xq     :   input array, imaginary part [size: (_n-1)*_stride + _q->n x 1]
+//  _stride :   input step between consecutive outputs
+//  _n      :   number of outputs
+//  _y      :   output array [size: _n x 1]
+void dotprod_crcf_execute_block_split(dotprod_crcf    _q,
+                                      float *         _xi,
+                                      float *         _xq,
+                                      unsigned int    _stride,
+                                      unsigned int    _n,
+                                      float complex * _y)
+{
+    // invoke kernel selected at creation
+    _q->execute_block_split_func(_q, _xi, _xq, _stride, _n, _y);
 }
 
 // use MMX/SSE extensions
@@ -285,3 +447,697 @@ void dotprod_crcf_execute_mmx4(dotprod_crcf    _q,
     *_y = w[0] + w[1]*_Complex_I;
 }
 
+// use MMX/SSE extensions, computing four outputs per pass so that
+// each coefficient vector is loaded once for all four
+void dotprod_crcf_execute_block_mmx(dotprod_crcf    _q,
+                                    float complex * _x,
+                                    unsigned int    _stride,
+                                    unsigned int    _n,
+                                    float complex * _y)
+{
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    __m128 h;               // coefficients vector
+    __m128 s0, s1, s2, s3;  // dot products [re, im, re, im]
+
+    // t = 4*(floor(n/4))
+    unsigned int t = (n >> 2) << 2;
+
+    // aligned output array
+    float w[8] __attribute__((aligned(16)));
+
+    unsigned int i;
+    unsigned int k;
+    for (k=0; k+4<=_n; k+=4) {
+        // type cast inputs for each output as floating point arrays
+        float * x0 = (float*) (_x + (k+0)*_stride);
+        float * x1 = (float*) (_x + (k+1)*_stride);
+        float * x2 = (float*) (_x + (k+2)*_stride);
+        float * x3 = (float*) (_x + (k+3)*_stride);
+
+        // load zeros into sum registers
+        s0 = _mm_setzero_ps();
+        s1 = _mm_setzero_ps();
+        s2 = _mm_setzero_ps();
+        s3 = _mm_setzero_ps();
+
+        for (i=0; i<t; i+=4) {
+            // load coefficients into register (aligned)
+            h = _mm_load_ps(&_q->h[i]);
+
+            // load inputs (unaligned), multiply, and accumulate
+            s0 = _mm_add_ps(s0, _mm_mul_ps(_mm_loadu_ps(&x0[i]), h));
+            s1 = _mm_add_ps(s1, _mm_mul_ps(_mm_loadu_ps(&x1[i]), h));
+            s2 = _mm_add_ps(s2, _mm_mul_ps(_mm_loadu_ps(&x2[i]), h));
+            s3 = _mm_add_ps(s3, _mm_mul_ps(_mm_loadu_ps(&x3[i]), h));
+        }
+
+        // add upper and lower halves, pairing outputs:
+        // {re0, im0, re1, im1}, {re2, im2, re3, im3}
+        s0 = _mm_add_ps(_mm_movelh_ps(s0, s1), _mm_movehl_ps(s1, s0));
+        s2 = _mm_add_ps(_mm_movelh_ps(s2, s3), _mm_movehl_ps(s3, s2));
+        _mm_store_ps(&w[0], s0);
+        _mm_store_ps(&w[4], s2);
+
+        // cleanup (note: n _must_ be even)
+        for (i=t; i<n; i+=2) {
+            w[0] += x0[i] * _q->h[i];   w[1] += x0[i+1] * _q->h[i+1];
+            w[2] += x1[i] * _q->h[i];   w[3] += x1[i+1] * _q->h[i+1];
+            w[4] += x2[i] * _q->h[i];   w[5] += x2[i+1] * _q->h[i+1];
+            w[6] += x3[i] * _q->h[i];   w[7] += x3[i+1] * _q->h[i+1];
+        }
+
+        // set return values
+        _y[k+0] = w[0] + w[1]*_Complex_I;
+        _y[k+1] = w[2] + w[3]*_Complex_I;
+        _y[k+2] = w[4] + w[5]*_Complex_I;
+        _y[k+3] = w[6] + w[7]*_Complex_I;
+    }
+
+    // clean up remaining outputs
+    for ( ; k<_n; k++)
+        _q->execute_func(_q, _x + k*_stride, &_y[k]);
+}
+
+// use MMX/SSE extensions on split-complex (planar) input; each
+// coefficient multiplies four real and four imaginary components
+// without shuffling
+void dotprod_crcf_execute_split_mmx(dotprod_crcf    _q,
+                                    float *         _xi,
+                                    float *         _xq,
+                                    float complex * _y)
+{
+    // load zeros into sum registers
+    __m128 si = _mm_setzero_ps();
+    __m128 sq = _mm_setzero_ps();
+
+    // t = 4*(floor(_n/4))
+    unsigned int t = (_q->n >> 2) << 2;
+
+    unsigned int i;
+    for (i=0; i<t; i+=4) {
+        // load coefficients (aligned) and inputs (unaligned)
+        __m128 h = _mm_load_ps(&_q->hp[i]);
+
+        // multiply/accumulate
+        si = _mm_add_ps(si, _mm_mul_ps(h, _mm_loadu_ps(&_xi[i])));
+        sq = _mm_add_ps(sq, _mm_mul_ps(h, _mm_loadu_ps(&_xq[i])));
+    }
+
+    // unload packed arrays
+    float wi[4] __attribute__((aligned(16)));
+    float wq[4] __attribute__((aligned(16)));
+    _mm_store_ps(wi, si);
+    _mm_store_ps(wq, sq);
+    float ri = wi[0] + wi[1] + wi[2] + wi[3];
+    float rq = wq[0] + wq[1] + wq[2] + wq[3];
+
+    // cleanup
+    for ( ; i<_q->n; i++) {
+        ri += _q->hp[i] * _xi[i];
+        rq += _q->hp[i] * _xq[i];
+    }
+
+    // set return value
+    *_y = ri + rq*_Complex_I;
+}
+
+// use MMX/SSE extensions on a block of lagged split-complex (planar)
+// inputs, one output at a time
+void dotprod_crcf_execute_block_split_mmx(dotprod_crcf    _q,
+                                          float *         _xi,
+                                          float *         _xq,
+                                          unsigned int    _stride,
+                                          unsigned int    _n,
+                                          float complex * _y)
+{
+    unsigned int k;
+    for (k=0; k<_n; k++)
+        dotprod_crcf_execute_split_mmx(_q, _xi + k*_stride, _xq + k*_stride, &_y[k]);
+}
+
+#if LIQUID_SIMD_DISPATCH
+// use AVX2/FMA extensions, unrolled loop
+__attribute__((target("avx2,fma")))
+void dotprod_crcf_execute_avx2(dotprod_crcf    _q,
+                               float complex * _x,
+                               float complex * _y)
+{
+    // type cast input as floating point array
+    float * x = (float*) _x;
+
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    // load zeros into sum registers [re, im, re, im, ...]
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    __m256 sum2 = _mm256_setzero_ps();
+    __m256 sum3 = _mm256_setzero_ps();
+
+    // r = 32*floor(n/32), t = 8*floor(n/8)
+    unsigned int r = (n >> 5) << 5;
+    unsigned int t = (n >> 3) << 3;
+
+    unsigned int i;
+    for (i=0; i<r; i+=32) {
+        // multiply/accumulate: inputs unaligned, coefficients aligned
+        sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(&x[i+ 0]), _mm256_load_ps(&_q->h[i+ 0]), sum0);
+        sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(&x[i+ 8]), _mm256_load_ps(&_q->h[i+ 8]), sum1);
+        sum2 = _mm256_fmadd_ps(_mm256_loadu_ps(&x[i+16]), _mm256_load_ps(&_q->h[i+16]), sum2);
+        sum3 = _mm256_fmadd_ps(_mm256_loadu_ps(&x[i+24]), _mm256_load_ps(&_q->h[i+24]), sum3);
+    }
+
+    // remaining groups of 8
+    for ( ; i<t; i+=8)
+        sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(&x[i]), _mm256_load_ps(&_q->h[i]), sum0);
+
+    // fold down into single 4-element register, then add in-phase
+    // and quadrature components
+    sum0 = _mm256_add_ps( _mm256_add_ps(sum0, sum1), _mm256_add_ps(sum2, sum3) );
+    __m128 s = _mm_add_ps( _mm256_castps256_ps128(sum0), _mm256_extractf128_ps(sum0, 1) );
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+
+    // unload packed array
+    float w[4] __attribute__((aligned(16)));
+    _mm_store_ps(w, s);
+
+    // cleanup (note: n _must_ be even)
+    for ( ; i<n; i+=2) {
+        w[0] += x[i  ] * _q->h[i  ];
+        w[1] += x[i+1] * _q->h[i+1];
+    }
+
+    // set return value
+    *_y = w[0] + w[1]*_Complex_I;
+}
+
+// use AVX-512 extensions, unrolled loop with masked tail
+__attribute__((target("avx512f")))
+void dotprod_crcf_execute_avx512(dotprod_crcf    _q,
+                                 float complex * _x,
+                                 float complex * _y)
+{
+    // type cast input as floating point array
+    float * x = (float*) _x;
+
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    // load zeros into sum registers [re, im, re, im, ...]
+    __m512 sum0 = _mm512_setzero_ps();
+    __m512 sum1 = _mm512_setzero_ps();
+    __m512 sum2 = _mm512_setzero_ps();
+    __m512 sum3 = _mm512_setzero_ps();
+
+    // r = 64*floor(n/64), t = 16*floor(n/16)
+    unsigned int r = (n >> 6) << 6;
+    unsigned int t = (n >> 4) << 4;
+
+    unsigned int i;
+    for (i=0; i<r; i+=64) {
+        // multiply/accumulate: inputs unaligned, coefficients aligned
+        sum0 = _mm512_fmadd_ps(_mm512_loadu_ps(&x[i+ 0]), _mm512_load_ps(&_q->h[i+ 0]), sum0);
+        sum1 = _mm512_fmadd_ps(_mm512_loadu_ps(&x[i+16]), _mm512_load_ps(&_q->h[i+16]), sum1);
+        sum2 = _mm512_fmadd_ps(_mm512_loadu_ps(&x[i+32]), _mm512_load_ps(&_q->h[i+32]), sum2);
+        sum3 = _mm512_fmadd_ps(_mm512_loadu_ps(&x[i+48]), _mm512_load_ps(&_q->h[i+48]), sum3);
+    }
+
+    // remaining groups of 16
+    for ( ; i<t; i+=16)
+        sum0 = _mm512_fmadd_ps(_mm512_loadu_ps(&x[i]), _mm512_load_ps(&_q->h[i]), sum0);
+
+    // cleanup with masked loads (no memory is touched beyond the mask)
+    if (i < n) {
+        __mmask16 m = (__mmask16)((1u << (n - i)) - 1);
+        sum1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(m, &x[i]),
+                               _mm512_maskz_loadu_ps(m, &_q->h[i]), sum1);
+    }
+
+    // fold down into single 4-element register, then add in-phase
+    // and quadrature components
+    sum0 = _mm512_add_ps( _mm512_add_ps(sum0, sum1), _mm512_add_ps(sum2, sum3) );
+    __m256 s8 = _mm256_add_ps( _mm512_castps512_ps256(sum0),
+        _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(sum0), 1)) );
+    __m128 s = _mm_add_ps( _mm256_castps256_ps128(s8), _mm256_extractf128_ps(s8, 1) );
+    s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+
+    // unload packed array
+    float w[4] __attribute__((aligned(16)));
+    _mm_store_ps(w, s);
+
+    // set return value
+    *_y = w[0] + w[1]*_Complex_I;
+}
+// use AVX2/FMA extensions, computing four outputs per pass
+__attribute__((target("avx2,fma")))
+void dotprod_crcf_execute_block_avx2(dotprod_crcf    _q,
+                                     float complex * _x,
+                                     unsigned int    _stride,
+                                     unsigned int    _n,
+                                     float complex * _y)
+{
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    __m256 h;               // coefficients vector
+    __m256 s0, s1, s2, s3;  // dot products [re, im, re, im, ...]
+
+    // t = 8*floor(n/8)
+    unsigned int t = (n >> 3) << 3;
+
+    // aligned output array
+    float w[8] __attribute__((aligned(16)));
+
+    unsigned int i;
+    unsigned int k;
+    for (k=0; k+4<=_n; k+=4) {
+        // type cast inputs for each output as floating point arrays
+        float * x0 = (float*) (_x + (k+0)*_stride);
+        float * x1 = (float*) (_x + (k+1)*_stride);
+        float * x2 = (float*) (_x + (k+2)*_stride);
+        float * x3 = (float*) (_x + (k+3)*_stride);
+
+        // load zeros into sum registers
+        s0 = _mm256_setzero_ps();
+        s1 = _mm256_setzero_ps();
+        s2 = _mm256_setzero_ps();
+        s3 = _mm256_setzero_ps();
+
+        for (i=0; i<t; i+=8) {
+            // load coefficients into register (aligned)
+            h = _mm256_load_ps(&_q->h[i]);
+
+            // load inputs (unaligned), multiply, and accumulate
+            s0 = _mm256_fmadd_ps(_mm256_loadu_ps(&x0[i]), h, s0);
+            s1 = _mm256_fmadd_ps(_mm256_loadu_ps(&x1[i]), h, s1);
+            s2 = _mm256_fmadd_ps(_mm256_loadu_ps(&x2[i]), h, s2);
+            s3 = _mm256_fmadd_ps(_mm256_loadu_ps(&x3[i]), h, s3);
+        }
+
+        // fold each into 4-element register
+        __m128 v0 = _mm_add_ps(_mm256_castps256_ps128(s0), _mm256_extractf128_ps(s0, 1));
+        __m128 v1 = _mm_add_ps(_mm256_castps256_ps128(s1), _mm256_extractf128_ps(s1, 1));
+        __m128 v2 = _mm_add_ps(_mm256_castps256_ps128(s2), _mm256_extractf128_ps(s2, 1));
+        __m128 v3 = _mm_add_ps(_mm256_castps256_ps128(s3), _mm256_extractf128_ps(s3, 1));
+
+        // add upper and lower halves, pairing outputs
+        v0 = _mm_add_ps(_mm_movelh_ps(v0, v1), _mm_movehl_ps(v1, v0));
+        v2 = _mm_add_ps(_mm_movelh_ps(v2, v3), _mm_movehl_ps(v3, v2));
+        _mm_store_ps(&w[0], v0);
+        _mm_store_ps(&w[4], v2);
+
+        // cleanup (note: n _must_ be even)
+        for (i=t; i<n; i+=2) {
+            w[0] += x0[i] * _q->h[i];   w[1] += x0[i+1] * _q->h[i+1];
+            w[2] += x1[i] * _q->h[i];   w[3] += x1[i+1] * _q->h[i+1];
+            w[4] += x2[i] * _q->h[i];   w[5] += x2[i+1] * _q->h[i+1];
+            w[6] += x3[i] * _q->h[i];   w[7] += x3[i+1] * _q->h[i+1];
+        }
+
+        // set return values
+        _y[k+0] = w[0] + w[1]*_Complex_I;
+        _y[k+1] = w[2] + w[3]*_Complex_I;
+        _y[k+2] = w[4] + w[5]*_Complex_I;
+        _y[k+3] = w[6] + w[7]*_Complex_I;
+    }
+
+    // clean up remaining outputs
+    for ( ; k<_n; k++)
+        dotprod_crcf_execute_avx2(_q, _x + k*_stride, &_y[k]);
+}
+
+// use AVX-512 extensions, computing four outputs per pass with
+// masked tail
+__attribute__((target("avx512f")))
+void dotprod_crcf_execute_block_avx512(dotprod_crcf    _q,
+                                       float complex * _x,
+                                       unsigned int    _stride,
+                                       unsigned int    _n,
+                                       float complex * _y)
+{
+    // double effective length
+    unsigned int n = 2*_q->n;
+
+    __m512 h;               // coefficients vector
+    __m512 s0, s1, s2, s3;  // dot products [re, im, re, im, ...]
+
+    // t = 16*floor(n/16), tail mask for remaining coefficients
+    unsigned int t = (n >> 4) << 4;
+    __mmask16 m = (__mmask16)((1u << (n - t)) - 1);
+
+    unsigned int i;
+    unsigned int k;
+    for (k=0; k+4<=_n; k+=4) {
+        // type cast inputs for each output as floating point arrays
+        float * x0 = (float*) (_x + (k+0)*_stride);
+        float * x1 = (float*) (_x + (k+1)*_stride);
+        float * x2 = (float*) (_x + (k+2)*_stride);
+        float * x3 = (float*) (_x + (k+3)*_stride);
+
+        // load zeros into sum registers
+        s0 = _mm512_setzero_ps();
+        s1 = _mm512_setzero_ps();
+        s2 = _mm512_setzero_ps();
+        s3 = _mm512_setzero_ps();
+
+        for (i=0; i<t; i+=16) {
+            // load coefficients into register (aligned)
+            h = _mm512_load_ps(&_q->h[i]);
+
+            // load inputs (unaligned), multiply, and accumulate
+            s0 = _mm512_fmadd_ps(_mm512_loadu_ps(&x0[i]), h, s0);
+            s1 = _mm512_fmadd_ps(_mm512_loadu_ps(&x1[i]), h, s1);
+            s2 = _mm512_fmadd_ps(_mm512_loadu_ps(&x2[i]), h, s2);
+            s3 = _mm512_fmadd_ps(_mm512_loadu_ps(&x3[i]), h, s3);
+        }
+
+        // cleanup with masked loads
+        if (m) {
+            h = _mm512_maskz_loadu_ps(m, &_q->h[t]);
+            s0 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(m, &x0[t]), h, s0);
+            s1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(m, &x1[t]), h, s1);
+            s2 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(m, &x2[t]), h, s2);
+            s3 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(m, &x3[t]), h, s3);
+        }
+
+        // fold each into 8-element register
+        __m256 u0 = _mm256_add_ps(_mm512_castps512_ps256(s0),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(s0), 1)));
+        __m256 u1 = _mm256_add_ps(_mm512_castps512_ps256(s1),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(s1), 1)));
+        __m256 u2 = _mm256_add_ps(_mm512_castps512_ps256(s2),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(s2), 1)));
+        __m256 u3 = _mm256_add_ps(_mm512_castps512_ps256(s3),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(s3), 1)));
+
+        // fold each into 4-element register
+        __m128 v0 = _mm_add_ps(_mm256_castps256_ps128(u0), _mm256_extractf128_ps(u0, 1));
+        __m128 v1 = _mm_add_ps(_mm256_castps256_ps128(u1), _mm256_extractf128_ps(u1, 1));
+        __m128 v2 = _mm_add_ps(_mm256_castps256_ps128(u2), _mm256_extractf128_ps(u2, 1));
+        __m128 v3 = _mm_add_ps(_mm256_castps256_ps128(u3), _mm256_extractf128_ps(u3, 1));
+
+        // add upper and lower halves, pairing outputs, and store
+        // directly as interleaved complex values
+        v0 = _mm_add_ps(_mm_movelh_ps(v0, v1), _mm_movehl_ps(v1, v0));
+        v2 = _mm_add_ps(_mm_movelh_ps(v2, v3), _mm_movehl_ps(v3, v2));
+        _mm_storeu_ps((float*)&_y[k+0], v0);
+        _mm_storeu_ps((float*)&_y[k+2], v2);
+    }
+
+    // clean up remaining outputs
+    for ( ; k<_n; k++)
+        dotprod_crcf_execute_avx512(_q, _x + k*_stride, &_y[k]);
+}
+
+// use AVX2/FMA extensions on split-complex (planar) input
+__attribute__((target("avx2,fma")))
+void dotprod_crcf_execute_split_avx2(dotprod_crcf    _q,
+                                     float *         _xi,
+                                     float *         _xq,
+                                     float complex * _y)
+{
+    // load zeros into sum registers
+    __m256 si0 = _mm256_setzero_ps();
+    __m256 sq0 = _mm256_setzero_ps();
+    __m256 si1 = _mm256_setzero_ps();
+    __m256 sq1 = _mm256_setzero_ps();
+
+    // r = 16*floor(n/16), t = 8*floor(n/8)
+    unsigned int r = (_q->n >> 4) << 4;
+    unsigned int t = (_q->n >> 3) << 3;
+
+    unsigned int i;
+    for (i=0; i<r; i+=16) {
+        // multiply/accumulate: inputs unaligned, coefficients aligned
+        __m256 h0 = _mm256_load_ps(&_q->hp[i  ]);
+        __m256 h1 = _mm256_load_ps(&_q->hp[i+8]);
+        si0 = _mm256_fmadd_ps(h0, _mm256_loadu_ps(&_xi[i  ]), si0);
+        sq0 = _mm256_fmadd_ps(h0, _mm256_loadu_ps(&_xq[i  ]), sq0);
+        si1 = _mm256_fmadd_ps(h1, _mm256_loadu_ps(&_xi[i+8]), si1);
+        sq1 = _mm256_fmadd_ps(h1, _mm256_loadu_ps(&_xq[i+8]), sq1);
+    }
+
+    // remaining group of 8
+    for ( ; i<t; i+=8) {
+        __m256 h = _mm256_load_ps(&_q->hp[i]);
+        si0 = _mm256_fmadd_ps(h, _mm256_loadu_ps(&_xi[i]), si0);
+        sq0 = _mm256_fmadd_ps(h, _mm256_loadu_ps(&_xq[i]), sq0);
+    }
+
+    // fold down into 4-element registers
+    si0 = _mm256_add_ps(si0, si1);
+    sq0 = _mm256_add_ps(sq0, sq1);
+    __m128 si = _mm_add_ps( _mm256_castps256_ps128(si0), _mm256_extractf128_ps(si0, 1) );
+    __m128 sq = _mm_add_ps( _mm256_castps256_ps128(sq0), _mm256_extractf128_ps(sq0, 1) );
+
+    // unload packed arrays
+    float wi[4] __attribute__((aligned(16)));
+    float wq[4] __attribute__((aligned(16)));
+    _mm_store_ps(wi, si);
+    _mm_store_ps(wq, sq);
+    float ri = wi[0] + wi[1] + wi[2] + wi[3];
+    float rq = wq[0] + wq[1] + wq[2] + wq[3];
+
+    // cleanup
+    for ( ; i<_q->n; i++) {
+        ri += _q->hp[i] * _xi[i];
+        rq += _q->hp[i] * _xq[i];
+    }
+
+    // set return value
+    *_y = ri + rq*_Complex_I;
+}
+
+// use AVX-512 extensions on split-complex (planar) input with
+// masked tail
+__attribute__((target("avx512f")))
+void dotprod_crcf_execute_split_avx512(dotprod_crcf    _q,
+                                       float *         _xi,
+                                       float *         _xq,
+                                       float complex * _y)
+{
+    // load zeros into sum registers
+    __m512 si0 = _mm512_setzero_ps();
+    __m512 sq0 = _mm512_setzero_ps();
+    __m512 si1 = _mm512_setzero_ps();
+    __m512 sq1 = _mm512_setzero_ps();
+
+    // r = 32*floor(n/32), t = 16*floor(n/16)
+    unsigned int r = (_q->n >> 5) << 5;
+    unsigned int t = (_q->n >> 4) << 4;
+
+    unsigned int i;
+    for (i=0; i<r; i+=32) {
+        // multiply/accumulate: inputs unaligned, coefficients aligned
+        __m512 h0 = _mm512_load_ps(&_q->hp[i   ]);
+        __m512 h1 = _mm512_load_ps(&_q->hp[i+16]);
+        si0 = _mm512_fmadd_ps(h0, _mm512_loadu_ps(&_xi[i   ]), si0);
+        sq0 = _mm512_fmadd_ps(h0, _mm512_loadu_ps(&_xq[i   ]), sq0);
+        si1 = _mm512_fmadd_ps(h1, _mm512_loadu_ps(&_xi[i+16]), si1);
+        sq1 = _mm512_fmadd_ps(h1, _mm512_loadu_ps(&_xq[i+16]), sq1);
+    }
+
+    // remaining group of 16
+    for ( ; i<t; i+=16) {
+        __m512 h = _mm512_load_ps(&_q->hp[i]);
+        si0 = _mm512_fmadd_ps(h, _mm512_loadu_ps(&_xi[i]), si0);
+        sq0 = _mm512_fmadd_ps(h, _mm512_loadu_ps(&_xq[i]), sq0);
+    }
+
+    // cleanup with masked loads (no memory is touched beyond the mask)
+    if (i < _q->n) {
+        __mmask16 m = (__mmask16)((1u << (_q->n - i)) - 1);
+        __m512 h = _mm512_maskz_loadu_ps(m, &_q->hp[i]);
+        si1 = _mm512_fmadd_ps(h, _mm512_maskz_loadu_ps(m, &_xi[i]), si1);
+        sq1 = _mm512_fmadd_ps(h, _mm512_maskz_loadu_ps(m, &_xq[i]), sq1);
+    }
+
+    // set return value
+    *_y = _mm512_reduce_add_ps(_mm512_add_ps(si0, si1)) +
+          _mm512_reduce_add_ps(_mm512_add_ps(sq0, sq1))*_Complex_I;
+}
+
+// use AVX2/FMA extensions on a block of lagged split-complex (planar)
+// inputs, computing four outputs per pass so that each coefficient
+// vector is loaded once for all four
+__attribute__((target("avx2,fma")))
+void dotprod_crcf_execute_block_split_avx2(dotprod_crcf    _q,
+                                           float *         _xi,
+                                           float *         _xq,
+                                           unsigned int    _stride,
+                                           unsigned int    _n,
+                                           float complex * _y)
+{
+    // t = 8*floor(n/8)
+    unsigned int t = (_q->n >> 3) << 3;
+
+    unsigned int i, j, k;
+    for (k=0; k+4<=_n; k+=4) {
+        // input pointers for each of the four outputs
+        float * x0i = _xi + (k  )*_stride;   float * x0q = _xq + (k  )*_stride;
+        float * x1i = _xi + (k+1)*_stride;   float * x1q = _xq + (k+1)*_stride;
+        float * x2i = _xi + (k+2)*_stride;   float * x2q = _xq + (k+2)*_stride;
+        float * x3i = _xi + (k+3)*_stride;   float * x3q = _xq + (k+3)*_stride;
+
+        // load zeros into sum registers
+        __m256 si0 = _mm256_setzero_ps(), sq0 = _mm256_setzero_ps();
+        __m256 si1 = _mm256_setzero_ps(), sq1 = _mm256_setzero_ps();
+        __m256 si2 = _mm256_setzero_ps(), sq2 = _mm256_setzero_ps();
+        __m256 si3 = _mm256_setzero_ps(), sq3 = _mm256_setzero_ps();
+
+        for (i=0; i<t; i+=8) {
+            // multiply/accumulate: inputs unaligned, coefficients aligned
+            __m256 h = _mm256_load_ps(&_q->hp[i]);
+            __m256 xi0 = _mm256_loadu_ps(x0i + i);
+            __m256 xq0 = _mm256_loadu_ps(x0q + i);
+            __m256 xi1 = _mm256_loadu_ps(x1i + i);
+            __m256 xq1 = _mm256_loadu_ps(x1q + i);
+            __m256 xi2 = _mm256_loadu_ps(x2i + i);
+            __m256 xq2 = _mm256_loadu_ps(x2q + i);
+            __m256 xi3 = _mm256_loadu_ps(x3i + i);
+            __m256 xq3 = _mm256_loadu_ps(x3q + i);
+            si0 = _mm256_fmadd_ps(h, xi0, si0);
+            sq0 = _mm256_fmadd_ps(h, xq0, sq0);
+            si1 = _mm256_fmadd_ps(h, xi1, si1);
+            sq1 = _mm256_fmadd_ps(h, xq1, sq1);
+            si2 = _mm256_fmadd_ps(h, xi2, si2);
+            sq2 = _mm256_fmadd_ps(h, xq2, sq2);
+            si3 = _mm256_fmadd_ps(h, xi3, si3);
+            sq3 = _mm256_fmadd_ps(h, xq3, sq3);
+        }
+
+        // horizontal sums: { s0, s1, s2, s3 } in a single register
+        __m256 ui = _mm256_hadd_ps(_mm256_hadd_ps(si0, si1), _mm256_hadd_ps(si2, si3));
+        __m256 uq = _mm256_hadd_ps(_mm256_hadd_ps(sq0, sq1), _mm256_hadd_ps(sq2, sq3));
+
+        // unload packed arrays
+        float ri[4] __attribute__((aligned(16)));
+        float rq[4] __attribute__((aligned(16)));
+        _mm_store_ps(ri, _mm_add_ps(_mm256_castps256_ps128(ui), _mm256_extractf128_ps(ui, 1)));
+        _mm_store_ps(rq, _mm_add_ps(_mm256_castps256_ps128(uq), _mm256_extractf128_ps(uq, 1)));
+
+        // cleanup
+        float * x_i[4] = {x0i, x1i, x2i, x3i};
+        float * x_q[4] = {x0q, x1q, x2q, x3q};
+        for ( ; i<_q->n; i++) {
+            for (j=0; j<4; j++) {
+                ri[j] += _q->hp[i] * x_i[j][i];
+                rq[j] += _q->hp[i] * x_q[j][i];
+            }
+        }
+
+        // set return values
+        for (j=0; j<4; j++)
+            _y[k+j] = ri[j] + rq[j]*_Complex_I;
+    }
+
+    // clean up remaining outputs
+    for ( ; k<_n; k++)
+        dotprod_crcf_execute_split_avx2(_q, _xi + k*_stride, _xq + k*_stride, &_y[k]);
+}
+
+// fold 16-element register down to 8 elements
+__attribute__((target("avx512f")))
+static inline __m256 dotprod_crcf_fold_avx512(__m512 _s)
+{
+    return _mm256_add_ps(_mm512_castps512_ps256(_s),
+        _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(_s), 1)));
+}
+
+// use AVX-512 extensions on a block of lagged split-complex (planar)
+// inputs, computing four outputs per pass with masked tail
+__attribute__((target("avx512f")))
+void dotprod_crcf_execute_block_split_avx512(dotprod_crcf    _q,
+                                             float *         _xi,
+                                             float *         _xq,
+                                             unsigned int    _stride,
+                                             unsigned int    _n,
+                                             float complex * _y)
+{
+    // t = 16*floor(n/16)
+    unsigned int t = (_q->n >> 4) << 4;
+
+    unsigned int i, k;
+    for (k=0; k+4<=_n; k+=4) {
+        // input pointers for each of the four outputs
+        float * x0i = _xi + (k  )*_stride;   float * x0q = _xq + (k  )*_stride;
+        float * x1i = _xi + (k+1)*_stride;   float * x1q = _xq + (k+1)*_stride;
+        float * x2i = _xi + (k+2)*_stride;   float * x2q = _xq + (k+2)*_stride;
+        float * x3i = _xi + (k+3)*_stride;   float * x3q = _xq + (k+3)*_stride;
+
+        // load zeros into sum registers
+        __m512 si0 = _mm512_setzero_ps(), sq0 = _mm512_setzero_ps();
+        __m512 si1 = _mm512_setzero_ps(), sq1 = _mm512_setzero_ps();
+        __m512 si2 = _mm512_setzero_ps(), sq2 = _mm512_setzero_ps();
+        __m512 si3 = _mm512_setzero_ps(), sq3 = _mm512_setzero_ps();
+
+        for (i=0; i<t; i+=16) {
+            // multiply/accumulate: inputs unaligned, coefficients aligned
+            __m512 h = _mm512_load_ps(&_q->hp[i]);
+            __m512 xi0 = _mm512_loadu_ps(x0i + i);
+            __m512 xq0 = _mm512_loadu_ps(x0q + i);
+            __m512 xi1 = _mm512_loadu_ps(x1i + i);
+            __m512 xq1 = _mm512_loadu_ps(x1q + i);
+            __m512 xi2 = _mm512_loadu_ps(x2i + i);
+            __m512 xq2 = _mm512_loadu_ps(x2q + i);
+            __m512 xi3 = _mm512_loadu_ps(x3i + i);
+            __m512 xq3 = _mm512_loadu_ps(x3q + i);
+            si0 = _mm512_fmadd_ps(h, xi0, si0);
+            sq0 = _mm512_fmadd_ps(h, xq0, sq0);
+            si1 = _mm512_fmadd_ps(h, xi1, si1);
+            sq1 = _mm512_fmadd_ps(h, xq1, sq1);
+            si2 = _mm512_fmadd_ps(h, xi2, si2);
+            sq2 = _mm512_fmadd_ps(h, xq2, sq2);
+            si3 = _mm512_fmadd_ps(h, xi3, si3);
+            sq3 = _mm512_fmadd_ps(h, xq3, sq3);
+        }
+
+        // cleanup with masked loads (no memory is touched beyond the mask)
+        if (i < _q->n) {
+            __mmask16 m = (__mmask16)((1u << (_q->n - i)) - 1);
+            __m512 h = _mm512_maskz_loadu_ps(m, &_q->hp[i]);
+            __m512 xi0 = _mm512_maskz_loadu_ps(m, x0i + i);
+            __m512 xq0 = _mm512_maskz_loadu_ps(m, x0q + i);
+            __m512 xi1 = _mm512_maskz_loadu_ps(m, x1i + i);
+            __m512 xq1 = _mm512_maskz_loadu_ps(m, x1q + i);
+            __m512 xi2 = _mm512_maskz_loadu_ps(m, x2i + i);
+            __m512 xq2 = _mm512_maskz_loadu_ps(m, x2q + i);
+            __m512 xi3 = _mm512_maskz_loadu_ps(m, x3i + i);
+            __m512 xq3 = _mm512_maskz_loadu_ps(m, x3q + i);
+            si0 = _mm512_fmadd_ps(h, xi0, si0);
+            sq0 = _mm512_fmadd_ps(h, xq0, sq0);
+            si1 = _mm512_fmadd_ps(h, xi1, si1);
+            sq1 = _mm512_fmadd_ps(h, xq1, sq1);
+            si2 = _mm512_fmadd_ps(h, xi2, si2);
+            sq2 = _mm512_fmadd_ps(h, xq2, sq2);
+            si3 = _mm512_fmadd_ps(h, xi3, si3);
+            sq3 = _mm512_fmadd_ps(h, xq3, sq3);
+        }
+
+        // fold each sum down to 8 elements, then horizontal sums:
+        // { s0, s1, s2, s3 } in a single register
+        __m256 ui = _mm256_hadd_ps(
+            _mm256_hadd_ps(dotprod_crcf_fold_avx512(si0), dotprod_crcf_fold_avx512(si1)),
+            _mm256_hadd_ps(dotprod_crcf_fold_avx512(si2), dotprod_crcf_fold_avx512(si3)));
+        __m256 uq = _mm256_hadd_ps(
+            _mm256_hadd_ps(dotprod_crcf_fold_avx512(sq0), dotprod_crcf_fold_avx512(sq1)),
+            _mm256_hadd_ps(dotprod_crcf_fold_avx512(sq2), dotprod_crcf_fold_avx512(sq3)));
+
+        // unload packed arrays and set return values
+        float ri[4] __attribute__((aligned(16)));
+        float rq[4] __attribute__((aligned(16)));
+        _mm_store_ps(ri, _mm_add_ps(_mm256_castps256_ps128(ui), _mm256_extractf128_ps(ui, 1)));
+        _mm_store_ps(rq, _mm_add_ps(_mm256_castps256_ps128(uq), _mm256_extractf128_ps(uq, 1)));
+        _y[k  ] = ri[0] + rq[0]*_Complex_I;
+        _y[k+1] = ri[1] + rq[1]*_Complex_I;
+        _y[k+2] = ri[2] + rq[2]*_Complex_I;
+        _y[k+3] = ri[3] + rq[3]*_Complex_I;
+    }
+
+    // clean up remaining outputs
+    for ( ; k<_n; k++)
+        dotprod_crcf_execute_split_avx512(_q, _xi + k*_stride, _xq + k*_stride, &_y[k]);
+}
+#endif
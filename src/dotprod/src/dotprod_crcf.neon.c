@@ -301,3 +301,60 @@ void dotprod_crcf_execute_neon4(dotprod_crcf    _q,
 #endif
 }
 
+// execute structured dot product on a block of lagged inputs
+//  _q      :   dot product object
+//  _x      :   input array [size: (_n-1)*_stride + _q->n x 1]
+//  _stride :   input step between consecutive outputs
+//  _n      :   number of outputs
+//  _y      :   output array [size: _n x 1]
+void dotprod_crcf_execute_block(dotprod_crcf    _q,
+                                float complex * _x,
+                                unsigned int    _stride,
+                                unsigned int    _n,
+                                float complex * _y)
+{
+    unsigned int k;
+    for (k=0; k<_n; k++)
+        dotprod_crcf_execute(_q, _x + k*_stride, &_y[k]);
+}
+
+// execute structured dot product on split-complex (planar) input
+//  _q      :   dot product object
+//  _xi     :   input array, real part [size: _q->n x 1]
+//  _xq     :   input array, imaginary part [size: _q->n x 1]
+//  _y      :   output sample pointer
+void dotprod_crcf_execute_split(dotprod_crcf    _q,
+                                float *         _xi,
+                                float *         _xq,
+                                float complex * _y)
+{
+    float ri = 0;
+    float rq = 0;
+    unsigned int i;
+    for (i=0; i<_q->n; i++) {
+        // coefficients are stored repeated: h[2*i] = h[2*i+1] = _h[i]
+        ri += _q->h[2*i] * _xi[i];
+        rq += _q->h[2*i] * _xq[i];
+    }
+    *_y = ri + _Complex_I*rq;
+}
+
+// execute structured dot product on a block of lagged split-complex
+// (planar) inputs
+//  _q      :   dot product object
+//  _xi     :   input array, real part [size: (_n-1)*_stride + _q->n x 1]
+//  _xq     :   input array, imaginary part [size: (_n-1)*_stride + _q->n x 1]
+//  _stride :   input step between consecutive outputs
+//  _n      :   number of outputs
+//  _y      :   output array [size: _n x 1]
+void dotprod_crcf_execute_block_split(dotprod_crcf    _q,
+                                      float *         _xi,
+                                      float *         _xq,
+                                      unsigned int    _stride,
+                                      unsigned int    _n,
+                                      float complex * _y)
+{
+    unsigned int k;
+    for (k=0; k<_n; k++)
+        dotprod_crcf_execute_split(_q, _xi + k*_stride, _xq + k*_stride, &_y[k]);
+}
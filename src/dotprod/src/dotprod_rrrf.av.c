@@ -200,3 +200,19 @@ void dotprod_rrrf_execute(dotprod_rrrf _q,
     *_r = s.w[0] + s.w[1] + s.w[2] + s.w[3];
 }
 
+// execute structured dot product on a block of lagged inputs
+//  _q      :   dot product object
+//  _x      :   input array [size: (_n-1)*_stride + _q->n x 1]
+//  _stride :   input step between consecutive outputs
+//  _n      :   number of outputs
+//  _y      :   output array [size: _n x 1]
+void dotprod_rrrf_execute_block(dotprod_rrrf _q,
+                                float *      _x,
+                                unsigned int _stride,
+                                unsigned int _n,
+                                float *      _y)
+{
+    unsigned int k;
+    for (k=0; k<_n; k++)
+        dotprod_rrrf_execute(_q, _x + k*_stride, &_y[k]);
+}
@@ -31,4 +31,6 @@
 #define TC              float
 #define TI              float
 
+#define TI_COMPLEX      0
+
 #include "dotprod.c"
@@ -50,6 +50,10 @@
 #include <pmmintrin.h>  // SSE3
 #endif
 
+#if LIQUID_SIMD_DISPATCH
+#include <immintrin.h>  // AVX2, FMA, AVX-512 (selected at run time)
+#endif
+
 #define DEBUG_DOTPROD_RRRF_MMX   0
 
 // internal methods
@@ -59,6 +63,29 @@ void dotprod_rrrf_execute_mmx(dotprod_rrrf _q,
 void dotprod_rrrf_execute_mmx4(dotprod_rrrf _q,
                                float *      _x,
                                float *      _y);
+void dotprod_rrrf_execute_block_mmx(dotprod_rrrf _q,
+                                    float *      _x,
+                                    unsigned int _stride,
+                                    unsigned int _n,
+                                    float *      _y);
+#if LIQUID_SIMD_DISPATCH
+void dotprod_rrrf_execute_avx2(dotprod_rrrf _q,
+                               float *      _x,
+                               float *      _y);
+void dotprod_rrrf_execute_avx512(dotprod_rrrf _q,
+                                 float *      _x,
+                                 float *      _y);
+void dotprod_rrrf_execute_block_avx2(dotprod_rrrf _q,
+                                     float *      _x,
+                                     unsigned int _stride,
+                                     unsigned int _n,
+                                     float *      _y);
+void dotprod_rrrf_execute_block_avx512(dotprod_rrrf _q,
+                                       float *      _x,
+                                       unsigned int _stride,
+                                       unsigned int _n,
+                                       float *      _y);
+#endif
 
 // basic dot product (ordinal calculation)
 void dotprod_rrrf_run(float *      _h,
@@ -108,6 +135,17 @@ void dotprod_rrrf_run4(float *      _h,
 struct dotprod_rrrf_s {
     unsigned int n;     // length
     float * h;          // coefficients array
+
+    // SIMD extension level and kernel, selected at run time
+    liquid_simd_level level;
+    void (*execute_func)(dotprod_rrrf _q,
+                         float *      _x,
+                         float *      _y);
+    void (*execute_block_func)(dotprod_rrrf _q,
+                               float *      _x,
+                               unsigned int _stride,
+                               unsigned int _n,
+                               float *      _y);
 };
 
 dotprod_rrrf dotprod_rrrf_create(float *      _h,
@@ -116,12 +154,32 @@ dotprod_rrrf dotprod_rrrf_create(float *      _h,
     dotprod_rrrf q = (dotprod_rrrf)malloc(sizeof(struct dotprod_rrrf_s));
     q->n = _n;
 
-    // allocate memory for coefficients, 16-byte aligned
-    q->h = (float*) _mm_malloc( q->n*sizeof(float), 16);
+    // allocate memory for coefficients, 64-byte aligned (AVX-512)
+    q->h = (float*) _mm_malloc( q->n*sizeof(float), 64);
 
     // set coefficients
     memmove(q->h, _h, _n*sizeof(float));
 
+    // select kernel based on length and host processor
+    q->level = LIQUID_SIMD_BASELINE;
+    q->execute_func = q->n < 16 ? dotprod_rrrf_execute_mmx :
+                                  dotprod_rrrf_execute_mmx4;
+    q->execute_block_func = dotprod_rrrf_execute_block_mmx;
+#if LIQUID_SIMD_DISPATCH
+    q->level = liquid_simd_get_level();
+    switch (q->level) {
+    case LIQUID_SIMD_AVX512:
+        q->execute_func       = dotprod_rrrf_execute_avx512;
+        q->execute_block_func = dotprod_rrrf_execute_block_avx512;
+        break;
+    case LIQUID_SIMD_AVX2:
+        q->execute_func       = dotprod_rrrf_execute_avx2;
+        q->execute_block_func = dotprod_rrrf_execute_block_avx2;
+        break;
+    default:;
+    }
+#endif
+
     // return object
     return q;
 }
@@ -145,7 +203,8 @@ void dotprod_rrrf_destroy(dotprod_rrrf _q)
 
 void dotprod_rrrf_print(dotprod_rrrf _q)
 {
-    printf("dotprod_rrrf [mmx, %u coefficients]\n", _q->n);
+    printf("dotprod_rrrf [%s, %u coefficients]\n",
+            liquid_simd_level_str(_q->level), _q->n);
     unsigned int i;
     for (i=0; i<_q->n; i++)
         printf("%3u : %12.9f\n", i, _q->h[i]);
@@ -156,12 +215,24 @@ void dotprod_rrrf_execute(dotprod_rrrf _q,
                           float *      _x,
                           float *      _y)
 {
-    // switch based on size
-    if (_q->n < 16) {
-        dotprod_rrrf_execute_mmx(_q, _x, _y);
-    } else {
-        dotprod_rrrf_execute_mmx4(_q, _x, _y);
-    }
+    // invoke kernel selected at creation
+    _q->execute_func(_q, _x, _y);
+}
+
+// execute structured dot product on a block of lagged inputs
+//  _q      :   dot product object
+//  _x      :   input array [size: (_n-1)*_stride + _q->n x 1]
+//  _stride :   input step between consecutive outputs
+//  _n      :   number of outputs
+//  _y      :   output array [size: _n x 1]
+void dotprod_rrrf_execute_block(dotprod_rrrf _q,
+                                float *      _x,
+                                unsigned int _stride,
+                                unsigned int _n,
+                                float *      _y)
+{
+    // invoke kernel selected at creation
+    _q->execute_block_func(_q, _x, _stride, _n, _y);
 }
 
 // use MMX/SSE extensions
@@ -299,3 +370,317 @@ void dotprod_rrrf_execute_mmx4(dotprod_rrrf _q,
     *_y = total;
 }
 
+// use MMX/SSE extensions, computing four outputs per pass so that
+// each coefficient vector is loaded once for all four
+void dotprod_rrrf_execute_block_mmx(dotprod_rrrf _q,
+                                    float *      _x,
+                                    unsigned int _stride,
+                                    unsigned int _n,
+                                    float *      _y)
+{
+    __m128 h;               // coefficients vector
+    __m128 s0, s1, s2, s3;  // dot products
+
+    // t = 4*(floor(_n/4))
+    unsigned int t = (_q->n >> 2) << 2;
+
+    // aligned output array
+    float w[4] __attribute__((aligned(16)));
+
+    unsigned int i;
+    unsigned int k;
+    for (k=0; k+4<=_n; k+=4) {
+        // set input pointers for each output
+        float * x0 = _x + (k+0)*_stride;
+        float * x1 = _x + (k+1)*_stride;
+        float * x2 = _x + (k+2)*_stride;
+        float * x3 = _x + (k+3)*_stride;
+
+        // load zeros into sum registers
+        s0 = _mm_setzero_ps();
+        s1 = _mm_setzero_ps();
+        s2 = _mm_setzero_ps();
+        s3 = _mm_setzero_ps();
+
+        for (i=0; i<t; i+=4) {
+            // load coefficients into register (aligned)
+            h = _mm_load_ps(&_q->h[i]);
+
+            // load inputs (unaligned), multiply, and accumulate
+            s0 = _mm_add_ps(s0, _mm_mul_ps(_mm_loadu_ps(&x0[i]), h));
+            s1 = _mm_add_ps(s1, _mm_mul_ps(_mm_loadu_ps(&x1[i]), h));
+            s2 = _mm_add_ps(s2, _mm_mul_ps(_mm_loadu_ps(&x2[i]), h));
+            s3 = _mm_add_ps(s3, _mm_mul_ps(_mm_loadu_ps(&x3[i]), h));
+        }
+
+        // transpose and fold down: element j holds output j
+        _MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+        s0 = _mm_add_ps( _mm_add_ps(s0, s1), _mm_add_ps(s2, s3) );
+        _mm_store_ps(w, s0);
+
+        // cleanup
+        for (i=t; i<_q->n; i++) {
+            w[0] += x0[i] * _q->h[i];
+            w[1] += x1[i] * _q->h[i];
+            w[2] += x2[i] * _q->h[i];
+            w[3] += x3[i] * _q->h[i];
+        }
+
+        // set return values
+        _y[k+0] = w[0];
+        _y[k+1] = w[1];
+        _y[k+2] = w[2];
+        _y[k+3] = w[3];
+    }
+
+    // clean up remaining outputs
+    for ( ; k<_n; k++)
+        _q->execute_func(_q, _x + k*_stride, &_y[k]);
+}
+
+#if LIQUID_SIMD_DISPATCH
+// use AVX2/FMA extensions, unrolled loop
+__attribute__((target("avx2,fma")))
+void dotprod_rrrf_execute_avx2(dotprod_rrrf _q,
+                               float *      _x,
+                               float *      _y)
+{
+    // load zeros into sum registers
+    __m256 sum0 = _mm256_setzero_ps();
+    __m256 sum1 = _mm256_setzero_ps();
+    __m256 sum2 = _mm256_setzero_ps();
+    __m256 sum3 = _mm256_setzero_ps();
+
+    // r = 32*floor(n/32), t = 8*floor(n/8)
+    unsigned int r = (_q->n >> 5) << 5;
+    unsigned int t = (_q->n >> 3) << 3;
+
+    unsigned int i;
+    for (i=0; i<r; i+=32) {
+        // multiply/accumulate: inputs unaligned, coefficients aligned
+        sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(&_x[i+ 0]), _mm256_load_ps(&_q->h[i+ 0]), sum0);
+        sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(&_x[i+ 8]), _mm256_load_ps(&_q->h[i+ 8]), sum1);
+        sum2 = _mm256_fmadd_ps(_mm256_loadu_ps(&_x[i+16]), _mm256_load_ps(&_q->h[i+16]), sum2);
+        sum3 = _mm256_fmadd_ps(_mm256_loadu_ps(&_x[i+24]), _mm256_load_ps(&_q->h[i+24]), sum3);
+    }
+
+    // remaining groups of 8
+    for ( ; i<t; i+=8)
+        sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(&_x[i]), _mm256_load_ps(&_q->h[i]), sum0);
+
+    // fold down into single 4-element register
+    sum0 = _mm256_add_ps( _mm256_add_ps(sum0, sum1), _mm256_add_ps(sum2, sum3) );
+    __m128 s = _mm_add_ps( _mm256_castps256_ps128(sum0), _mm256_extractf128_ps(sum0, 1) );
+    s = _mm_hadd_ps(s, s);
+    s = _mm_hadd_ps(s, s);
+    float total = _mm_cvtss_f32(s);
+
+    // cleanup
+    for ( ; i<_q->n; i++)
+        total += _x[i] * _q->h[i];
+
+    // set return value
+    *_y = total;
+}
+
+// use AVX-512 extensions, unrolled loop with masked tail
+__attribute__((target("avx512f")))
+void dotprod_rrrf_execute_avx512(dotprod_rrrf _q,
+                                 float *      _x,
+                                 float *      _y)
+{
+    // load zeros into sum registers
+    __m512 sum0 = _mm512_setzero_ps();
+    __m512 sum1 = _mm512_setzero_ps();
+    __m512 sum2 = _mm512_setzero_ps();
+    __m512 sum3 = _mm512_setzero_ps();
+
+    // r = 64*floor(n/64), t = 16*floor(n/16)
+    unsigned int r = (_q->n >> 6) << 6;
+    unsigned int t = (_q->n >> 4) << 4;
+
+    unsigned int i;
+    for (i=0; i<r; i+=64) {
+        // multiply/accumulate: inputs unaligned, coefficients aligned
+        sum0 = _mm512_fmadd_ps(_mm512_loadu_ps(&_x[i+ 0]), _mm512_load_ps(&_q->h[i+ 0]), sum0);
+        sum1 = _mm512_fmadd_ps(_mm512_loadu_ps(&_x[i+16]), _mm512_load_ps(&_q->h[i+16]), sum1);
+        sum2 = _mm512_fmadd_ps(_mm512_loadu_ps(&_x[i+32]), _mm512_load_ps(&_q->h[i+32]), sum2);
+        sum3 = _mm512_fmadd_ps(_mm512_loadu_ps(&_x[i+48]), _mm512_load_ps(&_q->h[i+48]), sum3);
+    }
+
+    // remaining groups of 16
+    for ( ; i<t; i+=16)
+        sum0 = _mm512_fmadd_ps(_mm512_loadu_ps(&_x[i]), _mm512_load_ps(&_q->h[i]), sum0);
+
+    // cleanup with masked loads (no memory is touched beyond the mask)
+    if (i < _q->n) {
+        __mmask16 m = (__mmask16)((1u << (_q->n - i)) - 1);
+        sum1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(m, &_x[i]),
+                               _mm512_maskz_loadu_ps(m, &_q->h[i]), sum1);
+    }
+
+    // fold down into single 8-element register
+    sum0 = _mm512_add_ps( _mm512_add_ps(sum0, sum1), _mm512_add_ps(sum2, sum3) );
+    __m256 s8 = _mm256_add_ps( _mm512_castps512_ps256(sum0),
+        _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(sum0), 1)) );
+
+    // fold down into single value
+    __m128 s = _mm_add_ps( _mm256_castps256_ps128(s8), _mm256_extractf128_ps(s8, 1) );
+    s = _mm_hadd_ps(s, s);
+    s = _mm_hadd_ps(s, s);
+
+    // set return value
+    *_y = _mm_cvtss_f32(s);
+}
+// use AVX2/FMA extensions, computing four outputs per pass
+__attribute__((target("avx2,fma")))
+void dotprod_rrrf_execute_block_avx2(dotprod_rrrf _q,
+                                     float *      _x,
+                                     unsigned int _stride,
+                                     unsigned int _n,
+                                     float *      _y)
+{
+    __m256 h;               // coefficients vector
+    __m256 s0, s1, s2, s3;  // dot products
+
+    // t = 8*floor(n/8)
+    unsigned int t = (_q->n >> 3) << 3;
+
+    // aligned output array
+    float w[4] __attribute__((aligned(16)));
+
+    unsigned int i;
+    unsigned int k;
+    for (k=0; k+4<=_n; k+=4) {
+        // set input pointers for each output
+        float * x0 = _x + (k+0)*_stride;
+        float * x1 = _x + (k+1)*_stride;
+        float * x2 = _x + (k+2)*_stride;
+        float * x3 = _x + (k+3)*_stride;
+
+        // load zeros into sum registers
+        s0 = _mm256_setzero_ps();
+        s1 = _mm256_setzero_ps();
+        s2 = _mm256_setzero_ps();
+        s3 = _mm256_setzero_ps();
+
+        for (i=0; i<t; i+=8) {
+            // load coefficients into register (aligned)
+            h = _mm256_load_ps(&_q->h[i]);
+
+            // load inputs (unaligned), multiply, and accumulate
+            s0 = _mm256_fmadd_ps(_mm256_loadu_ps(&x0[i]), h, s0);
+            s1 = _mm256_fmadd_ps(_mm256_loadu_ps(&x1[i]), h, s1);
+            s2 = _mm256_fmadd_ps(_mm256_loadu_ps(&x2[i]), h, s2);
+            s3 = _mm256_fmadd_ps(_mm256_loadu_ps(&x3[i]), h, s3);
+        }
+
+        // fold each into 4-element register
+        __m128 v0 = _mm_add_ps(_mm256_castps256_ps128(s0), _mm256_extractf128_ps(s0, 1));
+        __m128 v1 = _mm_add_ps(_mm256_castps256_ps128(s1), _mm256_extractf128_ps(s1, 1));
+        __m128 v2 = _mm_add_ps(_mm256_castps256_ps128(s2), _mm256_extractf128_ps(s2, 1));
+        __m128 v3 = _mm_add_ps(_mm256_castps256_ps128(s3), _mm256_extractf128_ps(s3, 1));
+
+        // transpose and fold down: element j holds output j
+        _MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+        v0 = _mm_add_ps( _mm_add_ps(v0, v1), _mm_add_ps(v2, v3) );
+        _mm_store_ps(w, v0);
+
+        // cleanup
+        for (i=t; i<_q->n; i++) {
+            w[0] += x0[i] * _q->h[i];
+            w[1] += x1[i] * _q->h[i];
+            w[2] += x2[i] * _q->h[i];
+            w[3] += x3[i] * _q->h[i];
+        }
+
+        // set return values
+        _y[k+0] = w[0];
+        _y[k+1] = w[1];
+        _y[k+2] = w[2];
+        _y[k+3] = w[3];
+    }
+
+    // clean up remaining outputs
+    for ( ; k<_n; k++)
+        dotprod_rrrf_execute_avx2(_q, _x + k*_stride, &_y[k]);
+}
+
+// use AVX-512 extensions, computing four outputs per pass with
+// masked tail
+__attribute__((target("avx512f")))
+void dotprod_rrrf_execute_block_avx512(dotprod_rrrf _q,
+                                       float *      _x,
+                                       unsigned int _stride,
+                                       unsigned int _n,
+                                       float *      _y)
+{
+    __m512 h;               // coefficients vector
+    __m512 s0, s1, s2, s3;  // dot products
+
+    // t = 16*floor(n/16), tail mask for remaining coefficients
+    unsigned int t = (_q->n >> 4) << 4;
+    __mmask16 m = (__mmask16)((1u << (_q->n - t)) - 1);
+
+    unsigned int i;
+    unsigned int k;
+    for (k=0; k+4<=_n; k+=4) {
+        // set input pointers for each output
+        float * x0 = _x + (k+0)*_stride;
+        float * x1 = _x + (k+1)*_stride;
+        float * x2 = _x + (k+2)*_stride;
+        float * x3 = _x + (k+3)*_stride;
+
+        // load zeros into sum registers
+        s0 = _mm512_setzero_ps();
+        s1 = _mm512_setzero_ps();
+        s2 = _mm512_setzero_ps();
+        s3 = _mm512_setzero_ps();
+
+        for (i=0; i<t; i+=16) {
+            // load coefficients into register (aligned)
+            h = _mm512_load_ps(&_q->h[i]);
+
+            // load inputs (unaligned), multiply, and accumulate
+            s0 = _mm512_fmadd_ps(_mm512_loadu_ps(&x0[i]), h, s0);
+            s1 = _mm512_fmadd_ps(_mm512_loadu_ps(&x1[i]), h, s1);
+            s2 = _mm512_fmadd_ps(_mm512_loadu_ps(&x2[i]), h, s2);
+            s3 = _mm512_fmadd_ps(_mm512_loadu_ps(&x3[i]), h, s3);
+        }
+
+        // cleanup with masked loads
+        if (m) {
+            h = _mm512_maskz_loadu_ps(m, &_q->h[t]);
+            s0 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(m, &x0[t]), h, s0);
+            s1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(m, &x1[t]), h, s1);
+            s2 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(m, &x2[t]), h, s2);
+            s3 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(m, &x3[t]), h, s3);
+        }
+
+        // fold each into 8-element register
+        __m256 u0 = _mm256_add_ps(_mm512_castps512_ps256(s0),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(s0), 1)));
+        __m256 u1 = _mm256_add_ps(_mm512_castps512_ps256(s1),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(s1), 1)));
+        __m256 u2 = _mm256_add_ps(_mm512_castps512_ps256(s2),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(s2), 1)));
+        __m256 u3 = _mm256_add_ps(_mm512_castps512_ps256(s3),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(s3), 1)));
+
+        // fold each into 4-element register
+        __m128 v0 = _mm_add_ps(_mm256_castps256_ps128(u0), _mm256_extractf128_ps(u0, 1));
+        __m128 v1 = _mm_add_ps(_mm256_castps256_ps128(u1), _mm256_extractf128_ps(u1, 1));
+        __m128 v2 = _mm_add_ps(_mm256_castps256_ps128(u2), _mm256_extractf128_ps(u2, 1));
+        __m128 v3 = _mm_add_ps(_mm256_castps256_ps128(u3), _mm256_extractf128_ps(u3, 1));
+
+        // transpose and fold down: element j holds output j
+        _MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+        v0 = _mm_add_ps( _mm_add_ps(v0, v1), _mm_add_ps(v2, v3) );
+        _mm_storeu_ps(&_y[k], v0);
+    }
+
+    // clean up remaining outputs
+    for ( ; k<_n; k++)
+        dotprod_rrrf_execute_avx512(_q, _x + k*_stride, &_y[k]);
+}
+#endif
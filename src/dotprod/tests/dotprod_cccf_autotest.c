@@ -174,6 +174,19 @@ void autotest_dotprod_cccf_struct_lengths()
 
 
 
+// run test once at each SIMD extension level supported by the host
+// processor so that every dispatched kernel is exercised
+void dotprod_cccf_test_levels(void (*_test)())
+{
+    liquid_simd_level host = liquid_simd_get_level();
+    unsigned int level;
+    for (level=LIQUID_SIMD_BASELINE; level<=host; level++) {
+        liquid_simd_set_level((liquid_simd_level)level);
+        _test();
+    }
+    liquid_simd_set_level(host);
+}
+
 // helper function (compare structured object to ordinal computation)
 void runtest_dotprod_cccf(unsigned int _n)
 {
@@ -212,7 +225,7 @@ void runtest_dotprod_cccf(unsigned int _n)
 }
 
 // compare structured object to ordinal computation
-void autotest_dotprod_cccf_struct_vs_ordinal()
+void dotprod_cccf_test_struct_vs_ordinal()
 {
     // run many, many tests
     unsigned int i;
@@ -220,3 +233,129 @@ void autotest_dotprod_cccf_struct_vs_ordinal()
         runtest_dotprod_cccf(i);
 }
 
+// helper function (compare block execution to ordinal computation)
+//  _n      :   dot product length
+//  _stride :   input stride between outputs
+//  _num    :   number of outputs
+void runtest_dotprod_cccf_block(unsigned int _n,
+                                unsigned int _stride,
+                                unsigned int _num)
+{
+    float tol = 1e-4f * _n;
+    unsigned int x_len = (_num-1)*_stride + _n;
+    float complex h[_n];
+    float complex x[x_len];
+    float complex y[_num];
+
+    // generate random coefficients and input
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        h[i] = randnf() + randnf()*_Complex_I;
+    for (i=0; i<x_len; i++)
+        x[i] = randnf() + randnf()*_Complex_I;
+
+    // create object and run block dot product
+    dotprod_cccf q = dotprod_cccf_create(h,_n);
+    dotprod_cccf_execute_block(q, x, _stride, _num, y);
+    dotprod_cccf_destroy(q);
+
+    // validate each output against ordinal computation
+    unsigned int k;
+    for (k=0; k<_num; k++) {
+        float complex y_test = 0;
+        for (i=0; i<_n; i++)
+            y_test += h[i] * x[k*_stride + i];
+
+        CONTEND_DELTA(crealf(y[k]), crealf(y_test), tol);
+        CONTEND_DELTA(cimagf(y[k]), cimagf(y_test), tol);
+    }
+}
+
+// compare block execution to ordinal computation
+void dotprod_cccf_test_execute_block()
+{
+    unsigned int n;
+    for (n=1; n<=67; n++) {
+        runtest_dotprod_cccf_block(n, 1, 13);
+        runtest_dotprod_cccf_block(n, 3,  9);
+    }
+}
+
+// compare split-complex (planar) execution to ordinal computation
+void dotprod_cccf_test_execute_split()
+{
+    float tol = 1e-3f;
+    unsigned int n;
+    for (n=1; n<=67; n++) {
+        float complex h[n];
+        float complex x[n];
+        float xi[n];
+        float xq[n];
+
+        // generate random coefficients and input
+        unsigned int i;
+        for (i=0; i<n; i++) {
+            h[i] = randnf() + randnf()*_Complex_I;
+            x[i] = randnf() + randnf()*_Complex_I;
+        }
+        liquid_vectorcf_split(x, n, xi, xq);
+
+        // compute expected value (ordinal computation)
+        float complex y_test;
+        dotprod_cccf_run(h, x, n, &y_test);
+
+        // create and run dot product object on planar input
+        float complex y;
+        dotprod_cccf q = dotprod_cccf_create(h,n);
+        dotprod_cccf_execute_split(q, xi, xq, &y);
+        dotprod_cccf_destroy(q);
+
+        CONTEND_DELTA(crealf(y), crealf(y_test), tol);
+        CONTEND_DELTA(cimagf(y), cimagf(y_test), tol);
+    }
+}
+
+// compare block split-complex (planar) execution to ordinal computation
+void dotprod_cccf_test_execute_block_split()
+{
+    float tol = 1e-3f;
+    unsigned int num    = 9;    // number of outputs
+    unsigned int stride = 2;    // input stride
+    unsigned int n;
+    for (n=1; n<=67; n++) {
+        unsigned int x_len = (num-1)*stride + n;
+        float complex h[n];
+        float complex x[x_len];
+        float xi[x_len];
+        float xq[x_len];
+        float complex y[num];
+
+        // generate random coefficients and input
+        unsigned int i;
+        for (i=0; i<n; i++)
+            h[i] = randnf() + randnf()*_Complex_I;
+        for (i=0; i<x_len; i++)
+            x[i] = randnf() + randnf()*_Complex_I;
+        liquid_vectorcf_split(x, x_len, xi, xq);
+
+        // create and run dot product object on planar input
+        dotprod_cccf q = dotprod_cccf_create(h,n);
+        dotprod_cccf_execute_block_split(q, xi, xq, stride, num, y);
+        dotprod_cccf_destroy(q);
+
+        // validate each output against ordinal computation
+        unsigned int k;
+        for (k=0; k<num; k++) {
+            float complex y_test;
+            dotprod_cccf_run(h, &x[k*stride], n, &y_test);
+            CONTEND_DELTA(crealf(y[k]), crealf(y_test), tol);
+            CONTEND_DELTA(cimagf(y[k]), cimagf(y_test), tol);
+        }
+    }
+}
+
+// compare results at each SIMD extension level
+void autotest_dotprod_cccf_struct_vs_ordinal()   { dotprod_cccf_test_levels(dotprod_cccf_test_struct_vs_ordinal);   }
+void autotest_dotprod_cccf_execute_block()       { dotprod_cccf_test_levels(dotprod_cccf_test_execute_block);       }
+void autotest_dotprod_cccf_execute_split()       { dotprod_cccf_test_levels(dotprod_cccf_test_execute_split);       }
+void autotest_dotprod_cccf_execute_block_split() { dotprod_cccf_test_levels(dotprod_cccf_test_execute_block_split); }
@@ -327,6 +327,19 @@ void autotest_dotprod_rrrf_struct_lengths()
 // AUTOTEST: compare structured result to oridinal computation
 //
 
+// run test once at each SIMD extension level supported by the host
+// processor so that every dispatched kernel is exercised
+void dotprod_rrrf_test_levels(void (*_test)())
+{
+    liquid_simd_level host = liquid_simd_get_level();
+    unsigned int level;
+    for (level=LIQUID_SIMD_BASELINE; level<=host; level++) {
+        liquid_simd_set_level((liquid_simd_level)level);
+        _test();
+    }
+    liquid_simd_set_level(host);
+}
+
 // helper function (compare structured object to ordinal computation)
 void runtest_dotprod_rrrf(unsigned int _n)
 {
@@ -362,7 +375,7 @@ void runtest_dotprod_rrrf(unsigned int _n)
 }
 
 // compare structured object to ordinal computation
-void autotest_dotprod_rrrf_struct_vs_ordinal()
+void dotprod_rrrf_test_struct_vs_ordinal()
 {
     // run many, many tests
     unsigned int i;
@@ -370,3 +383,53 @@ void autotest_dotprod_rrrf_struct_vs_ordinal()
         runtest_dotprod_rrrf(i);
 }
 
+// helper function (compare block execution to ordinal computation)
+//  _n      :   dot product length
+//  _stride :   input stride between outputs
+//  _num    :   number of outputs
+void runtest_dotprod_rrrf_block(unsigned int _n,
+                                unsigned int _stride,
+                                unsigned int _num)
+{
+    float tol = 1e-4f * _n;
+    unsigned int x_len = (_num-1)*_stride + _n;
+    float h[_n];
+    float x[x_len];
+    float y[_num];
+
+    // generate random coefficients and input
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        h[i] = randnf();
+    for (i=0; i<x_len; i++)
+        x[i] = randnf();
+
+    // create object and run block dot product
+    dotprod_rrrf q = dotprod_rrrf_create(h,_n);
+    dotprod_rrrf_execute_block(q, x, _stride, _num, y);
+    dotprod_rrrf_destroy(q);
+
+    // validate each output against ordinal computation
+    unsigned int k;
+    for (k=0; k<_num; k++) {
+        float y_test = 0;
+        for (i=0; i<_n; i++)
+            y_test += h[i] * x[k*_stride + i];
+
+        CONTEND_DELTA(y[k], y_test, tol);
+    }
+}
+
+// compare block execution to ordinal computation
+void dotprod_rrrf_test_execute_block()
+{
+    unsigned int n;
+    for (n=1; n<=67; n++) {
+        runtest_dotprod_rrrf_block(n, 1, 13);
+        runtest_dotprod_rrrf_block(n, 3,  9);
+    }
+}
+
+// compare results at each SIMD extension level
+void autotest_dotprod_rrrf_struct_vs_ordinal() { dotprod_rrrf_test_levels(dotprod_rrrf_test_struct_vs_ordinal); }
+void autotest_dotprod_rrrf_execute_block()     { dotprod_rrrf_test_levels(dotprod_rrrf_test_execute_block);     }
@@ -84,3 +84,50 @@ void benchmark_eqlms_cccf_n16   EQLMS_CCCF_TRAIN_BENCH_API(16)
 void benchmark_eqlms_cccf_n32   EQLMS_CCCF_TRAIN_BENCH_API(32)
 void benchmark_eqlms_cccf_n64   EQLMS_CCCF_TRAIN_BENCH_API(64)
 
+
+#define EQLMS_CCCF_FD_BENCH_API(N)      \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ eqlms_cccf_fd_bench(_start, _finish, _num_iterations, N); }
+
+// frequency-domain block LMS; one trial is one block of _h_len samples
+void eqlms_cccf_fd_bench(struct rusage *_start,
+                         struct rusage *_finish,
+                         unsigned long int *_num_iterations,
+                         unsigned int _h_len)
+{
+    // scale number of iterations appropriately
+    *_num_iterations *= 16;
+    *_num_iterations /= _h_len;
+    *_num_iterations = (*_num_iterations < 4) ? 4 : *_num_iterations;
+
+    eqlms_cccf eq = eqlms_cccf_create(NULL,_h_len);
+
+    // set up input, desired arrays
+    float complex * x = (float complex*) malloc(_h_len*sizeof(float complex));
+    float complex * d = (float complex*) malloc(_h_len*sizeof(float complex));
+    float complex * y = (float complex*) malloc(_h_len*sizeof(float complex));
+    unsigned long int i;
+    for (i=0; i<_h_len; i++) {
+        x[i] = randnf() + _Complex_I*randnf();
+        d[i] = randnf() + _Complex_I*randnf();
+    }
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        eqlms_cccf_execute_block_fd(eq, x, d, _h_len, y);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= _h_len;
+
+    eqlms_cccf_destroy(eq);
+    free(x);
+    free(d);
+    free(y);
+}
+
+// 
+void benchmark_eqlms_cccf_fd_n64    EQLMS_CCCF_FD_BENCH_API(64)
+void benchmark_eqlms_cccf_fd_n256   EQLMS_CCCF_FD_BENCH_API(256)
+void benchmark_eqlms_cccf_fd_n1024  EQLMS_CCCF_FD_BENCH_API(1024)
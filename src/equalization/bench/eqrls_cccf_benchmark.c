@@ -25,25 +25,29 @@
 #include <math.h>
 #include "liquid.h"
 
-#define EQRLS_CCCF_TRAIN_BENCH_API(N)   \
-(   struct rusage *_start,              \
-    struct rusage *_finish,             \
-    unsigned long int *_num_iterations) \
-{ eqrls_cccf_train_bench(_start, _finish, _num_iterations, N); }
+#define EQRLS_CCCF_TRAIN_BENCH_API(N,TYPE)  \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ eqrls_cccf_train_bench(_start, _finish, _num_iterations, N, TYPE); }
 
 // Helper function to keep code base small
 void eqrls_cccf_train_bench(struct rusage *_start,
                             struct rusage *_finish,
                             unsigned long int *_num_iterations,
-                            unsigned int _h_len)
+                            unsigned int _h_len,
+                            liquid_eqrls_type _type)
 {
-    // scale number of iterations appropriately
-    // log(cycles/trial) ~ 5.57 + 2.74*log(_h_len)
+    // scale number of iterations appropriately; fast transversal
+    // filter is linear in _h_len, others are quadratic
     *_num_iterations *= 2400;
-    *_num_iterations /= (unsigned int) expf(5.57f + 2.64f*logf(_h_len));
+    if (_type == LIQUID_EQRLS_FTF)
+        *_num_iterations /= (unsigned int) expf(5.57f + 1.0f*logf(_h_len));
+    else
+        *_num_iterations /= (unsigned int) expf(5.57f + 2.0f*logf(_h_len));
     *_num_iterations = (*_num_iterations < 4) ? 4 : *_num_iterations;
 
-    eqrls_cccf eq = eqrls_cccf_create(NULL,_h_len);
+    eqrls_cccf eq = eqrls_cccf_create_type(_type,NULL,_h_len);
     
     unsigned long int i;
 
@@ -78,9 +82,19 @@ void eqrls_cccf_train_bench(struct rusage *_start,
 }
 
 // 
-void benchmark_eqrls_cccf_n4    EQRLS_CCCF_TRAIN_BENCH_API(4)
-void benchmark_eqrls_cccf_n8    EQRLS_CCCF_TRAIN_BENCH_API(8)
-void benchmark_eqrls_cccf_n16   EQRLS_CCCF_TRAIN_BENCH_API(16)
-void benchmark_eqrls_cccf_n32   EQRLS_CCCF_TRAIN_BENCH_API(32)
-void benchmark_eqrls_cccf_n64   EQRLS_CCCF_TRAIN_BENCH_API(64)
+void benchmark_eqrls_cccf_n4    EQRLS_CCCF_TRAIN_BENCH_API(4,  LIQUID_EQRLS_CONVENTIONAL)
+void benchmark_eqrls_cccf_n8    EQRLS_CCCF_TRAIN_BENCH_API(8,  LIQUID_EQRLS_CONVENTIONAL)
+void benchmark_eqrls_cccf_n16   EQRLS_CCCF_TRAIN_BENCH_API(16, LIQUID_EQRLS_CONVENTIONAL)
+void benchmark_eqrls_cccf_n32   EQRLS_CCCF_TRAIN_BENCH_API(32, LIQUID_EQRLS_CONVENTIONAL)
+void benchmark_eqrls_cccf_n64   EQRLS_CCCF_TRAIN_BENCH_API(64, LIQUID_EQRLS_CONVENTIONAL)
 
+// fast transversal filter
+void benchmark_eqrls_cccf_ftf_n4    EQRLS_CCCF_TRAIN_BENCH_API(4,  LIQUID_EQRLS_FTF)
+void benchmark_eqrls_cccf_ftf_n16   EQRLS_CCCF_TRAIN_BENCH_API(16, LIQUID_EQRLS_FTF)
+void benchmark_eqrls_cccf_ftf_n64   EQRLS_CCCF_TRAIN_BENCH_API(64, LIQUID_EQRLS_FTF)
+void benchmark_eqrls_cccf_ftf_n256  EQRLS_CCCF_TRAIN_BENCH_API(256,LIQUID_EQRLS_FTF)
+
+// inverse QR
+void benchmark_eqrls_cccf_iqr_n4    EQRLS_CCCF_TRAIN_BENCH_API(4,  LIQUID_EQRLS_IQR)
+void benchmark_eqrls_cccf_iqr_n16   EQRLS_CCCF_TRAIN_BENCH_API(16, LIQUID_EQRLS_IQR)
+void benchmark_eqrls_cccf_iqr_n64   EQRLS_CCCF_TRAIN_BENCH_API(64, LIQUID_EQRLS_IQR)
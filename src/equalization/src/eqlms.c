@@ -23,6 +23,12 @@
 //
 // Least mean-squares (LMS) equalizer
 //
+// Weights are updated every sample by default. With a block size B
+// set, step() accumulates B updates before applying them (block
+// LMS). execute_block_fd() runs block LMS with block size h_len in
+// the frequency domain (overlap-save, constrained gradient, per-bin
+// step normalization) at O(log h_len) cost per sample.
+//
 
 #include <math.h>
 #include <stdlib.h>
@@ -45,11 +51,36 @@ struct EQLMS(_s) {
     WINDOW()     buffer;    // input buffer
     wdelayf      x2;        // buffer of |x|^2 values
     float        x2_sum;    // sum{ |x|^2 }
+
+    // block LMS: w1 accumulates updates, copied to w0 once per block
+    unsigned int block_size;    // samples per weight update
+    unsigned int block_count;   // updates accumulated in w1
+
+    // frequency-domain block LMS, allocated on first use
+    float complex * fd_time;    // time buffer [size: 2*h_len x 1]
+    float complex * fd_freq;    // freq buffer [size: 2*h_len x 1]
+    float complex * fd_X;       // input spectrum [size: 2*h_len x 1]
+    float complex * fd_H;       // weight spectrum [size: 2*h_len x 1]
+    float *         fd_P;       // per-bin input power [size: 2*h_len x 1]
+    FFT_PLAN        fd_fft;     // forward transform (time > freq)
+    FFT_PLAN        fd_ifft;    // inverse transform (freq > time)
 };
 
+// smoothing factor for per-bin power estimate
+#define EQLMS_FD_POWER_ALPHA    (0.9f)
+
+// per-bin power regularization relative to average power
+#define EQLMS_FD_POWER_REG      (0.01f)
+
 // update sum{|x|^2}
 void EQLMS(_update_sumsq)(EQLMS() _q, T _x);
 
+// allocate frequency-domain buffers and transforms
+void EQLMS(_fd_init)(EQLMS() _q);
+
+// run frequency-domain block LMS on a single block of h_len samples
+void EQLMS(_fd_run)(EQLMS() _q, T * _x, T * _d, T * _y);
+
 // create least mean-squares (LMS) equalizer object
 //  _h      :   initial coefficients [size: _h_len x 1], default if NULL
 //  _p      :   equalizer length (number of taps)
@@ -68,6 +99,12 @@ EQLMS() EQLMS(_create)(T *          _h,
     q->buffer = WINDOW(_create)(q->h_len);
     q->x2     = wdelayf_create(q->h_len);
 
+    // update weights every sample
+    q->block_size = 1;
+
+    // frequency-domain buffers are allocated on first use
+    q->fd_time = NULL;
+
     // copy coefficients (if not NULL)
     if (_h == NULL) {
         // initial coefficients with delta at first index
@@ -192,6 +229,17 @@ void EQLMS(_destroy)(EQLMS() _q)
 
     WINDOW(_destroy)(_q->buffer);
     wdelayf_destroy(_q->x2);
+
+    // free frequency-domain objects
+    if (_q->fd_time != NULL) {
+        free(_q->fd_time);
+        free(_q->fd_freq);
+        free(_q->fd_X);
+        free(_q->fd_H);
+        free(_q->fd_P);
+        FFT_DESTROY_PLAN(_q->fd_fft);
+        FFT_DESTROY_PLAN(_q->fd_ifft);
+    }
     free(_q);
 }
 
@@ -200,6 +248,7 @@ void EQLMS(_reset)(EQLMS() _q)
 {
     // copy default coefficients
     memmove(_q->w0, _q->h0, (_q->h_len)*sizeof(T));
+    memmove(_q->w1, _q->h0, (_q->h_len)*sizeof(T));
 
     WINDOW(_clear)(_q->buffer);
     wdelayf_clear(_q->x2);
@@ -207,9 +256,14 @@ void EQLMS(_reset)(EQLMS() _q)
     // reset input count
     _q->count = 0;
     _q->buf_full = 0;
+    _q->block_count = 0;
 
     // reset squared magnitude sum
     _q->x2_sum = 0;
+
+    // reset per-bin power estimate
+    if (_q->fd_time != NULL)
+        memset(_q->fd_P, 0x00, 2*_q->h_len*sizeof(float));
 }
 
 // print eqlms object internals
@@ -217,6 +271,7 @@ void EQLMS(_print)(EQLMS() _q)
 {
     printf("equalizer (LMS):\n");
     printf("    order:      %u\n", _q->h_len);
+    printf("    block size: %u\n", _q->block_size);
     unsigned int i;
     for (i=0; i<_q->h_len; i++)
         printf("  h(%3u) = %12.4e + j*%12.4e;\n", i+1, creal(_q->w0[i]), cimag(_q->w0[i]));
@@ -242,6 +297,32 @@ void EQLMS(_set_bw)(EQLMS() _q,
     _q->mu = _mu;
 }
 
+// get number of samples per weight update
+unsigned int EQLMS(_get_block_size)(EQLMS() _q)
+{
+    return _q->block_size;
+}
+
+// set number of samples per weight update (block LMS); step()
+// accumulates updates against fixed weights and applies them once
+// every _block_size calls
+//  _q          :   equalizer object
+//  _block_size :   samples per update, _block_size > 0
+void EQLMS(_set_block_size)(EQLMS()      _q,
+                            unsigned int _block_size)
+{
+    if (_block_size == 0) {
+        fprintf(stderr,"error: eqlms_%s_set_block_size(), block size must be greater than zero\n", EXTENSION_FULL);
+        exit(1);
+    }
+
+    // apply any pending updates
+    memmove(_q->w0, _q->w1, _q->h_len*sizeof(T));
+    _q->block_count = 0;
+
+    _q->block_size = _block_size;
+}
+
 // push sample into equalizer internal buffer
 //  _q      :   equalizer object
 //  _x      :   received sample
@@ -333,6 +414,34 @@ void EQLMS(_execute_block)(EQLMS()      _q,
     }
 }
 
+// execute equalizer on block of samples, adapting weights once every
+// h_len samples with frequency-domain block LMS
+//  _q      :   equalizer object
+//  _x      :   input sample array [size: _n x 1]
+//  _d      :   desired output array [size: _n x 1], NULL for blind
+//  _n      :   input sample array length, multiple of h_len
+//  _y      :   output sample array [size: _n x 1]
+void EQLMS(_execute_block_fd)(EQLMS()      _q,
+                              T *          _x,
+                              T *          _d,
+                              unsigned int _n,
+                              T *          _y)
+{
+    if ( (_n % _q->h_len) != 0 ) {
+        fprintf(stderr,"error: eqlms_%s_execute_block_fd(), block length (%u) must be a multiple of filter length (%u)\n",
+                EXTENSION_FULL, _n, _q->h_len);
+        exit(1);
+    }
+
+    // allocate transforms on first use
+    if (_q->fd_time == NULL)
+        EQLMS(_fd_init)(_q);
+
+    unsigned int i;
+    for (i=0; i<_n; i+=_q->h_len)
+        EQLMS(_fd_run)(_q, _x+i, _d==NULL ? NULL : _d+i, _y+i);
+}
+
 // step through one cycle of equalizer training
 //  _q      :   equalizer object
 //  _d      :   desired output
@@ -361,7 +470,13 @@ void EQLMS(_step)(EQLMS() _q,
     // update weighting vector
     // w[n+1] = w[n] + mu*conj(d-d_hat)*x[n]/(x[n]' * conj(x[n]))
     for (i=0; i<_q->h_len; i++)
-        _q->w1[i] = _q->w0[i] + (_q->mu)*conj(alpha)*r[i]/_q->x2_sum;
+        _q->w1[i] += (_q->mu)*conj(alpha)*r[i]/_q->x2_sum;
+
+    // apply updates only at end of block
+    _q->block_count++;
+    if (_q->block_count < _q->block_size)
+        return;
+    _q->block_count = 0;
 
 #ifdef DEBUG
     printf("w0: \n");
@@ -429,6 +544,7 @@ void EQLMS(_train)(EQLMS()      _q,
     // copy initial weights into buffer
     for (i=0; i<p; i++)
         _q->w0[i] = _w[p - i - 1];
+    memmove(_q->w1, _q->w0, p*sizeof(T));
 
     T d_hat;
     for (i=0; i<_n; i++) {
@@ -470,3 +586,122 @@ void EQLMS(_update_sumsq)(EQLMS() _q, T _x)
     _q->x2_sum = _q->x2_sum + x2_n - x2_0;
 }
 
+// allocate frequency-domain buffers and transforms
+void EQLMS(_fd_init)(EQLMS() _q)
+{
+    unsigned int nfft = 2*_q->h_len;
+    _q->fd_time = (float complex*) malloc(nfft*sizeof(float complex));
+    _q->fd_freq = (float complex*) malloc(nfft*sizeof(float complex));
+    _q->fd_X    = (float complex*) malloc(nfft*sizeof(float complex));
+    _q->fd_H    = (float complex*) malloc(nfft*sizeof(float complex));
+    _q->fd_P    = (float*)         calloc(nfft,sizeof(float));
+
+    _q->fd_fft  = FFT_CREATE_PLAN(nfft, _q->fd_time, _q->fd_freq, FFT_DIR_FORWARD,  FFT_METHOD);
+    _q->fd_ifft = FFT_CREATE_PLAN(nfft, _q->fd_freq, _q->fd_time, FFT_DIR_BACKWARD, FFT_METHOD);
+}
+
+// run frequency-domain block LMS on a single block of h_len samples;
+// outputs are identical to execute() with weights held fixed over the
+// block, and the update is the sum of the block's per-sample gradients
+// with each frequency bin normalized by its own power
+//  _q      :   equalizer object
+//  _x      :   input samples [size: h_len x 1]
+//  _d      :   desired output [size: h_len x 1], NULL for blind
+//  _y      :   output samples [size: h_len x 1]
+void EQLMS(_fd_run)(EQLMS() _q,
+                    T *     _x,
+                    T *     _d,
+                    T *     _y)
+{
+    unsigned int i;
+    unsigned int n    = _q->h_len;
+    unsigned int nfft = 2*n;
+    float complex * t = _q->fd_time;
+    float complex * f = _q->fd_freq;
+
+    // weights as filter, h[k] = conj(w[n-k-1]), zero-padded
+    for (i=0; i<n; i++) {
+        t[i]   = conj(_q->w0[n-i-1]);
+        t[n+i] = 0;
+    }
+    FFT_EXECUTE(_q->fd_fft);
+    memmove(_q->fd_H, f, nfft*sizeof(float complex));
+
+    // input spectrum: previous block (buffer contents) and current block
+    T * r;
+    WINDOW(_read)(_q->buffer, &r);
+    for (i=0; i<n; i++) {
+        t[i]   = r[i];
+        t[n+i] = _x[i];
+    }
+    FFT_EXECUTE(_q->fd_fft);
+    memmove(_q->fd_X, f, nfft*sizeof(float complex));
+
+    // filter; last n samples of circular convolution are valid
+    for (i=0; i<nfft; i++)
+        f[i] *= _q->fd_H[i];
+    FFT_EXECUTE(_q->fd_ifft);
+    float scale = 1.0f / (float)nfft;
+    for (i=0; i<n; i++) {
+#if T_COMPLEX
+        _y[i] = t[n+i] * scale;
+#else
+        _y[i] = crealf(t[n+i]) * scale;
+#endif
+    }
+
+    // push block into buffer, update sum{|x|^2}
+    WINDOW(_write)(_q->buffer, _x, n);
+    for (i=0; i<n; i++)
+        EQLMS(_update_sumsq)(_q, _x[i]);
+    _q->count += n;
+
+    // error spectrum, zero-padded at front
+    for (i=0; i<n; i++) {
+        T d;
+        if (_d != NULL) {
+            d = _d[i];
+        } else {
+            // constant modulus, as in step_blind()
+#if T_COMPLEX
+            d = _y[i] / cabsf(_y[i]);
+#else
+            d = _y[i] > 0 ? 1 : -1;
+#endif
+        }
+        t[i]   = 0;
+        t[n+i] = d - _y[i];
+    }
+    FFT_EXECUTE(_q->fd_fft);
+
+    // update per-bin power estimate
+    float p_avg = 0.0f;
+    for (i=0; i<nfft; i++) {
+        float x2 = crealf(_q->fd_X[i])*crealf(_q->fd_X[i]) +
+                   cimagf(_q->fd_X[i])*cimagf(_q->fd_X[i]);
+        if (_q->fd_P[i] == 0.0f)
+            _q->fd_P[i] = x2;
+        else
+            _q->fd_P[i] = EQLMS_FD_POWER_ALPHA*_q->fd_P[i] + (1.0f-EQLMS_FD_POWER_ALPHA)*x2;
+        p_avg += _q->fd_P[i];
+    }
+    p_avg /= (float)nfft;
+    if (p_avg == 0.0f)
+        return;
+
+    // normalized gradient, conj(X) E / P
+    float reg = EQLMS_FD_POWER_REG * p_avg;
+    for (i=0; i<nfft; i++)
+        f[i] *= conjf(_q->fd_X[i]) / (_q->fd_P[i] + reg);
+    FFT_EXECUTE(_q->fd_ifft);
+
+    // constrain gradient to first n lags and update weights; P is
+    // roughly nfft times the per-sample power while x2_sum is n times,
+    // hence the factor of two relative to step()
+    float g = 2.0f * _q->mu * scale;
+    for (i=0; i<n; i++) {
+        T dw = conj(g * t[i]);
+        _q->w0[n-i-1] += dw;
+        _q->w1[n-i-1] += dw;
+    }
+}
@@ -23,35 +23,77 @@
 //
 // Recursive least-squares (RLS) equalizer
 //
+// Three algorithms share the push/execute/step interface:
+//  LIQUID_EQRLS_CONVENTIONAL : inverse correlation matrix, O(p^2)
+//  LIQUID_EQRLS_FTF          : stabilized fast transversal filter, O(p)
+//  LIQUID_EQRLS_IQR          : inverse QR decomposition (Givens
+//                              rotations on Cholesky factor), O(p^2)
+//
+// All minimize sum lambda^(n-i) |d(i) - x_i^T w|^2 where x_i is the
+// buffer contents (oldest sample first) when step() is invoked.
+//
 
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <math.h>
 
 //#define DEBUG
 
+// FTF stabilization: weights of directly-computed backward prediction
+// error when mixed with error propagated through the gain vector, for
+// the backward predictor (K1) and its error energy (K2)
+#define EQRLS_FTF_K1    (1.5f)
+#define EQRLS_FTF_K2    (2.5f)
+
+#if T_COMPLEX
+#  define EQRLS_CONJ(X)     conjf(X)
+#  define EQRLS_ABS2(X)     (crealf(X)*crealf(X) + cimagf(X)*cimagf(X))
+#else
+#  define EQRLS_CONJ(X)     (X)
+#  define EQRLS_ABS2(X)     ((X)*(X))
+#endif
+
 struct EQRLS(_s) {
+    liquid_eqrls_type type; // algorithm
     unsigned int p;     // filter order
     float lambda;       // RLS forgetting factor
     float delta;        // RLS initialization factor
 
-    // internal matrices
+    // weights
     T * h0;             // initial coefficients
     T * w0, * w1;       // weights [px1]
-    T * P0, * P1;       // recursion matrix [pxp]
-    T * g;              // gain vector [px1]
 
-    // temporary matrices
+    // conventional: inverse correlation matrix P = R^-1
+    T * P0;             // recursion matrix [pxp]
+    T * g;              // gain vector [px1]
     T * xP0;            // [1xp]
     T zeta;             // constant
 
-    T * gxl;            // [pxp]
-    T * gxlP0;          // [pxp]
+    // fast transversal filter (FTF)
+    T * c;              // a priori gain, P x^* / lambda [px1]
+    T * cbar;           // extended gain [(p+1)x1]
+    T * a;              // forward predictor [px1]
+    T * b;              // backward predictor [px1]
+    float ef;           // forward prediction error energy
+    float eb;           // backward prediction error energy
+    float gamma;        // conversion factor
+
+    // inverse QR: lower-triangular S with P = S S^H
+    T * S;              // [pxp], row-major
+    T * u;              // S^T x / sqrt(lambda), first row of pre-array [px1]
+    T * v;              // rotated first column of pre-array [px1]
 
     unsigned int n;     // input counter
-    WINDOW() buffer;    // input buffer
+    unsigned int num_pushed;    // samples pushed since last step
+    WINDOW() buffer;    // input buffer, p+1 samples (oldest unused
+                        // except by FTF)
 };
 
+// forward declaration of internal methods
+void EQRLS(_step_conventional)(EQRLS() _q, T * _x, T _alpha);
+void EQRLS(_step_ftf)(EQRLS() _q, T * _x, T _alpha);
+void EQRLS(_step_iqr)(EQRLS() _q, T * _x, T _alpha);
 
 // create recursive least-squares (RLS) equalizer object
 //  _h      :   initial coefficients [size: _p x 1], default if NULL
@@ -59,26 +101,74 @@ struct EQRLS(_s) {
 EQRLS() EQRLS(_create)(T *          _h,
                        unsigned int _p)
 {
+    return EQRLS(_create_type)(LIQUID_EQRLS_CONVENTIONAL, _h, _p);
+}
+
+// create recursive least-squares (RLS) equalizer object using
+// specific algorithm
+//  _type   :   algorithm (e.g. LIQUID_EQRLS_FTF)
+//  _h      :   initial coefficients [size: _p x 1], default if NULL
+//  _p      :   equalizer length (number of taps)
+EQRLS() EQRLS(_create_type)(liquid_eqrls_type _type,
+                            T *               _h,
+                            unsigned int      _p)
+{
+    // validate input
+    if (_type != LIQUID_EQRLS_CONVENTIONAL &&
+        _type != LIQUID_EQRLS_FTF &&
+        _type != LIQUID_EQRLS_IQR)
+    {
+        fprintf(stderr,"error: eqrls_%s_create_type(), invalid type %d\n", EXTENSION_FULL, _type);
+        exit(1);
+    } else if (_p == 0) {
+        fprintf(stderr,"error: eqrls_%s_create_type(), equalizer length must be greater than 0\n", EXTENSION_FULL);
+        exit(1);
+    }
+
     EQRLS() q = (EQRLS()) malloc(sizeof(struct EQRLS(_s)));
 
     // set filter order, other parameters
+    q->type   = _type;  // algorithm
     q->p      = _p;     // filter order
     q->lambda = 0.99f;  // learning rate
     q->delta  = 0.1f;   // initialization factor
 
-    // allocate memory for matrices
+    // allocate memory for weights
     q->h0 = (T*) malloc((q->p)*sizeof(T));
     q->w0 = (T*) malloc((q->p)*sizeof(T));
     q->w1 = (T*) malloc((q->p)*sizeof(T));
-    q->P0 = (T*) malloc((q->p)*(q->p)*sizeof(T));
-    q->P1 = (T*) malloc((q->p)*(q->p)*sizeof(T));
-    q->g  = (T*) malloc((q->p)*sizeof(T));
 
-    q->xP0 =   (T*) malloc((q->p)*sizeof(T));
-    q->gxl =   (T*) malloc((q->p)*(q->p)*sizeof(T));
-    q->gxlP0 = (T*) malloc((q->p)*(q->p)*sizeof(T));
+    // allocate memory for algorithm state
+    q->P0   = NULL;
+    q->g    = NULL;
+    q->xP0  = NULL;
+    q->c    = NULL;
+    q->cbar = NULL;
+    q->a    = NULL;
+    q->b    = NULL;
+    q->S    = NULL;
+    q->u    = NULL;
+    q->v    = NULL;
+    switch (q->type) {
+    case LIQUID_EQRLS_CONVENTIONAL:
+        q->P0  = (T*) malloc((q->p)*(q->p)*sizeof(T));
+        q->g   = (T*) malloc((q->p)*sizeof(T));
+        q->xP0 = (T*) malloc((q->p)*sizeof(T));
+        break;
+    case LIQUID_EQRLS_FTF:
+        q->c    = (T*) malloc((q->p)*sizeof(T));
+        q->cbar = (T*) malloc((q->p+1)*sizeof(T));
+        q->a    = (T*) malloc((q->p)*sizeof(T));
+        q->b    = (T*) malloc((q->p)*sizeof(T));
+        break;
+    case LIQUID_EQRLS_IQR:
+        q->S = (T*) malloc((q->p)*(q->p)*sizeof(T));
+        q->u = (T*) malloc((q->p)*sizeof(T));
+        q->v = (T*) malloc((q->p)*sizeof(T));
+        break;
+    }
 
-    q->buffer = WINDOW(_create)(q->p);
+    q->buffer = WINDOW(_create)(q->p+1);
 
     // copy coefficients (if not NULL)
     if (_h == NULL) {
@@ -117,10 +207,11 @@ EQRLS() EQRLS(_recreate)(EQRLS()      _q,
     }
 
     // completely destroy old equalizer object
+    liquid_eqrls_type type = _q->type;
     EQRLS(_destroy)(_q);
 
     // create new one and return
-    return EQRLS(_create)(_h,_p);
+    return EQRLS(_create_type)(type,_h,_p);
 }
 
 // destroy eqrls object
@@ -130,13 +221,19 @@ void EQRLS(_destroy)(EQRLS() _q)
     free(_q->h0);
     free(_q->w0);
     free(_q->w1);
+
     free(_q->P0);
-    free(_q->P1);
     free(_q->g);
-
     free(_q->xP0);
-    free(_q->gxl);
-    free(_q->gxlP0);
+
+    free(_q->c);
+    free(_q->cbar);
+    free(_q->a);
+    free(_q->b);
+
+    free(_q->S);
+    free(_q->u);
+    free(_q->v);
 
     // destroy window buffer
     WINDOW(_destroy)(_q->buffer);
@@ -148,33 +245,21 @@ void EQRLS(_destroy)(EQRLS() _q)
 // print eqrls object internals
 void EQRLS(_print)(EQRLS() _q)
 {
-    printf("equalizer (RLS):\n");
+    const char * type_str[3] = {"conventional", "fast transversal", "inverse QR"};
+    printf("equalizer (RLS, %s):\n", type_str[_q->type]);
     printf("    order:      %u\n", _q->p);
 
 #ifdef DEBUG
     unsigned int r,c,p=_q->p;
-    printf("P0:\n");
-    for (r=0; r<p; r++) {
-        for (c=0; c<p; c++) {
-            PRINTVAL(matrix_access(_q->P0,p,p,r,c));
-        }
-        printf("\n");
-    }
-
-    printf("P1:\n");
-    for (r=0; r<p; r++) {
-        for (c=0; c<p; c++) {
-            PRINTVAL(matrix_access(_q->P1,p,p,r,c));
-        }
-        printf("\n");
-    }
-
-    printf("gxl:\n");
-    for (r=0; r<p; r++) {
-        for (c=0; c<p; c++) {
-            PRINTVAL(matrix_access(_q->gxl,p,p,r,c));
+    T * M = _q->type == LIQUID_EQRLS_CONVENTIONAL ? _q->P0 : _q->S;
+    if (M != NULL) {
+        printf("%s:\n", _q->type == LIQUID_EQRLS_CONVENTIONAL ? "P0" : "S");
+        for (r=0; r<p; r++) {
+            for (c=0; c<p; c++) {
+                PRINTVAL(matrix_access(M,p,p,r,c));
+            }
+            printf("\n");
         }
-        printf("\n");
     }
 #endif
 }
@@ -182,25 +267,54 @@ void EQRLS(_print)(EQRLS() _q)
 // reset equalizer
 void EQRLS(_reset)(EQRLS() _q)
 {
-    // reset input counter
+    // reset input counters
     _q->n = 0;
+    _q->num_pushed = 0;
 
     unsigned int i, j;
-    // initialize...
-    for (i=0; i<_q->p; i++) {
-        for (j=0; j<_q->p; j++) {
-            if (i==j)   _q->P0[(_q->p)*i + j] = 1 / (_q->delta);
-            else        _q->P0[(_q->p)*i + j] = 0;
+    unsigned int p = _q->p;
+    switch (_q->type) {
+    case LIQUID_EQRLS_CONVENTIONAL:
+        // P = I / delta
+        for (i=0; i<p; i++) {
+            for (j=0; j<p; j++) {
+                if (i==j)   _q->P0[p*i + j] = 1 / (_q->delta);
+                else        _q->P0[p*i + j] = 0;
+            }
+        }
+        break;
+    case LIQUID_EQRLS_FTF:
+        // prewindowed, soft-constrained initialization
+        memset(_q->c, 0x00, p*sizeof(T));
+        memset(_q->a, 0x00, p*sizeof(T));
+        memset(_q->b, 0x00, p*sizeof(T));
+        _q->ef    = _q->delta;
+        _q->eb    = _q->delta * powf(_q->lambda, -(float)p);
+        _q->gamma = 1.0f;
+        break;
+    case LIQUID_EQRLS_IQR:
+        // S = I / sqrt(delta)
+        for (i=0; i<p; i++) {
+            for (j=0; j<p; j++)
+                _q->S[p*i + j] = (i==j) ? 1.0f / sqrtf(_q->delta) : 0.0f;
         }
+        break;
     }
 
     // copy default coefficients
-    memmove(_q->w0, _q->h0, (_q->p)*sizeof(T));
+    memmove(_q->w0, _q->h0, p*sizeof(T));
+    memmove(_q->w1, _q->h0, p*sizeof(T));
 
     // clear window object
     WINDOW(_clear)(_q->buffer);
 }
 
+// get algorithm type
+liquid_eqrls_type EQRLS(_get_type)(EQRLS() _q)
+{
+    return _q->type;
+}
+
 // get learning rate of equalizer
 float EQRLS(_get_bw)(EQRLS() _q)
 {
@@ -220,6 +334,10 @@ void EQRLS(_set_bw)(EQRLS() _q,
 
     // set internal value
     _q->lambda = _lambda;
+
+    // FTF initial backward energy depends on forgetting factor
+    if (_q->type == LIQUID_EQRLS_FTF && _q->n == 0)
+        _q->eb = _q->delta * powf(_q->lambda, -(float)(_q->p));
 }
 
 // push sample into equalizer internal buffer
@@ -230,6 +348,7 @@ void EQRLS(_push)(EQRLS() _q,
 {
     // push value into buffer
     WINDOW(_push)(_q->buffer, _x);
+    _q->num_pushed++;
 }
 
 // execute internal dot product
@@ -238,10 +357,10 @@ void EQRLS(_push)(EQRLS() _q,
 void EQRLS(_execute)(EQRLS() _q,
                      T *     _y)
 {
-    // compute vector dot product
+    // compute vector dot product on most recent p samples
     T * r;      // read buffer
     WINDOW(_read)(_q->buffer, &r);
-    DOTPROD(_run)(_q->w0, r, _q->p, _y);
+    DOTPROD(_run)(_q->w0, r+1, _q->p, _y);
 }
 
 // execute cycle of equalizer, filtering output
@@ -253,16 +372,45 @@ void EQRLS(_step)(EQRLS() _q,
                   T       _d,
                   T       _d_hat)
 {
-    unsigned int i,r,c;
-    unsigned int p=_q->p;
+    // FTF propagates its gain assuming the regressor shifted by exactly
+    // one sample since the previous step
+    if (_q->type == LIQUID_EQRLS_FTF && _q->num_pushed != 1) {
+        fprintf(stderr,"error: eqrls_%s_step(), fast transversal filter requires exactly one push per step (got %u)\n",
+                EXTENSION_FULL, _q->num_pushed);
+        exit(1);
+    }
+    _q->num_pushed = 0;
 
     // compute error (a priori)
     T alpha = _d - _d_hat;
 
-    // read buffer
+    // read buffer; x[0] is the sample that just left the regressor
     T * x;
     WINDOW(_read)(_q->buffer, &x);
 
+    switch (_q->type) {
+    case LIQUID_EQRLS_CONVENTIONAL: EQRLS(_step_conventional)(_q, x+1, alpha); break;
+    case LIQUID_EQRLS_FTF:          EQRLS(_step_ftf)(_q, x, alpha);            break;
+    case LIQUID_EQRLS_IQR:          EQRLS(_step_iqr)(_q, x+1, alpha);          break;
+    }
+
+    // copy new values
+    memmove(_q->w0, _q->w1, (_q->p)*sizeof(T));
+    _q->n++;
+}
+
+// conventional RLS update of inverse correlation matrix
+//  _q      :   equalizer object
+//  _x      :   regressor [size: p x 1]
+//  _alpha  :   a priori error
+void EQRLS(_step_conventional)(EQRLS() _q,
+                               T *     _x,
+                               T       _alpha)
+{
+    unsigned int i,r,c;
+    unsigned int p=_q->p;
+    T * x = _x;
+
     // compute gain vector
     for (c=0; c<p; c++) {
         _q->xP0[c] = 0;
@@ -276,20 +424,12 @@ void EQRLS(_step)(EQRLS() _q,
     for (i=0; i<p; i++)
         PRINTVAL(x[i]);
     printf("\n");
-
-    DEBUG_PRINTF_CFLOAT(stdout,"    d",0,_d);
-    DEBUG_PRINTF_CFLOAT(stdout,"_d_hat",0,_d_hat);
-    DEBUG_PRINTF_CFLOAT(stdout,"error",0,alpha);
-
-    printf("xP0: ");
-    for (c=0; c<p; c++)
-        PRINTVAL(_q->xP0[c]);
-    printf("\n");
+    DEBUG_PRINTF_CFLOAT(stdout,"error",0,_alpha);
 #endif
     // zeta = lambda + [x.']*[P0]*[conj(x)]
     _q->zeta = 0;
     for (c=0; c<p; c++) {
-        T sum = _q->xP0[c] * conj(x[c]);
+        T sum = _q->xP0[c] * EQRLS_CONJ(x[c]);
         _q->zeta += sum;
     }
     _q->zeta += _q->lambda;
@@ -301,59 +441,154 @@ void EQRLS(_step)(EQRLS() _q,
     for (r=0; r<p; r++) {
         _q->g[r] = 0;
         for (c=0; c<p; c++) {
-            T sum = matrix_access(_q->P0,p,p,r,c) * conj(x[c]);
+            T sum = matrix_access(_q->P0,p,p,r,c) * EQRLS_CONJ(x[c]);
             _q->g[r] += sum;
         }
         _q->g[r] /= _q->zeta;
     }
-#ifdef DEBUG
-    printf("g: ");
-    for (i=0; i<p; i++)
-        PRINTVAL(_q->g[i]);
-        //printf("%6.3f ", _q->g[i]);
-    printf("\n");
-#endif
 
-    // update recursion matrix
+    // update recursion matrix, P1 = (P0 - g [x.'] P0) / lambda; the
+    // outer product re-uses x.' P0 rather than forming g x.' first
+    float lambda_inv = 1.0f / _q->lambda;
     for (r=0; r<p; r++) {
-        for (c=0; c<p; c++) {
-            // gxl = [g] * [x.'] / lambda
-            matrix_access(_q->gxl,p,p,r,c) = _q->g[r] * x[c] / _q->lambda;
-        }
+        for (c=0; c<p; c++)
+            matrix_access(_q->P0,p,p,r,c) = (matrix_access(_q->P0,p,p,r,c) -
+                                             _q->g[r]*_q->xP0[c]) * lambda_inv;
     }
-    // multiply two [pxp] matrices: gxlP0 = gxl * P0
-    MATRIX(_mul)(_q->gxl,  p,p,
-                 _q->P0,   p,p,
-                 _q->gxlP0,p,p);
-
-    for (i=0; i<p*p; i++)
-        _q->P1[i] = _q->P0[i] / _q->lambda - _q->gxlP0[i];
 
     // update weighting vector
     for (i=0; i<p; i++)
-        _q->w1[i] = _q->w0[i] + alpha*(_q->g[i]);
+        _q->w1[i] = _q->w0[i] + _alpha*(_q->g[i]);
+}
 
-#ifdef DEBUG
-    printf("w0: \n");
-    for (i=0; i<p; i++) {
-        PRINTVAL(_q->w0[i]);
-        printf("\n");
-    }
-    printf("w1: \n");
-    for (i=0; i<p; i++) {
-        PRINTVAL(_q->w1[i]);
-        printf("\n");
-    EQRLS(_print)(_q);
+// stabilized fast transversal filter (FTF) update; the regressor
+// shifts by one sample per step, so the gain vector is propagated
+// with forward and backward linear predictors in O(p)
+//  _q      :   equalizer object
+//  _x      :   extended regressor, oldest first [size: (p+1) x 1]
+//  _alpha  :   a priori error
+void EQRLS(_step_ftf)(EQRLS() _q,
+                      T *     _x,
+                      T       _alpha)
+{
+    unsigned int i;
+    unsigned int p      = _q->p;
+    float        lambda = _q->lambda;
+    T *          x0     = _x;       // previous regressor
+    T *          x1     = _x + 1;   // current regressor
+
+    // forward prediction error (a priori) of newest sample
+    T eta = x1[p-1];
+    for (i=0; i<p; i++)
+        eta -= _q->a[i] * x0[i];
+
+    // extended gain, [c; 0] + [-a; 1] conj(eta) / (lambda ef)
+    T s = EQRLS_CONJ(eta) / (lambda * _q->ef);
+    for (i=0; i<p; i++)
+        _q->cbar[i] = _q->c[i] - _q->a[i]*s;
+    _q->cbar[p] = s;
+
+    // update forward predictor and energy
+    T ge = _q->gamma * eta;
+    for (i=0; i<p; i++)
+        _q->a[i] += _q->c[i] * ge;
+    _q->ef = lambda*_q->ef + _q->gamma * EQRLS_ABS2(eta);
+
+    // backward prediction error (a priori) of oldest sample, computed
+    // directly and propagated through the extended gain; the difference
+    // is fed back into the backward recursions to damp the otherwise
+    // unstable error mode
+    T psi_d = x0[0];
+    for (i=0; i<p; i++)
+        psi_d -= _q->b[i] * x1[i];
+    T psi_f = lambda * _q->eb * EQRLS_CONJ(_q->cbar[0]);
+    T psi1  = EQRLS_FTF_K1*psi_d + (1.0f - EQRLS_FTF_K1)*psi_f;
+    T psi2  = EQRLS_FTF_K2*psi_d + (1.0f - EQRLS_FTF_K2)*psi_f;
+
+    // gain for current regressor, c = cbar[1..p] + b cbar[0]
+    for (i=0; i<p; i++)
+        _q->c[i] = _q->cbar[i+1] + _q->b[i]*_q->cbar[0];
+
+    // conversion factor, computed directly from gain
+    T xc = 0;
+    for (i=0; i<p; i++)
+        xc += x1[i] * _q->c[i];
+    _q->gamma = 1.0f / (1.0f + crealf(xc));
+
+    // update backward predictor and energy
+    ge = _q->gamma * psi1;
+    for (i=0; i<p; i++)
+        _q->b[i] += _q->c[i] * ge;
+    _q->eb = lambda*_q->eb + _q->gamma * EQRLS_ABS2(psi2);
+
+    // rescue: if numerical error has pushed the conversion factor or
+    // energies out of range, restart the predictors from their initial
+    // (soft-constrained) state, keeping the weights and input history,
+    // and skip this weight update
+    if (!(_q->gamma > 0.0f && _q->gamma <= 1.0f && _q->ef > 0.0f && _q->eb > 0.0f)) {
+        memset(_q->c, 0x00, p*sizeof(T));
+        memset(_q->a, 0x00, p*sizeof(T));
+        memset(_q->b, 0x00, p*sizeof(T));
+        _q->ef    = _q->delta;
+        _q->eb    = _q->delta * powf(lambda, -(float)p);
+        _q->gamma = 1.0f;
+        return;
     }
-    //if (_q->n == 7)
-    //    exit(0);
 
-#endif
+    // update weighting vector
+    ge = _q->gamma * _alpha;
+    for (i=0; i<p; i++)
+        _q->w1[i] = _q->w0[i] + _q->c[i] * ge;
+}
 
-    // copy old values
-    memmove(_q->w0, _q->w1,   p*sizeof(T));
-    memmove(_q->P0, _q->P1, p*p*sizeof(T));
+// inverse QR-RLS update: Givens rotations annihilate the first row of
+// the pre-array [1, x.' S / sqrt(lambda); 0, S / sqrt(lambda)], giving
+// the updated Cholesky factor of P and the gain without forming P
+//  _q      :   equalizer object
+//  _x      :   regressor [size: p x 1]
+//  _alpha  :   a priori error
+void EQRLS(_step_iqr)(EQRLS() _q,
+                      T *     _x,
+                      T       _alpha)
+{
+    unsigned int i, j;
+    unsigned int p = _q->p;
+    T * S = _q->S;
+
+    // scale factor and first row, u = S.' x / sqrt(lambda)
+    float l = 1.0f / sqrtf(_q->lambda);
+    for (j=0; j<p; j++) {
+        T sum = 0;
+        for (i=j; i<p; i++)
+            sum += _x[i] * S[i*p + j];
+        _q->u[j] = sum * l;
+    }
+    for (i=0; i<p*p; i++)
+        S[i] *= l;
+
+    // rotate columns (0, j) for j = p..1 to zero the first row while
+    // keeping S lower triangular; column 0 of the lower block is v
+    float rho = 1.0f;
+    memset(_q->v, 0x00, p*sizeof(T));
+    for (j=p; j>0; j--) {
+        T     bj = _q->u[j-1];
+        float r  = sqrtf(rho*rho + EQRLS_ABS2(bj));
+        float c  = rho / r;
+        T     sn = EQRLS_CONJ(bj) / r;
+        for (i=j-1; i<p; i++) {
+            T v0 = _q->v[i];
+            T sj = S[i*p + j-1];
+            _q->v[i]       = c*v0 + sn*sj;
+            S[i*p + j-1]   = c*sj - EQRLS_CONJ(sn)*v0;
+        }
+        rho = r;
+    }
 
+    // gain: first column is [gamma^-1/2; c gamma^1/2], so the Kalman
+    // gain is v / rho
+    T ge = _alpha / rho;
+    for (i=0; i<p; i++)
+        _q->w1[i] = _q->w0[i] + _q->v[i] * ge;
 }
 
 // retrieve internal filter coefficients
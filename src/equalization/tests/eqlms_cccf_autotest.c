@@ -20,6 +20,9 @@
  * THE SOFTWARE.
  */
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "autotest/autotest.h"
 #include "liquid.h"
 
@@ -210,3 +213,152 @@ void autotest_eqlms_cccf_decisiondirected()
     msequence_destroy(ms);
 }
 
+
+// 
+// AUTOTEST: frequency-domain block execution matches time-domain
+//           filtering when weights are held fixed
+//
+void autotest_eqlms_cccf_block_fd_filter()
+{
+    unsigned int p = 24;        // equalizer order
+    unsigned int n = 5*p;       // number of samples
+
+    // random initial weights
+    float complex h[p];
+    unsigned int i;
+    for (i=0; i<p; i++)
+        h[i] = randnf() + _Complex_I*randnf();
+
+    // create equalizers with zero learning rate
+    eqlms_cccf q0 = eqlms_cccf_create(h, p);
+    eqlms_cccf q1 = eqlms_cccf_create(h, p);
+    eqlms_cccf_set_bw(q0, 0.0f);
+    eqlms_cccf_set_bw(q1, 0.0f);
+
+    float complex x [n];
+    float complex y0[n];
+    float complex y1[n];
+    for (i=0; i<n; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // run time-domain filter, frequency-domain block
+    for (i=0; i<n; i++) {
+        eqlms_cccf_push(q0, x[i]);
+        eqlms_cccf_execute(q0, &y0[i]);
+    }
+    eqlms_cccf_execute_block_fd(q1, x, NULL, n, y1);
+
+    for (i=0; i<n; i++) {
+        CONTEND_DELTA(crealf(y1[i]), crealf(y0[i]), 1e-3f);
+        CONTEND_DELTA(cimagf(y1[i]), cimagf(y0[i]), 1e-3f);
+    }
+
+    eqlms_cccf_destroy(q0);
+    eqlms_cccf_destroy(q1);
+}
+
+// train equalizer on QPSK through a static channel, either with block
+// LMS of a given size or in the frequency domain, returning the mean
+// squared error over the last quarter of the sequence
+float eqlms_cccf_test_block(unsigned int _p,
+                            unsigned int _block_size,
+                            int          _fd)
+{
+    unsigned int n = 64*_p;
+
+    // create sequence generator for repeatability
+    msequence ms = msequence_create_default(12);
+
+    // create channel filter
+    float complex h[5] = {0.2f, 1.0f, 0.4f+0.2f*_Complex_I, -0.2f+0.1f*_Complex_I, 0.1f};
+    firfilt_cccf fchannel = firfilt_cccf_create(h,5);
+
+    // create equalizer
+    eqlms_cccf eq = eqlms_cccf_create(NULL, _p);
+    eqlms_cccf_set_bw(eq, 0.5f);
+    eqlms_cccf_set_block_size(eq, _block_size);
+
+    // generate symbols, apply channel; desired response is delayed
+    float complex * sym = (float complex*) malloc(n*sizeof(float complex));
+    float complex * x   = (float complex*) malloc(n*sizeof(float complex));
+    float complex * d   = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y   = (float complex*) malloc(n*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<n; i++) {
+        sym[i] = ( msequence_advance(ms) ? M_SQRT1_2 : -M_SQRT1_2 ) +
+                 ( msequence_advance(ms) ? M_SQRT1_2 : -M_SQRT1_2 ) * _Complex_I;
+        firfilt_cccf_push(fchannel, sym[i]);
+        firfilt_cccf_execute(fchannel, &x[i]);
+        d[i] = i < _p/2 ? 0.0f : sym[i-_p/2];
+    }
+
+    // run equalizer
+    if (_fd) {
+        eqlms_cccf_execute_block_fd(eq, x, d, n, y);
+    } else {
+        for (i=0; i<n; i++) {
+            eqlms_cccf_push(eq, x[i]);
+            eqlms_cccf_execute(eq, &y[i]);
+            eqlms_cccf_step(eq, d[i], y[i]);
+        }
+    }
+
+    // compute error over last quarter
+    float mse = 0.0f;
+    for (i=3*n/4; i<n; i++)
+        mse += crealf( (y[i]-d[i])*conjf(y[i]-d[i]) );
+    mse /= (float)(n/4);
+
+    if (liquid_autotest_verbose)
+        printf("  p=%3u, block=%3u, fd=%d, mse=%12.4e\n", _p, _block_size, _fd, mse);
+
+    // clean up objects
+    firfilt_cccf_destroy(fchannel);
+    eqlms_cccf_destroy(eq);
+    msequence_destroy(ms);
+    free(sym);
+    free(x);
+    free(d);
+    free(y);
+    return mse;
+}
+
+void autotest_eqlms_cccf_block_td()  { CONTEND_LESS_THAN(eqlms_cccf_test_block( 32, 32, 0), 0.05f); }
+void autotest_eqlms_cccf_block_fd()  { CONTEND_LESS_THAN(eqlms_cccf_test_block( 32, 32, 1), 0.05f); }
+void autotest_eqlms_cccf_block_fd_long() { CONTEND_LESS_THAN(eqlms_cccf_test_block(256, 256, 1), 0.05f); }
+
+// 
+// AUTOTEST: block LMS applies weight updates only at block boundaries
+//
+void autotest_eqlms_cccf_block_size()
+{
+    unsigned int p = 8;
+    unsigned int block_size = 5;
+    eqlms_cccf q = eqlms_cccf_create(NULL, p);
+    eqlms_cccf_set_block_size(q, block_size);
+    CONTEND_EQUALITY(eqlms_cccf_get_block_size(q), block_size);
+
+    float complex w0[p];
+    float complex w1[p];
+    eqlms_cccf_get_weights(q, w0);
+
+    unsigned int i, j;
+    for (i=0; i<p + 2*block_size; i++) {
+        float complex y;
+        eqlms_cccf_push(q, randnf() + _Complex_I*randnf());
+        eqlms_cccf_execute(q, &y);
+        eqlms_cccf_step(q, 1.0f, y);
+
+        // weights can only change on last step of a block (steps are
+        // only counted once the buffer is full)
+        eqlms_cccf_get_weights(q, w1);
+        int changed = 0;
+        for (j=0; j<p; j++)
+            changed |= (w1[j] != w0[j]);
+        int boundary = (i+1 >= p) && ((i+1-p+1) % block_size) == 0;
+        CONTEND_EQUALITY(changed, boundary);
+        memmove(w0, w1, sizeof(w0));
+    }
+
+    eqlms_cccf_destroy(q);
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+//
+// AUTOTEST: frequency-domain block execution matches time-domain
+//           filtering when weights are held fixed
+//
+void autotest_eqlms_rrrf_block_fd_filter()
+{
+    unsigned int p = 24;        // equalizer order
+    unsigned int n = 5*p;       // number of samples
+
+    // random initial weights
+    float h[p];
+    unsigned int i;
+    for (i=0; i<p; i++)
+        h[i] = randnf();
+
+    // create equalizers with zero learning rate
+    eqlms_rrrf q0 = eqlms_rrrf_create(h, p);
+    eqlms_rrrf q1 = eqlms_rrrf_create(h, p);
+    eqlms_rrrf_set_bw(q0, 0.0f);
+    eqlms_rrrf_set_bw(q1, 0.0f);
+
+    float x [n];
+    float y0[n];
+    float y1[n];
+    for (i=0; i<n; i++)
+        x[i] = randnf();
+
+    // run time-domain filter, frequency-domain block
+    for (i=0; i<n; i++) {
+        eqlms_rrrf_push(q0, x[i]);
+        eqlms_rrrf_execute(q0, &y0[i]);
+    }
+    eqlms_rrrf_execute_block_fd(q1, x, NULL, n, y1);
+
+    for (i=0; i<n; i++)
+        CONTEND_DELTA(y1[i], y0[i], 1e-3f);
+
+    eqlms_rrrf_destroy(q0);
+    eqlms_rrrf_destroy(q1);
+}
+
+// train equalizer on BPSK through a static channel, either with block
+// LMS of a given size or in the frequency domain, returning the mean
+// squared error over the last quarter of the sequence
+float eqlms_rrrf_test_block(unsigned int _p,
+                            unsigned int _block_size,
+                            int          _fd)
+{
+    unsigned int n = 64*_p;
+
+    // create sequence generator for repeatability
+    msequence ms = msequence_create_default(12);
+
+    // create channel filter
+    float h[5] = {0.2f, 1.0f, 0.4f, -0.2f, 0.1f};
+    firfilt_rrrf fchannel = firfilt_rrrf_create(h,5);
+
+    // create equalizer
+    eqlms_rrrf eq = eqlms_rrrf_create(NULL, _p);
+    eqlms_rrrf_set_bw(eq, 0.5f);
+    eqlms_rrrf_set_block_size(eq, _block_size);
+
+    // generate symbols, apply channel; desired response is delayed
+    float * sym = (float*) malloc(n*sizeof(float));
+    float * x   = (float*) malloc(n*sizeof(float));
+    float * d   = (float*) malloc(n*sizeof(float));
+    float * y   = (float*) malloc(n*sizeof(float));
+    unsigned int i;
+    for (i=0; i<n; i++) {
+        sym[i] = msequence_advance(ms) ? 1.0f : -1.0f;
+        firfilt_rrrf_push(fchannel, sym[i]);
+        firfilt_rrrf_execute(fchannel, &x[i]);
+        d[i] = i < _p/2 ? 0.0f : sym[i-_p/2];
+    }
+
+    // run equalizer
+    if (_fd) {
+        eqlms_rrrf_execute_block_fd(eq, x, d, n, y);
+    } else {
+        for (i=0; i<n; i++) {
+            eqlms_rrrf_push(eq, x[i]);
+            eqlms_rrrf_execute(eq, &y[i]);
+            eqlms_rrrf_step(eq, d[i], y[i]);
+        }
+    }
+
+    // compute error over last quarter
+    float mse = 0.0f;
+    for (i=3*n/4; i<n; i++)
+        mse += (y[i]-d[i])*(y[i]-d[i]);
+    mse /= (float)(n/4);
+
+    if (liquid_autotest_verbose)
+        printf("  p=%3u, block=%3u, fd=%d, mse=%12.4e\n", _p, _block_size, _fd, mse);
+
+    // clean up objects
+    firfilt_rrrf_destroy(fchannel);
+    eqlms_rrrf_destroy(eq);
+    msequence_destroy(ms);
+    free(sym);
+    free(x);
+    free(d);
+    free(y);
+    return mse;
+}
+
+void autotest_eqlms_rrrf_block_td()  { CONTEND_LESS_THAN(eqlms_rrrf_test_block( 32, 32, 0), 0.05f); }
+void autotest_eqlms_rrrf_block_fd()  { CONTEND_LESS_THAN(eqlms_rrrf_test_block( 32, 32, 1), 0.05f); }
+void autotest_eqlms_rrrf_block_fd_long() { CONTEND_LESS_THAN(eqlms_rrrf_test_block(256, 256, 1), 0.05f); }
+
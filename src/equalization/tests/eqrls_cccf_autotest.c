@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// compare weights of fast algorithm against conventional RLS after
+// streaming random QPSK data through a fixed complex channel
+void eqrls_cccf_test_type(liquid_eqrls_type _type,
+                          unsigned int      _p,
+                          float             _lambda,
+                          unsigned int      _n,
+                          float             _tol)
+{
+    // channel filter
+    float complex h[3] = {1.0f, 0.4f+0.2f*_Complex_I, -0.2f+0.1f*_Complex_I};
+    firfilt_cccf f = firfilt_cccf_create(h,3);
+
+    // create equalizers
+    eqrls_cccf q0 = eqrls_cccf_create(NULL, _p);
+    eqrls_cccf q1 = eqrls_cccf_create_type(_type, NULL, _p);
+    eqrls_cccf_set_bw(q0, _lambda);
+    eqrls_cccf_set_bw(q1, _lambda);
+
+    // delay line for desired response
+    unsigned int delay = _p/2;
+    float complex buf[_p];
+    unsigned int i;
+    for (i=0; i<_p; i++)
+        buf[i] = 0.0f;
+
+    for (i=0; i<_n; i++) {
+        // generate symbol, filter through channel with noise
+        float complex s = ((rand() % 2) ? M_SQRT1_2 : -M_SQRT1_2) +
+                          ((rand() % 2) ? M_SQRT1_2 : -M_SQRT1_2)*_Complex_I;
+        float complex y;
+        firfilt_cccf_push(f, s);
+        firfilt_cccf_execute(f, &y);
+        y += 0.01f*(randnf() + randnf()*_Complex_I)*M_SQRT1_2;
+
+        // desired response is delayed symbol
+        float complex d = buf[delay];
+        memmove(buf+1, buf, (_p-1)*sizeof(float complex));
+        buf[0] = s;
+
+        float complex d0, d1;
+        eqrls_cccf_push(q0, y);
+        eqrls_cccf_push(q1, y);
+        eqrls_cccf_execute(q0, &d0);
+        eqrls_cccf_execute(q1, &d1);
+        eqrls_cccf_step(q0, d, d0);
+        eqrls_cccf_step(q1, d, d1);
+    }
+
+    // compare filter taps
+    float complex w0[_p];
+    float complex w1[_p];
+    eqrls_cccf_get_weights(q0, w0);
+    eqrls_cccf_get_weights(q1, w1);
+    for (i=0; i<_p; i++) {
+        CONTEND_DELTA(crealf(w1[i]), crealf(w0[i]), _tol);
+        CONTEND_DELTA(cimagf(w1[i]), cimagf(w0[i]), _tol);
+    }
+
+    // clean up objects
+    firfilt_cccf_destroy(f);
+    eqrls_cccf_destroy(q0);
+    eqrls_cccf_destroy(q1);
+}
+
+void autotest_eqrls_cccf_ftf()      { eqrls_cccf_test_type(LIQUID_EQRLS_FTF, 16, 0.99f,   4000, 1e-3f); }
+void autotest_eqrls_cccf_ftf_long() { eqrls_cccf_test_type(LIQUID_EQRLS_FTF, 64, 0.995f, 20000, 1e-3f); }
+void autotest_eqrls_cccf_iqr()      { eqrls_cccf_test_type(LIQUID_EQRLS_IQR, 16, 0.99f,   4000, 1e-3f); }
@@ -20,6 +20,9 @@
  * THE SOFTWARE.
  */
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "autotest/autotest.h"
 #include "liquid.h"
 
@@ -87,3 +90,158 @@ void autotest_eqrls_rrrf_01()
     eqrls_rrrf_destroy(eq);
 }
 
+
+// compare weights of fast algorithm against conventional RLS after
+// streaming random data through a fixed channel
+void eqrls_rrrf_test_type(liquid_eqrls_type _type,
+                          unsigned int      _p,
+                          float             _lambda,
+                          unsigned int      _n,
+                          float             _tol)
+{
+    // channel filter
+    float h[3] = {1.0f, 0.4f, -0.2f};
+    firfilt_rrrf f = firfilt_rrrf_create(h,3);
+
+    // create equalizers
+    eqrls_rrrf q0 = eqrls_rrrf_create(NULL, _p);
+    eqrls_rrrf q1 = eqrls_rrrf_create_type(_type, NULL, _p);
+    eqrls_rrrf_set_bw(q0, _lambda);
+    eqrls_rrrf_set_bw(q1, _lambda);
+    CONTEND_EQUALITY(eqrls_rrrf_get_type(q1), _type);
+
+    // delay line for desired response
+    unsigned int delay = _p/2;
+    float buf[_p];
+    unsigned int i;
+    for (i=0; i<_p; i++)
+        buf[i] = 0.0f;
+
+    for (i=0; i<_n; i++) {
+        // generate symbol, filter through channel with noise
+        float s = (rand() % 2) ? 1.0f : -1.0f;
+        float y;
+        firfilt_rrrf_push(f, s);
+        firfilt_rrrf_execute(f, &y);
+        y += 0.01f*randnf();
+
+        // desired response is delayed symbol
+        float d = buf[delay];
+        memmove(buf+1, buf, (_p-1)*sizeof(float));
+        buf[0] = s;
+
+        float d0, d1;
+        eqrls_rrrf_push(q0, y);
+        eqrls_rrrf_push(q1, y);
+        eqrls_rrrf_execute(q0, &d0);
+        eqrls_rrrf_execute(q1, &d1);
+        eqrls_rrrf_step(q0, d, d0);
+        eqrls_rrrf_step(q1, d, d1);
+    }
+
+    // compare filter taps
+    float w0[_p];
+    float w1[_p];
+    eqrls_rrrf_get_weights(q0, w0);
+    eqrls_rrrf_get_weights(q1, w1);
+    for (i=0; i<_p; i++)
+        CONTEND_DELTA(w1[i], w0[i], _tol);
+
+    // clean up objects
+    firfilt_rrrf_destroy(f);
+    eqrls_rrrf_destroy(q0);
+    eqrls_rrrf_destroy(q1);
+}
+
+void autotest_eqrls_rrrf_ftf()      { eqrls_rrrf_test_type(LIQUID_EQRLS_FTF, 16, 0.99f,   4000, 1e-3f); }
+void autotest_eqrls_rrrf_ftf_long() { eqrls_rrrf_test_type(LIQUID_EQRLS_FTF, 64, 0.995f, 20000, 1e-3f); }
+void autotest_eqrls_rrrf_iqr()      { eqrls_rrrf_test_type(LIQUID_EQRLS_IQR, 16, 0.99f,   4000, 1e-3f); }
+void autotest_eqrls_rrrf_iqr_long() { eqrls_rrrf_test_type(LIQUID_EQRLS_IQR, 64, 0.995f, 20000, 1e-3f); }
+
+// force the FTF rescue with a corrupt (NaN) input sample: the weights
+// must be kept while the sample is in the buffer, and adaptation must
+// resume once it has left
+void autotest_eqrls_rrrf_ftf_rescue()
+{
+    unsigned int p = 12;
+    unsigned int n = 3000;      // samples on either side of corrupt one
+    float h[3] = {1.0f, 0.4f, -0.2f};
+    firfilt_rrrf f = firfilt_rrrf_create(h,3);
+    eqrls_rrrf   q = eqrls_rrrf_create_type(LIQUID_EQRLS_FTF, NULL, p);
+
+    // delay line for desired response
+    unsigned int delay = p/2;
+    float buf[p];
+    float w0[p];    // weights before corrupt sample
+    float w1[p];    // weights after
+    unsigned int i;
+    for (i=0; i<p; i++)
+        buf[i] = 0.0f;
+
+    float e = 0.0f; // output error
+    for (i=0; i<2*n+p+1; i++) {
+        // generate symbol, filter through channel with noise
+        float s = (rand() % 2) ? 1.0f : -1.0f;
+        float y;
+        firfilt_rrrf_push(f, s);
+        firfilt_rrrf_execute(f, &y);
+        y += 0.01f*randnf();
+
+        // desired response is delayed symbol
+        float d = buf[delay];
+        memmove(buf+1, buf, (p-1)*sizeof(float));
+        buf[0] = s;
+
+        if (i == n) {
+            eqrls_rrrf_get_weights(q, w0);
+            y = NAN;
+        }
+
+        float d_hat;
+        eqrls_rrrf_push(q, y);
+        eqrls_rrrf_execute(q, &d_hat);
+        e = d - d_hat;
+        eqrls_rrrf_step(q, d, d_hat);
+
+        // corrupt sample is in buffer for p+1 steps; weights are kept
+        if (i == n+p) {
+            eqrls_rrrf_get_weights(q, w1);
+            CONTEND_SAME_DATA(w0, w1, p*sizeof(float));
+        }
+
+        // once it has left, existing history and weights are used
+        if (i == n+p+1)
+            CONTEND_DELTA(e, 0.0f, 0.1f);
+    }
+
+    // equalizer adapts as before
+    eqrls_rrrf_get_weights(q, w1);
+    for (i=0; i<p; i++)
+        CONTEND_DELTA(w1[i], w0[i], 2e-2f);
+    CONTEND_DELTA(e, 0.0f, 0.1f);
+
+    firfilt_rrrf_destroy(f);
+    eqrls_rrrf_destroy(q);
+}
+
+// delta channel recovered by each algorithm using train()
+void autotest_eqrls_rrrf_train_types()
+{
+    unsigned int p=6;
+    unsigned int n=64;
+    float * d = (float*) eqrls_rrrf_autotest_data_sequence;
+    float w[p];
+    unsigned int i, t;
+    liquid_eqrls_type types[2] = {LIQUID_EQRLS_FTF, LIQUID_EQRLS_IQR};
+    for (t=0; t<2; t++) {
+        eqrls_rrrf q = eqrls_rrrf_create_type(types[t], NULL, p);
+        for (i=0; i<p; i++)
+            w[i] = 0;
+        eqrls_rrrf_train(q, w, d, d, n);
+
+        CONTEND_DELTA(w[0], 1.0f, 1e-2f);
+        for (i=1; i<p; i++)
+            CONTEND_DELTA(w[i], 0.0f, 1e-2f);
+        eqrls_rrrf_destroy(q);
+    }
+}
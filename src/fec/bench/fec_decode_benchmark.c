@@ -42,32 +42,6 @@ void fec_decode_bench(
     unsigned int _n,
     void * _opts)
 {
-#if !LIBFEC_ENABLED
-    if ( _fs == LIQUID_FEC_CONV_V27    ||
-         _fs == LIQUID_FEC_CONV_V29    ||
-         _fs == LIQUID_FEC_CONV_V39    ||
-         _fs == LIQUID_FEC_CONV_V615   ||
-         _fs == LIQUID_FEC_CONV_V27P23 ||
-         _fs == LIQUID_FEC_CONV_V27P34 ||
-         _fs == LIQUID_FEC_CONV_V27P45 ||
-         _fs == LIQUID_FEC_CONV_V27P56 ||
-         _fs == LIQUID_FEC_CONV_V27P67 ||
-         _fs == LIQUID_FEC_CONV_V27P78 ||
-         _fs == LIQUID_FEC_CONV_V29P23 ||
-         _fs == LIQUID_FEC_CONV_V29P34 ||
-         _fs == LIQUID_FEC_CONV_V29P45 ||
-         _fs == LIQUID_FEC_CONV_V29P56 ||
-         _fs == LIQUID_FEC_CONV_V29P67 ||
-         _fs == LIQUID_FEC_CONV_V29P78 ||
-         _fs == LIQUID_FEC_RS_M8)
-    {
-        fprintf(stderr,"warning: convolutional, Reed-Solomon codes unavailable (install libfec)\n");
-        getrusage(RUSAGE_SELF, _start);
-        memmove((void*)_finish,(void*)_start,sizeof(struct rusage));
-        return;
-    }
-#endif
-
     // normalize number of iterations
     *_num_iterations /= _n;
 
@@ -105,6 +79,12 @@ void fec_decode_bench(
     case LIQUID_FEC_RS_M8:
         *_num_iterations *= 1;
         break;
+    case LIQUID_FEC_LDPC_R12:
+    case LIQUID_FEC_LDPC_R23:
+    case LIQUID_FEC_LDPC_R34:
+    case LIQUID_FEC_LDPC_R56:
+        *_num_iterations /= 5;
+        break;
     default:;
     }
     if (*_num_iterations < 1) *_num_iterations = 1;
@@ -180,3 +160,8 @@ void benchmark_fec_dec_conv29p78_n64    FEC_DECODE_BENCH_API(LIQUID_FEC_CONV_V29
 
 void benchmark_fec_dec_rs8_n64          FEC_DECODE_BENCH_API(LIQUID_FEC_RS_M8,      64,  NULL)
 
+void benchmark_fec_dec_ldpc12_n64       FEC_DECODE_BENCH_API(LIQUID_FEC_LDPC_R12,   64,  NULL)
+void benchmark_fec_dec_ldpc23_n64       FEC_DECODE_BENCH_API(LIQUID_FEC_LDPC_R23,   64,  NULL)
+void benchmark_fec_dec_ldpc34_n64       FEC_DECODE_BENCH_API(LIQUID_FEC_LDPC_R34,   64,  NULL)
+void benchmark_fec_dec_ldpc56_n64       FEC_DECODE_BENCH_API(LIQUID_FEC_LDPC_R56,   64,  NULL)
+
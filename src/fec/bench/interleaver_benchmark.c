@@ -31,6 +31,12 @@
     unsigned long int *_num_iterations) \
 { interleaver_bench(_start, _finish, _num_iterations, N); }
 
+#define INTERLEAVER_SOFT_BENCH_API(N)   \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ interleaver_soft_bench(_start, _finish, _num_iterations, N); }
+
 // Helper function to keep code base small
 void interleaver_bench(struct rusage *_start,
                        struct rusage *_finish,
@@ -67,6 +73,41 @@ void interleaver_bench(struct rusage *_start,
     interleaver_destroy(q);
 }
 
+// interleave soft bits of 16 packets at a time
+void interleaver_soft_bench(struct rusage *_start,
+                            struct rusage *_finish,
+                            unsigned long int *_num_iterations,
+                            unsigned int _n)
+{
+    // scale number of iterations by block size
+    *_num_iterations = *_num_iterations * 8 / _n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    unsigned int num_packets = 16;
+    interleaver q = interleaver_create(_n);
+    interleaver_set_depth(q, 4);
+
+    unsigned char * x = (unsigned char*) malloc(8*_n*num_packets);
+    unsigned char * y = (unsigned char*) malloc(8*_n*num_packets);
+
+    unsigned long int i;
+    for (i=0; i<8*_n*num_packets; i++)
+        x[i] = rand() & 0xff;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        interleaver_encode_soft_block(q, x, y, num_packets);
+        interleaver_decode_soft_block(q, y, x, num_packets);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 2*num_packets;
+
+    interleaver_destroy(q);
+    free(x);
+    free(y);
+}
+
 void benchmark_interleaver_8    INTERLEAVER_BENCH_API(8     )
 void benchmark_interleaver_16   INTERLEAVER_BENCH_API(16    )
 void benchmark_interleaver_32   INTERLEAVER_BENCH_API(32    )
@@ -76,3 +117,7 @@ void benchmark_interleaver_256  INTERLEAVER_BENCH_API(256   )
 void benchmark_interleaver_512  INTERLEAVER_BENCH_API(512   )
 void benchmark_interleaver_1024 INTERLEAVER_BENCH_API(1024  )
 
+void benchmark_interleaver_soft_64   INTERLEAVER_SOFT_BENCH_API(64  )
+void benchmark_interleaver_soft_256  INTERLEAVER_SOFT_BENCH_API(256 )
+void benchmark_interleaver_soft_1024 INTERLEAVER_SOFT_BENCH_API(1024)
+
@@ -30,6 +30,26 @@
 
 #include "liquid.internal.h"
 
+#if LIQUID_SIMD_DISPATCH
+#include <immintrin.h>  // PCLMULQDQ (selected at run time)
+#endif
+
+// messages at least this long are folded with carry-less multiplication
+// (when available) before the table-driven update
+#define CRC_FOLD_MIN_LENGTH (256)
+
+// internal methods
+unsigned int crc_update_gentab(const unsigned int (*_tab)[256],
+                               unsigned int          _crc,
+                               unsigned char *       _msg,
+                               unsigned int          _n);
+#if LIQUID_SIMD_DISPATCH
+void crc_fold_clmul(const unsigned long long int * _k,
+                    unsigned int                   _crc,
+                    unsigned char *                _msg,
+                    unsigned int                   _n,
+                    unsigned char *                _rem);
+#endif
 
 // object-independent methods
 
@@ -108,19 +128,81 @@ unsigned int crc_get_length(crc_scheme _scheme)
 unsigned int crc_generate_key(crc_scheme      _scheme,
                               unsigned char * _msg,
                               unsigned int    _n)
+{
+    unsigned int state = crc_init(_scheme);
+    state = crc_update(_scheme, state, _msg, _n);
+    return crc_finalize(_scheme, state);
+}
+
+// initialize running error-detection state
+//  _scheme     :   error-detection scheme
+unsigned int crc_init(crc_scheme _scheme)
 {
     switch (_scheme) {
     case LIQUID_CRC_UNKNOWN:
-        fprintf(stderr,"error: crc_generate_key(), cannot generate key with CRC type \"UNKNOWN\"\n");
+        fprintf(stderr,"error: crc_init(), cannot generate key with CRC type \"UNKNOWN\"\n");
         exit(-1);
     case LIQUID_CRC_NONE:      return 0;
-    case LIQUID_CRC_CHECKSUM:  return checksum_generate_key(_msg, _n);
-    case LIQUID_CRC_8:         return crc8_generate_key(_msg, _n);
-    case LIQUID_CRC_16:        return crc16_generate_key(_msg, _n);
-    case LIQUID_CRC_24:        return crc24_generate_key(_msg, _n);
-    case LIQUID_CRC_32:        return crc32_generate_key(_msg, _n);
+    case LIQUID_CRC_CHECKSUM:  return 0;
+    case LIQUID_CRC_8:
+    case LIQUID_CRC_16:
+    case LIQUID_CRC_24:
+    case LIQUID_CRC_32:        return 0xffffffff;
     default:
-        fprintf(stderr,"error: crc_generate_key(), unknown/unsupported scheme: %d\n", _scheme);
+        fprintf(stderr,"error: crc_init(), unknown/unsupported scheme: %d\n", _scheme);
+        exit(1);
+    }
+
+    return 0;
+}
+
+// update running error-detection state with a portion of the message;
+// the key is independent of how the message is split
+//  _scheme     :   error-detection scheme
+//  _state      :   running state from crc_init() or crc_update()
+//  _msg        :   input data message portion, [size: _n x 1]
+//  _n          :   input data message portion size
+unsigned int crc_update(crc_scheme      _scheme,
+                        unsigned int    _state,
+                        unsigned char * _msg,
+                        unsigned int    _n)
+{
+    switch (_scheme) {
+    case LIQUID_CRC_UNKNOWN:
+        fprintf(stderr,"error: crc_update(), cannot generate key with CRC type \"UNKNOWN\"\n");
+        exit(-1);
+    case LIQUID_CRC_NONE:      return 0;
+    case LIQUID_CRC_CHECKSUM:  return _state + checksum_sum(_msg, _n);
+    case LIQUID_CRC_8:         return crc_update_fold(_state, _msg, _n, liquid_crc8_gentab,  liquid_crc8_fold);
+    case LIQUID_CRC_16:        return crc_update_fold(_state, _msg, _n, liquid_crc16_gentab, liquid_crc16_fold);
+    case LIQUID_CRC_24:        return crc_update_fold(_state, _msg, _n, liquid_crc24_gentab, liquid_crc24_fold);
+    case LIQUID_CRC_32:        return crc_update_fold(_state, _msg, _n, liquid_crc32_gentab, liquid_crc32_fold);
+    default:
+        fprintf(stderr,"error: crc_update(), unknown/unsupported scheme: %d\n", _scheme);
+        exit(1);
+    }
+
+    return 0;
+}
+
+// finalize running error-detection state, returning key
+//  _scheme     :   error-detection scheme
+//  _state      :   running state from crc_init() or crc_update()
+unsigned int crc_finalize(crc_scheme   _scheme,
+                          unsigned int _state)
+{
+    switch (_scheme) {
+    case LIQUID_CRC_UNKNOWN:
+        fprintf(stderr,"error: crc_finalize(), cannot generate key with CRC type \"UNKNOWN\"\n");
+        exit(-1);
+    case LIQUID_CRC_NONE:      return 0;
+    case LIQUID_CRC_CHECKSUM:  return (~_state + 1) & 0xff;
+    case LIQUID_CRC_8:         return (~_state) & 0xff;
+    case LIQUID_CRC_16:        return (~_state) & 0xffff;
+    case LIQUID_CRC_24:        return (~_state) & 0xffffff;
+    case LIQUID_CRC_32:        return (~_state) & 0xffffffff;
+    default:
+        fprintf(stderr,"error: crc_finalize(), unknown/unsupported scheme: %d\n", _scheme);
         exit(1);
     }
 
@@ -224,140 +306,170 @@ unsigned int crc_sizeof_key(crc_scheme _scheme)
 //  _n          :   input data message size
 unsigned int checksum_generate_key(unsigned char *_data,
                                    unsigned int _n)
+{
+    return crc_finalize(LIQUID_CRC_CHECKSUM, checksum_sum(_data, _n));
+}
+
+// sum of message bytes (running checksum state)
+unsigned int checksum_sum(unsigned char * _data,
+                          unsigned int    _n)
 {
     unsigned int i, sum=0;
     for (i=0; i<_n; i++)
         sum += (unsigned int) (_data[i]);
-    //sum &= 0x00ff;
-
-    // mask and convert to 2's complement
-    unsigned char key = ~(sum&0x00ff) + 1;
-
-    return key;
+    return sum;
 }
 
 
-// 
-// CRC-8
 //
-
-// generate 8-bit cyclic redundancy check key.
+// cyclic redundancy check
 //
-// slow method, operates one bit at a time
-// algorithm from: http://www.hackersdelight.org/crc.pdf
+// All keys use the reflected (lsb-first) form of the polynomial with a
+// 32-bit shift register initialized to all ones; the key is the lower
+// 8, 16, 24, or 32 bits of the inverted register.  The register is
+// advanced eight bytes at a time through the slice-by-8 tables (the
+// j-th table holds the register contribution of a byte followed by j
+// zero bytes).  Long messages are first folded to 16 bytes using
+// carry-less multiplication (PCLMULQDQ) when available at run time.
 //
+
+// generate 8-bit cyclic redundancy check key.
 //  _msg    :   input data message [size: _n x 1]
 //  _n      :   input data message size
 unsigned int crc8_generate_key(unsigned char *_msg,
                                unsigned int _n)
 {
-    unsigned int i, j, b, mask, key8=~0;
-    unsigned int poly = liquid_reverse_byte_gentab[CRC8_POLY];
-    for (i=0; i<_n; i++) {
-        b = _msg[i];
-        key8 ^= b;
-        for (j=0; j<8; j++) {
-            mask = -(key8 & 1);
-            key8 = (key8>>1) ^ (poly & mask);
-        }
-    }
-    return (~key8) & 0xff;
+    return crc_generate_key(LIQUID_CRC_8, _msg, _n);
 }
 
-
-// 
-// CRC-16
-//
-
 // generate 16-bit cyclic redundancy check key.
-//
-// slow method, operates one bit at a time
-// algorithm from: http://www.hackersdelight.org/crc.pdf
-//
 //  _msg    :   input data message [size: _n x 1]
 //  _n      :   input data message size
 unsigned int crc16_generate_key(unsigned char *_msg,
                                 unsigned int _n)
 {
-    unsigned int i, j, b, mask, key16=~0;
-    unsigned int poly = liquid_reverse_uint16(CRC16_POLY);
-    for (i=0; i<_n; i++) {
-        b = _msg[i];
-        key16 ^= b;
-        for (j=0; j<8; j++) {
-            mask = -(key16 & 1);
-            key16 = (key16>>1) ^ (poly & mask);
-        }
-    }
-    return (~key16) & 0xffff;
+    return crc_generate_key(LIQUID_CRC_16, _msg, _n);
 }
 
-
-// 
-// CRC-24
-//
-
 // generate 24-bit cyclic redundancy check key.
-//
-// slow method, operates one bit at a time
-// algorithm from: http://www.hackersdelight.org/crc.pdf
-//
 //  _msg    :   input data message [size: _n x 1]
 //  _n      :   input data message size
 unsigned int crc24_generate_key(unsigned char *_msg,
                                 unsigned int _n)
 {
-    unsigned int i, j, b, mask, key24=~0;
-    unsigned int poly = liquid_reverse_uint24(CRC24_POLY);
-    for (i=0; i<_n; i++) {
-        b = _msg[i];
-        key24 ^= b;
-        for (j=0; j<8; j++) {
-            mask = -(key24 & 1);
-            key24 = (key24>>1) ^ (poly & mask);
-        }
-    }
-    return (~key24) & 0xffffff;
+    return crc_generate_key(LIQUID_CRC_24, _msg, _n);
 }
 
-
-// 
-// CRC-32
-//
-
 // generate 32-bit cyclic redundancy check key.
-//
-// slow method, operates one bit at a time
-// algorithm from: http://www.hackersdelight.org/crc.pdf
-//
 //  _msg    :   input data message [size: _n x 1]
 //  _n      :   input data message size
 unsigned int crc32_generate_key(unsigned char *_msg,
                                 unsigned int _n)
 {
-    unsigned int i, j, b, mask, key32=~0;
-    unsigned int poly = liquid_reverse_uint32(CRC32_POLY);
-    for (i=0; i<_n; i++) {
-        b = _msg[i];
-        key32 ^= b;
-        for (j=0; j<8; j++) {
-            mask = -(key32 & 1);
-            key32 = (key32>>1) ^ (poly & mask);
-        }
+    return crc_generate_key(LIQUID_CRC_32, _msg, _n);
+}
+
+// update cyclic redundancy check register, folding long messages
+//  _crc    :   shift register state
+//  _msg    :   input data message [size: _n x 1]
+//  _n      :   input data message size
+//  _tab    :   slice-by-8 tables [size: 8 x 256]
+//  _k      :   folding constants [size: 4 x 1]
+unsigned int crc_update_fold(unsigned int                   _crc,
+                             unsigned char *                _msg,
+                             unsigned int                   _n,
+                             const unsigned int (*_tab)[256],
+                             const unsigned long long int * _k)
+{
+#if LIQUID_SIMD_DISPATCH
+    // the feature query is cheap next to a message of this length and
+    // keeps the method free of shared state
+    if (_n >= CRC_FOLD_MIN_LENGTH && liquid_simd_has_pclmul()) {
+        // fold all but the tail into 16 bytes whose register contribution
+        // (starting from zero) is the same as that of the folded portion
+        unsigned char rem[16];
+        unsigned int nfold = _n & ~15;
+        crc_fold_clmul(_k, _crc, _msg, nfold, rem);
+        _crc = crc_update_gentab(_tab, 0, rem, 16);
+        return crc_update_gentab(_tab, _crc, &_msg[nfold], _n - nfold);
+    }
+#endif
+    return crc_update_gentab(_tab, _crc, _msg, _n);
+}
+
+//
+// internal methods
+//
+
+// slice-by-8 register update
+unsigned int crc_update_gentab(const unsigned int (*_tab)[256],
+                               unsigned int          _crc,
+                               unsigned char *       _msg,
+                               unsigned int          _n)
+{
+    unsigned int i = 0;
+    for (; i+8<=_n; i+=8) {
+        const unsigned char * p = &_msg[i];
+        unsigned int w0 = _crc ^ ( (unsigned int)p[0]        |
+                                  ((unsigned int)p[1] <<  8) |
+                                  ((unsigned int)p[2] << 16) |
+                                  ((unsigned int)p[3] << 24));
+        _crc = _tab[7][ w0        & 0xff] ^
+               _tab[6][(w0 >>  8) & 0xff] ^
+               _tab[5][(w0 >> 16) & 0xff] ^
+               _tab[4][(w0 >> 24)       ] ^
+               _tab[3][p[4]] ^
+               _tab[2][p[5]] ^
+               _tab[1][p[6]] ^
+               _tab[0][p[7]];
     }
-    return (~key32) & 0xffffffff;
+    for (; i<_n; i++)
+        _crc = (_crc >> 8) ^ _tab[0][(_crc ^ _msg[i]) & 0xff];
+    return _crc;
 }
 
-#if 0
-void crc32_generate_key(unsigned char *_msg,
-                        unsigned int _n,
-                        unsigned char *_key)
+#if LIQUID_SIMD_DISPATCH
+// fold 128-bit lane _x forward by distance of constants _k
+__attribute__((target("pclmul"), always_inline))
+static inline __m128i crc_fold_lane(__m128i _x, __m128i _k)
 {
-    unsigned int key32 = crc32_generate_key32(_msg,_n);
-    _key[0] = (key32 & 0xFF000000) >> 24;
-    _key[1] = (key32 & 0x00FF0000) >> 16;
-    _key[2] = (key32 & 0x0000FF00) >> 8;
-    _key[3] = (key32 & 0x000000FF);
+    return _mm_xor_si128(_mm_clmulepi64_si128(_x, _k, 0x00),
+                         _mm_clmulepi64_si128(_x, _k, 0x11));
 }
-#endif
 
+// fold message (length multiple of 16, at least 64) into 16 bytes _rem
+// whose register contribution equals that of _crc followed by message
+__attribute__((target("pclmul")))
+void crc_fold_clmul(const unsigned long long int * _k,
+                    unsigned int                   _crc,
+                    unsigned char *                _msg,
+                    unsigned int                   _n,
+                    unsigned char *                _rem)
+{
+    const __m128i * p = (const __m128i*) _msg;
+    __m128i k4 = _mm_set_epi64x(_k[1], _k[0]);  // fold by four lanes
+    __m128i k1 = _mm_set_epi64x(_k[3], _k[2]);  // fold by one lane
+
+    // register state enters as the first four message bytes
+    __m128i x0 = _mm_xor_si128(_mm_loadu_si128(p+0), _mm_cvtsi32_si128(_crc));
+    __m128i x1 = _mm_loadu_si128(p+1);
+    __m128i x2 = _mm_loadu_si128(p+2);
+    __m128i x3 = _mm_loadu_si128(p+3);
+    unsigned int i;
+    for (i=4; i+4<=_n/16; i+=4) {
+        x0 = _mm_xor_si128(crc_fold_lane(x0, k4), _mm_loadu_si128(p+i+0));
+        x1 = _mm_xor_si128(crc_fold_lane(x1, k4), _mm_loadu_si128(p+i+1));
+        x2 = _mm_xor_si128(crc_fold_lane(x2, k4), _mm_loadu_si128(p+i+2));
+        x3 = _mm_xor_si128(crc_fold_lane(x3, k4), _mm_loadu_si128(p+i+3));
+    }
+
+    // reduce four lanes to one, then fold in remaining lanes
+    x1 = _mm_xor_si128(crc_fold_lane(x0, k1), x1);
+    x2 = _mm_xor_si128(crc_fold_lane(x1, k1), x2);
+    x3 = _mm_xor_si128(crc_fold_lane(x2, k1), x3);
+    for (; i<_n/16; i++)
+        x3 = _mm_xor_si128(crc_fold_lane(x3, k1), _mm_loadu_si128(p+i));
+
+    _mm_storeu_si128((__m128i*)_rem, x3);
+}
+#endif
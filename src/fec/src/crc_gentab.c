@@ -0,0 +1,1459 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// cyclic redundancy check generated tables (see sandbox/crc_gentab.c)
+//
+
+// slice-by-8 tables
+const unsigned int liquid_crc8_gentab[8][256] = {
+  {
+    0x00000000, 0x00000091, 0x000000e3, 0x00000072, 0x00000007, 0x00000096, 
+    0x000000e4, 0x00000075, 0x0000000e, 0x0000009f, 0x000000ed, 0x0000007c, 
+    0x00000009, 0x00000098, 0x000000ea, 0x0000007b, 0x0000001c, 0x0000008d, 
+    0x000000ff, 0x0000006e, 0x0000001b, 0x0000008a, 0x000000f8, 0x00000069, 
+    0x00000012, 0x00000083, 0x000000f1, 0x00000060, 0x00000015, 0x00000084, 
+    0x000000f6, 0x00000067, 0x00000038, 0x000000a9, 0x000000db, 0x0000004a, 
+    0x0000003f, 0x000000ae, 0x000000dc, 0x0000004d, 0x00000036, 0x000000a7, 
+    0x000000d5, 0x00000044, 0x00000031, 0x000000a0, 0x000000d2, 0x00000043, 
+    0x00000024, 0x000000b5, 0x000000c7, 0x00000056, 0x00000023, 0x000000b2, 
+    0x000000c0, 0x00000051, 0x0000002a, 0x000000bb, 0x000000c9, 0x00000058, 
+    0x0000002d, 0x000000bc, 0x000000ce, 0x0000005f, 0x00000070, 0x000000e1, 
+    0x00000093, 0x00000002, 0x00000077, 0x000000e6, 0x00000094, 0x00000005, 
+    0x0000007e, 0x000000ef, 0x0000009d, 0x0000000c, 0x00000079, 0x000000e8, 
+    0x0000009a, 0x0000000b, 0x0000006c, 0x000000fd, 0x0000008f, 0x0000001e, 
+    0x0000006b, 0x000000fa, 0x00000088, 0x00000019, 0x00000062, 0x000000f3, 
+    0x00000081, 0x00000010, 0x00000065, 0x000000f4, 0x00000086, 0x00000017, 
+    0x00000048, 0x000000d9, 0x000000ab, 0x0000003a, 0x0000004f, 0x000000de, 
+    0x000000ac, 0x0000003d, 0x00000046, 0x000000d7, 0x000000a5, 0x00000034, 
+    0x00000041, 0x000000d0, 0x000000a2, 0x00000033, 0x00000054, 0x000000c5, 
+    0x000000b7, 0x00000026, 0x00000053, 0x000000c2, 0x000000b0, 0x00000021, 
+    0x0000005a, 0x000000cb, 0x000000b9, 0x00000028, 0x0000005d, 0x000000cc, 
+    0x000000be, 0x0000002f, 0x000000e0, 0x00000071, 0x00000003, 0x00000092, 
+    0x000000e7, 0x00000076, 0x00000004, 0x00000095, 0x000000ee, 0x0000007f, 
+    0x0000000d, 0x0000009c, 0x000000e9, 0x00000078, 0x0000000a, 0x0000009b, 
+    0x000000fc, 0x0000006d, 0x0000001f, 0x0000008e, 0x000000fb, 0x0000006a, 
+    0x00000018, 0x00000089, 0x000000f2, 0x00000063, 0x00000011, 0x00000080, 
+    0x000000f5, 0x00000064, 0x00000016, 0x00000087, 0x000000d8, 0x00000049, 
+    0x0000003b, 0x000000aa, 0x000000df, 0x0000004e, 0x0000003c, 0x000000ad, 
+    0x000000d6, 0x00000047, 0x00000035, 0x000000a4, 0x000000d1, 0x00000040, 
+    0x00000032, 0x000000a3, 0x000000c4, 0x00000055, 0x00000027, 0x000000b6, 
+    0x000000c3, 0x00000052, 0x00000020, 0x000000b1, 0x000000ca, 0x0000005b, 
+    0x00000029, 0x000000b8, 0x000000cd, 0x0000005c, 0x0000002e, 0x000000bf, 
+    0x00000090, 0x00000001, 0x00000073, 0x000000e2, 0x00000097, 0x00000006, 
+    0x00000074, 0x000000e5, 0x0000009e, 0x0000000f, 0x0000007d, 0x000000ec, 
+    0x00000099, 0x00000008, 0x0000007a, 0x000000eb, 0x0000008c, 0x0000001d, 
+    0x0000006f, 0x000000fe, 0x0000008b, 0x0000001a, 0x00000068, 0x000000f9, 
+    0x00000082, 0x00000013, 0x00000061, 0x000000f0, 0x00000085, 0x00000014, 
+    0x00000066, 0x000000f7, 0x000000a8, 0x00000039, 0x0000004b, 0x000000da, 
+    0x000000af, 0x0000003e, 0x0000004c, 0x000000dd, 0x000000a6, 0x00000037, 
+    0x00000045, 0x000000d4, 0x000000a1, 0x00000030, 0x00000042, 0x000000d3, 
+    0x000000b4, 0x00000025, 0x00000057, 0x000000c6, 0x000000b3, 0x00000022, 
+    0x00000050, 0x000000c1, 0x000000ba, 0x0000002b, 0x00000059, 0x000000c8, 
+    0x000000bd, 0x0000002c, 0x0000005e, 0x000000cf},
+  {
+    0x00000000, 0x0000006d, 0x000000da, 0x000000b7, 0x00000075, 0x00000018, 
+    0x000000af, 0x000000c2, 0x000000ea, 0x00000087, 0x00000030, 0x0000005d, 
+    0x0000009f, 0x000000f2, 0x00000045, 0x00000028, 0x00000015, 0x00000078, 
+    0x000000cf, 0x000000a2, 0x00000060, 0x0000000d, 0x000000ba, 0x000000d7, 
+    0x000000ff, 0x00000092, 0x00000025, 0x00000048, 0x0000008a, 0x000000e7, 
+    0x00000050, 0x0000003d, 0x0000002a, 0x00000047, 0x000000f0, 0x0000009d, 
+    0x0000005f, 0x00000032, 0x00000085, 0x000000e8, 0x000000c0, 0x000000ad, 
+    0x0000001a, 0x00000077, 0x000000b5, 0x000000d8, 0x0000006f, 0x00000002, 
+    0x0000003f, 0x00000052, 0x000000e5, 0x00000088, 0x0000004a, 0x00000027, 
+    0x00000090, 0x000000fd, 0x000000d5, 0x000000b8, 0x0000000f, 0x00000062, 
+    0x000000a0, 0x000000cd, 0x0000007a, 0x00000017, 0x00000054, 0x00000039, 
+    0x0000008e, 0x000000e3, 0x00000021, 0x0000004c, 0x000000fb, 0x00000096, 
+    0x000000be, 0x000000d3, 0x00000064, 0x00000009, 0x000000cb, 0x000000a6, 
+    0x00000011, 0x0000007c, 0x00000041, 0x0000002c, 0x0000009b, 0x000000f6, 
+    0x00000034, 0x00000059, 0x000000ee, 0x00000083, 0x000000ab, 0x000000c6, 
+    0x00000071, 0x0000001c, 0x000000de, 0x000000b3, 0x00000004, 0x00000069, 
+    0x0000007e, 0x00000013, 0x000000a4, 0x000000c9, 0x0000000b, 0x00000066, 
+    0x000000d1, 0x000000bc, 0x00000094, 0x000000f9, 0x0000004e, 0x00000023, 
+    0x000000e1, 0x0000008c, 0x0000003b, 0x00000056, 0x0000006b, 0x00000006, 
+    0x000000b1, 0x000000dc, 0x0000001e, 0x00000073, 0x000000c4, 0x000000a9, 
+    0x00000081, 0x000000ec, 0x0000005b, 0x00000036, 0x000000f4, 0x00000099, 
+    0x0000002e, 0x00000043, 0x000000a8, 0x000000c5, 0x00000072, 0x0000001f, 
+    0x000000dd, 0x000000b0, 0x00000007, 0x0000006a, 0x00000042, 0x0000002f, 
+    0x00000098, 0x000000f5, 0x00000037, 0x0000005a, 0x000000ed, 0x00000080, 
+    0x000000bd, 0x000000d0, 0x00000067, 0x0000000a, 0x000000c8, 0x000000a5, 
+    0x00000012, 0x0000007f, 0x00000057, 0x0000003a, 0x0000008d, 0x000000e0, 
+    0x00000022, 0x0000004f, 0x000000f8, 0x00000095, 0x00000082, 0x000000ef, 
+    0x00000058, 0x00000035, 0x000000f7, 0x0000009a, 0x0000002d, 0x00000040, 
+    0x00000068, 0x00000005, 0x000000b2, 0x000000df, 0x0000001d, 0x00000070, 
+    0x000000c7, 0x000000aa, 0x00000097, 0x000000fa, 0x0000004d, 0x00000020, 
+    0x000000e2, 0x0000008f, 0x00000038, 0x00000055, 0x0000007d, 0x00000010, 
+    0x000000a7, 0x000000ca, 0x00000008, 0x00000065, 0x000000d2, 0x000000bf, 
+    0x000000fc, 0x00000091, 0x00000026, 0x0000004b, 0x00000089, 0x000000e4, 
+    0x00000053, 0x0000003e, 0x00000016, 0x0000007b, 0x000000cc, 0x000000a1, 
+    0x00000063, 0x0000000e, 0x000000b9, 0x000000d4, 0x000000e9, 0x00000084, 
+    0x00000033, 0x0000005e, 0x0000009c, 0x000000f1, 0x00000046, 0x0000002b, 
+    0x00000003, 0x0000006e, 0x000000d9, 0x000000b4, 0x00000076, 0x0000001b, 
+    0x000000ac, 0x000000c1, 0x000000d6, 0x000000bb, 0x0000000c, 0x00000061, 
+    0x000000a3, 0x000000ce, 0x00000079, 0x00000014, 0x0000003c, 0x00000051, 
+    0x000000e6, 0x0000008b, 0x00000049, 0x00000024, 0x00000093, 0x000000fe, 
+    0x000000c3, 0x000000ae, 0x00000019, 0x00000074, 0x000000b6, 0x000000db, 
+    0x0000006c, 0x00000001, 0x00000029, 0x00000044, 0x000000f3, 0x0000009e, 
+    0x0000005c, 0x00000031, 0x00000086, 0x000000eb},
+  {
+    0x00000000, 0x000000d0, 0x00000061, 0x000000b1, 0x000000c2, 0x00000012, 
+    0x000000a3, 0x00000073, 0x00000045, 0x00000095, 0x00000024, 0x000000f4, 
+    0x00000087, 0x00000057, 0x000000e6, 0x00000036, 0x0000008a, 0x0000005a, 
+    0x000000eb, 0x0000003b, 0x00000048, 0x00000098, 0x00000029, 0x000000f9, 
+    0x000000cf, 0x0000001f, 0x000000ae, 0x0000007e, 0x0000000d, 0x000000dd, 
+    0x0000006c, 0x000000bc, 0x000000d5, 0x00000005, 0x000000b4, 0x00000064, 
+    0x00000017, 0x000000c7, 0x00000076, 0x000000a6, 0x00000090, 0x00000040, 
+    0x000000f1, 0x00000021, 0x00000052, 0x00000082, 0x00000033, 0x000000e3, 
+    0x0000005f, 0x0000008f, 0x0000003e, 0x000000ee, 0x0000009d, 0x0000004d, 
+    0x000000fc, 0x0000002c, 0x0000001a, 0x000000ca, 0x0000007b, 0x000000ab, 
+    0x000000d8, 0x00000008, 0x000000b9, 0x00000069, 0x0000006b, 0x000000bb, 
+    0x0000000a, 0x000000da, 0x000000a9, 0x00000079, 0x000000c8, 0x00000018, 
+    0x0000002e, 0x000000fe, 0x0000004f, 0x0000009f, 0x000000ec, 0x0000003c, 
+    0x0000008d, 0x0000005d, 0x000000e1, 0x00000031, 0x00000080, 0x00000050, 
+    0x00000023, 0x000000f3, 0x00000042, 0x00000092, 0x000000a4, 0x00000074, 
+    0x000000c5, 0x00000015, 0x00000066, 0x000000b6, 0x00000007, 0x000000d7, 
+    0x000000be, 0x0000006e, 0x000000df, 0x0000000f, 0x0000007c, 0x000000ac, 
+    0x0000001d, 0x000000cd, 0x000000fb, 0x0000002b, 0x0000009a, 0x0000004a, 
+    0x00000039, 0x000000e9, 0x00000058, 0x00000088, 0x00000034, 0x000000e4, 
+    0x00000055, 0x00000085, 0x000000f6, 0x00000026, 0x00000097, 0x00000047, 
+    0x00000071, 0x000000a1, 0x00000010, 0x000000c0, 0x000000b3, 0x00000063, 
+    0x000000d2, 0x00000002, 0x000000d6, 0x00000006, 0x000000b7, 0x00000067, 
+    0x00000014, 0x000000c4, 0x00000075, 0x000000a5, 0x00000093, 0x00000043, 
+    0x000000f2, 0x00000022, 0x00000051, 0x00000081, 0x00000030, 0x000000e0, 
+    0x0000005c, 0x0000008c, 0x0000003d, 0x000000ed, 0x0000009e, 0x0000004e, 
+    0x000000ff, 0x0000002f, 0x00000019, 0x000000c9, 0x00000078, 0x000000a8, 
+    0x000000db, 0x0000000b, 0x000000ba, 0x0000006a, 0x00000003, 0x000000d3, 
+    0x00000062, 0x000000b2, 0x000000c1, 0x00000011, 0x000000a0, 0x00000070, 
+    0x00000046, 0x00000096, 0x00000027, 0x000000f7, 0x00000084, 0x00000054, 
+    0x000000e5, 0x00000035, 0x00000089, 0x00000059, 0x000000e8, 0x00000038, 
+    0x0000004b, 0x0000009b, 0x0000002a, 0x000000fa, 0x000000cc, 0x0000001c, 
+    0x000000ad, 0x0000007d, 0x0000000e, 0x000000de, 0x0000006f, 0x000000bf, 
+    0x000000bd, 0x0000006d, 0x000000dc, 0x0000000c, 0x0000007f, 0x000000af, 
+    0x0000001e, 0x000000ce, 0x000000f8, 0x00000028, 0x00000099, 0x00000049, 
+    0x0000003a, 0x000000ea, 0x0000005b, 0x0000008b, 0x00000037, 0x000000e7, 
+    0x00000056, 0x00000086, 0x000000f5, 0x00000025, 0x00000094, 0x00000044, 
+    0x00000072, 0x000000a2, 0x00000013, 0x000000c3, 0x000000b0, 0x00000060, 
+    0x000000d1, 0x00000001, 0x00000068, 0x000000b8, 0x00000009, 0x000000d9, 
+    0x000000aa, 0x0000007a, 0x000000cb, 0x0000001b, 0x0000002d, 0x000000fd, 
+    0x0000004c, 0x0000009c, 0x000000ef, 0x0000003f, 0x0000008e, 0x0000005e, 
+    0x000000e2, 0x00000032, 0x00000083, 0x00000053, 0x00000020, 0x000000f0, 
+    0x00000041, 0x00000091, 0x000000a7, 0x00000077, 0x000000c6, 0x00000016, 
+    0x00000065, 0x000000b5, 0x00000004, 0x000000d4},
+  {
+    0x00000000, 0x0000008c, 0x000000d9, 0x00000055, 0x00000073, 0x000000ff, 
+    0x000000aa, 0x00000026, 0x000000e6, 0x0000006a, 0x0000003f, 0x000000b3, 
+    0x00000095, 0x00000019, 0x0000004c, 0x000000c0, 0x0000000d, 0x00000081, 
+    0x000000d4, 0x00000058, 0x0000007e, 0x000000f2, 0x000000a7, 0x0000002b, 
+    0x000000eb, 0x00000067, 0x00000032, 0x000000be, 0x00000098, 0x00000014, 
+    0x00000041, 0x000000cd, 0x0000001a, 0x00000096, 0x000000c3, 0x0000004f, 
+    0x00000069, 0x000000e5, 0x000000b0, 0x0000003c, 0x000000fc, 0x00000070, 
+    0x00000025, 0x000000a9, 0x0000008f, 0x00000003, 0x00000056, 0x000000da, 
+    0x00000017, 0x0000009b, 0x000000ce, 0x00000042, 0x00000064, 0x000000e8, 
+    0x000000bd, 0x00000031, 0x000000f1, 0x0000007d, 0x00000028, 0x000000a4, 
+    0x00000082, 0x0000000e, 0x0000005b, 0x000000d7, 0x00000034, 0x000000b8, 
+    0x000000ed, 0x00000061, 0x00000047, 0x000000cb, 0x0000009e, 0x00000012, 
+    0x000000d2, 0x0000005e, 0x0000000b, 0x00000087, 0x000000a1, 0x0000002d, 
+    0x00000078, 0x000000f4, 0x00000039, 0x000000b5, 0x000000e0, 0x0000006c, 
+    0x0000004a, 0x000000c6, 0x00000093, 0x0000001f, 0x000000df, 0x00000053, 
+    0x00000006, 0x0000008a, 0x000000ac, 0x00000020, 0x00000075, 0x000000f9, 
+    0x0000002e, 0x000000a2, 0x000000f7, 0x0000007b, 0x0000005d, 0x000000d1, 
+    0x00000084, 0x00000008, 0x000000c8, 0x00000044, 0x00000011, 0x0000009d, 
+    0x000000bb, 0x00000037, 0x00000062, 0x000000ee, 0x00000023, 0x000000af, 
+    0x000000fa, 0x00000076, 0x00000050, 0x000000dc, 0x00000089, 0x00000005, 
+    0x000000c5, 0x00000049, 0x0000001c, 0x00000090, 0x000000b6, 0x0000003a, 
+    0x0000006f, 0x000000e3, 0x00000068, 0x000000e4, 0x000000b1, 0x0000003d, 
+    0x0000001b, 0x00000097, 0x000000c2, 0x0000004e, 0x0000008e, 0x00000002, 
+    0x00000057, 0x000000db, 0x000000fd, 0x00000071, 0x00000024, 0x000000a8, 
+    0x00000065, 0x000000e9, 0x000000bc, 0x00000030, 0x00000016, 0x0000009a, 
+    0x000000cf, 0x00000043, 0x00000083, 0x0000000f, 0x0000005a, 0x000000d6, 
+    0x000000f0, 0x0000007c, 0x00000029, 0x000000a5, 0x00000072, 0x000000fe, 
+    0x000000ab, 0x00000027, 0x00000001, 0x0000008d, 0x000000d8, 0x00000054, 
+    0x00000094, 0x00000018, 0x0000004d, 0x000000c1, 0x000000e7, 0x0000006b, 
+    0x0000003e, 0x000000b2, 0x0000007f, 0x000000f3, 0x000000a6, 0x0000002a, 
+    0x0000000c, 0x00000080, 0x000000d5, 0x00000059, 0x00000099, 0x00000015, 
+    0x00000040, 0x000000cc, 0x000000ea, 0x00000066, 0x00000033, 0x000000bf, 
+    0x0000005c, 0x000000d0, 0x00000085, 0x00000009, 0x0000002f, 0x000000a3, 
+    0x000000f6, 0x0000007a, 0x000000ba, 0x00000036, 0x00000063, 0x000000ef, 
+    0x000000c9, 0x00000045, 0x00000010, 0x0000009c, 0x00000051, 0x000000dd, 
+    0x00000088, 0x00000004, 0x00000022, 0x000000ae, 0x000000fb, 0x00000077, 
+    0x000000b7, 0x0000003b, 0x0000006e, 0x000000e2, 0x000000c4, 0x00000048, 
+    0x0000001d, 0x00000091, 0x00000046, 0x000000ca, 0x0000009f, 0x00000013, 
+    0x00000035, 0x000000b9, 0x000000ec, 0x00000060, 0x000000a0, 0x0000002c, 
+    0x00000079, 0x000000f5, 0x000000d3, 0x0000005f, 0x0000000a, 0x00000086, 
+    0x0000004b, 0x000000c7, 0x00000092, 0x0000001e, 0x00000038, 0x000000b4, 
+    0x000000e1, 0x0000006d, 0x000000ad, 0x00000021, 0x00000074, 0x000000f8, 
+    0x000000de, 0x00000052, 0x00000007, 0x0000008b},
+  {
+    0x00000000, 0x000000e9, 0x00000013, 0x000000fa, 0x00000026, 0x000000cf, 
+    0x00000035, 0x000000dc, 0x0000004c, 0x000000a5, 0x0000005f, 0x000000b6, 
+    0x0000006a, 0x00000083, 0x00000079, 0x00000090, 0x00000098, 0x00000071, 
+    0x0000008b, 0x00000062, 0x000000be, 0x00000057, 0x000000ad, 0x00000044, 
+    0x000000d4, 0x0000003d, 0x000000c7, 0x0000002e, 0x000000f2, 0x0000001b, 
+    0x000000e1, 0x00000008, 0x000000f1, 0x00000018, 0x000000e2, 0x0000000b, 
+    0x000000d7, 0x0000003e, 0x000000c4, 0x0000002d, 0x000000bd, 0x00000054, 
+    0x000000ae, 0x00000047, 0x0000009b, 0x00000072, 0x00000088, 0x00000061, 
+    0x00000069, 0x00000080, 0x0000007a, 0x00000093, 0x0000004f, 0x000000a6, 
+    0x0000005c, 0x000000b5, 0x00000025, 0x000000cc, 0x00000036, 0x000000df, 
+    0x00000003, 0x000000ea, 0x00000010, 0x000000f9, 0x00000023, 0x000000ca, 
+    0x00000030, 0x000000d9, 0x00000005, 0x000000ec, 0x00000016, 0x000000ff, 
+    0x0000006f, 0x00000086, 0x0000007c, 0x00000095, 0x00000049, 0x000000a0, 
+    0x0000005a, 0x000000b3, 0x000000bb, 0x00000052, 0x000000a8, 0x00000041, 
+    0x0000009d, 0x00000074, 0x0000008e, 0x00000067, 0x000000f7, 0x0000001e, 
+    0x000000e4, 0x0000000d, 0x000000d1, 0x00000038, 0x000000c2, 0x0000002b, 
+    0x000000d2, 0x0000003b, 0x000000c1, 0x00000028, 0x000000f4, 0x0000001d, 
+    0x000000e7, 0x0000000e, 0x0000009e, 0x00000077, 0x0000008d, 0x00000064, 
+    0x000000b8, 0x00000051, 0x000000ab, 0x00000042, 0x0000004a, 0x000000a3, 
+    0x00000059, 0x000000b0, 0x0000006c, 0x00000085, 0x0000007f, 0x00000096, 
+    0x00000006, 0x000000ef, 0x00000015, 0x000000fc, 0x00000020, 0x000000c9, 
+    0x00000033, 0x000000da, 0x00000046, 0x000000af, 0x00000055, 0x000000bc, 
+    0x00000060, 0x00000089, 0x00000073, 0x0000009a, 0x0000000a, 0x000000e3, 
+    0x00000019, 0x000000f0, 0x0000002c, 0x000000c5, 0x0000003f, 0x000000d6, 
+    0x000000de, 0x00000037, 0x000000cd, 0x00000024, 0x000000f8, 0x00000011, 
+    0x000000eb, 0x00000002, 0x00000092, 0x0000007b, 0x00000081, 0x00000068, 
+    0x000000b4, 0x0000005d, 0x000000a7, 0x0000004e, 0x000000b7, 0x0000005e, 
+    0x000000a4, 0x0000004d, 0x00000091, 0x00000078, 0x00000082, 0x0000006b, 
+    0x000000fb, 0x00000012, 0x000000e8, 0x00000001, 0x000000dd, 0x00000034, 
+    0x000000ce, 0x00000027, 0x0000002f, 0x000000c6, 0x0000003c, 0x000000d5, 
+    0x00000009, 0x000000e0, 0x0000001a, 0x000000f3, 0x00000063, 0x0000008a, 
+    0x00000070, 0x00000099, 0x00000045, 0x000000ac, 0x00000056, 0x000000bf, 
+    0x00000065, 0x0000008c, 0x00000076, 0x0000009f, 0x00000043, 0x000000aa, 
+    0x00000050, 0x000000b9, 0x00000029, 0x000000c0, 0x0000003a, 0x000000d3, 
+    0x0000000f, 0x000000e6, 0x0000001c, 0x000000f5, 0x000000fd, 0x00000014, 
+    0x000000ee, 0x00000007, 0x000000db, 0x00000032, 0x000000c8, 0x00000021, 
+    0x000000b1, 0x00000058, 0x000000a2, 0x0000004b, 0x00000097, 0x0000007e, 
+    0x00000084, 0x0000006d, 0x00000094, 0x0000007d, 0x00000087, 0x0000006e, 
+    0x000000b2, 0x0000005b, 0x000000a1, 0x00000048, 0x000000d8, 0x00000031, 
+    0x000000cb, 0x00000022, 0x000000fe, 0x00000017, 0x000000ed, 0x00000004, 
+    0x0000000c, 0x000000e5, 0x0000001f, 0x000000f6, 0x0000002a, 0x000000c3, 
+    0x00000039, 0x000000d0, 0x00000040, 0x000000a9, 0x00000053, 0x000000ba, 
+    0x00000066, 0x0000008f, 0x00000075, 0x0000009c},
+  {
+    0x00000000, 0x00000037, 0x0000006e, 0x00000059, 0x000000dc, 0x000000eb, 
+    0x000000b2, 0x00000085, 0x00000079, 0x0000004e, 0x00000017, 0x00000020, 
+    0x000000a5, 0x00000092, 0x000000cb, 0x000000fc, 0x000000f2, 0x000000c5, 
+    0x0000009c, 0x000000ab, 0x0000002e, 0x00000019, 0x00000040, 0x00000077, 
+    0x0000008b, 0x000000bc, 0x000000e5, 0x000000d2, 0x00000057, 0x00000060, 
+    0x00000039, 0x0000000e, 0x00000025, 0x00000012, 0x0000004b, 0x0000007c, 
+    0x000000f9, 0x000000ce, 0x00000097, 0x000000a0, 0x0000005c, 0x0000006b, 
+    0x00000032, 0x00000005, 0x00000080, 0x000000b7, 0x000000ee, 0x000000d9, 
+    0x000000d7, 0x000000e0, 0x000000b9, 0x0000008e, 0x0000000b, 0x0000003c, 
+    0x00000065, 0x00000052, 0x000000ae, 0x00000099, 0x000000c0, 0x000000f7, 
+    0x00000072, 0x00000045, 0x0000001c, 0x0000002b, 0x0000004a, 0x0000007d, 
+    0x00000024, 0x00000013, 0x00000096, 0x000000a1, 0x000000f8, 0x000000cf, 
+    0x00000033, 0x00000004, 0x0000005d, 0x0000006a, 0x000000ef, 0x000000d8, 
+    0x00000081, 0x000000b6, 0x000000b8, 0x0000008f, 0x000000d6, 0x000000e1, 
+    0x00000064, 0x00000053, 0x0000000a, 0x0000003d, 0x000000c1, 0x000000f6, 
+    0x000000af, 0x00000098, 0x0000001d, 0x0000002a, 0x00000073, 0x00000044, 
+    0x0000006f, 0x00000058, 0x00000001, 0x00000036, 0x000000b3, 0x00000084, 
+    0x000000dd, 0x000000ea, 0x00000016, 0x00000021, 0x00000078, 0x0000004f, 
+    0x000000ca, 0x000000fd, 0x000000a4, 0x00000093, 0x0000009d, 0x000000aa, 
+    0x000000f3, 0x000000c4, 0x00000041, 0x00000076, 0x0000002f, 0x00000018, 
+    0x000000e4, 0x000000d3, 0x0000008a, 0x000000bd, 0x00000038, 0x0000000f, 
+    0x00000056, 0x00000061, 0x00000094, 0x000000a3, 0x000000fa, 0x000000cd, 
+    0x00000048, 0x0000007f, 0x00000026, 0x00000011, 0x000000ed, 0x000000da, 
+    0x00000083, 0x000000b4, 0x00000031, 0x00000006, 0x0000005f, 0x00000068, 
+    0x00000066, 0x00000051, 0x00000008, 0x0000003f, 0x000000ba, 0x0000008d, 
+    0x000000d4, 0x000000e3, 0x0000001f, 0x00000028, 0x00000071, 0x00000046, 
+    0x000000c3, 0x000000f4, 0x000000ad, 0x0000009a, 0x000000b1, 0x00000086, 
+    0x000000df, 0x000000e8, 0x0000006d, 0x0000005a, 0x00000003, 0x00000034, 
+    0x000000c8, 0x000000ff, 0x000000a6, 0x00000091, 0x00000014, 0x00000023, 
+    0x0000007a, 0x0000004d, 0x00000043, 0x00000074, 0x0000002d, 0x0000001a, 
+    0x0000009f, 0x000000a8, 0x000000f1, 0x000000c6, 0x0000003a, 0x0000000d, 
+    0x00000054, 0x00000063, 0x000000e6, 0x000000d1, 0x00000088, 0x000000bf, 
+    0x000000de, 0x000000e9, 0x000000b0, 0x00000087, 0x00000002, 0x00000035, 
+    0x0000006c, 0x0000005b, 0x000000a7, 0x00000090, 0x000000c9, 0x000000fe, 
+    0x0000007b, 0x0000004c, 0x00000015, 0x00000022, 0x0000002c, 0x0000001b, 
+    0x00000042, 0x00000075, 0x000000f0, 0x000000c7, 0x0000009e, 0x000000a9, 
+    0x00000055, 0x00000062, 0x0000003b, 0x0000000c, 0x00000089, 0x000000be, 
+    0x000000e7, 0x000000d0, 0x000000fb, 0x000000cc, 0x00000095, 0x000000a2, 
+    0x00000027, 0x00000010, 0x00000049, 0x0000007e, 0x00000082, 0x000000b5, 
+    0x000000ec, 0x000000db, 0x0000005e, 0x00000069, 0x00000030, 0x00000007, 
+    0x00000009, 0x0000003e, 0x00000067, 0x00000050, 0x000000d5, 0x000000e2, 
+    0x000000bb, 0x0000008c, 0x00000070, 0x00000047, 0x0000001e, 0x00000029, 
+    0x000000ac, 0x0000009b, 0x000000c2, 0x000000f5},
+  {
+    0x00000000, 0x00000051, 0x000000a2, 0x000000f3, 0x00000085, 0x000000d4, 
+    0x00000027, 0x00000076, 0x000000cb, 0x0000009a, 0x00000069, 0x00000038, 
+    0x0000004e, 0x0000001f, 0x000000ec, 0x000000bd, 0x00000057, 0x00000006, 
+    0x000000f5, 0x000000a4, 0x000000d2, 0x00000083, 0x00000070, 0x00000021, 
+    0x0000009c, 0x000000cd, 0x0000003e, 0x0000006f, 0x00000019, 0x00000048, 
+    0x000000bb, 0x000000ea, 0x000000ae, 0x000000ff, 0x0000000c, 0x0000005d, 
+    0x0000002b, 0x0000007a, 0x00000089, 0x000000d8, 0x00000065, 0x00000034, 
+    0x000000c7, 0x00000096, 0x000000e0, 0x000000b1, 0x00000042, 0x00000013, 
+    0x000000f9, 0x000000a8, 0x0000005b, 0x0000000a, 0x0000007c, 0x0000002d, 
+    0x000000de, 0x0000008f, 0x00000032, 0x00000063, 0x00000090, 0x000000c1, 
+    0x000000b7, 0x000000e6, 0x00000015, 0x00000044, 0x0000009d, 0x000000cc, 
+    0x0000003f, 0x0000006e, 0x00000018, 0x00000049, 0x000000ba, 0x000000eb, 
+    0x00000056, 0x00000007, 0x000000f4, 0x000000a5, 0x000000d3, 0x00000082, 
+    0x00000071, 0x00000020, 0x000000ca, 0x0000009b, 0x00000068, 0x00000039, 
+    0x0000004f, 0x0000001e, 0x000000ed, 0x000000bc, 0x00000001, 0x00000050, 
+    0x000000a3, 0x000000f2, 0x00000084, 0x000000d5, 0x00000026, 0x00000077, 
+    0x00000033, 0x00000062, 0x00000091, 0x000000c0, 0x000000b6, 0x000000e7, 
+    0x00000014, 0x00000045, 0x000000f8, 0x000000a9, 0x0000005a, 0x0000000b, 
+    0x0000007d, 0x0000002c, 0x000000df, 0x0000008e, 0x00000064, 0x00000035, 
+    0x000000c6, 0x00000097, 0x000000e1, 0x000000b0, 0x00000043, 0x00000012, 
+    0x000000af, 0x000000fe, 0x0000000d, 0x0000005c, 0x0000002a, 0x0000007b, 
+    0x00000088, 0x000000d9, 0x000000fb, 0x000000aa, 0x00000059, 0x00000008, 
+    0x0000007e, 0x0000002f, 0x000000dc, 0x0000008d, 0x00000030, 0x00000061, 
+    0x00000092, 0x000000c3, 0x000000b5, 0x000000e4, 0x00000017, 0x00000046, 
+    0x000000ac, 0x000000fd, 0x0000000e, 0x0000005f, 0x00000029, 0x00000078, 
+    0x0000008b, 0x000000da, 0x00000067, 0x00000036, 0x000000c5, 0x00000094, 
+    0x000000e2, 0x000000b3, 0x00000040, 0x00000011, 0x00000055, 0x00000004, 
+    0x000000f7, 0x000000a6, 0x000000d0, 0x00000081, 0x00000072, 0x00000023, 
+    0x0000009e, 0x000000cf, 0x0000003c, 0x0000006d, 0x0000001b, 0x0000004a, 
+    0x000000b9, 0x000000e8, 0x00000002, 0x00000053, 0x000000a0, 0x000000f1, 
+    0x00000087, 0x000000d6, 0x00000025, 0x00000074, 0x000000c9, 0x00000098, 
+    0x0000006b, 0x0000003a, 0x0000004c, 0x0000001d, 0x000000ee, 0x000000bf, 
+    0x00000066, 0x00000037, 0x000000c4, 0x00000095, 0x000000e3, 0x000000b2, 
+    0x00000041, 0x00000010, 0x000000ad, 0x000000fc, 0x0000000f, 0x0000005e, 
+    0x00000028, 0x00000079, 0x0000008a, 0x000000db, 0x00000031, 0x00000060, 
+    0x00000093, 0x000000c2, 0x000000b4, 0x000000e5, 0x00000016, 0x00000047, 
+    0x000000fa, 0x000000ab, 0x00000058, 0x00000009, 0x0000007f, 0x0000002e, 
+    0x000000dd, 0x0000008c, 0x000000c8, 0x00000099, 0x0000006a, 0x0000003b, 
+    0x0000004d, 0x0000001c, 0x000000ef, 0x000000be, 0x00000003, 0x00000052, 
+    0x000000a1, 0x000000f0, 0x00000086, 0x000000d7, 0x00000024, 0x00000075, 
+    0x0000009f, 0x000000ce, 0x0000003d, 0x0000006c, 0x0000001a, 0x0000004b, 
+    0x000000b8, 0x000000e9, 0x00000054, 0x00000005, 0x000000f6, 0x000000a7, 
+    0x000000d1, 0x00000080, 0x00000073, 0x00000022},
+  {
+    0x00000000, 0x000000fd, 0x0000003b, 0x000000c6, 0x00000076, 0x0000008b, 
+    0x0000004d, 0x000000b0, 0x000000ec, 0x00000011, 0x000000d7, 0x0000002a, 
+    0x0000009a, 0x00000067, 0x000000a1, 0x0000005c, 0x00000019, 0x000000e4, 
+    0x00000022, 0x000000df, 0x0000006f, 0x00000092, 0x00000054, 0x000000a9, 
+    0x000000f5, 0x00000008, 0x000000ce, 0x00000033, 0x00000083, 0x0000007e, 
+    0x000000b8, 0x00000045, 0x00000032, 0x000000cf, 0x00000009, 0x000000f4, 
+    0x00000044, 0x000000b9, 0x0000007f, 0x00000082, 0x000000de, 0x00000023, 
+    0x000000e5, 0x00000018, 0x000000a8, 0x00000055, 0x00000093, 0x0000006e, 
+    0x0000002b, 0x000000d6, 0x00000010, 0x000000ed, 0x0000005d, 0x000000a0, 
+    0x00000066, 0x0000009b, 0x000000c7, 0x0000003a, 0x000000fc, 0x00000001, 
+    0x000000b1, 0x0000004c, 0x0000008a, 0x00000077, 0x00000064, 0x00000099, 
+    0x0000005f, 0x000000a2, 0x00000012, 0x000000ef, 0x00000029, 0x000000d4, 
+    0x00000088, 0x00000075, 0x000000b3, 0x0000004e, 0x000000fe, 0x00000003, 
+    0x000000c5, 0x00000038, 0x0000007d, 0x00000080, 0x00000046, 0x000000bb, 
+    0x0000000b, 0x000000f6, 0x00000030, 0x000000cd, 0x00000091, 0x0000006c, 
+    0x000000aa, 0x00000057, 0x000000e7, 0x0000001a, 0x000000dc, 0x00000021, 
+    0x00000056, 0x000000ab, 0x0000006d, 0x00000090, 0x00000020, 0x000000dd, 
+    0x0000001b, 0x000000e6, 0x000000ba, 0x00000047, 0x00000081, 0x0000007c, 
+    0x000000cc, 0x00000031, 0x000000f7, 0x0000000a, 0x0000004f, 0x000000b2, 
+    0x00000074, 0x00000089, 0x00000039, 0x000000c4, 0x00000002, 0x000000ff, 
+    0x000000a3, 0x0000005e, 0x00000098, 0x00000065, 0x000000d5, 0x00000028, 
+    0x000000ee, 0x00000013, 0x000000c8, 0x00000035, 0x000000f3, 0x0000000e, 
+    0x000000be, 0x00000043, 0x00000085, 0x00000078, 0x00000024, 0x000000d9, 
+    0x0000001f, 0x000000e2, 0x00000052, 0x000000af, 0x00000069, 0x00000094, 
+    0x000000d1, 0x0000002c, 0x000000ea, 0x00000017, 0x000000a7, 0x0000005a, 
+    0x0000009c, 0x00000061, 0x0000003d, 0x000000c0, 0x00000006, 0x000000fb, 
+    0x0000004b, 0x000000b6, 0x00000070, 0x0000008d, 0x000000fa, 0x00000007, 
+    0x000000c1, 0x0000003c, 0x0000008c, 0x00000071, 0x000000b7, 0x0000004a, 
+    0x00000016, 0x000000eb, 0x0000002d, 0x000000d0, 0x00000060, 0x0000009d, 
+    0x0000005b, 0x000000a6, 0x000000e3, 0x0000001e, 0x000000d8, 0x00000025, 
+    0x00000095, 0x00000068, 0x000000ae, 0x00000053, 0x0000000f, 0x000000f2, 
+    0x00000034, 0x000000c9, 0x00000079, 0x00000084, 0x00000042, 0x000000bf, 
+    0x000000ac, 0x00000051, 0x00000097, 0x0000006a, 0x000000da, 0x00000027, 
+    0x000000e1, 0x0000001c, 0x00000040, 0x000000bd, 0x0000007b, 0x00000086, 
+    0x00000036, 0x000000cb, 0x0000000d, 0x000000f0, 0x000000b5, 0x00000048, 
+    0x0000008e, 0x00000073, 0x000000c3, 0x0000003e, 0x000000f8, 0x00000005, 
+    0x00000059, 0x000000a4, 0x00000062, 0x0000009f, 0x0000002f, 0x000000d2, 
+    0x00000014, 0x000000e9, 0x0000009e, 0x00000063, 0x000000a5, 0x00000058, 
+    0x000000e8, 0x00000015, 0x000000d3, 0x0000002e, 0x00000072, 0x0000008f, 
+    0x00000049, 0x000000b4, 0x00000004, 0x000000f9, 0x0000003f, 0x000000c2, 
+    0x00000087, 0x0000007a, 0x000000bc, 0x00000041, 0x000000f1, 0x0000000c, 
+    0x000000ca, 0x00000037, 0x0000006b, 0x00000096, 0x00000050, 0x000000ad, 
+    0x0000001d, 0x000000e0, 0x00000026, 0x000000db}
+};
+
+const unsigned int liquid_crc16_gentab[8][256] = {
+  {
+    0x00000000, 0x0000c0c1, 0x0000c181, 0x00000140, 0x0000c301, 0x000003c0, 
+    0x00000280, 0x0000c241, 0x0000c601, 0x000006c0, 0x00000780, 0x0000c741, 
+    0x00000500, 0x0000c5c1, 0x0000c481, 0x00000440, 0x0000cc01, 0x00000cc0, 
+    0x00000d80, 0x0000cd41, 0x00000f00, 0x0000cfc1, 0x0000ce81, 0x00000e40, 
+    0x00000a00, 0x0000cac1, 0x0000cb81, 0x00000b40, 0x0000c901, 0x000009c0, 
+    0x00000880, 0x0000c841, 0x0000d801, 0x000018c0, 0x00001980, 0x0000d941, 
+    0x00001b00, 0x0000dbc1, 0x0000da81, 0x00001a40, 0x00001e00, 0x0000dec1, 
+    0x0000df81, 0x00001f40, 0x0000dd01, 0x00001dc0, 0x00001c80, 0x0000dc41, 
+    0x00001400, 0x0000d4c1, 0x0000d581, 0x00001540, 0x0000d701, 0x000017c0, 
+    0x00001680, 0x0000d641, 0x0000d201, 0x000012c0, 0x00001380, 0x0000d341, 
+    0x00001100, 0x0000d1c1, 0x0000d081, 0x00001040, 0x0000f001, 0x000030c0, 
+    0x00003180, 0x0000f141, 0x00003300, 0x0000f3c1, 0x0000f281, 0x00003240, 
+    0x00003600, 0x0000f6c1, 0x0000f781, 0x00003740, 0x0000f501, 0x000035c0, 
+    0x00003480, 0x0000f441, 0x00003c00, 0x0000fcc1, 0x0000fd81, 0x00003d40, 
+    0x0000ff01, 0x00003fc0, 0x00003e80, 0x0000fe41, 0x0000fa01, 0x00003ac0, 
+    0x00003b80, 0x0000fb41, 0x00003900, 0x0000f9c1, 0x0000f881, 0x00003840, 
+    0x00002800, 0x0000e8c1, 0x0000e981, 0x00002940, 0x0000eb01, 0x00002bc0, 
+    0x00002a80, 0x0000ea41, 0x0000ee01, 0x00002ec0, 0x00002f80, 0x0000ef41, 
+    0x00002d00, 0x0000edc1, 0x0000ec81, 0x00002c40, 0x0000e401, 0x000024c0, 
+    0x00002580, 0x0000e541, 0x00002700, 0x0000e7c1, 0x0000e681, 0x00002640, 
+    0x00002200, 0x0000e2c1, 0x0000e381, 0x00002340, 0x0000e101, 0x000021c0, 
+    0x00002080, 0x0000e041, 0x0000a001, 0x000060c0, 0x00006180, 0x0000a141, 
+    0x00006300, 0x0000a3c1, 0x0000a281, 0x00006240, 0x00006600, 0x0000a6c1, 
+    0x0000a781, 0x00006740, 0x0000a501, 0x000065c0, 0x00006480, 0x0000a441, 
+    0x00006c00, 0x0000acc1, 0x0000ad81, 0x00006d40, 0x0000af01, 0x00006fc0, 
+    0x00006e80, 0x0000ae41, 0x0000aa01, 0x00006ac0, 0x00006b80, 0x0000ab41, 
+    0x00006900, 0x0000a9c1, 0x0000a881, 0x00006840, 0x00007800, 0x0000b8c1, 
+    0x0000b981, 0x00007940, 0x0000bb01, 0x00007bc0, 0x00007a80, 0x0000ba41, 
+    0x0000be01, 0x00007ec0, 0x00007f80, 0x0000bf41, 0x00007d00, 0x0000bdc1, 
+    0x0000bc81, 0x00007c40, 0x0000b401, 0x000074c0, 0x00007580, 0x0000b541, 
+    0x00007700, 0x0000b7c1, 0x0000b681, 0x00007640, 0x00007200, 0x0000b2c1, 
+    0x0000b381, 0x00007340, 0x0000b101, 0x000071c0, 0x00007080, 0x0000b041, 
+    0x00005000, 0x000090c1, 0x00009181, 0x00005140, 0x00009301, 0x000053c0, 
+    0x00005280, 0x00009241, 0x00009601, 0x000056c0, 0x00005780, 0x00009741, 
+    0x00005500, 0x000095c1, 0x00009481, 0x00005440, 0x00009c01, 0x00005cc0, 
+    0x00005d80, 0x00009d41, 0x00005f00, 0x00009fc1, 0x00009e81, 0x00005e40, 
+    0x00005a00, 0x00009ac1, 0x00009b81, 0x00005b40, 0x00009901, 0x000059c0, 
+    0x00005880, 0x00009841, 0x00008801, 0x000048c0, 0x00004980, 0x00008941, 
+    0x00004b00, 0x00008bc1, 0x00008a81, 0x00004a40, 0x00004e00, 0x00008ec1, 
+    0x00008f81, 0x00004f40, 0x00008d01, 0x00004dc0, 0x00004c80, 0x00008c41, 
+    0x00004400, 0x000084c1, 0x00008581, 0x00004540, 0x00008701, 0x000047c0, 
+    0x00004680, 0x00008641, 0x00008201, 0x000042c0, 0x00004380, 0x00008341, 
+    0x00004100, 0x000081c1, 0x00008081, 0x00004040},
+  {
+    0x00000000, 0x00009001, 0x00006001, 0x0000f000, 0x0000c002, 0x00005003, 
+    0x0000a003, 0x00003002, 0x0000c007, 0x00005006, 0x0000a006, 0x00003007, 
+    0x00000005, 0x00009004, 0x00006004, 0x0000f005, 0x0000c00d, 0x0000500c, 
+    0x0000a00c, 0x0000300d, 0x0000000f, 0x0000900e, 0x0000600e, 0x0000f00f, 
+    0x0000000a, 0x0000900b, 0x0000600b, 0x0000f00a, 0x0000c008, 0x00005009, 
+    0x0000a009, 0x00003008, 0x0000c019, 0x00005018, 0x0000a018, 0x00003019, 
+    0x0000001b, 0x0000901a, 0x0000601a, 0x0000f01b, 0x0000001e, 0x0000901f, 
+    0x0000601f, 0x0000f01e, 0x0000c01c, 0x0000501d, 0x0000a01d, 0x0000301c, 
+    0x00000014, 0x00009015, 0x00006015, 0x0000f014, 0x0000c016, 0x00005017, 
+    0x0000a017, 0x00003016, 0x0000c013, 0x00005012, 0x0000a012, 0x00003013, 
+    0x00000011, 0x00009010, 0x00006010, 0x0000f011, 0x0000c031, 0x00005030, 
+    0x0000a030, 0x00003031, 0x00000033, 0x00009032, 0x00006032, 0x0000f033, 
+    0x00000036, 0x00009037, 0x00006037, 0x0000f036, 0x0000c034, 0x00005035, 
+    0x0000a035, 0x00003034, 0x0000003c, 0x0000903d, 0x0000603d, 0x0000f03c, 
+    0x0000c03e, 0x0000503f, 0x0000a03f, 0x0000303e, 0x0000c03b, 0x0000503a, 
+    0x0000a03a, 0x0000303b, 0x00000039, 0x00009038, 0x00006038, 0x0000f039, 
+    0x00000028, 0x00009029, 0x00006029, 0x0000f028, 0x0000c02a, 0x0000502b, 
+    0x0000a02b, 0x0000302a, 0x0000c02f, 0x0000502e, 0x0000a02e, 0x0000302f, 
+    0x0000002d, 0x0000902c, 0x0000602c, 0x0000f02d, 0x0000c025, 0x00005024, 
+    0x0000a024, 0x00003025, 0x00000027, 0x00009026, 0x00006026, 0x0000f027, 
+    0x00000022, 0x00009023, 0x00006023, 0x0000f022, 0x0000c020, 0x00005021, 
+    0x0000a021, 0x00003020, 0x0000c061, 0x00005060, 0x0000a060, 0x00003061, 
+    0x00000063, 0x00009062, 0x00006062, 0x0000f063, 0x00000066, 0x00009067, 
+    0x00006067, 0x0000f066, 0x0000c064, 0x00005065, 0x0000a065, 0x00003064, 
+    0x0000006c, 0x0000906d, 0x0000606d, 0x0000f06c, 0x0000c06e, 0x0000506f, 
+    0x0000a06f, 0x0000306e, 0x0000c06b, 0x0000506a, 0x0000a06a, 0x0000306b, 
+    0x00000069, 0x00009068, 0x00006068, 0x0000f069, 0x00000078, 0x00009079, 
+    0x00006079, 0x0000f078, 0x0000c07a, 0x0000507b, 0x0000a07b, 0x0000307a, 
+    0x0000c07f, 0x0000507e, 0x0000a07e, 0x0000307f, 0x0000007d, 0x0000907c, 
+    0x0000607c, 0x0000f07d, 0x0000c075, 0x00005074, 0x0000a074, 0x00003075, 
+    0x00000077, 0x00009076, 0x00006076, 0x0000f077, 0x00000072, 0x00009073, 
+    0x00006073, 0x0000f072, 0x0000c070, 0x00005071, 0x0000a071, 0x00003070, 
+    0x00000050, 0x00009051, 0x00006051, 0x0000f050, 0x0000c052, 0x00005053, 
+    0x0000a053, 0x00003052, 0x0000c057, 0x00005056, 0x0000a056, 0x00003057, 
+    0x00000055, 0x00009054, 0x00006054, 0x0000f055, 0x0000c05d, 0x0000505c, 
+    0x0000a05c, 0x0000305d, 0x0000005f, 0x0000905e, 0x0000605e, 0x0000f05f, 
+    0x0000005a, 0x0000905b, 0x0000605b, 0x0000f05a, 0x0000c058, 0x00005059, 
+    0x0000a059, 0x00003058, 0x0000c049, 0x00005048, 0x0000a048, 0x00003049, 
+    0x0000004b, 0x0000904a, 0x0000604a, 0x0000f04b, 0x0000004e, 0x0000904f, 
+    0x0000604f, 0x0000f04e, 0x0000c04c, 0x0000504d, 0x0000a04d, 0x0000304c, 
+    0x00000044, 0x00009045, 0x00006045, 0x0000f044, 0x0000c046, 0x00005047, 
+    0x0000a047, 0x00003046, 0x0000c043, 0x00005042, 0x0000a042, 0x00003043, 
+    0x00000041, 0x00009040, 0x00006040, 0x0000f041},
+  {
+    0x00000000, 0x0000c051, 0x0000c0a1, 0x000000f0, 0x0000c141, 0x00000110, 
+    0x000001e0, 0x0000c1b1, 0x0000c281, 0x000002d0, 0x00000220, 0x0000c271, 
+    0x000003c0, 0x0000c391, 0x0000c361, 0x00000330, 0x0000c501, 0x00000550, 
+    0x000005a0, 0x0000c5f1, 0x00000440, 0x0000c411, 0x0000c4e1, 0x000004b0, 
+    0x00000780, 0x0000c7d1, 0x0000c721, 0x00000770, 0x0000c6c1, 0x00000690, 
+    0x00000660, 0x0000c631, 0x0000ca01, 0x00000a50, 0x00000aa0, 0x0000caf1, 
+    0x00000b40, 0x0000cb11, 0x0000cbe1, 0x00000bb0, 0x00000880, 0x0000c8d1, 
+    0x0000c821, 0x00000870, 0x0000c9c1, 0x00000990, 0x00000960, 0x0000c931, 
+    0x00000f00, 0x0000cf51, 0x0000cfa1, 0x00000ff0, 0x0000ce41, 0x00000e10, 
+    0x00000ee0, 0x0000ceb1, 0x0000cd81, 0x00000dd0, 0x00000d20, 0x0000cd71, 
+    0x00000cc0, 0x0000cc91, 0x0000cc61, 0x00000c30, 0x0000d401, 0x00001450, 
+    0x000014a0, 0x0000d4f1, 0x00001540, 0x0000d511, 0x0000d5e1, 0x000015b0, 
+    0x00001680, 0x0000d6d1, 0x0000d621, 0x00001670, 0x0000d7c1, 0x00001790, 
+    0x00001760, 0x0000d731, 0x00001100, 0x0000d151, 0x0000d1a1, 0x000011f0, 
+    0x0000d041, 0x00001010, 0x000010e0, 0x0000d0b1, 0x0000d381, 0x000013d0, 
+    0x00001320, 0x0000d371, 0x000012c0, 0x0000d291, 0x0000d261, 0x00001230, 
+    0x00001e00, 0x0000de51, 0x0000dea1, 0x00001ef0, 0x0000df41, 0x00001f10, 
+    0x00001fe0, 0x0000dfb1, 0x0000dc81, 0x00001cd0, 0x00001c20, 0x0000dc71, 
+    0x00001dc0, 0x0000dd91, 0x0000dd61, 0x00001d30, 0x0000db01, 0x00001b50, 
+    0x00001ba0, 0x0000dbf1, 0x00001a40, 0x0000da11, 0x0000dae1, 0x00001ab0, 
+    0x00001980, 0x0000d9d1, 0x0000d921, 0x00001970, 0x0000d8c1, 0x00001890, 
+    0x00001860, 0x0000d831, 0x0000e801, 0x00002850, 0x000028a0, 0x0000e8f1, 
+    0x00002940, 0x0000e911, 0x0000e9e1, 0x000029b0, 0x00002a80, 0x0000ead1, 
+    0x0000ea21, 0x00002a70, 0x0000ebc1, 0x00002b90, 0x00002b60, 0x0000eb31, 
+    0x00002d00, 0x0000ed51, 0x0000eda1, 0x00002df0, 0x0000ec41, 0x00002c10, 
+    0x00002ce0, 0x0000ecb1, 0x0000ef81, 0x00002fd0, 0x00002f20, 0x0000ef71, 
+    0x00002ec0, 0x0000ee91, 0x0000ee61, 0x00002e30, 0x00002200, 0x0000e251, 
+    0x0000e2a1, 0x000022f0, 0x0000e341, 0x00002310, 0x000023e0, 0x0000e3b1, 
+    0x0000e081, 0x000020d0, 0x00002020, 0x0000e071, 0x000021c0, 0x0000e191, 
+    0x0000e161, 0x00002130, 0x0000e701, 0x00002750, 0x000027a0, 0x0000e7f1, 
+    0x00002640, 0x0000e611, 0x0000e6e1, 0x000026b0, 0x00002580, 0x0000e5d1, 
+    0x0000e521, 0x00002570, 0x0000e4c1, 0x00002490, 0x00002460, 0x0000e431, 
+    0x00003c00, 0x0000fc51, 0x0000fca1, 0x00003cf0, 0x0000fd41, 0x00003d10, 
+    0x00003de0, 0x0000fdb1, 0x0000fe81, 0x00003ed0, 0x00003e20, 0x0000fe71, 
+    0x00003fc0, 0x0000ff91, 0x0000ff61, 0x00003f30, 0x0000f901, 0x00003950, 
+    0x000039a0, 0x0000f9f1, 0x00003840, 0x0000f811, 0x0000f8e1, 0x000038b0, 
+    0x00003b80, 0x0000fbd1, 0x0000fb21, 0x00003b70, 0x0000fac1, 0x00003a90, 
+    0x00003a60, 0x0000fa31, 0x0000f601, 0x00003650, 0x000036a0, 0x0000f6f1, 
+    0x00003740, 0x0000f711, 0x0000f7e1, 0x000037b0, 0x00003480, 0x0000f4d1, 
+    0x0000f421, 0x00003470, 0x0000f5c1, 0x00003590, 0x00003560, 0x0000f531, 
+    0x00003300, 0x0000f351, 0x0000f3a1, 0x000033f0, 0x0000f241, 0x00003210, 
+    0x000032e0, 0x0000f2b1, 0x0000f181, 0x000031d0, 0x00003120, 0x0000f171, 
+    0x000030c0, 0x0000f091, 0x0000f061, 0x00003030},
+  {
+    0x00000000, 0x0000fc01, 0x0000b801, 0x00004400, 0x00003001, 0x0000cc00, 
+    0x00008800, 0x00007401, 0x00006002, 0x00009c03, 0x0000d803, 0x00002402, 
+    0x00005003, 0x0000ac02, 0x0000e802, 0x00001403, 0x0000c004, 0x00003c05, 
+    0x00007805, 0x00008404, 0x0000f005, 0x00000c04, 0x00004804, 0x0000b405, 
+    0x0000a006, 0x00005c07, 0x00001807, 0x0000e406, 0x00009007, 0x00006c06, 
+    0x00002806, 0x0000d407, 0x0000c00b, 0x00003c0a, 0x0000780a, 0x0000840b, 
+    0x0000f00a, 0x00000c0b, 0x0000480b, 0x0000b40a, 0x0000a009, 0x00005c08, 
+    0x00001808, 0x0000e409, 0x00009008, 0x00006c09, 0x00002809, 0x0000d408, 
+    0x0000000f, 0x0000fc0e, 0x0000b80e, 0x0000440f, 0x0000300e, 0x0000cc0f, 
+    0x0000880f, 0x0000740e, 0x0000600d, 0x00009c0c, 0x0000d80c, 0x0000240d, 
+    0x0000500c, 0x0000ac0d, 0x0000e80d, 0x0000140c, 0x0000c015, 0x00003c14, 
+    0x00007814, 0x00008415, 0x0000f014, 0x00000c15, 0x00004815, 0x0000b414, 
+    0x0000a017, 0x00005c16, 0x00001816, 0x0000e417, 0x00009016, 0x00006c17, 
+    0x00002817, 0x0000d416, 0x00000011, 0x0000fc10, 0x0000b810, 0x00004411, 
+    0x00003010, 0x0000cc11, 0x00008811, 0x00007410, 0x00006013, 0x00009c12, 
+    0x0000d812, 0x00002413, 0x00005012, 0x0000ac13, 0x0000e813, 0x00001412, 
+    0x0000001e, 0x0000fc1f, 0x0000b81f, 0x0000441e, 0x0000301f, 0x0000cc1e, 
+    0x0000881e, 0x0000741f, 0x0000601c, 0x00009c1d, 0x0000d81d, 0x0000241c, 
+    0x0000501d, 0x0000ac1c, 0x0000e81c, 0x0000141d, 0x0000c01a, 0x00003c1b, 
+    0x0000781b, 0x0000841a, 0x0000f01b, 0x00000c1a, 0x0000481a, 0x0000b41b, 
+    0x0000a018, 0x00005c19, 0x00001819, 0x0000e418, 0x00009019, 0x00006c18, 
+    0x00002818, 0x0000d419, 0x0000c029, 0x00003c28, 0x00007828, 0x00008429, 
+    0x0000f028, 0x00000c29, 0x00004829, 0x0000b428, 0x0000a02b, 0x00005c2a, 
+    0x0000182a, 0x0000e42b, 0x0000902a, 0x00006c2b, 0x0000282b, 0x0000d42a, 
+    0x0000002d, 0x0000fc2c, 0x0000b82c, 0x0000442d, 0x0000302c, 0x0000cc2d, 
+    0x0000882d, 0x0000742c, 0x0000602f, 0x00009c2e, 0x0000d82e, 0x0000242f, 
+    0x0000502e, 0x0000ac2f, 0x0000e82f, 0x0000142e, 0x00000022, 0x0000fc23, 
+    0x0000b823, 0x00004422, 0x00003023, 0x0000cc22, 0x00008822, 0x00007423, 
+    0x00006020, 0x00009c21, 0x0000d821, 0x00002420, 0x00005021, 0x0000ac20, 
+    0x0000e820, 0x00001421, 0x0000c026, 0x00003c27, 0x00007827, 0x00008426, 
+    0x0000f027, 0x00000c26, 0x00004826, 0x0000b427, 0x0000a024, 0x00005c25, 
+    0x00001825, 0x0000e424, 0x00009025, 0x00006c24, 0x00002824, 0x0000d425, 
+    0x0000003c, 0x0000fc3d, 0x0000b83d, 0x0000443c, 0x0000303d, 0x0000cc3c, 
+    0x0000883c, 0x0000743d, 0x0000603e, 0x00009c3f, 0x0000d83f, 0x0000243e, 
+    0x0000503f, 0x0000ac3e, 0x0000e83e, 0x0000143f, 0x0000c038, 0x00003c39, 
+    0x00007839, 0x00008438, 0x0000f039, 0x00000c38, 0x00004838, 0x0000b439, 
+    0x0000a03a, 0x00005c3b, 0x0000183b, 0x0000e43a, 0x0000903b, 0x00006c3a, 
+    0x0000283a, 0x0000d43b, 0x0000c037, 0x00003c36, 0x00007836, 0x00008437, 
+    0x0000f036, 0x00000c37, 0x00004837, 0x0000b436, 0x0000a035, 0x00005c34, 
+    0x00001834, 0x0000e435, 0x00009034, 0x00006c35, 0x00002835, 0x0000d434, 
+    0x00000033, 0x0000fc32, 0x0000b832, 0x00004433, 0x00003032, 0x0000cc33, 
+    0x00008833, 0x00007432, 0x00006031, 0x00009c30, 0x0000d830, 0x00002431, 
+    0x00005030, 0x0000ac31, 0x0000e831, 0x00001430},
+  {
+    0x00000000, 0x0000c03d, 0x0000c079, 0x00000044, 0x0000c0f1, 0x000000cc, 
+    0x00000088, 0x0000c0b5, 0x0000c1e1, 0x000001dc, 0x00000198, 0x0000c1a5, 
+    0x00000110, 0x0000c12d, 0x0000c169, 0x00000154, 0x0000c3c1, 0x000003fc, 
+    0x000003b8, 0x0000c385, 0x00000330, 0x0000c30d, 0x0000c349, 0x00000374, 
+    0x00000220, 0x0000c21d, 0x0000c259, 0x00000264, 0x0000c2d1, 0x000002ec, 
+    0x000002a8, 0x0000c295, 0x0000c781, 0x000007bc, 0x000007f8, 0x0000c7c5, 
+    0x00000770, 0x0000c74d, 0x0000c709, 0x00000734, 0x00000660, 0x0000c65d, 
+    0x0000c619, 0x00000624, 0x0000c691, 0x000006ac, 0x000006e8, 0x0000c6d5, 
+    0x00000440, 0x0000c47d, 0x0000c439, 0x00000404, 0x0000c4b1, 0x0000048c, 
+    0x000004c8, 0x0000c4f5, 0x0000c5a1, 0x0000059c, 0x000005d8, 0x0000c5e5, 
+    0x00000550, 0x0000c56d, 0x0000c529, 0x00000514, 0x0000cf01, 0x00000f3c, 
+    0x00000f78, 0x0000cf45, 0x00000ff0, 0x0000cfcd, 0x0000cf89, 0x00000fb4, 
+    0x00000ee0, 0x0000cedd, 0x0000ce99, 0x00000ea4, 0x0000ce11, 0x00000e2c, 
+    0x00000e68, 0x0000ce55, 0x00000cc0, 0x0000ccfd, 0x0000ccb9, 0x00000c84, 
+    0x0000cc31, 0x00000c0c, 0x00000c48, 0x0000cc75, 0x0000cd21, 0x00000d1c, 
+    0x00000d58, 0x0000cd65, 0x00000dd0, 0x0000cded, 0x0000cda9, 0x00000d94, 
+    0x00000880, 0x0000c8bd, 0x0000c8f9, 0x000008c4, 0x0000c871, 0x0000084c, 
+    0x00000808, 0x0000c835, 0x0000c961, 0x0000095c, 0x00000918, 0x0000c925, 
+    0x00000990, 0x0000c9ad, 0x0000c9e9, 0x000009d4, 0x0000cb41, 0x00000b7c, 
+    0x00000b38, 0x0000cb05, 0x00000bb0, 0x0000cb8d, 0x0000cbc9, 0x00000bf4, 
+    0x00000aa0, 0x0000ca9d, 0x0000cad9, 0x00000ae4, 0x0000ca51, 0x00000a6c, 
+    0x00000a28, 0x0000ca15, 0x0000de01, 0x00001e3c, 0x00001e78, 0x0000de45, 
+    0x00001ef0, 0x0000decd, 0x0000de89, 0x00001eb4, 0x00001fe0, 0x0000dfdd, 
+    0x0000df99, 0x00001fa4, 0x0000df11, 0x00001f2c, 0x00001f68, 0x0000df55, 
+    0x00001dc0, 0x0000ddfd, 0x0000ddb9, 0x00001d84, 0x0000dd31, 0x00001d0c, 
+    0x00001d48, 0x0000dd75, 0x0000dc21, 0x00001c1c, 0x00001c58, 0x0000dc65, 
+    0x00001cd0, 0x0000dced, 0x0000dca9, 0x00001c94, 0x00001980, 0x0000d9bd, 
+    0x0000d9f9, 0x000019c4, 0x0000d971, 0x0000194c, 0x00001908, 0x0000d935, 
+    0x0000d861, 0x0000185c, 0x00001818, 0x0000d825, 0x00001890, 0x0000d8ad, 
+    0x0000d8e9, 0x000018d4, 0x0000da41, 0x00001a7c, 0x00001a38, 0x0000da05, 
+    0x00001ab0, 0x0000da8d, 0x0000dac9, 0x00001af4, 0x00001ba0, 0x0000db9d, 
+    0x0000dbd9, 0x00001be4, 0x0000db51, 0x00001b6c, 0x00001b28, 0x0000db15, 
+    0x00001100, 0x0000d13d, 0x0000d179, 0x00001144, 0x0000d1f1, 0x000011cc, 
+    0x00001188, 0x0000d1b5, 0x0000d0e1, 0x000010dc, 0x00001098, 0x0000d0a5, 
+    0x00001010, 0x0000d02d, 0x0000d069, 0x00001054, 0x0000d2c1, 0x000012fc, 
+    0x000012b8, 0x0000d285, 0x00001230, 0x0000d20d, 0x0000d249, 0x00001274, 
+    0x00001320, 0x0000d31d, 0x0000d359, 0x00001364, 0x0000d3d1, 0x000013ec, 
+    0x000013a8, 0x0000d395, 0x0000d681, 0x000016bc, 0x000016f8, 0x0000d6c5, 
+    0x00001670, 0x0000d64d, 0x0000d609, 0x00001634, 0x00001760, 0x0000d75d, 
+    0x0000d719, 0x00001724, 0x0000d791, 0x000017ac, 0x000017e8, 0x0000d7d5, 
+    0x00001540, 0x0000d57d, 0x0000d539, 0x00001504, 0x0000d5b1, 0x0000158c, 
+    0x000015c8, 0x0000d5f5, 0x0000d4a1, 0x0000149c, 0x000014d8, 0x0000d4e5, 
+    0x00001450, 0x0000d46d, 0x0000d429, 0x00001414},
+  {
+    0x00000000, 0x0000d101, 0x0000e201, 0x00003300, 0x00008401, 0x00005500, 
+    0x00006600, 0x0000b701, 0x00004801, 0x00009900, 0x0000aa00, 0x00007b01, 
+    0x0000cc00, 0x00001d01, 0x00002e01, 0x0000ff00, 0x00009002, 0x00004103, 
+    0x00007203, 0x0000a302, 0x00001403, 0x0000c502, 0x0000f602, 0x00002703, 
+    0x0000d803, 0x00000902, 0x00003a02, 0x0000eb03, 0x00005c02, 0x00008d03, 
+    0x0000be03, 0x00006f02, 0x00006007, 0x0000b106, 0x00008206, 0x00005307, 
+    0x0000e406, 0x00003507, 0x00000607, 0x0000d706, 0x00002806, 0x0000f907, 
+    0x0000ca07, 0x00001b06, 0x0000ac07, 0x00007d06, 0x00004e06, 0x00009f07, 
+    0x0000f005, 0x00002104, 0x00001204, 0x0000c305, 0x00007404, 0x0000a505, 
+    0x00009605, 0x00004704, 0x0000b804, 0x00006905, 0x00005a05, 0x00008b04, 
+    0x00003c05, 0x0000ed04, 0x0000de04, 0x00000f05, 0x0000c00e, 0x0000110f, 
+    0x0000220f, 0x0000f30e, 0x0000440f, 0x0000950e, 0x0000a60e, 0x0000770f, 
+    0x0000880f, 0x0000590e, 0x00006a0e, 0x0000bb0f, 0x00000c0e, 0x0000dd0f, 
+    0x0000ee0f, 0x00003f0e, 0x0000500c, 0x0000810d, 0x0000b20d, 0x0000630c, 
+    0x0000d40d, 0x0000050c, 0x0000360c, 0x0000e70d, 0x0000180d, 0x0000c90c, 
+    0x0000fa0c, 0x00002b0d, 0x00009c0c, 0x00004d0d, 0x00007e0d, 0x0000af0c, 
+    0x0000a009, 0x00007108, 0x00004208, 0x00009309, 0x00002408, 0x0000f509, 
+    0x0000c609, 0x00001708, 0x0000e808, 0x00003909, 0x00000a09, 0x0000db08, 
+    0x00006c09, 0x0000bd08, 0x00008e08, 0x00005f09, 0x0000300b, 0x0000e10a, 
+    0x0000d20a, 0x0000030b, 0x0000b40a, 0x0000650b, 0x0000560b, 0x0000870a, 
+    0x0000780a, 0x0000a90b, 0x00009a0b, 0x00004b0a, 0x0000fc0b, 0x00002d0a, 
+    0x00001e0a, 0x0000cf0b, 0x0000c01f, 0x0000111e, 0x0000221e, 0x0000f31f, 
+    0x0000441e, 0x0000951f, 0x0000a61f, 0x0000771e, 0x0000881e, 0x0000591f, 
+    0x00006a1f, 0x0000bb1e, 0x00000c1f, 0x0000dd1e, 0x0000ee1e, 0x00003f1f, 
+    0x0000501d, 0x0000811c, 0x0000b21c, 0x0000631d, 0x0000d41c, 0x0000051d, 
+    0x0000361d, 0x0000e71c, 0x0000181c, 0x0000c91d, 0x0000fa1d, 0x00002b1c, 
+    0x00009c1d, 0x00004d1c, 0x00007e1c, 0x0000af1d, 0x0000a018, 0x00007119, 
+    0x00004219, 0x00009318, 0x00002419, 0x0000f518, 0x0000c618, 0x00001719, 
+    0x0000e819, 0x00003918, 0x00000a18, 0x0000db19, 0x00006c18, 0x0000bd19, 
+    0x00008e19, 0x00005f18, 0x0000301a, 0x0000e11b, 0x0000d21b, 0x0000031a, 
+    0x0000b41b, 0x0000651a, 0x0000561a, 0x0000871b, 0x0000781b, 0x0000a91a, 
+    0x00009a1a, 0x00004b1b, 0x0000fc1a, 0x00002d1b, 0x00001e1b, 0x0000cf1a, 
+    0x00000011, 0x0000d110, 0x0000e210, 0x00003311, 0x00008410, 0x00005511, 
+    0x00006611, 0x0000b710, 0x00004810, 0x00009911, 0x0000aa11, 0x00007b10, 
+    0x0000cc11, 0x00001d10, 0x00002e10, 0x0000ff11, 0x00009013, 0x00004112, 
+    0x00007212, 0x0000a313, 0x00001412, 0x0000c513, 0x0000f613, 0x00002712, 
+    0x0000d812, 0x00000913, 0x00003a13, 0x0000eb12, 0x00005c13, 0x00008d12, 
+    0x0000be12, 0x00006f13, 0x00006016, 0x0000b117, 0x00008217, 0x00005316, 
+    0x0000e417, 0x00003516, 0x00000616, 0x0000d717, 0x00002817, 0x0000f916, 
+    0x0000ca16, 0x00001b17, 0x0000ac16, 0x00007d17, 0x00004e17, 0x00009f16, 
+    0x0000f014, 0x00002115, 0x00001215, 0x0000c314, 0x00007415, 0x0000a514, 
+    0x00009614, 0x00004715, 0x0000b815, 0x00006914, 0x00005a14, 0x00008b15, 
+    0x00003c14, 0x0000ed15, 0x0000de15, 0x00000f14},
+  {
+    0x00000000, 0x0000c010, 0x0000c023, 0x00000033, 0x0000c045, 0x00000055, 
+    0x00000066, 0x0000c076, 0x0000c089, 0x00000099, 0x000000aa, 0x0000c0ba, 
+    0x000000cc, 0x0000c0dc, 0x0000c0ef, 0x000000ff, 0x0000c111, 0x00000101, 
+    0x00000132, 0x0000c122, 0x00000154, 0x0000c144, 0x0000c177, 0x00000167, 
+    0x00000198, 0x0000c188, 0x0000c1bb, 0x000001ab, 0x0000c1dd, 0x000001cd, 
+    0x000001fe, 0x0000c1ee, 0x0000c221, 0x00000231, 0x00000202, 0x0000c212, 
+    0x00000264, 0x0000c274, 0x0000c247, 0x00000257, 0x000002a8, 0x0000c2b8, 
+    0x0000c28b, 0x0000029b, 0x0000c2ed, 0x000002fd, 0x000002ce, 0x0000c2de, 
+    0x00000330, 0x0000c320, 0x0000c313, 0x00000303, 0x0000c375, 0x00000365, 
+    0x00000356, 0x0000c346, 0x0000c3b9, 0x000003a9, 0x0000039a, 0x0000c38a, 
+    0x000003fc, 0x0000c3ec, 0x0000c3df, 0x000003cf, 0x0000c441, 0x00000451, 
+    0x00000462, 0x0000c472, 0x00000404, 0x0000c414, 0x0000c427, 0x00000437, 
+    0x000004c8, 0x0000c4d8, 0x0000c4eb, 0x000004fb, 0x0000c48d, 0x0000049d, 
+    0x000004ae, 0x0000c4be, 0x00000550, 0x0000c540, 0x0000c573, 0x00000563, 
+    0x0000c515, 0x00000505, 0x00000536, 0x0000c526, 0x0000c5d9, 0x000005c9, 
+    0x000005fa, 0x0000c5ea, 0x0000059c, 0x0000c58c, 0x0000c5bf, 0x000005af, 
+    0x00000660, 0x0000c670, 0x0000c643, 0x00000653, 0x0000c625, 0x00000635, 
+    0x00000606, 0x0000c616, 0x0000c6e9, 0x000006f9, 0x000006ca, 0x0000c6da, 
+    0x000006ac, 0x0000c6bc, 0x0000c68f, 0x0000069f, 0x0000c771, 0x00000761, 
+    0x00000752, 0x0000c742, 0x00000734, 0x0000c724, 0x0000c717, 0x00000707, 
+    0x000007f8, 0x0000c7e8, 0x0000c7db, 0x000007cb, 0x0000c7bd, 0x000007ad, 
+    0x0000079e, 0x0000c78e, 0x0000c881, 0x00000891, 0x000008a2, 0x0000c8b2, 
+    0x000008c4, 0x0000c8d4, 0x0000c8e7, 0x000008f7, 0x00000808, 0x0000c818, 
+    0x0000c82b, 0x0000083b, 0x0000c84d, 0x0000085d, 0x0000086e, 0x0000c87e, 
+    0x00000990, 0x0000c980, 0x0000c9b3, 0x000009a3, 0x0000c9d5, 0x000009c5, 
+    0x000009f6, 0x0000c9e6, 0x0000c919, 0x00000909, 0x0000093a, 0x0000c92a, 
+    0x0000095c, 0x0000c94c, 0x0000c97f, 0x0000096f, 0x00000aa0, 0x0000cab0, 
+    0x0000ca83, 0x00000a93, 0x0000cae5, 0x00000af5, 0x00000ac6, 0x0000cad6, 
+    0x0000ca29, 0x00000a39, 0x00000a0a, 0x0000ca1a, 0x00000a6c, 0x0000ca7c, 
+    0x0000ca4f, 0x00000a5f, 0x0000cbb1, 0x00000ba1, 0x00000b92, 0x0000cb82, 
+    0x00000bf4, 0x0000cbe4, 0x0000cbd7, 0x00000bc7, 0x00000b38, 0x0000cb28, 
+    0x0000cb1b, 0x00000b0b, 0x0000cb7d, 0x00000b6d, 0x00000b5e, 0x0000cb4e, 
+    0x00000cc0, 0x0000ccd0, 0x0000cce3, 0x00000cf3, 0x0000cc85, 0x00000c95, 
+    0x00000ca6, 0x0000ccb6, 0x0000cc49, 0x00000c59, 0x00000c6a, 0x0000cc7a, 
+    0x00000c0c, 0x0000cc1c, 0x0000cc2f, 0x00000c3f, 0x0000cdd1, 0x00000dc1, 
+    0x00000df2, 0x0000cde2, 0x00000d94, 0x0000cd84, 0x0000cdb7, 0x00000da7, 
+    0x00000d58, 0x0000cd48, 0x0000cd7b, 0x00000d6b, 0x0000cd1d, 0x00000d0d, 
+    0x00000d3e, 0x0000cd2e, 0x0000cee1, 0x00000ef1, 0x00000ec2, 0x0000ced2, 
+    0x00000ea4, 0x0000ceb4, 0x0000ce87, 0x00000e97, 0x00000e68, 0x0000ce78, 
+    0x0000ce4b, 0x00000e5b, 0x0000ce2d, 0x00000e3d, 0x00000e0e, 0x0000ce1e, 
+    0x00000ff0, 0x0000cfe0, 0x0000cfd3, 0x00000fc3, 0x0000cfb5, 0x00000fa5, 
+    0x00000f96, 0x0000cf86, 0x0000cf79, 0x00000f69, 0x00000f5a, 0x0000cf4a, 
+    0x00000f3c, 0x0000cf2c, 0x0000cf1f, 0x00000f0f},
+  {
+    0x00000000, 0x0000ccc1, 0x0000d981, 0x00001540, 0x0000f301, 0x00003fc0, 
+    0x00002a80, 0x0000e641, 0x0000a601, 0x00006ac0, 0x00007f80, 0x0000b341, 
+    0x00005500, 0x000099c1, 0x00008c81, 0x00004040, 0x00000c01, 0x0000c0c0, 
+    0x0000d580, 0x00001941, 0x0000ff00, 0x000033c1, 0x00002681, 0x0000ea40, 
+    0x0000aa00, 0x000066c1, 0x00007381, 0x0000bf40, 0x00005901, 0x000095c0, 
+    0x00008080, 0x00004c41, 0x00001802, 0x0000d4c3, 0x0000c183, 0x00000d42, 
+    0x0000eb03, 0x000027c2, 0x00003282, 0x0000fe43, 0x0000be03, 0x000072c2, 
+    0x00006782, 0x0000ab43, 0x00004d02, 0x000081c3, 0x00009483, 0x00005842, 
+    0x00001403, 0x0000d8c2, 0x0000cd82, 0x00000143, 0x0000e702, 0x00002bc3, 
+    0x00003e83, 0x0000f242, 0x0000b202, 0x00007ec3, 0x00006b83, 0x0000a742, 
+    0x00004103, 0x00008dc2, 0x00009882, 0x00005443, 0x00003004, 0x0000fcc5, 
+    0x0000e985, 0x00002544, 0x0000c305, 0x00000fc4, 0x00001a84, 0x0000d645, 
+    0x00009605, 0x00005ac4, 0x00004f84, 0x00008345, 0x00006504, 0x0000a9c5, 
+    0x0000bc85, 0x00007044, 0x00003c05, 0x0000f0c4, 0x0000e584, 0x00002945, 
+    0x0000cf04, 0x000003c5, 0x00001685, 0x0000da44, 0x00009a04, 0x000056c5, 
+    0x00004385, 0x00008f44, 0x00006905, 0x0000a5c4, 0x0000b084, 0x00007c45, 
+    0x00002806, 0x0000e4c7, 0x0000f187, 0x00003d46, 0x0000db07, 0x000017c6, 
+    0x00000286, 0x0000ce47, 0x00008e07, 0x000042c6, 0x00005786, 0x00009b47, 
+    0x00007d06, 0x0000b1c7, 0x0000a487, 0x00006846, 0x00002407, 0x0000e8c6, 
+    0x0000fd86, 0x00003147, 0x0000d706, 0x00001bc7, 0x00000e87, 0x0000c246, 
+    0x00008206, 0x00004ec7, 0x00005b87, 0x00009746, 0x00007107, 0x0000bdc6, 
+    0x0000a886, 0x00006447, 0x00006008, 0x0000acc9, 0x0000b989, 0x00007548, 
+    0x00009309, 0x00005fc8, 0x00004a88, 0x00008649, 0x0000c609, 0x00000ac8, 
+    0x00001f88, 0x0000d349, 0x00003508, 0x0000f9c9, 0x0000ec89, 0x00002048, 
+    0x00006c09, 0x0000a0c8, 0x0000b588, 0x00007949, 0x00009f08, 0x000053c9, 
+    0x00004689, 0x00008a48, 0x0000ca08, 0x000006c9, 0x00001389, 0x0000df48, 
+    0x00003909, 0x0000f5c8, 0x0000e088, 0x00002c49, 0x0000780a, 0x0000b4cb, 
+    0x0000a18b, 0x00006d4a, 0x00008b0b, 0x000047ca, 0x0000528a, 0x00009e4b, 
+    0x0000de0b, 0x000012ca, 0x0000078a, 0x0000cb4b, 0x00002d0a, 0x0000e1cb, 
+    0x0000f48b, 0x0000384a, 0x0000740b, 0x0000b8ca, 0x0000ad8a, 0x0000614b, 
+    0x0000870a, 0x00004bcb, 0x00005e8b, 0x0000924a, 0x0000d20a, 0x00001ecb, 
+    0x00000b8b, 0x0000c74a, 0x0000210b, 0x0000edca, 0x0000f88a, 0x0000344b, 
+    0x0000500c, 0x00009ccd, 0x0000898d, 0x0000454c, 0x0000a30d, 0x00006fcc, 
+    0x00007a8c, 0x0000b64d, 0x0000f60d, 0x00003acc, 0x00002f8c, 0x0000e34d, 
+    0x0000050c, 0x0000c9cd, 0x0000dc8d, 0x0000104c, 0x00005c0d, 0x000090cc, 
+    0x0000858c, 0x0000494d, 0x0000af0c, 0x000063cd, 0x0000768d, 0x0000ba4c, 
+    0x0000fa0c, 0x000036cd, 0x0000238d, 0x0000ef4c, 0x0000090d, 0x0000c5cc, 
+    0x0000d08c, 0x00001c4d, 0x0000480e, 0x000084cf, 0x0000918f, 0x00005d4e, 
+    0x0000bb0f, 0x000077ce, 0x0000628e, 0x0000ae4f, 0x0000ee0f, 0x000022ce, 
+    0x0000378e, 0x0000fb4f, 0x00001d0e, 0x0000d1cf, 0x0000c48f, 0x0000084e, 
+    0x0000440f, 0x000088ce, 0x00009d8e, 0x0000514f, 0x0000b70e, 0x00007bcf, 
+    0x00006e8f, 0x0000a24e, 0x0000e20e, 0x00002ecf, 0x00003b8f, 0x0000f74e, 
+    0x0000110f, 0x0000ddce, 0x0000c88e, 0x0000044f}
+};
+
+const unsigned int liquid_crc24_gentab[8][256] = {
+  {
+    0x00000000, 0x0033d776, 0x0067aeec, 0x0054799a, 0x00cf5dd8, 0x00fc8aae, 
+    0x00a8f334, 0x009b2442, 0x0039d6c5, 0x000a01b3, 0x005e7829, 0x006daf5f, 
+    0x00f68b1d, 0x00c55c6b, 0x009125f1, 0x00a2f287, 0x0073ad8a, 0x00407afc, 
+    0x00140366, 0x0027d410, 0x00bcf052, 0x008f2724, 0x00db5ebe, 0x00e889c8, 
+    0x004a7b4f, 0x0079ac39, 0x002dd5a3, 0x001e02d5, 0x00852697, 0x00b6f1e1, 
+    0x00e2887b, 0x00d15f0d, 0x00e75b14, 0x00d48c62, 0x0080f5f8, 0x00b3228e, 
+    0x002806cc, 0x001bd1ba, 0x004fa820, 0x007c7f56, 0x00de8dd1, 0x00ed5aa7, 
+    0x00b9233d, 0x008af44b, 0x0011d009, 0x0022077f, 0x00767ee5, 0x0045a993, 
+    0x0094f69e, 0x00a721e8, 0x00f35872, 0x00c08f04, 0x005bab46, 0x00687c30, 
+    0x003c05aa, 0x000fd2dc, 0x00ad205b, 0x009ef72d, 0x00ca8eb7, 0x00f959c1, 
+    0x00627d83, 0x0051aaf5, 0x0005d36f, 0x00360419, 0x0069db5d, 0x005a0c2b, 
+    0x000e75b1, 0x003da2c7, 0x00a68685, 0x009551f3, 0x00c12869, 0x00f2ff1f, 
+    0x00500d98, 0x0063daee, 0x0037a374, 0x00047402, 0x009f5040, 0x00ac8736, 
+    0x00f8feac, 0x00cb29da, 0x001a76d7, 0x0029a1a1, 0x007dd83b, 0x004e0f4d, 
+    0x00d52b0f, 0x00e6fc79, 0x00b285e3, 0x00815295, 0x0023a012, 0x00107764, 
+    0x00440efe, 0x0077d988, 0x00ecfdca, 0x00df2abc, 0x008b5326, 0x00b88450, 
+    0x008e8049, 0x00bd573f, 0x00e92ea5, 0x00daf9d3, 0x0041dd91, 0x00720ae7, 
+    0x0026737d, 0x0015a40b, 0x00b7568c, 0x008481fa, 0x00d0f860, 0x00e32f16, 
+    0x00780b54, 0x004bdc22, 0x001fa5b8, 0x002c72ce, 0x00fd2dc3, 0x00cefab5, 
+    0x009a832f, 0x00a95459, 0x0032701b, 0x0001a76d, 0x0055def7, 0x00660981, 
+    0x00c4fb06, 0x00f72c70, 0x00a355ea, 0x0090829c, 0x000ba6de, 0x003871a8, 
+    0x006c0832, 0x005fdf44, 0x00d3b6ba, 0x00e061cc, 0x00b41856, 0x0087cf20, 
+    0x001ceb62, 0x002f3c14, 0x007b458e, 0x004892f8, 0x00ea607f, 0x00d9b709, 
+    0x008dce93, 0x00be19e5, 0x00253da7, 0x0016ead1, 0x0042934b, 0x0071443d, 
+    0x00a01b30, 0x0093cc46, 0x00c7b5dc, 0x00f462aa, 0x006f46e8, 0x005c919e, 
+    0x0008e804, 0x003b3f72, 0x0099cdf5, 0x00aa1a83, 0x00fe6319, 0x00cdb46f, 
+    0x0056902d, 0x0065475b, 0x00313ec1, 0x0002e9b7, 0x0034edae, 0x00073ad8, 
+    0x00534342, 0x00609434, 0x00fbb076, 0x00c86700, 0x009c1e9a, 0x00afc9ec, 
+    0x000d3b6b, 0x003eec1d, 0x006a9587, 0x005942f1, 0x00c266b3, 0x00f1b1c5, 
+    0x00a5c85f, 0x00961f29, 0x00474024, 0x00749752, 0x0020eec8, 0x001339be, 
+    0x00881dfc, 0x00bbca8a, 0x00efb310, 0x00dc6466, 0x007e96e1, 0x004d4197, 
+    0x0019380d, 0x002aef7b, 0x00b1cb39, 0x00821c4f, 0x00d665d5, 0x00e5b2a3, 
+    0x00ba6de7, 0x0089ba91, 0x00ddc30b, 0x00ee147d, 0x0075303f, 0x0046e749, 
+    0x00129ed3, 0x002149a5, 0x0083bb22, 0x00b06c54, 0x00e415ce, 0x00d7c2b8, 
+    0x004ce6fa, 0x007f318c, 0x002b4816, 0x00189f60, 0x00c9c06d, 0x00fa171b, 
+    0x00ae6e81, 0x009db9f7, 0x00069db5, 0x00354ac3, 0x00613359, 0x0052e42f, 
+    0x00f016a8, 0x00c3c1de, 0x0097b844, 0x00a46f32, 0x003f4b70, 0x000c9c06, 
+    0x0058e59c, 0x006b32ea, 0x005d36f3, 0x006ee185, 0x003a981f, 0x00094f69, 
+    0x00926b2b, 0x00a1bc5d, 0x00f5c5c7, 0x00c612b1, 0x0064e036, 0x00573740, 
+    0x00034eda, 0x003099ac, 0x00abbdee, 0x00986a98, 0x00cc1302, 0x00ffc474, 
+    0x002e9b79, 0x001d4c0f, 0x00493595, 0x007ae2e3, 0x00e1c6a1, 0x00d211d7, 
+    0x0086684d, 0x00b5bf3b, 0x00174dbc, 0x00249aca, 0x0070e350, 0x00433426, 
+    0x00d81064, 0x00ebc712, 0x00bfbe88, 0x008c69fe},
+  {
+    0x00000000, 0x0055ed20, 0x00abda40, 0x00fe3760, 0x00f0d9f5, 0x00a534d5, 
+    0x005b03b5, 0x000eee95, 0x0046de9f, 0x001333bf, 0x00ed04df, 0x00b8e9ff, 
+    0x00b6076a, 0x00e3ea4a, 0x001ddd2a, 0x0048300a, 0x008dbd3e, 0x00d8501e, 
+    0x0026677e, 0x00738a5e, 0x007d64cb, 0x002889eb, 0x00d6be8b, 0x008353ab, 
+    0x00cb63a1, 0x009e8e81, 0x0060b9e1, 0x003554c1, 0x003bba54, 0x006e5774, 
+    0x00906014, 0x00c58d34, 0x00bc1709, 0x00e9fa29, 0x0017cd49, 0x00422069, 
+    0x004ccefc, 0x001923dc, 0x00e714bc, 0x00b2f99c, 0x00fac996, 0x00af24b6, 
+    0x005113d6, 0x0004fef6, 0x000a1063, 0x005ffd43, 0x00a1ca23, 0x00f42703, 
+    0x0031aa37, 0x00644717, 0x009a7077, 0x00cf9d57, 0x00c173c2, 0x00949ee2, 
+    0x006aa982, 0x003f44a2, 0x007774a8, 0x00229988, 0x00dcaee8, 0x008943c8, 
+    0x0087ad5d, 0x00d2407d, 0x002c771d, 0x00799a3d, 0x00df4367, 0x008aae47, 
+    0x00749927, 0x00217407, 0x002f9a92, 0x007a77b2, 0x008440d2, 0x00d1adf2, 
+    0x00999df8, 0x00cc70d8, 0x003247b8, 0x0067aa98, 0x0069440d, 0x003ca92d, 
+    0x00c29e4d, 0x0097736d, 0x0052fe59, 0x00071379, 0x00f92419, 0x00acc939, 
+    0x00a227ac, 0x00f7ca8c, 0x0009fdec, 0x005c10cc, 0x001420c6, 0x0041cde6, 
+    0x00bffa86, 0x00ea17a6, 0x00e4f933, 0x00b11413, 0x004f2373, 0x001ace53, 
+    0x0063546e, 0x0036b94e, 0x00c88e2e, 0x009d630e, 0x00938d9b, 0x00c660bb, 
+    0x003857db, 0x006dbafb, 0x00258af1, 0x007067d1, 0x008e50b1, 0x00dbbd91, 
+    0x00d55304, 0x0080be24, 0x007e8944, 0x002b6464, 0x00eee950, 0x00bb0470, 
+    0x00453310, 0x0010de30, 0x001e30a5, 0x004bdd85, 0x00b5eae5, 0x00e007c5, 
+    0x00a837cf, 0x00fddaef, 0x0003ed8f, 0x005600af, 0x0058ee3a, 0x000d031a, 
+    0x00f3347a, 0x00a6d95a, 0x0019ebbb, 0x004c069b, 0x00b231fb, 0x00e7dcdb, 
+    0x00e9324e, 0x00bcdf6e, 0x0042e80e, 0x0017052e, 0x005f3524, 0x000ad804, 
+    0x00f4ef64, 0x00a10244, 0x00afecd1, 0x00fa01f1, 0x00043691, 0x0051dbb1, 
+    0x00945685, 0x00c1bba5, 0x003f8cc5, 0x006a61e5, 0x00648f70, 0x00316250, 
+    0x00cf5530, 0x009ab810, 0x00d2881a, 0x0087653a, 0x0079525a, 0x002cbf7a, 
+    0x002251ef, 0x0077bccf, 0x00898baf, 0x00dc668f, 0x00a5fcb2, 0x00f01192, 
+    0x000e26f2, 0x005bcbd2, 0x00552547, 0x0000c867, 0x00feff07, 0x00ab1227, 
+    0x00e3222d, 0x00b6cf0d, 0x0048f86d, 0x001d154d, 0x0013fbd8, 0x004616f8, 
+    0x00b82198, 0x00edccb8, 0x0028418c, 0x007dacac, 0x00839bcc, 0x00d676ec, 
+    0x00d89879, 0x008d7559, 0x00734239, 0x0026af19, 0x006e9f13, 0x003b7233, 
+    0x00c54553, 0x0090a873, 0x009e46e6, 0x00cbabc6, 0x00359ca6, 0x00607186, 
+    0x00c6a8dc, 0x009345fc, 0x006d729c, 0x00389fbc, 0x00367129, 0x00639c09, 
+    0x009dab69, 0x00c84649, 0x00807643, 0x00d59b63, 0x002bac03, 0x007e4123, 
+    0x0070afb6, 0x00254296, 0x00db75f6, 0x008e98d6, 0x004b15e2, 0x001ef8c2, 
+    0x00e0cfa2, 0x00b52282, 0x00bbcc17, 0x00ee2137, 0x00101657, 0x0045fb77, 
+    0x000dcb7d, 0x0058265d, 0x00a6113d, 0x00f3fc1d, 0x00fd1288, 0x00a8ffa8, 
+    0x0056c8c8, 0x000325e8, 0x007abfd5, 0x002f52f5, 0x00d16595, 0x008488b5, 
+    0x008a6620, 0x00df8b00, 0x0021bc60, 0x00745140, 0x003c614a, 0x00698c6a, 
+    0x0097bb0a, 0x00c2562a, 0x00ccb8bf, 0x0099559f, 0x006762ff, 0x00328fdf, 
+    0x00f702eb, 0x00a2efcb, 0x005cd8ab, 0x0009358b, 0x0007db1e, 0x0052363e, 
+    0x00ac015e, 0x00f9ec7e, 0x00b1dc74, 0x00e43154, 0x001a0634, 0x004feb14, 
+    0x00410581, 0x0014e8a1, 0x00eadfc1, 0x00bf32e1},
+  {
+    0x00000000, 0x00e70ef9, 0x00697087, 0x008e7e7e, 0x00d2e10e, 0x0035eff7, 
+    0x00bb9189, 0x005c9f70, 0x0002af69, 0x00e5a190, 0x006bdfee, 0x008cd117, 
+    0x00d04e67, 0x0037409e, 0x00b93ee0, 0x005e3019, 0x00055ed2, 0x00e2502b, 
+    0x006c2e55, 0x008b20ac, 0x00d7bfdc, 0x0030b125, 0x00becf5b, 0x0059c1a2, 
+    0x0007f1bb, 0x00e0ff42, 0x006e813c, 0x00898fc5, 0x00d510b5, 0x00321e4c, 
+    0x00bc6032, 0x005b6ecb, 0x000abda4, 0x00edb35d, 0x0063cd23, 0x0084c3da, 
+    0x00d85caa, 0x003f5253, 0x00b12c2d, 0x005622d4, 0x000812cd, 0x00ef1c34, 
+    0x0061624a, 0x00866cb3, 0x00daf3c3, 0x003dfd3a, 0x00b38344, 0x00548dbd, 
+    0x000fe376, 0x00e8ed8f, 0x006693f1, 0x00819d08, 0x00dd0278, 0x003a0c81, 
+    0x00b472ff, 0x00537c06, 0x000d4c1f, 0x00ea42e6, 0x00643c98, 0x00833261, 
+    0x00dfad11, 0x0038a3e8, 0x00b6dd96, 0x0051d36f, 0x00157b48, 0x00f275b1, 
+    0x007c0bcf, 0x009b0536, 0x00c79a46, 0x002094bf, 0x00aeeac1, 0x0049e438, 
+    0x0017d421, 0x00f0dad8, 0x007ea4a6, 0x0099aa5f, 0x00c5352f, 0x00223bd6, 
+    0x00ac45a8, 0x004b4b51, 0x0010259a, 0x00f72b63, 0x0079551d, 0x009e5be4, 
+    0x00c2c494, 0x0025ca6d, 0x00abb413, 0x004cbaea, 0x00128af3, 0x00f5840a, 
+    0x007bfa74, 0x009cf48d, 0x00c06bfd, 0x00276504, 0x00a91b7a, 0x004e1583, 
+    0x001fc6ec, 0x00f8c815, 0x0076b66b, 0x0091b892, 0x00cd27e2, 0x002a291b, 
+    0x00a45765, 0x0043599c, 0x001d6985, 0x00fa677c, 0x00741902, 0x009317fb, 
+    0x00cf888b, 0x00288672, 0x00a6f80c, 0x0041f6f5, 0x001a983e, 0x00fd96c7, 
+    0x0073e8b9, 0x0094e640, 0x00c87930, 0x002f77c9, 0x00a109b7, 0x0046074e, 
+    0x00183757, 0x00ff39ae, 0x007147d0, 0x00964929, 0x00cad659, 0x002dd8a0, 
+    0x00a3a6de, 0x0044a827, 0x002af690, 0x00cdf869, 0x00438617, 0x00a488ee, 
+    0x00f8179e, 0x001f1967, 0x00916719, 0x007669e0, 0x002859f9, 0x00cf5700, 
+    0x0041297e, 0x00a62787, 0x00fab8f7, 0x001db60e, 0x0093c870, 0x0074c689, 
+    0x002fa842, 0x00c8a6bb, 0x0046d8c5, 0x00a1d63c, 0x00fd494c, 0x001a47b5, 
+    0x009439cb, 0x00733732, 0x002d072b, 0x00ca09d2, 0x004477ac, 0x00a37955, 
+    0x00ffe625, 0x0018e8dc, 0x009696a2, 0x0071985b, 0x00204b34, 0x00c745cd, 
+    0x00493bb3, 0x00ae354a, 0x00f2aa3a, 0x0015a4c3, 0x009bdabd, 0x007cd444, 
+    0x0022e45d, 0x00c5eaa4, 0x004b94da, 0x00ac9a23, 0x00f00553, 0x00170baa, 
+    0x009975d4, 0x007e7b2d, 0x002515e6, 0x00c21b1f, 0x004c6561, 0x00ab6b98, 
+    0x00f7f4e8, 0x0010fa11, 0x009e846f, 0x00798a96, 0x0027ba8f, 0x00c0b476, 
+    0x004eca08, 0x00a9c4f1, 0x00f55b81, 0x00125578, 0x009c2b06, 0x007b25ff, 
+    0x003f8dd8, 0x00d88321, 0x0056fd5f, 0x00b1f3a6, 0x00ed6cd6, 0x000a622f, 
+    0x00841c51, 0x006312a8, 0x003d22b1, 0x00da2c48, 0x00545236, 0x00b35ccf, 
+    0x00efc3bf, 0x0008cd46, 0x0086b338, 0x0061bdc1, 0x003ad30a, 0x00ddddf3, 
+    0x0053a38d, 0x00b4ad74, 0x00e83204, 0x000f3cfd, 0x00814283, 0x00664c7a, 
+    0x00387c63, 0x00df729a, 0x00510ce4, 0x00b6021d, 0x00ea9d6d, 0x000d9394, 
+    0x0083edea, 0x0064e313, 0x0035307c, 0x00d23e85, 0x005c40fb, 0x00bb4e02, 
+    0x00e7d172, 0x0000df8b, 0x008ea1f5, 0x0069af0c, 0x00379f15, 0x00d091ec, 
+    0x005eef92, 0x00b9e16b, 0x00e57e1b, 0x000270e2, 0x008c0e9c, 0x006b0065, 
+    0x00306eae, 0x00d76057, 0x00591e29, 0x00be10d0, 0x00e28fa0, 0x00058159, 
+    0x008bff27, 0x006cf1de, 0x0032c1c7, 0x00d5cf3e, 0x005bb140, 0x00bcbfb9, 
+    0x00e020c9, 0x00072e30, 0x0089504e, 0x006e5eb7},
+  {
+    0x00000000, 0x00247dc4, 0x0048fb88, 0x006c864c, 0x0091f710, 0x00b58ad4, 
+    0x00d90c98, 0x00fd715c, 0x00848355, 0x00a0fe91, 0x00cc78dd, 0x00e80519, 
+    0x00157445, 0x00310981, 0x005d8fcd, 0x0079f209, 0x00ae6bdf, 0x008a161b, 
+    0x00e69057, 0x00c2ed93, 0x003f9ccf, 0x001be10b, 0x00776747, 0x00531a83, 
+    0x002ae88a, 0x000e954e, 0x00621302, 0x00466ec6, 0x00bb1f9a, 0x009f625e, 
+    0x00f3e412, 0x00d799d6, 0x00fbbacb, 0x00dfc70f, 0x00b34143, 0x00973c87, 
+    0x006a4ddb, 0x004e301f, 0x0022b653, 0x0006cb97, 0x007f399e, 0x005b445a, 
+    0x0037c216, 0x0013bfd2, 0x00eece8e, 0x00cab34a, 0x00a63506, 0x008248c2, 
+    0x0055d114, 0x0071acd0, 0x001d2a9c, 0x00395758, 0x00c42604, 0x00e05bc0, 
+    0x008cdd8c, 0x00a8a048, 0x00d15241, 0x00f52f85, 0x0099a9c9, 0x00bdd40d, 
+    0x0040a551, 0x0064d895, 0x00085ed9, 0x002c231d, 0x005018e3, 0x00746527, 
+    0x0018e36b, 0x003c9eaf, 0x00c1eff3, 0x00e59237, 0x0089147b, 0x00ad69bf, 
+    0x00d49bb6, 0x00f0e672, 0x009c603e, 0x00b81dfa, 0x00456ca6, 0x00611162, 
+    0x000d972e, 0x0029eaea, 0x00fe733c, 0x00da0ef8, 0x00b688b4, 0x0092f570, 
+    0x006f842c, 0x004bf9e8, 0x00277fa4, 0x00030260, 0x007af069, 0x005e8dad, 
+    0x00320be1, 0x00167625, 0x00eb0779, 0x00cf7abd, 0x00a3fcf1, 0x00878135, 
+    0x00aba228, 0x008fdfec, 0x00e359a0, 0x00c72464, 0x003a5538, 0x001e28fc, 
+    0x0072aeb0, 0x0056d374, 0x002f217d, 0x000b5cb9, 0x0067daf5, 0x0043a731, 
+    0x00bed66d, 0x009aaba9, 0x00f62de5, 0x00d25021, 0x0005c9f7, 0x0021b433, 
+    0x004d327f, 0x00694fbb, 0x00943ee7, 0x00b04323, 0x00dcc56f, 0x00f8b8ab, 
+    0x00814aa2, 0x00a53766, 0x00c9b12a, 0x00edccee, 0x0010bdb2, 0x0034c076, 
+    0x0058463a, 0x007c3bfe, 0x00a031c6, 0x00844c02, 0x00e8ca4e, 0x00ccb78a, 
+    0x0031c6d6, 0x0015bb12, 0x00793d5e, 0x005d409a, 0x0024b293, 0x0000cf57, 
+    0x006c491b, 0x004834df, 0x00b54583, 0x00913847, 0x00fdbe0b, 0x00d9c3cf, 
+    0x000e5a19, 0x002a27dd, 0x0046a191, 0x0062dc55, 0x009fad09, 0x00bbd0cd, 
+    0x00d75681, 0x00f32b45, 0x008ad94c, 0x00aea488, 0x00c222c4, 0x00e65f00, 
+    0x001b2e5c, 0x003f5398, 0x0053d5d4, 0x0077a810, 0x005b8b0d, 0x007ff6c9, 
+    0x00137085, 0x00370d41, 0x00ca7c1d, 0x00ee01d9, 0x00828795, 0x00a6fa51, 
+    0x00df0858, 0x00fb759c, 0x0097f3d0, 0x00b38e14, 0x004eff48, 0x006a828c, 
+    0x000604c0, 0x00227904, 0x00f5e0d2, 0x00d19d16, 0x00bd1b5a, 0x0099669e, 
+    0x006417c2, 0x00406a06, 0x002cec4a, 0x0008918e, 0x00716387, 0x00551e43, 
+    0x0039980f, 0x001de5cb, 0x00e09497, 0x00c4e953, 0x00a86f1f, 0x008c12db, 
+    0x00f02925, 0x00d454e1, 0x00b8d2ad, 0x009caf69, 0x0061de35, 0x0045a3f1, 
+    0x002925bd, 0x000d5879, 0x0074aa70, 0x0050d7b4, 0x003c51f8, 0x00182c3c, 
+    0x00e55d60, 0x00c120a4, 0x00ada6e8, 0x0089db2c, 0x005e42fa, 0x007a3f3e, 
+    0x0016b972, 0x0032c4b6, 0x00cfb5ea, 0x00ebc82e, 0x00874e62, 0x00a333a6, 
+    0x00dac1af, 0x00febc6b, 0x00923a27, 0x00b647e3, 0x004b36bf, 0x006f4b7b, 
+    0x0003cd37, 0x0027b0f3, 0x000b93ee, 0x002fee2a, 0x00436866, 0x006715a2, 
+    0x009a64fe, 0x00be193a, 0x00d29f76, 0x00f6e2b2, 0x008f10bb, 0x00ab6d7f, 
+    0x00c7eb33, 0x00e396f7, 0x001ee7ab, 0x003a9a6f, 0x00561c23, 0x007261e7, 
+    0x00a5f831, 0x008185f5, 0x00ed03b9, 0x00c97e7d, 0x00340f21, 0x001072e5, 
+    0x007cf4a9, 0x0058896d, 0x00217b64, 0x000506a0, 0x006980ec, 0x004dfd28, 
+    0x00b08c74, 0x0094f1b0, 0x00f877fc, 0x00dc0a38},
+  {
+    0x00000000, 0x00751442, 0x00ea2884, 0x009f3cc6, 0x00733c7d, 0x0006283f, 
+    0x009914f9, 0x00ec00bb, 0x00e678fa, 0x00936cb8, 0x000c507e, 0x0079443c, 
+    0x00954487, 0x00e050c5, 0x007f6c03, 0x000a7841, 0x006b9c81, 0x001e88c3, 
+    0x0081b405, 0x00f4a047, 0x0018a0fc, 0x006db4be, 0x00f28878, 0x00879c3a, 
+    0x008de47b, 0x00f8f039, 0x0067ccff, 0x0012d8bd, 0x00fed806, 0x008bcc44, 
+    0x0014f082, 0x0061e4c0, 0x00d73902, 0x00a22d40, 0x003d1186, 0x004805c4, 
+    0x00a4057f, 0x00d1113d, 0x004e2dfb, 0x003b39b9, 0x003141f8, 0x004455ba, 
+    0x00db697c, 0x00ae7d3e, 0x00427d85, 0x003769c7, 0x00a85501, 0x00dd4143, 
+    0x00bca583, 0x00c9b1c1, 0x00568d07, 0x00239945, 0x00cf99fe, 0x00ba8dbc, 
+    0x0025b17a, 0x0050a538, 0x005add79, 0x002fc93b, 0x00b0f5fd, 0x00c5e1bf, 
+    0x0029e104, 0x005cf546, 0x00c3c980, 0x00b6ddc2, 0x00091f71, 0x007c0b33, 
+    0x00e337f5, 0x009623b7, 0x007a230c, 0x000f374e, 0x00900b88, 0x00e51fca, 
+    0x00ef678b, 0x009a73c9, 0x00054f0f, 0x00705b4d, 0x009c5bf6, 0x00e94fb4, 
+    0x00767372, 0x00036730, 0x006283f0, 0x001797b2, 0x0088ab74, 0x00fdbf36, 
+    0x0011bf8d, 0x0064abcf, 0x00fb9709, 0x008e834b, 0x0084fb0a, 0x00f1ef48, 
+    0x006ed38e, 0x001bc7cc, 0x00f7c777, 0x0082d335, 0x001deff3, 0x0068fbb1, 
+    0x00de2673, 0x00ab3231, 0x00340ef7, 0x00411ab5, 0x00ad1a0e, 0x00d80e4c, 
+    0x0047328a, 0x003226c8, 0x00385e89, 0x004d4acb, 0x00d2760d, 0x00a7624f, 
+    0x004b62f4, 0x003e76b6, 0x00a14a70, 0x00d45e32, 0x00b5baf2, 0x00c0aeb0, 
+    0x005f9276, 0x002a8634, 0x00c6868f, 0x00b392cd, 0x002cae0b, 0x0059ba49, 
+    0x0053c208, 0x0026d64a, 0x00b9ea8c, 0x00ccfece, 0x0020fe75, 0x0055ea37, 
+    0x00cad6f1, 0x00bfc2b3, 0x00123ee2, 0x00672aa0, 0x00f81666, 0x008d0224, 
+    0x0061029f, 0x001416dd, 0x008b2a1b, 0x00fe3e59, 0x00f44618, 0x0081525a, 
+    0x001e6e9c, 0x006b7ade, 0x00877a65, 0x00f26e27, 0x006d52e1, 0x001846a3, 
+    0x0079a263, 0x000cb621, 0x00938ae7, 0x00e69ea5, 0x000a9e1e, 0x007f8a5c, 
+    0x00e0b69a, 0x0095a2d8, 0x009fda99, 0x00eacedb, 0x0075f21d, 0x0000e65f, 
+    0x00ece6e4, 0x0099f2a6, 0x0006ce60, 0x0073da22, 0x00c507e0, 0x00b013a2, 
+    0x002f2f64, 0x005a3b26, 0x00b63b9d, 0x00c32fdf, 0x005c1319, 0x0029075b, 
+    0x00237f1a, 0x00566b58, 0x00c9579e, 0x00bc43dc, 0x00504367, 0x00255725, 
+    0x00ba6be3, 0x00cf7fa1, 0x00ae9b61, 0x00db8f23, 0x0044b3e5, 0x0031a7a7, 
+    0x00dda71c, 0x00a8b35e, 0x00378f98, 0x00429bda, 0x0048e39b, 0x003df7d9, 
+    0x00a2cb1f, 0x00d7df5d, 0x003bdfe6, 0x004ecba4, 0x00d1f762, 0x00a4e320, 
+    0x001b2193, 0x006e35d1, 0x00f10917, 0x00841d55, 0x00681dee, 0x001d09ac, 
+    0x0082356a, 0x00f72128, 0x00fd5969, 0x00884d2b, 0x001771ed, 0x006265af, 
+    0x008e6514, 0x00fb7156, 0x00644d90, 0x001159d2, 0x0070bd12, 0x0005a950, 
+    0x009a9596, 0x00ef81d4, 0x0003816f, 0x0076952d, 0x00e9a9eb, 0x009cbda9, 
+    0x0096c5e8, 0x00e3d1aa, 0x007ced6c, 0x0009f92e, 0x00e5f995, 0x0090edd7, 
+    0x000fd111, 0x007ac553, 0x00cc1891, 0x00b90cd3, 0x00263015, 0x00532457, 
+    0x00bf24ec, 0x00ca30ae, 0x00550c68, 0x0020182a, 0x002a606b, 0x005f7429, 
+    0x00c048ef, 0x00b55cad, 0x00595c16, 0x002c4854, 0x00b37492, 0x00c660d0, 
+    0x00a78410, 0x00d29052, 0x004dac94, 0x0038b8d6, 0x00d4b86d, 0x00a1ac2f, 
+    0x003e90e9, 0x004b84ab, 0x0041fcea, 0x0034e8a8, 0x00abd46e, 0x00dec02c, 
+    0x0032c097, 0x0047d4d5, 0x00d8e813, 0x00adfc51},
+  {
+    0x00000000, 0x000e00a5, 0x001c014a, 0x001201ef, 0x00380294, 0x00360231, 
+    0x002403de, 0x002a037b, 0x00700528, 0x007e058d, 0x006c0462, 0x006204c7, 
+    0x004807bc, 0x00460719, 0x005406f6, 0x005a0653, 0x00e00a50, 0x00ee0af5, 
+    0x00fc0b1a, 0x00f20bbf, 0x00d808c4, 0x00d60861, 0x00c4098e, 0x00ca092b, 
+    0x00900f78, 0x009e0fdd, 0x008c0e32, 0x00820e97, 0x00a80dec, 0x00a60d49, 
+    0x00b40ca6, 0x00ba0c03, 0x006779d5, 0x00697970, 0x007b789f, 0x0075783a, 
+    0x005f7b41, 0x00517be4, 0x00437a0b, 0x004d7aae, 0x00177cfd, 0x00197c58, 
+    0x000b7db7, 0x00057d12, 0x002f7e69, 0x00217ecc, 0x00337f23, 0x003d7f86, 
+    0x00877385, 0x00897320, 0x009b72cf, 0x0095726a, 0x00bf7111, 0x00b171b4, 
+    0x00a3705b, 0x00ad70fe, 0x00f776ad, 0x00f97608, 0x00eb77e7, 0x00e57742, 
+    0x00cf7439, 0x00c1749c, 0x00d37573, 0x00dd75d6, 0x00cef3aa, 0x00c0f30f, 
+    0x00d2f2e0, 0x00dcf245, 0x00f6f13e, 0x00f8f19b, 0x00eaf074, 0x00e4f0d1, 
+    0x00bef682, 0x00b0f627, 0x00a2f7c8, 0x00acf76d, 0x0086f416, 0x0088f4b3, 
+    0x009af55c, 0x0094f5f9, 0x002ef9fa, 0x0020f95f, 0x0032f8b0, 0x003cf815, 
+    0x0016fb6e, 0x0018fbcb, 0x000afa24, 0x0004fa81, 0x005efcd2, 0x0050fc77, 
+    0x0042fd98, 0x004cfd3d, 0x0066fe46, 0x0068fee3, 0x007aff0c, 0x0074ffa9, 
+    0x00a98a7f, 0x00a78ada, 0x00b58b35, 0x00bb8b90, 0x009188eb, 0x009f884e, 
+    0x008d89a1, 0x00838904, 0x00d98f57, 0x00d78ff2, 0x00c58e1d, 0x00cb8eb8, 
+    0x00e18dc3, 0x00ef8d66, 0x00fd8c89, 0x00f38c2c, 0x0049802f, 0x0047808a, 
+    0x00558165, 0x005b81c0, 0x007182bb, 0x007f821e, 0x006d83f1, 0x00638354, 
+    0x00398507, 0x003785a2, 0x0025844d, 0x002b84e8, 0x00018793, 0x000f8736, 
+    0x001d86d9, 0x0013867c, 0x003a8a21, 0x00348a84, 0x00268b6b, 0x00288bce, 
+    0x000288b5, 0x000c8810, 0x001e89ff, 0x0010895a, 0x004a8f09, 0x00448fac, 
+    0x00568e43, 0x00588ee6, 0x00728d9d, 0x007c8d38, 0x006e8cd7, 0x00608c72, 
+    0x00da8071, 0x00d480d4, 0x00c6813b, 0x00c8819e, 0x00e282e5, 0x00ec8240, 
+    0x00fe83af, 0x00f0830a, 0x00aa8559, 0x00a485fc, 0x00b68413, 0x00b884b6, 
+    0x009287cd, 0x009c8768, 0x008e8687, 0x00808622, 0x005df3f4, 0x0053f351, 
+    0x0041f2be, 0x004ff21b, 0x0065f160, 0x006bf1c5, 0x0079f02a, 0x0077f08f, 
+    0x002df6dc, 0x0023f679, 0x0031f796, 0x003ff733, 0x0015f448, 0x001bf4ed, 
+    0x0009f502, 0x0007f5a7, 0x00bdf9a4, 0x00b3f901, 0x00a1f8ee, 0x00aff84b, 
+    0x0085fb30, 0x008bfb95, 0x0099fa7a, 0x0097fadf, 0x00cdfc8c, 0x00c3fc29, 
+    0x00d1fdc6, 0x00dffd63, 0x00f5fe18, 0x00fbfebd, 0x00e9ff52, 0x00e7fff7, 
+    0x00f4798b, 0x00fa792e, 0x00e878c1, 0x00e67864, 0x00cc7b1f, 0x00c27bba, 
+    0x00d07a55, 0x00de7af0, 0x00847ca3, 0x008a7c06, 0x00987de9, 0x00967d4c, 
+    0x00bc7e37, 0x00b27e92, 0x00a07f7d, 0x00ae7fd8, 0x001473db, 0x001a737e, 
+    0x00087291, 0x00067234, 0x002c714f, 0x002271ea, 0x00307005, 0x003e70a0, 
+    0x006476f3, 0x006a7656, 0x007877b9, 0x0076771c, 0x005c7467, 0x005274c2, 
+    0x0040752d, 0x004e7588, 0x0093005e, 0x009d00fb, 0x008f0114, 0x008101b1, 
+    0x00ab02ca, 0x00a5026f, 0x00b70380, 0x00b90325, 0x00e30576, 0x00ed05d3, 
+    0x00ff043c, 0x00f10499, 0x00db07e2, 0x00d50747, 0x00c706a8, 0x00c9060d, 
+    0x00730a0e, 0x007d0aab, 0x006f0b44, 0x00610be1, 0x004b089a, 0x0045083f, 
+    0x005709d0, 0x00590975, 0x00030f26, 0x000d0f83, 0x001f0e6c, 0x00110ec9, 
+    0x003b0db2, 0x00350d17, 0x00270cf8, 0x00290c5d},
+  {
+    0x00000000, 0x00c86900, 0x0037bf75, 0x00ffd675, 0x006f7eea, 0x00a717ea, 
+    0x0058c19f, 0x0090a89f, 0x00defdd4, 0x001694d4, 0x00e942a1, 0x00212ba1, 
+    0x00b1833e, 0x0079ea3e, 0x00863c4b, 0x004e554b, 0x001a96dd, 0x00d2ffdd, 
+    0x002d29a8, 0x00e540a8, 0x0075e837, 0x00bd8137, 0x00425742, 0x008a3e42, 
+    0x00c46b09, 0x000c0209, 0x00f3d47c, 0x003bbd7c, 0x00ab15e3, 0x00637ce3, 
+    0x009caa96, 0x0054c396, 0x00352dba, 0x00fd44ba, 0x000292cf, 0x00cafbcf, 
+    0x005a5350, 0x00923a50, 0x006dec25, 0x00a58525, 0x00ebd06e, 0x0023b96e, 
+    0x00dc6f1b, 0x0014061b, 0x0084ae84, 0x004cc784, 0x00b311f1, 0x007b78f1, 
+    0x002fbb67, 0x00e7d267, 0x00180412, 0x00d06d12, 0x0040c58d, 0x0088ac8d, 
+    0x00777af8, 0x00bf13f8, 0x00f146b3, 0x00392fb3, 0x00c6f9c6, 0x000e90c6, 
+    0x009e3859, 0x00565159, 0x00a9872c, 0x0061ee2c, 0x006a5b74, 0x00a23274, 
+    0x005de401, 0x00958d01, 0x0005259e, 0x00cd4c9e, 0x00329aeb, 0x00faf3eb, 
+    0x00b4a6a0, 0x007ccfa0, 0x008319d5, 0x004b70d5, 0x00dbd84a, 0x0013b14a, 
+    0x00ec673f, 0x00240e3f, 0x0070cda9, 0x00b8a4a9, 0x004772dc, 0x008f1bdc, 
+    0x001fb343, 0x00d7da43, 0x00280c36, 0x00e06536, 0x00ae307d, 0x0066597d, 
+    0x00998f08, 0x0051e608, 0x00c14e97, 0x00092797, 0x00f6f1e2, 0x003e98e2, 
+    0x005f76ce, 0x00971fce, 0x0068c9bb, 0x00a0a0bb, 0x00300824, 0x00f86124, 
+    0x0007b751, 0x00cfde51, 0x00818b1a, 0x0049e21a, 0x00b6346f, 0x007e5d6f, 
+    0x00eef5f0, 0x00269cf0, 0x00d94a85, 0x00112385, 0x0045e013, 0x008d8913, 
+    0x00725f66, 0x00ba3666, 0x002a9ef9, 0x00e2f7f9, 0x001d218c, 0x00d5488c, 
+    0x009b1dc7, 0x005374c7, 0x00aca2b2, 0x0064cbb2, 0x00f4632d, 0x003c0a2d, 
+    0x00c3dc58, 0x000bb558, 0x00d4b6e8, 0x001cdfe8, 0x00e3099d, 0x002b609d, 
+    0x00bbc802, 0x0073a102, 0x008c7777, 0x00441e77, 0x000a4b3c, 0x00c2223c, 
+    0x003df449, 0x00f59d49, 0x006535d6, 0x00ad5cd6, 0x00528aa3, 0x009ae3a3, 
+    0x00ce2035, 0x00064935, 0x00f99f40, 0x0031f640, 0x00a15edf, 0x006937df, 
+    0x0096e1aa, 0x005e88aa, 0x0010dde1, 0x00d8b4e1, 0x00276294, 0x00ef0b94, 
+    0x007fa30b, 0x00b7ca0b, 0x00481c7e, 0x0080757e, 0x00e19b52, 0x0029f252, 
+    0x00d62427, 0x001e4d27, 0x008ee5b8, 0x00468cb8, 0x00b95acd, 0x007133cd, 
+    0x003f6686, 0x00f70f86, 0x0008d9f3, 0x00c0b0f3, 0x0050186c, 0x0098716c, 
+    0x0067a719, 0x00afce19, 0x00fb0d8f, 0x0033648f, 0x00ccb2fa, 0x0004dbfa, 
+    0x00947365, 0x005c1a65, 0x00a3cc10, 0x006ba510, 0x0025f05b, 0x00ed995b, 
+    0x00124f2e, 0x00da262e, 0x004a8eb1, 0x0082e7b1, 0x007d31c4, 0x00b558c4, 
+    0x00beed9c, 0x0076849c, 0x008952e9, 0x00413be9, 0x00d19376, 0x0019fa76, 
+    0x00e62c03, 0x002e4503, 0x00601048, 0x00a87948, 0x0057af3d, 0x009fc63d, 
+    0x000f6ea2, 0x00c707a2, 0x0038d1d7, 0x00f0b8d7, 0x00a47b41, 0x006c1241, 
+    0x0093c434, 0x005bad34, 0x00cb05ab, 0x00036cab, 0x00fcbade, 0x0034d3de, 
+    0x007a8695, 0x00b2ef95, 0x004d39e0, 0x008550e0, 0x0015f87f, 0x00dd917f, 
+    0x0022470a, 0x00ea2e0a, 0x008bc026, 0x0043a926, 0x00bc7f53, 0x00741653, 
+    0x00e4becc, 0x002cd7cc, 0x00d301b9, 0x001b68b9, 0x00553df2, 0x009d54f2, 
+    0x00628287, 0x00aaeb87, 0x003a4318, 0x00f22a18, 0x000dfc6d, 0x00c5956d, 
+    0x009156fb, 0x00593ffb, 0x00a6e98e, 0x006e808e, 0x00fe2811, 0x00364111, 
+    0x00c99764, 0x0001fe64, 0x004fab2f, 0x0087c22f, 0x0078145a, 0x00b07d5a, 
+    0x0020d5c5, 0x00e8bcc5, 0x00176ab0, 0x00df03b0},
+  {
+    0x00000000, 0x0000c869, 0x000190d2, 0x000158bb, 0x000321a4, 0x0003e9cd, 
+    0x0002b176, 0x0002791f, 0x00064348, 0x00068b21, 0x0007d39a, 0x00071bf3, 
+    0x000562ec, 0x0005aa85, 0x0004f23e, 0x00043a57, 0x000c8690, 0x000c4ef9, 
+    0x000d1642, 0x000dde2b, 0x000fa734, 0x000f6f5d, 0x000e37e6, 0x000eff8f, 
+    0x000ac5d8, 0x000a0db1, 0x000b550a, 0x000b9d63, 0x0009e47c, 0x00092c15, 
+    0x000874ae, 0x0008bcc7, 0x00190d20, 0x0019c549, 0x00189df2, 0x0018559b, 
+    0x001a2c84, 0x001ae4ed, 0x001bbc56, 0x001b743f, 0x001f4e68, 0x001f8601, 
+    0x001edeba, 0x001e16d3, 0x001c6fcc, 0x001ca7a5, 0x001dff1e, 0x001d3777, 
+    0x00158bb0, 0x001543d9, 0x00141b62, 0x0014d30b, 0x0016aa14, 0x0016627d, 
+    0x00173ac6, 0x0017f2af, 0x0013c8f8, 0x00130091, 0x0012582a, 0x00129043, 
+    0x0010e95c, 0x00102135, 0x0011798e, 0x0011b1e7, 0x00321a40, 0x0032d229, 
+    0x00338a92, 0x003342fb, 0x00313be4, 0x0031f38d, 0x0030ab36, 0x0030635f, 
+    0x00345908, 0x00349161, 0x0035c9da, 0x003501b3, 0x003778ac, 0x0037b0c5, 
+    0x0036e87e, 0x00362017, 0x003e9cd0, 0x003e54b9, 0x003f0c02, 0x003fc46b, 
+    0x003dbd74, 0x003d751d, 0x003c2da6, 0x003ce5cf, 0x0038df98, 0x003817f1, 
+    0x00394f4a, 0x00398723, 0x003bfe3c, 0x003b3655, 0x003a6eee, 0x003aa687, 
+    0x002b1760, 0x002bdf09, 0x002a87b2, 0x002a4fdb, 0x002836c4, 0x0028fead, 
+    0x0029a616, 0x00296e7f, 0x002d5428, 0x002d9c41, 0x002cc4fa, 0x002c0c93, 
+    0x002e758c, 0x002ebde5, 0x002fe55e, 0x002f2d37, 0x002791f0, 0x00275999, 
+    0x00260122, 0x0026c94b, 0x0024b054, 0x0024783d, 0x00252086, 0x0025e8ef, 
+    0x0021d2b8, 0x00211ad1, 0x0020426a, 0x00208a03, 0x0022f31c, 0x00223b75, 
+    0x002363ce, 0x0023aba7, 0x00643480, 0x0064fce9, 0x0065a452, 0x00656c3b, 
+    0x00671524, 0x0067dd4d, 0x006685f6, 0x00664d9f, 0x006277c8, 0x0062bfa1, 
+    0x0063e71a, 0x00632f73, 0x0061566c, 0x00619e05, 0x0060c6be, 0x00600ed7, 
+    0x0068b210, 0x00687a79, 0x006922c2, 0x0069eaab, 0x006b93b4, 0x006b5bdd, 
+    0x006a0366, 0x006acb0f, 0x006ef158, 0x006e3931, 0x006f618a, 0x006fa9e3, 
+    0x006dd0fc, 0x006d1895, 0x006c402e, 0x006c8847, 0x007d39a0, 0x007df1c9, 
+    0x007ca972, 0x007c611b, 0x007e1804, 0x007ed06d, 0x007f88d6, 0x007f40bf, 
+    0x007b7ae8, 0x007bb281, 0x007aea3a, 0x007a2253, 0x00785b4c, 0x00789325, 
+    0x0079cb9e, 0x007903f7, 0x0071bf30, 0x00717759, 0x00702fe2, 0x0070e78b, 
+    0x00729e94, 0x007256fd, 0x00730e46, 0x0073c62f, 0x0077fc78, 0x00773411, 
+    0x00766caa, 0x0076a4c3, 0x0074dddc, 0x007415b5, 0x00754d0e, 0x00758567, 
+    0x00562ec0, 0x0056e6a9, 0x0057be12, 0x0057767b, 0x00550f64, 0x0055c70d, 
+    0x00549fb6, 0x005457df, 0x00506d88, 0x0050a5e1, 0x0051fd5a, 0x00513533, 
+    0x00534c2c, 0x00538445, 0x0052dcfe, 0x00521497, 0x005aa850, 0x005a6039, 
+    0x005b3882, 0x005bf0eb, 0x005989f4, 0x0059419d, 0x00581926, 0x0058d14f, 
+    0x005ceb18, 0x005c2371, 0x005d7bca, 0x005db3a3, 0x005fcabc, 0x005f02d5, 
+    0x005e5a6e, 0x005e9207, 0x004f23e0, 0x004feb89, 0x004eb332, 0x004e7b5b, 
+    0x004c0244, 0x004cca2d, 0x004d9296, 0x004d5aff, 0x004960a8, 0x0049a8c1, 
+    0x0048f07a, 0x00483813, 0x004a410c, 0x004a8965, 0x004bd1de, 0x004b19b7, 
+    0x0043a570, 0x00436d19, 0x004235a2, 0x0042fdcb, 0x004084d4, 0x00404cbd, 
+    0x00411406, 0x0041dc6f, 0x0045e638, 0x00452e51, 0x004476ea, 0x0044be83, 
+    0x0046c79c, 0x00460ff5, 0x0047574e, 0x00479f27}
+};
+
+const unsigned int liquid_crc32_gentab[8][256] = {
+  {
+    0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f, 
+    0xe963a535, 0x9e6495a3, 0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988, 
+    0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91, 0x1db71064, 0x6ab020f2, 
+    0xf3b97148, 0x84be41de, 0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7, 
+    0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec, 0x14015c4f, 0x63066cd9, 
+    0xfa0f3d63, 0x8d080df5, 0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172, 
+    0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b, 0x35b5a8fa, 0x42b2986c, 
+    0xdbbbc9d6, 0xacbcf940, 0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59, 
+    0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116, 0x21b4f4b5, 0x56b3c423, 
+    0xcfba9599, 0xb8bda50f, 0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924, 
+    0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d, 0x76dc4190, 0x01db7106, 
+    0x98d220bc, 0xefd5102a, 0x71b18589, 0x06b6b51f, 0x9fbfe4a5, 0xe8b8d433, 
+    0x7807c9a2, 0x0f00f934, 0x9609a88e, 0xe10e9818, 0x7f6a0dbb, 0x086d3d2d, 
+    0x91646c97, 0xe6635c01, 0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e, 
+    0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457, 0x65b0d9c6, 0x12b7e950, 
+    0x8bbeb8ea, 0xfcb9887c, 0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65, 
+    0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2, 0x4adfa541, 0x3dd895d7, 
+    0xa4d1c46d, 0xd3d6f4fb, 0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0, 
+    0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9, 0x5005713c, 0x270241aa, 
+    0xbe0b1010, 0xc90c2086, 0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f, 
+    0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4, 0x59b33d17, 0x2eb40d81, 
+    0xb7bd5c3b, 0xc0ba6cad, 0xedb88320, 0x9abfb3b6, 0x03b6e20c, 0x74b1d29a, 
+    0xead54739, 0x9dd277af, 0x04db2615, 0x73dc1683, 0xe3630b12, 0x94643b84, 
+    0x0d6d6a3e, 0x7a6a5aa8, 0xe40ecf0b, 0x9309ff9d, 0x0a00ae27, 0x7d079eb1, 
+    0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe, 0xf762575d, 0x806567cb, 
+    0x196c3671, 0x6e6b06e7, 0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc, 
+    0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5, 0xd6d6a3e8, 0xa1d1937e, 
+    0x38d8c2c4, 0x4fdff252, 0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b, 
+    0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60, 0xdf60efc3, 0xa867df55, 
+    0x316e8eef, 0x4669be79, 0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236, 
+    0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f, 0xc5ba3bbe, 0xb2bd0b28, 
+    0x2bb45a92, 0x5cb36a04, 0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d, 
+    0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x026d930a, 0x9c0906a9, 0xeb0e363f, 
+    0x72076785, 0x05005713, 0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0x0cb61b38, 
+    0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0x0bdbdf21, 0x86d3d2d4, 0xf1d4e242, 
+    0x68ddb3f8, 0x1fda836e, 0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777, 
+    0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c, 0x8f659eff, 0xf862ae69, 
+    0x616bffd3, 0x166ccf45, 0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2, 
+    0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db, 0xaed16a4a, 0xd9d65adc, 
+    0x40df0b66, 0x37d83bf0, 0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9, 
+    0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693, 
+    0x54de5729, 0x23d967bf, 0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 
+    0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d},
+  {
+    0x00000000, 0x191b3141, 0x32366282, 0x2b2d53c3, 0x646cc504, 0x7d77f445, 
+    0x565aa786, 0x4f4196c7, 0xc8d98a08, 0xd1c2bb49, 0xfaefe88a, 0xe3f4d9cb, 
+    0xacb54f0c, 0xb5ae7e4d, 0x9e832d8e, 0x87981ccf, 0x4ac21251, 0x53d92310, 
+    0x78f470d3, 0x61ef4192, 0x2eaed755, 0x37b5e614, 0x1c98b5d7, 0x05838496, 
+    0x821b9859, 0x9b00a918, 0xb02dfadb, 0xa936cb9a, 0xe6775d5d, 0xff6c6c1c, 
+    0xd4413fdf, 0xcd5a0e9e, 0x958424a2, 0x8c9f15e3, 0xa7b24620, 0xbea97761, 
+    0xf1e8e1a6, 0xe8f3d0e7, 0xc3de8324, 0xdac5b265, 0x5d5daeaa, 0x44469feb, 
+    0x6f6bcc28, 0x7670fd69, 0x39316bae, 0x202a5aef, 0x0b07092c, 0x121c386d, 
+    0xdf4636f3, 0xc65d07b2, 0xed705471, 0xf46b6530, 0xbb2af3f7, 0xa231c2b6, 
+    0x891c9175, 0x9007a034, 0x179fbcfb, 0x0e848dba, 0x25a9de79, 0x3cb2ef38, 
+    0x73f379ff, 0x6ae848be, 0x41c51b7d, 0x58de2a3c, 0xf0794f05, 0xe9627e44, 
+    0xc24f2d87, 0xdb541cc6, 0x94158a01, 0x8d0ebb40, 0xa623e883, 0xbf38d9c2, 
+    0x38a0c50d, 0x21bbf44c, 0x0a96a78f, 0x138d96ce, 0x5ccc0009, 0x45d73148, 
+    0x6efa628b, 0x77e153ca, 0xbabb5d54, 0xa3a06c15, 0x888d3fd6, 0x91960e97, 
+    0xded79850, 0xc7cca911, 0xece1fad2, 0xf5facb93, 0x7262d75c, 0x6b79e61d, 
+    0x4054b5de, 0x594f849f, 0x160e1258, 0x0f152319, 0x243870da, 0x3d23419b, 
+    0x65fd6ba7, 0x7ce65ae6, 0x57cb0925, 0x4ed03864, 0x0191aea3, 0x188a9fe2, 
+    0x33a7cc21, 0x2abcfd60, 0xad24e1af, 0xb43fd0ee, 0x9f12832d, 0x8609b26c, 
+    0xc94824ab, 0xd05315ea, 0xfb7e4629, 0xe2657768, 0x2f3f79f6, 0x362448b7, 
+    0x1d091b74, 0x04122a35, 0x4b53bcf2, 0x52488db3, 0x7965de70, 0x607eef31, 
+    0xe7e6f3fe, 0xfefdc2bf, 0xd5d0917c, 0xcccba03d, 0x838a36fa, 0x9a9107bb, 
+    0xb1bc5478, 0xa8a76539, 0x3b83984b, 0x2298a90a, 0x09b5fac9, 0x10aecb88, 
+    0x5fef5d4f, 0x46f46c0e, 0x6dd93fcd, 0x74c20e8c, 0xf35a1243, 0xea412302, 
+    0xc16c70c1, 0xd8774180, 0x9736d747, 0x8e2de606, 0xa500b5c5, 0xbc1b8484, 
+    0x71418a1a, 0x685abb5b, 0x4377e898, 0x5a6cd9d9, 0x152d4f1e, 0x0c367e5f, 
+    0x271b2d9c, 0x3e001cdd, 0xb9980012, 0xa0833153, 0x8bae6290, 0x92b553d1, 
+    0xddf4c516, 0xc4eff457, 0xefc2a794, 0xf6d996d5, 0xae07bce9, 0xb71c8da8, 
+    0x9c31de6b, 0x852aef2a, 0xca6b79ed, 0xd37048ac, 0xf85d1b6f, 0xe1462a2e, 
+    0x66de36e1, 0x7fc507a0, 0x54e85463, 0x4df36522, 0x02b2f3e5, 0x1ba9c2a4, 
+    0x30849167, 0x299fa026, 0xe4c5aeb8, 0xfdde9ff9, 0xd6f3cc3a, 0xcfe8fd7b, 
+    0x80a96bbc, 0x99b25afd, 0xb29f093e, 0xab84387f, 0x2c1c24b0, 0x350715f1, 
+    0x1e2a4632, 0x07317773, 0x4870e1b4, 0x516bd0f5, 0x7a468336, 0x635db277, 
+    0xcbfad74e, 0xd2e1e60f, 0xf9ccb5cc, 0xe0d7848d, 0xaf96124a, 0xb68d230b, 
+    0x9da070c8, 0x84bb4189, 0x03235d46, 0x1a386c07, 0x31153fc4, 0x280e0e85, 
+    0x674f9842, 0x7e54a903, 0x5579fac0, 0x4c62cb81, 0x8138c51f, 0x9823f45e, 
+    0xb30ea79d, 0xaa1596dc, 0xe554001b, 0xfc4f315a, 0xd7626299, 0xce7953d8, 
+    0x49e14f17, 0x50fa7e56, 0x7bd72d95, 0x62cc1cd4, 0x2d8d8a13, 0x3496bb52, 
+    0x1fbbe891, 0x06a0d9d0, 0x5e7ef3ec, 0x4765c2ad, 0x6c48916e, 0x7553a02f, 
+    0x3a1236e8, 0x230907a9, 0x0824546a, 0x113f652b, 0x96a779e4, 0x8fbc48a5, 
+    0xa4911b66, 0xbd8a2a27, 0xf2cbbce0, 0xebd08da1, 0xc0fdde62, 0xd9e6ef23, 
+    0x14bce1bd, 0x0da7d0fc, 0x268a833f, 0x3f91b27e, 0x70d024b9, 0x69cb15f8, 
+    0x42e6463b, 0x5bfd777a, 0xdc656bb5, 0xc57e5af4, 0xee530937, 0xf7483876, 
+    0xb809aeb1, 0xa1129ff0, 0x8a3fcc33, 0x9324fd72},
+  {
+    0x00000000, 0x01c26a37, 0x0384d46e, 0x0246be59, 0x0709a8dc, 0x06cbc2eb, 
+    0x048d7cb2, 0x054f1685, 0x0e1351b8, 0x0fd13b8f, 0x0d9785d6, 0x0c55efe1, 
+    0x091af964, 0x08d89353, 0x0a9e2d0a, 0x0b5c473d, 0x1c26a370, 0x1de4c947, 
+    0x1fa2771e, 0x1e601d29, 0x1b2f0bac, 0x1aed619b, 0x18abdfc2, 0x1969b5f5, 
+    0x1235f2c8, 0x13f798ff, 0x11b126a6, 0x10734c91, 0x153c5a14, 0x14fe3023, 
+    0x16b88e7a, 0x177ae44d, 0x384d46e0, 0x398f2cd7, 0x3bc9928e, 0x3a0bf8b9, 
+    0x3f44ee3c, 0x3e86840b, 0x3cc03a52, 0x3d025065, 0x365e1758, 0x379c7d6f, 
+    0x35dac336, 0x3418a901, 0x3157bf84, 0x3095d5b3, 0x32d36bea, 0x331101dd, 
+    0x246be590, 0x25a98fa7, 0x27ef31fe, 0x262d5bc9, 0x23624d4c, 0x22a0277b, 
+    0x20e69922, 0x2124f315, 0x2a78b428, 0x2bbade1f, 0x29fc6046, 0x283e0a71, 
+    0x2d711cf4, 0x2cb376c3, 0x2ef5c89a, 0x2f37a2ad, 0x709a8dc0, 0x7158e7f7, 
+    0x731e59ae, 0x72dc3399, 0x7793251c, 0x76514f2b, 0x7417f172, 0x75d59b45, 
+    0x7e89dc78, 0x7f4bb64f, 0x7d0d0816, 0x7ccf6221, 0x798074a4, 0x78421e93, 
+    0x7a04a0ca, 0x7bc6cafd, 0x6cbc2eb0, 0x6d7e4487, 0x6f38fade, 0x6efa90e9, 
+    0x6bb5866c, 0x6a77ec5b, 0x68315202, 0x69f33835, 0x62af7f08, 0x636d153f, 
+    0x612bab66, 0x60e9c151, 0x65a6d7d4, 0x6464bde3, 0x662203ba, 0x67e0698d, 
+    0x48d7cb20, 0x4915a117, 0x4b531f4e, 0x4a917579, 0x4fde63fc, 0x4e1c09cb, 
+    0x4c5ab792, 0x4d98dda5, 0x46c49a98, 0x4706f0af, 0x45404ef6, 0x448224c1, 
+    0x41cd3244, 0x400f5873, 0x4249e62a, 0x438b8c1d, 0x54f16850, 0x55330267, 
+    0x5775bc3e, 0x56b7d609, 0x53f8c08c, 0x523aaabb, 0x507c14e2, 0x51be7ed5, 
+    0x5ae239e8, 0x5b2053df, 0x5966ed86, 0x58a487b1, 0x5deb9134, 0x5c29fb03, 
+    0x5e6f455a, 0x5fad2f6d, 0xe1351b80, 0xe0f771b7, 0xe2b1cfee, 0xe373a5d9, 
+    0xe63cb35c, 0xe7fed96b, 0xe5b86732, 0xe47a0d05, 0xef264a38, 0xeee4200f, 
+    0xeca29e56, 0xed60f461, 0xe82fe2e4, 0xe9ed88d3, 0xebab368a, 0xea695cbd, 
+    0xfd13b8f0, 0xfcd1d2c7, 0xfe976c9e, 0xff5506a9, 0xfa1a102c, 0xfbd87a1b, 
+    0xf99ec442, 0xf85cae75, 0xf300e948, 0xf2c2837f, 0xf0843d26, 0xf1465711, 
+    0xf4094194, 0xf5cb2ba3, 0xf78d95fa, 0xf64fffcd, 0xd9785d60, 0xd8ba3757, 
+    0xdafc890e, 0xdb3ee339, 0xde71f5bc, 0xdfb39f8b, 0xddf521d2, 0xdc374be5, 
+    0xd76b0cd8, 0xd6a966ef, 0xd4efd8b6, 0xd52db281, 0xd062a404, 0xd1a0ce33, 
+    0xd3e6706a, 0xd2241a5d, 0xc55efe10, 0xc49c9427, 0xc6da2a7e, 0xc7184049, 
+    0xc25756cc, 0xc3953cfb, 0xc1d382a2, 0xc011e895, 0xcb4dafa8, 0xca8fc59f, 
+    0xc8c97bc6, 0xc90b11f1, 0xcc440774, 0xcd866d43, 0xcfc0d31a, 0xce02b92d, 
+    0x91af9640, 0x906dfc77, 0x922b422e, 0x93e92819, 0x96a63e9c, 0x976454ab, 
+    0x9522eaf2, 0x94e080c5, 0x9fbcc7f8, 0x9e7eadcf, 0x9c381396, 0x9dfa79a1, 
+    0x98b56f24, 0x99770513, 0x9b31bb4a, 0x9af3d17d, 0x8d893530, 0x8c4b5f07, 
+    0x8e0de15e, 0x8fcf8b69, 0x8a809dec, 0x8b42f7db, 0x89044982, 0x88c623b5, 
+    0x839a6488, 0x82580ebf, 0x801eb0e6, 0x81dcdad1, 0x8493cc54, 0x8551a663, 
+    0x8717183a, 0x86d5720d, 0xa9e2d0a0, 0xa820ba97, 0xaa6604ce, 0xaba46ef9, 
+    0xaeeb787c, 0xaf29124b, 0xad6fac12, 0xacadc625, 0xa7f18118, 0xa633eb2f, 
+    0xa4755576, 0xa5b73f41, 0xa0f829c4, 0xa13a43f3, 0xa37cfdaa, 0xa2be979d, 
+    0xb5c473d0, 0xb40619e7, 0xb640a7be, 0xb782cd89, 0xb2cddb0c, 0xb30fb13b, 
+    0xb1490f62, 0xb08b6555, 0xbbd72268, 0xba15485f, 0xb853f606, 0xb9919c31, 
+    0xbcde8ab4, 0xbd1ce083, 0xbf5a5eda, 0xbe9834ed},
+  {
+    0x00000000, 0xb8bc6765, 0xaa09c88b, 0x12b5afee, 0x8f629757, 0x37def032, 
+    0x256b5fdc, 0x9dd738b9, 0xc5b428ef, 0x7d084f8a, 0x6fbde064, 0xd7018701, 
+    0x4ad6bfb8, 0xf26ad8dd, 0xe0df7733, 0x58631056, 0x5019579f, 0xe8a530fa, 
+    0xfa109f14, 0x42acf871, 0xdf7bc0c8, 0x67c7a7ad, 0x75720843, 0xcdce6f26, 
+    0x95ad7f70, 0x2d111815, 0x3fa4b7fb, 0x8718d09e, 0x1acfe827, 0xa2738f42, 
+    0xb0c620ac, 0x087a47c9, 0xa032af3e, 0x188ec85b, 0x0a3b67b5, 0xb28700d0, 
+    0x2f503869, 0x97ec5f0c, 0x8559f0e2, 0x3de59787, 0x658687d1, 0xdd3ae0b4, 
+    0xcf8f4f5a, 0x7733283f, 0xeae41086, 0x525877e3, 0x40edd80d, 0xf851bf68, 
+    0xf02bf8a1, 0x48979fc4, 0x5a22302a, 0xe29e574f, 0x7f496ff6, 0xc7f50893, 
+    0xd540a77d, 0x6dfcc018, 0x359fd04e, 0x8d23b72b, 0x9f9618c5, 0x272a7fa0, 
+    0xbafd4719, 0x0241207c, 0x10f48f92, 0xa848e8f7, 0x9b14583d, 0x23a83f58, 
+    0x311d90b6, 0x89a1f7d3, 0x1476cf6a, 0xaccaa80f, 0xbe7f07e1, 0x06c36084, 
+    0x5ea070d2, 0xe61c17b7, 0xf4a9b859, 0x4c15df3c, 0xd1c2e785, 0x697e80e0, 
+    0x7bcb2f0e, 0xc377486b, 0xcb0d0fa2, 0x73b168c7, 0x6104c729, 0xd9b8a04c, 
+    0x446f98f5, 0xfcd3ff90, 0xee66507e, 0x56da371b, 0x0eb9274d, 0xb6054028, 
+    0xa4b0efc6, 0x1c0c88a3, 0x81dbb01a, 0x3967d77f, 0x2bd27891, 0x936e1ff4, 
+    0x3b26f703, 0x839a9066, 0x912f3f88, 0x299358ed, 0xb4446054, 0x0cf80731, 
+    0x1e4da8df, 0xa6f1cfba, 0xfe92dfec, 0x462eb889, 0x549b1767, 0xec277002, 
+    0x71f048bb, 0xc94c2fde, 0xdbf98030, 0x6345e755, 0x6b3fa09c, 0xd383c7f9, 
+    0xc1366817, 0x798a0f72, 0xe45d37cb, 0x5ce150ae, 0x4e54ff40, 0xf6e89825, 
+    0xae8b8873, 0x1637ef16, 0x048240f8, 0xbc3e279d, 0x21e91f24, 0x99557841, 
+    0x8be0d7af, 0x335cb0ca, 0xed59b63b, 0x55e5d15e, 0x47507eb0, 0xffec19d5, 
+    0x623b216c, 0xda874609, 0xc832e9e7, 0x708e8e82, 0x28ed9ed4, 0x9051f9b1, 
+    0x82e4565f, 0x3a58313a, 0xa78f0983, 0x1f336ee6, 0x0d86c108, 0xb53aa66d, 
+    0xbd40e1a4, 0x05fc86c1, 0x1749292f, 0xaff54e4a, 0x322276f3, 0x8a9e1196, 
+    0x982bbe78, 0x2097d91d, 0x78f4c94b, 0xc048ae2e, 0xd2fd01c0, 0x6a4166a5, 
+    0xf7965e1c, 0x4f2a3979, 0x5d9f9697, 0xe523f1f2, 0x4d6b1905, 0xf5d77e60, 
+    0xe762d18e, 0x5fdeb6eb, 0xc2098e52, 0x7ab5e937, 0x680046d9, 0xd0bc21bc, 
+    0x88df31ea, 0x3063568f, 0x22d6f961, 0x9a6a9e04, 0x07bda6bd, 0xbf01c1d8, 
+    0xadb46e36, 0x15080953, 0x1d724e9a, 0xa5ce29ff, 0xb77b8611, 0x0fc7e174, 
+    0x9210d9cd, 0x2aacbea8, 0x38191146, 0x80a57623, 0xd8c66675, 0x607a0110, 
+    0x72cfaefe, 0xca73c99b, 0x57a4f122, 0xef189647, 0xfdad39a9, 0x45115ecc, 
+    0x764dee06, 0xcef18963, 0xdc44268d, 0x64f841e8, 0xf92f7951, 0x41931e34, 
+    0x5326b1da, 0xeb9ad6bf, 0xb3f9c6e9, 0x0b45a18c, 0x19f00e62, 0xa14c6907, 
+    0x3c9b51be, 0x842736db, 0x96929935, 0x2e2efe50, 0x2654b999, 0x9ee8defc, 
+    0x8c5d7112, 0x34e11677, 0xa9362ece, 0x118a49ab, 0x033fe645, 0xbb838120, 
+    0xe3e09176, 0x5b5cf613, 0x49e959fd, 0xf1553e98, 0x6c820621, 0xd43e6144, 
+    0xc68bceaa, 0x7e37a9cf, 0xd67f4138, 0x6ec3265d, 0x7c7689b3, 0xc4caeed6, 
+    0x591dd66f, 0xe1a1b10a, 0xf3141ee4, 0x4ba87981, 0x13cb69d7, 0xab770eb2, 
+    0xb9c2a15c, 0x017ec639, 0x9ca9fe80, 0x241599e5, 0x36a0360b, 0x8e1c516e, 
+    0x866616a7, 0x3eda71c2, 0x2c6fde2c, 0x94d3b949, 0x090481f0, 0xb1b8e695, 
+    0xa30d497b, 0x1bb12e1e, 0x43d23e48, 0xfb6e592d, 0xe9dbf6c3, 0x516791a6, 
+    0xccb0a91f, 0x740cce7a, 0x66b96194, 0xde0506f1},
+  {
+    0x00000000, 0x3d6029b0, 0x7ac05360, 0x47a07ad0, 0xf580a6c0, 0xc8e08f70, 
+    0x8f40f5a0, 0xb220dc10, 0x30704bc1, 0x0d106271, 0x4ab018a1, 0x77d03111, 
+    0xc5f0ed01, 0xf890c4b1, 0xbf30be61, 0x825097d1, 0x60e09782, 0x5d80be32, 
+    0x1a20c4e2, 0x2740ed52, 0x95603142, 0xa80018f2, 0xefa06222, 0xd2c04b92, 
+    0x5090dc43, 0x6df0f5f3, 0x2a508f23, 0x1730a693, 0xa5107a83, 0x98705333, 
+    0xdfd029e3, 0xe2b00053, 0xc1c12f04, 0xfca106b4, 0xbb017c64, 0x866155d4, 
+    0x344189c4, 0x0921a074, 0x4e81daa4, 0x73e1f314, 0xf1b164c5, 0xccd14d75, 
+    0x8b7137a5, 0xb6111e15, 0x0431c205, 0x3951ebb5, 0x7ef19165, 0x4391b8d5, 
+    0xa121b886, 0x9c419136, 0xdbe1ebe6, 0xe681c256, 0x54a11e46, 0x69c137f6, 
+    0x2e614d26, 0x13016496, 0x9151f347, 0xac31daf7, 0xeb91a027, 0xd6f18997, 
+    0x64d15587, 0x59b17c37, 0x1e1106e7, 0x23712f57, 0x58f35849, 0x659371f9, 
+    0x22330b29, 0x1f532299, 0xad73fe89, 0x9013d739, 0xd7b3ade9, 0xead38459, 
+    0x68831388, 0x55e33a38, 0x124340e8, 0x2f236958, 0x9d03b548, 0xa0639cf8, 
+    0xe7c3e628, 0xdaa3cf98, 0x3813cfcb, 0x0573e67b, 0x42d39cab, 0x7fb3b51b, 
+    0xcd93690b, 0xf0f340bb, 0xb7533a6b, 0x8a3313db, 0x0863840a, 0x3503adba, 
+    0x72a3d76a, 0x4fc3feda, 0xfde322ca, 0xc0830b7a, 0x872371aa, 0xba43581a, 
+    0x9932774d, 0xa4525efd, 0xe3f2242d, 0xde920d9d, 0x6cb2d18d, 0x51d2f83d, 
+    0x167282ed, 0x2b12ab5d, 0xa9423c8c, 0x9422153c, 0xd3826fec, 0xeee2465c, 
+    0x5cc29a4c, 0x61a2b3fc, 0x2602c92c, 0x1b62e09c, 0xf9d2e0cf, 0xc4b2c97f, 
+    0x8312b3af, 0xbe729a1f, 0x0c52460f, 0x31326fbf, 0x7692156f, 0x4bf23cdf, 
+    0xc9a2ab0e, 0xf4c282be, 0xb362f86e, 0x8e02d1de, 0x3c220dce, 0x0142247e, 
+    0x46e25eae, 0x7b82771e, 0xb1e6b092, 0x8c869922, 0xcb26e3f2, 0xf646ca42, 
+    0x44661652, 0x79063fe2, 0x3ea64532, 0x03c66c82, 0x8196fb53, 0xbcf6d2e3, 
+    0xfb56a833, 0xc6368183, 0x74165d93, 0x49767423, 0x0ed60ef3, 0x33b62743, 
+    0xd1062710, 0xec660ea0, 0xabc67470, 0x96a65dc0, 0x248681d0, 0x19e6a860, 
+    0x5e46d2b0, 0x6326fb00, 0xe1766cd1, 0xdc164561, 0x9bb63fb1, 0xa6d61601, 
+    0x14f6ca11, 0x2996e3a1, 0x6e369971, 0x5356b0c1, 0x70279f96, 0x4d47b626, 
+    0x0ae7ccf6, 0x3787e546, 0x85a73956, 0xb8c710e6, 0xff676a36, 0xc2074386, 
+    0x4057d457, 0x7d37fde7, 0x3a978737, 0x07f7ae87, 0xb5d77297, 0x88b75b27, 
+    0xcf1721f7, 0xf2770847, 0x10c70814, 0x2da721a4, 0x6a075b74, 0x576772c4, 
+    0xe547aed4, 0xd8278764, 0x9f87fdb4, 0xa2e7d404, 0x20b743d5, 0x1dd76a65, 
+    0x5a7710b5, 0x67173905, 0xd537e515, 0xe857cca5, 0xaff7b675, 0x92979fc5, 
+    0xe915e8db, 0xd475c16b, 0x93d5bbbb, 0xaeb5920b, 0x1c954e1b, 0x21f567ab, 
+    0x66551d7b, 0x5b3534cb, 0xd965a31a, 0xe4058aaa, 0xa3a5f07a, 0x9ec5d9ca, 
+    0x2ce505da, 0x11852c6a, 0x562556ba, 0x6b457f0a, 0x89f57f59, 0xb49556e9, 
+    0xf3352c39, 0xce550589, 0x7c75d999, 0x4115f029, 0x06b58af9, 0x3bd5a349, 
+    0xb9853498, 0x84e51d28, 0xc34567f8, 0xfe254e48, 0x4c059258, 0x7165bbe8, 
+    0x36c5c138, 0x0ba5e888, 0x28d4c7df, 0x15b4ee6f, 0x521494bf, 0x6f74bd0f, 
+    0xdd54611f, 0xe03448af, 0xa794327f, 0x9af41bcf, 0x18a48c1e, 0x25c4a5ae, 
+    0x6264df7e, 0x5f04f6ce, 0xed242ade, 0xd044036e, 0x97e479be, 0xaa84500e, 
+    0x4834505d, 0x755479ed, 0x32f4033d, 0x0f942a8d, 0xbdb4f69d, 0x80d4df2d, 
+    0xc774a5fd, 0xfa148c4d, 0x78441b9c, 0x4524322c, 0x028448fc, 0x3fe4614c, 
+    0x8dc4bd5c, 0xb0a494ec, 0xf704ee3c, 0xca64c78c},
+  {
+    0x00000000, 0xcb5cd3a5, 0x4dc8a10b, 0x869472ae, 0x9b914216, 0x50cd91b3, 
+    0xd659e31d, 0x1d0530b8, 0xec53826d, 0x270f51c8, 0xa19b2366, 0x6ac7f0c3, 
+    0x77c2c07b, 0xbc9e13de, 0x3a0a6170, 0xf156b2d5, 0x03d6029b, 0xc88ad13e, 
+    0x4e1ea390, 0x85427035, 0x9847408d, 0x531b9328, 0xd58fe186, 0x1ed33223, 
+    0xef8580f6, 0x24d95353, 0xa24d21fd, 0x6911f258, 0x7414c2e0, 0xbf481145, 
+    0x39dc63eb, 0xf280b04e, 0x07ac0536, 0xccf0d693, 0x4a64a43d, 0x81387798, 
+    0x9c3d4720, 0x57619485, 0xd1f5e62b, 0x1aa9358e, 0xebff875b, 0x20a354fe, 
+    0xa6372650, 0x6d6bf5f5, 0x706ec54d, 0xbb3216e8, 0x3da66446, 0xf6fab7e3, 
+    0x047a07ad, 0xcf26d408, 0x49b2a6a6, 0x82ee7503, 0x9feb45bb, 0x54b7961e, 
+    0xd223e4b0, 0x197f3715, 0xe82985c0, 0x23755665, 0xa5e124cb, 0x6ebdf76e, 
+    0x73b8c7d6, 0xb8e41473, 0x3e7066dd, 0xf52cb578, 0x0f580a6c, 0xc404d9c9, 
+    0x4290ab67, 0x89cc78c2, 0x94c9487a, 0x5f959bdf, 0xd901e971, 0x125d3ad4, 
+    0xe30b8801, 0x28575ba4, 0xaec3290a, 0x659ffaaf, 0x789aca17, 0xb3c619b2, 
+    0x35526b1c, 0xfe0eb8b9, 0x0c8e08f7, 0xc7d2db52, 0x4146a9fc, 0x8a1a7a59, 
+    0x971f4ae1, 0x5c439944, 0xdad7ebea, 0x118b384f, 0xe0dd8a9a, 0x2b81593f, 
+    0xad152b91, 0x6649f834, 0x7b4cc88c, 0xb0101b29, 0x36846987, 0xfdd8ba22, 
+    0x08f40f5a, 0xc3a8dcff, 0x453cae51, 0x8e607df4, 0x93654d4c, 0x58399ee9, 
+    0xdeadec47, 0x15f13fe2, 0xe4a78d37, 0x2ffb5e92, 0xa96f2c3c, 0x6233ff99, 
+    0x7f36cf21, 0xb46a1c84, 0x32fe6e2a, 0xf9a2bd8f, 0x0b220dc1, 0xc07ede64, 
+    0x46eaacca, 0x8db67f6f, 0x90b34fd7, 0x5bef9c72, 0xdd7beedc, 0x16273d79, 
+    0xe7718fac, 0x2c2d5c09, 0xaab92ea7, 0x61e5fd02, 0x7ce0cdba, 0xb7bc1e1f, 
+    0x31286cb1, 0xfa74bf14, 0x1eb014d8, 0xd5ecc77d, 0x5378b5d3, 0x98246676, 
+    0x852156ce, 0x4e7d856b, 0xc8e9f7c5, 0x03b52460, 0xf2e396b5, 0x39bf4510, 
+    0xbf2b37be, 0x7477e41b, 0x6972d4a3, 0xa22e0706, 0x24ba75a8, 0xefe6a60d, 
+    0x1d661643, 0xd63ac5e6, 0x50aeb748, 0x9bf264ed, 0x86f75455, 0x4dab87f0, 
+    0xcb3ff55e, 0x006326fb, 0xf135942e, 0x3a69478b, 0xbcfd3525, 0x77a1e680, 
+    0x6aa4d638, 0xa1f8059d, 0x276c7733, 0xec30a496, 0x191c11ee, 0xd240c24b, 
+    0x54d4b0e5, 0x9f886340, 0x828d53f8, 0x49d1805d, 0xcf45f2f3, 0x04192156, 
+    0xf54f9383, 0x3e134026, 0xb8873288, 0x73dbe12d, 0x6eded195, 0xa5820230, 
+    0x2316709e, 0xe84aa33b, 0x1aca1375, 0xd196c0d0, 0x5702b27e, 0x9c5e61db, 
+    0x815b5163, 0x4a0782c6, 0xcc93f068, 0x07cf23cd, 0xf6999118, 0x3dc542bd, 
+    0xbb513013, 0x700de3b6, 0x6d08d30e, 0xa65400ab, 0x20c07205, 0xeb9ca1a0, 
+    0x11e81eb4, 0xdab4cd11, 0x5c20bfbf, 0x977c6c1a, 0x8a795ca2, 0x41258f07, 
+    0xc7b1fda9, 0x0ced2e0c, 0xfdbb9cd9, 0x36e74f7c, 0xb0733dd2, 0x7b2fee77, 
+    0x662adecf, 0xad760d6a, 0x2be27fc4, 0xe0beac61, 0x123e1c2f, 0xd962cf8a, 
+    0x5ff6bd24, 0x94aa6e81, 0x89af5e39, 0x42f38d9c, 0xc467ff32, 0x0f3b2c97, 
+    0xfe6d9e42, 0x35314de7, 0xb3a53f49, 0x78f9ecec, 0x65fcdc54, 0xaea00ff1, 
+    0x28347d5f, 0xe368aefa, 0x16441b82, 0xdd18c827, 0x5b8cba89, 0x90d0692c, 
+    0x8dd55994, 0x46898a31, 0xc01df89f, 0x0b412b3a, 0xfa1799ef, 0x314b4a4a, 
+    0xb7df38e4, 0x7c83eb41, 0x6186dbf9, 0xaada085c, 0x2c4e7af2, 0xe712a957, 
+    0x15921919, 0xdececabc, 0x585ab812, 0x93066bb7, 0x8e035b0f, 0x455f88aa, 
+    0xc3cbfa04, 0x089729a1, 0xf9c19b74, 0x329d48d1, 0xb4093a7f, 0x7f55e9da, 
+    0x6250d962, 0xa90c0ac7, 0x2f987869, 0xe4c4abcc},
+  {
+    0x00000000, 0xa6770bb4, 0x979f1129, 0x31e81a9d, 0xf44f2413, 0x52382fa7, 
+    0x63d0353a, 0xc5a73e8e, 0x33ef4e67, 0x959845d3, 0xa4705f4e, 0x020754fa, 
+    0xc7a06a74, 0x61d761c0, 0x503f7b5d, 0xf64870e9, 0x67de9cce, 0xc1a9977a, 
+    0xf0418de7, 0x56368653, 0x9391b8dd, 0x35e6b369, 0x040ea9f4, 0xa279a240, 
+    0x5431d2a9, 0xf246d91d, 0xc3aec380, 0x65d9c834, 0xa07ef6ba, 0x0609fd0e, 
+    0x37e1e793, 0x9196ec27, 0xcfbd399c, 0x69ca3228, 0x582228b5, 0xfe552301, 
+    0x3bf21d8f, 0x9d85163b, 0xac6d0ca6, 0x0a1a0712, 0xfc5277fb, 0x5a257c4f, 
+    0x6bcd66d2, 0xcdba6d66, 0x081d53e8, 0xae6a585c, 0x9f8242c1, 0x39f54975, 
+    0xa863a552, 0x0e14aee6, 0x3ffcb47b, 0x998bbfcf, 0x5c2c8141, 0xfa5b8af5, 
+    0xcbb39068, 0x6dc49bdc, 0x9b8ceb35, 0x3dfbe081, 0x0c13fa1c, 0xaa64f1a8, 
+    0x6fc3cf26, 0xc9b4c492, 0xf85cde0f, 0x5e2bd5bb, 0x440b7579, 0xe27c7ecd, 
+    0xd3946450, 0x75e36fe4, 0xb044516a, 0x16335ade, 0x27db4043, 0x81ac4bf7, 
+    0x77e43b1e, 0xd19330aa, 0xe07b2a37, 0x460c2183, 0x83ab1f0d, 0x25dc14b9, 
+    0x14340e24, 0xb2430590, 0x23d5e9b7, 0x85a2e203, 0xb44af89e, 0x123df32a, 
+    0xd79acda4, 0x71edc610, 0x4005dc8d, 0xe672d739, 0x103aa7d0, 0xb64dac64, 
+    0x87a5b6f9, 0x21d2bd4d, 0xe47583c3, 0x42028877, 0x73ea92ea, 0xd59d995e, 
+    0x8bb64ce5, 0x2dc14751, 0x1c295dcc, 0xba5e5678, 0x7ff968f6, 0xd98e6342, 
+    0xe86679df, 0x4e11726b, 0xb8590282, 0x1e2e0936, 0x2fc613ab, 0x89b1181f, 
+    0x4c162691, 0xea612d25, 0xdb8937b8, 0x7dfe3c0c, 0xec68d02b, 0x4a1fdb9f, 
+    0x7bf7c102, 0xdd80cab6, 0x1827f438, 0xbe50ff8c, 0x8fb8e511, 0x29cfeea5, 
+    0xdf879e4c, 0x79f095f8, 0x48188f65, 0xee6f84d1, 0x2bc8ba5f, 0x8dbfb1eb, 
+    0xbc57ab76, 0x1a20a0c2, 0x8816eaf2, 0x2e61e146, 0x1f89fbdb, 0xb9fef06f, 
+    0x7c59cee1, 0xda2ec555, 0xebc6dfc8, 0x4db1d47c, 0xbbf9a495, 0x1d8eaf21, 
+    0x2c66b5bc, 0x8a11be08, 0x4fb68086, 0xe9c18b32, 0xd82991af, 0x7e5e9a1b, 
+    0xefc8763c, 0x49bf7d88, 0x78576715, 0xde206ca1, 0x1b87522f, 0xbdf0599b, 
+    0x8c184306, 0x2a6f48b2, 0xdc27385b, 0x7a5033ef, 0x4bb82972, 0xedcf22c6, 
+    0x28681c48, 0x8e1f17fc, 0xbff70d61, 0x198006d5, 0x47abd36e, 0xe1dcd8da, 
+    0xd034c247, 0x7643c9f3, 0xb3e4f77d, 0x1593fcc9, 0x247be654, 0x820cede0, 
+    0x74449d09, 0xd23396bd, 0xe3db8c20, 0x45ac8794, 0x800bb91a, 0x267cb2ae, 
+    0x1794a833, 0xb1e3a387, 0x20754fa0, 0x86024414, 0xb7ea5e89, 0x119d553d, 
+    0xd43a6bb3, 0x724d6007, 0x43a57a9a, 0xe5d2712e, 0x139a01c7, 0xb5ed0a73, 
+    0x840510ee, 0x22721b5a, 0xe7d525d4, 0x41a22e60, 0x704a34fd, 0xd63d3f49, 
+    0xcc1d9f8b, 0x6a6a943f, 0x5b828ea2, 0xfdf58516, 0x3852bb98, 0x9e25b02c, 
+    0xafcdaab1, 0x09baa105, 0xfff2d1ec, 0x5985da58, 0x686dc0c5, 0xce1acb71, 
+    0x0bbdf5ff, 0xadcafe4b, 0x9c22e4d6, 0x3a55ef62, 0xabc30345, 0x0db408f1, 
+    0x3c5c126c, 0x9a2b19d8, 0x5f8c2756, 0xf9fb2ce2, 0xc813367f, 0x6e643dcb, 
+    0x982c4d22, 0x3e5b4696, 0x0fb35c0b, 0xa9c457bf, 0x6c636931, 0xca146285, 
+    0xfbfc7818, 0x5d8b73ac, 0x03a0a617, 0xa5d7ada3, 0x943fb73e, 0x3248bc8a, 
+    0xf7ef8204, 0x519889b0, 0x6070932d, 0xc6079899, 0x304fe870, 0x9638e3c4, 
+    0xa7d0f959, 0x01a7f2ed, 0xc400cc63, 0x6277c7d7, 0x539fdd4a, 0xf5e8d6fe, 
+    0x647e3ad9, 0xc209316d, 0xf3e12bf0, 0x55962044, 0x90311eca, 0x3646157e, 
+    0x07ae0fe3, 0xa1d90457, 0x579174be, 0xf1e67f0a, 0xc00e6597, 0x66796e23, 
+    0xa3de50ad, 0x05a95b19, 0x34414184, 0x92364a30},
+  {
+    0x00000000, 0xccaa009e, 0x4225077d, 0x8e8f07e3, 0x844a0efa, 0x48e00e64, 
+    0xc66f0987, 0x0ac50919, 0xd3e51bb5, 0x1f4f1b2b, 0x91c01cc8, 0x5d6a1c56, 
+    0x57af154f, 0x9b0515d1, 0x158a1232, 0xd92012ac, 0x7cbb312b, 0xb01131b5, 
+    0x3e9e3656, 0xf23436c8, 0xf8f13fd1, 0x345b3f4f, 0xbad438ac, 0x767e3832, 
+    0xaf5e2a9e, 0x63f42a00, 0xed7b2de3, 0x21d12d7d, 0x2b142464, 0xe7be24fa, 
+    0x69312319, 0xa59b2387, 0xf9766256, 0x35dc62c8, 0xbb53652b, 0x77f965b5, 
+    0x7d3c6cac, 0xb1966c32, 0x3f196bd1, 0xf3b36b4f, 0x2a9379e3, 0xe639797d, 
+    0x68b67e9e, 0xa41c7e00, 0xaed97719, 0x62737787, 0xecfc7064, 0x205670fa, 
+    0x85cd537d, 0x496753e3, 0xc7e85400, 0x0b42549e, 0x01875d87, 0xcd2d5d19, 
+    0x43a25afa, 0x8f085a64, 0x562848c8, 0x9a824856, 0x140d4fb5, 0xd8a74f2b, 
+    0xd2624632, 0x1ec846ac, 0x9047414f, 0x5ced41d1, 0x299dc2ed, 0xe537c273, 
+    0x6bb8c590, 0xa712c50e, 0xadd7cc17, 0x617dcc89, 0xeff2cb6a, 0x2358cbf4, 
+    0xfa78d958, 0x36d2d9c6, 0xb85dde25, 0x74f7debb, 0x7e32d7a2, 0xb298d73c, 
+    0x3c17d0df, 0xf0bdd041, 0x5526f3c6, 0x998cf358, 0x1703f4bb, 0xdba9f425, 
+    0xd16cfd3c, 0x1dc6fda2, 0x9349fa41, 0x5fe3fadf, 0x86c3e873, 0x4a69e8ed, 
+    0xc4e6ef0e, 0x084cef90, 0x0289e689, 0xce23e617, 0x40ace1f4, 0x8c06e16a, 
+    0xd0eba0bb, 0x1c41a025, 0x92cea7c6, 0x5e64a758, 0x54a1ae41, 0x980baedf, 
+    0x1684a93c, 0xda2ea9a2, 0x030ebb0e, 0xcfa4bb90, 0x412bbc73, 0x8d81bced, 
+    0x8744b5f4, 0x4beeb56a, 0xc561b289, 0x09cbb217, 0xac509190, 0x60fa910e, 
+    0xee7596ed, 0x22df9673, 0x281a9f6a, 0xe4b09ff4, 0x6a3f9817, 0xa6959889, 
+    0x7fb58a25, 0xb31f8abb, 0x3d908d58, 0xf13a8dc6, 0xfbff84df, 0x37558441, 
+    0xb9da83a2, 0x7570833c, 0x533b85da, 0x9f918544, 0x111e82a7, 0xddb48239, 
+    0xd7718b20, 0x1bdb8bbe, 0x95548c5d, 0x59fe8cc3, 0x80de9e6f, 0x4c749ef1, 
+    0xc2fb9912, 0x0e51998c, 0x04949095, 0xc83e900b, 0x46b197e8, 0x8a1b9776, 
+    0x2f80b4f1, 0xe32ab46f, 0x6da5b38c, 0xa10fb312, 0xabcaba0b, 0x6760ba95, 
+    0xe9efbd76, 0x2545bde8, 0xfc65af44, 0x30cfafda, 0xbe40a839, 0x72eaa8a7, 
+    0x782fa1be, 0xb485a120, 0x3a0aa6c3, 0xf6a0a65d, 0xaa4de78c, 0x66e7e712, 
+    0xe868e0f1, 0x24c2e06f, 0x2e07e976, 0xe2ade9e8, 0x6c22ee0b, 0xa088ee95, 
+    0x79a8fc39, 0xb502fca7, 0x3b8dfb44, 0xf727fbda, 0xfde2f2c3, 0x3148f25d, 
+    0xbfc7f5be, 0x736df520, 0xd6f6d6a7, 0x1a5cd639, 0x94d3d1da, 0x5879d144, 
+    0x52bcd85d, 0x9e16d8c3, 0x1099df20, 0xdc33dfbe, 0x0513cd12, 0xc9b9cd8c, 
+    0x4736ca6f, 0x8b9ccaf1, 0x8159c3e8, 0x4df3c376, 0xc37cc495, 0x0fd6c40b, 
+    0x7aa64737, 0xb60c47a9, 0x3883404a, 0xf42940d4, 0xfeec49cd, 0x32464953, 
+    0xbcc94eb0, 0x70634e2e, 0xa9435c82, 0x65e95c1c, 0xeb665bff, 0x27cc5b61, 
+    0x2d095278, 0xe1a352e6, 0x6f2c5505, 0xa386559b, 0x061d761c, 0xcab77682, 
+    0x44387161, 0x889271ff, 0x825778e6, 0x4efd7878, 0xc0727f9b, 0x0cd87f05, 
+    0xd5f86da9, 0x19526d37, 0x97dd6ad4, 0x5b776a4a, 0x51b26353, 0x9d1863cd, 
+    0x1397642e, 0xdf3d64b0, 0x83d02561, 0x4f7a25ff, 0xc1f5221c, 0x0d5f2282, 
+    0x079a2b9b, 0xcb302b05, 0x45bf2ce6, 0x89152c78, 0x50353ed4, 0x9c9f3e4a, 
+    0x121039a9, 0xdeba3937, 0xd47f302e, 0x18d530b0, 0x965a3753, 0x5af037cd, 
+    0xff6b144a, 0x33c114d4, 0xbd4e1337, 0x71e413a9, 0x7b211ab0, 0xb78b1a2e, 
+    0x39041dcd, 0xf5ae1d53, 0x2c8e0fff, 0xe0240f61, 0x6eab0882, 0xa201081c, 
+    0xa8c40105, 0x646e019b, 0xeae10678, 0x264b06e6}
+};
+
+// folding constants {k1,k2,k3,k4}
+const unsigned long long int liquid_crc8_fold[4] = {
+    0x1cc000000, 0x0ce000000, 0x068000000, 0x174000000};
+
+const unsigned long long int liquid_crc16_fold[4] = {
+    0x194520000, 0x150000000, 0x1bc520000, 0x185520000};
+
+const unsigned long long int liquid_crc24_fold[4] = {
+    0x003717c00, 0x0290d8a00, 0x1ad214a00, 0x084813200};
+
+const unsigned long long int liquid_crc32_fold[4] = {
+    0x154442bd4, 0x1c6e41596, 0x1751997d0, 0x0ccaa009e};
@@ -61,7 +61,11 @@ const char * fec_scheme_str[LIQUID_FEC_NUM_SCHEMES][2] = {
     {"v29p56",      "convolutional r5/6 K=9 (punctured)"},
     {"v29p67",      "convolutional r6/7 K=9 (punctured)"},
     {"v29p78",      "convolutional r7/8 K=9 (punctured)"},
-    {"rs8",         "Reed-Solomon, 223/255"}
+    {"rs8",         "Reed-Solomon, 223/255"},
+    {"ldpc12",      "LDPC r1/2 (quasi-cyclic)"},
+    {"ldpc23",      "LDPC r2/3 (quasi-cyclic)"},
+    {"ldpc34",      "LDPC r3/4 (quasi-cyclic)"},
+    {"ldpc56",      "LDPC r5/6 (quasi-cyclic)"}
 };
 
 // Print compact list of existing and available fec schemes
@@ -73,10 +77,6 @@ void liquid_print_fec_schemes()
     // print all available MOD schemes
     printf("          ");
     for (i=0; i<LIQUID_FEC_NUM_SCHEMES; i++) {
-#if !LIBFEC_ENABLED
-        if ( fec_scheme_is_convolutional(i) || fec_scheme_is_reedsolomon(i) )
-            continue;
-#endif
         printf("%s", fec_scheme_str[i][0]);
 
         if (i != LIQUID_FEC_NUM_SCHEMES-1)
@@ -174,6 +174,20 @@ int fec_scheme_is_reedsolomon(fec_scheme _scheme)
     return 0;
 }
 
+// is scheme LDPC?
+int fec_scheme_is_ldpc(fec_scheme _scheme)
+{
+    switch (_scheme) {
+    case LIQUID_FEC_LDPC_R12:
+    case LIQUID_FEC_LDPC_R23:
+    case LIQUID_FEC_LDPC_R34:
+    case LIQUID_FEC_LDPC_R56:
+        return 1;
+    default:;
+    }
+    return 0;
+}
+
 // is scheme Hamming?
 int fec_scheme_is_hamming(fec_scheme _scheme)
 {
@@ -220,7 +234,6 @@ unsigned int fec_get_enc_msg_length(fec_scheme _scheme,
     case LIQUID_FEC_SECDED3932:     return _msg_len + _msg_len/4 + ((_msg_len%4) ? 1 : 0);
     case LIQUID_FEC_SECDED7264:     return _msg_len + _msg_len/8 + ((_msg_len%8) ? 1 : 0);
 
-#if LIBFEC_ENABLED
     // convolutional codes
     case LIQUID_FEC_CONV_V27:       return 2*_msg_len + 2;  // (K-1)/r=12, round up to 2 bytes
     case LIQUID_FEC_CONV_V29:       return 2*_msg_len + 2;  // (K-1)/r=16, 2 bytes
@@ -242,32 +255,12 @@ unsigned int fec_get_enc_msg_length(fec_scheme _scheme,
 
     // Reed-Solomon codes
     case LIQUID_FEC_RS_M8:          return fec_rs_get_enc_msg_len(_msg_len,32,255,223);
-#else
-    case LIQUID_FEC_CONV_V27:
-    case LIQUID_FEC_CONV_V29:
-    case LIQUID_FEC_CONV_V39:
-    case LIQUID_FEC_CONV_V615:
-
-    case LIQUID_FEC_CONV_V27P23:
-    case LIQUID_FEC_CONV_V27P34:
-    case LIQUID_FEC_CONV_V27P45:
-    case LIQUID_FEC_CONV_V27P56:
-    case LIQUID_FEC_CONV_V27P67:
-    case LIQUID_FEC_CONV_V27P78:
 
-    case LIQUID_FEC_CONV_V29P23:
-    case LIQUID_FEC_CONV_V29P34:
-    case LIQUID_FEC_CONV_V29P45:
-    case LIQUID_FEC_CONV_V29P56:
-    case LIQUID_FEC_CONV_V29P67:
-    case LIQUID_FEC_CONV_V29P78:
-        fprintf(stderr, "error: fec_get_enc_msg_length(), convolutional codes unavailable (install libfec)\n");
-        exit(-1);
-
-    case LIQUID_FEC_RS_M8:
-        fprintf(stderr, "error: fec_get_enc_msg_length(), Reed-Solomon codes unavailable (install libfec)\n");
-        exit(-1);
-#endif
+    // LDPC codes
+    case LIQUID_FEC_LDPC_R12:       return fec_ldpc_get_enc_msg_len(_msg_len,12);
+    case LIQUID_FEC_LDPC_R23:       return fec_ldpc_get_enc_msg_len(_msg_len,16);
+    case LIQUID_FEC_LDPC_R34:       return fec_ldpc_get_enc_msg_len(_msg_len,18);
+    case LIQUID_FEC_LDPC_R56:       return fec_ldpc_get_enc_msg_len(_msg_len,20);
     default:
         printf("error: fec_get_enc_msg_length(), unknown/unsupported scheme: %d\n", _scheme);
         exit(-1);
@@ -415,7 +408,6 @@ float fec_get_rate(fec_scheme _scheme)
     case LIQUID_FEC_SECDED7264:     return 8./9.;
 
     // convolutional codes
-#if LIBFEC_ENABLED
     case LIQUID_FEC_CONV_V27:       return 1./2.;
     case LIQUID_FEC_CONV_V29:       return 1./2.;
     case LIQUID_FEC_CONV_V39:       return 1./3.;
@@ -435,32 +427,12 @@ float fec_get_rate(fec_scheme _scheme)
 
     // Reed-Solomon codes
     case LIQUID_FEC_RS_M8:          return 223./255.;
-#else
-    case LIQUID_FEC_CONV_V27:
-    case LIQUID_FEC_CONV_V29:
-    case LIQUID_FEC_CONV_V39:
-    case LIQUID_FEC_CONV_V615:
 
-    case LIQUID_FEC_CONV_V27P23:
-    case LIQUID_FEC_CONV_V27P34:
-    case LIQUID_FEC_CONV_V27P45:
-    case LIQUID_FEC_CONV_V27P56:
-    case LIQUID_FEC_CONV_V27P67:
-    case LIQUID_FEC_CONV_V27P78:
-
-    case LIQUID_FEC_CONV_V29P23:
-    case LIQUID_FEC_CONV_V29P34:
-    case LIQUID_FEC_CONV_V29P45:
-    case LIQUID_FEC_CONV_V29P56:
-    case LIQUID_FEC_CONV_V29P67:
-    case LIQUID_FEC_CONV_V29P78:
-        fprintf(stderr,"error: fec_get_rate(), convolutional codes unavailable (install libfec)\n");
-        exit(-1);
-
-    case LIQUID_FEC_RS_M8:
-        fprintf(stderr,"error: fec_get_rate(), Reed-Solomon codes unavailable (install libfec)\n");
-        exit(-1);
-#endif
+    // LDPC codes
+    case LIQUID_FEC_LDPC_R12:       return 1./2.;
+    case LIQUID_FEC_LDPC_R23:       return 2./3.;
+    case LIQUID_FEC_LDPC_R34:       return 3./4.;
+    case LIQUID_FEC_LDPC_R56:       return 5./6.;
 
     default:
         printf("error: fec_get_rate(), unknown/unsupported scheme: %d\n", _scheme);
@@ -503,7 +475,6 @@ fec fec_create(fec_scheme _scheme, void *_opts)
         return fec_secded7264_create(_opts);
 
     // convolutional codes
-#if LIBFEC_ENABLED
     case LIQUID_FEC_CONV_V27:
     case LIQUID_FEC_CONV_V29:
     case LIQUID_FEC_CONV_V39:
@@ -529,32 +500,13 @@ fec fec_create(fec_scheme _scheme, void *_opts)
     // Reed-Solomon codes
     case LIQUID_FEC_RS_M8:
         return fec_rs_create(_scheme);
-#else
-    case LIQUID_FEC_CONV_V27:
-    case LIQUID_FEC_CONV_V29:
-    case LIQUID_FEC_CONV_V39:
-    case LIQUID_FEC_CONV_V615:
-
-    case LIQUID_FEC_CONV_V27P23:
-    case LIQUID_FEC_CONV_V27P34:
-    case LIQUID_FEC_CONV_V27P45:
-    case LIQUID_FEC_CONV_V27P56:
-    case LIQUID_FEC_CONV_V27P67:
-    case LIQUID_FEC_CONV_V27P78:
-
-    case LIQUID_FEC_CONV_V29P23:
-    case LIQUID_FEC_CONV_V29P34:
-    case LIQUID_FEC_CONV_V29P45:
-    case LIQUID_FEC_CONV_V29P56:
-    case LIQUID_FEC_CONV_V29P67:
-    case LIQUID_FEC_CONV_V29P78:
-        fprintf(stderr,"error: fec_create(), convolutional codes unavailable (install libfec)\n");
-        exit(-1);
 
-    case LIQUID_FEC_RS_M8:
-        fprintf(stderr,"error: fec_create(), Reed-Solomon codes unavailable (install libfec)\n");
-        exit(-1);
-#endif
+    // LDPC codes
+    case LIQUID_FEC_LDPC_R12:
+    case LIQUID_FEC_LDPC_R23:
+    case LIQUID_FEC_LDPC_R34:
+    case LIQUID_FEC_LDPC_R56:
+        return fec_ldpc_create(_scheme);
 
     default:
         printf("error: fec_create(), unknown/unsupported scheme: %d\n", _scheme);
@@ -587,6 +539,27 @@ fec fec_recreate(fec _q,
 // destroy fec object
 void fec_destroy(fec _q)
 {
+    // convolutional codes hold internal decoder objects
+    if (fec_scheme_is_convolutional(_q->scheme)) {
+        if (fec_scheme_is_punctured(_q->scheme))
+            fec_conv_punctured_destroy(_q);
+        else
+            fec_conv_destroy(_q);
+        return;
+    }
+
+    // Reed-Solomon codes hold internal codec object
+    if (fec_scheme_is_reedsolomon(_q->scheme)) {
+        fec_rs_destroy(_q);
+        return;
+    }
+
+    // LDPC codes hold internal codec object
+    if (fec_scheme_is_ldpc(_q->scheme)) {
+        fec_ldpc_destroy(_q);
+        return;
+    }
+
     free(_q);
 }
 
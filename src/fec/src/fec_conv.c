@@ -26,15 +26,13 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
 
 #include "liquid.internal.h"
 
 #define VERBOSE_FEC_CONV    0
 
-#if LIBFEC_ENABLED
-#include "fec.h"
-
 fec fec_conv_create(fec_scheme _fs)
 {
     fec q = (fec) malloc(sizeof(struct fec_s));
@@ -68,8 +66,10 @@ void fec_conv_destroy(fec _q)
 {
     // delete viterbi decoder
     if (_q->vp != NULL)
-        _q->delete_viterbi(_q->vp);
+        fec_conv_viterbi_destroy(_q->vp);
 
+    // free internal buffers
+    free(_q->enc_bits);
     free(_q);
 }
 
@@ -97,7 +97,7 @@ void fec_conv_encode(fec _q,
 
             // compute parity bits for each polynomial
             for (r=0; r<_q->R; r++) {
-                byte_out = (byte_out<<1) | parity(sr & _q->poly[r]);
+                byte_out = (byte_out<<1) | liquid_count_ones_mod2(sr & _q->poly[r]);
                 _msg_enc[n/8] = byte_out;
                 n++;
             }
@@ -111,7 +111,7 @@ void fec_conv_encode(fec _q,
 
         // compute parity bits for each polynomial
         for (r=0; r<_q->R; r++) {
-            byte_out = (byte_out<<1) | parity(sr & _q->poly[r]);
+            byte_out = (byte_out<<1) | liquid_count_ones_mod2(sr & _q->poly[r]);
             _msg_enc[n/8] = byte_out;
             n++;
         }
@@ -175,9 +175,7 @@ void fec_conv_decode_soft(fec _q,
     fec_conv_setlength(_q, _dec_msg_len);
 
     // copy soft input bits
-    unsigned int k;
-    for (k=0; k<8*_q->num_enc_bytes; k++)
-        _q->enc_bits[k] = _msg_enc[k];
+    memmove(_q->enc_bits, _msg_enc, 8*_q->num_enc_bytes*sizeof(unsigned char));
 
     // run internal decoder
     fec_conv_decode(_q, _msg_dec);
@@ -188,9 +186,9 @@ void fec_conv_decode(fec _q,
                      unsigned char *_msg_dec)
 {
     // run decoder
-    _q->init_viterbi(_q->vp,0);
-    _q->update_viterbi_blk(_q->vp, _q->enc_bits, 8*_q->num_dec_bytes+_q->K-1);
-    _q->chainback_viterbi(_q->vp, _msg_dec, 8*_q->num_dec_bytes, 0);
+    fec_conv_viterbi_reset(_q->vp);
+    fec_conv_viterbi_update(_q->vp, _q->enc_bits, 8*_q->num_dec_bytes+_q->K-1);
+    fec_conv_viterbi_chainback(_q->vp, _msg_dec, 8*_q->num_dec_bytes, 0);
 
 #if VERBOSE_FEC_CONV
     for (i=0; i<_dec_msg_len; i++)
@@ -219,10 +217,10 @@ void fec_conv_setlength(fec _q, unsigned int _dec_msg_len)
 
     // delete old decoder if necessary
     if (_q->vp != NULL)
-        _q->delete_viterbi(_q->vp);
+        fec_conv_viterbi_destroy(_q->vp);
 
     // re-create / re-allocate memory buffers
-    _q->vp = _q->create_viterbi(8*_q->num_dec_bytes);
+    _q->vp = fec_conv_viterbi_create(_q->K, _q->R, _q->poly, 8*_q->num_dec_bytes);
     _q->enc_bits = (unsigned char*) realloc(_q->enc_bits,
                                             _q->num_enc_bytes*8*sizeof(unsigned char));
 }
@@ -236,11 +234,6 @@ void fec_conv_init_v27(fec _q)
     _q->R=2;
     _q->K=7;
     _q->poly = fec_conv27_poly;
-    _q->create_viterbi = create_viterbi27;
-    _q->init_viterbi = init_viterbi27;
-    _q->update_viterbi_blk = update_viterbi27_blk;
-    _q->chainback_viterbi = chainback_viterbi27;
-    _q->delete_viterbi = delete_viterbi27;
 }
 
 void fec_conv_init_v29(fec _q)
@@ -248,11 +241,6 @@ void fec_conv_init_v29(fec _q)
     _q->R=2;
     _q->K=9;
     _q->poly = fec_conv29_poly;
-    _q->create_viterbi = create_viterbi29;
-    _q->init_viterbi = init_viterbi29;
-    _q->update_viterbi_blk = update_viterbi29_blk;
-    _q->chainback_viterbi = chainback_viterbi29;
-    _q->delete_viterbi = delete_viterbi29;
 }
 
 void fec_conv_init_v39(fec _q)
@@ -260,11 +248,6 @@ void fec_conv_init_v39(fec _q)
     _q->R=3;
     _q->K=9;
     _q->poly = fec_conv39_poly;
-    _q->create_viterbi = create_viterbi39;
-    _q->init_viterbi = init_viterbi39;
-    _q->update_viterbi_blk = update_viterbi39_blk;
-    _q->chainback_viterbi = chainback_viterbi39;
-    _q->delete_viterbi = delete_viterbi39;
 }
 
 void fec_conv_init_v615(fec _q)
@@ -272,25 +255,6 @@ void fec_conv_init_v615(fec _q)
     _q->R=6;
     _q->K=15;
     _q->poly = fec_conv615_poly;
-    _q->create_viterbi = create_viterbi615;
-    _q->init_viterbi = init_viterbi615;
-    _q->update_viterbi_blk = update_viterbi615_blk;
-    _q->chainback_viterbi = chainback_viterbi615;
-    _q->delete_viterbi = delete_viterbi615;
-}
-
-
-
-#else   // LIBFEC_ENABLED
-
-fec fec_conv_create(fec_scheme _fs)
-{
-    return NULL;
-}
-
-void fec_conv_destroy(fec _q)
-{
 }
 
-#endif  // LIBFEC_ENABLED
 
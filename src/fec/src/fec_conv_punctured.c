@@ -32,9 +32,6 @@
 
 #define VERBOSE_FEC_CONV_PUNCTURED    0
 
-#if LIBFEC_ENABLED
-#include "fec.h"
-
 fec fec_conv_punctured_create(fec_scheme _fs)
 {
     fec q = (fec) malloc(sizeof(struct fec_s));
@@ -77,8 +74,10 @@ void fec_conv_punctured_destroy(fec _q)
 {
     // delete viterbi decoder
     if (_q->vp != NULL)
-        _q->delete_viterbi(_q->vp);
+        fec_conv_viterbi_destroy(_q->vp);
 
+    // free internal buffers
+    free(_q->enc_bits);
     free(_q);
 }
 
@@ -109,7 +108,7 @@ void fec_conv_punctured_encode(fec _q,
             for (r=0; r<_q->R; r++) {
                 // enable output determined by puncturing matrix
                 if (_q->puncturing_matrix[r*(_q->P)+p]) {
-                    byte_out = (byte_out<<1) | parity(sr & _q->poly[r]);
+                    byte_out = (byte_out<<1) | liquid_count_ones_mod2(sr & _q->poly[r]);
                     _msg_enc[n/8] = byte_out;
                     n++;
                 } else {
@@ -131,7 +130,7 @@ void fec_conv_punctured_encode(fec _q,
         // compute parity bits for each polynomial
         for (r=0; r<_q->R; r++) {
             if (_q->puncturing_matrix[r*(_q->P)+p]) {
-                byte_out = (byte_out<<1) | parity(sr & _q->poly[r]);
+                byte_out = (byte_out<<1) | liquid_count_ones_mod2(sr & _q->poly[r]);
                 _msg_enc[n/8] = byte_out;
                 n++;
             }
@@ -171,11 +170,15 @@ void fec_conv_punctured_decode_hard(fec _q,
     unsigned int k=0;   // intput bit index (0<=k<8)
     unsigned int p=0;   // puncturing matrix column index
     unsigned char bit;
-    unsigned char byte_in = _msg_enc[n];
+    unsigned char byte_in = 0;
     for (i=0; i<num_enc_bits; i+=_q->R) {
         //
         for (r=0; r<_q->R; r++) {
             if (_q->puncturing_matrix[r*(_q->P)+p]) {
+                // load next input byte only when its first bit is needed
+                if (k==0)
+                    byte_in = _msg_enc[n];
+
                 // push bit from input
                 bit = (byte_in >> (7-k)) & 0x01;
                 _q->enc_bits[i+r] = bit ? LIQUID_SOFTBIT_1 : LIQUID_SOFTBIT_0;
@@ -183,7 +186,6 @@ void fec_conv_punctured_decode_hard(fec _q,
                 if (k==8) {
                     k = 0;
                     n++;
-                    byte_in = _msg_enc[n];
                 }
             } else {
                 // push erasure
@@ -205,10 +207,9 @@ void fec_conv_punctured_decode_hard(fec _q,
 #endif
 
     // run decoder
-    _q->init_viterbi(_q->vp,0);
-    // TODO : check to see if this shouldn't be num_enc_bits (punctured)
-    _q->update_viterbi_blk(_q->vp, _q->enc_bits, 8*_q->num_dec_bytes+_q->K-1);
-    _q->chainback_viterbi(_q->vp, _msg_dec, 8*_q->num_dec_bytes, 0);
+    fec_conv_viterbi_reset(_q->vp);
+    fec_conv_viterbi_update(_q->vp, _q->enc_bits, 8*_q->num_dec_bytes+_q->K-1);
+    fec_conv_viterbi_chainback(_q->vp, _msg_dec, 8*_q->num_dec_bytes, 0);
 
 #if VERBOSE_FEC_CONV_PUNCTURED
     for (ii=0; ii<_dec_msg_len; ii++)
@@ -258,10 +259,9 @@ void fec_conv_punctured_decode_soft(fec _q,
 #endif
 
     // run decoder
-    _q->init_viterbi(_q->vp,0);
-    // TODO : check to see if this shouldn't be num_enc_bits (punctured)
-    _q->update_viterbi_blk(_q->vp, _q->enc_bits, 8*_q->num_dec_bytes+_q->K-1);
-    _q->chainback_viterbi(_q->vp, _msg_dec, 8*_q->num_dec_bytes, 0);
+    fec_conv_viterbi_reset(_q->vp);
+    fec_conv_viterbi_update(_q->vp, _q->enc_bits, 8*_q->num_dec_bytes+_q->K-1);
+    fec_conv_viterbi_chainback(_q->vp, _msg_dec, 8*_q->num_dec_bytes, 0);
 
 #if VERBOSE_FEC_CONV_PUNCTURED
     for (ii=0; ii<_dec_msg_len; ii++)
@@ -300,10 +300,10 @@ void fec_conv_punctured_setlength(fec _q, unsigned int _dec_msg_len)
 
     // delete old decoder if necessary
     if (_q->vp != NULL)
-        _q->delete_viterbi(_q->vp);
+        fec_conv_viterbi_destroy(_q->vp);
 
     // re-create / re-allocate memory buffers
-    _q->vp = _q->create_viterbi(8*_q->num_dec_bytes);
+    _q->vp = fec_conv_viterbi_create(_q->K, _q->R, _q->poly, 8*_q->num_dec_bytes);
     _q->enc_bits = (unsigned char*) realloc(_q->enc_bits,
                                             num_enc_bits*sizeof(unsigned char));
 
@@ -424,32 +424,3 @@ void fec_conv_init_v29p78(fec _q)
     _q->puncturing_matrix = fec_conv29p78_matrix;
 }
 
-
-#else   // LIBFEC_ENABLED
-
-fec fec_conv_punctured_create(fec_scheme _fs)
-{
-    return NULL;
-}
-
-void fec_conv_punctured_destroy(fec _q)
-{
-}
-
-void fec_conv_punctured_encode(fec _q,
-                               unsigned int _dec_msg_len,
-                               unsigned char *_msg_dec,
-                               unsigned char *_msg_enc)
-{
-}
-
-//unsigned int
-void fec_conv_punctured_decode(fec _q,
-                               unsigned int _dec_msg_len,
-                               unsigned char *_msg_enc,
-                               unsigned char *_msg_dec)
-{
-}
-
-#endif  // LIBFEC_ENABLED
-
@@ -0,0 +1,664 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Viterbi decoder for convolutional codes
+//
+// Decodes rate 1/R, constraint length K codes using 8-bit soft
+// symbols (LIQUID_SOFTBIT_0 ... LIQUID_SOFTBIT_1). The encoder shift
+// register holds the newest bit in its least-significant position, so
+// states i and i+S/2 feed states 2i and 2i+1 (S = 2^(K-1)). Every code
+// polynomial taps both ends of the register, which lets each butterfly
+// share a single branch metric pair. Path metrics are kept as 16-bit
+// integers and updated with SSE2 (or AVX2 when available at run time)
+// add-compare-select operations.
+//
+// Decisions for each trellis step are stored as 32-bit words in groups
+// of 32 butterflies: word 2g holds the decisions for the even states
+// 2i (i = 32g ... 32g+31), word 2g+1 those of the odd states 2i+1.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "liquid.internal.h"
+
+#if HAVE_EMMINTRIN_H && defined(__SSE2__)
+#  define FEC_CONV_VITERBI_SSE2 1
+#  include <emmintrin.h>  // SSE2
+#else
+#  define FEC_CONV_VITERBI_SSE2 0
+#endif
+
+#if LIQUID_SIMD_DISPATCH
+#include <immintrin.h>  // AVX2 (selected at run time)
+#endif
+
+// path metrics are re-normalized to the metric of state zero after
+// every RENORM/(255*R) trellis steps, so that it grows by no more than
+// this threshold in the meantime; with the initial state penalty below
+// this keeps the metrics of all codes (up to K=15, R=6) within the
+// range of int16_t. All kernels use the same schedule and so produce
+// identical path metrics.
+#define FEC_CONV_VITERBI_RENORM     (4096)
+#define FEC_CONV_VITERBI_PENALTY    (2048)
+
+// internal methods
+void fec_conv_viterbi_update_port(fec_conv_viterbi _q,
+                                  unsigned char *  _syms,
+                                  unsigned int     _n);
+#if FEC_CONV_VITERBI_SSE2
+void fec_conv_viterbi_update_sse2(fec_conv_viterbi _q,
+                                  unsigned char *  _syms,
+                                  unsigned int     _n);
+#endif
+#if LIQUID_SIMD_DISPATCH
+void fec_conv_viterbi_update_avx2(fec_conv_viterbi _q,
+                                  unsigned char *  _syms,
+                                  unsigned int     _n);
+#endif
+
+struct fec_conv_viterbi_s {
+    unsigned int K;             // constraint length
+    unsigned int R;             // inverse rate (symbols per bit)
+    unsigned int S;             // number of states, 2^(K-1)
+    unsigned int W;             // decision words per step, S/32
+    unsigned int num_steps;     // maximum number of trellis steps
+    unsigned int step;          // current trellis step
+    unsigned int renorm;        // re-normalization period (steps)
+
+    int16_t * bt;               // branch table [R x S/2]: 0 or 255
+    int16_t * metrics0;         // path metrics buffer [S]
+    int16_t * metrics1;         // path metrics buffer [S]
+    int16_t * m_old;            // pointer to previous path metrics
+    int16_t * m_new;            // pointer to updated path metrics
+    uint32_t * decisions;       // decision bits [num_steps x W]
+
+    // add-compare-select kernel
+    void (*update_func)(fec_conv_viterbi, unsigned char *, unsigned int);
+};
+
+// create Viterbi decoder object
+//  _K          :   constraint length, 7 <= _K <= 15
+//  _R          :   inverse code rate, 1 <= _R <= 6
+//  _poly       :   generator polynomials [size: _R x 1]
+//  _num_bits   :   maximum number of decoded bits (excluding tail)
+fec_conv_viterbi fec_conv_viterbi_create(unsigned int _K,
+                                         unsigned int _R,
+                                         int *        _poly,
+                                         unsigned int _num_bits)
+{
+    // validate input
+    if (_K < 7 || _K > 15) {
+        fprintf(stderr,"error: fec_conv_viterbi_create(), constraint length must be in [7,15]\n");
+        exit(1);
+    } else if (_R < 1 || _R > 6) {
+        fprintf(stderr,"error: fec_conv_viterbi_create(), inverse rate must be in [1,6]\n");
+        exit(1);
+    }
+
+    unsigned int r, i;
+    for (r=0; r<_R; r++) {
+        if ( !(_poly[r] & 1) || !((_poly[r] >> (_K-1)) & 1) ) {
+            fprintf(stderr,"error: fec_conv_viterbi_create(), polynomial 0x%x must tap both ends of register\n", _poly[r]);
+            exit(1);
+        }
+    }
+
+    fec_conv_viterbi q = (fec_conv_viterbi) malloc(sizeof(struct fec_conv_viterbi_s));
+    q->K         = _K;
+    q->R         = _R;
+    q->S         = 1 << (_K-1);
+    q->W         = q->S / 32;
+    q->num_steps = _num_bits + _K - 1;
+    q->renorm    = FEC_CONV_VITERBI_RENORM / (255*_R);
+
+    // compute branch table: expected output of each polynomial
+    // for old state i, input bit 0
+    unsigned int S2 = q->S / 2;
+    q->bt = (int16_t*) malloc(_R*S2*sizeof(int16_t));
+    for (r=0; r<_R; r++) {
+        for (i=0; i<S2; i++)
+            q->bt[r*S2+i] = liquid_count_ones_mod2((2*i) & _poly[r]) ? 255 : 0;
+    }
+
+    // allocate memory for path metrics and decisions
+    q->metrics0  = (int16_t*)  malloc(q->S*sizeof(int16_t));
+    q->metrics1  = (int16_t*)  malloc(q->S*sizeof(int16_t));
+    q->decisions = (uint32_t*) malloc(q->num_steps*q->W*sizeof(uint32_t));
+
+    // select kernel based on host processor
+    q->update_func = fec_conv_viterbi_update_port;
+#if FEC_CONV_VITERBI_SSE2
+    q->update_func = fec_conv_viterbi_update_sse2;
+#endif
+#if LIQUID_SIMD_DISPATCH
+    if (liquid_simd_get_level() >= LIQUID_SIMD_AVX2)
+        q->update_func = fec_conv_viterbi_update_avx2;
+#endif
+
+    // reset and return object
+    fec_conv_viterbi_reset(q);
+    return q;
+}
+
+// destroy Viterbi decoder object
+void fec_conv_viterbi_destroy(fec_conv_viterbi _q)
+{
+    free(_q->bt);
+    free(_q->metrics0);
+    free(_q->metrics1);
+    free(_q->decisions);
+    free(_q);
+}
+
+// reset decoder: trellis starts in state zero
+void fec_conv_viterbi_reset(fec_conv_viterbi _q)
+{
+    unsigned int i;
+    _q->metrics0[0] = 0;
+    for (i=1; i<_q->S; i++)
+        _q->metrics0[i] = FEC_CONV_VITERBI_PENALTY;
+
+    _q->m_old = _q->metrics0;
+    _q->m_new = _q->metrics1;
+    _q->step  = 0;
+}
+
+// select add-compare-select kernel
+int fec_conv_viterbi_set_kernel(fec_conv_viterbi        _q,
+                                fec_conv_viterbi_kernel _kernel)
+{
+    switch (_kernel) {
+    case FEC_CONV_VITERBI_KERNEL_PORT:
+        _q->update_func = fec_conv_viterbi_update_port;
+        return 1;
+#if FEC_CONV_VITERBI_SSE2
+    case FEC_CONV_VITERBI_KERNEL_SSE2:
+        _q->update_func = fec_conv_viterbi_update_sse2;
+        return 1;
+#endif
+#if LIQUID_SIMD_DISPATCH
+    case FEC_CONV_VITERBI_KERNEL_AVX2:
+        if (liquid_simd_get_level() < LIQUID_SIMD_AVX2)
+            return 0;
+        _q->update_func = fec_conv_viterbi_update_avx2;
+        return 1;
+#endif
+    default:;
+    }
+    return 0;
+}
+
+// copy current path metrics
+void fec_conv_viterbi_get_metrics(fec_conv_viterbi _q,
+                                  int16_t *        _metrics)
+{
+    memmove(_metrics, _q->m_old, _q->S*sizeof(int16_t));
+}
+
+// copy decisions of all trellis steps so far
+void fec_conv_viterbi_get_decisions(fec_conv_viterbi _q,
+                                    uint32_t *       _decisions)
+{
+    memmove(_decisions, _q->decisions, _q->step*_q->W*sizeof(uint32_t));
+}
+
+// run add-compare-select over block of soft symbols
+//  _q      :   decoder object
+//  _syms   :   soft symbols [size: _R*_n x 1]
+//  _n      :   number of trellis steps (decoded bits)
+void fec_conv_viterbi_update(fec_conv_viterbi _q,
+                             unsigned char *  _syms,
+                             unsigned int     _n)
+{
+    if (_q->step + _n > _q->num_steps) {
+        fprintf(stderr,"error: fec_conv_viterbi_update(), number of steps exceeds maximum (%u)\n", _q->num_steps);
+        exit(1);
+    }
+
+    _q->update_func(_q, _syms, _n);
+}
+
+// get predecessor of state _s from decisions of a single trellis step
+static inline unsigned int fec_conv_viterbi_prev(uint32_t *   _dec,
+                                                 unsigned int _s,
+                                                 unsigned int _shift)
+{
+    unsigned int i = _s >> 1;
+    unsigned int d;
+    if (_shift == 5) {
+        // K=7: both decision words fit in a single register, keeping
+        // the memory access independent of the state
+        uint64_t v = (uint64_t)_dec[0] | ((uint64_t)_dec[1] << 32);
+        d = (v >> (((_s&1)<<5) | i)) & 1;
+    } else {
+        d = (_dec[((i>>5)<<1) + (_s&1)] >> (i&31)) & 1;
+    }
+    return i | (d << _shift);
+}
+
+// trace decisions back from final state and write decoded bits
+//  _q          :   decoder object
+//  _data       :   decoded bits, packed msb-first [size: ceil(_nbits/8) x 1]
+//  _nbits      :   number of decoded bits to write (excluding tail)
+//  _endstate   :   final encoder state (zero for terminated codes)
+void fec_conv_viterbi_chainback(fec_conv_viterbi _q,
+                                unsigned char *  _data,
+                                unsigned int     _nbits,
+                                unsigned int     _endstate)
+{
+    unsigned int W     = _q->W;
+    unsigned int shift = _q->K - 2;
+    unsigned int s     = _endstate & (_q->S - 1);
+    unsigned int t     = _q->step;
+    unsigned char byte = 0;
+
+    if (_nbits > t) {
+        fprintf(stderr,"error: fec_conv_viterbi_chainback(), number of bits exceeds trellis length\n");
+        exit(1);
+    }
+
+    // trace back through tail (no output)
+    for ( ; t > _nbits; t--)
+        s = fec_conv_viterbi_prev(_q->decisions + (t-1)*W, s, shift);
+
+    // trace back through data; least-significant bit of each state is
+    // the input bit for that step
+    for ( ; t > 0; t--) {
+        byte |= (s & 1) << (7 - ((t-1)&7));
+        if (((t-1)&7) == 0) {
+            _data[(t-1) >> 3] = byte;
+            byte = 0;
+        }
+        s = fec_conv_viterbi_prev(_q->decisions + (t-1)*W, s, shift);
+    }
+}
+
+// swap metrics buffers after trellis step
+static inline void fec_conv_viterbi_swap(fec_conv_viterbi _q)
+{
+    int16_t * tmp = _q->m_old;
+    _q->m_old = _q->m_new;
+    _q->m_new = tmp;
+    _q->step++;
+}
+
+// portable add-compare-select
+void fec_conv_viterbi_update_port(fec_conv_viterbi _q,
+                                  unsigned char *  _syms,
+                                  unsigned int     _n)
+{
+    unsigned int S2   = _q->S / 2;
+    int          bmax = 255*_q->R;
+    unsigned int t, i, r;
+    for (t=0; t<_n; t++) {
+        unsigned char * syms = _syms + t*_q->R;
+        uint32_t * dec   = _q->decisions + _q->step*_q->W;
+        int16_t *  m_old = _q->m_old;
+        int16_t *  m_new = _q->m_new;
+
+        memset(dec, 0x00, _q->W*sizeof(uint32_t));
+        for (i=0; i<S2; i++) {
+            // branch metrics for input bit 0 (bm0) and 1 (bm1)
+            int bm0 = 0;
+            for (r=0; r<_q->R; r++)
+                bm0 += _q->bt[r*S2+i] ^ syms[r];
+            int bm1 = bmax - bm0;
+
+            // butterfly
+            int a0 = m_old[i]    + bm0;
+            int a1 = m_old[i+S2] + bm1;
+            int b0 = m_old[i]    + bm1;
+            int b1 = m_old[i+S2] + bm0;
+            m_new[2*i  ] = a0 > a1 ? a1 : a0;
+            m_new[2*i+1] = b0 > b1 ? b1 : b0;
+            dec[((i>>5)<<1)    ] |= (uint32_t)(a0 > a1) << (i&31);
+            dec[((i>>5)<<1) + 1] |= (uint32_t)(b0 > b1) << (i&31);
+        }
+
+        // re-normalize
+        if ( ((_q->step+1) % _q->renorm) == 0 ) {
+            int16_t m0 = m_new[0];
+            for (i=0; i<_q->S; i++)
+                m_new[i] -= m0;
+        }
+
+        fec_conv_viterbi_swap(_q);
+    }
+}
+
+#if FEC_CONV_VITERBI_SSE2
+// SSE2 add-compare-select, 8 butterflies at a time; the number of
+// symbols per step is passed as a constant so the branch metric loop
+// can be unrolled
+static inline void fec_conv_viterbi_run_sse2(fec_conv_viterbi _q,
+                                             unsigned char *  _syms,
+                                             unsigned int     _n,
+                                             unsigned int     _R)
+{
+    unsigned int S  = _q->S;
+    unsigned int S2 = _q->S / 2;
+    unsigned int t, i, r;
+    __m128i symv[6];
+    __m128i bmax = _mm_set1_epi16(255*_R);
+    for (t=0; t<_n; t++) {
+        unsigned char * syms = _syms + t*_R;
+        unsigned char * dec  = (unsigned char*)(_q->decisions + _q->step*_q->W);
+        int16_t * m_old = _q->m_old;
+        int16_t * m_new = _q->m_new;
+
+        for (r=0; r<_R; r++)
+            symv[r] = _mm_set1_epi16(syms[r]);
+
+        for (i=0; i<S2; i+=8) {
+            // branch metrics
+            __m128i bm0 = _mm_setzero_si128();
+            for (r=0; r<_R; r++) {
+                __m128i v = _mm_loadu_si128((__m128i*)(_q->bt + r*S2 + i));
+                bm0 = _mm_add_epi16(bm0, _mm_xor_si128(v, symv[r]));
+            }
+            __m128i bm1 = _mm_sub_epi16(bmax, bm0);
+
+            // butterflies
+            __m128i m0 = _mm_loadu_si128((__m128i*)(m_old + i));
+            __m128i m1 = _mm_loadu_si128((__m128i*)(m_old + i + S2));
+            __m128i a0 = _mm_adds_epi16(m0, bm0);
+            __m128i a1 = _mm_adds_epi16(m1, bm1);
+            __m128i b0 = _mm_adds_epi16(m0, bm1);
+            __m128i b1 = _mm_adds_epi16(m1, bm0);
+            __m128i ne = _mm_min_epi16(a0, a1);
+            __m128i no = _mm_min_epi16(b0, b1);
+
+            // interleave even/odd states
+            _mm_storeu_si128((__m128i*)(m_new + 2*i    ), _mm_unpacklo_epi16(ne, no));
+            _mm_storeu_si128((__m128i*)(m_new + 2*i + 8), _mm_unpackhi_epi16(ne, no));
+
+            // decisions: low byte even states, high byte odd states
+            // (little-endian byte order within each decision word)
+            unsigned int mask = _mm_movemask_epi8(
+                    _mm_packs_epi16(_mm_cmpgt_epi16(a0, a1), _mm_cmpgt_epi16(b0, b1)));
+            unsigned int k = ((i>>5)<<3) + ((i>>3)&3);
+            dec[k    ] = mask & 0xff;
+            dec[k + 4] = mask >> 8;
+        }
+
+        // re-normalize
+        if ( ((_q->step+1) % _q->renorm) == 0 ) {
+            __m128i v0 = _mm_set1_epi16(m_new[0]);
+            for (i=0; i<S; i+=8) {
+                __m128i v = _mm_loadu_si128((__m128i*)(m_new + i));
+                _mm_storeu_si128((__m128i*)(m_new + i), _mm_sub_epi16(v, v0));
+            }
+        }
+
+        fec_conv_viterbi_swap(_q);
+    }
+}
+
+void fec_conv_viterbi_update_sse2(fec_conv_viterbi _q,
+                                  unsigned char *  _syms,
+                                  unsigned int     _n)
+{
+    switch (_q->R) {
+    case 2:  fec_conv_viterbi_run_sse2(_q, _syms, _n, 2);     break;
+    case 3:  fec_conv_viterbi_run_sse2(_q, _syms, _n, 3);     break;
+    case 6:  fec_conv_viterbi_run_sse2(_q, _syms, _n, 6);     break;
+    default: fec_conv_viterbi_run_sse2(_q, _syms, _n, _q->R);
+    }
+}
+#endif
+
+#if LIQUID_SIMD_DISPATCH
+// AVX2 butterflies for 16 old states m0 (i...i+15) and m1 (i+S/2...),
+// returning the new metrics in state order and the decisions (low 16
+// bits even states, high 16 bits odd states)
+__attribute__((target("avx2"), always_inline))
+static inline unsigned int fec_conv_viterbi_bfly_avx2(__m256i   _m0,
+                                                      __m256i   _m1,
+                                                      __m256i   _bm0,
+                                                      __m256i   _bmax,
+                                                      __m256i * _n0,
+                                                      __m256i * _n1)
+{
+    __m256i bm1 = _mm256_sub_epi16(_bmax, _bm0);
+    __m256i a0  = _mm256_adds_epi16(_m0, _bm0);
+    __m256i a1  = _mm256_adds_epi16(_m1, bm1);
+    __m256i b0  = _mm256_adds_epi16(_m0, bm1);
+    __m256i b1  = _mm256_adds_epi16(_m1, _bm0);
+    __m256i ne  = _mm256_min_epi16(a0, a1);
+    __m256i no  = _mm256_min_epi16(b0, b1);
+
+    // interleave even/odd states (unpack operates on 128-bit lanes, so
+    // the halves are re-ordered afterwards)
+    __m256i lo = _mm256_unpacklo_epi16(ne, no);
+    __m256i hi = _mm256_unpackhi_epi16(ne, no);
+    *_n0 = _mm256_permute2x128_si256(lo, hi, 0x20);
+    *_n1 = _mm256_permute2x128_si256(lo, hi, 0x31);
+
+    __m256i d = _mm256_packs_epi16(_mm256_cmpgt_epi16(a0, a1),
+                                   _mm256_cmpgt_epi16(b0, b1));
+    return (unsigned int) _mm256_movemask_epi8(_mm256_permute4x64_epi64(d, 0xd8));
+}
+
+// AVX2 add-compare-select, 16 butterflies at a time
+__attribute__((target("avx2"), always_inline))
+static inline void fec_conv_viterbi_run_avx2(fec_conv_viterbi _q,
+                                             unsigned char *  _syms,
+                                             unsigned int     _n,
+                                             unsigned int     _R)
+{
+    unsigned int S  = _q->S;
+    unsigned int S2 = _q->S / 2;
+    unsigned int t, i, r;
+    __m256i symv[6];
+    __m256i bmax = _mm256_set1_epi16(255*_R);
+    for (t=0; t<_n; t++) {
+        unsigned char * syms = _syms + t*_R;
+        uint16_t * dec   = (uint16_t*)(_q->decisions + _q->step*_q->W);
+        int16_t *  m_old = _q->m_old;
+        int16_t *  m_new = _q->m_new;
+
+        for (r=0; r<_R; r++)
+            symv[r] = _mm256_set1_epi16(syms[r]);
+
+        for (i=0; i<S2; i+=16) {
+            // branch metrics
+            __m256i bm0 = _mm256_setzero_si256();
+            for (r=0; r<_R; r++) {
+                __m256i v = _mm256_loadu_si256((__m256i*)(_q->bt + r*S2 + i));
+                bm0 = _mm256_add_epi16(bm0, _mm256_xor_si256(v, symv[r]));
+            }
+
+            // butterflies
+            __m256i n0, n1;
+            unsigned int mask = fec_conv_viterbi_bfly_avx2(
+                    _mm256_loadu_si256((__m256i*)(m_old + i)),
+                    _mm256_loadu_si256((__m256i*)(m_old + i + S2)),
+                    bm0, bmax, &n0, &n1);
+            _mm256_storeu_si256((__m256i*)(m_new + 2*i     ), n0);
+            _mm256_storeu_si256((__m256i*)(m_new + 2*i + 16), n1);
+
+            // decisions (little-endian halves of each decision word)
+            unsigned int k = ((i>>5)<<2) + ((i>>4)&1);
+            dec[k    ] = mask & 0xffff;
+            dec[k + 2] = mask >> 16;
+        }
+
+        // re-normalize
+        if ( ((_q->step+1) % _q->renorm) == 0 ) {
+            __m256i v0 = _mm256_set1_epi16(m_new[0]);
+            for (i=0; i<S; i+=16) {
+                __m256i v = _mm256_loadu_si256((__m256i*)(m_new + i));
+                _mm256_storeu_si256((__m256i*)(m_new + i), _mm256_sub_epi16(v, v0));
+            }
+        }
+
+        fec_conv_viterbi_swap(_q);
+    }
+}
+
+// AVX2 butterflies for K=7 without the decision mask: old states _m0
+// (i...i+15) and _m1 (i+32...), returning the new metrics in state
+// order along with the comparisons for the even (_de) and odd (_do)
+// new states
+__attribute__((target("avx2"), always_inline))
+static inline void fec_conv_viterbi_acs_k7_avx2(__m256i   _m0,
+                                                __m256i   _m1,
+                                                __m256i   _bm0,
+                                                __m256i   _bm1,
+                                                __m256i * _n0,
+                                                __m256i * _n1,
+                                                __m256i * _de,
+                                                __m256i * _do)
+{
+    __m256i a0 = _mm256_adds_epi16(_m0, _bm0);
+    __m256i a1 = _mm256_adds_epi16(_m1, _bm1);
+    __m256i b0 = _mm256_adds_epi16(_m0, _bm1);
+    __m256i b1 = _mm256_adds_epi16(_m1, _bm0);
+    __m256i ne = _mm256_min_epi16(a0, a1);
+    __m256i no = _mm256_min_epi16(b0, b1);
+    *_de = _mm256_cmpgt_epi16(a0, a1);
+    *_do = _mm256_cmpgt_epi16(b0, b1);
+
+    __m256i lo = _mm256_unpacklo_epi16(ne, no);
+    __m256i hi = _mm256_unpackhi_epi16(ne, no);
+    *_n0 = _mm256_permute2x128_si256(lo, hi, 0x20);
+    *_n1 = _mm256_permute2x128_si256(lo, hi, 0x31);
+}
+
+// AVX2 add-compare-select for K=7 (64 states): path metrics are held in
+// registers for the entire block
+__attribute__((target("avx2"), always_inline))
+static inline void fec_conv_viterbi_run_k7_avx2(fec_conv_viterbi _q,
+                                                unsigned char *  _syms,
+                                                unsigned int     _n,
+                                                unsigned int     _R)
+{
+    unsigned int t, r, i;
+    __m256i bt[2][6];
+    for (r=0; r<_R; r++) {
+        bt[0][r] = _mm256_loadu_si256((__m256i*)(_q->bt + r*32     ));
+        bt[1][r] = _mm256_loadu_si256((__m256i*)(_q->bt + r*32 + 16));
+    }
+    __m256i bmax = _mm256_set1_epi16(255*_R);
+
+    // rate 1/2: branch metric of each state is k + c0*s0 + c1*s1 with
+    // c = +1 (expected 0) or -1 (expected 255), computed with a single
+    // multiply-add on the broadcast symbol pair
+    __m256i bk[2], bc[2];
+    if (_R == 2) {
+        int16_t k[16];
+        int8_t  c[32];
+        for (t=0; t<2; t++) {
+            for (i=0; i<16; i++) {
+                k[i]     = _q->bt[t*16 + i] + _q->bt[32 + t*16 + i];
+                c[2*i  ] = _q->bt[     t*16 + i] ? -1 : 1;
+                c[2*i+1] = _q->bt[32 + t*16 + i] ? -1 : 1;
+            }
+            bk[t] = _mm256_loadu_si256((__m256i*)k);
+            bc[t] = _mm256_loadu_si256((__m256i*)c);
+        }
+    }
+
+    // load path metrics (states 0-15, 16-31, 32-47, 48-63)
+    __m256i m0 = _mm256_loadu_si256((__m256i*)(_q->m_old     ));
+    __m256i m1 = _mm256_loadu_si256((__m256i*)(_q->m_old + 16));
+    __m256i m2 = _mm256_loadu_si256((__m256i*)(_q->m_old + 32));
+    __m256i m3 = _mm256_loadu_si256((__m256i*)(_q->m_old + 48));
+
+    uint32_t * dec = _q->decisions + _q->step*2;
+    unsigned int count = _q->step % _q->renorm;
+    for (t=0; t<_n; t++) {
+        unsigned char * syms = _syms + t*_R;
+
+        // branch metrics
+        __m256i bm0 = _mm256_setzero_si256();
+        __m256i bm1 = _mm256_setzero_si256();
+        if (_R == 2) {
+            uint16_t pair;
+            memcpy(&pair, syms, 2);
+            __m256i s = _mm256_set1_epi16((int16_t)pair);
+            bm0 = _mm256_add_epi16(bk[0], _mm256_maddubs_epi16(s, bc[0]));
+            bm1 = _mm256_add_epi16(bk[1], _mm256_maddubs_epi16(s, bc[1]));
+        } else {
+            for (r=0; r<_R; r++) {
+                __m256i s = _mm256_set1_epi16(syms[r]);
+                bm0 = _mm256_add_epi16(bm0, _mm256_xor_si256(bt[0][r], s));
+                bm1 = _mm256_add_epi16(bm1, _mm256_xor_si256(bt[1][r], s));
+            }
+        }
+
+        // butterflies: old states (0-15, 32-47) and (16-31, 48-63)
+        __m256i n0, n1, n2, n3, e0, o0, e1, o1;
+        fec_conv_viterbi_acs_k7_avx2(m0, m2, bm0, _mm256_sub_epi16(bmax, bm0), &n0, &n1, &e0, &o0);
+        fec_conv_viterbi_acs_k7_avx2(m1, m3, bm1, _mm256_sub_epi16(bmax, bm1), &n2, &n3, &e1, &o1);
+        m0 = n0; m1 = n1; m2 = n2; m3 = n3;
+
+        // decisions: even states (i = 0...31) then odd states
+        __m256i de = _mm256_permute4x64_epi64(_mm256_packs_epi16(e0, e1), 0xd8);
+        __m256i dd = _mm256_permute4x64_epi64(_mm256_packs_epi16(o0, o1), 0xd8);
+        dec[2*t  ] = (uint32_t) _mm256_movemask_epi8(de);
+        dec[2*t+1] = (uint32_t) _mm256_movemask_epi8(dd);
+
+        // re-normalize
+        if (++count == _q->renorm) {
+            count = 0;
+            __m256i v = _mm256_broadcastw_epi16(_mm256_castsi256_si128(m0));
+            m0 = _mm256_sub_epi16(m0, v);
+            m1 = _mm256_sub_epi16(m1, v);
+            m2 = _mm256_sub_epi16(m2, v);
+            m3 = _mm256_sub_epi16(m3, v);
+        }
+    }
+
+    // store path metrics
+    _mm256_storeu_si256((__m256i*)(_q->m_old     ), m0);
+    _mm256_storeu_si256((__m256i*)(_q->m_old + 16), m1);
+    _mm256_storeu_si256((__m256i*)(_q->m_old + 32), m2);
+    _mm256_storeu_si256((__m256i*)(_q->m_old + 48), m3);
+    _q->step += _n;
+}
+
+__attribute__((target("avx2")))
+void fec_conv_viterbi_update_avx2(fec_conv_viterbi _q,
+                                  unsigned char *  _syms,
+                                  unsigned int     _n)
+{
+    if (_q->K == 7) {
+        switch (_q->R) {
+        case 2:  fec_conv_viterbi_run_k7_avx2(_q, _syms, _n, 2);    break;
+        default: fec_conv_viterbi_run_k7_avx2(_q, _syms, _n, _q->R);
+        }
+        return;
+    }
+
+    switch (_q->R) {
+    case 2:  fec_conv_viterbi_run_avx2(_q, _syms, _n, 2);     break;
+    case 3:  fec_conv_viterbi_run_avx2(_q, _syms, _n, 3);     break;
+    case 6:  fec_conv_viterbi_run_avx2(_q, _syms, _n, 6);     break;
+    default: fec_conv_viterbi_run_avx2(_q, _syms, _n, _q->R);
+    }
+}
+#endif
@@ -62,6 +62,10 @@ unsigned int golay2412_H[12] = {
     0x00080ed1, 0x00040da3, 0x00020b47, 0x0001068f,
     0x00008d1d, 0x00004a3b, 0x00002477, 0x00001ffe};
 
+// parity of 12-bit message from look-up table, p(m) = m*P
+#define golay2412_parity(m) (golay2412_enc_gentab[0][(m) >> 6] ^ \
+                             golay2412_enc_gentab[1][(m) & 0x3f])
+
 // multiply input vector with parity check matrix, H
 unsigned int golay2412_matrix_mul(unsigned int   _v,
                                   unsigned int * _A,
@@ -98,8 +102,8 @@ unsigned int fec_golay2412_encode_symbol(unsigned int _sym_dec)
         exit(1);
     }
 
-    // compute encoded/transmitted message: v = m*G
-    return golay2412_matrix_mul(_sym_dec, golay2412_Gt, 24);
+    // compute encoded/transmitted message: v = m*G = [p(m), m]
+    return (golay2412_parity(_sym_dec) << 12) | _sym_dec;
 }
 
 // search for p[i] such that w(v+p[i]) <= 2, return -1 on fail
@@ -127,6 +131,7 @@ int golay2412_parity_search(unsigned int _v)
     return -1;
 }
 
+// decode symbol using syndrome look-up table
 unsigned int fec_golay2412_decode_symbol(unsigned int _sym_enc)
 {
     // validate input
@@ -135,14 +140,20 @@ unsigned int fec_golay2412_decode_symbol(unsigned int _sym_enc)
         exit(1);
     }
 
+    // syndrome, s = r*H^T = [r_p] + p(r_m), selects message correction
+    unsigned int m = _sym_enc & 0x0fff;
+    unsigned int s = (_sym_enc >> 12) ^ golay2412_parity(m);
+
+    return m ^ golay2412_dec_gentab[s];
+}
+
+// estimate error vector from syndrome (used to generate look-up table)
+unsigned int golay2412_estimate_ehat(unsigned int _s)
+{
     // state variables
-    unsigned int s=0;       // syndrome vector
+    unsigned int s=_s;      // syndrome vector
     unsigned int e_hat=0;   // estimated error vector
-    unsigned int v_hat=0;   // estimated transmitted message
-    unsigned int m_hat=0;   // estimated original message
-    
-    // compute syndrome vector, s = r*H^T = ( H*r^T )^T
-    s = golay2412_matrix_mul(_sym_enc, golay2412_H, 12);
+
 #if DEBUG_FEC_GOLAY2412
     printf("s (syndrome vector): "); liquid_print_bitstring(s,12); printf("\n");
 #endif
@@ -220,18 +231,7 @@ unsigned int fec_golay2412_decode_symbol(unsigned int _sym_enc)
         }
     }
 
-    // step 8: compute estimated transmitted message: v_hat = r + e_hat
-    v_hat = _sym_enc ^ e_hat;
-#if DEBUG_FEC_GOLAY2412
-    printf("r (recevied vector):            "); liquid_print_bitstring(_sym_enc,24); printf("\n");
-    printf("e-hat (estimated error vector): "); liquid_print_bitstring(e_hat,24);    printf("\n");
-    printf("v-hat (estimated tx vector):    "); liquid_print_bitstring(v_hat,24);    printf("\n");
-#endif
-    
-    // compute estimated original message: (last 12 bits of encoded message)
-    m_hat = v_hat & 0x0fff;
-
-    return m_hat;
+    return e_hat;
 }
 
 // create Golay(24,12) codec object
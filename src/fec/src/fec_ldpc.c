@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Quasi-cyclic LDPC codes
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "liquid.internal.h"
+
+#define VERBOSE_FEC_LDPC    0
+
+// maximum number of decoder iterations
+#define FEC_LDPC_MAX_ITERATIONS (20)
+
+// available circulant sizes, in increasing order; the codeword lengths
+// are 648, 1296, 1944, 16200, and 64800 bits
+static const unsigned int fec_ldpc_lifting[5] = {27, 54, 81, 675, 2700};
+
+fec fec_ldpc_create(fec_scheme _fs)
+{
+    fec q = (fec) malloc(sizeof(struct fec_s));
+
+    q->scheme = _fs;
+    q->rate = fec_get_rate(q->scheme);
+
+    q->encode_func      = &fec_ldpc_encode;
+    q->decode_func      = &fec_ldpc_decode;
+    q->decode_soft_func = &fec_ldpc_decode_soft;
+
+    q->ldpc_kb = fec_ldpc_get_kb(q->scheme);
+
+    // internal codec object is created once the message length is known
+    q->num_dec_bytes = 0;
+    q->ldpc_Z        = 0;
+    q->ldpc          = NULL;
+    q->ldpc_llr      = NULL;
+    q->ldpc_bits     = NULL;
+
+    return q;
+}
+
+void fec_ldpc_destroy(fec _q)
+{
+    // delete internal codec object and memory arrays
+    if (_q->ldpc != NULL)
+        fec_ldpc_codec_destroy(_q->ldpc);
+    free(_q->ldpc_llr);
+    free(_q->ldpc_bits);
+
+    // delete fec object
+    free(_q);
+}
+
+void fec_ldpc_encode(fec _q,
+                     unsigned int _dec_msg_len,
+                     unsigned char *_msg_dec,
+                     unsigned char *_msg_enc)
+{
+    // validate input
+    if (_dec_msg_len == 0) {
+        fprintf(stderr,"error: fec_ldpc_encode(), input length must be > 0\n");
+        exit(1);
+    }
+
+    // re-allocate resources if necessary
+    fec_ldpc_setlength(_q, _dec_msg_len);
+
+    unsigned int K = _q->ldpc_kb * _q->ldpc_Z;
+    unsigned int M = FEC_LDPC_NB_COLS * _q->ldpc_Z - K;
+    unsigned int i, j;
+    unsigned int n0=0;  // input index
+    unsigned int n1=0;  // output index
+    unsigned int block_size = _q->dec_block_len;
+    for (i=0; i<_q->num_blocks; i++) {
+
+        // the last block is smaller by the residual block length
+        if (i == _q->num_blocks-1)
+            block_size -= _q->res_block_len;
+
+        // expand data to bits, shortening the code with zeros
+        memset(_q->ldpc_bits, 0x00, K*sizeof(unsigned char));
+        for (j=0; j<8*block_size; j++)
+            _q->ldpc_bits[j] = (_msg_dec[n0 + j/8] >> (7 - j%8)) & 0x01;
+
+        // compute parity bits
+        fec_ldpc_codec_encode(_q->ldpc, _q->ldpc_bits, _q->ldpc_bits + K);
+
+        // copy systematic bytes, padding the last block with zeros
+        memmove(&_msg_enc[n1], &_msg_dec[n0], block_size*sizeof(unsigned char));
+        memset(&_msg_enc[n1+block_size], 0x00, (_q->dec_block_len-block_size)*sizeof(unsigned char));
+
+        // append parity bits (msb-first)
+        unsigned char * p = &_msg_enc[n1 + _q->dec_block_len];
+        memset(p, 0x00, (_q->enc_block_len - _q->dec_block_len)*sizeof(unsigned char));
+        for (j=0; j<M; j++)
+            p[j/8] |= _q->ldpc_bits[K+j] << (7 - j%8);
+
+        // increment counters
+        n0 += block_size;
+        n1 += _q->enc_block_len;
+    }
+
+    // sanity check
+    assert( n0 == _q->num_dec_bytes );
+    assert( n1 == _q->num_enc_bytes );
+}
+
+void fec_ldpc_decode(fec _q,
+                     unsigned int _dec_msg_len,
+                     unsigned char *_msg_enc,
+                     unsigned char *_msg_dec)
+{
+    // expand to soft bits and run soft-decision decoder
+    unsigned int enc_msg_len = fec_get_enc_msg_length(_q->scheme, _dec_msg_len);
+    unsigned char * soft = (unsigned char*) malloc(8*enc_msg_len*sizeof(unsigned char));
+    unsigned int i;
+    for (i=0; i<8*enc_msg_len; i++)
+        soft[i] = ((_msg_enc[i/8] >> (7 - i%8)) & 0x01) ? LIQUID_SOFTBIT_1 : LIQUID_SOFTBIT_0;
+
+    fec_ldpc_decode_soft(_q, _dec_msg_len, soft, _msg_dec);
+    free(soft);
+}
+
+void fec_ldpc_decode_soft(fec _q,
+                          unsigned int _dec_msg_len,
+                          unsigned char *_msg_enc,
+                          unsigned char *_msg_dec)
+{
+    // validate input
+    if (_dec_msg_len == 0) {
+        fprintf(stderr,"error: fec_ldpc_decode_soft(), input length must be > 0\n");
+        exit(1);
+    }
+
+    // re-allocate resources if necessary
+    fec_ldpc_setlength(_q, _dec_msg_len);
+
+    unsigned int K = _q->ldpc_kb * _q->ldpc_Z;
+    unsigned int M = FEC_LDPC_NB_COLS * _q->ldpc_Z - K;
+    unsigned int i, j;
+    unsigned int n0=0;  // input index (soft bits)
+    unsigned int n1=0;  // output index
+    unsigned int block_size = _q->dec_block_len;
+    for (i=0; i<_q->num_blocks; i++) {
+
+        // the last block is smaller by the residual block length
+        if (i == _q->num_blocks-1)
+            block_size -= _q->res_block_len;
+
+        // convert soft bits to log-likelihood ratios (positive for zero);
+        // padded and shortened bits are known to be zero
+        for (j=0; j<8*block_size; j++)
+            _q->ldpc_llr[j] = (127 - (int)_msg_enc[n0 + j]) >> 2;
+        for (j=8*block_size; j<K; j++)
+            _q->ldpc_llr[j] = 127;
+        unsigned char * p = &_msg_enc[n0 + 8*_q->dec_block_len];
+        for (j=0; j<M; j++)
+            _q->ldpc_llr[K+j] = (127 - (int)p[j]) >> 2;
+
+        // decode block; blocks which fail the parity checks after the
+        // maximum number of iterations return their best estimate
+        fec_ldpc_codec_decode(_q->ldpc, _q->ldpc_llr, FEC_LDPC_MAX_ITERATIONS, _q->ldpc_bits);
+
+        // pack result
+        memset(&_msg_dec[n1], 0x00, block_size*sizeof(unsigned char));
+        for (j=0; j<8*block_size; j++)
+            _msg_dec[n1 + j/8] |= _q->ldpc_bits[j] << (7 - j%8);
+
+        // increment counters
+        n0 += 8*_q->enc_block_len;
+        n1 += block_size;
+    }
+
+    // sanity check
+    assert( n0 == 8*_q->num_enc_bytes );
+    assert( n1 == _q->num_dec_bytes );
+}
+
+// Set dec_msg_len, re-computing block lengths and re-creating the codec
+// as necessary. The message is divided into blocks of (at most) the
+// number of whole bytes which fit into the information part of one
+// codeword; the remaining information bits are shortened (zero and not
+// transmitted). Each encoded block holds its data bytes followed by the
+// parity bits, padded to a whole number of bytes.
+void fec_ldpc_setlength(fec _q,
+                        unsigned int _dec_msg_len)
+{
+    // return if length has not changed
+    if (_dec_msg_len == _q->num_dec_bytes)
+        return;
+
+    // reset lengths
+    _q->num_dec_bytes = _dec_msg_len;
+
+    // select circulant size and re-create codec if it has changed
+    unsigned int Z = fec_ldpc_get_lifting(_dec_msg_len, _q->ldpc_kb);
+    if (Z != _q->ldpc_Z) {
+        if (_q->ldpc != NULL)
+            fec_ldpc_codec_destroy(_q->ldpc);
+        _q->ldpc_Z = Z;
+        _q->ldpc   = fec_ldpc_codec_create(_q->ldpc_kb, Z);
+        unsigned int N = FEC_LDPC_NB_COLS * Z;
+        _q->ldpc_llr  = (signed char*)   realloc(_q->ldpc_llr,  N*sizeof(signed char));
+        _q->ldpc_bits = (unsigned char*) realloc(_q->ldpc_bits, N*sizeof(unsigned char));
+    }
+
+    div_t d;
+    unsigned int kk = (_q->ldpc_kb * Z) / 8;
+
+    // compute the total number of blocks necessary: ceil(num_dec_bytes / kk)
+    d = div(_q->num_dec_bytes, kk);
+    _q->num_blocks = d.quot + (d.rem==0 ? 0 : 1);
+
+    // compute the decoded block length: ceil(num_dec_bytes / num_blocks)
+    d = div(_dec_msg_len, _q->num_blocks);
+    _q->dec_block_len = d.quot + (d.rem == 0 ? 0 : 1);
+
+    // compute the encoded block length: dec_block_len + ceil(parity bits / 8)
+    unsigned int M = (FEC_LDPC_NB_COLS - _q->ldpc_kb) * Z;
+    _q->enc_block_len = _q->dec_block_len + (M + 7) / 8;
+
+    // compute the residual padding symbols in the last block
+    _q->res_block_len = _q->num_blocks*_q->dec_block_len - _q->num_dec_bytes;
+
+    // compute the final encoded block length: enc_block_len * num_blocks
+    _q->num_enc_bytes = _q->enc_block_len * _q->num_blocks;
+
+#if VERBOSE_FEC_LDPC
+    printf("dec_msg_len     :   %u\n", _q->num_dec_bytes);
+    printf("Z               :   %u\n", Z);
+    printf("num_blocks      :   %u\n", _q->num_blocks);
+    printf("dec_block_len   :   %u\n", _q->dec_block_len);
+    printf("enc_block_len   :   %u\n", _q->enc_block_len);
+    printf("res_block_len   :   %u\n", _q->res_block_len);
+    printf("enc_msg_len     :   %u\n", _q->num_enc_bytes);
+#endif
+}
+
+// get number of systematic block columns for scheme
+unsigned int fec_ldpc_get_kb(fec_scheme _scheme)
+{
+    switch (_scheme) {
+    case LIQUID_FEC_LDPC_R12:   return 12;
+    case LIQUID_FEC_LDPC_R23:   return 16;
+    case LIQUID_FEC_LDPC_R34:   return 18;
+    case LIQUID_FEC_LDPC_R56:   return 20;
+    default:
+        fprintf(stderr,"error: fec_ldpc_get_kb(), invalid type\n");
+        exit(1);
+    }
+    return 0;
+}
+
+// select circulant size for a message: the largest whose blocks waste
+// no more than a quarter of the message in shortened bytes, otherwise
+// the smallest available
+//  _dec_msg_len    :   decoded message length (bytes)
+//  _kb             :   systematic block columns
+unsigned int fec_ldpc_get_lifting(unsigned int _dec_msg_len,
+                                  unsigned int _kb)
+{
+    unsigned int Z = fec_ldpc_lifting[0];
+    unsigned int i;
+    for (i=1; i<5; i++) {
+        unsigned int kk = (_kb * fec_ldpc_lifting[i]) / 8;
+        unsigned int num_blocks = (_dec_msg_len + kk - 1) / kk;
+        if (4*num_blocks*kk <= 5*_dec_msg_len)
+            Z = fec_ldpc_lifting[i];
+    }
+    return Z;
+}
+
+// compute encoded message length for LDPC codes
+//  _dec_msg_len    :   decoded message length (bytes)
+//  _kb             :   systematic block columns
+unsigned int fec_ldpc_get_enc_msg_len(unsigned int _dec_msg_len,
+                                      unsigned int _kb)
+{
+    // validate input
+    if (_dec_msg_len == 0) {
+        fprintf(stderr,"error: fec_ldpc_get_enc_msg_len(), _dec_msg_len must be greater than 0\n");
+        exit(1);
+    }
+
+    unsigned int Z  = fec_ldpc_get_lifting(_dec_msg_len, _kb);
+    unsigned int kk = (_kb * Z) / 8;
+    unsigned int num_blocks    = (_dec_msg_len + kk - 1) / kk;
+    unsigned int dec_block_len = (_dec_msg_len + num_blocks - 1) / num_blocks;
+    unsigned int enc_block_len = dec_block_len + ((FEC_LDPC_NB_COLS - _kb)*Z + 7) / 8;
+    return enc_block_len * num_blocks;
+}
@@ -0,0 +1,537 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Quasi-cyclic LDPC codec
+//
+// The parity-check matrix is expanded from a base matrix of 24 block
+// columns, each non-zero entry standing for a Z x Z identity matrix
+// cyclically shifted by its exponent: row z of the block checks bit
+// (z + shift) mod Z of the block column. The parity part follows the
+// 802.11n structure (one weight-3 column with equal exponents at the
+// top and bottom and zero in the middle, followed by a dual diagonal)
+// so codewords are computed in linear time. Exponents are assigned
+// deterministically for each lifting size, avoiding cycles of length
+// four in the expanded graph.
+//
+// Decoding runs the normalized min-sum algorithm one block row (layer)
+// at a time, updating the a posteriori values in place, with 8-bit
+// saturating messages. Each layer is processed across the Z rows of
+// its circulants at once (AVX2 when available at run time), and the
+// decoder stops as soon as all parity checks are satisfied.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+#if LIQUID_SIMD_DISPATCH
+#include <immintrin.h>  // AVX2 (selected at run time)
+#endif
+
+// circulant storage is padded to a multiple of this many messages
+#define FEC_LDPC_ALIGN (32)
+
+// internal methods
+void fec_ldpc_codec_init_base(fec_ldpc_codec _q);
+void fec_ldpc_codec_layer_port(fec_ldpc_codec _q,
+                               unsigned int   _r);
+#if LIQUID_SIMD_DISPATCH
+void fec_ldpc_codec_layer_avx2(fec_ldpc_codec _q,
+                               unsigned int   _r);
+#endif
+int fec_ldpc_codec_check(fec_ldpc_codec _q);
+
+struct fec_ldpc_codec_s {
+    unsigned int kb;            // systematic block columns
+    unsigned int mb;            // block rows (parity block columns)
+    unsigned int Z;             // circulant size
+    unsigned int Zp;            // circulant storage size (padded)
+    unsigned int num_edges;     // number of non-zero base entries
+    unsigned int max_degree;    // maximum number of entries in a row
+
+    // base matrix entries listed by row
+    unsigned int * row_start;   // first entry of each row [size: mb+1]
+    unsigned int * col;         // block column of each entry
+    unsigned int * shift;       // circulant shift of each entry
+
+    // decoder state
+    signed char * L;            // a posteriori values [size: nb x Zp]
+    signed char * R;            // check messages [size: num_edges x Zp]
+    signed char * T;            // layer workspace [size: max_degree x Zp]
+
+    // encoder workspace
+    unsigned char * lambda;     // systematic part of checks [size: mb x Z]
+
+    // layer update kernel
+    void (*layer_func)(fec_ldpc_codec, unsigned int);
+};
+
+// systematic column degrees for each rate
+static const unsigned char fec_ldpc_deg_r12[12] =
+    {11, 3, 3, 3, 11, 3, 3, 3, 11, 3, 4, 3};
+static const unsigned char fec_ldpc_deg_r23[16] =
+    {8, 3, 3, 3, 8, 3, 3, 3, 8, 3, 3, 3, 8, 3, 3, 3};
+static const unsigned char fec_ldpc_deg_r34[18] =
+    {6, 3, 3, 3, 3, 3, 6, 3, 3, 3, 3, 3, 6, 3, 3, 3, 3, 3};
+static const unsigned char fec_ldpc_deg_r56[20] =
+    {4, 3, 3, 3, 3, 4, 3, 3, 3, 3, 4, 3, 3, 3, 3, 4, 3, 3, 3, 3};
+
+// create LDPC codec object
+//  _kb     :   systematic block columns (12, 16, 18, or 20 of 24)
+//  _Z      :   circulant size, _Z >= 24
+fec_ldpc_codec fec_ldpc_codec_create(unsigned int _kb,
+                                     unsigned int _Z)
+{
+    // validate input
+    if (_kb != 12 && _kb != 16 && _kb != 18 && _kb != 20) {
+        fprintf(stderr,"error: fec_ldpc_codec_create(), unsupported number of systematic columns (%u)\n", _kb);
+        exit(1);
+    } else if (_Z < 24) {
+        fprintf(stderr,"error: fec_ldpc_codec_create(), circulant size must be at least 24\n");
+        exit(1);
+    }
+
+    fec_ldpc_codec q = (fec_ldpc_codec) malloc(sizeof(struct fec_ldpc_codec_s));
+    q->kb = _kb;
+    q->mb = FEC_LDPC_NB_COLS - _kb;
+    q->Z  = _Z;
+    q->Zp = ((_Z + FEC_LDPC_ALIGN - 1) / FEC_LDPC_ALIGN) * FEC_LDPC_ALIGN;
+
+    // generate base matrix
+    fec_ldpc_codec_init_base(q);
+
+    // allocate decoder and encoder memory
+    q->L = (signed char*) malloc(FEC_LDPC_NB_COLS*q->Zp*sizeof(signed char));
+    q->R = (signed char*) malloc(q->num_edges*q->Zp*sizeof(signed char));
+    q->T = (signed char*) calloc(q->max_degree*q->Zp, sizeof(signed char));
+    q->lambda = (unsigned char*) malloc(q->mb*q->Z*sizeof(unsigned char));
+
+    // select layer kernel
+    q->layer_func = fec_ldpc_codec_layer_port;
+#if LIQUID_SIMD_DISPATCH
+    if (liquid_simd_get_level() >= LIQUID_SIMD_AVX2)
+        q->layer_func = fec_ldpc_codec_layer_avx2;
+#endif
+    return q;
+}
+
+void fec_ldpc_codec_destroy(fec_ldpc_codec _q)
+{
+    free(_q->row_start);
+    free(_q->col);
+    free(_q->shift);
+    free(_q->L);
+    free(_q->R);
+    free(_q->T);
+    free(_q->lambda);
+    free(_q);
+}
+
+// get codeword length (bits)
+unsigned int fec_ldpc_codec_get_n(fec_ldpc_codec _q)
+{
+    return FEC_LDPC_NB_COLS * _q->Z;
+}
+
+// get number of information bits
+unsigned int fec_ldpc_codec_get_k(fec_ldpc_codec _q)
+{
+    return _q->kb * _q->Z;
+}
+
+// generate expanded parity-check matrix [size: (N-K) x N]
+smatrixb fec_ldpc_codec_get_H(fec_ldpc_codec _q)
+{
+    smatrixb H = smatrixb_create(_q->mb*_q->Z, FEC_LDPC_NB_COLS*_q->Z);
+    unsigned int r, e, z;
+    for (r=0; r<_q->mb; r++) {
+        for (e=_q->row_start[r]; e<_q->row_start[r+1]; e++) {
+            for (z=0; z<_q->Z; z++)
+                smatrixb_set(H, r*_q->Z + z, _q->col[e]*_q->Z + (z + _q->shift[e]) % _q->Z, 1);
+        }
+    }
+    return H;
+}
+
+// compute parity bits of a codeword
+//  _q      :   codec object
+//  _msg    :   information bits, one per byte [size: K x 1]
+//  _parity :   parity bits, one per byte [size: N-K x 1]
+void fec_ldpc_codec_encode(fec_ldpc_codec  _q,
+                           unsigned char * _msg,
+                           unsigned char * _parity)
+{
+    unsigned int Z  = _q->Z;
+    unsigned int mb = _q->mb;
+    unsigned int r, e, z;
+
+    // checks over systematic bits: lambda_r = sum_c P^shift m_c
+    memset(_q->lambda, 0x00, mb*Z*sizeof(unsigned char));
+    for (r=0; r<mb; r++) {
+        unsigned char * lambda = _q->lambda + r*Z;
+        for (e=_q->row_start[r]; e<_q->row_start[r+1]; e++) {
+            if (_q->col[e] >= _q->kb)
+                continue;
+            unsigned char * m = _msg + _q->col[e]*Z;
+            unsigned int s = _q->shift[e];
+            for (z=0; z<Z-s; z++) lambda[z]       ^= m[z+s];
+            for (z=0; z<s;   z++) lambda[Z-s+z]   ^= m[z];
+        }
+    }
+
+    // first parity block is the sum of all checks, since the shifted
+    // copies in the top and bottom rows cancel
+    unsigned char * p0 = _parity;
+    memmove(p0, _q->lambda, Z*sizeof(unsigned char));
+    for (r=1; r<mb; r++) {
+        for (z=0; z<Z; z++)
+            p0[z] ^= _q->lambda[r*Z + z];
+    }
+
+    // remaining blocks follow the dual diagonal: the top row gives
+    // p_1 = lambda_0 + P^x p_0, and row r gives p_{r+1} from p_r
+    unsigned int x   = _q->shift[_q->row_start[1] - 2];
+    unsigned int mid = mb / 2;
+    unsigned char * p1 = _parity + Z;
+    for (z=0; z<Z; z++)
+        p1[z] = _q->lambda[z] ^ p0[(z + x) % Z];
+    for (r=1; r<mb-1; r++) {
+        unsigned char * pr = _parity + r*Z;
+        for (z=0; z<Z; z++)
+            pr[Z+z] = _q->lambda[r*Z + z] ^ pr[z] ^ (r == mid ? p0[z] : 0);
+    }
+}
+
+// decode codeword from log-likelihood ratios
+//  _q              :   codec object
+//  _llr            :   input LLRs, positive for zero [size: N x 1]
+//  _max_iterations :   maximum number of iterations
+//  _msg            :   decoded information bits, one per byte [size: K x 1]
+// returns number of iterations run if all checks are satisfied, or -1
+int fec_ldpc_codec_decode(fec_ldpc_codec  _q,
+                          signed char *   _llr,
+                          unsigned int    _max_iterations,
+                          unsigned char * _msg)
+{
+    unsigned int Z  = _q->Z;
+    unsigned int Zp = _q->Zp;
+    unsigned int c, r, z;
+
+    // initialize a posteriori values with channel, messages with zero
+    for (c=0; c<FEC_LDPC_NB_COLS; c++) {
+        for (z=0; z<Z; z++)
+            _q->L[c*Zp + z] = _llr[c*Z + z] < -127 ? -127 : _llr[c*Z + z];
+        memset(_q->L + c*Zp + Z, 0x00, (Zp - Z)*sizeof(signed char));
+    }
+    memset(_q->R, 0x00, _q->num_edges*Zp*sizeof(signed char));
+
+    int rc = fec_ldpc_codec_check(_q) ? 0 : -1;
+    unsigned int i;
+    for (i=0; i<_max_iterations && rc < 0; i++) {
+        for (r=0; r<_q->mb; r++)
+            _q->layer_func(_q, r);
+        if (fec_ldpc_codec_check(_q))
+            rc = i + 1;
+    }
+
+    // hard decisions on systematic bits
+    for (c=0; c<_q->kb; c++) {
+        for (z=0; z<Z; z++)
+            _msg[c*Z + z] = _q->L[c*Zp + z] < 0;
+    }
+    return rc;
+}
+
+//
+// internal methods
+//
+
+// generate base matrix for the given rate and lifting size
+void fec_ldpc_codec_init_base(fec_ldpc_codec _q)
+{
+    unsigned int kb = _q->kb;
+    unsigned int mb = _q->mb;
+    unsigned int Z  = _q->Z;
+    const unsigned char * deg = NULL;
+    switch (kb) {
+    case 12: deg = fec_ldpc_deg_r12; break;
+    case 16: deg = fec_ldpc_deg_r23; break;
+    case 18: deg = fec_ldpc_deg_r34; break;
+    case 20: deg = fec_ldpc_deg_r56; break;
+    default:;
+    }
+
+    // base matrix: shift of each entry, or -1 where empty
+    int B[mb][FEC_LDPC_NB_COLS];
+    unsigned int weight[mb];
+    unsigned int r, c, i;
+    for (r=0; r<mb; r++) {
+        for (c=0; c<FEC_LDPC_NB_COLS; c++)
+            B[r][c] = -1;
+        weight[r] = 0;
+    }
+
+    // parity part: weight-3 column, then dual diagonal
+    unsigned int mid = mb / 2;
+    B[0][kb] = B[mb-1][kb] = 1;
+    B[mid][kb] = 0;
+    for (r=0; r<mb-1; r++)
+        B[r][kb+1+r] = B[r+1][kb+1+r] = 0;
+    for (r=0; r<mb; r++)
+        weight[r] = r == 0 || r == mb-1 || r == mid ? 3 : 2;
+
+    // place systematic entries in the lightest rows, spreading ties
+    for (c=0; c<kb; c++) {
+        for (i=0; i<deg[c]; i++) {
+            unsigned int r_min = 0, w_min = (unsigned int)-1;
+            unsigned int k;
+            for (k=0; k<mb; k++) {
+                unsigned int rr = (k + 5*c) % mb;
+                if (B[rr][c] < 0 && weight[rr] < w_min) {
+                    r_min = rr;
+                    w_min = weight[rr];
+                }
+            }
+            B[r_min][c] = 0;    // assigned below
+            weight[r_min]++;
+        }
+    }
+
+    // assign shifts column by column: a pair of rows (r,r2) shared by
+    // columns c and c2 closes a cycle of length four when
+    // B[r][c] - B[r2][c] = B[r][c2] - B[r2][c2] (mod Z)
+    int assigned[mb][FEC_LDPC_NB_COLS];
+    for (r=0; r<mb; r++) {
+        for (c=0; c<FEC_LDPC_NB_COLS; c++)
+            assigned[r][c] = c >= kb && B[r][c] >= 0;
+    }
+    unsigned int state = 0x2545f491u ^ (Z * 2654435761u) ^ kb;
+    for (c=0; c<kb; c++) {
+        for (r=0; r<mb; r++) {
+            if (B[r][c] < 0)
+                continue;
+
+            // search all shifts starting from a pseudo-random offset
+            state = state*1103515245u + 12345u;
+            unsigned int s0 = (state >> 8) % Z;
+            unsigned int t;
+            int shift = (int)s0;
+            for (t=0; t<Z; t++) {
+                int s = (int)((s0 + t) % Z);
+                int cycle = 0;
+                unsigned int r2, c2;
+                for (r2=0; r2<mb && !cycle; r2++) {
+                    if (r2 == r || !assigned[r2][c])
+                        continue;
+                    for (c2=0; c2<FEC_LDPC_NB_COLS && !cycle; c2++) {
+                        if (c2 == c || !assigned[r][c2] || !assigned[r2][c2])
+                            continue;
+                        int d = s - B[r2][c] - B[r][c2] + B[r2][c2];
+                        cycle = ((d % (int)Z) + (int)Z) % (int)Z == 0;
+                    }
+                }
+                if (!cycle) {
+                    shift = s;
+                    break;
+                }
+            }
+            B[r][c] = shift;
+            assigned[r][c] = 1;
+        }
+    }
+
+    // list entries by row
+    _q->num_edges = 0;
+    for (r=0; r<mb; r++)
+        _q->num_edges += weight[r];
+    _q->row_start = (unsigned int*) malloc((mb+1)*sizeof(unsigned int));
+    _q->col       = (unsigned int*) malloc(_q->num_edges*sizeof(unsigned int));
+    _q->shift     = (unsigned int*) malloc(_q->num_edges*sizeof(unsigned int));
+    _q->max_degree = 0;
+    unsigned int e = 0;
+    for (r=0; r<mb; r++) {
+        _q->row_start[r] = e;
+        for (c=0; c<FEC_LDPC_NB_COLS; c++) {
+            if (B[r][c] >= 0) {
+                _q->col[e]   = c;
+                _q->shift[e] = (unsigned int)B[r][c] % Z;
+                e++;
+            }
+        }
+        if (weight[r] > _q->max_degree)
+            _q->max_degree = weight[r];
+    }
+    _q->row_start[mb] = e;
+}
+
+// copy circulant of a posteriori values into workspace, rotated by shift
+static inline void fec_ldpc_codec_load(signed char * _t,
+                                       signed char * _l,
+                                       unsigned int  _Z,
+                                       unsigned int  _s)
+{
+    memcpy(_t,         _l + _s, (_Z - _s)*sizeof(signed char));
+    memcpy(_t + _Z-_s, _l,      _s*sizeof(signed char));
+}
+
+// copy workspace back to circulant of a posteriori values
+static inline void fec_ldpc_codec_store(signed char * _l,
+                                        signed char * _t,
+                                        unsigned int  _Z,
+                                        unsigned int  _s)
+{
+    memcpy(_l + _s, _t,         (_Z - _s)*sizeof(signed char));
+    memcpy(_l,      _t + _Z-_s, _s*sizeof(signed char));
+}
+
+// update one layer (block row), portable version
+void fec_ldpc_codec_layer_port(fec_ldpc_codec _q,
+                               unsigned int   _r)
+{
+    unsigned int Z  = _q->Z;
+    unsigned int Zp = _q->Zp;
+    unsigned int e0 = _q->row_start[_r];
+    unsigned int d  = _q->row_start[_r+1] - e0;
+    unsigned int k, z;
+    for (k=0; k<d; k++)
+        fec_ldpc_codec_load(_q->T + k*Zp, _q->L + _q->col[e0+k]*Zp, Z, _q->shift[e0+k]);
+
+    for (z=0; z<Z; z++) {
+        // remove old message, track two smallest magnitudes and signs
+        int min1 = 127, min2 = 127, sgn = 0;
+        unsigned int idx = 0;
+        for (k=0; k<d; k++) {
+            int t = (int)_q->T[k*Zp + z] - (int)_q->R[(e0+k)*Zp + z];
+            t = t < -127 ? -127 : (t > 127 ? 127 : t);
+            _q->T[k*Zp + z] = t;
+            int a = t < 0 ? -t : t;
+            sgn ^= t < 0;
+            if (a < min1) {
+                min2 = min1;
+                min1 = a;
+                idx  = k;
+            } else if (a < min2) {
+                min2 = a;
+            }
+        }
+
+        // normalize by 3/4 (rounded up)
+        min1 -= min1 >> 2;
+        min2 -= min2 >> 2;
+
+        // new message excludes the edge's own input
+        for (k=0; k<d; k++) {
+            int t = _q->T[k*Zp + z];
+            int m = k == idx ? min2 : min1;
+            int v = (sgn ^ (t < 0)) ? -m : m;
+            _q->R[(e0+k)*Zp + z] = v;
+            t += v;
+            _q->T[k*Zp + z] = t < -127 ? -127 : (t > 127 ? 127 : t);
+        }
+    }
+
+    for (k=0; k<d; k++)
+        fec_ldpc_codec_store(_q->L + _q->col[e0+k]*Zp, _q->T + k*Zp, Z, _q->shift[e0+k]);
+}
+
+#if LIQUID_SIMD_DISPATCH
+// update one layer (block row), 32 rows of each circulant at a time
+__attribute__((target("avx2")))
+void fec_ldpc_codec_layer_avx2(fec_ldpc_codec _q,
+                               unsigned int   _r)
+{
+    unsigned int Z  = _q->Z;
+    unsigned int Zp = _q->Zp;
+    unsigned int e0 = _q->row_start[_r];
+    unsigned int d  = _q->row_start[_r+1] - e0;
+    unsigned int k, z;
+    for (k=0; k<d; k++)
+        fec_ldpc_codec_load(_q->T + k*Zp, _q->L + _q->col[e0+k]*Zp, Z, _q->shift[e0+k]);
+
+    __m256i vmax  = _mm256_set1_epi8(127);
+    __m256i vmin  = _mm256_set1_epi8(-127);
+    __m256i vzero = _mm256_setzero_si256();
+    __m256i v3f   = _mm256_set1_epi8(0x3f);
+    for (z=0; z<Zp; z+=32) {
+        // remove old message, track two smallest magnitudes and signs
+        __m256i min1 = vmax, min2 = vmax, sgn = vzero, idx = vzero;
+        for (k=0; k<d; k++) {
+            __m256i * pt = (__m256i*)(_q->T + k*Zp + z);
+            __m256i * pr = (__m256i*)(_q->R + (e0+k)*Zp + z);
+            __m256i t = _mm256_max_epi8(_mm256_subs_epi8(_mm256_loadu_si256(pt), _mm256_loadu_si256(pr)), vmin);
+            _mm256_storeu_si256(pt, t);
+            __m256i a  = _mm256_abs_epi8(t);
+            __m256i lt = _mm256_cmpgt_epi8(min1, a);
+            sgn  = _mm256_xor_si256(sgn, _mm256_cmpgt_epi8(vzero, t));
+            min2 = _mm256_blendv_epi8(_mm256_min_epi8(min2, a), min1, lt);
+            min1 = _mm256_min_epi8(min1, a);
+            idx  = _mm256_blendv_epi8(idx, _mm256_set1_epi8(k), lt);
+        }
+
+        // normalize by 3/4 (rounded up)
+        min1 = _mm256_sub_epi8(min1, _mm256_and_si256(_mm256_srli_epi16(min1, 2), v3f));
+        min2 = _mm256_sub_epi8(min2, _mm256_and_si256(_mm256_srli_epi16(min2, 2), v3f));
+
+        // new message excludes the edge's own input
+        for (k=0; k<d; k++) {
+            __m256i * pt = (__m256i*)(_q->T + k*Zp + z);
+            __m256i * pr = (__m256i*)(_q->R + (e0+k)*Zp + z);
+            __m256i t = _mm256_loadu_si256(pt);
+            __m256i m = _mm256_blendv_epi8(min1, min2, _mm256_cmpeq_epi8(idx, _mm256_set1_epi8(k)));
+            __m256i neg = _mm256_xor_si256(sgn, _mm256_cmpgt_epi8(vzero, t));
+            __m256i v = _mm256_sub_epi8(_mm256_xor_si256(m, neg), neg);
+            _mm256_storeu_si256(pr, v);
+            _mm256_storeu_si256(pt, _mm256_max_epi8(_mm256_adds_epi8(t, v), vmin));
+        }
+    }
+
+    for (k=0; k<d; k++)
+        fec_ldpc_codec_store(_q->L + _q->col[e0+k]*Zp, _q->T + k*Zp, Z, _q->shift[e0+k]);
+}
+#endif
+
+// check whether hard decisions satisfy all parity checks
+int fec_ldpc_codec_check(fec_ldpc_codec _q)
+{
+    unsigned int Z  = _q->Z;
+    unsigned int Zp = _q->Zp;
+    unsigned int r, e, z;
+    for (r=0; r<_q->mb; r++) {
+        // accumulate sign bits of rotated circulants
+        signed char * x = _q->T;
+        memset(x, 0x00, Z*sizeof(signed char));
+        for (e=_q->row_start[r]; e<_q->row_start[r+1]; e++) {
+            signed char * l = _q->L + _q->col[e]*Zp;
+            unsigned int s = _q->shift[e];
+            for (z=0; z<Z-s; z++) x[z]     ^= l[z+s];
+            for (z=0; z<s;   z++) x[Z-s+z] ^= l[z];
+        }
+        for (z=0; z<Z; z++) {
+            if (x[z] < 0)
+                return 0;
+        }
+    }
+    return 1;
+}
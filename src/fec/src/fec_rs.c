@@ -33,9 +33,6 @@
 
 #define VERBOSE_FEC_RS    0
 
-#if LIBFEC_ENABLED
-#include "fec.h"
-
 fec fec_rs_create(fec_scheme _fs)
 {
     fec q = (fec) malloc(sizeof(struct fec_s));
@@ -60,25 +57,24 @@ fec fec_rs_create(fec_scheme _fs)
 
     // lengths
     q->num_dec_bytes = 0;
-    q->rs = NULL;
+
+    // create internal codec object; shortened blocks are handled by
+    // the codec directly so this does not depend on the message length
+    q->rs = fec_rs_codec_create(q->genpoly, q->fcs, q->prim, q->nroots);
 
     // allocate memory for arrays
     q->tblock   = (unsigned char*) malloc(q->nn*sizeof(unsigned char));
-    q->errlocs  = (int *) malloc(q->nn*sizeof(int));
-    q->derrlocs = (int *) malloc(q->nn*sizeof(int));
 
     return q;
 }
 
 void fec_rs_destroy(fec _q)
 {
-    // delete internal Reed-Solomon decoder object
-    free_rs_char(_q->rs);
+    // delete internal Reed-Solomon codec object
+    fec_rs_codec_destroy(_q->rs);
 
     // delete internal memory arrays
     free(_q->tblock);
-    free(_q->errlocs);
-    free(_q->derrlocs);
 
     // delete fec object
     free(_q);
@@ -108,17 +104,15 @@ void fec_rs_encode(fec _q,
         if (i == _q->num_blocks-1)
             block_size -= _q->res_block_len;
 
-        // copy sequence
-        memmove(_q->tblock, &_msg_dec[n0], block_size*sizeof(unsigned char));
-
-        // last block: we could pad end with zeros, but it's not really
-        // necessary as these bits are going to be thrown away anyway
+        // copy sequence, padding the end of the last block with zeros
+        memmove(&_msg_enc[n1], &_msg_dec[n0], block_size*sizeof(unsigned char));
+        memset(&_msg_enc[n1+block_size], 0x00, (_q->dec_block_len-block_size)*sizeof(unsigned char));
 
         // encode data, appending parity bits to end of sequence
-        encode_rs_char(_q->rs, _q->tblock, &_q->tblock[_q->dec_block_len]);
-
-        // copy result to output
-        memmove(&_msg_enc[n1], _q->tblock, _q->enc_block_len*sizeof(unsigned char));
+        fec_rs_codec_encode(_q->rs,
+                            &_msg_enc[n1],
+                            _q->dec_block_len,
+                            &_msg_enc[n1+_q->dec_block_len]);
 
         // increment counters
         n0 += block_size;
@@ -138,23 +132,17 @@ void fec_rs_decode(fec _q,
 {
     // validate input
     if (_dec_msg_len == 0) {
-        fprintf(stderr,"error: fec_rs_encode(), input lenght must be > 0\n");
+        fprintf(stderr,"error: fec_rs_decode(), input lenght must be > 0\n");
         exit(1);
     }
 
     // re-allocate resources if necessary
     fec_rs_setlength(_q, _dec_msg_len);
 
-    // set erasures, error locations to zero
-    memset(_q->errlocs,  0x00, _q->nn*sizeof(unsigned char));
-    memset(_q->derrlocs, 0x00, _q->nn*sizeof(unsigned char));
-    _q->erasures = 0;
-
     unsigned int i;
     unsigned int n0=0;
     unsigned int n1=0;
     unsigned int block_size = _q->dec_block_len;
-    //int derrors; // number of decoder errors
     for (i=0; i<_q->num_blocks; i++) {
 
         // the last block is smaller by the residual block length
@@ -164,12 +152,9 @@ void fec_rs_decode(fec _q,
         // copy sequence
         memmove(_q->tblock, &_msg_enc[n0], _q->enc_block_len*sizeof(unsigned char));
 
-        // decode block
-        //derrors = 
-        decode_rs_char(_q->rs,
-                       _q->tblock,
-                       _q->derrlocs,
-                       _q->erasures);
+        // decode block; blocks which cannot be corrected are passed
+        // through unchanged
+        fec_rs_codec_decode(_q->rs, _q->tblock, _q->dec_block_len);
 
         // copy result
         memmove(&_msg_dec[n1], _q->tblock, block_size*sizeof(unsigned char));
@@ -184,7 +169,7 @@ void fec_rs_decode(fec _q,
     assert( n1 == _q->num_dec_bytes );
 }
 
-// Set dec_msg_len, re-allocating resources as necessary.  Effectively, it
+// Set dec_msg_len, re-computing block lengths as necessary.  Effectively, it
 // divides the input message into several blocks and allows the decoder to
 // pad each block appropraitely.
 //
@@ -212,8 +197,8 @@ void fec_rs_decode(fec _q,
 // Thus, the 1024-byte input message is broken into 5 blocks, the first
 // four have a length 205, and the last block has a length 204 (which is
 // externally padded to 205, e.g. res_block_len = 1). This code adds 32
-// parity symbols, so each block is extended to 237 bytes. libfec auto-
-// matically extends the internal data to 255 bytes by padding with 18
+// parity symbols, so each block is extended to 237 bytes. The codec
+// implicitly extends the internal data to 255 bytes by padding with 18
 // symbols.  Therefore, the final output length is 237 * 5 = 1185 symbols.
 void fec_rs_setlength(fec _q,
                       unsigned int _dec_msg_len)
@@ -242,7 +227,7 @@ void fec_rs_setlength(fec _q,
     // mod(num_blocks*dec_block_len, num_dec_bytes)
     _q->res_block_len = (_q->num_blocks*_q->dec_block_len) % _q->num_dec_bytes;
 
-    // compute the internal libfec padding factor: kk - dec_block_len
+    // compute the internal padding factor: kk - dec_block_len
     _q->pad = _q->kk - _q->dec_block_len;
 
     // compute the final encoded block length: enc_block_len * num_blocks
@@ -257,18 +242,6 @@ void fec_rs_setlength(fec _q,
     printf("pad             :   %u\n", _q->pad);
     printf("enc_msg_len     :   %u\n", _q->num_enc_bytes);
 #endif
-
-    // delete old decoder if necessary
-    if (_q->rs != NULL)
-        free_rs_char(_q->rs);
-
-    // Reed-Solomon specific decoding
-    _q->rs = init_rs_char(_q->symsize,
-                          _q->genpoly,
-                          _q->fcs,
-                          _q->prim,
-                          _q->nroots,
-                          _q->pad);
 }
 
 // 
@@ -283,32 +256,3 @@ void fec_rs_init_p8(fec _q)
     _q->prim = 1;
     _q->nroots = 32;
 }
-
-#else   // LIBFEC_ENABLED
-
-fec fec_rs_create(fec_scheme _fs)
-{
-    return NULL;
-}
-
-void fec_rs_destroy(fec _q)
-{
-}
-
-void fec_rs_encode(fec _q,
-                   unsigned int _dec_msg_len,
-                   unsigned char *_msg_dec,
-                   unsigned char *_msg_enc)
-{
-}
-
-//unsigned int
-void fec_rs_decode(fec _q,
-                   unsigned int _dec_msg_len,
-                   unsigned char *_msg_enc,
-                   unsigned char *_msg_dec)
-{
-}
-
-#endif  // LIBFEC_ENABLED
-
@@ -0,0 +1,504 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Reed-Solomon codec over GF(2^8)
+//
+// Systematic encoder and decoder for Reed-Solomon codes with 8-bit
+// symbols. Code words hold the data symbols followed by the parity
+// symbols, with the first parity symbol being the coefficient of
+// x^(nroots-1) of the remainder. The conventions (field polynomial,
+// first consecutive root, primitive element) follow those of libfec
+// so the code words are interchangeable. Blocks shorter than the full
+// code length are implicitly padded with leading zeros.
+//
+// The parity of a block is linear in its data: data symbol i of a
+// k-symbol block contributes d*C[k-1-i] where C[m] = x^(nroots+m)
+// mod g(x) is a precomputed parity column. With 4-bit lookup tables
+// for the products this maps directly onto the PSHUFB instruction,
+// encoding a full block of 32 parity symbols with one 256-bit
+// accumulator (AVX2, selected at run time). The decoder re-encodes
+// the data and only computes syndromes (from the parity difference)
+// and runs the Berlekamp-Massey, Chien search and Forney algorithms
+// when the received parity does not match.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+#if LIQUID_SIMD_DISPATCH
+#include <immintrin.h>  // AVX2 (selected at run time)
+#endif
+
+#define FEC_RS_CODEC_NN     (255)   // code length, 2^8 - 1
+#define FEC_RS_CODEC_A0     (255)   // index form of zero, log(0)
+
+// internal methods
+void fec_rs_codec_encode_port(fec_rs_codec    _q,
+                              unsigned char * _data,
+                              unsigned int    _k,
+                              unsigned char * _parity);
+#if LIQUID_SIMD_DISPATCH
+void fec_rs_codec_encode_avx2(fec_rs_codec    _q,
+                              unsigned char * _data,
+                              unsigned int    _k,
+                              unsigned char * _parity);
+#endif
+
+struct fec_rs_codec_s {
+    unsigned int nroots;        // number of parity symbols
+    unsigned int kk;            // maximum number of data symbols
+    unsigned int fcr;           // first consecutive root (index)
+    unsigned int prim;          // primitive element (index)
+    unsigned int iprim;         // prim-th root of 1 (index)
+
+    unsigned char alpha_to[256];// antilog table: index -> polynomial
+    unsigned char index_of[256];// log table: polynomial -> index
+    unsigned char * genpoly;    // code generator (index form) [nroots+1]
+    unsigned char * G;          // feedback products f*g [256 x nroots]
+    unsigned char * T;          // nibble products [256 x 32]
+    unsigned char * M;          // nibble parity columns [kk x 64]
+    unsigned char * r;          // parity difference buffer [nroots]
+
+    // encoder kernel
+    void (*encode_func)(fec_rs_codec, unsigned char *, unsigned int, unsigned char *);
+};
+
+// reduce index modulo 255 without division
+static inline unsigned int fec_rs_codec_modnn(unsigned int _x)
+{
+    while (_x >= FEC_RS_CODEC_NN) {
+        _x -= FEC_RS_CODEC_NN;
+        _x = (_x >> 8) + (_x & FEC_RS_CODEC_NN);
+    }
+    return _x;
+}
+
+// multiply two field elements (polynomial form)
+static inline unsigned char fec_rs_codec_mul(fec_rs_codec  _q,
+                                             unsigned char _a,
+                                             unsigned char _b)
+{
+    if (_a == 0 || _b == 0)
+        return 0;
+    return _q->alpha_to[fec_rs_codec_modnn(_q->index_of[_a] + _q->index_of[_b])];
+}
+
+// create Reed-Solomon codec object
+//  _gfpoly     :   field generator polynomial (degree 8), e.g. 0x11d
+//  _fcr        :   first consecutive root of the code generator (index)
+//  _prim       :   primitive element used to generate roots (index)
+//  _nroots     :   number of parity symbols, 0 < _nroots < 255
+fec_rs_codec fec_rs_codec_create(unsigned int _gfpoly,
+                                 unsigned int _fcr,
+                                 unsigned int _prim,
+                                 unsigned int _nroots)
+{
+    // validate input
+    if (_gfpoly < 0x100 || _gfpoly > 0x1ff) {
+        fprintf(stderr,"error: fec_rs_codec_create(), field polynomial must have degree 8\n");
+        exit(1);
+    } else if (_fcr >= FEC_RS_CODEC_NN) {
+        fprintf(stderr,"error: fec_rs_codec_create(), first consecutive root must be less than 255\n");
+        exit(1);
+    } else if (_prim == 0 || _prim >= FEC_RS_CODEC_NN) {
+        fprintf(stderr,"error: fec_rs_codec_create(), primitive element must be in [1,254]\n");
+        exit(1);
+    } else if (_nroots == 0 || _nroots >= FEC_RS_CODEC_NN) {
+        fprintf(stderr,"error: fec_rs_codec_create(), number of roots must be in [1,254]\n");
+        exit(1);
+    }
+
+    fec_rs_codec q = (fec_rs_codec) malloc(sizeof(struct fec_rs_codec_s));
+    q->nroots = _nroots;
+    q->kk     = FEC_RS_CODEC_NN - _nroots;
+    q->fcr    = _fcr;
+    q->prim   = _prim;
+
+    // generate log/antilog tables
+    unsigned int i, j;
+    unsigned int sr = 1;
+    q->index_of[0]                = FEC_RS_CODEC_A0;
+    q->alpha_to[FEC_RS_CODEC_A0]  = 0;
+    for (i=0; i<FEC_RS_CODEC_NN; i++) {
+        q->index_of[sr] = i;
+        q->alpha_to[i]  = sr;
+        sr <<= 1;
+        if (sr & 0x100)
+            sr ^= _gfpoly;
+    }
+    if (sr != 1) {
+        fprintf(stderr,"error: fec_rs_codec_create(), field polynomial 0x%x is not primitive\n", _gfpoly);
+        exit(1);
+    }
+
+    // find prim-th root of 1, used in decoding
+    unsigned int iprim;
+    for (iprim=1; (iprim % _prim) != 0; iprim += FEC_RS_CODEC_NN)
+        ;
+    q->iprim = iprim / _prim;
+
+    // form code generator polynomial from its roots
+    q->genpoly = (unsigned char*) malloc((_nroots+1)*sizeof(unsigned char));
+    unsigned char * g = q->genpoly;
+    unsigned int root;
+    g[0] = 1;
+    for (i=0, root=_fcr*_prim; i<_nroots; i++, root += _prim) {
+        g[i+1] = 1;
+        // multiply g[] by (x + alpha^root)
+        for (j=i; j>0; j--) {
+            if (g[j] != 0)
+                g[j] = g[j-1] ^ q->alpha_to[fec_rs_codec_modnn(q->index_of[g[j]] + root)];
+            else
+                g[j] = g[j-1];
+        }
+        g[0] = q->alpha_to[fec_rs_codec_modnn(q->index_of[g[0]] + root)];
+    }
+
+    // feedback products: G[f][j] = f * g[nroots-1-j]
+    q->G = (unsigned char*) malloc(256*_nroots*sizeof(unsigned char));
+    for (i=0; i<256; i++) {
+        for (j=0; j<_nroots; j++)
+            q->G[i*_nroots + j] = fec_rs_codec_mul(q, i, g[_nroots-1-j]);
+    }
+
+    // convert generator to index form for quicker decoding
+    for (i=0; i<=_nroots; i++)
+        g[i] = q->index_of[g[i]];
+
+    q->r = (unsigned char*) malloc(_nroots*sizeof(unsigned char));
+
+    // select encoder kernel
+    q->T = NULL;
+    q->M = NULL;
+    q->encode_func = fec_rs_codec_encode_port;
+#if LIQUID_SIMD_DISPATCH
+    if (_nroots <= 32 && liquid_simd_get_level() >= LIQUID_SIMD_AVX2) {
+        // nibble products: T[d][n] = d*n, T[d][16+n] = d*(n<<4)
+        q->T = (unsigned char*) malloc(256*32*sizeof(unsigned char));
+        for (i=0; i<256; i++) {
+            for (j=0; j<16; j++) {
+                q->T[32*i +      j] = fec_rs_codec_mul(q, i, j);
+                q->T[32*i + 16 + j] = fec_rs_codec_mul(q, i, j << 4);
+            }
+        }
+
+        // parity columns C[m] = x^(nroots+m) mod g(x), i.e. the parity of
+        // a one followed by m zeros, split into low and high nibbles
+        q->M = (unsigned char*) calloc(q->kk*64, sizeof(unsigned char));
+        unsigned char c[32];
+        memset(c, 0x00, sizeof(c));
+        unsigned int m;
+        for (m=0; m<q->kk; m++) {
+            // shift register with input symbol (1 for m=0, 0 otherwise)
+            unsigned char f = (m == 0 ? 1 : 0) ^ c[0];
+            for (j=0; j<_nroots; j++)
+                c[j] = (j+1 < _nroots ? c[j+1] : 0) ^ q->G[f*_nroots + j];
+
+            for (j=0; j<_nroots; j++) {
+                q->M[64*m +      j] = c[j] & 0x0f;
+                q->M[64*m + 32 + j] = c[j] >> 4;
+            }
+        }
+        q->encode_func = fec_rs_codec_encode_avx2;
+    }
+#endif
+
+    return q;
+}
+
+void fec_rs_codec_destroy(fec_rs_codec _q)
+{
+    free(_q->genpoly);
+    free(_q->G);
+    free(_q->T);
+    free(_q->M);
+    free(_q->r);
+    free(_q);
+}
+
+// compute _nroots parity symbols for _k data symbols (_k <= 255-_nroots);
+// shorter blocks are implicitly padded with leading zeros
+void fec_rs_codec_encode(fec_rs_codec    _q,
+                         unsigned char * _data,
+                         unsigned int    _k,
+                         unsigned char * _parity)
+{
+    if (_k == 0 || _k > _q->kk) {
+        fprintf(stderr,"error: fec_rs_codec_encode(), block length must be in [1,%u]\n", _q->kk);
+        exit(1);
+    }
+    _q->encode_func(_q, _data, _k, _parity);
+}
+
+// correct block of _k data symbols followed by _nroots parity symbols
+// in place, returning the number of corrected symbols or -1 if the block
+// could not be decoded (block is left unchanged)
+int fec_rs_codec_decode(fec_rs_codec    _q,
+                        unsigned char * _block,
+                        unsigned int    _k)
+{
+    if (_k == 0 || _k > _q->kk) {
+        fprintf(stderr,"error: fec_rs_codec_decode(), block length must be in [1,%u]\n", _q->kk);
+        exit(1);
+    }
+
+    // re-encode data; the difference to the received parity is the
+    // remainder of the received code word, zero for a valid block
+    unsigned int nroots = _q->nroots;
+    unsigned char * r = _q->r;
+    _q->encode_func(_q, _block, _k, r);
+    unsigned int i, j;
+    unsigned char rsum = 0;
+    for (i=0; i<nroots; i++) {
+        r[i] ^= _block[_k + i];
+        rsum |= r[i];
+    }
+    if (rsum == 0)
+        return 0;
+
+    const unsigned char * alpha_to = _q->alpha_to;
+    const unsigned char * index_of = _q->index_of;
+    unsigned int A0  = FEC_RS_CODEC_A0;
+    unsigned int pad = FEC_RS_CODEC_NN - nroots - _k;
+
+    // compute syndromes (index form) by evaluating the remainder at the
+    // roots of the code generator: r[0] is coefficient of x^(nroots-1)
+    unsigned int s[nroots];
+    for (j=0; j<nroots; j++) {
+        unsigned int root = fec_rs_codec_modnn((_q->fcr + j)*_q->prim);
+        unsigned int v = 0;
+        for (i=0; i<nroots; i++) {
+            if (v != 0)
+                v = alpha_to[fec_rs_codec_modnn(index_of[v] + root)];
+            v ^= r[i];
+        }
+        s[j] = index_of[v];
+    }
+
+    // Berlekamp-Massey: find error locator polynomial lambda
+    unsigned int lambda[nroots+1];  // error locator (polynomial form)
+    unsigned int b[nroots+1];       // shifted locator (index form)
+    unsigned int t[nroots+1];       // temporary locator
+    unsigned int el = 0;            // current locator degree
+    unsigned int k, rr;
+    memset(lambda, 0x00, (nroots+1)*sizeof(unsigned int));
+    lambda[0] = 1;
+    for (i=0; i<=nroots; i++)
+        b[i] = index_of[lambda[i]];
+
+    for (rr=1; rr<=nroots; rr++) {
+        // compute discrepancy at step rr
+        unsigned int discr = 0;
+        for (i=0; i<rr; i++) {
+            if (lambda[i] != 0 && s[rr-i-1] != A0)
+                discr ^= alpha_to[fec_rs_codec_modnn(index_of[lambda[i]] + s[rr-i-1])];
+        }
+        discr = index_of[discr];
+
+        if (discr == A0) {
+            // B(x) <- x*B(x)
+            memmove(&b[1], b, nroots*sizeof(unsigned int));
+            b[0] = A0;
+        } else {
+            // T(x) <- lambda(x) - discr*x*B(x)
+            t[0] = lambda[0];
+            for (i=0; i<nroots; i++) {
+                if (b[i] != A0)
+                    t[i+1] = lambda[i+1] ^ alpha_to[fec_rs_codec_modnn(discr + b[i])];
+                else
+                    t[i+1] = lambda[i+1];
+            }
+            if (2*el <= rr-1) {
+                // B(x) <- inv(discr)*lambda(x)
+                el = rr - el;
+                for (i=0; i<=nroots; i++) {
+                    b[i] = (lambda[i] == 0) ? A0 :
+                        fec_rs_codec_modnn(index_of[lambda[i]] - discr + FEC_RS_CODEC_NN);
+                }
+            } else {
+                // B(x) <- x*B(x)
+                memmove(&b[1], b, nroots*sizeof(unsigned int));
+                b[0] = A0;
+            }
+            memmove(lambda, t, (nroots+1)*sizeof(unsigned int));
+        }
+    }
+
+    // convert lambda to index form and compute its degree
+    unsigned int deg_lambda = 0;
+    for (i=0; i<=nroots; i++) {
+        lambda[i] = index_of[lambda[i]];
+        if (lambda[i] != A0)
+            deg_lambda = i;
+    }
+    if (deg_lambda == 0)
+        return -1;
+
+    // Chien search: find roots of the error locator polynomial
+    unsigned int reg[nroots+1];
+    unsigned int root[nroots];      // roots (index form)
+    unsigned int loc[nroots];       // error locations within code word
+    unsigned int count = 0;
+    memmove(&reg[1], &lambda[1], nroots*sizeof(unsigned int));
+    for (i=1, k=_q->iprim-1; i<=FEC_RS_CODEC_NN; i++, k=fec_rs_codec_modnn(k+_q->iprim)) {
+        unsigned int v = 1;
+        for (j=deg_lambda; j>0; j--) {
+            if (reg[j] != A0) {
+                reg[j] = fec_rs_codec_modnn(reg[j] + j);
+                v ^= alpha_to[reg[j]];
+            }
+        }
+        if (v != 0)
+            continue;
+
+        // errors within the (implicit) zero padding cannot be corrected
+        if (k < pad)
+            return -1;
+
+        root[count] = i;
+        loc[count]  = k;
+        if (++count == deg_lambda)
+            break;
+    }
+
+    // number of roots must equal degree of lambda
+    if (count != deg_lambda)
+        return -1;
+
+    // error evaluator omega(x) = s(x)*lambda(x) mod x^nroots (index form)
+    unsigned int deg_omega = deg_lambda - 1;
+    unsigned int omega[nroots];
+    for (i=0; i<=deg_omega; i++) {
+        unsigned int v = 0;
+        for (j=0; j<=i; j++) {
+            if (s[i-j] != A0 && lambda[j] != A0)
+                v ^= alpha_to[fec_rs_codec_modnn(s[i-j] + lambda[j])];
+        }
+        omega[i] = index_of[v];
+    }
+
+    // Forney: compute error values
+    //  num1 = omega(inv(X(l))), num2 = inv(X(l))^(fcr-1)
+    //  den  = lambda_pr(inv(X(l)))
+    unsigned char e[nroots];
+    for (j=0; j<count; j++) {
+        unsigned int num1 = 0;
+        for (i=0; i<=deg_omega; i++) {
+            if (omega[i] != A0)
+                num1 ^= alpha_to[fec_rs_codec_modnn(omega[i] + i*root[j])];
+        }
+        unsigned int num2 = alpha_to[fec_rs_codec_modnn(root[j]*(_q->fcr + FEC_RS_CODEC_NN - 1) + FEC_RS_CODEC_NN)];
+
+        // lambda[i+1] for even i is the formal derivative of lambda
+        unsigned int den = 0;
+        int ii;
+        for (ii = (deg_lambda < nroots-1 ? deg_lambda : nroots-1) & ~1; ii >= 0; ii -= 2) {
+            if (lambda[ii+1] != A0)
+                den ^= alpha_to[fec_rs_codec_modnn(lambda[ii+1] + ii*root[j])];
+        }
+        if (den == 0)
+            return -1;
+
+        e[j] = (num1 == 0) ? 0 :
+            alpha_to[fec_rs_codec_modnn(index_of[num1] + index_of[num2] +
+                                        FEC_RS_CODEC_NN - index_of[den])];
+    }
+
+    // apply corrections
+    for (j=0; j<count; j++)
+        _block[loc[j] - pad] ^= e[j];
+
+    return count;
+}
+
+//
+// internal methods
+//
+
+// portable encoder: shift register with feedback product table
+void fec_rs_codec_encode_port(fec_rs_codec    _q,
+                              unsigned char * _data,
+                              unsigned int    _k,
+                              unsigned char * _parity)
+{
+    unsigned int nroots = _q->nroots;
+    unsigned int i, j;
+    memset(_parity, 0x00, nroots*sizeof(unsigned char));
+    for (i=0; i<_k; i++) {
+        const unsigned char * gf = &_q->G[(_data[i] ^ _parity[0])*nroots];
+        for (j=0; j<nroots-1; j++)
+            _parity[j] = _parity[j+1] ^ gf[j];
+        _parity[nroots-1] = gf[nroots-1];
+    }
+}
+
+#if LIQUID_SIMD_DISPATCH
+// accumulate d*C[m] for a single data symbol using 4-bit products
+__attribute__((target("avx2"), always_inline))
+static inline __m256i fec_rs_codec_col_avx2(fec_rs_codec          _q,
+                                            unsigned char         _d,
+                                            const unsigned char * _m)
+{
+    const unsigned char * t = &_q->T[32*_d];
+    __m256i tlo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(t)));
+    __m256i thi = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(t+16)));
+    __m256i mlo = _mm256_loadu_si256((const __m256i*)(_m));
+    __m256i mhi = _mm256_loadu_si256((const __m256i*)(_m+32));
+    return _mm256_xor_si256(_mm256_shuffle_epi8(tlo, mlo),
+                            _mm256_shuffle_epi8(thi, mhi));
+}
+
+// AVX2 encoder: sum of parity columns (nroots <= 32)
+__attribute__((target("avx2")))
+void fec_rs_codec_encode_avx2(fec_rs_codec    _q,
+                              unsigned char * _data,
+                              unsigned int    _k,
+                              unsigned char * _parity)
+{
+    // data symbol i contributes parity column m = k-1-i
+    const unsigned char * M = _q->M;
+    __m256i acc0 = _mm256_setzero_si256();
+    __m256i acc1 = _mm256_setzero_si256();
+    __m256i acc2 = _mm256_setzero_si256();
+    __m256i acc3 = _mm256_setzero_si256();
+    unsigned int i = 0;
+    unsigned int m = _k;
+    for (; i+4<=_k; i+=4, m-=4) {
+        acc0 = _mm256_xor_si256(acc0, fec_rs_codec_col_avx2(_q, _data[i  ], &M[64*(m-1)]));
+        acc1 = _mm256_xor_si256(acc1, fec_rs_codec_col_avx2(_q, _data[i+1], &M[64*(m-2)]));
+        acc2 = _mm256_xor_si256(acc2, fec_rs_codec_col_avx2(_q, _data[i+2], &M[64*(m-3)]));
+        acc3 = _mm256_xor_si256(acc3, fec_rs_codec_col_avx2(_q, _data[i+3], &M[64*(m-4)]));
+    }
+    for (; i<_k; i++, m--)
+        acc0 = _mm256_xor_si256(acc0, fec_rs_codec_col_avx2(_q, _data[i], &M[64*(m-1)]));
+    acc0 = _mm256_xor_si256(_mm256_xor_si256(acc0, acc1),
+                            _mm256_xor_si256(acc2, acc3));
+
+    unsigned char p[32];
+    _mm256_storeu_si256((__m256i*)p, acc0);
+    memmove(_parity, p, _q->nroots*sizeof(unsigned char));
+}
+#endif
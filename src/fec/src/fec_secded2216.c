@@ -64,41 +64,16 @@ unsigned char secded2216_syndrome_w1[22] = {
 // compute parity on 16-bit input
 unsigned char fec_secded2216_compute_parity(unsigned char * _m)
 {
-    // compute encoded/transmitted message: v = m*G
-    unsigned char parity = 0x00;
-
-    // TODO : unwrap this loop
-    unsigned int i;
-    for (i=0; i<6; i++) {
-        parity <<= 1;
-
-        unsigned int p = liquid_c_ones[ secded2216_P[2*i+0] & _m[0] ] +
-                         liquid_c_ones[ secded2216_P[2*i+1] & _m[1] ];
-
-        parity |= p & 0x01;
-    }
-
-    return parity;
+    // sum parity contribution of each input byte
+    return secded2216_parity_gentab[0][_m[0]] ^
+           secded2216_parity_gentab[1][_m[1]];
 }
 
 // compute syndrome on 22-bit input
 unsigned char fec_secded2216_compute_syndrome(unsigned char * _v)
 {
-    // TODO : unwrap this loop
-    unsigned int i;
-    unsigned char syndrome = 0x00;
-    for (i=0; i<6; i++) {
-        syndrome <<= 1;
-
-        unsigned int p =
-            ( (_v[0] & (1<<(6-i-1))) ? 1 : 0 )+
-            liquid_c_ones[ secded2216_P[2*i+0] & _v[1] ] +
-            liquid_c_ones[ secded2216_P[2*i+1] & _v[2] ];
-
-        syndrome |= p & 0x01;
-    }
-
-    return syndrome;
+    // received parity bits plus parity computed on received message
+    return (_v[0] & 0x3f) ^ fec_secded2216_compute_parity(&_v[1]);
 }
 
 // encode symbol
@@ -173,19 +148,14 @@ int fec_secded2216_estimate_ehat(unsigned char * _sym_enc,
         // no errors detected
         return 0;
     } else {
-        // estimate error location; search for syndrome with error
-        // vector of weight one
-
-        unsigned int n;
-        // estimate error location
-        for (n=0; n<22; n++) {
-            if (s == secded2216_syndrome_w1[n]) {
-                // single error detected at location 'n'
-                div_t d = div(n,8);
-                _e_hat[3-d.quot-1] = 1 << d.rem;
-
-                return 1;
-            }
+        // estimate error location from syndrome of error vector
+        // with weight one
+        unsigned int n = secded2216_ehat_gentab[s];
+        if (n != 0xff) {
+            // single error detected at location 'n'
+            _e_hat[3-(n>>3)-1] = 1 << (n & 7);
+
+            return 1;
         }
 
     }
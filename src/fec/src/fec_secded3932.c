@@ -71,45 +71,18 @@ unsigned char secded3932_syndrome_w1[39] = {
 // compute parity on 32-bit input
 unsigned char fec_secded3932_compute_parity(unsigned char * _m)
 {
-    // compute encoded/transmitted message: v = m*G
-    unsigned char parity = 0x00;
-
-    // TODO : unwrap this loop
-    unsigned int i;
-    for (i=0; i<7; i++) {
-        parity <<= 1;
-
-        unsigned int p = liquid_c_ones[ secded3932_P[4*i+0] & _m[0] ] +
-                         liquid_c_ones[ secded3932_P[4*i+1] & _m[1] ] +
-                         liquid_c_ones[ secded3932_P[4*i+2] & _m[2] ] +
-                         liquid_c_ones[ secded3932_P[4*i+3] & _m[3] ];
-
-        parity |= p & 0x01;
-    }
-
-    return parity;
+    // sum parity contribution of each input byte
+    return secded3932_parity_gentab[0][_m[0]] ^
+           secded3932_parity_gentab[1][_m[1]] ^
+           secded3932_parity_gentab[2][_m[2]] ^
+           secded3932_parity_gentab[3][_m[3]];
 }
 
 // compute syndrome on 39-bit input
 unsigned char fec_secded3932_compute_syndrome(unsigned char * _v)
 {
-    // TODO : unwrap this loop
-    unsigned int i;
-    unsigned char syndrome = 0x00;
-    for (i=0; i<7; i++) {
-        syndrome <<= 1;
-
-        unsigned int p =
-            ( (_v[0] & (1<<(7-i-1))) ? 1 : 0 )+
-            liquid_c_ones[ secded3932_P[4*i+0] & _v[1] ] +
-            liquid_c_ones[ secded3932_P[4*i+1] & _v[2] ] +
-            liquid_c_ones[ secded3932_P[4*i+2] & _v[3] ] +
-            liquid_c_ones[ secded3932_P[4*i+3] & _v[4] ];
-
-        syndrome |= p & 0x01;
-    }
-
-    return syndrome;
+    // received parity bits plus parity computed on received message
+    return (_v[0] & 0x7f) ^ fec_secded3932_compute_parity(&_v[1]);
 }
 
 // encode symbol
@@ -189,19 +162,14 @@ int fec_secded3932_estimate_ehat(unsigned char * _sym_enc,
         // no errors detected
         return 0;
     } else {
-        // estimate error location; search for syndrome with error
-        // vector of weight one
-
-        unsigned int n;
-        // estimate error location
-        for (n=0; n<39; n++) {
-            if (s == secded3932_syndrome_w1[n]) {
-                // single error detected at location 'n'
-                div_t d = div(n,8);
-                _e_hat[5-d.quot-1] = 1 << d.rem;
-
-                return 1;
-            }
+        // estimate error location from syndrome of error vector
+        // with weight one
+        unsigned int n = secded3932_ehat_gentab[s];
+        if (n != 0xff) {
+            // single error detected at location 'n'
+            _e_hat[5-(n>>3)-1] = 1 << (n & 7);
+
+            return 1;
         }
 
     }
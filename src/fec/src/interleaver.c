@@ -33,36 +33,61 @@
 
 #include "liquid.internal.h"
 
+#if LIQUID_SIMD_DISPATCH
+#include <immintrin.h>  // AVX2 (selected at run time)
+#endif
+
+// number of output bytes per tile when interleaving blocks of packets
+#define INTERLEAVER_TILE (256)
+
 // 
 // internal methods
 //
 
-// permute one iteration
-void interleaver_permute(unsigned char * _x,
-                         unsigned int    _n,
-                         unsigned int    _M,
-                         unsigned int    _N);
-
-// permute one iteration (soft bit input)
-void interleaver_permute_soft(unsigned char * _x,
-                              unsigned int    _n,
-                              unsigned int    _M,
-                              unsigned int    _N);
-
-// permute one iteration with mask
-void interleaver_permute_mask(unsigned char * _x,
-                              unsigned int    _n,
-                              unsigned int    _M,
-                              unsigned int    _N,
-                              unsigned char   _mask);
-
-// permute one iteration (soft bit input) with mask
-void interleaver_permute_mask_soft(unsigned char * _x,
-                                   unsigned int    _n,
-                                   unsigned int    _M,
-                                   unsigned int    _N,
-                                   unsigned char   _mask);
-
+// compile permutation passes into gather tables
+void interleaver_compile(interleaver _q);
+
+// compute index walk of one permutation pass
+//  _n      :   number of bytes
+//  _M      :   row dimension
+//  _N      :   col dimension
+//  _j      :   odd-byte partner of each even byte [size: _n/2 x 1]
+void interleaver_walk(unsigned int   _n,
+                      unsigned int   _M,
+                      unsigned int   _N,
+                      unsigned int * _j);
+
+// gather bytes [_i0,_i1) through tables _p
+void interleaver_gather(interleaver     _q,
+                        unsigned int *  _p,
+                        unsigned char * _x,
+                        unsigned char * _y,
+                        unsigned int    _i0,
+                        unsigned int    _i1);
+
+// gather soft bits of bytes [_i0,_i1) through tables _p
+void interleaver_gather_soft_port(interleaver     _q,
+                                  unsigned int *  _p,
+                                  unsigned char * _x,
+                                  unsigned char * _y,
+                                  unsigned int    _i0,
+                                  unsigned int    _i1);
+#if LIQUID_SIMD_DISPATCH
+void interleaver_gather_soft_avx2(interleaver     _q,
+                                  unsigned int *  _p,
+                                  unsigned char * _x,
+                                  unsigned char * _y,
+                                  unsigned int    _i0,
+                                  unsigned int    _i1);
+#endif
+
+// interleave a block of packets through tables _p
+void interleaver_execute_block(interleaver     _q,
+                               unsigned int *  _p,
+                               unsigned char * _x,
+                               unsigned char * _y,
+                               unsigned int    _num_packets,
+                               int             _soft);
 
 // structured interleaver object
 struct interleaver_s {
@@ -73,6 +98,19 @@ struct interleaver_s {
 
     // interleaving depth (number of permutations)
     unsigned int depth;
+
+    // bits moved by the same passes share a byte permutation (class);
+    // tables hold the gather index of each class for the encoder,
+    // followed by the decoder [size: 2*num_classes*n x 1]
+    unsigned int    num_classes;
+    unsigned char   mask[8];        // bits of each class
+    uint64_t        mask_soft[8];   // soft bits of each class
+    unsigned int *  p;              // gather tables
+    unsigned char * buf;            // buffer for in-place operation
+
+    // soft-bit gather kernel
+    void (*gather_soft)(interleaver, unsigned int *, unsigned char *,
+                        unsigned char *, unsigned int, unsigned int);
 };
 
 // create interleaver of length _n input/output bytes
@@ -90,12 +128,28 @@ interleaver interleaver_create(unsigned int _n)
     q->N = q->n / q->M;
     while (q->n >= (q->M*q->N)) q->N++;  // ensures M*N >= n
 
+    // select soft-bit gather kernel
+    q->gather_soft = interleaver_gather_soft_port;
+#if LIQUID_SIMD_DISPATCH
+    if (liquid_simd_get_level() >= LIQUID_SIMD_AVX2)
+        q->gather_soft = interleaver_gather_soft_avx2;
+#endif
+
+    // compile tables
+    q->p   = NULL;
+    q->buf = (unsigned char*) malloc((8*q->n+1)*sizeof(unsigned char));
+    interleaver_compile(q);
+
     return q;
 }
 
 // destroy interleaver object
 void interleaver_destroy(interleaver _q)
 {
+    // free tables and buffer
+    free(_q->p);
+    free(_q->buf);
+
     // free main object memory
     free(_q);
 }
@@ -114,6 +168,9 @@ void interleaver_set_depth(interleaver  _q,
                            unsigned int _depth)
 {
     _q->depth = _depth;
+
+    // re-compile tables
+    interleaver_compile(_q);
 }
 
 // execute forward interleaver (encoder)
@@ -124,13 +181,10 @@ void interleaver_encode(interleaver _q,
                         unsigned char * _msg_dec,
                         unsigned char * _msg_enc)
 {
-    // copy data to output
-    memmove(_msg_enc, _msg_dec, _q->n);
-
-    if (_q->depth > 0) interleaver_permute(_msg_enc, _q->n, _q->M, _q->N);
-    if (_q->depth > 1) interleaver_permute_mask(_msg_enc, _q->n, _q->M, _q->N+2, 0x0f);
-    if (_q->depth > 2) interleaver_permute_mask(_msg_enc, _q->n, _q->M, _q->N+4, 0x55);
-    if (_q->depth > 3) interleaver_permute_mask(_msg_enc, _q->n, _q->M, _q->N+8, 0x33);
+    unsigned char * y = (_msg_enc == _msg_dec) ? _q->buf : _msg_enc;
+    interleaver_gather(_q, _q->p, _msg_dec, y, 0, _q->n);
+    if (y != _msg_enc)
+        memmove(_msg_enc, y, _q->n);
 }
 
 // execute forward interleaver (encoder) on soft bits
@@ -141,13 +195,10 @@ void interleaver_encode_soft(interleaver _q,
                              unsigned char * _msg_dec,
                              unsigned char * _msg_enc)
 {
-    // copy data to output
-    memmove(_msg_enc, _msg_dec, 8*_q->n);
-
-    if (_q->depth > 0) interleaver_permute_soft(_msg_enc, _q->n, _q->M, _q->N);
-    if (_q->depth > 1) interleaver_permute_mask_soft(_msg_enc, _q->n, _q->M, _q->N+2, 0x0f);
-    if (_q->depth > 2) interleaver_permute_mask_soft(_msg_enc, _q->n, _q->M, _q->N+4, 0x55);
-    if (_q->depth > 3) interleaver_permute_mask_soft(_msg_enc, _q->n, _q->M, _q->N+8, 0x33);
+    unsigned char * y = (_msg_enc == _msg_dec) ? _q->buf : _msg_enc;
+    _q->gather_soft(_q, _q->p, _msg_dec, y, 0, _q->n);
+    if (y != _msg_enc)
+        memmove(_msg_enc, y, 8*_q->n);
 }
 
 // execute reverse interleaver (decoder)
@@ -158,13 +209,10 @@ void interleaver_decode(interleaver _q,
                         unsigned char * _msg_enc,
                         unsigned char * _msg_dec)
 {
-    // copy data to output
-    memmove(_msg_dec, _msg_enc, _q->n);
-
-    if (_q->depth > 3) interleaver_permute_mask(_msg_dec, _q->n, _q->M, _q->N+8, 0x33);
-    if (_q->depth > 2) interleaver_permute_mask(_msg_dec, _q->n, _q->M, _q->N+4, 0x55);
-    if (_q->depth > 1) interleaver_permute_mask(_msg_dec, _q->n, _q->M, _q->N+2, 0x0f);
-    if (_q->depth > 0) interleaver_permute(_msg_dec, _q->n, _q->M, _q->N);
+    unsigned char * y = (_msg_dec == _msg_enc) ? _q->buf : _msg_dec;
+    interleaver_gather(_q, _q->p + _q->num_classes*_q->n, _msg_enc, y, 0, _q->n);
+    if (y != _msg_dec)
+        memmove(_msg_dec, y, _q->n);
 }
 
 // execute reverse interleaver (decoder) on soft bits
@@ -175,63 +223,155 @@ void interleaver_decode_soft(interleaver _q,
                              unsigned char * _msg_enc,
                              unsigned char * _msg_dec)
 {
-    // copy data to output
-    memmove(_msg_dec, _msg_enc, 8*_q->n);
+    unsigned char * y = (_msg_dec == _msg_enc) ? _q->buf : _msg_dec;
+    _q->gather_soft(_q, _q->p + _q->num_classes*_q->n, _msg_enc, y, 0, _q->n);
+    if (y != _msg_dec)
+        memmove(_msg_dec, y, 8*_q->n);
+}
+
+// execute forward interleaver (encoder) on a block of packets
+//  _q          :   interleaver object
+//  _msg_dec    :   decoded messages [size: _num_packets*n x 1]
+//  _msg_enc    :   encoded messages [size: _num_packets*n x 1]
+//  _num_packets:   number of packets
+void interleaver_encode_block(interleaver     _q,
+                              unsigned char * _msg_dec,
+                              unsigned char * _msg_enc,
+                              unsigned int    _num_packets)
+{
+    interleaver_execute_block(_q, _q->p, _msg_dec, _msg_enc, _num_packets, 0);
+}
+
+// execute forward interleaver (encoder) on soft bits of a block of packets
+//  _q          :   interleaver object
+//  _msg_dec    :   decoded messages [size: 8*_num_packets*n x 1]
+//  _msg_enc    :   encoded messages [size: 8*_num_packets*n x 1]
+//  _num_packets:   number of packets
+void interleaver_encode_soft_block(interleaver     _q,
+                                   unsigned char * _msg_dec,
+                                   unsigned char * _msg_enc,
+                                   unsigned int    _num_packets)
+{
+    interleaver_execute_block(_q, _q->p, _msg_dec, _msg_enc, _num_packets, 1);
+}
+
+// execute reverse interleaver (decoder) on a block of packets
+//  _q          :   interleaver object
+//  _msg_enc    :   encoded messages [size: _num_packets*n x 1]
+//  _msg_dec    :   decoded messages [size: _num_packets*n x 1]
+//  _num_packets:   number of packets
+void interleaver_decode_block(interleaver     _q,
+                              unsigned char * _msg_enc,
+                              unsigned char * _msg_dec,
+                              unsigned int    _num_packets)
+{
+    interleaver_execute_block(_q, _q->p + _q->num_classes*_q->n,
+                              _msg_enc, _msg_dec, _num_packets, 0);
+}
 
-    if (_q->depth > 3) interleaver_permute_mask_soft(_msg_dec, _q->n, _q->M, _q->N+8, 0x33);
-    if (_q->depth > 2) interleaver_permute_mask_soft(_msg_dec, _q->n, _q->M, _q->N+4, 0x55);
-    if (_q->depth > 1) interleaver_permute_mask_soft(_msg_dec, _q->n, _q->M, _q->N+2, 0x0f);
-    if (_q->depth > 0) interleaver_permute_soft(_msg_dec, _q->n, _q->M, _q->N);
+// execute reverse interleaver (decoder) on soft bits of a block of packets
+//  _q          :   interleaver object
+//  _msg_enc    :   encoded messages [size: 8*_num_packets*n x 1]
+//  _msg_dec    :   decoded messages [size: 8*_num_packets*n x 1]
+//  _num_packets:   number of packets
+void interleaver_decode_soft_block(interleaver     _q,
+                                   unsigned char * _msg_enc,
+                                   unsigned char * _msg_dec,
+                                   unsigned int    _num_packets)
+{
+    interleaver_execute_block(_q, _q->p + _q->num_classes*_q->n,
+                              _msg_enc, _msg_dec, _num_packets, 1);
 }
 
 // 
-// internal permutation methods
+// internal methods
 //
 
-// permute one iteration
-void interleaver_permute(unsigned char * _x,
-                         unsigned int    _n,
-                         unsigned int    _M,
-                         unsigned int    _N)
+// compile permutation passes into gather tables
+void interleaver_compile(interleaver _q)
 {
-    unsigned int i;
-    unsigned int j;
-    unsigned int m=0;
-    unsigned int n=_n/3;
-    unsigned int n2=_n/2;
-    unsigned char tmp;
-    for (i=0; i<n2; i++) {
-        //j = m*N + n; // input
-        do {
-            j = m*_N + n; // output
-            m++;
-            if (m == _M) {
-                n = (n+1) % (_N);
-                m=0;
+    unsigned int n  = _q->n;
+    unsigned int n2 = _q->n / 2;
+    unsigned int depth = _q->depth < 4 ? _q->depth : 4;
+
+    // bits moved by each pass and its column dimension; the first
+    // pass swaps whole bytes
+    unsigned char pass_mask[4] = {0xff, 0x0f, 0x55, 0x33};
+    unsigned int  pass_N[4]    = {_q->N, _q->N+2, _q->N+4, _q->N+8};
+
+    // group bits by the set of passes which move them
+    unsigned int key[8];
+    unsigned int b, c, s, i;
+    _q->num_classes = 0;
+    for (b=0; b<8; b++) {
+        unsigned int k = 0;
+        for (s=0; s<depth; s++)
+            k |= ((pass_mask[s] >> b) & 0x01) << s;
+
+        for (c=0; c<_q->num_classes && key[c] != k; c++);
+        if (c == _q->num_classes) {
+            key[c] = k;
+            _q->mask[c] = 0;
+            _q->num_classes++;
+        }
+        _q->mask[c] |= 1 << b;
+    }
+
+    // soft bits are stored most-significant bit first
+    for (c=0; c<_q->num_classes; c++) {
+        _q->mask_soft[c] = 0;
+        for (b=0; b<8; b++) {
+            if ((_q->mask[c] >> (7-b)) & 0x01)
+                _q->mask_soft[c] |= 0xffULL << (8*b);
+        }
+    }
+
+    // index walk of each pass
+    unsigned int * j = (unsigned int*) malloc((4*n2+1)*sizeof(unsigned int));
+    for (s=0; s<depth; s++)
+        interleaver_walk(n, _q->M, pass_N[s], j + s*n2);
+
+    // apply passes to byte indices of each class, recording the source
+    // of each encoded byte and its inverse
+    _q->p = (unsigned int*) realloc(_q->p, (2*_q->num_classes*n+1)*sizeof(unsigned int));
+    for (c=0; c<_q->num_classes; c++) {
+        unsigned int * pe = _q->p + c*n;
+        unsigned int * pd = _q->p + (_q->num_classes + c)*n;
+        for (i=0; i<n; i++)
+            pe[i] = i;
+
+        for (s=0; s<depth; s++) {
+            if ( !((key[c] >> s) & 0x01) )
+                continue;
+            for (i=0; i<n2; i++) {
+                unsigned int t   = pe[2*i];
+                pe[2*i]          = pe[2*j[s*n2+i]+1];
+                pe[2*j[s*n2+i]+1] = t;
             }
-        } while (j>=n2);
+        }
 
-        // swap indices
-        tmp = _x[2*j+1];
-        _x[2*j+1] = _x[2*i+0];
-        _x[2*i+0] = tmp;
+        for (i=0; i<n; i++)
+            pd[pe[i]] = i;
     }
+    free(j);
 }
 
-// permute one iteration (soft bit input)
-void interleaver_permute_soft(unsigned char * _x,
-                              unsigned int    _n,
-                              unsigned int    _M,
-                              unsigned int    _N)
+// compute index walk of one permutation pass
+//  _n      :   number of bytes
+//  _M      :   row dimension
+//  _N      :   col dimension
+//  _j      :   odd-byte partner of each even byte [size: _n/2 x 1]
+void interleaver_walk(unsigned int   _n,
+                      unsigned int   _M,
+                      unsigned int   _N,
+                      unsigned int * _j)
 {
     unsigned int i;
     unsigned int j;
     unsigned int m=0;
     unsigned int n=_n/3;
     unsigned int n2=_n/2;
-    unsigned char tmp[8];
     for (i=0; i<n2; i++) {
-        //j = m*N + n; // input
         do {
             j = m*_N + n; // output
             m++;
@@ -240,83 +380,112 @@ void interleaver_permute_soft(unsigned char * _x,
                 m=0;
             }
         } while (j>=n2);
-    
-        // swap soft bits at indices
-        memmove( tmp,            &_x[8*(2*j+1)], 8);
-        memmove( &_x[8*(2*j+1)], &_x[8*(2*i+0)], 8);
-        memmove( &_x[8*(2*i+0)], tmp,            8);
+
+        _j[i] = j;
     }
-    //printf("\n");
 }
 
-
-// permute one iteration with mask
-void interleaver_permute_mask(unsigned char * _x,
-                              unsigned int    _n,
-                              unsigned int    _M,
-                              unsigned int    _N,
-                              unsigned char   _mask)
+// gather bytes [_i0,_i1) through tables _p
+void interleaver_gather(interleaver     _q,
+                        unsigned int *  _p,
+                        unsigned char * _x,
+                        unsigned char * _y,
+                        unsigned int    _i0,
+                        unsigned int    _i1)
 {
-    unsigned int i;
-    unsigned int j;
-    unsigned int m=0;
-    unsigned int n=_n/3;
-    unsigned int n2=_n/2;
-    unsigned char tmp0;
-    unsigned char tmp1;
-    for (i=0; i<n2; i++) {
-        //j = m*N + n; // input
-        do {
-            j = m*_N + n; // output
-            m++;
-            if (m == _M) {
-                n = (n+1) % (_N);
-                m=0;
-            }
-        } while (j>=n2);
+    unsigned int n = _q->n;
+    unsigned int i, c;
 
-        // swap indices, applying mask
-        tmp0 = (_x[2*i+0] & (~_mask)) | (_x[2*j+1] & ( _mask));
-        tmp1 = (_x[2*i+0] & ( _mask)) | (_x[2*j+1] & (~_mask));
-        _x[2*i+0] = tmp0;
-        _x[2*j+1] = tmp1;
+    if (_q->num_classes == 1) {
+        for (i=_i0; i<_i1; i++)
+            _y[i] = _x[_p[i]];
+        return;
+    }
+
+    for (i=_i0; i<_i1; i++) {
+        unsigned char v = 0;
+        for (c=0; c<_q->num_classes; c++)
+            v |= _x[_p[c*n+i]] & _q->mask[c];
+        _y[i] = v;
     }
 }
 
-// permute one iteration (soft bit input)
-void interleaver_permute_mask_soft(unsigned char * _x,
-                                   unsigned int    _n,
-                                   unsigned int    _M,
-                                   unsigned int    _N,
-                                   unsigned char   _mask)
+// gather soft bits of bytes [_i0,_i1) through tables _p, one 64-bit
+// word per byte
+void interleaver_gather_soft_port(interleaver     _q,
+                                  unsigned int *  _p,
+                                  unsigned char * _x,
+                                  unsigned char * _y,
+                                  unsigned int    _i0,
+                                  unsigned int    _i1)
 {
-    unsigned int i;
-    unsigned int j;
-    unsigned int k;
-    unsigned int m=0;
-    unsigned int n=_n/3;
-    unsigned int n2=_n/2;
-    unsigned char tmp;
-    for (i=0; i<n2; i++) {
-        //j = m*N + n; // input
-        do {
-            j = m*_N + n; // output
-            m++;
-            if (m == _M) {
-                n = (n+1) % (_N);
-                m=0;
-            }
-        } while (j>=n2);
+    unsigned int n = _q->n;
+    unsigned int i, c;
+    for (i=_i0; i<_i1; i++) {
+        uint64_t v = 0;
+        for (c=0; c<_q->num_classes; c++)
+            v |= liquid_load_le64(&_x[8*_p[c*n+i]]) & _q->mask_soft[c];
+        liquid_store_le64(&_y[8*i], v);
+    }
+}
 
-        // swap bits matching the mask
-        for (k=0; k<8; k++) {
-            if ( (_mask >> (8-k-1)) & 0x01 ) {
-                tmp = _x[8*(2*j+1)+k];
-                _x[8*(2*j+1)+k] = _x[8*(2*i+0)+k];
-                _x[8*(2*i+0)+k] = tmp;
-            }
+#if LIQUID_SIMD_DISPATCH
+// gather soft bits of bytes [_i0,_i1), four bytes at a time
+__attribute__((target("avx2")))
+void interleaver_gather_soft_avx2(interleaver     _q,
+                                  unsigned int *  _p,
+                                  unsigned char * _x,
+                                  unsigned char * _y,
+                                  unsigned int    _i0,
+                                  unsigned int    _i1)
+{
+    unsigned int n = _q->n;
+    unsigned int i = _i0;
+    unsigned int c;
+    for ( ; i+4<=_i1; i+=4) {
+        __m256i v = _mm256_setzero_si256();
+        for (c=0; c<_q->num_classes; c++) {
+            __m128i idx = _mm_loadu_si128((const __m128i*)(_p + c*n + i));
+            __m256i g   = _mm256_i32gather_epi64((const long long*)_x, idx, 8);
+            v = _mm256_or_si256(v, _mm256_and_si256(g, _mm256_set1_epi64x(_q->mask_soft[c])));
+        }
+        _mm256_storeu_si256((__m256i*)(_y + 8*i), v);
+    }
+
+    // remaining bytes
+    interleaver_gather_soft_port(_q, _p, _x, _y, i, _i1);
+}
+#endif
+
+// interleave a block of packets through tables _p, tiling the output
+// so each slice of the tables is reused across all packets
+void interleaver_execute_block(interleaver     _q,
+                               unsigned int *  _p,
+                               unsigned char * _x,
+                               unsigned char * _y,
+                               unsigned int    _num_packets,
+                               int             _soft)
+{
+    unsigned int n  = _q->n;
+    unsigned int ns = _soft ? 8*n : n;  // bytes per packet
+    unsigned int i0, i1, k;
+
+    // in-place operation runs one packet at a time through buffer
+    if (_x == _y) {
+        for (k=0; k<_num_packets; k++) {
+            if (_soft) _q->gather_soft(_q, _p, _x + k*ns, _q->buf, 0, n);
+            else       interleaver_gather (_q, _p, _x + k*ns, _q->buf, 0, n);
+            memmove(_y + k*ns, _q->buf, ns);
+        }
+        return;
+    }
+
+    for (i0=0; i0<n; i0+=INTERLEAVER_TILE) {
+        i1 = (i0 + INTERLEAVER_TILE < n) ? i0 + INTERLEAVER_TILE : n;
+        for (k=0; k<_num_packets; k++) {
+            if (_soft) _q->gather_soft(_q, _p, _x + k*ns, _y + k*ns, i0, i1);
+            else       interleaver_gather (_q, _p, _x + k*ns, _y + k*ns, i0, i1);
         }
     }
-    //printf("\n");
 }
 
@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  */
 
+#include <stdlib.h>
 #include <string.h>
 
 #include "autotest/autotest.h"
@@ -120,3 +121,77 @@ void autotest_crc24()    { validate_crc(LIQUID_CRC_24,          64); }
 void autotest_crc32()    { validate_crc(LIQUID_CRC_32,          64); }
 
 
+
+// bit-serial reference: reflected polynomial, 32-bit register
+// initialized to all ones, key is lower _w bits of inverted register
+unsigned int crc_autotest_reference(unsigned int    _poly,
+                                    unsigned int    _w,
+                                    unsigned char * _msg,
+                                    unsigned int    _n)
+{
+    unsigned int i, j, key=~0;
+    unsigned int poly = liquid_reverse_uint32(_poly) >> (32-_w);
+    for (i=0; i<_n; i++) {
+        key ^= _msg[i];
+        for (j=0; j<8; j++)
+            key = (key>>1) ^ (poly & -(key & 1));
+    }
+    return _w == 32 ? ~key : (~key) & ((1u<<_w)-1);
+}
+
+//
+// AUTOTEST: table-driven (and folded) keys match bit-serial reference
+//           for lengths covering all code paths
+//
+void autotest_crc_reference()
+{
+    crc_scheme   schemes[4] = {LIQUID_CRC_8, LIQUID_CRC_16, LIQUID_CRC_24, LIQUID_CRC_32};
+    unsigned int polys[4]   = {0x07, 0x8005, 0x5D6DCB, 0x04C11DB7};
+    unsigned int widths[4]  = {8, 16, 24, 32};
+
+    unsigned char msg[1200];
+    unsigned int i, s, n;
+    for (i=0; i<1200; i++)
+        msg[i] = rand() & 0xff;
+
+    for (s=0; s<4; s++) {
+        for (n=0; n<1200; n += (n < 80 ? 1 : 37)) {
+            CONTEND_EQUALITY(crc_generate_key(schemes[s], msg, n),
+                             crc_autotest_reference(polys[s], widths[s], msg, n));
+        }
+        // unaligned message
+        CONTEND_EQUALITY(crc_generate_key(schemes[s], msg+3, 1001),
+                         crc_autotest_reference(polys[s], widths[s], msg+3, 1001));
+    }
+
+    // standard check value for CRC-32
+    unsigned char check[9] = {'1','2','3','4','5','6','7','8','9'};
+    CONTEND_EQUALITY(crc_generate_key(LIQUID_CRC_32, check, 9), 0xcbf43926);
+}
+
+//
+// AUTOTEST: streaming keys are independent of how message is split
+//
+void autotest_crc_streaming()
+{
+    unsigned char msg[1000];
+    unsigned int i;
+    for (i=0; i<1000; i++)
+        msg[i] = rand() & 0xff;
+
+    crc_scheme s;
+    for (s=LIQUID_CRC_NONE; s<LIQUID_CRC_NUM_SCHEMES; s++) {
+        unsigned int key = crc_generate_key(s, msg, 1000);
+
+        // split message into random portions (including empty ones)
+        unsigned int state = crc_init(s);
+        unsigned int n = 0;
+        while (n < 1000) {
+            unsigned int k = rand() % 300;
+            if (n + k > 1000) k = 1000 - n;
+            state = crc_update(s, state, &msg[n], k);
+            n += k;
+        }
+        CONTEND_EQUALITY(crc_finalize(s, state), key);
+    }
+}
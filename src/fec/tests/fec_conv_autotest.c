@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// Helper function: decode convolutional code with hard errors
+//  _fs     :   convolutional scheme
+//  _n      :   decoded message length (bytes)
+//  _step   :   spacing between bit errors in encoded message
+void fec_conv_test_hard(fec_scheme   _fs,
+                        unsigned int _n,
+                        unsigned int _step)
+{
+    // create arrays
+    unsigned int n_enc = fec_get_enc_msg_length(_fs,_n);
+    unsigned char msg_org[_n];      // original message
+    unsigned char msg_enc[n_enc];   // encoded message
+    unsigned char msg_dec[_n];      // decoded message
+
+    // initialize message
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        msg_org[i] = rand() & 0xff;
+
+    // create object and encode
+    fec q = fec_create(_fs,NULL);
+    fec_encode(q, _n, msg_org, msg_enc);
+
+    // flip bits, evenly spaced across encoded message
+    for (i=_step/2; i<8*n_enc; i+=_step)
+        msg_enc[i/8] ^= 1 << (7-(i%8));
+
+    // decode and validate
+    fec_decode(q, _n, msg_enc, msg_dec);
+    CONTEND_SAME_DATA(msg_org, msg_dec, _n);
+
+    fec_destroy(q);
+}
+
+// Helper function: decode convolutional code with noisy soft bits
+//  _fs     :   convolutional scheme
+//  _n      :   decoded message length (bytes)
+//  _sigma  :   noise standard deviation (unit signal amplitude)
+void fec_conv_test_soft(fec_scheme   _fs,
+                        unsigned int _n,
+                        float        _sigma)
+{
+    // create arrays
+    unsigned int n_enc = fec_get_enc_msg_length(_fs,_n);
+    unsigned char msg_org[_n];          // original message
+    unsigned char msg_enc[n_enc];       // encoded message
+    unsigned char msg_soft[8*n_enc];    // received soft bits
+    unsigned char msg_dec[_n];          // decoded message
+
+    // initialize message
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        msg_org[i] = rand() & 0xff;
+
+    // create object and encode
+    fec q = fec_create(_fs,NULL);
+    fec_encode(q, _n, msg_org, msg_enc);
+
+    // add noise and quantize to soft bits
+    for (i=0; i<8*n_enc; i++) {
+        float v = ((msg_enc[i/8] >> (7-(i%8))) & 1) ? 1.0f : -1.0f;
+        v = 127.5f + 64.0f*(v + _sigma*randnf());
+        msg_soft[i] = v < 0.0f ? 0 : (v > 255.0f ? 255 : (unsigned char)v);
+    }
+
+    // decode and validate
+    fec_decode_soft(q, _n, msg_soft, msg_dec);
+    CONTEND_SAME_DATA(msg_org, msg_dec, _n);
+
+    fec_destroy(q);
+}
+
+// 
+// AUTOTESTS: hard-decision decoding with bit errors
+//
+void autotest_fec_conv_v27_hard()       { fec_conv_test_hard(LIQUID_FEC_CONV_V27,    64, 40); }
+void autotest_fec_conv_v29_hard()       { fec_conv_test_hard(LIQUID_FEC_CONV_V29,    64, 40); }
+void autotest_fec_conv_v39_hard()       { fec_conv_test_hard(LIQUID_FEC_CONV_V39,    64, 40); }
+void autotest_fec_conv_v615_hard()      { fec_conv_test_hard(LIQUID_FEC_CONV_V615,   16, 40); }
+void autotest_fec_conv_v27p34_hard()    { fec_conv_test_hard(LIQUID_FEC_CONV_V27P34, 64, 200); }
+void autotest_fec_conv_v29p23_hard()    { fec_conv_test_hard(LIQUID_FEC_CONV_V29P23, 64, 100); }
+
+// 
+// AUTOTESTS: soft-decision decoding with noise
+//
+void autotest_fec_conv_v27_soft()       { fec_conv_test_soft(LIQUID_FEC_CONV_V27,    64, 0.5f); }
+void autotest_fec_conv_v29_soft()       { fec_conv_test_soft(LIQUID_FEC_CONV_V29,    64, 0.5f); }
+void autotest_fec_conv_v39_soft()       { fec_conv_test_soft(LIQUID_FEC_CONV_V39,    64, 0.6f); }
+void autotest_fec_conv_v615_soft()      { fec_conv_test_soft(LIQUID_FEC_CONV_V615,   16, 0.8f); }
+
+//
+// AUTOTEST: Viterbi decoder run over trellis in several blocks
+//
+void autotest_fec_conv_viterbi_blocks()
+{
+    unsigned int n = 32;        // decoded message length (bytes)
+    unsigned int K = 7;         // constraint length
+    unsigned int num_steps = 8*n + K - 1;
+
+    // create arrays
+    unsigned int n_enc = fec_get_enc_msg_length(LIQUID_FEC_CONV_V27,n);
+    unsigned char msg_org[n];           // original message
+    unsigned char msg_enc[n_enc];       // encoded message
+    unsigned char msg_soft[8*n_enc];    // soft bits
+    unsigned char msg_dec0[n];          // decoded message (single block)
+    unsigned char msg_dec1[n];          // decoded message (several blocks)
+
+    unsigned int i;
+    for (i=0; i<n; i++)
+        msg_org[i] = rand() & 0xff;
+
+    fec q = fec_create(LIQUID_FEC_CONV_V27,NULL);
+    fec_encode(q, n, msg_org, msg_enc);
+    fec_destroy(q);
+
+    // soft bits with a few errors
+    for (i=0; i<8*n_enc; i++)
+        msg_soft[i] = ((msg_enc[i/8] >> (7-(i%8))) & 1) ? LIQUID_SOFTBIT_1 : LIQUID_SOFTBIT_0;
+    for (i=17; i<8*n_enc; i+=53)
+        msg_soft[i] = 255 - msg_soft[i];
+
+    // decode in a single block
+    fec_conv_viterbi v = fec_conv_viterbi_create(K, 2, fec_conv27_poly, 8*n);
+    fec_conv_viterbi_update(v, msg_soft, num_steps);
+    fec_conv_viterbi_chainback(v, msg_dec0, 8*n, 0);
+
+    // decode in blocks of irregular size
+    unsigned int t = 0;
+    unsigned int block = 1;
+    fec_conv_viterbi_reset(v);
+    while (t < num_steps) {
+        unsigned int k = (t + block > num_steps) ? num_steps - t : block;
+        fec_conv_viterbi_update(v, msg_soft + 2*t, k);
+        t += k;
+        block = (block % 11) + 2;
+    }
+    fec_conv_viterbi_chainback(v, msg_dec1, 8*n, 0);
+    fec_conv_viterbi_destroy(v);
+
+    CONTEND_SAME_DATA(msg_dec0, msg_dec1, n);
+    CONTEND_SAME_DATA(msg_org,  msg_dec0, n);
+}
+
+// Helper function: run each add-compare-select kernel available on
+// this build/host over the same random soft symbols (in blocks of
+// irregular size) and contend that path metrics and decisions match
+// those of the portable kernel
+//  _K      :   constraint length
+//  _R      :   inverse code rate
+//  _poly   :   generator polynomials [size: _R x 1]
+void fec_conv_viterbi_test_kernels(unsigned int _K,
+                                   unsigned int _R,
+                                   int *        _poly)
+{
+    unsigned int num_bits  = 200;
+    unsigned int num_steps = num_bits + _K - 1;
+    unsigned int S = 1 << (_K-1);
+    unsigned int W = S / 32;
+
+    unsigned char * syms = (unsigned char*) malloc(_R*num_steps);
+    int16_t *  m0 = (int16_t*)  malloc(S*sizeof(int16_t));
+    int16_t *  m1 = (int16_t*)  malloc(S*sizeof(int16_t));
+    uint32_t * d0 = (uint32_t*) malloc(num_steps*W*sizeof(uint32_t));
+    uint32_t * d1 = (uint32_t*) malloc(num_steps*W*sizeof(uint32_t));
+
+    unsigned int i;
+    for (i=0; i<_R*num_steps; i++)
+        syms[i] = rand() & 0xff;
+
+    fec_conv_viterbi_kernel kernels[3] = {FEC_CONV_VITERBI_KERNEL_PORT,
+                                          FEC_CONV_VITERBI_KERNEL_SSE2,
+                                          FEC_CONV_VITERBI_KERNEL_AVX2};
+    fec_conv_viterbi v = fec_conv_viterbi_create(_K, _R, _poly, num_bits);
+    unsigned int k;
+    for (k=0; k<3; k++) {
+        if (!fec_conv_viterbi_set_kernel(v, kernels[k])) {
+            if (liquid_autotest_verbose)
+                printf("  kernel %u not available\n", k);
+            continue;
+        }
+
+        fec_conv_viterbi_reset(v);
+        unsigned int t = 0;
+        unsigned int block = 1;
+        while (t < num_steps) {
+            unsigned int n = (t + block > num_steps) ? num_steps - t : block;
+            fec_conv_viterbi_update(v, syms + _R*t, n);
+            t += n;
+            block = (block % 13) + 3;
+        }
+
+        fec_conv_viterbi_get_metrics(v, k==0 ? m0 : m1);
+        fec_conv_viterbi_get_decisions(v, k==0 ? d0 : d1);
+        if (k > 0) {
+            CONTEND_SAME_DATA(m0, m1, S*sizeof(int16_t));
+            CONTEND_SAME_DATA(d0, d1, num_steps*W*sizeof(uint32_t));
+        }
+    }
+    fec_conv_viterbi_destroy(v);
+
+    free(syms);
+    free(m0);
+    free(m1);
+    free(d0);
+    free(d1);
+}
+
+//
+// AUTOTESTS: add-compare-select kernels agree with portable kernel
+//
+void autotest_fec_conv_viterbi_kernels_v27()  { fec_conv_viterbi_test_kernels( 7, 2, fec_conv27_poly);  }
+void autotest_fec_conv_viterbi_kernels_v29()  { fec_conv_viterbi_test_kernels( 9, 2, fec_conv29_poly);  }
+void autotest_fec_conv_viterbi_kernels_v39()  { fec_conv_viterbi_test_kernels( 9, 3, fec_conv39_poly);  }
+void autotest_fec_conv_viterbi_kernels_v615() { fec_conv_viterbi_test_kernels(15, 6, fec_conv615_poly); }
+
+// Helper function: hard-decision decoding from an encoded message held
+// in a buffer of exactly the encoded length (no trailing bytes to read)
+//  _fs     :   convolutional scheme
+//  _n      :   decoded message length (bytes)
+void fec_conv_test_exact(fec_scheme   _fs,
+                         unsigned int _n)
+{
+    unsigned int n_enc = fec_get_enc_msg_length(_fs,_n);
+    unsigned char * msg_org = (unsigned char*) malloc(_n);
+    unsigned char * msg_enc = (unsigned char*) malloc(n_enc);
+    unsigned char * msg_dec = (unsigned char*) malloc(_n);
+
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        msg_org[i] = rand() & 0xff;
+
+    fec q = fec_create(_fs,NULL);
+    fec_encode(q, _n, msg_org, msg_enc);
+    fec_decode(q, _n, msg_enc, msg_dec);
+    CONTEND_SAME_DATA(msg_org, msg_dec, _n);
+    fec_destroy(q);
+
+    free(msg_org);
+    free(msg_enc);
+    free(msg_dec);
+}
+
+//
+// AUTOTESTS: exactly-sized encoded buffers
+//
+void autotest_fec_conv_v27_exact()      { fec_conv_test_exact(LIQUID_FEC_CONV_V27,    17); }
+void autotest_fec_conv_v27p23_exact()   { fec_conv_test_exact(LIQUID_FEC_CONV_V27P23, 17); }
+void autotest_fec_conv_v27p34_exact()   { fec_conv_test_exact(LIQUID_FEC_CONV_V27P34, 17); }
+void autotest_fec_conv_v27p45_exact()   { fec_conv_test_exact(LIQUID_FEC_CONV_V27P45, 17); }
+void autotest_fec_conv_v27p56_exact()   { fec_conv_test_exact(LIQUID_FEC_CONV_V27P56, 17); }
+void autotest_fec_conv_v27p67_exact()   { fec_conv_test_exact(LIQUID_FEC_CONV_V27P67, 17); }
+void autotest_fec_conv_v27p78_exact()   { fec_conv_test_exact(LIQUID_FEC_CONV_V27P78, 17); }
+void autotest_fec_conv_v29p23_exact()   { fec_conv_test_exact(LIQUID_FEC_CONV_V29P23, 17); }
+void autotest_fec_conv_v29p78_exact()   { fec_conv_test_exact(LIQUID_FEC_CONV_V29P78, 17); }
@@ -105,3 +105,21 @@ void autotest_golay2412_codec()
     }
 }
 
+//
+// AUTOTEST: Golay(24,12) decoding table
+//
+void autotest_golay2412_gentab()
+{
+    // table must agree with full error estimate for every syndrome
+    unsigned int s;
+    for (s=0; s<(1<<12); s++)
+        CONTEND_EQUALITY(golay2412_dec_gentab[s], golay2412_estimate_ehat(s) & 0x0fff);
+
+    // parity table must agree with matrix multiplication
+    unsigned int m;
+    for (m=0; m<(1<<12); m++) {
+        unsigned int p = golay2412_enc_gentab[0][m >> 6] ^ golay2412_enc_gentab[1][m & 0x3f];
+        CONTEND_EQUALITY(p, golay2412_matrix_mul(m, golay2412_P, 12));
+    }
+}
+
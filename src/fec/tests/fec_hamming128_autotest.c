@@ -103,3 +103,54 @@ void autotest_hamming128_codec_soft()
     }
 }
 
+//
+// AUTOTEST: Hamming (12,8) decoding table
+//
+void autotest_hamming128_gentab()
+{
+    unsigned int c;
+    for (c=0; c<(1<<12); c++)
+        CONTEND_EQUALITY(hamming128_dec_gentab[c], fec_hamming128_decode_symbol(c));
+}
+
+//
+// AUTOTEST: Hamming (12,8) soft decoding against exhaustive search
+//
+void autotest_hamming128_codec_soft_ml()
+{
+    unsigned int n = 37;            // number of decoded bytes
+    unsigned char soft_bits[12*37]; // random soft bits
+    unsigned char msg_dec[37];      // decoded message
+    unsigned int i, k, s;
+
+    for (i=0; i<12*n; i++)
+        soft_bits[i] = rand() & 0xff;
+
+    // decode block (possibly several symbols at a time)
+    fec q = fec_create(LIQUID_FEC_HAMMING128, NULL);
+    fec_decode_soft(q, n, soft_bits, msg_dec);
+    fec_destroy(q);
+
+    for (i=0; i<n; i++) {
+        unsigned char * b = &soft_bits[12*i];
+
+        // find symbol with minimum distance from all 2^8 possible
+        unsigned int dmin = 0;
+        unsigned int s_hat = 0;
+        for (s=0; s<256; s++) {
+            unsigned int c = fec_hamming128_encode_symbol(s);
+            unsigned int d = 0;
+            for (k=0; k<12; k++)
+                d += (c >> (11-k)) & 1 ? 255 - b[k] : b[k];
+
+            if (d < dmin || s==0) {
+                s_hat = s;
+                dmin  = d;
+            }
+        }
+
+        CONTEND_EQUALITY(fecsoft_hamming128_decode(b), s_hat);
+        CONTEND_EQUALITY(msg_dec[i], s_hat);
+    }
+}
+
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// check that encoded codewords satisfy all parity checks
+void fec_ldpc_test_codeword(unsigned int _kb,
+                            unsigned int _Z)
+{
+    fec_ldpc_codec q = fec_ldpc_codec_create(_kb, _Z);
+    unsigned int n = fec_ldpc_codec_get_n(q);
+    unsigned int k = fec_ldpc_codec_get_k(q);
+    CONTEND_EQUALITY(n, 24*_Z);
+    CONTEND_EQUALITY(k, _kb*_Z);
+
+    unsigned char * c = (unsigned char*) malloc(n*sizeof(unsigned char));
+    unsigned char * s = (unsigned char*) malloc((n-k)*sizeof(unsigned char));
+    unsigned int i, t;
+    smatrixb H = fec_ldpc_codec_get_H(q);
+    for (t=0; t<4; t++) {
+        for (i=0; i<k; i++)
+            c[i] = rand() & 1;
+        fec_ldpc_codec_encode(q, c, c+k);
+
+        // syndrome: s = H*c
+        smatrixb_vmul(H, c, s);
+        unsigned int num_errors = 0;
+        for (i=0; i<n-k; i++)
+            num_errors += s[i];
+        CONTEND_EQUALITY(num_errors, 0);
+    }
+
+    smatrixb_destroy(H);
+    fec_ldpc_codec_destroy(q);
+    free(c);
+    free(s);
+}
+
+void autotest_fec_ldpc_codeword_r12_z27()  { fec_ldpc_test_codeword(12,  27); }
+void autotest_fec_ldpc_codeword_r23_z54()  { fec_ldpc_test_codeword(16,  54); }
+void autotest_fec_ldpc_codeword_r34_z81()  { fec_ldpc_test_codeword(18,  81); }
+void autotest_fec_ldpc_codeword_r56_z81()  { fec_ldpc_test_codeword(20,  81); }
+void autotest_fec_ldpc_codeword_r12_z675() { fec_ldpc_test_codeword(12, 675); }
+
+// decode codeword in additive white Gaussian noise
+void fec_ldpc_test_awgn(unsigned int _kb,
+                        unsigned int _Z,
+                        float        _SNRdB)
+{
+    fec_ldpc_codec q = fec_ldpc_codec_create(_kb, _Z);
+    unsigned int n = fec_ldpc_codec_get_n(q);
+    unsigned int k = fec_ldpc_codec_get_k(q);
+
+    unsigned char * c   = (unsigned char*) malloc(n*sizeof(unsigned char));
+    unsigned char * m   = (unsigned char*) malloc(k*sizeof(unsigned char));
+    signed char   * llr = (signed char*)   malloc(n*sizeof(signed char));
+    unsigned int i;
+    for (i=0; i<k; i++)
+        c[i] = rand() & 1;
+    fec_ldpc_codec_encode(q, c, c+k);
+
+    // BPSK in noise, LLRs scaled by 4 and quantized
+    float nstd = powf(10.0f, -_SNRdB/20.0f);
+    unsigned int num_errors_raw = 0;
+    for (i=0; i<n; i++) {
+        float y = (c[i] ? -1.0f : 1.0f) + nstd*randnf();
+        float v = roundf(4.0f * 2.0f * y / (nstd*nstd));
+        llr[i] = v > 127 ? 127 : (v < -127 ? -127 : (signed char)v);
+        num_errors_raw += (llr[i] < 0) != c[i];
+    }
+
+    int rc = fec_ldpc_codec_decode(q, llr, 50, m);
+    unsigned int num_errors = 0;
+    for (i=0; i<k; i++)
+        num_errors += m[i] != c[i];
+
+    if (liquid_autotest_verbose)
+        printf("  ldpc r%u/24, Z=%u, SNR=%.1f dB : %u raw errors, %u after decoding (%d iterations)\n",
+                _kb, _Z, _SNRdB, num_errors_raw, num_errors, rc);
+
+    CONTEND_GREATER_THAN(num_errors_raw, 0);
+    CONTEND_GREATER_THAN(rc, 0);
+    CONTEND_EQUALITY(num_errors, 0);
+
+    fec_ldpc_codec_destroy(q);
+    free(c);
+    free(m);
+    free(llr);
+}
+
+void autotest_fec_ldpc_awgn_r12() { fec_ldpc_test_awgn(12,  81, 3.0f); }
+void autotest_fec_ldpc_awgn_r23() { fec_ldpc_test_awgn(16,  81, 5.0f); }
+void autotest_fec_ldpc_awgn_r34() { fec_ldpc_test_awgn(18,  81, 6.0f); }
+void autotest_fec_ldpc_awgn_r56() { fec_ldpc_test_awgn(20, 675, 6.5f); }
+
+// decode noisy codewords with the layer kernel of each SIMD extension
+// level supported by the host, comparing against the portable kernel
+// after a varying number of iterations (including non-converged ones)
+void fec_ldpc_test_kernels(unsigned int _kb,
+                           unsigned int _Z,
+                           float        _SNRdB)
+{
+    liquid_simd_level host = liquid_simd_get_level();
+    liquid_simd_set_level(LIQUID_SIMD_BASELINE);
+    fec_ldpc_codec q0 = fec_ldpc_codec_create(_kb, _Z);
+    unsigned int n = fec_ldpc_codec_get_n(q0);
+    unsigned int k = fec_ldpc_codec_get_k(q0);
+
+    unsigned char * c   = (unsigned char*) malloc(n*sizeof(unsigned char));
+    unsigned char * m0  = (unsigned char*) malloc(k*sizeof(unsigned char));
+    unsigned char * m1  = (unsigned char*) malloc(k*sizeof(unsigned char));
+    signed char   * llr = (signed char*)   malloc(n*sizeof(signed char));
+    unsigned int i, t, level;
+    unsigned int num_iterations[4] = {1, 2, 5, 50};
+    for (t=0; t<4; t++) {
+        for (i=0; i<k; i++)
+            c[i] = rand() & 1;
+        fec_ldpc_codec_encode(q0, c, c+k);
+
+        // BPSK in noise, LLRs scaled by 4 and quantized
+        float nstd = powf(10.0f, -_SNRdB/20.0f);
+        for (i=0; i<n; i++) {
+            float y = (c[i] ? -1.0f : 1.0f) + nstd*randnf();
+            float v = roundf(4.0f * 2.0f * y / (nstd*nstd));
+            llr[i] = v > 127 ? 127 : (v < -127 ? -127 : (signed char)v);
+        }
+        int rc0 = fec_ldpc_codec_decode(q0, llr, num_iterations[t], m0);
+
+        for (level=LIQUID_SIMD_BASELINE+1; level<=host; level++) {
+            liquid_simd_set_level((liquid_simd_level)level);
+            fec_ldpc_codec q1 = fec_ldpc_codec_create(_kb, _Z);
+            int rc1 = fec_ldpc_codec_decode(q1, llr, num_iterations[t], m1);
+            fec_ldpc_codec_destroy(q1);
+
+            CONTEND_EQUALITY(rc0, rc1);
+            CONTEND_SAME_DATA(m0, m1, k);
+        }
+    }
+    liquid_simd_set_level(host);
+
+    fec_ldpc_codec_destroy(q0);
+    free(c);
+    free(m0);
+    free(m1);
+    free(llr);
+}
+
+void autotest_fec_ldpc_kernels_r12_z27()  { fec_ldpc_test_kernels(12,  27, 2.0f); }
+void autotest_fec_ldpc_kernels_r23_z54()  { fec_ldpc_test_kernels(16,  54, 4.0f); }
+void autotest_fec_ldpc_kernels_r56_z81()  { fec_ldpc_test_kernels(20,  81, 5.5f); }
+void autotest_fec_ldpc_kernels_r34_z675() { fec_ldpc_test_kernels(18, 675, 4.5f); }
+
+// compare against floating-point sum-product decoder on expanded matrix
+void autotest_fec_ldpc_sumproduct()
+{
+    fec_ldpc_codec q = fec_ldpc_codec_create(20, 27);
+    unsigned int n = fec_ldpc_codec_get_n(q);
+    unsigned int k = fec_ldpc_codec_get_k(q);
+
+    unsigned char c[n];
+    unsigned char c_hat[n];
+    unsigned char m[k];
+    float         LLR[n];
+    signed char   llr[n];
+    unsigned int i;
+    for (i=0; i<k; i++)
+        c[i] = rand() & 1;
+    fec_ldpc_codec_encode(q, c, c+k);
+
+    // fixed channel values with a few bits in error
+    for (i=0; i<n; i++) {
+        int v = c[i] ? -8 : 8;
+        if ((i % 97) == 13)
+            v = -v / 2;
+        llr[i] = v;
+        LLR[i] = 0.5f * v;
+    }
+
+    smatrixb H = fec_ldpc_codec_get_H(q);
+    int parity_pass = fec_sumproduct(n-k, n, H, LLR, c_hat, 10);
+    int rc = fec_ldpc_codec_decode(q, llr, 10, m);
+    CONTEND_EQUALITY(parity_pass, 1);
+    CONTEND_GREATER_THAN(rc, 0);
+    CONTEND_SAME_DATA(c_hat, c, n);
+    CONTEND_SAME_DATA(m, c, k);
+
+    smatrixb_destroy(H);
+    fec_ldpc_codec_destroy(q);
+}
+
+// test encoding/decoding through fec object with various message lengths
+void fec_ldpc_test_length(fec_scheme   _fs,
+                          unsigned int _n)
+{
+    fec q = fec_create(_fs, NULL);
+    unsigned int n_enc = fec_get_enc_msg_length(_fs, _n);
+    CONTEND_GREATER_THAN(n_enc, _n);
+
+    unsigned char * msg     = (unsigned char*) malloc(_n*sizeof(unsigned char));
+    unsigned char * msg_enc = (unsigned char*) malloc(n_enc*sizeof(unsigned char));
+    unsigned char * msg_dec = (unsigned char*) malloc(_n*sizeof(unsigned char));
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        msg[i] = rand() & 0xff;
+
+    fec_encode(q, _n, msg, msg_enc);
+
+    // flip one bit in every 50 bytes
+    for (i=0; i<n_enc; i+=50)
+        msg_enc[i] ^= 0x10;
+
+    fec_decode(q, _n, msg_enc, msg_dec);
+    CONTEND_SAME_DATA(msg, msg_dec, _n);
+
+    free(msg);
+    free(msg_enc);
+    free(msg_dec);
+    fec_destroy(q);
+}
+
+void autotest_fec_ldpc_length_n1()     { fec_ldpc_test_length(LIQUID_FEC_LDPC_R12,     1); }
+void autotest_fec_ldpc_length_n57()    { fec_ldpc_test_length(LIQUID_FEC_LDPC_R23,    57); }
+void autotest_fec_ldpc_length_n1000()  { fec_ldpc_test_length(LIQUID_FEC_LDPC_R34,  1000); }
+void autotest_fec_ldpc_length_n10000() { fec_ldpc_test_length(LIQUID_FEC_LDPC_R56, 10000); }
+
@@ -31,11 +31,6 @@
 //
 void autotest_reedsolomon_223_255()
 {
-#if !LIBFEC_ENABLED
-    printf("warning: Reed-Solomon codes unavailable\n");
-    return;
-#endif
-
     unsigned int dec_msg_len = 223;
 
     // compute and test encoded message length
@@ -83,3 +78,205 @@ void autotest_reedsolomon_223_255()
     fec_destroy(q);
 }
 
+
+// multiply two elements in GF(2^8) with field polynomial 0x11d
+unsigned char reedsolomon_autotest_gfmul(unsigned char _a,
+                                         unsigned char _b)
+{
+    unsigned int p = 0, a = _a;
+    while (_b) {
+        if (_b & 1) p ^= a;
+        a <<= 1;
+        if (a & 0x100) a ^= 0x11d;
+        _b >>= 1;
+    }
+    return p;
+}
+
+//
+// AUTOTEST: code words have roots alpha^1 ... alpha^32 with the data
+//           symbols first (libfec convention)
+//
+void autotest_reedsolomon_codeword()
+{
+    unsigned int k = 223;
+    unsigned char msg[255];
+    unsigned int i, j;
+    for (i=0; i<k; i++)
+        msg[i] = rand() & 0xff;
+
+    fec_rs_codec q = fec_rs_codec_create(0x11d, 1, 1, 32);
+    fec_rs_codec_encode(q, msg, k, &msg[k]);
+
+    // evaluate code word polynomial (msg[0] is highest order) at roots
+    unsigned char root = 1;
+    for (j=0; j<32; j++) {
+        root = reedsolomon_autotest_gfmul(root, 2);
+        unsigned char v = 0;
+        for (i=0; i<255; i++)
+            v = reedsolomon_autotest_gfmul(v, root) ^ msg[i];
+        CONTEND_EQUALITY(v, 0);
+    }
+
+    // clean block decodes without corrections
+    CONTEND_EQUALITY(fec_rs_codec_decode(q, msg, k), 0);
+
+    fec_rs_codec_destroy(q);
+}
+
+// Helper function: corrupt _num_errors distinct symbols of a shortened
+// block and decode
+void reedsolomon_test_errors(unsigned int _k,
+                             unsigned int _num_errors)
+{
+    unsigned int n = _k + 32;
+    unsigned char msg[n];   // original code word
+    unsigned char rec[n];   // received code word
+    unsigned int i;
+    for (i=0; i<_k; i++)
+        msg[i] = rand() & 0xff;
+
+    fec_rs_codec q = fec_rs_codec_create(0x11d, 1, 1, 32);
+    fec_rs_codec_encode(q, msg, _k, &msg[_k]);
+
+    // corrupt distinct symbols (data and parity)
+    memmove(rec, msg, n);
+    unsigned int num_errors = 0;
+    while (num_errors < _num_errors) {
+        unsigned int p = rand() % n;
+        if (rec[p] != msg[p])
+            continue;
+        rec[p] ^= 1 + (rand() % 255);
+        num_errors++;
+    }
+
+    // keep copy of received block
+    unsigned char rec0[n];
+    memmove(rec0, rec, n);
+
+    int rc = fec_rs_codec_decode(q, rec, _k);
+    if (liquid_autotest_verbose)
+        printf("  rs(%3u,%3u), %2u errors : %d\n", n, _k, _num_errors, rc);
+
+    if (_num_errors <= 16) {
+        // errors must be corrected
+        CONTEND_EQUALITY(rc, (int)_num_errors);
+        CONTEND_SAME_DATA(rec, msg, n);
+    } else {
+        // decoding fails, leaving block unchanged
+        CONTEND_EQUALITY(rc, -1);
+        CONTEND_SAME_DATA(rec, rec0, n);
+    }
+
+    fec_rs_codec_destroy(q);
+}
+
+void autotest_reedsolomon_errors_k223()
+{
+    unsigned int e;
+    for (e=0; e<=16; e++)
+        reedsolomon_test_errors(223, e);
+    reedsolomon_test_errors(223, 17);
+    reedsolomon_test_errors(223, 24);
+}
+
+void autotest_reedsolomon_errors_k100()
+{
+    unsigned int e;
+    for (e=0; e<=16; e++)
+        reedsolomon_test_errors(100, e);
+    reedsolomon_test_errors(100, 17);
+}
+
+void autotest_reedsolomon_errors_k1()
+{
+    reedsolomon_test_errors(1, 1);
+    reedsolomon_test_errors(1, 16);
+}
+
+// Helper function: encode and decode random (shortened) blocks with
+// the encoder of each SIMD extension level supported by the host,
+// comparing against the portable encoder
+void reedsolomon_test_kernels(unsigned int _nroots,
+                              unsigned int _k)
+{
+    liquid_simd_level host = liquid_simd_get_level();
+    liquid_simd_set_level(LIQUID_SIMD_BASELINE);
+    fec_rs_codec q0 = fec_rs_codec_create(0x11d, 1, 1, _nroots);
+
+    unsigned int n = _k + _nroots;
+    unsigned char msg0[n];  // encoded with portable kernel
+    unsigned char msg1[n];  // encoded with dispatched kernel
+    unsigned int i, t, level;
+    for (t=0; t<8; t++) {
+        for (i=0; i<_k; i++)
+            msg0[i] = rand() & 0xff;
+        memmove(msg1, msg0, _k);
+        fec_rs_codec_encode(q0, msg0, _k, &msg0[_k]);
+
+        // corrupt a few symbols (decoding re-encodes the data)
+        unsigned char rec0[n];
+        unsigned char rec1[n];
+        memmove(rec0, msg0, n);
+        for (i=0; i<_nroots/2; i++)
+            rec0[rand() % n] ^= 1 + (rand() % 255);
+        memmove(rec1, rec0, n);
+        int rc0 = fec_rs_codec_decode(q0, rec0, _k);
+
+        for (level=LIQUID_SIMD_BASELINE+1; level<=host; level++) {
+            liquid_simd_set_level((liquid_simd_level)level);
+            fec_rs_codec q1 = fec_rs_codec_create(0x11d, 1, 1, _nroots);
+            fec_rs_codec_encode(q1, msg1, _k, &msg1[_k]);
+            CONTEND_SAME_DATA(msg0, msg1, n);
+
+            unsigned char rec[n];
+            memmove(rec, rec1, n);
+            int rc1 = fec_rs_codec_decode(q1, rec, _k);
+            CONTEND_EQUALITY(rc0, rc1);
+            CONTEND_SAME_DATA(rec0, rec, n);
+            fec_rs_codec_destroy(q1);
+        }
+    }
+    liquid_simd_set_level(host);
+
+    fec_rs_codec_destroy(q0);
+}
+
+void autotest_reedsolomon_kernels_r32_k223() { reedsolomon_test_kernels(32, 223); }
+void autotest_reedsolomon_kernels_r32_k1()   { reedsolomon_test_kernels(32,   1); }
+void autotest_reedsolomon_kernels_r16_k100() { reedsolomon_test_kernels(16, 100); }
+void autotest_reedsolomon_kernels_r7_k31()   { reedsolomon_test_kernels( 7,  31); }
+
+//
+// AUTOTEST: message split over several (shortened) blocks
+//
+void autotest_reedsolomon_1024()
+{
+    unsigned int dec_msg_len = 1024;
+
+    // five blocks of 205 data symbols plus 32 parity symbols
+    unsigned int enc_msg_len = fec_get_enc_msg_length(LIQUID_FEC_RS_M8,dec_msg_len);
+    CONTEND_EQUALITY( enc_msg_len, 1185 );
+
+    unsigned char msg_org[dec_msg_len]; // original message
+    unsigned char msg_enc[enc_msg_len]; // encoded message
+    unsigned char msg_dec[dec_msg_len]; // decoded message
+    unsigned int i;
+    for (i=0; i<dec_msg_len; i++)
+        msg_org[i] = rand() & 0xff;
+
+    fec q = fec_create(LIQUID_FEC_RS_M8,NULL);
+    fec_encode(q, dec_msg_len, msg_org, msg_enc);
+
+    // corrupt 16 symbols in each block of 237
+    unsigned int b;
+    for (b=0; b<5; b++) {
+        for (i=0; i<16; i++)
+            msg_enc[237*b + 14*i + b] ^= 0x5a + i;
+    }
+
+    fec_decode(q, dec_msg_len, msg_enc, msg_dec);
+    CONTEND_SAME_DATA(msg_org, msg_dec, dec_msg_len);
+
+    fec_destroy(q);
+}
@@ -31,30 +31,6 @@ void fec_test_soft_codec(fec_scheme _fs,
                          unsigned int _n,
                          void * _opts)
 {
-#if !LIBFEC_ENABLED
-    if ( _fs == LIQUID_FEC_CONV_V27    ||
-         _fs == LIQUID_FEC_CONV_V29    ||
-         _fs == LIQUID_FEC_CONV_V39    ||
-         _fs == LIQUID_FEC_CONV_V615   ||
-         _fs == LIQUID_FEC_CONV_V27P23 ||
-         _fs == LIQUID_FEC_CONV_V27P34 ||
-         _fs == LIQUID_FEC_CONV_V27P45 ||
-         _fs == LIQUID_FEC_CONV_V27P56 ||
-         _fs == LIQUID_FEC_CONV_V27P67 ||
-         _fs == LIQUID_FEC_CONV_V27P78 ||
-         _fs == LIQUID_FEC_CONV_V29P23 ||
-         _fs == LIQUID_FEC_CONV_V29P34 ||
-         _fs == LIQUID_FEC_CONV_V29P45 ||
-         _fs == LIQUID_FEC_CONV_V29P56 ||
-         _fs == LIQUID_FEC_CONV_V29P67 ||
-         _fs == LIQUID_FEC_CONV_V29P78 ||
-         _fs == LIQUID_FEC_RS_M8)
-    {
-        AUTOTEST_WARN("convolutional, Reed-Solomon codes unavailable (install libfec)\n");
-        return;
-    }
-#endif
-
     // generate fec object
     fec q = fec_create(_fs,_opts);
 
@@ -137,4 +113,10 @@ void autotest_fecsoft_v29p78() { fec_test_soft_codec(LIQUID_FEC_CONV_V29P78, 64,
 // Reed-Solomon block codes
 void autotest_fecsoft_rs8()    { fec_test_soft_codec(LIQUID_FEC_RS_M8,       64, NULL); }
 
+// LDPC block codes
+void autotest_fecsoft_ldpc12() { fec_test_soft_codec(LIQUID_FEC_LDPC_R12,    64, NULL); }
+void autotest_fecsoft_ldpc23() { fec_test_soft_codec(LIQUID_FEC_LDPC_R23,    64, NULL); }
+void autotest_fecsoft_ldpc34() { fec_test_soft_codec(LIQUID_FEC_LDPC_R34,    64, NULL); }
+void autotest_fecsoft_ldpc56() { fec_test_soft_codec(LIQUID_FEC_LDPC_R56,    64, NULL); }
+
 
@@ -21,6 +21,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "autotest/autotest.h"
 #include "liquid.h"
@@ -85,3 +86,110 @@ void autotest_interleaver_soft_16()     { interleaver_test_soft(16  ); }
 void autotest_interleaver_soft_64()     { interleaver_test_soft(64  ); }
 void autotest_interleaver_soft_256()    { interleaver_test_soft(256 ); }
 
+
+// 
+// AUTOTEST: interleaver output matches known permutation
+//
+void autotest_interleaver_hard_output()
+{
+    unsigned int i;
+    unsigned char x[16];
+    unsigned char y[16];
+    unsigned char y_test[16] = {
+        0x02, 0x07, 0x0c, 0x01, 0x06, 0x03, 0x0c, 0x0f,
+        0x0e, 0x05, 0x00, 0x09, 0x00, 0x0b, 0x0a, 0x0d};
+
+    for (i=0; i<16; i++)
+        x[i] = i;
+
+    interleaver q = interleaver_create(16);
+    interleaver_encode(q,x,y);
+    CONTEND_SAME_DATA(y, y_test, 16);
+
+    // in-place operation
+    interleaver_encode(q,x,x);
+    CONTEND_SAME_DATA(x, y_test, 16);
+
+    interleaver_destroy(q);
+}
+
+// 
+// AUTOTEST: soft-bit interleaver moves each bit as the hard interleaver
+//
+void interleaver_test_hard_soft(unsigned int _n,
+                                unsigned int _depth)
+{
+    unsigned int i;
+    unsigned int num_written;
+    unsigned char x[_n];
+    unsigned char y[_n];
+    unsigned char x_soft[8*_n];
+    unsigned char y_soft[8*_n];
+    unsigned char y_test[8*_n];
+
+    for (i=0; i<_n; i++)
+        x[i] = rand() & 0xFF;
+    liquid_unpack_bytes(x, _n, x_soft, 8*_n, &num_written);
+
+    interleaver q = interleaver_create(_n);
+    interleaver_set_depth(q, _depth);
+
+    interleaver_encode(q,x,y);
+    interleaver_encode_soft(q,x_soft,y_soft);
+    liquid_unpack_bytes(y, _n, y_test, 8*_n, &num_written);
+    CONTEND_SAME_DATA(y_soft, y_test, 8*_n);
+
+    interleaver_decode(q,x,y);
+    interleaver_decode_soft(q,x_soft,y_soft);
+    liquid_unpack_bytes(y, _n, y_test, 8*_n, &num_written);
+    CONTEND_SAME_DATA(y_soft, y_test, 8*_n);
+
+    interleaver_destroy(q);
+}
+
+void autotest_interleaver_hard_soft_d0()    { interleaver_test_hard_soft(37, 0); }
+void autotest_interleaver_hard_soft_d1()    { interleaver_test_hard_soft(37, 1); }
+void autotest_interleaver_hard_soft_d2()    { interleaver_test_hard_soft(37, 2); }
+void autotest_interleaver_hard_soft_d3()    { interleaver_test_hard_soft(37, 3); }
+void autotest_interleaver_hard_soft_d4()    { interleaver_test_hard_soft(37, 4); }
+
+// 
+// AUTOTEST: block of packets matches one packet at a time
+//
+void autotest_interleaver_block()
+{
+    unsigned int n = 301;           // bytes per packet (spans tiles)
+    unsigned int num_packets = 5;
+    unsigned int i;
+    unsigned char * x = (unsigned char*) malloc(8*n*num_packets);
+    unsigned char * y = (unsigned char*) malloc(8*n*num_packets);
+    unsigned char * z = (unsigned char*) malloc(8*n*num_packets);
+
+    for (i=0; i<8*n*num_packets; i++)
+        x[i] = rand() & 0xFF;
+
+    interleaver q = interleaver_create(n);
+
+    // hard
+    interleaver_encode_block(q, x, y, num_packets);
+    for (i=0; i<num_packets; i++)
+        interleaver_encode(q, x + i*n, z + i*n);
+    CONTEND_SAME_DATA(y, z, n*num_packets);
+
+    interleaver_decode_block(q, y, y, num_packets);
+    CONTEND_SAME_DATA(y, x, n*num_packets);
+
+    // soft
+    interleaver_encode_soft_block(q, x, y, num_packets);
+    for (i=0; i<num_packets; i++)
+        interleaver_encode_soft(q, x + 8*i*n, z + 8*i*n);
+    CONTEND_SAME_DATA(y, z, 8*n*num_packets);
+
+    interleaver_decode_soft_block(q, y, z, num_packets);
+    CONTEND_SAME_DATA(z, x, 8*n*num_packets);
+
+    interleaver_destroy(q);
+    free(x);
+    free(y);
+    free(z);
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_batch_benchmark.c : benchmark batches of same-size transforms
+//
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// helper function to keep code base small
+//  _nfft       :   transform size
+//  _howmany    :   number of transforms in batch
+//  _interleaved:   interleave input samples of successive transforms
+void fft_batch_runbench(struct rusage *     _start,
+                        struct rusage *     _finish,
+                        unsigned long int * _num_iterations,
+                        unsigned int        _nfft,
+                        unsigned int        _howmany,
+                        int                 _interleaved)
+{
+    unsigned int n = _nfft * _howmany;
+    float complex * x = (float complex *) malloc(n*sizeof(float complex));
+    float complex * y = (float complex *) malloc(n*sizeof(float complex));
+    fftplan q = _interleaved ?
+        fft_create_plan_batch(_nfft, _howmany, x, _howmany, 1, y, 1, _nfft, LIQUID_FFT_FORWARD, 0) :
+        fft_create_plan_batch(_nfft, _howmany, x, 1, _nfft,    y, 1, _nfft, LIQUID_FFT_FORWARD, 0);
+
+    unsigned long int i;
+    for (i=0; i<n; i++)
+        x[i] = randnf() + randnf()*_Complex_I;
+
+    // scale number of iterations to keep execution time
+    // relatively linear
+    *_num_iterations /= n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        fft_execute(q);
+        fft_execute(q);
+        fft_execute(q);
+        fft_execute(q);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 4;
+
+    fft_destroy_plan(q);
+    free(x);
+    free(y);
+}
+
+#define FFT_BATCH_BENCHMARK_API(NFFT,HOWMANY,INTERLEAVED)   \
+(   struct rusage *_start,                                  \
+    struct rusage *_finish,                                 \
+    unsigned long int *_num_iterations)                     \
+{ fft_batch_runbench(_start, _finish, _num_iterations, NFFT, HOWMANY, INTERLEAVED); }
+
+void benchmark_fft_batch_64x64          FFT_BATCH_BENCHMARK_API(  64, 64, 0)
+void benchmark_fft_batch_64x64_strided  FFT_BATCH_BENCHMARK_API(  64, 64, 1)
+void benchmark_fft_batch_1024x16        FFT_BATCH_BENCHMARK_API(1024, 16, 0)
+void benchmark_fft_batch_120x32         FFT_BATCH_BENCHMARK_API( 120, 32, 0)
+
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+//
+// fft_batch.c : many same-size transforms sharing one plan
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "liquid.internal.h"
+
+// create plan for many same-size complex transforms
+//  _nfft       :   transform size
+//  _howmany    :   number of transforms
+//  _x          :   input array
+//  _istride    :   stride between samples of one input transform
+//  _idist      :   distance between starts of successive input transforms
+//  _y          :   output array
+//  _ostride    :   stride between samples of one output transform
+//  _odist      :   distance between starts of successive output transforms
+//  _dir        :   fft direction: {LIQUID_FFT_FORWARD, LIQUID_FFT_BACKWARD}
+//  _flags      :   fft flags
+FFT(plan) FFT(_create_plan_batch)(unsigned int _nfft,
+                                  unsigned int _howmany,
+                                  TC *         _x,
+                                  unsigned int _istride,
+                                  unsigned int _idist,
+                                  TC *         _y,
+                                  unsigned int _ostride,
+                                  unsigned int _odist,
+                                  int          _dir,
+                                  int          _flags)
+{
+    // validate input
+    if (_nfft == 0) {
+        fprintf(stderr,"error: fft_create_plan_batch(), transform size must be greater than zero\n");
+        exit(1);
+    } else if (_howmany == 0) {
+        fprintf(stderr,"error: fft_create_plan_batch(), number of transforms must be greater than zero\n");
+        exit(1);
+    } else if (_istride == 0 || _ostride == 0) {
+        fprintf(stderr,"error: fft_create_plan_batch(), strides must be greater than zero\n");
+        exit(1);
+    }
+
+    // allocate plan
+    FFT(plan) q = (FFT(plan)) malloc(sizeof(struct FFT(plan_s)));
+
+    q->nfft      = _nfft;
+    q->x         = _x;
+    q->y         = _y;
+    q->flags     = _flags;
+    q->type      = (_dir == LIQUID_FFT_FORWARD) ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD;
+    q->direction = (_dir == LIQUID_FFT_FORWARD) ? LIQUID_FFT_FORWARD : LIQUID_FFT_BACKWARD;
+    q->method    = LIQUID_FFT_METHOD_BATCH;
+
+    q->execute   = FFT(_execute_batch);
+
+    // set batch layout
+    q->data.batch.howmany = _howmany;
+    q->data.batch.istride = _istride;
+    q->data.batch.idist   = _idist;
+    q->data.batch.ostride = _ostride;
+    q->data.batch.odist   = _odist;
+
+    // contiguous buffers for strided or aliased transforms
+    q->data.batch.t0 = (TC *) malloc(_nfft * sizeof(TC));
+    q->data.batch.t1 = (TC *) malloc(_nfft * sizeof(TC));
+
+    // single transform shared by the entire batch
+    q->data.batch.fft = FFT(_create_plan)(_nfft,
+                                          q->data.batch.t0,
+                                          q->data.batch.t1,
+                                          q->direction,
+                                          q->flags);
+    return q;
+}
+
+// destroy batch plan
+void FFT(_destroy_plan_batch)(FFT(plan) _q)
+{
+    // destroy sub-plan
+    FFT(_destroy_plan)(_q->data.batch.fft);
+
+    // free buffers
+    free(_q->data.batch.t0);
+    free(_q->data.batch.t1);
+
+    // free main object memory
+    free(_q);
+}
+
+// execute batch of transforms
+void FFT(_execute_batch)(FFT(plan) _q)
+{
+    unsigned int nfft    = _q->nfft;
+    unsigned int istride = _q->data.batch.istride;
+    unsigned int ostride = _q->data.batch.ostride;
+    TC * t0 = _q->data.batch.t0;
+    TC * t1 = _q->data.batch.t1;
+
+    // transforms read contiguous input in place unless the input is
+    // strided or overlaps the output
+    int gather  = istride != 1 || _q->x == _q->y;
+    int scatter = ostride != 1;
+
+    unsigned int i, k;
+    for (i=0; i<_q->data.batch.howmany; i++) {
+        TC * x = _q->x + i*_q->data.batch.idist;
+        TC * y = _q->y + i*_q->data.batch.odist;
+
+        if (gather) {
+            for (k=0; k<nfft; k++)
+                t0[k] = x[k*istride];
+        }
+
+        FFT(_execute_arrays)(_q->data.batch.fft,
+                             gather  ? t0 : x,
+                             scatter ? t1 : y);
+
+        if (scatter) {
+            for (k=0; k<nfft; k++)
+                y[k*ostride] = t1[k];
+        }
+    }
+}
@@ -58,7 +58,10 @@ struct FFT(plan_s)
         struct {
             unsigned int m;             // log2(nfft)
             unsigned int * index_rev;   // reversed indices
-            TC * twiddle;               // twiddle factors
+            TC * twiddle;               // per-stage twiddle factors
+#if LIQUID_SIMD_DISPATCH
+            liquid_simd_level level;    // butterfly kernel selection
+#endif
         } radix2;
 
         // recursive mixed-radix transform data:
@@ -97,6 +100,18 @@ struct FFT(plan_s)
             FFT(plan) fft;      // sub-FFT of size nfft_prime
             FFT(plan) ifft;     // sub-IFFT of size nfft_prime
         } rader2;
+
+        // batch of same-size transforms sharing one sub-plan
+        struct {
+            unsigned int howmany;   // number of transforms
+            unsigned int istride;   // input sample stride
+            unsigned int idist;     // input transform distance
+            unsigned int ostride;   // output sample stride
+            unsigned int odist;     // output transform distance
+            TC * t0;                // gathered input buffer
+            TC * t1;                // output buffer before scatter
+            FFT(plan) fft;          // sub-transform of size nfft
+        } batch;
     } data;
 };
 
@@ -160,6 +175,7 @@ void FFT(_destroy_plan)(FFT(plan) _q)
         case LIQUID_FFT_METHOD_MIXED_RADIX: FFT(_destroy_plan_mixed_radix)(_q); return;
         case LIQUID_FFT_METHOD_RADER:       FFT(_destroy_plan_rader)(_q);       return;
         case LIQUID_FFT_METHOD_RADER2:      FFT(_destroy_plan_rader2)(_q);      return;
+        case LIQUID_FFT_METHOD_BATCH:       FFT(_destroy_plan_batch)(_q);       return;
         case LIQUID_FFT_METHOD_UNKNOWN:
         default:
             fprintf(stderr,"error: fft_destroy_plan(), unknown/invalid fft method\n");
@@ -206,6 +222,7 @@ void FFT(_print_plan)(FFT(plan) _q)
         case LIQUID_FFT_METHOD_MIXED_RADIX: printf("Cooley-Tukey\n");       break;
         case LIQUID_FFT_METHOD_RADER:       printf("Rader (Type I)\n");     break;
         case LIQUID_FFT_METHOD_RADER2:      printf("Rader (Type II)\n");    break;
+        case LIQUID_FFT_METHOD_BATCH:       printf("batch\n");              break;
         case LIQUID_FFT_METHOD_UNKNOWN:
         default:
             fprintf(stderr,"error: fft_destroy_plan(), unknown/invalid fft method\n");
@@ -276,6 +293,11 @@ void FFT(_print_plan_recursive)(FFT(plan)    _q,
         FFT(_print_plan_recursive)(_q->data.rader2.fft, _level+1);
         break;
 
+    case LIQUID_FFT_METHOD_BATCH:
+        printf("batch, howmany=%u\n", _q->data.batch.howmany);
+        FFT(_print_plan_recursive)(_q->data.batch.fft, _level+1);
+        break;
+
     case LIQUID_FFT_METHOD_UNKNOWN:     printf("(unknown)\n");      break;
     default:                            printf("(unknown)\n");      break;
     }
@@ -288,6 +310,28 @@ void FFT(_execute)(FFT(plan) _q)
     _q->execute(_q);
 }
 
+// execute fft on new input/output arrays of the same size and layout
+// as those the plan was created with
+void FFT(_execute_arrays)(FFT(plan) _q,
+                          TC *      _x,
+                          TC *      _y)
+{
+    if (_q->type != LIQUID_FFT_FORWARD && _q->type != LIQUID_FFT_BACKWARD) {
+        fprintf(stderr,"error: fft_execute_arrays(), only complex transforms supported\n");
+        exit(1);
+    }
+
+    // sub-plans operate on internal buffers, so only the outer
+    // array pointers need to be replaced
+    TC * x = _q->x;
+    TC * y = _q->y;
+    _q->x = _x;
+    _q->y = _y;
+    _q->execute(_q);
+    _q->x = x;
+    _q->y = y;
+}
+
 // perform n-point FFT allocating plan internally
 //  _nfft   :   fft size
 //  _x      :   input array [size: _nfft x 1]
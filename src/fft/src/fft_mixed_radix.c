@@ -155,9 +155,15 @@ void FFT(_execute_mixed_radix)(FFT(plan) _q)
         // run internal P-point DFT
         FFT(_execute)(_q->data.mixedradix.fft_P);
 
-        // copy back to input, applying twiddle factors
-        for (k=0; k<P; k++)
-            x[Q*k+i] = t1[k] * twiddle[i*k];
+        // copy back to input, applying twiddle factors (explicit
+        // products avoid the library call for complex multiplication)
+        for (k=0; k<P; k++) {
+            T * v = (T*) &t1[k];
+            T * w = (T*) &twiddle[i*k];
+            T * r = (T*) &x[Q*k+i];
+            r[0] = v[0]*w[0] - v[1]*w[1];
+            r[1] = v[0]*w[1] + v[1]*w[0];
+        }
 
 #if FFT_DEBUG_MIXED_RADIX
         printf("i=%3u/%3u\n", i, Q);
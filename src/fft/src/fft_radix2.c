@@ -29,6 +29,25 @@
 #include <math.h>
 #include "liquid.internal.h"
 
+#if LIQUID_SIMD_DISPATCH
+#include <immintrin.h>  // AVX2 (selected at run time)
+#endif
+
+// forward declaration of internal methods
+void FFT(_radix2_stage2)(T * _y, unsigned int _nfft);
+void FFT(_radix2_stage4)(T *          _y,
+                         unsigned int _nfft,
+                         unsigned int _n1,
+                         const T *    _w,
+                         int          _forward);
+#if LIQUID_SIMD_DISPATCH
+void FFT(_radix2_stage4_avx2)(T *          _y,
+                              unsigned int _nfft,
+                              unsigned int _n1,
+                              const T *    _w,
+                              int          _forward);
+#endif
+
 // create FFT plan for regular DFT
 //  _nfft   :   FFT size
 //  _x      :   input array [size: _nfft x 1]
@@ -62,13 +81,31 @@ FFT(plan) FFT(_create_plan_radix2)(unsigned int _nfft,
     for (i=0; i<q->nfft; i++)
         q->data.radix2.index_rev[i] = fft_reverse_index(i,q->data.radix2.m);
 
-    // initialize twiddle factors
-    q->data.radix2.twiddle = (TC *) malloc(q->nfft * sizeof(TC));
+    // Butterflies are computed two radix-2 stages at a time (radix-4),
+    // preceded by a single radix-2 stage when m is odd. Each radix-4
+    // stage with quarter-span n1 stores its twiddle factors contiguously
+    // as w1[j] = W(2*n1)^j followed by w2[j] = W(4*n1)^j for j < n1.
+    unsigned int n1;
+    unsigned int twiddle_len = 0;
+    for (n1 = (q->data.radix2.m % 2) ? 2 : 1; 4*n1 <= q->nfft; n1 *= 4)
+        twiddle_len += 2*n1;
+    q->data.radix2.twiddle = (TC *) malloc((twiddle_len+1) * sizeof(TC));
     
-    T d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
-    for (i=0; i<q->nfft; i++)
-        q->data.radix2.twiddle[i] = cexpf(_Complex_I*d*2*M_PI*(T)i / (T)(q->nfft));
+    double d = (q->direction == LIQUID_FFT_FORWARD) ? -1.0 : 1.0;
+    T * w = (T*) q->data.radix2.twiddle;
+    for (n1 = (q->data.radix2.m % 2) ? 2 : 1; 4*n1 <= q->nfft; n1 *= 4) {
+        for (i=0; i<n1; i++) {
+            w[2*i        ] = (T) cos(d*M_PI*(double)i/(double)n1);
+            w[2*i+1      ] = (T) sin(d*M_PI*(double)i/(double)n1);
+            w[2*(i+n1)   ] = (T) cos(d*0.5*M_PI*(double)i/(double)n1);
+            w[2*(i+n1)+1 ] = (T) sin(d*0.5*M_PI*(double)i/(double)n1);
+        }
+        w += 4*n1;
+    }
 
+#if LIQUID_SIMD_DISPATCH
+    q->data.radix2.level = liquid_simd_get_level();
+#endif
     return q;
 }
 
@@ -86,52 +123,161 @@ void FFT(_destroy_plan_radix2)(FFT(plan) _q)
 // execute radix-2 FFT
 void FFT(_execute_radix2)(FFT(plan) _q)
 {
-    // swap values
-    unsigned int i,j,k;
-
-    // unroll loop
-    unsigned int nfft4 = (_q->nfft>>2)<<2;  // floor(_nfft/4)
-    for (i=0; i<nfft4; i+=4) {
-        _q->y[i  ] = _q->x[ _q->data.radix2.index_rev[i  ] ];
-        _q->y[i+1] = _q->x[ _q->data.radix2.index_rev[i+1] ];
-        _q->y[i+2] = _q->x[ _q->data.radix2.index_rev[i+2] ];
-        _q->y[i+3] = _q->x[ _q->data.radix2.index_rev[i+3] ];
+    unsigned int nfft = _q->nfft;
+    unsigned int * index_rev = _q->data.radix2.index_rev;
+    unsigned int i;
+
+    // bit-reversed permutation, swapping in place if arrays alias
+    if (_q->x == _q->y) {
+        TC v;
+        for (i=0; i<nfft; i++) {
+            if (i < index_rev[i]) {
+                v                   = _q->y[i];
+                _q->y[i]            = _q->y[index_rev[i]];
+                _q->y[index_rev[i]] = v;
+            }
+        }
+    } else {
+        for (i=0; i<nfft; i++)
+            _q->y[i] = _q->x[ index_rev[i] ];
     }
 
-#if 0
-    // clean up remaining
-    // NOTE : this only happens when _nfft=2 because we know (_nfft%4)==0 otherwise
-    for ( ; i<_q->nfft; i++)
-        _q->y[i] = _q->x[ _q->data.radix2.index_rev[i] ];
+    // butterflies operate on interleaved real/imaginary components
+    T * y = (T*) _q->y;
+    const T * w = (const T*) _q->data.radix2.twiddle;
+    int forward = _q->direction == LIQUID_FFT_FORWARD;
+
+    unsigned int n1 = 1;
+    if (_q->data.radix2.m % 2) {
+        FFT(_radix2_stage2)(y, nfft);
+        n1 = 2;
+    }
+
+    for ( ; 4*n1 <= nfft; n1 *= 4) {
+#if LIQUID_SIMD_DISPATCH
+        if (n1 >= 4 && _q->data.radix2.level >= LIQUID_SIMD_AVX2)
+            FFT(_radix2_stage4_avx2)(y, nfft, n1, w, forward);
+        else
 #endif
+        FFT(_radix2_stage4)(y, nfft, n1, w, forward);
+        w += 4*n1;
+    }
+}
 
-    TC yp;
-    TC *y=_q->y;
-    unsigned int n1 = 0;
-    unsigned int n2 = 1;
+// first radix-2 stage (unity twiddle factors)
+void FFT(_radix2_stage2)(T * _y, unsigned int _nfft)
+{
+    unsigned int k;
+    for (k=0; k<2*_nfft; k+=4) {
+        T ar = _y[k  ], ai = _y[k+1];
+        T br = _y[k+2], bi = _y[k+3];
+        _y[k  ] = ar + br;  _y[k+1] = ai + bi;
+        _y[k+2] = ar - br;  _y[k+3] = ai - bi;
+    }
+}
 
-    TC t;   // twiddle value
-    unsigned int stride = _q->nfft;
-    unsigned int twiddle_index;
+// radix-4 stage combining the radix-2 stages of span 2*_n1 and 4*_n1
+//  _y          :   interleaved transform data [size: 2*_nfft x 1]
+//  _nfft       :   transform size
+//  _n1         :   quarter span of butterfly
+//  _w          :   stage twiddle factors [size: 4*_n1 x 1]
+//  _forward    :   forward transform flag
+void FFT(_radix2_stage4)(T *          _y,
+                         unsigned int _nfft,
+                         unsigned int _n1,
+                         const T *    _w,
+                         int          _forward)
+{
+    const T * w1 = _w;
+    const T * w2 = _w + 2*_n1;
+    unsigned int j, k;
+    for (k=0; k<_nfft; k+=4*_n1) {
+        T * a = _y + 2*k;
+        T * b = a + 2*_n1;
+        T * c = b + 2*_n1;
+        T * d = c + 2*_n1;
+        for (j=0; j<2*_n1; j+=2) {
+            // first radix-2 layer: a +/- w1*b, c +/- w1*d
+            T br = b[j]*w1[j  ] - b[j+1]*w1[j+1];
+            T bi = b[j]*w1[j+1] + b[j+1]*w1[j  ];
+            T dr = d[j]*w1[j  ] - d[j+1]*w1[j+1];
+            T di = d[j]*w1[j+1] + d[j+1]*w1[j  ];
+            T a0r = a[j] + br,  a0i = a[j+1] + bi;
+            T b0r = a[j] - br,  b0i = a[j+1] - bi;
+            T c0r = c[j] + dr,  c0i = c[j+1] + di;
+            T d0r = c[j] - dr,  d0i = c[j+1] - di;
 
-    for (i=0; i<_q->data.radix2.m; i++) {
-        n1 = n2;
-        n2 *= 2;
-        stride >>= 1;
+            // second radix-2 layer: twiddle for the odd pair is
+            // w2*W(4)^1, i.e. a rotation by -j (forward) or +j
+            T tr = c0r*w2[j  ] - c0i*w2[j+1];
+            T ti = c0r*w2[j+1] + c0i*w2[j  ];
+            T ur = d0r*w2[j  ] - d0i*w2[j+1];
+            T ui = d0r*w2[j+1] + d0i*w2[j  ];
+            T vr = _forward ?  ui : -ui;
+            T vi = _forward ? -ur :  ur;
 
-        twiddle_index = 0;
-    
-        for (j=0; j<n1; j++) {
-            t = _q->data.radix2.twiddle[twiddle_index];
-            twiddle_index = (twiddle_index + stride) % _q->nfft;
-
-            for (k=j; k<_q->nfft; k+=n2) {
-                // NOTE: most computation is with the multiplication in next line
-                yp      =  y[k+n1]*t;
-                y[k+n1] =  y[k] - yp;
-                y[k]    += yp;
-            }
+            a[j] = a0r + tr;    a[j+1] = a0i + ti;
+            c[j] = a0r - tr;    c[j+1] = a0i - ti;
+            b[j] = b0r + vr;    b[j+1] = b0i + vi;
+            d[j] = b0r - vr;    d[j+1] = b0i - vi;
         }
     }
 }
 
+#if LIQUID_SIMD_DISPATCH
+// multiply interleaved complex values
+__attribute__((target("avx2,fma"), always_inline))
+static inline __m256 FFT(_cmul_avx2)(__m256 _x, __m256 _w)
+{
+    __m256 wr = _mm256_moveldup_ps(_w);
+    __m256 wi = _mm256_movehdup_ps(_w);
+    __m256 xs = _mm256_permute_ps(_x, _MM_SHUFFLE(2,3,0,1));
+    return _mm256_fmaddsub_ps(_x, wr, _mm256_mul_ps(xs, wi));
+}
+
+// radix-4 stage operating on four complex values per register; _n1
+// must be a multiple of four
+__attribute__((target("avx2,fma")))
+void FFT(_radix2_stage4_avx2)(T *          _y,
+                              unsigned int _nfft,
+                              unsigned int _n1,
+                              const T *    _w,
+                              int          _forward)
+{
+    const T * w1 = _w;
+    const T * w2 = _w + 2*_n1;
+
+    // rotation by -j (forward) or +j: swap components, negate one
+    __m256 sign = _forward ? _mm256_setr_ps(0.f,-0.f,0.f,-0.f,0.f,-0.f,0.f,-0.f)
+                           : _mm256_setr_ps(-0.f,0.f,-0.f,0.f,-0.f,0.f,-0.f,0.f);
+    unsigned int j, k;
+    for (k=0; k<_nfft; k+=4*_n1) {
+        T * a = _y + 2*k;
+        T * b = a + 2*_n1;
+        T * c = b + 2*_n1;
+        T * d = c + 2*_n1;
+        for (j=0; j<2*_n1; j+=8) {
+            __m256 vw1 = _mm256_loadu_ps(w1 + j);
+            __m256 vw2 = _mm256_loadu_ps(w2 + j);
+            __m256 va  = _mm256_loadu_ps(a + j);
+            __m256 vb  = FFT(_cmul_avx2)(_mm256_loadu_ps(b + j), vw1);
+            __m256 vc  = _mm256_loadu_ps(c + j);
+            __m256 vd  = FFT(_cmul_avx2)(_mm256_loadu_ps(d + j), vw1);
+
+            __m256 a0 = _mm256_add_ps(va, vb);
+            __m256 b0 = _mm256_sub_ps(va, vb);
+            __m256 c0 = _mm256_add_ps(vc, vd);
+            __m256 d0 = _mm256_sub_ps(vc, vd);
+
+            __m256 t = FFT(_cmul_avx2)(c0, vw2);
+            __m256 u = FFT(_cmul_avx2)(d0, vw2);
+            __m256 v = _mm256_xor_ps(_mm256_permute_ps(u, _MM_SHUFFLE(2,3,0,1)), sign);
+
+            _mm256_storeu_ps(a + j, _mm256_add_ps(a0, t));
+            _mm256_storeu_ps(c + j, _mm256_sub_ps(a0, t));
+            _mm256_storeu_ps(b + j, _mm256_add_ps(b0, v));
+            _mm256_storeu_ps(d + j, _mm256_sub_ps(b0, v));
+        }
+    }
+}
+#endif
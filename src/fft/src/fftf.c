@@ -44,4 +44,5 @@
 #include "fft_rader.c"          // FFT definitions for transforms of prime length (Rader's algorithm)
 #include "fft_rader2.c"         // FFT definitions for transforms of prime length (Rader's alternate algorithm)
 #include "fft_r2r_1d.c"         // real-to-real definitions (DCT/DST)
+#include "fft_batch.c"          // batches of same-size transforms
 
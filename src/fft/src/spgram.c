@@ -279,17 +279,22 @@ void SPGRAM(_accumulate_psd)(SPGRAM()     _q,
         exit(1);
     }
 
-    // push samples and run FFT at appropriate time
-    unsigned int i;
-    for (i=0; i<_n; i++) {
-        // push sample
-        WINDOW(_push)(_q->buffer, _x[i]);
+    // write samples in blocks and run FFT at appropriate time
+    unsigned int delay = _q->window_len/2;
+    unsigned int i = 0;
+    while (i < _n) {
+        // write samples up to next transform
+        unsigned int num_write = _n - i;
+        if (_q->sample_counter < delay && delay - _q->sample_counter < num_write)
+            num_write = delay - _q->sample_counter;
+        WINDOW(_write)(_q->buffer, _x + i, num_write);
+        i += num_write;
 
         // increment counter
-        _q->sample_counter++;
+        _q->sample_counter += num_write;
 
         // run FFT
-        if (_q->sample_counter == _q->window_len/2) {
+        if (_q->sample_counter == delay) {
             // override alpha for first transform
             if (_q->num_transforms==0)
                 _alpha = 1.0f;
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// fft_batch_autotest.c : test batched transforms and new-array execution
+//
+
+#include <stdlib.h>
+#include <math.h>
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// compare transform of large radix-2 size against direct DFT
+void fft_radix2_large_test(unsigned int _n)
+{
+    float complex * x = (float complex*) malloc(_n*sizeof(float complex));
+    float complex * y = (float complex*) malloc(_n*sizeof(float complex));
+    float complex * z = (float complex*) malloc(_n*sizeof(float complex));
+
+    unsigned int i, k;
+    for (i=0; i<_n; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    fft_run(_n, x, y, LIQUID_FFT_FORWARD, 0);
+    fft_run(_n, y, z, LIQUID_FFT_BACKWARD, 0);
+
+    // direct DFT in double precision (output bins subsampled)
+    float tol = 2e-3f * sqrtf((float)_n);
+    for (k=0; k<_n; k+=13) {
+        double complex v = 0;
+        for (i=0; i<_n; i++)
+            v += x[i] * cexp(-_Complex_I*2*M_PI*(double)((i*k)%_n)/(double)_n);
+        CONTEND_DELTA( cabs(y[k] - v), 0, tol );
+    }
+
+    // inverse recovers input
+    for (i=0; i<_n; i++)
+        CONTEND_DELTA( cabsf(z[i]/(float)_n - x[i]), 0, 1e-4f );
+
+    free(x);
+    free(y);
+    free(z);
+}
+
+void autotest_fft_radix2_1024() { fft_radix2_large_test(1024); }
+void autotest_fft_radix2_2048() { fft_radix2_large_test(2048); }
+
+// same plan executed on different arrays (including in place)
+void autotest_fft_execute_arrays()
+{
+    unsigned int n = 256;
+    float complex x0[n], x1[n], y0[n], y1[n], ref[n];
+    unsigned int i;
+    for (i=0; i<n; i++) {
+        x0[i] = randnf() + _Complex_I*randnf();
+        x1[i] = randnf() + _Complex_I*randnf();
+    }
+
+    fftplan q = fft_create_plan(n, x0, y0, LIQUID_FFT_FORWARD, 0);
+    fft_execute_arrays(q, x1, y1);
+    fft_run(n, x1, ref, LIQUID_FFT_FORWARD, 0);
+    CONTEND_SAME_DATA(y1, ref, n*sizeof(float complex));
+
+    // in-place on new array
+    fft_execute_arrays(q, x1, x1);
+    CONTEND_SAME_DATA(x1, ref, n*sizeof(float complex));
+
+    // original arrays remain bound to plan
+    fft_execute(q);
+    fft_run(n, x0, ref, LIQUID_FFT_FORWARD, 0);
+    CONTEND_SAME_DATA(y0, ref, n*sizeof(float complex));
+
+    fft_destroy_plan(q);
+}
+
+// helper: run batch and compare against individual transforms
+//  _n          :   transform size
+//  _howmany    :   number of transforms
+//  _istride    :   input stride
+//  _idist      :   input distance
+//  _ostride    :   output stride
+//  _odist      :   output distance
+//  _inplace    :   input and output share memory
+void fft_batch_test(unsigned int _n,
+                    unsigned int _howmany,
+                    unsigned int _istride,
+                    unsigned int _idist,
+                    unsigned int _ostride,
+                    unsigned int _odist,
+                    int          _inplace)
+{
+    unsigned int ilen = (_howmany-1)*_idist + (_n-1)*_istride + 1;
+    unsigned int olen = (_howmany-1)*_odist + (_n-1)*_ostride + 1;
+    unsigned int len  = ilen > olen ? ilen : olen;
+    float complex * x = (float complex*) malloc(len*sizeof(float complex));
+    float complex * y = _inplace ? x : (float complex*) malloc(len*sizeof(float complex));
+    float complex * c = (float complex*) malloc(len*sizeof(float complex));
+    float complex t[_n], ref[_n];
+
+    unsigned int i, k;
+    for (i=0; i<len; i++)
+        x[i] = c[i] = randnf() + _Complex_I*randnf();
+
+    fftplan q = fft_create_plan_batch(_n, _howmany, x, _istride, _idist,
+                                      y, _ostride, _odist, LIQUID_FFT_BACKWARD, 0);
+    fft_execute(q);
+    fft_destroy_plan(q);
+
+    for (i=0; i<_howmany; i++) {
+        for (k=0; k<_n; k++)
+            t[k] = c[i*_idist + k*_istride];
+        fft_run(_n, t, ref, LIQUID_FFT_BACKWARD, 0);
+        for (k=0; k<_n; k++)
+            CONTEND_DELTA( cabsf(y[i*_odist + k*_ostride] - ref[k]), 0, 1e-5f );
+    }
+
+    free(x);
+    if (!_inplace) free(y);
+    free(c);
+}
+
+void autotest_fft_batch_contiguous()  { fft_batch_test( 64,  7,  1, 64,  1, 64, 0); }
+void autotest_fft_batch_inplace()     { fft_batch_test(128,  5,  1,128,  1,128, 1); }
+void autotest_fft_batch_strided()     { fft_batch_test( 30,  4,  4,  1,  1, 30, 0); }
+void autotest_fft_batch_transpose()   { fft_batch_test( 17,  6,  1, 17,  6,  1, 0); }
+void autotest_fft_batch_padded()      { fft_batch_test( 32,  3,  2, 80,  3,100, 0); }
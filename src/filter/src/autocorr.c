@@ -48,6 +48,13 @@ struct AUTOCORR(_s) {
     float * we2;        // energy buffer
     float e2_sum;       // running sum of energy
     unsigned int ie2;   // read index
+
+    // block execution: the auto-correlation is the windowed sum of
+    // lagged products x(n)*conj(x(n-delay)), computed with a block
+    // dot product against a vector of ones
+    DOTPROD() dp;               // windowed sum
+    TI * xprod;                 // lagged products buffer
+    unsigned int xprod_len;     // allocated length of lagged products
 };
 
 // create auto-correlator object                            
@@ -70,6 +77,18 @@ AUTOCORR() AUTOCORR(_create)(unsigned int _window_size,
     // allocate array for squared energy buffer
     q->we2 = (float*) malloc( (q->window_size)*sizeof(float) );
 
+    // create dot product object for windowed sum
+    TC * h = (TC*) malloc(q->window_size*sizeof(TC));
+    unsigned int i;
+    for (i=0; i<q->window_size; i++)
+        h[i] = 1.0f;
+    q->dp = DOTPROD(_create)(h, q->window_size);
+    free(h);
+
+    // lagged products buffer is allocated as needed
+    q->xprod     = NULL;
+    q->xprod_len = 0;
+
     // clear object
     AUTOCORR(_reset)(q);
 
@@ -87,6 +106,10 @@ void AUTOCORR(_destroy)(AUTOCORR() _q)
     // free array for squared energy buffer
     free(_q->we2);
 
+    // destroy block execution objects
+    DOTPROD(_destroy)(_q->dp);
+    free(_q->xprod);
+
     // free main object memory
     free(_q);
 }
@@ -154,14 +177,38 @@ void AUTOCORR(_execute_block)(AUTOCORR()   _q,
                               unsigned int _n,
                               TO *         _rxx)
 {
+    if (_n == 0)
+        return;
+
+    // grow lagged products buffer if necessary (never shrinks)
+    unsigned int len = _q->window_size - 1 + _n;
+    if (len > _q->xprod_len) {
+        _q->xprod_len = len;
+        _q->xprod = (TI*) realloc(_q->xprod, _q->xprod_len*sizeof(TI));
+    }
+
+    // read buffers; set internal pointers appropriately
+    TI * rw;        // input buffer read pointer
+    TC * rwdelay;   // input buffer read pointer (with delay)
+    WINDOW(_read)(_q->w,      &rw     );
+    WINDOW(_read)(_q->wdelay, &rwdelay);
+
+    // lagged products currently in the window (all but the oldest)
     unsigned int i;
+    for (i=1; i<_q->window_size; i++)
+        _q->xprod[i-1] = rw[i] * rwdelay[i];
+
+    // push input samples, appending new lagged products; inputs
+    // are consumed before any output is written as the arrays may
+    // be the same
     for (i=0; i<_n; i++) {
-        // push input sample into auto-correlator
         AUTOCORR(_push)(_q, _x[i]);
-
-        // compute output
-        AUTOCORR(_execute)(_q, &_rxx[i]);
+        WINDOW(_read)(_q->wdelay, &rwdelay);
+        _q->xprod[_q->window_size - 1 + i] = _x[i] * rwdelay[_q->window_size-1];
     }
+
+    // compute windowed sums for all outputs at once
+    DOTPROD(_execute_block)(_q->dp, _q->xprod, 1, _n, _rxx);
 }
 
 // return sum of squares of buffered samples
@@ -36,7 +36,13 @@ struct FIRDECIM(_s) {
     unsigned int h_len; // number of coefficients
     unsigned int M;     // decimation factor
 
-    WINDOW() w;         // buffer
+    // use array as internal buffer so that blocks of samples can
+    // be appended and filtered without per-sample pushes
+    TI * w;                 // internal buffer
+    unsigned int w_len;     // buffer length (power of two)
+    unsigned int w_mask;    // buffer index mask
+    unsigned int w_index;   // buffer read index
+
     DOTPROD() dp;       // vector dot product
 };
 
@@ -69,8 +75,12 @@ FIRDECIM() FIRDECIM(_create)(unsigned int _M,
     for (i=0; i<q->h_len; i++)
         q->h[i] = _h[_h_len-i-1];
 
-    // create window (internal buffer)
-    q->w = WINDOW(_create)(q->h_len);
+    // initialize array for buffering, leaving room for several
+    // decimated outputs before the read index wraps around
+    q->w_len   = 1<<liquid_msb_index(q->h_len + 4*q->M);
+    q->w_mask  = q->w_len - 1;
+    q->w       = (TI *) malloc((q->w_len + q->h_len + 1)*sizeof(TI));
+    q->w_index = 0;
 
     // create dot product object
     q->dp = DOTPROD(_create)(q->h, q->h_len);
@@ -162,7 +172,7 @@ FIRDECIM() FIRDECIM(_create_prototype)(int          _type,
 // destroy decimator object
 void FIRDECIM(_destroy)(FIRDECIM() _q)
 {
-    WINDOW(_destroy)(_q->w);
+    free(_q->w);
     DOTPROD(_destroy)(_q->dp);
     free(_q->h);
     free(_q);
@@ -173,13 +183,21 @@ void FIRDECIM(_print)(FIRDECIM() _q)
 {
     printf("FIRDECIM() [%u] :\n", _q->M);
     printf("  window:\n");
-    WINDOW(_print)(_q->w);
+    unsigned int i;
+    for (i=0; i<_q->h_len; i++) {
+        printf("  %4u", i);
+        PRINTVAL_TI(_q->w[_q->w_index + i],%12.8f);
+        printf("\n");
+    }
 }
 
 // clear decimator object
 void FIRDECIM(_clear)(FIRDECIM() _q)
 {
-    WINDOW(_clear)(_q->w);
+    unsigned int i;
+    for (i=0; i<_q->w_len + _q->h_len + 1; i++)
+        _q->w[i] = 0.0;
+    _q->w_index = 0;
 }
 
 // execute decimator
@@ -190,18 +208,21 @@ void FIRDECIM(_execute)(FIRDECIM() _q,
                         TI *       _x,
                         TO *       _y)
 {
-    TI * r; // read pointer
     unsigned int i;
     for (i=0; i<_q->M; i++) {
-        WINDOW(_push)(_q->w, _x[i]);
+        // increment index, wrapping around pointer
+        _q->w_index = (_q->w_index + 1) & _q->w_mask;
 
-        if (i==0) {
-            // read buffer (retrieve pointer to aligned memory array)
-            WINDOW(_read)(_q->w, &r);
+        // if pointer wraps around, copy excess memory
+        if (_q->w_index == 0)
+            memmove(_q->w, _q->w + _q->w_len, (_q->h_len)*sizeof(TI));
 
-            // execute dot product
-            DOTPROD(_execute)(_q->dp, r, _y);
-        }
+        // append value to end of buffer
+        _q->w[_q->w_index + _q->h_len - 1] = _x[i];
+
+        // execute dot product
+        if (i==0)
+            DOTPROD(_execute)(_q->dp, _q->w + _q->w_index, _y);
     }
 }
 
@@ -215,10 +236,31 @@ void FIRDECIM(_execute_block)(FIRDECIM()   _q,
                               unsigned int _n,
                               TO *         _y)
 {
-    unsigned int i;
-    for (i=0; i<_n; i++) {
-        // execute _M input samples computing just one output each time
-        FIRDECIM(_execute)(_q, &_x[i*_q->M], &_y[i]);
+    while (_n > 0) {
+        // number of outputs whose _M input samples can be appended
+        // to the buffer before the read index wraps around
+        unsigned int m = (_q->w_mask - _q->w_index) / _q->M;
+
+        if (m == 0) {
+            // execute _M input samples (wrapping buffer)
+            FIRDECIM(_execute)(_q, _x, _y);
+            m = 1;
+        } else {
+            if (m > _n) m = _n;
+
+            // append samples to end of buffer
+            memmove(_q->w + _q->w_index + _q->h_len, _x, m*_q->M*sizeof(TI));
+
+            // compute all outputs at once, stepping _M samples through
+            // the buffer for each
+            DOTPROD(_execute_block)(_q->dp, _q->w + _q->w_index + 1, _q->M, m, _y);
+            _q->w_index += m*_q->M;
+        }
+
+        // update pointers, counter
+        _x += m*_q->M;
+        _y += m;
+        _n -= m;
     }
 }
 
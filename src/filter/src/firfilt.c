@@ -54,6 +54,15 @@ struct FIRFILT(_s) {
 #endif
     DOTPROD() dp;           // dot product object
     TC scale;               // output scaling factor
+
+#if TI_COMPLEX
+    // split-complex (planar) buffers: the last h_len-1 samples of the
+    // internal buffer followed by a segment of new input samples
+    float * wsi;            // real part [size: h_len-1 + ws_len x 1]
+    float * wsq;            // imaginary part [size: h_len-1 + ws_len x 1]
+    TO * ys;                // segment output [size: ws_len x 1]
+    unsigned int ws_len;    // segment length
+#endif
 };
 
 // create firfilt object
@@ -84,6 +93,14 @@ FIRFILT() FIRFILT(_create)(TC * _h,
     q->w_index = 0;
 #endif
 
+#if TI_COMPLEX
+    // initialize split-complex buffers
+    q->ws_len = 1<<liquid_msb_index(4*q->h_len);
+    q->wsi    = (float*) malloc((q->h_len - 1 + q->ws_len)*sizeof(float));
+    q->wsq    = (float*) malloc((q->h_len - 1 + q->ws_len)*sizeof(float));
+    q->ys     = (TO*)    malloc((q->ws_len)*sizeof(TO));
+#endif
+
     // load filter in reverse order
     unsigned int i;
     for (i=_n; i>0; i--)
@@ -222,6 +239,15 @@ FIRFILT() FIRFILT(_recreate)(FIRFILT() _q,
         _q->w_mask  = _q->w_len - 1;
         _q->w       = (TI *) malloc((_q->w_len + _q->h_len + 1)*sizeof(TI));
         _q->w_index = 0;
+        memset(_q->w, 0x00, _q->w_len*sizeof(TI));
+#endif
+
+#if TI_COMPLEX
+        // re-allocate split-complex buffers
+        _q->ws_len = 1<<liquid_msb_index(4*_q->h_len);
+        _q->wsi    = (float*) realloc(_q->wsi, (_q->h_len - 1 + _q->ws_len)*sizeof(float));
+        _q->wsq    = (float*) realloc(_q->wsq, (_q->h_len - 1 + _q->ws_len)*sizeof(float));
+        _q->ys     = (TO*)    realloc(_q->ys,  (_q->ws_len)*sizeof(TO));
 #endif
     }
 
@@ -243,6 +269,11 @@ void FIRFILT(_destroy)(FIRFILT() _q)
     WINDOW(_destroy)(_q->w);
 #else
     free(_q->w);
+#endif
+#if TI_COMPLEX
+    free(_q->wsi);
+    free(_q->wsq);
+    free(_q->ys);
 #endif
     DOTPROD(_destroy)(_q->dp);
     free(_q->h);
@@ -348,6 +379,7 @@ void FIRFILT(_execute_block)(FIRFILT()    _q,
                              unsigned int _n,
                              TO *         _y)
 {
+#if LIQUID_FIRFILT_USE_WINDOW
     unsigned int i;
     for (i=0; i<_n; i++) {
         // push sample into filter
@@ -356,7 +388,102 @@ void FIRFILT(_execute_block)(FIRFILT()    _q,
         // compute output sample
         FIRFILT(_execute)(_q, &_y[i]);
     }
+#else
+    unsigned int i;
+    while (_n > 0) {
+        // number of samples which can be appended to the buffer
+        // before the read index wraps around
+        unsigned int m = _q->w_mask - _q->w_index;
+
+        if (m == 0) {
+            // push single sample (wrapping buffer) and compute output
+            FIRFILT(_push)(_q, _x[0]);
+            FIRFILT(_execute)(_q, &_y[0]);
+            m = 1;
+        } else {
+            if (m > _n) m = _n;
+
+            // append samples to end of buffer; this must happen before
+            // any output is written as the arrays may be the same
+            memmove(_q->w + _q->w_index + _q->h_len, _x, m*sizeof(TI));
+
+            // compute all outputs at once from contiguous buffer
+            DOTPROD(_execute_block)(_q->dp, _q->w + _q->w_index + 1, 1, m, _y);
+            _q->w_index += m;
+
+            // apply scaling factor
+            for (i=0; i<m; i++)
+                _y[i] *= _q->scale;
+        }
+
+        // update pointers, counter
+        _x += m;
+        _y += m;
+        _n -= m;
+    }
+#endif
+}
+
+#if TI_COMPLEX
+// execute the filter on a block of split-complex (planar) input
+// samples; the internal buffer is shared with the interleaved
+// methods, and the input and output arrays may be the same
+//  _q      :   filter object
+//  _xi     :   input array, real part [size: _n x 1]
+//  _xq     :   input array, imaginary part [size: _n x 1]
+//  _n      :   number of input, output samples
+//  _yi     :   output array, real part [size: _n x 1]
+//  _yq     :   output array, imaginary part [size: _n x 1]
+void FIRFILT(_execute_block_split)(FIRFILT()    _q,
+                                   float *      _xi,
+                                   float *      _xq,
+                                   unsigned int _n,
+                                   float *      _yi,
+                                   float *      _yq)
+{
+    unsigned int h = _q->h_len - 1;  // number of history samples
+    unsigned int i;
+    while (_n > 0) {
+        // number of samples to process in this segment
+        unsigned int m = _n < _q->ws_len ? _n : _q->ws_len;
+
+        // read internal buffer (most recent h_len samples)
+        TI * r;
+#if LIQUID_FIRFILT_USE_WINDOW
+        WINDOW(_read)(_q->w, &r);
+#else
+        r = _q->w + _q->w_index;
+#endif
+
+        // split history, then append new samples
+        liquid_vectorcf_split(r + 1, h, _q->wsi, _q->wsq);
+        memmove(_q->wsi + h, _xi, m*sizeof(float));
+        memmove(_q->wsq + h, _xq, m*sizeof(float));
+
+        // push new samples into internal buffer; this must happen
+        // before any output is written as the arrays may be the same.
+        // Only the last h_len samples can affect the buffer's state.
+        for (i = m > _q->h_len ? m - _q->h_len : 0; i<m; i++)
+            FIRFILT(_push)(_q, _xi[i] + _Complex_I*_xq[i]);
+
+        // compute all outputs at once from planar buffers
+        TO * y = _q->ys;
+        DOTPROD(_execute_block_split)(_q->dp, _q->wsi, _q->wsq, 1, m, y);
+        for (i=0; i<m; i++) {
+            y[i] *= _q->scale;
+            _yi[i] = crealf(y[i]);
+            _yq[i] = cimagf(y[i]);
+        }
+
+        // update pointers, counter
+        _xi += m;
+        _xq += m;
+        _yi += m;
+        _yq += m;
+        _n  -= m;
+    }
 }
+#endif
 
 // get filter length
 unsigned int FIRFILT(_get_length)(FIRFILT() _q)
@@ -344,3 +344,27 @@ void FIRPFB(_execute)(FIRPFB()     _q,
     *_y *= _q->scale;
 }
 
+// execute the filter on an external buffer
+//  _q      : firpfb object
+//  _i      : index of filter to use
+//  _x      : most recent h_sub_len input samples, oldest first
+//  _y      : pointer to output sample
+void FIRPFB(_execute_buffer)(FIRPFB()     _q,
+                             unsigned int _i,
+                             TI *         _x,
+                             TO *         _y)
+{
+    // validate input
+    if (_i >= _q->num_filters) {
+        fprintf(stderr,"error: firpfb_execute_buffer(), filterbank index (%u) exceeds maximum (%u)\n",
+                _i, _q->num_filters);
+        exit(1);
+    }
+
+    // execute dot product
+    DOTPROD(_execute)(_q->dp[_i], _x, _y);
+
+    // apply scaling factor
+    *_y *= _q->scale;
+}
+
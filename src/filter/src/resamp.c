@@ -42,6 +42,16 @@
 // internal: update timing
 void RESAMP(_update_timing_state)(RESAMP() _q);
 
+// internal: run timing state machine for the most recent input sample
+//  _q          :   resampling object
+//  _r          :   most recent input samples, oldest first [size: 2*m x 1]
+//  _y          :   output array
+//  _num_written:   number of samples written to output
+void RESAMP(_execute_buffer)(RESAMP()       _q,
+                             TI *           _r,
+                             TO *           _y,
+                             unsigned int * _num_written);
+
 struct RESAMP(_s) {
     // filter design parameters
     unsigned int m;     // filter semi-length, h_len = 2*m + 1
@@ -64,6 +74,14 @@ struct RESAMP(_s) {
     unsigned int npfb;  // number of filters in the bank
     FIRPFB() f;         // filterbank object (interpolator)
 
+    // input buffer: the filterbank is run directly on this array so
+    // that a block of samples can be written before any outputs are
+    // computed
+    TI * w;             // input buffer [size: w_len + w_size x 1]
+    unsigned int w_len; // filterbank sub-filter length, 2*m
+    unsigned int w_size;// number of samples before buffer wraps
+    unsigned int w_index;// buffer read index
+
     enum {
         RESAMP_STATE_BOUNDARY, // boundary between input samples
         RESAMP_STATE_INTERP,   // regular interpolation
@@ -131,6 +149,11 @@ RESAMP() RESAMP(_create)(float        _rate,
         h[i] = hf[i]*gain;
     q->f = FIRPFB(_create)(q->npfb,h,n-1);
 
+    // allocate input buffer
+    q->w_len  = 2*q->m;
+    q->w_size = 1<<liquid_msb_index(4*q->w_len + 256);
+    q->w      = (TI*) malloc((q->w_len + q->w_size)*sizeof(TI));
+
     // reset object and return
     RESAMP(_reset)(q);
     return q;
@@ -163,8 +186,9 @@ RESAMP() RESAMP(_create_default)(float _rate)
 // free arbitrary resampler object
 void RESAMP(_destroy)(RESAMP() _q)
 {
-    // free polyphase filterbank
+    // free polyphase filterbank and input buffer
     FIRPFB(_destroy)(_q->f);
+    free(_q->w);
 
     // free main object memory
     free(_q);
@@ -180,8 +204,10 @@ void RESAMP(_print)(RESAMP() _q)
 // reset resampler object
 void RESAMP(_reset)(RESAMP() _q)
 {
-    // clear filterbank
+    // clear filterbank and input buffer
     FIRPFB(_reset)(_q->f);
+    memset(_q->w, 0x00, _q->w_len*sizeof(TI));
+    _q->w_index = 0;
 
     // reset states
     _q->state = RESAMP_STATE_INTERP;// input/output sample state
@@ -247,8 +273,87 @@ void RESAMP(_execute)(RESAMP()       _q,
                       TO *           _y,
                       unsigned int * _num_written)
 {
-    // push input sample into filterbank
-    FIRPFB(_push)(_q->f, _x);
+    // push input sample into buffer, moving the most recent
+    // samples to the front when the end has been reached
+    _q->w_index++;
+    if (_q->w_index == _q->w_size) {
+        memmove(_q->w, _q->w + _q->w_index, (_q->w_len-1)*sizeof(TI));
+        _q->w_index = 0;
+    }
+    _q->w[_q->w_index + _q->w_len - 1] = _x;
+
+    // run resampler on buffer
+    RESAMP(_execute_buffer)(_q, _q->w + _q->w_index, _y, _num_written);
+}
+
+// execute arbitrary resampler on a block of samples
+//  _q              :   resamp object
+//  _x              :   input buffer [size: _nx x 1]
+//  _nx             :   input buffer
+//  _y              :   output sample array (pointer)
+//  _ny             :   number of samples written to _y
+void RESAMP(_execute_block)(RESAMP()       _q,
+                            TI *           _x,
+                            unsigned int   _nx,
+                            TO *           _y,
+                            unsigned int * _ny)
+{
+    // initialize number of output samples to zero
+    unsigned int ny = 0;
+
+    // number of samples written for each individual iteration
+    unsigned int num_written;
+
+    unsigned int i;
+    while (_nx > 0) {
+        // number of samples which can be appended to the buffer
+        // before it wraps around
+        unsigned int n = _q->w_size - 1 - _q->w_index;
+
+        if (n == 0) {
+            // push single sample (wrapping buffer)
+            RESAMP(_execute)(_q, _x[0], &_y[ny], &num_written);
+            ny += num_written;
+            n = 1;
+        } else {
+            if (n > _nx) n = _nx;
+
+            // append samples to end of buffer; writing the entire block
+            // before reading it back avoids stalling on each new sample
+            memmove(_q->w + _q->w_index + _q->w_len, _x, n*sizeof(TI));
+
+            // run resampler on each input sample
+            for (i=0; i<n; i++) {
+                RESAMP(_execute_buffer)(_q, _q->w + _q->w_index + 1 + i, &_y[ny], &num_written);
+                ny += num_written;
+            }
+            _q->w_index += n;
+        }
+
+        // update pointers, counter
+        _x  += n;
+        _nx -= n;
+    }
+
+    // set return value for number of output samples written
+    *_ny = ny;
+}
+
+
+//
+// internal methods
+// 
+
+// run timing state machine for the most recent input sample
+//  _q          :   resampling object
+//  _r          :   most recent input samples, oldest first [size: 2*m x 1]
+//  _y          :   output array
+//  _num_written:   number of samples written to output
+void RESAMP(_execute_buffer)(RESAMP()       _q,
+                             TI *           _r,
+                             TO *           _y,
+                             unsigned int * _num_written)
+{
     unsigned int n=0;
     
     while (_q->b < _q->npfb) {
@@ -259,7 +364,7 @@ void RESAMP(_execute)(RESAMP()       _q,
         switch (_q->state) {
         case RESAMP_STATE_BOUNDARY:
             // compute filterbank output
-            FIRPFB(_execute)(_q->f, 0, &_q->y1);
+            FIRPFB(_execute_buffer)(_q->f, 0, _r, &_q->y1);
 
             // interpolate
             _y[n++] = (1.0f - _q->mu)*_q->y0 + _q->mu*_q->y1;
@@ -272,7 +377,7 @@ void RESAMP(_execute)(RESAMP()       _q,
 
         case RESAMP_STATE_INTERP:
             // compute output at base index
-            FIRPFB(_execute)(_q->f, _q->b, &_q->y0);
+            FIRPFB(_execute_buffer)(_q->f, _q->b, _r, &_q->y0);
 
             // check to see if base index is last filter in the bank, in
             // which case the resampler needs an additional input sample
@@ -286,7 +391,7 @@ void RESAMP(_execute)(RESAMP()       _q,
             } else {
                 // do not need additional input sample; compute
                 // output at incremented base index
-                FIRPFB(_execute)(_q->f, _q->b+1, &_q->y1);
+                FIRPFB(_execute_buffer)(_q->f, _q->b+1, _r, &_q->y1);
 
                 // perform linear interpolation between filterbank outputs
                 _y[n++] = (1.0f - _q->mu)*_q->y0 + _q->mu*_q->y1;
@@ -310,43 +415,6 @@ void RESAMP(_execute)(RESAMP()       _q,
     *_num_written = n;
 }
 
-// execute arbitrary resampler on a block of samples
-//  _q              :   resamp object
-//  _x              :   input buffer [size: _nx x 1]
-//  _nx             :   input buffer
-//  _y              :   output sample array (pointer)
-//  _ny             :   number of samples written to _y
-void RESAMP(_execute_block)(RESAMP()       _q,
-                            TI *           _x,
-                            unsigned int   _nx,
-                            TO *           _y,
-                            unsigned int * _ny)
-{
-    // initialize number of output samples to zero
-    unsigned int ny = 0;
-
-    // number of samples written for each individual iteration
-    unsigned int num_written;
-
-    // iterate over each input sample
-    unsigned int i;
-    for (i=0; i<_nx; i++) {
-        // run resampler on single input
-        RESAMP(_execute)(_q, _x[i], &_y[ny], &num_written);
-
-        // update output counter
-        ny += num_written;
-    }
-
-    // set return value for number of output samples written
-    *_ny = ny;
-}
-
-
-//
-// internal methods
-// 
-
 // update timing state; increment output timing stride and
 // quantize filterbank indices
 void RESAMP(_update_timing_state)(RESAMP() _q)
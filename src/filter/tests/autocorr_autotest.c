@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// block sizes cycled through by the tests below; the larger
+// sizes push more samples than the window holds in one call
+#define AUTOCORR_AUTOTEST_NUM_BLOCKS (7)
+static unsigned int autocorr_autotest_blocks[AUTOCORR_AUTOTEST_NUM_BLOCKS] =
+    {1, 3, 17, 2, 64, 5, 129};
+
+//
+// AUTOTEST helper: compare autocorr_cccf_execute_block() against
+// repeated autocorr_cccf_push() and autocorr_cccf_execute(); the
+// block is run in place to check input/output aliasing
+//
+void autocorr_cccf_test_block(unsigned int _window_size,
+                              unsigned int _delay)
+{
+    float tol = 1e-4f * _window_size;
+    unsigned int num_samples = 4*(_window_size + _delay) + 300;
+
+    autocorr_cccf q0 = autocorr_cccf_create(_window_size, _delay);
+    autocorr_cccf q1 = autocorr_cccf_create(_window_size, _delay);
+
+    float complex * x = (float complex*) malloc(num_samples*sizeof(float complex));
+    float complex * y = (float complex*) malloc(num_samples*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<num_samples; i++) {
+        x[i] = randnf() + _Complex_I*randnf();
+        y[i] = x[i];
+    }
+
+    // run block execution in place, in blocks of varying size
+    unsigned int n = 0;
+    unsigned int b = 0;
+    while (n < num_samples) {
+        unsigned int num_block = autocorr_autotest_blocks[b];
+        if (num_block > num_samples - n)
+            num_block = num_samples - n;
+        autocorr_cccf_execute_block(q1, &y[n], num_block, &y[n]);
+        n += num_block;
+        b = (b + 1) % AUTOCORR_AUTOTEST_NUM_BLOCKS;
+    }
+
+    // compare with sample-by-sample execution
+    for (i=0; i<num_samples; i++) {
+        float complex rxx;
+        autocorr_cccf_push(q0, x[i]);
+        autocorr_cccf_execute(q0, &rxx);
+
+        CONTEND_DELTA(crealf(y[i]), crealf(rxx), tol);
+        CONTEND_DELTA(cimagf(y[i]), cimagf(rxx), tol);
+    }
+
+    // energy is tracked identically on both paths
+    CONTEND_DELTA(autocorr_cccf_get_energy(q1), autocorr_cccf_get_energy(q0), tol);
+
+    autocorr_cccf_destroy(q0);
+    autocorr_cccf_destroy(q1);
+    free(x);
+    free(y);
+}
+
+//
+// AUTOTEST helper: compare autocorr_rrrf_execute_block() against
+// repeated autocorr_rrrf_push() and autocorr_rrrf_execute()
+//
+void autocorr_rrrf_test_block(unsigned int _window_size,
+                              unsigned int _delay)
+{
+    float tol = 1e-4f * _window_size;
+    unsigned int num_samples = 4*(_window_size + _delay) + 300;
+
+    autocorr_rrrf q0 = autocorr_rrrf_create(_window_size, _delay);
+    autocorr_rrrf q1 = autocorr_rrrf_create(_window_size, _delay);
+
+    float * x = (float*) malloc(num_samples*sizeof(float));
+    float * y = (float*) malloc(num_samples*sizeof(float));
+    unsigned int i;
+    for (i=0; i<num_samples; i++)
+        x[i] = randnf();
+
+    // run block execution in blocks of varying size
+    unsigned int n = 0;
+    unsigned int b = 0;
+    while (n < num_samples) {
+        unsigned int num_block = autocorr_autotest_blocks[b];
+        if (num_block > num_samples - n)
+            num_block = num_samples - n;
+        autocorr_rrrf_execute_block(q1, &x[n], num_block, &y[n]);
+        n += num_block;
+        b = (b + 1) % AUTOCORR_AUTOTEST_NUM_BLOCKS;
+    }
+
+    // compare with sample-by-sample execution
+    for (i=0; i<num_samples; i++) {
+        float rxx;
+        autocorr_rrrf_push(q0, x[i]);
+        autocorr_rrrf_execute(q0, &rxx);
+
+        CONTEND_DELTA(y[i], rxx, tol);
+    }
+
+    autocorr_rrrf_destroy(q0);
+    autocorr_rrrf_destroy(q1);
+    free(x);
+    free(y);
+}
+
+void autotest_autocorr_cccf_block_w1_d1()   { autocorr_cccf_test_block(  1,  1); }
+void autotest_autocorr_cccf_block_w4_d2()   { autocorr_cccf_test_block(  4,  2); }
+void autotest_autocorr_cccf_block_w16_d5()  { autocorr_cccf_test_block( 16,  5); }
+void autotest_autocorr_cccf_block_w64_d64() { autocorr_cccf_test_block( 64, 64); }
+void autotest_autocorr_cccf_block_w100_d7() { autocorr_cccf_test_block(100,  7); }
+
+void autotest_autocorr_rrrf_block_w1_d1()   { autocorr_rrrf_test_block(  1,  1); }
+void autotest_autocorr_rrrf_block_w4_d2()   { autocorr_rrrf_test_block(  4,  2); }
+void autotest_autocorr_rrrf_block_w16_d5()  { autocorr_rrrf_test_block( 16,  5); }
+void autotest_autocorr_rrrf_block_w64_d64() { autocorr_rrrf_test_block( 64, 64); }
+void autotest_autocorr_rrrf_block_w100_d7() { autocorr_rrrf_test_block(100,  7); }
+
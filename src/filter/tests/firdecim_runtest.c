@@ -55,6 +55,16 @@ void firdecim_rrrf_test(unsigned int    _M,
         CONTEND_DELTA( y_test[i], _y[i], tol );
     }
     
+    // run again in block mode, split into two calls to carry
+    // internal state across blocks
+    firdecim_rrrf_clear(q);
+    unsigned int n0 = _y_len / 3;
+    firdecim_rrrf_execute_block(q, _x,         n0,          y_test   );
+    firdecim_rrrf_execute_block(q, _x + _M*n0, _y_len - n0, y_test+n0);
+    for (i=0; i<_y_len; i++) {
+        CONTEND_DELTA( y_test[i], _y[i], tol );
+    }
+
     // destroy decimator object object
     firdecim_rrrf_destroy(q);
 }
@@ -92,6 +102,17 @@ void firdecim_crcf_test(unsigned int    _M,
         CONTEND_DELTA( cimagf(y_test[i]), cimagf(_y[i]), tol );
     }
     
+    // run again in block mode, split into two calls to carry
+    // internal state across blocks
+    firdecim_crcf_clear(q);
+    unsigned int n0 = _y_len / 3;
+    firdecim_crcf_execute_block(q, _x,         n0,          y_test   );
+    firdecim_crcf_execute_block(q, _x + _M*n0, _y_len - n0, y_test+n0);
+    for (i=0; i<_y_len; i++) {
+        CONTEND_DELTA( crealf(y_test[i]), crealf(_y[i]), tol );
+        CONTEND_DELTA( cimagf(y_test[i]), cimagf(_y[i]), tol );
+    }
+
     // destroy decimator object object
     firdecim_crcf_destroy(q);
 }
@@ -129,6 +150,17 @@ void firdecim_cccf_test(unsigned int    _M,
         CONTEND_DELTA( cimagf(y_test[i]), cimagf(_y[i]), tol );
     }
     
+    // run again in block mode, split into two calls to carry
+    // internal state across blocks
+    firdecim_cccf_clear(q);
+    unsigned int n0 = _y_len / 3;
+    firdecim_cccf_execute_block(q, _x,         n0,          y_test   );
+    firdecim_cccf_execute_block(q, _x + _M*n0, _y_len - n0, y_test+n0);
+    for (i=0; i<_y_len; i++) {
+        CONTEND_DELTA( crealf(y_test[i]), crealf(_y[i]), tol );
+        CONTEND_DELTA( cimagf(y_test[i]), cimagf(_y[i]), tol );
+    }
+
     // destroy decimator object object
     firdecim_cccf_destroy(q);
 }
@@ -20,6 +20,8 @@
  * THE SOFTWARE.
  */
 
+#include <string.h>
+
 #include "autotest/autotest.h"
 #include "liquid.h"
 
@@ -54,6 +56,17 @@ void firfilt_rrrf_test(float *      _h,
         CONTEND_DELTA( y_test[i], _y[i], tol );
     }
 
+    // run again in block mode, split into two calls to carry
+    // internal state across blocks (operate in place)
+    firfilt_rrrf_reset(q);
+    memmove(y_test, _x, _x_len*sizeof(float));
+    unsigned int n0 = _x_len / 3;
+    firfilt_rrrf_execute_block(q, y_test,    n0,          y_test   );
+    firfilt_rrrf_execute_block(q, y_test+n0, _x_len - n0, y_test+n0);
+    for (i=0; i<_x_len; i++) {
+        CONTEND_DELTA( y_test[i], _y[i], tol );
+    }
+
     // destroy filter object
     firfilt_rrrf_destroy(q);
 }
@@ -90,6 +103,30 @@ void firfilt_crcf_test(float *         _h,
         CONTEND_DELTA( cimagf(y_test[i]), cimagf(_y[i]), tol );
     }
     
+    // run again in block mode, split into two calls to carry
+    // internal state across blocks (operate in place)
+    firfilt_crcf_reset(q);
+    memmove(y_test, _x, _x_len*sizeof(float complex));
+    unsigned int n0 = _x_len / 3;
+    firfilt_crcf_execute_block(q, y_test,    n0,          y_test   );
+    firfilt_crcf_execute_block(q, y_test+n0, _x_len - n0, y_test+n0);
+    for (i=0; i<_x_len; i++) {
+        CONTEND_DELTA( crealf(y_test[i]), crealf(_y[i]), tol );
+        CONTEND_DELTA( cimagf(y_test[i]), cimagf(_y[i]), tol );
+    }
+
+    // run again on split-complex (planar) input, in place
+    firfilt_crcf_reset(q);
+    float yi[_x_len];
+    float yq[_x_len];
+    liquid_vectorcf_split(_x, _x_len, yi, yq);
+    firfilt_crcf_execute_block_split(q, yi,    yq,    n0,          yi,    yq   );
+    firfilt_crcf_execute_block_split(q, yi+n0, yq+n0, _x_len - n0, yi+n0, yq+n0);
+    for (i=0; i<_x_len; i++) {
+        CONTEND_DELTA( yi[i], crealf(_y[i]), tol );
+        CONTEND_DELTA( yq[i], cimagf(_y[i]), tol );
+    }
+
     // destroy filter object
     firfilt_crcf_destroy(q);
 }
@@ -126,6 +163,30 @@ void firfilt_cccf_test(float complex * _h,
         CONTEND_DELTA( cimagf(y_test[i]), cimagf(_y[i]), tol );
     }
     
+    // run again in block mode, split into two calls to carry
+    // internal state across blocks (operate in place)
+    firfilt_cccf_reset(q);
+    memmove(y_test, _x, _x_len*sizeof(float complex));
+    unsigned int n0 = _x_len / 3;
+    firfilt_cccf_execute_block(q, y_test,    n0,          y_test   );
+    firfilt_cccf_execute_block(q, y_test+n0, _x_len - n0, y_test+n0);
+    for (i=0; i<_x_len; i++) {
+        CONTEND_DELTA( crealf(y_test[i]), crealf(_y[i]), tol );
+        CONTEND_DELTA( cimagf(y_test[i]), cimagf(_y[i]), tol );
+    }
+
+    // run again on split-complex (planar) input, in place
+    firfilt_cccf_reset(q);
+    float yi[_x_len];
+    float yq[_x_len];
+    liquid_vectorcf_split(_x, _x_len, yi, yq);
+    firfilt_cccf_execute_block_split(q, yi,    yq,    n0,          yi,    yq   );
+    firfilt_cccf_execute_block_split(q, yi+n0, yq+n0, _x_len - n0, yi+n0, yq+n0);
+    for (i=0; i<_x_len; i++) {
+        CONTEND_DELTA( yi[i], crealf(_y[i]), tol );
+        CONTEND_DELTA( yq[i], cimagf(_y[i]), tol );
+    }
+
     // destroy filter object
     firfilt_cccf_destroy(q);
 }
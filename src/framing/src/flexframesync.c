@@ -69,6 +69,32 @@ void flexframesync_execute_rxheader(flexframesync _q,
 void flexframesync_execute_rxpayload(flexframesync _q,
                                      float complex _x);
 
+// frame handed to decoder threads (pipelined mode)
+struct flexframesync_job_s {
+    unsigned char    header_dec[FLEXFRAME_H_DEC]; // header bytes (decoded)
+    int              header_valid;      // header CRC flag
+    float complex *  payload_sym;       // payload symbols (received)
+    unsigned int     payload_sym_len;   // payload symbols (length)
+    unsigned int     payload_sym_size;  // payload symbols (allocated)
+    unsigned char *  payload_dec;       // payload data (bytes)
+    unsigned int     payload_dec_len;   // payload data (length)
+    unsigned int     payload_dec_size;  // payload data (allocated)
+    int              payload_valid;     // payload CRC flag
+    framesyncstats_s framesyncstats;    // frame statistics
+};
+
+// pipeline callbacks: per-thread payload decoder, decode, deliver
+void * flexframesync_worker_create(void * _userdata);
+void   flexframesync_worker_destroy(void * _worker);
+void   flexframesync_job_decode(void * _userdata, void * _worker, void * _job);
+void   flexframesync_job_deliver(void * _userdata, void * _job);
+
+// submit frame to decoder threads
+void flexframesync_submit(flexframesync _q);
+
+// stop decoder threads, releasing job buffers
+void flexframesync_pipe_destroy(flexframesync _q);
+
 // flexframesync object structure
 struct flexframesync_s {
     // callback
@@ -112,14 +138,20 @@ struct flexframesync_s {
     int             header_valid;       // header CRC flag
     
     // payload
+    framecache      payload_cache;      // payload demods (for phase recovery)
     modem           payload_demod;      // payload demod (for phase recovery only)
     float complex * payload_sym;        // payload symbols (received)
     unsigned int    payload_sym_len;    // payload symbols (length)
+    unsigned int    payload_sym_size;   // payload symbols (allocated)
     qpacketmodem    payload_decoder;    // payload demodulator/decoder
     unsigned char * payload_dec;        // payload data (bytes)
     unsigned int    payload_dec_len;    // payload data (length)
+    unsigned int    payload_dec_size;   // payload data (allocated)
     int             payload_valid;      // payload CRC flag
     
+    // pipelined payload decoding (NULL: decode in sample loop)
+    framepipe       pipe;
+
     // status variables
     unsigned int    preamble_counter;   // counter: num of p/n syms received
     unsigned int    symbol_counter;     // counter: num of symbols received
@@ -201,7 +233,8 @@ flexframesync flexframesync_create(framesync_callback _callback,
     q->header_sym       = (float complex*) malloc(q->header_sym_len*sizeof(float complex));
     
     // payload demodulator for phase recovery
-    q->payload_demod = modem_create(LIQUID_MODEM_QPSK);
+    q->payload_cache = framecache_create(FRAMECACHE_CAPACITY);
+    q->payload_demod = framecache_get_modem(q->payload_cache, LIQUID_MODEM_QPSK);
 
     // create payload demodulator/decoder object
     q->payload_dec_len = 64;
@@ -216,8 +249,13 @@ flexframesync flexframesync_create(framesync_callback _callback,
     q->payload_sym_len = qpacketmodem_get_frame_len(q->payload_decoder);
 
     // allocate memory for payload symbols and recovered data bytes
-    q->payload_sym = (float complex*) malloc(q->payload_sym_len*sizeof(float complex));
-    q->payload_dec = (unsigned char*) malloc(q->payload_dec_len*sizeof(unsigned char));
+    q->payload_sym_size = q->payload_sym_len;
+    q->payload_dec_size = q->payload_dec_len;
+    q->payload_sym = (float complex*) malloc(q->payload_sym_size*sizeof(float complex));
+    q->payload_dec = (unsigned char*) malloc(q->payload_dec_size*sizeof(unsigned char));
+
+    // payload decoded in sample loop until threads are requested
+    q->pipe = NULL;
 
     // reset global data counters
     flexframesync_reset_framedatastats(q);
@@ -244,6 +282,9 @@ void flexframesync_destroy(flexframesync _q)
         windowcf_destroy(_q->debug_x);
 #endif
 
+    // wait for pending frames and stop decoder threads
+    flexframesync_pipe_destroy(_q);
+
     // free allocated arrays
     free(_q->preamble_pn);
     free(_q->preamble_rx);
@@ -256,7 +297,7 @@ void flexframesync_destroy(flexframesync _q)
     // destroy synchronization objects
     qpilotsync_destroy    (_q->header_pilotsync); // header demodulator/decoder
     qpacketmodem_destroy  (_q->header_decoder);   // header demodulator/decoder
-    modem_destroy         (_q->payload_demod);    // payload demodulator (for PLL)
+    framecache_destroy    (_q->payload_cache);    // payload demodulators (for PLL)
     qpacketmodem_destroy  (_q->payload_decoder);  // payload demodulator/decoder
     qdetector_cccf_destroy(_q->detector);         // frame detector
     firpfb_crcf_destroy   (_q->mf);               // matched filter
@@ -512,6 +553,13 @@ void flexframesync_execute_rxheader(flexframesync _q,
                 return;
             }
 
+            if (_q->pipe != NULL) {
+                // deliver in order with frames pending on decoder threads
+                flexframesync_submit(_q);
+                flexframesync_reset(_q);
+                return;
+            }
+
             // update statistics
             _q->framedatastats.num_frames_detected++;
 
@@ -612,8 +660,8 @@ void flexframesync_decode_header(flexframesync _q)
         return;
     }
 
-    // re-create payload demodulator for phase-locked loop
-    _q->payload_demod = modem_recreate(_q->payload_demod, mod_scheme);
+    // get payload demodulator for phase-locked loop
+    _q->payload_demod = framecache_get_modem(_q->payload_cache, mod_scheme);
 
     // reconfigure payload demodulator/decoder
     qpacketmodem_configure(_q->payload_decoder,
@@ -622,9 +670,15 @@ void flexframesync_decode_header(flexframesync _q)
     // set length appropriately
     _q->payload_sym_len = qpacketmodem_get_frame_len(_q->payload_decoder);
 
-    // re-allocate buffers accordingly
-    _q->payload_sym = (float complex*) realloc(_q->payload_sym, (_q->payload_sym_len)*sizeof(float complex));
-    _q->payload_dec = (unsigned char*) realloc(_q->payload_dec, (_q->payload_dec_len)*sizeof(unsigned char));
+    // grow buffers as needed (never shrunk)
+    if (_q->payload_sym_len > _q->payload_sym_size) {
+        _q->payload_sym_size = _q->payload_sym_len;
+        _q->payload_sym = (float complex*) realloc(_q->payload_sym, (_q->payload_sym_size)*sizeof(float complex));
+    }
+    if (_q->payload_dec_len > _q->payload_dec_size) {
+        _q->payload_dec_size = _q->payload_dec_len;
+        _q->payload_dec = (unsigned char*) realloc(_q->payload_dec, (_q->payload_dec_size)*sizeof(unsigned char));
+    }
 
     if (_q->payload_sym == NULL || _q->payload_dec == NULL) {
         fprintf(stderr,"error: flexframesync_decode_header(), could not re-allocate payload arrays\n");
@@ -683,6 +737,13 @@ void flexframesync_execute_rxpayload(flexframesync _q,
         _q->symbol_counter++;
 
         if (_q->symbol_counter == _q->payload_sym_len) {
+            if (_q->pipe != NULL) {
+                // hand payload to decoder threads
+                flexframesync_submit(_q);
+                flexframesync_reset(_q);
+                return;
+            }
+
             // decode payload
             _q->payload_valid = qpacketmodem_decode(_q->payload_decoder,
                                                     _q->payload_sym,
@@ -729,13 +790,175 @@ void flexframesync_execute_rxpayload(flexframesync _q,
 // reset frame data statistics
 void flexframesync_reset_framedatastats(flexframesync _q)
 {
+    if (_q->pipe != NULL) framepipe_lock(_q->pipe);
     framedatastats_reset(&_q->framedatastats);
+    if (_q->pipe != NULL) framepipe_unlock(_q->pipe);
 }
 
 // retrieve frame data statistics
 framedatastats_s flexframesync_get_framedatastats(flexframesync _q)
 {
-    return _q->framedatastats;
+    if (_q->pipe != NULL) framepipe_lock(_q->pipe);
+    framedatastats_s stats = _q->framedatastats;
+    if (_q->pipe != NULL) framepipe_unlock(_q->pipe);
+    return stats;
+}
+
+// set number of threads decoding payloads; frames are delivered to
+// the callback (from a decoder thread) in the order they were received
+//  _q           :   frame synchronizer object
+//  _num_threads :   number of decoder threads (0: decode in sample loop)
+void flexframesync_set_num_threads(flexframesync _q,
+                                   unsigned int  _num_threads)
+{
+    flexframesync_pipe_destroy(_q);
+    if (_num_threads == 0)
+        return;
+
+    _q->pipe = framepipe_create(_num_threads,
+                                4*_num_threads,
+                                sizeof(struct flexframesync_job_s),
+                                flexframesync_worker_create,
+                                flexframesync_worker_destroy,
+                                flexframesync_job_decode,
+                                flexframesync_job_deliver,
+                                (void*)_q);
+}
+
+// block until all frames handed to decoder threads have been delivered
+void flexframesync_wait(flexframesync _q)
+{
+    if (_q->pipe != NULL)
+        framepipe_wait(_q->pipe);
+}
+
+// stop decoder threads, releasing job buffers
+void flexframesync_pipe_destroy(flexframesync _q)
+{
+    if (_q->pipe == NULL)
+        return;
+
+    framepipe_wait(_q->pipe);
+    unsigned int i;
+    for (i=0; i<framepipe_get_num_jobs(_q->pipe); i++) {
+        struct flexframesync_job_s * job = framepipe_get_job(_q->pipe, i);
+        free(job->payload_sym);
+        free(job->payload_dec);
+    }
+    framepipe_destroy(_q->pipe);
+    _q->pipe = NULL;
+}
+
+// submit received frame (header and payload symbols) to decoder threads
+void flexframesync_submit(flexframesync _q)
+{
+    struct flexframesync_job_s * job = framepipe_acquire(_q->pipe);
+
+    memmove(job->header_dec, _q->header_dec, FLEXFRAME_H_DEC*sizeof(unsigned char));
+    job->header_valid = _q->header_valid;
+
+    // set framestats internals known to the front end
+    job->framesyncstats      = _q->framesyncstats;
+    job->framesyncstats.rssi = 20*log10f(_q->gamma_hat);
+    job->framesyncstats.cfo  = nco_crcf_get_frequency(_q->mixer);
+
+    if (!_q->header_valid) {
+        job->framesyncstats.evm           = 0.0f;
+        job->framesyncstats.framesyms     = NULL;
+        job->framesyncstats.num_framesyms = 0;
+        job->framesyncstats.mod_scheme    = LIQUID_MODEM_UNKNOWN;
+        job->framesyncstats.mod_bps       = 0;
+        job->framesyncstats.check         = LIQUID_CRC_UNKNOWN;
+        job->framesyncstats.fec0          = LIQUID_FEC_UNKNOWN;
+        job->framesyncstats.fec1          = LIQUID_FEC_UNKNOWN;
+        job->payload_sym_len = 0;
+        job->payload_dec_len = 0;
+        job->payload_valid   = 0;
+        framepipe_submit(_q->pipe);
+        return;
+    }
+
+    // copy payload symbols, growing job buffers as needed
+    job->payload_sym_len = _q->payload_sym_len;
+    job->payload_dec_len = _q->payload_dec_len;
+    if (job->payload_sym_len > job->payload_sym_size) {
+        job->payload_sym_size = job->payload_sym_len;
+        job->payload_sym = (float complex*) realloc(job->payload_sym, job->payload_sym_size*sizeof(float complex));
+    }
+    if (job->payload_dec_len > job->payload_dec_size) {
+        job->payload_dec_size = job->payload_dec_len;
+        job->payload_dec = (unsigned char*) realloc(job->payload_dec, job->payload_dec_size*sizeof(unsigned char));
+    }
+    memmove(job->payload_sym, _q->payload_sym, job->payload_sym_len*sizeof(float complex));
+
+    int ms = qpacketmodem_get_modscheme(_q->payload_decoder);
+    job->framesyncstats.evm           = 10*log10f(_q->framesyncstats.evm / (float)_q->payload_sym_len);
+    job->framesyncstats.framesyms     = job->payload_sym;
+    job->framesyncstats.num_framesyms = job->payload_sym_len;
+    job->framesyncstats.mod_scheme    = ms;
+    job->framesyncstats.mod_bps       = modulation_types[ms].bps;
+    job->framesyncstats.check         = qpacketmodem_get_crc(_q->payload_decoder);
+    job->framesyncstats.fec0          = qpacketmodem_get_fec0(_q->payload_decoder);
+    job->framesyncstats.fec1          = qpacketmodem_get_fec1(_q->payload_decoder);
+    framepipe_submit(_q->pipe);
+}
+
+// create payload decoder for one decoder thread
+void * flexframesync_worker_create(void * _userdata)
+{
+    return (void*) qpacketmodem_create();
+}
+
+// destroy payload decoder
+void flexframesync_worker_destroy(void * _worker)
+{
+    qpacketmodem_destroy((qpacketmodem)_worker);
+}
+
+// decode payload (runs on decoder thread)
+void flexframesync_job_decode(void * _userdata,
+                              void * _worker,
+                              void * _job)
+{
+    struct flexframesync_job_s * job = (struct flexframesync_job_s *) _job;
+    if (!job->header_valid)
+        return;
+
+    qpacketmodem dec = (qpacketmodem) _worker;
+    qpacketmodem_configure(dec,
+                           job->payload_dec_len,
+                           job->framesyncstats.check,
+                           job->framesyncstats.fec0,
+                           job->framesyncstats.fec1,
+                           job->framesyncstats.mod_scheme);
+    job->payload_valid = qpacketmodem_decode(dec, job->payload_sym, job->payload_dec);
+}
+
+// update statistics and invoke callback (runs in frame order)
+void flexframesync_job_deliver(void * _userdata,
+                               void * _job)
+{
+    flexframesync _q = (flexframesync) _userdata;
+    struct flexframesync_job_s * job = (struct flexframesync_job_s *) _job;
+
+    // update statistics
+    _q->framedatastats.num_frames_detected++;
+    if (job->header_valid) {
+        _q->framedatastats.num_headers_valid++;
+        _q->framedatastats.num_payloads_valid += job->payload_valid;
+        _q->framedatastats.num_bytes_received += job->payload_dec_len;
+    }
+
+    // invoke callback method
+    if (_q->callback != NULL) {
+        _q->callback(job->header_dec,
+                     job->header_valid,
+                     job->header_valid ? job->payload_dec : NULL,
+                     job->payload_dec_len,
+                     job->payload_valid,
+                     job->framesyncstats,
+                     _q->userdata);
+    }
 }
 
 // enable debugging
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+//
+// framecache.c
+//
+// cache of payload modems and packetizers for frame synchronizers, so
+// that reconfiguring between previously seen modes does not allocate
+// memory or rebuild forward error-correction tables
+//
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "liquid.internal.h"
+
+struct framecache_s {
+    unsigned int        capacity;       // maximum number of each object type
+    unsigned long int   counter;        // access counter (least-recently used)
+
+    // payload modems, keyed by modulation scheme
+    modem *             mod;            // cached modems [size: capacity x 1]
+    unsigned long int * mod_access;     // last access time
+    unsigned int        num_mod;        // number of cached modems
+    modem               mod_last;       // most recently returned modem
+
+    // packetizers, keyed by length, crc, inner fec, outer fec
+    packetizer *        p;              // cached packetizers [size: capacity x 1]
+    unsigned long int * p_access;       // last access time
+    unsigned int        num_p;          // number of cached packetizers
+};
+
+// create frame cache
+//  _capacity   :   maximum number of modems (and packetizers) to retain
+framecache framecache_create(unsigned int _capacity)
+{
+    // validate input
+    if (_capacity == 0) {
+        fprintf(stderr,"error: framecache_create(), capacity must be greater than zero\n");
+        exit(1);
+    }
+
+    // allocate memory for main object
+    framecache q = (framecache) malloc(sizeof(struct framecache_s));
+    q->capacity = _capacity;
+    q->counter  = 0;
+
+    // objects are created on demand
+    q->mod        = (modem *)             malloc(q->capacity*sizeof(modem));
+    q->mod_access = (unsigned long int *) malloc(q->capacity*sizeof(unsigned long int));
+    q->num_mod    = 0;
+    q->mod_last   = NULL;
+
+    q->p          = (packetizer *)        malloc(q->capacity*sizeof(packetizer));
+    q->p_access   = (unsigned long int *) malloc(q->capacity*sizeof(unsigned long int));
+    q->num_p      = 0;
+
+    // return object
+    return q;
+}
+
+// destroy frame cache and all objects it holds
+void framecache_destroy(framecache _q)
+{
+    unsigned int i;
+    for (i=0; i<_q->num_mod; i++)
+        modem_destroy(_q->mod[i]);
+    for (i=0; i<_q->num_p; i++)
+        packetizer_destroy(_q->p[i]);
+
+    free(_q->mod);
+    free(_q->mod_access);
+    free(_q->p);
+    free(_q->p_access);
+    free(_q);
+}
+
+// get modem for a modulation scheme; the returned object is owned by
+// the cache and is reset when it differs from the previously returned
+// modem, matching the state of a newly created object
+modem framecache_get_modem(framecache        _q,
+                           modulation_scheme _ms)
+{
+    unsigned int i;
+    unsigned int i_lru = 0;
+    for (i=0; i<_q->num_mod; i++) {
+        if (modem_get_scheme(_q->mod[i]) == _ms)
+            break;
+        if (_q->mod_access[i] < _q->mod_access[i_lru])
+            i_lru = i;
+    }
+
+    if (i < _q->num_mod) {
+        // cache hit
+        if (_q->mod[i] != _q->mod_last)
+            modem_reset(_q->mod[i]);
+    } else if (_q->num_mod < _q->capacity) {
+        // add new entry
+        i = _q->num_mod++;
+        _q->mod[i] = modem_create(_ms);
+    } else {
+        // replace least-recently used entry
+        i = i_lru;
+        modem_destroy(_q->mod[i]);
+        _q->mod[i] = modem_create(_ms);
+    }
+
+    _q->mod_access[i] = ++_q->counter;
+    _q->mod_last = _q->mod[i];
+    return _q->mod[i];
+}
+
+// get packetizer for a decoded length, crc and fec schemes; the
+// returned object is owned by the cache
+packetizer framecache_get_packetizer(framecache   _q,
+                                     unsigned int _n,
+                                     crc_scheme   _crc,
+                                     fec_scheme   _fec0,
+                                     fec_scheme   _fec1)
+{
+    unsigned int i;
+    unsigned int i_lru = 0;
+    for (i=0; i<_q->num_p; i++) {
+        if (packetizer_get_dec_msg_len(_q->p[i]) == _n    &&
+            packetizer_get_crc        (_q->p[i]) == _crc  &&
+            packetizer_get_fec0       (_q->p[i]) == _fec0 &&
+            packetizer_get_fec1       (_q->p[i]) == _fec1)
+        {
+            break;
+        }
+        if (_q->p_access[i] < _q->p_access[i_lru])
+            i_lru = i;
+    }
+
+    if (i < _q->num_p) {
+        // cache hit
+    } else if (_q->num_p < _q->capacity) {
+        // add new entry
+        i = _q->num_p++;
+        _q->p[i] = packetizer_create(_n, _crc, _fec0, _fec1);
+    } else {
+        // replace least-recently used entry
+        i = i_lru;
+        packetizer_destroy(_q->p[i]);
+        _q->p[i] = packetizer_create(_n, _crc, _fec0, _fec1);
+    }
+
+    _q->p_access[i] = ++_q->counter;
+    return _q->p[i];
+}
+
+// get number of cached modems
+unsigned int framecache_get_num_modems(framecache _q)
+{
+    return _q->num_mod;
+}
+
+// get number of cached packetizers
+unsigned int framecache_get_num_packetizers(framecache _q)
+{
+    return _q->num_p;
+}
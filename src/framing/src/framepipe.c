@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+//
+// framepipe.c
+//
+// pipelined frame decoding: a frame synchronizer front end hands
+// received frames to a bounded ring of jobs which a pool of worker
+// threads decode concurrently; results are delivered one at a time
+// in the order the frames were submitted
+//
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+#if HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+
+struct framepipe_s {
+    unsigned int    num_threads;    // number of worker threads
+    unsigned int    num_jobs;       // number of job slots
+    unsigned int    job_size;       // size of each job (bytes)
+    unsigned char * jobs;           // job memory [size: num_jobs*job_size]
+
+    // callbacks
+    framepipe_worker_create_callback  worker_create;
+    framepipe_worker_destroy_callback worker_destroy;
+    framepipe_decode_callback         decode;
+    framepipe_deliver_callback        deliver;
+    void *                            userdata;
+
+    // job sequence counters (slot index is counter modulo num_jobs)
+    unsigned long int num_submitted;    // jobs handed off by front end
+    unsigned long int num_claimed;      // jobs taken by workers
+    unsigned long int num_delivered;    // jobs delivered
+
+    void ** workers;                // worker-specific decoder state
+
+#if HAVE_PTHREAD_H
+    pthread_t *     threads;        // worker threads
+    pthread_mutex_t mutex;          // protects counters
+    pthread_cond_t  cond;           // signals any counter change
+    pthread_mutex_t deliver_mutex;  // held while delivering (recursive)
+    unsigned int    num_started;    // number of workers started
+    int             shutdown;       // workers exit when set
+#endif
+};
+
+#if HAVE_PTHREAD_H
+// worker thread: claim next job, decode, then deliver in order
+static void * framepipe_worker(void * _arg);
+#endif
+
+// create frame pipeline
+//  _num_threads    :   number of worker threads (0: decode inline on submit)
+//  _num_jobs       :   number of job slots, _num_jobs > 0
+//  _job_size       :   size of each job (bytes)
+//  _worker_create  :   create per-worker decoder state
+//  _worker_destroy :   destroy per-worker decoder state
+//  _decode         :   decode job (runs concurrently on workers)
+//  _deliver        :   deliver decoded job (runs serially, in order)
+//  _userdata       :   user-defined data passed to callbacks
+framepipe framepipe_create(unsigned int                      _num_threads,
+                           unsigned int                      _num_jobs,
+                           unsigned int                      _job_size,
+                           framepipe_worker_create_callback  _worker_create,
+                           framepipe_worker_destroy_callback _worker_destroy,
+                           framepipe_decode_callback         _decode,
+                           framepipe_deliver_callback        _deliver,
+                           void *                            _userdata)
+{
+    // validate input
+    if (_num_jobs == 0) {
+        fprintf(stderr,"error: framepipe_create(), number of jobs must be greater than zero\n");
+        exit(1);
+    }
+
+    framepipe q = (framepipe) malloc(sizeof(struct framepipe_s));
+#if HAVE_PTHREAD_H
+    q->num_threads = _num_threads;
+#else
+    // decode inline when threads are not available
+    q->num_threads = 0;
+#endif
+    q->num_jobs       = _num_jobs;
+    q->job_size       = _job_size;
+    q->jobs           = (unsigned char*) calloc(q->num_jobs, q->job_size);
+    q->worker_create  = _worker_create;
+    q->worker_destroy = _worker_destroy;
+    q->decode         = _decode;
+    q->deliver        = _deliver;
+    q->userdata       = _userdata;
+    q->num_submitted  = 0;
+    q->num_claimed    = 0;
+    q->num_delivered  = 0;
+
+    // create decoder state for each worker (one for inline decoding)
+    unsigned int i;
+    unsigned int num_workers = q->num_threads > 0 ? q->num_threads : 1;
+    q->workers = (void**) malloc(num_workers*sizeof(void*));
+    for (i=0; i<num_workers; i++)
+        q->workers[i] = q->worker_create(q->userdata);
+
+#if HAVE_PTHREAD_H
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&q->deliver_mutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+    pthread_mutex_init(&q->mutex, NULL);
+    pthread_cond_init(&q->cond, NULL);
+    q->num_started = 0;
+    q->shutdown    = 0;
+
+    // start worker threads
+    q->threads = (pthread_t*) malloc(q->num_threads*sizeof(pthread_t));
+    for (i=0; i<q->num_threads; i++) {
+        if (pthread_create(&q->threads[i], NULL, framepipe_worker, (void*)q) != 0) {
+            fprintf(stderr,"error: framepipe_create(), could not create worker thread\n");
+            exit(1);
+        }
+    }
+#endif
+
+    return q;
+}
+
+// destroy frame pipeline, waiting for all submitted jobs to be
+// delivered; per-job buffers must be released by the caller first
+// (see framepipe_get_job())
+void framepipe_destroy(framepipe _q)
+{
+    unsigned int i;
+#if HAVE_PTHREAD_H
+    // stop and join worker threads
+    pthread_mutex_lock(&_q->mutex);
+    while (_q->num_delivered != _q->num_submitted)
+        pthread_cond_wait(&_q->cond, &_q->mutex);
+    _q->shutdown = 1;
+    pthread_cond_broadcast(&_q->cond);
+    pthread_mutex_unlock(&_q->mutex);
+    for (i=0; i<_q->num_threads; i++)
+        pthread_join(_q->threads[i], NULL);
+    free(_q->threads);
+
+    pthread_cond_destroy(&_q->cond);
+    pthread_mutex_destroy(&_q->mutex);
+    pthread_mutex_destroy(&_q->deliver_mutex);
+#endif
+
+    // destroy worker state
+    unsigned int num_workers = _q->num_threads > 0 ? _q->num_threads : 1;
+    for (i=0; i<num_workers; i++)
+        _q->worker_destroy(_q->workers[i]);
+    free(_q->workers);
+
+    free(_q->jobs);
+    free(_q);
+}
+
+// get number of worker threads
+unsigned int framepipe_get_num_threads(framepipe _q)
+{
+    return _q->num_threads;
+}
+
+// get number of job slots
+unsigned int framepipe_get_num_jobs(framepipe _q)
+{
+    return _q->num_jobs;
+}
+
+// get pointer to job slot _i, e.g. to release buffers attached to it;
+// only valid while no jobs are pending
+void * framepipe_get_job(framepipe    _q,
+                         unsigned int _i)
+{
+    return _q->jobs + (_i % _q->num_jobs)*_q->job_size;
+}
+
+// get next free job slot for the front end to fill, blocking while
+// all slots are pending; buffers attached to a job persist across uses
+void * framepipe_acquire(framepipe _q)
+{
+#if HAVE_PTHREAD_H
+    pthread_mutex_lock(&_q->mutex);
+    while (_q->num_submitted - _q->num_delivered == _q->num_jobs)
+        pthread_cond_wait(&_q->cond, &_q->mutex);
+    pthread_mutex_unlock(&_q->mutex);
+#endif
+    return framepipe_get_job(_q, _q->num_submitted);
+}
+
+// submit job obtained with framepipe_acquire()
+void framepipe_submit(framepipe _q)
+{
+    if (_q->num_threads == 0) {
+        // decode and deliver inline
+        void * job = framepipe_get_job(_q, _q->num_submitted);
+        _q->num_submitted++;
+        _q->decode(_q->userdata, _q->workers[0], job);
+        framepipe_lock(_q);
+        _q->deliver(_q->userdata, job);
+        framepipe_unlock(_q);
+        _q->num_claimed++;
+        _q->num_delivered++;
+        return;
+    }
+
+#if HAVE_PTHREAD_H
+    pthread_mutex_lock(&_q->mutex);
+    _q->num_submitted++;
+    pthread_cond_broadcast(&_q->cond);
+    pthread_mutex_unlock(&_q->mutex);
+#endif
+}
+
+// block until all submitted jobs have been delivered; must not be
+// called from within the deliver callback
+void framepipe_wait(framepipe _q)
+{
+#if HAVE_PTHREAD_H
+    pthread_mutex_lock(&_q->mutex);
+    while (_q->num_delivered != _q->num_submitted)
+        pthread_cond_wait(&_q->cond, &_q->mutex);
+    pthread_mutex_unlock(&_q->mutex);
+#endif
+}
+
+// lock against concurrent delivery, e.g. to read state updated by the
+// deliver callback; may be called from within the callback itself
+void framepipe_lock(framepipe _q)
+{
+#if HAVE_PTHREAD_H
+    pthread_mutex_lock(&_q->deliver_mutex);
+#endif
+}
+
+// release lock obtained with framepipe_lock()
+void framepipe_unlock(framepipe _q)
+{
+#if HAVE_PTHREAD_H
+    pthread_mutex_unlock(&_q->deliver_mutex);
+#endif
+}
+
+#if HAVE_PTHREAD_H
+static void * framepipe_worker(void * _arg)
+{
+    framepipe q = (framepipe) _arg;
+
+    // take next unused worker decoder state
+    pthread_mutex_lock(&q->mutex);
+    void * worker = q->workers[q->num_started++];
+    while (1) {
+        // wait for a job (or shutdown)
+        while (q->num_claimed == q->num_submitted && !q->shutdown)
+            pthread_cond_wait(&q->cond, &q->mutex);
+        if (q->num_claimed == q->num_submitted)
+            break;
+
+        unsigned long int n = q->num_claimed++;
+        void * job = framepipe_get_job(q, n);
+        pthread_mutex_unlock(&q->mutex);
+
+        // decode concurrently with other workers
+        q->decode(q->userdata, worker, job);
+
+        // wait for turn to deliver
+        pthread_mutex_lock(&q->mutex);
+        while (q->num_delivered != n)
+            pthread_cond_wait(&q->cond, &q->mutex);
+        pthread_mutex_unlock(&q->mutex);
+
+        framepipe_lock(q);
+        q->deliver(q->userdata, job);
+        framepipe_unlock(q);
+
+        pthread_mutex_lock(&q->mutex);
+        q->num_delivered++;
+        pthread_cond_broadcast(&q->cond);
+    }
+    pthread_mutex_unlock(&q->mutex);
+    return NULL;
+}
+#endif
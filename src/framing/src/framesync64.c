@@ -62,6 +62,27 @@ void framesync64_execute_rxpreamble(framesync64   _q,
 void framesync64_execute_rxpayload(framesync64   _q,
                                    float complex _x);
 
+// frame handed to decoder threads (pipelined mode)
+struct framesync64_job_s {
+    float complex    payload_rx [630];  // received payload symbols with pilots
+    float complex    payload_sym[600];  // received payload symbols
+    unsigned char    payload_dec[ 72];  // decoded payload bytes
+    int              payload_valid;     // did payload pass crc?
+    framesyncstats_s framestats;        // frame statistics
+};
+
+// decoder objects owned by one decoder thread
+struct framesync64_worker_s {
+    qpacketmodem dec;                   // packet demodulator/decoder
+    qpilotsync   pilotsync;             // pilot extraction, carrier recovery
+};
+
+// pipeline callbacks: per-thread payload decoder, decode, deliver
+void * framesync64_worker_create(void * _userdata);
+void   framesync64_worker_destroy(void * _worker);
+void   framesync64_job_decode(void * _userdata, void * _worker, void * _job);
+void   framesync64_job_deliver(void * _userdata, void * _job);
+
 // framesync64 object structure
 struct framesync64_s {
     // callback
@@ -99,6 +120,9 @@ struct framesync64_s {
     qpacketmodem  dec;              // packet demodulator/decoder
     qpilotsync    pilotsync;        // pilot extraction, carrier recovery
     int           payload_valid;    // did payload pass crc?
+
+    // pipelined payload decoding (NULL: decode in sample loop)
+    framepipe     pipe;
     
     // status variables
     enum {
@@ -171,6 +195,9 @@ framesync64 framesync64_create(framesync_callback _callback,
     q->pilotsync   = qpilotsync_create(600, 21);
     assert( qpilotsync_get_frame_len(q->pilotsync)==630 );
 
+    // payload decoded in sample loop until threads are requested
+    q->pipe = NULL;
+
 #if DEBUG_FRAMESYNC64
     // set debugging flags, objects to NULL
     q->debug_enabled         = 0;
@@ -193,6 +220,10 @@ void framesync64_destroy(framesync64 _q)
     }
 #endif
 
+    // wait for pending frames and stop decoder threads
+    if (_q->pipe != NULL)
+        framepipe_destroy(_q->pipe);
+
     // destroy synchronization objects
     qdetector_cccf_destroy(_q->detector);   // frame detector
     firpfb_crcf_destroy   (_q->mf);         // matched filter
@@ -423,7 +454,18 @@ void framesync64_execute_rxpayload(framesync64   _q,
         // increment counter
         _q->payload_counter++;
 
-        if (_q->payload_counter == 630) {
+        if (_q->payload_counter == 630 && _q->pipe != NULL) {
+            // hand received symbols to decoder threads
+            struct framesync64_job_s * job = framepipe_acquire(_q->pipe);
+            memmove(job->payload_rx, _q->payload_rx, 630*sizeof(float complex));
+            job->framestats.rssi = 20*log10f(_q->gamma_hat);
+            job->framestats.cfo  = nco_crcf_get_frequency(_q->mixer);
+            framepipe_submit(_q->pipe);
+
+            // reset frame synchronizer
+            framesync64_reset(_q);
+            return;
+        } else if (_q->payload_counter == 630) {
             // recover data symbols from pilots
             qpilotsync_execute(_q->pilotsync, _q->payload_rx, _q->payload_sym);
 
@@ -463,6 +505,99 @@ void framesync64_execute_rxpayload(framesync64   _q,
     }
 }
 
+// set number of threads decoding payloads; frames are delivered to
+// the callback (from a decoder thread) in the order they were received
+//  _q           :   frame synchronizer object
+//  _num_threads :   number of decoder threads (0: decode in sample loop)
+void framesync64_set_num_threads(framesync64  _q,
+                                 unsigned int _num_threads)
+{
+    if (_q->pipe != NULL) {
+        framepipe_destroy(_q->pipe);
+        _q->pipe = NULL;
+    }
+    if (_num_threads == 0)
+        return;
+
+    _q->pipe = framepipe_create(_num_threads,
+                                4*_num_threads,
+                                sizeof(struct framesync64_job_s),
+                                framesync64_worker_create,
+                                framesync64_worker_destroy,
+                                framesync64_job_decode,
+                                framesync64_job_deliver,
+                                (void*)_q);
+}
+
+// block until all frames handed to decoder threads have been delivered
+void framesync64_wait(framesync64 _q)
+{
+    if (_q->pipe != NULL)
+        framepipe_wait(_q->pipe);
+}
+
+// create pilot synchronizer and payload decoder for one decoder thread
+void * framesync64_worker_create(void * _userdata)
+{
+    struct framesync64_worker_s * w = (struct framesync64_worker_s *)
+        malloc(sizeof(struct framesync64_worker_s));
+    w->dec = qpacketmodem_create();
+    qpacketmodem_configure(w->dec, 72, LIQUID_CRC_24, LIQUID_FEC_NONE,
+                           LIQUID_FEC_GOLAY2412, LIQUID_MODEM_QPSK);
+    w->pilotsync = qpilotsync_create(600, 21);
+    return (void*) w;
+}
+
+// destroy decoder thread objects
+void framesync64_worker_destroy(void * _worker)
+{
+    struct framesync64_worker_s * w = (struct framesync64_worker_s *) _worker;
+    qpacketmodem_destroy(w->dec);
+    qpilotsync_destroy(w->pilotsync);
+    free(w);
+}
+
+// recover and decode payload (runs on decoder thread)
+void framesync64_job_decode(void * _userdata,
+                            void * _worker,
+                            void * _job)
+{
+    struct framesync64_worker_s * w   = (struct framesync64_worker_s *) _worker;
+    struct framesync64_job_s *    job = (struct framesync64_job_s *) _job;
+
+    qpilotsync_execute(w->pilotsync, job->payload_rx, job->payload_sym);
+    job->payload_valid = qpacketmodem_decode(w->dec, job->payload_sym, job->payload_dec);
+}
+
+// invoke callback (runs in frame order)
+void framesync64_job_deliver(void * _userdata,
+                             void * _job)
+{
+    framesync64 _q = (framesync64) _userdata;
+    struct framesync64_job_s * job = (struct framesync64_job_s *) _job;
+    if (_q->callback == NULL)
+        return;
+
+    // set framestats internals
+    job->framestats.evm           = 0.0f;
+    job->framestats.framesyms     = job->payload_sym;
+    job->framestats.num_framesyms = 600;
+    job->framestats.mod_scheme    = LIQUID_MODEM_QPSK;
+    job->framestats.mod_bps       = 2;
+    job->framestats.check         = LIQUID_CRC_24;
+    job->framestats.fec0          = LIQUID_FEC_NONE;
+    job->framestats.fec1          = LIQUID_FEC_GOLAY2412;
+
+    // invoke callback method
+    _q->callback(&job->payload_dec[0],  // header is first 8 bytes
+                 job->payload_valid,
+                 &job->payload_dec[8],  // payload is last 64 bytes
+                 64,
+                 job->payload_valid,
+                 job->framestats,
+                 _q->userdata);
+}
+
 // enable debugging
 void framesync64_debug_enable(framesync64 _q)
 {
@@ -123,7 +123,10 @@ struct gmskframesync_s {
     unsigned int payload_dec_len;   // payload length (num un-encoded bytes)
     unsigned char * payload_enc;    // payload data (encoded bytes)
     unsigned char * payload_dec;    // payload data (encoded bytes)
-    packetizer p_payload;           // payload packetizer
+    unsigned int payload_enc_size;  // allocated length of payload_enc
+    unsigned int payload_dec_size;  // allocated length of payload_dec
+    framecache payload_cache;       // payload packetizers
+    packetizer p_payload;           // payload packetizer (cached)
     int payload_valid;              // did payload pass crc?
     
     // status variables
@@ -223,13 +226,17 @@ gmskframesync gmskframesync_create(framesync_callback _callback,
     q->check           = LIQUID_CRC_32;
     q->fec0            = LIQUID_FEC_NONE;
     q->fec1            = LIQUID_FEC_NONE;
-    q->p_payload = packetizer_create(q->payload_dec_len,
-                                     q->check,
-                                     q->fec0,
-                                     q->fec1);
-    q->payload_enc_len = packetizer_get_enc_msg_len(q->p_payload);
-    q->payload_dec = (unsigned char*) malloc(q->payload_dec_len*sizeof(unsigned char));
-    q->payload_enc = (unsigned char*) malloc(q->payload_enc_len*sizeof(unsigned char));
+    q->payload_cache = framecache_create(FRAMECACHE_CAPACITY);
+    q->p_payload = framecache_get_packetizer(q->payload_cache,
+                                             q->payload_dec_len,
+                                             q->check,
+                                             q->fec0,
+                                             q->fec1);
+    q->payload_enc_len  = packetizer_get_enc_msg_len(q->p_payload);
+    q->payload_dec_size = q->payload_dec_len;
+    q->payload_enc_size = q->payload_enc_len;
+    q->payload_dec = (unsigned char*) malloc(q->payload_dec_size*sizeof(unsigned char));
+    q->payload_enc = (unsigned char*) malloc(q->payload_enc_size*sizeof(unsigned char));
 
 #if DEBUG_GMSKFRAMESYNC
     // debugging structures
@@ -283,7 +290,7 @@ void gmskframesync_destroy(gmskframesync _q)
     free(_q->header_dec);
 
     // payload
-    packetizer_destroy(_q->p_payload);
+    framecache_destroy(_q->payload_cache);
     free(_q->payload_enc);
     free(_q->payload_dec);
 
@@ -798,12 +805,12 @@ void gmskframesync_decode_header(gmskframesync _q)
         _q->fec0            = fec0;
         _q->fec1            = fec1;
         
-        // recreate packetizer object
-        _q->p_payload = packetizer_recreate(_q->p_payload,
-                                            _q->payload_dec_len,
-                                            _q->check,
-                                            _q->fec0,
-                                            _q->fec1);
+        // get packetizer object from cache
+        _q->p_payload = framecache_get_packetizer(_q->payload_cache,
+                                                  _q->payload_dec_len,
+                                                  _q->check,
+                                                  _q->fec0,
+                                                  _q->fec1);
 
         // re-compute payload encoded message length
         _q->payload_enc_len = packetizer_get_enc_msg_len(_q->p_payload);
@@ -811,9 +818,15 @@ void gmskframesync_decode_header(gmskframesync _q)
         printf("      * payload encoded :   %u bytes\n", _q->payload_enc_len);
 #endif
 
-        // re-allocate buffers accordingly
-        _q->payload_enc = (unsigned char*) realloc(_q->payload_enc, _q->payload_enc_len*sizeof(unsigned char));
-        _q->payload_dec = (unsigned char*) realloc(_q->payload_dec, _q->payload_dec_len*sizeof(unsigned char));
+        // grow buffers as needed (never shrunk)
+        if (_q->payload_enc_len > _q->payload_enc_size) {
+            _q->payload_enc_size = _q->payload_enc_len;
+            _q->payload_enc = (unsigned char*) realloc(_q->payload_enc, _q->payload_enc_size*sizeof(unsigned char));
+        }
+        if (_q->payload_dec_len > _q->payload_dec_size) {
+            _q->payload_dec_size = _q->payload_dec_len;
+            _q->payload_dec = (unsigned char*) realloc(_q->payload_dec, _q->payload_dec_size*sizeof(unsigned char));
+        }
     }
     //
 }
@@ -87,6 +87,7 @@ void QSOURCE(_set_frequency)(QSOURCE() _q,
                              float     _dphi);
 
 void QSOURCE(_gen_sample)(QSOURCE() _q,
+                          randgen   _rng,
                           TO *      _v);
 
 // internal structure
@@ -96,6 +97,9 @@ struct MSOURCE(_s)
     unsigned int num_sources;
 
     int id_counter;
+
+    randgen rng_internal;   // internal random number generator (owned)
+    randgen rng;            // active random number generator
 };
 
 //
@@ -117,6 +121,11 @@ MSOURCE() MSOURCE(_create)(void)
     q->num_sources = 0;
     q->id_counter  = 0;
 
+    // internal random number generator, seeded from rand() so that
+    // separate objects generate independent noise
+    q->rng_internal = randgen_create(rand());
+    q->rng          = q->rng_internal;
+
     // reset and return main object
     MSOURCE(_reset)(q);
     return q;
@@ -133,6 +142,9 @@ void MSOURCE(_destroy)(MSOURCE() _q)
     // free list of sources
     free(_q->sources);
 
+    // destroy internal random number generator
+    randgen_destroy(_q->rng_internal);
+
     // free main object
     free(_q);
 }
@@ -142,6 +154,13 @@ void MSOURCE(_reset)(MSOURCE() _q)
 {
 }
 
+// set random number generator used for noise sources
+void MSOURCE(_set_randgen)(MSOURCE() _q,
+                           randgen   _rng)
+{
+    _q->rng = (_rng == NULL) ? _q->rng_internal : _rng;
+}
+
 // print
 void MSOURCE(_print)(MSOURCE() _q)
 {
@@ -304,7 +323,7 @@ void MSOURCE(_write_samples)(MSOURCE()    _q,
         accumulation = 0;
 
         for (j=0; j<_q->num_sources; j++) {
-            QSOURCE(_gen_sample)(_q->sources[j], &sample);
+            QSOURCE(_gen_sample)(_q->sources[j], _q->rng, &sample);
             accumulation += sample;
         }
 
@@ -478,6 +497,7 @@ void QSOURCE(_set_frequency)(QSOURCE() _q,
 }
 
 void QSOURCE(_gen_sample)(QSOURCE() _q,
+                          randgen   _rng,
                           TO *      _v)
 {
     TO sample;
@@ -488,7 +508,7 @@ void QSOURCE(_gen_sample)(QSOURCE() _q,
         sample = 1.0f;
         break;
     case QSOURCE_NOISE:
-        IIRFILT(_execute)(_q->source.noise.filter, (randnf() + _Complex_I*randnf())*M_SQRT1_2, &sample);
+        IIRFILT(_execute)(_q->source.noise.filter, randgen_cgauss(_rng), &sample);
         break;
     case QSOURCE_MODEM:
         SYMSTREAM(_write_samples)(_q->source.linmod.symstream, &sample, 1);
@@ -95,12 +95,16 @@ struct ofdmflexframesync_s {
     fec_scheme fec1;                    // payload FEC (outer)
 
     // payload
-    packetizer p_payload;               // payload packetizer
-    modem mod_payload;                  // payload demodulator
+    framecache payload_cache;           // payload packetizers, demodulators
+    packetizer p_payload;               // payload packetizer (cached)
+    modem mod_payload;                  // payload demodulator (cached)
     unsigned char * payload_enc;        // payload data (encoded bytes)
     unsigned char * payload_dec;        // payload data (decoded bytes)
     unsigned int payload_enc_len;       // length of encoded payload
     unsigned int payload_mod_len;       // number of payload modem symbols
+    unsigned int payload_enc_size;      // allocated length of payload_enc
+    unsigned int payload_dec_size;      // allocated length of payload_dec
+    unsigned int payload_syms_size;     // allocated length of payload_syms
     int payload_valid;                  // valid payload flag
     float complex * payload_syms;       // received payload symbols
 
@@ -192,12 +196,17 @@ ofdmflexframesync ofdmflexframesync_create(unsigned int       _M,
     q->fec1         = LIQUID_FEC_NONE;
 
     // create payload objects (initally QPSK, etc but overridden by received properties)
-    q->mod_payload = modem_create(q->ms_payload);
-    q->p_payload   = packetizer_create(q->payload_len, q->check, q->fec0, q->fec1);
-    q->payload_enc_len = packetizer_get_enc_msg_len(q->p_payload);
-    q->payload_enc = (unsigned char*) malloc(q->payload_enc_len*sizeof(unsigned char));
-    q->payload_dec = (unsigned char*) malloc(q->payload_len*sizeof(unsigned char));
-    q->payload_syms = (float complex *) malloc(q->payload_len*sizeof(float complex));
+    q->payload_cache = framecache_create(FRAMECACHE_CAPACITY);
+    q->mod_payload = framecache_get_modem(q->payload_cache, q->ms_payload);
+    q->p_payload   = framecache_get_packetizer(q->payload_cache,
+                                               q->payload_len, q->check, q->fec0, q->fec1);
+    q->payload_enc_len   = packetizer_get_enc_msg_len(q->p_payload);
+    q->payload_enc_size  = q->payload_enc_len;
+    q->payload_dec_size  = q->payload_len;
+    q->payload_syms_size = q->payload_len;
+    q->payload_enc = (unsigned char*) malloc(q->payload_enc_size*sizeof(unsigned char));
+    q->payload_dec = (unsigned char*) malloc(q->payload_dec_size*sizeof(unsigned char));
+    q->payload_syms = (float complex *) malloc(q->payload_syms_size*sizeof(float complex));
     q->payload_mod_len = 0;
 
     // reset state
@@ -213,8 +222,7 @@ void ofdmflexframesync_destroy(ofdmflexframesync _q)
     ofdmframesync_destroy(_q->fs);
     packetizer_destroy(_q->p_header);
     modem_destroy(_q->mod_header);
-    packetizer_destroy(_q->p_payload);
-    modem_destroy(_q->mod_payload);
+    framecache_destroy(_q->payload_cache);
 
     // free internal buffers/arrays
     free(_q->p);
@@ -539,8 +547,8 @@ void ofdmflexframesync_decode_header(ofdmflexframesync _q)
             _q->ms_payload  = mod_scheme;
             _q->bps_payload = modulation_types[mod_scheme].bps;
 
-            // recreate modem (destroy/create)
-            _q->mod_payload = modem_recreate(_q->mod_payload, _q->ms_payload);
+            // get modem from cache
+            _q->mod_payload = framecache_get_modem(_q->payload_cache, _q->ms_payload);
         }
 
         // set new packetizer properties
@@ -549,12 +557,12 @@ void ofdmflexframesync_decode_header(ofdmflexframesync _q)
         _q->fec0        = fec0;
         _q->fec1        = fec1;
         
-        // recreate packetizer object
-        _q->p_payload = packetizer_recreate(_q->p_payload,
-                                            _q->payload_len,
-                                            _q->check,
-                                            _q->fec0,
-                                            _q->fec1);
+        // get packetizer object from cache
+        _q->p_payload = framecache_get_packetizer(_q->payload_cache,
+                                                  _q->payload_len,
+                                                  _q->check,
+                                                  _q->fec0,
+                                                  _q->fec1);
 
         // re-compute payload encoded message length
         _q->payload_enc_len = packetizer_get_enc_msg_len(_q->p_payload);
@@ -562,14 +570,23 @@ void ofdmflexframesync_decode_header(ofdmflexframesync _q)
         printf("      * payload encoded :   %u bytes\n", _q->payload_enc_len);
 #endif
 
-        // re-allocate buffers accordingly
-        _q->payload_enc = (unsigned char*) realloc(_q->payload_enc, _q->payload_enc_len*sizeof(unsigned char));
-        _q->payload_dec = (unsigned char*) realloc(_q->payload_dec, _q->payload_len*sizeof(unsigned char));
+        // grow buffers as needed (never shrunk)
+        if (_q->payload_enc_len > _q->payload_enc_size) {
+            _q->payload_enc_size = _q->payload_enc_len;
+            _q->payload_enc = (unsigned char*) realloc(_q->payload_enc, _q->payload_enc_size*sizeof(unsigned char));
+        }
+        if (_q->payload_len > _q->payload_dec_size) {
+            _q->payload_dec_size = _q->payload_len;
+            _q->payload_dec = (unsigned char*) realloc(_q->payload_dec, _q->payload_dec_size*sizeof(unsigned char));
+        }
 
         // re-compute number of modulated payload symbols
         div_t d = div(8*_q->payload_enc_len, _q->bps_payload);
         _q->payload_mod_len = d.quot + (d.rem ? 1 : 0);
-        _q->payload_syms = (float complex*) realloc(_q->payload_syms, _q->payload_mod_len*sizeof(float complex));
+        if (_q->payload_mod_len > _q->payload_syms_size) {
+            _q->payload_syms_size = _q->payload_mod_len;
+            _q->payload_syms = (float complex*) realloc(_q->payload_syms, _q->payload_syms_size*sizeof(float complex));
+        }
 #if DEBUG_OFDMFLEXFRAMESYNC
         printf("      * payload mod syms:   %u symbols\n", _q->payload_mod_len);
 #endif
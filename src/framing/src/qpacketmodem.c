@@ -40,8 +40,9 @@
 
 struct qpacketmodem_s {
     // properties
-    modem           mod_payload;        // payload modulator/demodulator
-    packetizer      p;                  // packet encoder/decoder
+    framecache      cache;              // cached modems, packetizers
+    modem           mod_payload;        // payload modulator/demodulator (cached)
+    packetizer      p;                  // packet encoder/decoder (cached)
     unsigned int    bits_per_symbol;    // modulator bits/symbol
     unsigned int    payload_dec_len;    // number of decoded payload bytes
     unsigned char * payload_enc;        // payload data (encoded bytes)
@@ -49,6 +50,8 @@ struct qpacketmodem_s {
     unsigned int    payload_enc_len;    // number of encoded payload bytes
     unsigned int    payload_bit_len;    // number of bits in encoded payload
     unsigned int    payload_mod_len;    // number of symbols in encoded payload
+    unsigned int    payload_enc_size;   // allocated length of payload_enc
+    unsigned int    payload_mod_size;   // allocated length of payload_mod
 };
 
 // create packet encoder
@@ -57,16 +60,20 @@ qpacketmodem qpacketmodem_create()
     // allocate memory for main object
     qpacketmodem q = (qpacketmodem) malloc(sizeof(struct qpacketmodem_s));
 
+    // create cache of payload objects
+    q->cache = framecache_create(FRAMECACHE_CAPACITY);
+
     // create payload modem (initially QPSK, overridden by properties)
-    q->mod_payload = modem_create(LIQUID_MODEM_QPSK);
+    q->mod_payload = framecache_get_modem(q->cache, LIQUID_MODEM_QPSK);
     q->bits_per_symbol = 2;
     
     // initial memory allocation for payload
     q->payload_dec_len = 1;
-    q->p = packetizer_create(q->payload_dec_len,
-                             LIQUID_CRC_NONE,
-                             LIQUID_FEC_NONE,
-                             LIQUID_FEC_NONE);
+    q->p = framecache_get_packetizer(q->cache,
+                                     q->payload_dec_len,
+                                     LIQUID_CRC_NONE,
+                                     LIQUID_FEC_NONE,
+                                     LIQUID_FEC_NONE);
 
     // number of bytes in encoded payload
     q->payload_enc_len = packetizer_get_enc_msg_len(q->p);
@@ -80,15 +87,17 @@ qpacketmodem qpacketmodem_create()
 
 #if QPACKETMODEM_SOFT
     // soft demodulator uses one byte to represent each soft bit
-    q->payload_enc = (unsigned char*) malloc(q->bits_per_symbol*q->payload_mod_len*sizeof(unsigned char));
+    q->payload_enc_size = q->bits_per_symbol*q->payload_mod_len;
 #else
     // hard demodulator compacts demodulated output bits into array
-    q->payload_enc = (unsigned char*) malloc(q->payload_enc_len*sizeof(unsigned char));
+    q->payload_enc_size = q->payload_enc_len;
 #endif
+    q->payload_enc = (unsigned char*) malloc(q->payload_enc_size*sizeof(unsigned char));
 
     // set symbol length appropriately
-    q->payload_mod_len = q->payload_enc_len * 4;    // for QPSK
-    q->payload_mod = (unsigned char*) malloc(q->payload_mod_len*sizeof(unsigned char));
+    q->payload_mod_len  = q->payload_enc_len * 4;    // for QPSK
+    q->payload_mod_size = q->payload_mod_len;
+    q->payload_mod = (unsigned char*) malloc(q->payload_mod_size*sizeof(unsigned char));
 
     // return pointer to main object
     return q;
@@ -97,13 +106,15 @@ qpacketmodem qpacketmodem_create()
 // destroy object, freeing all internal arrays
 void qpacketmodem_destroy(qpacketmodem _q)
 {
-    // free objects
-    packetizer_destroy(_q->p);
-    modem_destroy(_q->mod_payload);
+    // free cached modem, packetizer objects
+    framecache_destroy(_q->cache);
 
     // free arrays
     free(_q->payload_enc);
     free(_q->payload_mod);
+
+    // free main object memory
+    free(_q);
 }
 
 // reset object
@@ -137,12 +148,12 @@ int qpacketmodem_configure(qpacketmodem _q,
     // set new decoded message length
     _q->payload_dec_len = _payload_len;
 
-    // recreate modem object and get new bits per symbol
-    _q->mod_payload = modem_recreate(_q->mod_payload, _ms);
+    // get modem object from cache and get new bits per symbol
+    _q->mod_payload = framecache_get_modem(_q->cache, _ms);
     _q->bits_per_symbol = modem_get_bps(_q->mod_payload);
 
-    // recreate packetizer object and compute new encoded payload length
-    _q->p = packetizer_recreate(_q->p, _q->payload_dec_len, _check, _fec0, _fec1);
+    // get packetizer object from cache and compute new encoded payload length
+    _q->p = framecache_get_packetizer(_q->cache, _q->payload_dec_len, _check, _fec0, _fec1);
     _q->payload_enc_len = packetizer_get_enc_msg_len(_q->p);
 
     // number of bits in encoded payload
@@ -152,17 +163,25 @@ int qpacketmodem_configure(qpacketmodem _q,
     div_t d = div(_q->payload_bit_len, _q->bits_per_symbol);
     _q->payload_mod_len = d.quot + (d.rem ? 1 : 0);
 
+    // grow buffers as needed; they are never shrunk so that switching
+    // between known configurations does not allocate memory
 #if QPACKETMODEM_SOFT
-    _q->payload_enc = (unsigned char*) realloc(_q->payload_enc,
-            _q->bits_per_symbol*_q->payload_mod_len*sizeof(unsigned char));
+    unsigned int payload_enc_size = _q->bits_per_symbol*_q->payload_mod_len;
 #else
-    _q->payload_enc = (unsigned char*) realloc(_q->payload_enc,
-                                               _q->payload_enc_len*sizeof(unsigned char));
+    unsigned int payload_enc_size = _q->payload_enc_len;
 #endif
+    if (payload_enc_size > _q->payload_enc_size) {
+        _q->payload_enc_size = payload_enc_size;
+        _q->payload_enc = (unsigned char*) realloc(_q->payload_enc,
+                                                   _q->payload_enc_size*sizeof(unsigned char));
+    }
 
     // reallocate memory for modem symbols
-    _q->payload_mod = (unsigned char*) realloc(_q->payload_mod,
-                                               _q->payload_mod_len*sizeof(unsigned char));
+    if (_q->payload_mod_len > _q->payload_mod_size) {
+        _q->payload_mod_size = _q->payload_mod_len;
+        _q->payload_mod = (unsigned char*) realloc(_q->payload_mod,
+                                                   _q->payload_mod_size*sizeof(unsigned char));
+    }
 
     return 0;
 }
@@ -260,21 +279,21 @@ int qpacketmodem_decode(qpacketmodem    _q,
 {
     unsigned int i;
 
-    // demodulate and pack bytes into decoder input buffer
+    // demodulate symbols
     unsigned int sym;
-    //memset(_q->payload_enc, 0x00, _q->payload_enc_len*sizeof(unsigned char));
     for (i=0; i<_q->payload_mod_len; i++) {
-        // demodulate symbol
         modem_demodulate(_q->mod_payload, _frame[i], &sym);
-
-        // pack decoded symbol into array
-        liquid_pack_array(_q->payload_enc,
-                          _q->payload_enc_len,
-                          i * _q->bits_per_symbol,
-                          _q->bits_per_symbol,
-                          sym);
+        _q->payload_mod[i] = sym;
     }
 
+    // pack decoded symbols into decoder input buffer
+    liquid_pack_array_block(_q->payload_enc,
+                            _q->payload_enc_len,
+                            0,
+                            _q->bits_per_symbol,
+                            _q->payload_mod,
+                            _q->payload_mod_len);
+
     // decode payload
     int payload_valid = packetizer_decode(_q->p, _q->payload_enc, _payload);
 
@@ -25,6 +25,7 @@
 #include <math.h>
 #include "autotest/autotest.h"
 #include "liquid.h"
+#include "src/framing/tests/framesync_runtest.h"
 
 // 
 // AUTOTEST : test simple recovery of frame in noise
@@ -89,3 +90,125 @@ void autotest_flexframesync()
     flexframesync_destroy(fs);
 }
 
+
+// 
+// AUTOTEST : recover frames while rotating through payload configurations
+//
+void autotest_flexframesync_reconfig()
+{
+    unsigned int i, j;
+
+    // payload configurations: modulation, inner/outer fec, length
+    struct {
+        int          ms;
+        int          fec0;
+        int          fec1;
+        unsigned int payload_len;
+    } config[4] = {
+        {LIQUID_MODEM_QPSK,   LIQUID_FEC_NONE,      LIQUID_FEC_NONE,      200},
+        {LIQUID_MODEM_QAM16,  LIQUID_FEC_HAMMING74, LIQUID_FEC_NONE,       60},
+        {LIQUID_MODEM_BPSK,   LIQUID_FEC_NONE,      LIQUID_FEC_GOLAY2412, 120},
+        {LIQUID_MODEM_DPSK4,  LIQUID_FEC_NONE,      LIQUID_FEC_NONE,       31},
+    };
+    unsigned int num_frames = 12;
+
+    flexframegenprops_s fgprops;
+    flexframegenprops_init_default(&fgprops);
+    flexframegen fg = flexframegen_create(&fgprops);
+    flexframesync fs = flexframesync_create(NULL,NULL);
+
+    unsigned char header[14] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
+    unsigned char payload[200];
+    unsigned int num_bytes = 0;
+    for (i=0; i<num_frames; i++) {
+        // configure generator for next payload
+        unsigned int k = i % 4;
+        fgprops.mod_scheme = config[k].ms;
+        fgprops.check      = LIQUID_CRC_32;
+        fgprops.fec0       = config[k].fec0;
+        fgprops.fec1       = config[k].fec1;
+        flexframegen_setprops(fg, &fgprops);
+
+        for (j=0; j<config[k].payload_len; j++)
+            payload[j] = rand() & 0xff;
+        flexframegen_assemble(fg, header, payload, config[k].payload_len);
+        num_bytes += config[k].payload_len;
+
+        // generate frame and run through synchronizer
+        int frame_complete = 0;
+        float complex buf[2];
+        while (!frame_complete) {
+            frame_complete = flexframegen_write_samples(fg, buf, 2);
+            flexframesync_execute(fs, buf, 2);
+        }
+    }
+
+    // check to see that all frames were recovered
+    framedatastats_s stats = flexframesync_get_framedatastats(fs);
+    CONTEND_EQUALITY( stats.num_frames_detected, num_frames );
+    CONTEND_EQUALITY( stats.num_headers_valid,   num_frames );
+    CONTEND_EQUALITY( stats.num_payloads_valid,  num_frames );
+    CONTEND_EQUALITY( stats.num_bytes_received,  num_bytes  );
+
+    // destroy objects
+    flexframegen_destroy(fg);
+    flexframesync_destroy(fs);
+}
+
+// 
+// AUTOTEST : decode payloads on threads, frames delivered in order
+//
+void autotest_flexframesync_threads()
+{
+    unsigned int i, j;
+
+    unsigned int num_frames = 16;
+    int ms[4] = {LIQUID_MODEM_QPSK, LIQUID_MODEM_QAM16,
+                 LIQUID_MODEM_BPSK, LIQUID_MODEM_PSK8};
+    unsigned int seq[1 + 16] = {0};
+
+    flexframegenprops_s fgprops;
+    flexframegenprops_init_default(&fgprops);
+    flexframegen fg = flexframegen_create(&fgprops);
+    flexframesync fs = flexframesync_create(framesync_autotest_callback_seq,
+                                            (void*)seq);
+    flexframesync_set_num_threads(fs, 3);
+
+    unsigned char header[14] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
+    unsigned char payload[120];
+    unsigned int num_bytes = 0;
+    for (i=0; i<num_frames; i++) {
+        // vary payload length and modulation so frames take different
+        // amounts of time to decode
+        unsigned int payload_len = 20 + (i % 5)*25;
+        fgprops.mod_scheme = ms[i % 4];
+        fgprops.check      = LIQUID_CRC_32;
+        flexframegen_setprops(fg, &fgprops);
+
+        header[0] = i;
+        for (j=0; j<payload_len; j++)
+            payload[j] = rand() & 0xff;
+        flexframegen_assemble(fg, header, payload, payload_len);
+        num_bytes += payload_len;
+
+        int frame_complete = 0;
+        float complex buf[2];
+        while (!frame_complete) {
+            frame_complete = flexframegen_write_samples(fg, buf, 2);
+            flexframesync_execute(fs, buf, 2);
+        }
+    }
+    flexframesync_wait(fs);
+
+    // check that all frames were recovered, in order
+    framedatastats_s stats = flexframesync_get_framedatastats(fs);
+    CONTEND_EQUALITY( stats.num_frames_detected, num_frames );
+    CONTEND_EQUALITY( stats.num_headers_valid,   num_frames );
+    CONTEND_EQUALITY( stats.num_payloads_valid,  num_frames );
+    CONTEND_EQUALITY( stats.num_bytes_received,  num_bytes  );
+    framesync_autotest_check_seq(seq, num_frames);
+
+    // destroy objects
+    flexframegen_destroy(fg);
+    flexframesync_destroy(fs);
+}
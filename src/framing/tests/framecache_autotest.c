@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// test that cached objects are reused and evicted in least-recently
+// used order
+void autotest_framecache()
+{
+    framecache q = framecache_create(2);
+
+    // repeated requests return the same object
+    modem m0 = framecache_get_modem(q, LIQUID_MODEM_QPSK);
+    modem m1 = framecache_get_modem(q, LIQUID_MODEM_QAM16);
+    CONTEND_EXPRESSION( framecache_get_modem(q, LIQUID_MODEM_QPSK) == m0 );
+    CONTEND_EQUALITY( modem_get_scheme(m0), LIQUID_MODEM_QPSK );
+    CONTEND_EQUALITY( modem_get_scheme(m1), LIQUID_MODEM_QAM16 );
+    CONTEND_EQUALITY( framecache_get_num_modems(q), 2 );
+
+    // new scheme replaces least-recently used (QAM16)
+    modem m2 = framecache_get_modem(q, LIQUID_MODEM_BPSK);
+    CONTEND_EQUALITY( modem_get_scheme(m2), LIQUID_MODEM_BPSK );
+    CONTEND_EQUALITY( framecache_get_num_modems(q), 2 );
+    CONTEND_EXPRESSION( framecache_get_modem(q, LIQUID_MODEM_QPSK) == m0 );
+
+    // packetizers are keyed by length, crc, and fec schemes
+    packetizer p0 = framecache_get_packetizer(q, 100, LIQUID_CRC_32, LIQUID_FEC_HAMMING74, LIQUID_FEC_NONE);
+    packetizer p1 = framecache_get_packetizer(q, 100, LIQUID_CRC_32, LIQUID_FEC_NONE,      LIQUID_FEC_NONE);
+    CONTEND_EXPRESSION( p0 != p1 );
+    CONTEND_EXPRESSION( framecache_get_packetizer(q, 100, LIQUID_CRC_32, LIQUID_FEC_HAMMING74, LIQUID_FEC_NONE) == p0 );
+    CONTEND_EQUALITY( packetizer_get_dec_msg_len(p0), 100 );
+    CONTEND_EQUALITY( packetizer_get_fec0(p0), LIQUID_FEC_HAMMING74 );
+
+    packetizer p2 = framecache_get_packetizer(q, 40, LIQUID_CRC_16, LIQUID_FEC_NONE, LIQUID_FEC_NONE);
+    CONTEND_EQUALITY( packetizer_get_dec_msg_len(p2), 40 );
+    CONTEND_EQUALITY( framecache_get_num_packetizers(q), 2 );
+    CONTEND_EXPRESSION( framecache_get_packetizer(q, 100, LIQUID_CRC_32, LIQUID_FEC_HAMMING74, LIQUID_FEC_NONE) == p0 );
+
+    framecache_destroy(q);
+}
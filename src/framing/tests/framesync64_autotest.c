@@ -25,6 +25,7 @@
 #include <math.h>
 #include "autotest/autotest.h"
 #include "liquid.h"
+#include "src/framing/tests/framesync_runtest.h"
 
 static int callback(unsigned char *  _header,
                     int              _header_valid,
@@ -90,3 +91,40 @@ void autotest_framesync64()
     framesync64_destroy(fs);
 }
 
+
+// 
+// AUTOTEST : decode payloads on threads, frames delivered in order
+//
+void autotest_framesync64_threads()
+{
+    unsigned int i, j;
+    unsigned int num_frames = 12;
+    unsigned int seq[1 + 12] = {0};
+
+    framegen64  fg = framegen64_create();
+    framesync64 fs = framesync64_create(framesync_autotest_callback_seq,(void*)seq);
+    framesync64_set_num_threads(fs, 2);
+
+    unsigned char header[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    unsigned char payload[64];
+    unsigned int frame_len = LIQUID_FRAME64_LEN;
+    float complex frame[frame_len];
+    for (i=0; i<num_frames; i++) {
+        header[0] = i;
+        for (j=0; j<64; j++)
+            payload[j] = rand() & 0xff;
+        framegen64_execute(fg, header, payload, frame);
+
+        for (j=0; j<frame_len; j++)
+            frame[j] += 0.01f*(randnf() + _Complex_I*randnf()) * M_SQRT1_2;
+        framesync64_execute(fs, frame, frame_len);
+    }
+    framesync64_wait(fs);
+
+    // check that all frames were recovered, in order
+    framesync_autotest_check_seq(seq, num_frames);
+
+    // destroy objects
+    framegen64_destroy(fg);
+    framesync64_destroy(fs);
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+#include "src/framing/tests/framesync_runtest.h"
+
+// frame synchronizer callback recording the sequence number (first
+// header byte) of each valid frame delivered
+int framesync_autotest_callback_seq(unsigned char *  _header,
+                                    int              _header_valid,
+                                    unsigned char *  _payload,
+                                    unsigned int     _payload_len,
+                                    int              _payload_valid,
+                                    framesyncstats_s _stats,
+                                    void *           _userdata)
+{
+    unsigned int * seq = (unsigned int*) _userdata;
+    if (_header_valid && _payload_valid)
+        seq[1 + seq[0]++] = _header[0];
+    return 0;
+}
+
+// check that all frames were recorded, in order
+void framesync_autotest_check_seq(unsigned int * _seq,
+                                  unsigned int   _num_frames)
+{
+    CONTEND_EQUALITY( _seq[0], _num_frames );
+
+    unsigned int i;
+    for (i=0; i<_num_frames; i++)
+        CONTEND_EQUALITY( _seq[1+i], i );
+}
+
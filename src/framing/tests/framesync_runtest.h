@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// autotest framesync helper definitions
+//
+
+#ifndef __LIQUID_FRAMESYNC_RUNTEST_H__
+#define __LIQUID_FRAMESYNC_RUNTEST_H__
+
+#include "liquid.h"
+
+// frame synchronizer callback recording the sequence number (first
+// header byte) of each valid frame delivered; _userdata points to an
+// array whose first element counts the frames recorded so far and is
+// followed by one element per frame
+int framesync_autotest_callback_seq(unsigned char *  _header,
+                                    int              _header_valid,
+                                    unsigned char *  _payload,
+                                    unsigned int     _payload_len,
+                                    int              _payload_valid,
+                                    framesyncstats_s _stats,
+                                    void *           _userdata);
+
+// check that all frames were recorded by the callback above, in order
+//  _seq        :   sequence array [size: 1 + _num_frames x 1]
+//  _num_frames :   number of frames transmitted
+void framesync_autotest_check_seq(unsigned int * _seq,
+                                  unsigned int   _num_frames);
+
+#endif // __LIQUID_FRAMESYNC_RUNTEST_H__
+
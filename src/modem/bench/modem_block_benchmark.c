@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+#define MODEM_BLOCK_BENCH_API(MS,DEMOD)  \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ modem_block_bench(_start, _finish, _num_iterations, MS, DEMOD); }
+
+// Helper function to keep code base small
+void modem_block_bench(struct rusage *_start,
+                       struct rusage *_finish,
+                       unsigned long int *_num_iterations,
+                       modulation_scheme _ms,
+                       int _demod)
+{
+    // number of symbols per block
+    unsigned int n = 256;
+
+    // normalize number of iterations
+    *_num_iterations /= 16;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // initialize modem
+    modem q = modem_create(_ms);
+    unsigned int M = 1 << modem_get_bps(q);
+
+    unsigned long int i;
+
+    // generate input symbols and samples to demodulate (spiral)
+    unsigned int s[n];
+    float complex x[n];
+    for (i=0; i<n; i++) {
+        s[i] = (7*i) % M;
+        x[i] = 0.07 * (i % 20) * cexpf(_Complex_I*2*M_PI*0.1*i);
+    }
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    if (_demod) {
+        for (i=0; i<(*_num_iterations); i++)
+            modem_demodulate_block(q, x, n, s, NULL, NULL);
+    } else {
+        for (i=0; i<(*_num_iterations); i++)
+            modem_modulate_block(q, s, n, x);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= n;
+
+    modem_destroy(q);
+}
+
+// modulate
+void benchmark_modulate_block_bpsk    MODEM_BLOCK_BENCH_API(LIQUID_MODEM_BPSK,   0)
+void benchmark_modulate_block_psk8    MODEM_BLOCK_BENCH_API(LIQUID_MODEM_PSK8,   0)
+void benchmark_modulate_block_dpsk8   MODEM_BLOCK_BENCH_API(LIQUID_MODEM_DPSK8,  0)
+void benchmark_modulate_block_qam16   MODEM_BLOCK_BENCH_API(LIQUID_MODEM_QAM16,  0)
+void benchmark_modulate_block_qam256  MODEM_BLOCK_BENCH_API(LIQUID_MODEM_QAM256, 0)
+void benchmark_modulate_block_apsk32  MODEM_BLOCK_BENCH_API(LIQUID_MODEM_APSK32, 0)
+
+// hard-decision demodulate
+void benchmark_demodulate_block_bpsk   MODEM_BLOCK_BENCH_API(LIQUID_MODEM_BPSK,   1)
+void benchmark_demodulate_block_qpsk   MODEM_BLOCK_BENCH_API(LIQUID_MODEM_QPSK,   1)
+void benchmark_demodulate_block_psk8   MODEM_BLOCK_BENCH_API(LIQUID_MODEM_PSK8,   1)
+void benchmark_demodulate_block_dpsk8  MODEM_BLOCK_BENCH_API(LIQUID_MODEM_DPSK8,  1)
+void benchmark_demodulate_block_ask8   MODEM_BLOCK_BENCH_API(LIQUID_MODEM_ASK8,   1)
+void benchmark_demodulate_block_qam16  MODEM_BLOCK_BENCH_API(LIQUID_MODEM_QAM16,  1)
+void benchmark_demodulate_block_qam64  MODEM_BLOCK_BENCH_API(LIQUID_MODEM_QAM64,  1)
+void benchmark_demodulate_block_qam256 MODEM_BLOCK_BENCH_API(LIQUID_MODEM_QAM256, 1)
+void benchmark_demodulate_block_apsk32 MODEM_BLOCK_BENCH_API(LIQUID_MODEM_APSK32, 1)
+void benchmark_demodulate_block_arbV29 MODEM_BLOCK_BENCH_API(LIQUID_MODEM_V29,    1)
+
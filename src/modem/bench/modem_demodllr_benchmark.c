@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+#define MODEM_DEMODLLR_BENCH_API(MS,METHOD) \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ modem_demodulate_llr_bench(_start, _finish, _num_iterations, MS, METHOD); }
+
+// Helper function to keep code base small
+void modem_demodulate_llr_bench(struct rusage *_start,
+                                struct rusage *_finish,
+                                unsigned long int *_num_iterations,
+                                modulation_scheme _ms,
+                                liquid_modem_llr  _method)
+{
+    // number of symbols per block
+    unsigned int n = 256;
+
+    // normalize number of iterations
+    *_num_iterations /= _method == LIQUID_MODEM_LLR_EXACT ? 2048 : 64;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // initialize demodulator
+    modem demod = modem_create(_ms);
+    unsigned int bps = modem_get_bps(demod);
+
+    unsigned long int i;
+
+    // generate input vector to demodulate (spiral)
+    float complex x[n];
+    for (i=0; i<n; i++)
+        x[i] = 0.07 * (i % 20) * cexpf(_Complex_I*2*M_PI*0.1*i);
+
+    float llr[n*bps];
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        modem_demodulate_llr(demod, x, n, 0.1f, _method, llr);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= n;
+
+    modem_destroy(demod);
+}
+
+// max-log
+void benchmark_demodllr_maxlog_bpsk   MODEM_DEMODLLR_BENCH_API(LIQUID_MODEM_BPSK,   LIQUID_MODEM_LLR_MAXLOG)
+void benchmark_demodllr_maxlog_qpsk   MODEM_DEMODLLR_BENCH_API(LIQUID_MODEM_QPSK,   LIQUID_MODEM_LLR_MAXLOG)
+void benchmark_demodllr_maxlog_psk8   MODEM_DEMODLLR_BENCH_API(LIQUID_MODEM_PSK8,   LIQUID_MODEM_LLR_MAXLOG)
+void benchmark_demodllr_maxlog_qam16  MODEM_DEMODLLR_BENCH_API(LIQUID_MODEM_QAM16,  LIQUID_MODEM_LLR_MAXLOG)
+void benchmark_demodllr_maxlog_qam64  MODEM_DEMODLLR_BENCH_API(LIQUID_MODEM_QAM64,  LIQUID_MODEM_LLR_MAXLOG)
+void benchmark_demodllr_maxlog_qam256 MODEM_DEMODLLR_BENCH_API(LIQUID_MODEM_QAM256, LIQUID_MODEM_LLR_MAXLOG)
+void benchmark_demodllr_maxlog_apsk32 MODEM_DEMODLLR_BENCH_API(LIQUID_MODEM_APSK32, LIQUID_MODEM_LLR_MAXLOG)
+
+// exact log-MAP
+void benchmark_demodllr_exact_qam16   MODEM_DEMODLLR_BENCH_API(LIQUID_MODEM_QAM16,  LIQUID_MODEM_LLR_EXACT)
+void benchmark_demodllr_exact_qam256  MODEM_DEMODLLR_BENCH_API(LIQUID_MODEM_QAM256, LIQUID_MODEM_LLR_EXACT)
+void benchmark_demodllr_exact_psk8    MODEM_DEMODLLR_BENCH_API(LIQUID_MODEM_PSK8,   LIQUID_MODEM_LLR_EXACT)
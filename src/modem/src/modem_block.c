@@ -0,0 +1,478 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// modem_block.c : block modulation and hard-decision demodulation
+//
+// Modulation maps each symbol through the constellation table. Hard
+// decisions for schemes built from Gray-coded amplitude levels (ASK,
+// QAM, BPSK, QPSK) are sliced one axis at a time without branches,
+// PSK slices the phase directly, and APSK picks the ring and then the
+// phase with an inverse symbol table. Other constellations are
+// searched for the nearest point; differential schemes run their
+// per-symbol demodulator over the block.
+//
+
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "liquid.internal.h"
+
+#if LIQUID_SIMD_DISPATCH
+#include <immintrin.h>  // AVX2 (selected at run time)
+#endif
+
+// get constellation table for block methods, creating it if the scheme
+// does not keep one (returns NULL for differential schemes)
+TC * MODEM(_block_map)(MODEM() _q)
+{
+    if (liquid_modem_is_dpsk(_q->scheme))
+        return NULL;
+
+    if (_q->symbol_map == NULL) {
+        // table is not used by the per-symbol methods of this scheme
+        _q->symbol_map = (TC*)malloc(_q->M*sizeof(TC));
+        MODEM(_init_map)(_q);
+    }
+    return _q->symbol_map;
+}
+
+#if LIQUID_SIMD_DISPATCH
+// map symbols through table, four at a time; returns number of
+// symbols processed (multiple of 4)
+__attribute__((target("avx2")))
+unsigned int MODEM(_modulate_block_avx2)(TC *           _map,
+                                         unsigned int   _M,
+                                         unsigned int * _s,
+                                         unsigned int   _n,
+                                         TC *           _y)
+{
+    __m128i vinvalid = _mm_set1_epi32(~(int)(_M-1));
+    unsigned int i;
+    for (i=0; i+4<=_n; i+=4) {
+        __m128i s = _mm_loadu_si128((__m128i*)(_s + i));
+        if (!_mm_testz_si128(s, vinvalid))
+            break;
+
+        // each complex float sample is gathered as one 64-bit element
+        __m256i y = _mm256_i32gather_epi64((const long long*)_map, s, 8);
+        _mm256_storeu_si256((__m256i*)(_y + i), y);
+    }
+    return i;
+}
+#endif
+
+// modulate a block of symbols
+//  _q      :   modem object
+//  _s      :   input symbols [size: _n x 1]
+//  _n      :   number of input symbols
+//  _y      :   output samples [size: _n x 1]
+void MODEM(_modulate_block)(MODEM()        _q,
+                            unsigned int * _s,
+                            unsigned int   _n,
+                            TC *           _y)
+{
+    unsigned int i;
+    TC * map = MODEM(_block_map)(_q);
+    if (map == NULL) {
+        // differential modulation carries state from symbol to symbol
+        for (i=0; i<_n; i++)
+            MODEM(_modulate)(_q, _s[i], &_y[i]);
+        return;
+    }
+
+    i = 0;
+#if LIQUID_SIMD_DISPATCH
+    if (_q->level >= LIQUID_SIMD_AVX2)
+        i = MODEM(_modulate_block_avx2)(map, _q->M, _s, _n, _y);
+#endif
+    for ( ; i<_n; i++) {
+        if (_s[i] >= _q->M) {
+            fprintf(stderr,"error: modem_modulate_block(), input symbol exceeds constellation size\n");
+            exit(1);
+        }
+        _y[i] = map[_s[i]];
+    }
+}
+
+// slice Gray-coded levels on up to two axes, portable version
+//  _x      :   input samples, interleaved complex [size: 2*_n x 1]
+//  _n      :   number of samples
+//  _num    :   number of axes
+//  _comp   :   component per axis (0:real, 1:imag)
+//  _scale  :   input scaling (sign/alpha) per axis to level units
+//  _m      :   bits per axis
+//  _s      :   output symbols [size: _n x 1]
+void MODEM(_slice_pam)(T *            _x,
+                       unsigned int   _n,
+                       unsigned int   _num,
+                       unsigned int * _comp,
+                       T *            _scale,
+                       unsigned int * _m,
+                       unsigned int * _s)
+{
+    unsigned int i, a;
+    for (i=0; i<_n; i++) {
+        unsigned int s = 0;
+        for (a=0; a<_num; a++) {
+            T M = (T)(1 << _m[a]);
+            T j = floorf(0.5f*(_x[2*i + _comp[a]]*_scale[a] + M));
+            j = j < 0 ? 0 : (j > M - 1 ? M - 1 : j);
+            unsigned int g = (unsigned int)j;
+            s = (s << _m[a]) | (g ^ (g >> 1));
+        }
+        _s[i] = s;
+    }
+}
+
+#if LIQUID_SIMD_DISPATCH
+// slice Gray-coded levels on up to two axes, eight samples at a time;
+// returns number of samples processed (multiple of 8)
+__attribute__((target("avx2")))
+unsigned int MODEM(_slice_pam_avx2)(T *            _x,
+                                    unsigned int   _n,
+                                    unsigned int   _num,
+                                    unsigned int * _comp,
+                                    T *            _scale,
+                                    unsigned int * _m,
+                                    unsigned int * _s)
+{
+    __m256 vzero = _mm256_setzero_ps();
+    __m256 vhalf = _mm256_set1_ps(0.5f);
+    __m256 vM[2], vMm1[2], vscale[2];
+    unsigned int a;
+    for (a=0; a<_num; a++) {
+        vM[a]     = _mm256_set1_ps((T)(1 << _m[a]));
+        vMm1[a]   = _mm256_set1_ps((T)(1 << _m[a]) - 1);
+        vscale[a] = _mm256_set1_ps(_scale[a]);
+    }
+
+    unsigned int i;
+    for (i=0; i+8<=_n; i+=8) {
+        // de-interleave eight samples, in order
+        __m256 x0 = _mm256_loadu_ps(_x + 2*i);
+        __m256 x1 = _mm256_loadu_ps(_x + 2*i + 8);
+        __m256 c[2];
+        c[0] = _mm256_shuffle_ps(x0, x1, _MM_SHUFFLE(2,0,2,0));
+        c[1] = _mm256_shuffle_ps(x0, x1, _MM_SHUFFLE(3,1,3,1));
+        c[0] = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(c[0]), 0xd8));
+        c[1] = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(c[1]), 0xd8));
+
+        __m256i s = _mm256_setzero_si256();
+        for (a=0; a<_num; a++) {
+            __m256 u = _mm256_mul_ps(c[_comp[a]], vscale[a]);
+            __m256 j = _mm256_floor_ps(_mm256_mul_ps(vhalf, _mm256_add_ps(u, vM[a])));
+            j = _mm256_min_ps(_mm256_max_ps(j, vzero), vMm1[a]);
+            __m256i g = _mm256_cvttps_epi32(j);
+            g = _mm256_xor_si256(g, _mm256_srli_epi32(g, 1));
+            s = _mm256_or_si256(_mm256_slli_epi32(s, _m[a]), g);
+        }
+        _mm256_storeu_si256((__m256i*)(_s + i), s);
+    }
+    return i;
+}
+#endif
+
+// approximate phase of sample in [-pi,pi] (error below 1e-5 radians);
+// slicers correct the decision against neighboring points
+static inline T MODEM(_arg_approx)(TC _x)
+{
+    T xr = crealf(_x), xi = cimagf(_x);
+    T ar = fabsf(xr), ai = fabsf(xi);
+    T hi = ar > ai ? ar : ai;
+    T lo = ar > ai ? ai : ar;
+    T a  = hi > 0 ? lo / hi : 0;
+    T s  = a*a;
+    T theta = a + a*s*(-0.327622764f + s*(0.15931422f - 0.0464964749f*s));
+    theta = ai > ar ? (T)M_PI_2 - theta : theta;
+    theta = xr < 0  ? (T)M_PI   - theta : theta;
+    return copysignf(theta, xi);
+}
+
+// real part of _x*conj(_c)
+static inline T MODEM(_dot)(TC _x, TC _c)
+{
+    return crealf(_x)*crealf(_c) + cimagf(_x)*cimagf(_c);
+}
+
+#if LIQUID_SIMD_DISPATCH
+// slice PSK phase eight samples at a time (see _slice_psk); returns
+// number of samples processed (multiple of 8)
+//  _x      :   input samples, interleaved complex [size: 2*_n x 1]
+//  _n      :   number of samples
+//  _M      :   constellation size
+//  _cr     :   real part of points in order of phase index [size: _M x 1]
+//  _ci     :   imag part of points in order of phase index [size: _M x 1]
+//  _s      :   output symbols [size: _n x 1]
+__attribute__((target("avx2,fma")))
+unsigned int MODEM(_slice_psk_avx2)(T *            _x,
+                                    unsigned int   _n,
+                                    unsigned int   _M,
+                                    T *            _cr,
+                                    T *            _ci,
+                                    unsigned int * _s)
+{
+    __m256  vabs   = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+    __m256  vsign  = _mm256_set1_ps(-0.0f);
+    __m256  vzero  = _mm256_setzero_ps();
+    __m256  vpi    = _mm256_set1_ps(M_PI);
+    __m256  vpi2   = _mm256_set1_ps(M_PI_2);
+    __m256  vscale = _mm256_set1_ps((T)_M / (2*M_PI));
+    __m256  vhalf  = _mm256_set1_ps(0.5f);
+    __m256  vp0    = _mm256_set1_ps(-0.0464964749f);
+    __m256  vp1    = _mm256_set1_ps( 0.15931422f);
+    __m256  vp2    = _mm256_set1_ps(-0.327622764f);
+    __m256i vmask  = _mm256_set1_epi32(_M - 1);
+    __m256i vone   = _mm256_set1_epi32(1);
+
+    unsigned int i;
+    for (i=0; i+8<=_n; i+=8) {
+        // de-interleave eight samples, in order
+        __m256 x0 = _mm256_loadu_ps(_x + 2*i);
+        __m256 x1 = _mm256_loadu_ps(_x + 2*i + 8);
+        __m256 xr = _mm256_shuffle_ps(x0, x1, _MM_SHUFFLE(2,0,2,0));
+        __m256 xi = _mm256_shuffle_ps(x0, x1, _MM_SHUFFLE(3,1,3,1));
+        xr = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(xr), 0xd8));
+        xi = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(xi), 0xd8));
+
+        // approximate phase
+        __m256 ar = _mm256_and_ps(xr, vabs);
+        __m256 ai = _mm256_and_ps(xi, vabs);
+        __m256 hi = _mm256_max_ps(ar, ai);
+        __m256 lo = _mm256_min_ps(ar, ai);
+        __m256 a  = _mm256_and_ps(_mm256_div_ps(lo, hi), _mm256_cmp_ps(hi, vzero, _CMP_GT_OQ));
+        __m256 s2 = _mm256_mul_ps(a, a);
+        __m256 t  = _mm256_fmadd_ps(_mm256_fmadd_ps(vp0, s2, vp1), s2, vp2);
+        t = _mm256_fmadd_ps(_mm256_mul_ps(a, s2), t, a);
+        t = _mm256_blendv_ps(t, _mm256_sub_ps(vpi2, t), _mm256_cmp_ps(ai, ar, _CMP_GT_OQ));
+        t = _mm256_blendv_ps(t, _mm256_sub_ps(vpi,  t), xr);
+        t = _mm256_or_ps(t, _mm256_and_ps(xi, vsign));
+
+        // approximate phase index and its neighbors
+        __m256i k  = _mm256_cvttps_epi32(_mm256_floor_ps(_mm256_fmadd_ps(t, vscale, vhalf)));
+        __m256i k0 = _mm256_and_si256(_mm256_sub_epi32(k, vone), vmask);
+        __m256i k1 = _mm256_and_si256(k, vmask);
+        __m256i k2 = _mm256_and_si256(_mm256_add_epi32(k, vone), vmask);
+        __m256 d0 = _mm256_fmadd_ps(xr, _mm256_i32gather_ps(_cr, k0, 4),
+                        _mm256_mul_ps(xi, _mm256_i32gather_ps(_ci, k0, 4)));
+        __m256 d1 = _mm256_fmadd_ps(xr, _mm256_i32gather_ps(_cr, k1, 4),
+                        _mm256_mul_ps(xi, _mm256_i32gather_ps(_ci, k1, 4)));
+        __m256 d2 = _mm256_fmadd_ps(xr, _mm256_i32gather_ps(_cr, k2, 4),
+                        _mm256_mul_ps(xi, _mm256_i32gather_ps(_ci, k2, 4)));
+
+        // keep nearest
+        __m256 m = _mm256_cmp_ps(d1, d0, _CMP_GE_OQ);
+        k  = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(k0), _mm256_castsi256_ps(k1), m));
+        d1 = _mm256_blendv_ps(d0, d1, m);
+        m  = _mm256_cmp_ps(d2, d1, _CMP_GT_OQ);
+        k  = _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(k), _mm256_castsi256_ps(k2), m));
+
+        k = _mm256_xor_si256(k, _mm256_srli_epi32(k, 1));
+        _mm256_storeu_si256((__m256i*)(_s + i), k);
+    }
+    return i;
+}
+#endif
+
+// slice PSK phase
+void MODEM(_slice_psk)(MODEM()        _q,
+                       TC *           _x,
+                       unsigned int   _n,
+                       unsigned int * _s)
+{
+    T scale = (T)_q->M / (2*M_PI);
+    unsigned int mask = _q->M - 1;
+
+    // points in order of phase index
+    TC * map = MODEM(_block_map)(_q);
+    T cr[_q->M];
+    T ci[_q->M];
+    unsigned int i;
+    for (i=0; i<_q->M; i++) {
+        cr[i] = crealf(map[i ^ (i >> 1)]);
+        ci[i] = cimagf(map[i ^ (i >> 1)]);
+    }
+
+    i = 0;
+#if LIQUID_SIMD_DISPATCH
+    if (_q->level >= LIQUID_SIMD_AVX2)
+        i = MODEM(_slice_psk_avx2)((T*)_x, _n, _q->M, cr, ci, _s);
+#endif
+    for ( ; i<_n; i++) {
+        // approximate phase index, then keep nearest of it and its neighbors
+        T xr = crealf(_x[i]), xi = cimagf(_x[i]);
+        unsigned int k = (unsigned int)(int)floorf(MODEM(_arg_approx)(_x[i])*scale + 0.5f);
+        unsigned int k0 = (k - 1) & mask;
+        unsigned int k1 =  k      & mask;
+        unsigned int k2 = (k + 1) & mask;
+        T d0 = xr*cr[k0] + xi*ci[k0];
+        T d1 = xr*cr[k1] + xi*ci[k1];
+        T d2 = xr*cr[k2] + xi*ci[k2];
+        k = d1 >= d0 ? k1 : k0;
+        d1 = d1 >= d0 ? d1 : d0;
+        k = d2 > d1 ? k2 : k;
+        _s[i] = k ^ (k >> 1);
+    }
+}
+
+// slice APSK ring and phase
+void MODEM(_slice_apsk)(MODEM()        _q,
+                        TC *           _x,
+                        unsigned int   _n,
+                        unsigned int * _s)
+{
+    unsigned int num_levels = _q->data.apsk.num_levels;
+
+    // per-ring index offset, phase scale, and squared slicer radius
+    unsigned int offset[8];
+    T scale[8], r2_slicer[8];
+    unsigned int i, k;
+    for (i=0, k=0; i<num_levels; i++) {
+        offset[i]    = k;
+        scale[i]     = (T)_q->data.apsk.p[i] / (2*M_PI);
+        r2_slicer[i] = _q->data.apsk.r_slicer[i]*_q->data.apsk.r_slicer[i];
+        k += _q->data.apsk.p[i];
+    }
+
+    // symbols and points in order of ring and phase index
+    TC * map = MODEM(_block_map)(_q);
+    unsigned char map_inv[1 << MAX_MOD_BITS_PER_SYMBOL];
+    TC c[_q->M];
+    for (i=0; i<_q->M; i++)
+        map_inv[_q->data.apsk.map[i]] = i;
+    for (i=0; i<_q->M; i++)
+        c[i] = map[map_inv[i]];
+
+    for (i=0; i<_n; i++) {
+        // ring: number of slicer radii at or below amplitude
+        T r2 = MODEM(_dot)(_x[i], _x[i]);
+        unsigned int p = 0;
+        for (k=0; k<num_levels-1; k++)
+            p += r2 >= r2_slicer[k];
+
+        // approximate phase index in ring, then keep nearest of it and
+        // its neighbors
+        int P = (int)_q->data.apsk.p[p];
+        T theta = MODEM(_arg_approx)(_x[i]);
+        theta += theta < 0 ? (T)(2*M_PI) : 0;
+        int j = (int)floorf((theta - _q->data.apsk.phi[p])*scale[p] + 0.5f) + P;
+        unsigned int j0 = offset[p] + (j - 1) % P;
+        unsigned int j1 = offset[p] +  j      % P;
+        unsigned int j2 = offset[p] + (j + 1) % P;
+        T d0 = MODEM(_dot)(_x[i], c[j0]);
+        T d1 = MODEM(_dot)(_x[i], c[j1]);
+        T d2 = MODEM(_dot)(_x[i], c[j2]);
+        k = d1 >= d0 ? j1 : j0;
+        d1 = d1 >= d0 ? d1 : d0;
+        k = d2 > d1 ? j2 : k;
+        _s[i] = map_inv[k];
+    }
+}
+
+// slice by searching all constellation points for the nearest
+void MODEM(_slice_search)(MODEM()        _q,
+                          TC *           _x,
+                          unsigned int   _n,
+                          unsigned int * _s)
+{
+    TC * map = MODEM(_block_map)(_q);
+    unsigned int i, j;
+    for (i=0; i<_n; i++) {
+        T xr = crealf(_x[i]), xi = cimagf(_x[i]);
+        T d_min = 0;
+        unsigned int s = 0;
+        for (j=0; j<_q->M; j++) {
+            T er = xr - crealf(map[j]);
+            T ei = xi - cimagf(map[j]);
+            T d  = er*er + ei*ei;
+            s     = (j == 0 || d < d_min) ? j : s;
+            d_min = (j == 0 || d < d_min) ? d : d_min;
+        }
+        _s[i] = s;
+    }
+}
+
+// hard-decision demodulation of a block of samples
+//  _q              :   modem object
+//  _x              :   input samples [size: _n x 1]
+//  _n              :   number of input samples
+//  _s              :   output symbols [size: _n x 1]
+//  _phase_error    :   output phase error per sample (ignored if NULL)
+//  _evm            :   output error vector magnitude per sample (ignored if NULL)
+void MODEM(_demodulate_block)(MODEM()        _q,
+                              TC *           _x,
+                              unsigned int   _n,
+                              unsigned int * _s,
+                              T *            _phase_error,
+                              T *            _evm)
+{
+    if (_n == 0)
+        return;
+
+    unsigned int i;
+    unsigned int comp[2], m[2];
+    T sign[2], alpha[2], scale[2];
+    unsigned int num_axes = MODEM(_pam_axes)(_q, comp, sign, m, alpha);
+    if (num_axes > 0) {
+        unsigned int a;
+        for (a=0; a<num_axes; a++)
+            scale[a] = sign[a] / alpha[a];
+        i = 0;
+#if LIQUID_SIMD_DISPATCH
+        if (_q->level >= LIQUID_SIMD_AVX2)
+            i = MODEM(_slice_pam_avx2)((T*)_x, _n, num_axes, comp, scale, m, _s);
+#endif
+        MODEM(_slice_pam)((T*)(_x + i), _n - i, num_axes, comp, scale, m, _s + i);
+    } else if (liquid_modem_is_psk(_q->scheme)) {
+        MODEM(_slice_psk)(_q, _x, _n, _s);
+    } else if (liquid_modem_is_apsk(_q->scheme)) {
+        MODEM(_slice_apsk)(_q, _x, _n, _s);
+    } else if (!liquid_modem_is_dpsk(_q->scheme)) {
+        MODEM(_slice_search)(_q, _x, _n, _s);
+    } else {
+        // run per-symbol demodulator, keeping its state
+        for (i=0; i<_n; i++) {
+            _q->demodulate_func(_q, _x[i], &_s[i]);
+            if (_phase_error != NULL) _phase_error[i] = MODEM(_get_demodulator_phase_error)(_q);
+            if (_evm         != NULL) _evm[i]         = MODEM(_get_demodulator_evm)(_q);
+        }
+        return;
+    }
+
+    // re-modulate symbols for error statistics and demodulator state
+    TC * map = MODEM(_block_map)(_q);
+    if (_phase_error != NULL) {
+        for (i=0; i<_n; i++) {
+            TC c = map[_s[i]];
+            _phase_error[i] = cimagf(_x[i])*crealf(c) - crealf(_x[i])*cimagf(c);
+        }
+    }
+    if (_evm != NULL) {
+        for (i=0; i<_n; i++) {
+            TC e = map[_s[i]] - _x[i];
+            _evm[i] = sqrtf(MODEM(_dot)(e, e));
+        }
+    }
+    _q->x_hat = map[_s[_n-1]];
+    _q->r     = _x[_n-1];
+}
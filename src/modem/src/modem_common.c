@@ -130,6 +130,9 @@ struct MODEM(_s)
     // neighbors array
     unsigned char * demod_soft_neighbors;   // array of nearest neighbors
     unsigned int demod_soft_p;              // number of neighbors in array
+
+    // SIMD extension level for block methods, selected at run time
+    liquid_simd_level level;
 };
 
 // create digital modem of a specific scheme and bits/symbol
@@ -299,6 +302,12 @@ void MODEM(_init)(MODEM() _q,
     // soft demodulation
     _q->demod_soft_neighbors = NULL;
     _q->demod_soft_p = 0;
+
+    // select block kernels
+    _q->level = LIQUID_SIMD_BASELINE;
+#if LIQUID_SIMD_DISPATCH
+    _q->level = liquid_simd_get_level();
+#endif
 }
 
 // initialize symbol map for fast modulation
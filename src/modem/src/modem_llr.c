@@ -0,0 +1,451 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// modem_llr.c : block soft demodulation to log-likelihood ratios
+//
+// Schemes built from Gray-coded amplitude levels on each axis (ASK,
+// QAM, BPSK, QPSK) are demodulated one axis at a time in closed form:
+// the nearest level with a given bit flipped lies just across the
+// nearest decision boundary of that bit, so no search over the
+// constellation is needed. PSK is treated the same way in angle.
+// Other schemes (and the exact log-MAP method) evaluate distances to
+// every constellation point.
+//
+
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+#if LIQUID_SIMD_DISPATCH
+#include <immintrin.h>  // AVX2 (selected at run time)
+#endif
+
+// number of symbols demodulated per pass for 8-bit output
+#define MODEM_LLR_BLOCK_LEN (64)
+
+// describe scheme as Gray-coded amplitude levels (2j - M + 1)*alpha on
+// one or both axes, in order of output bits; returns number of axes,
+// or zero if the scheme does not separate this way
+//  _q      :   modem object
+//  _comp   :   input component per axis (0:real, 1:imag) [size: 2 x 1]
+//  _sign   :   input sign per axis [size: 2 x 1]
+//  _m      :   bits per axis [size: 2 x 1]
+//  _alpha  :   level spacing per axis (half) [size: 2 x 1]
+unsigned int MODEM(_pam_axes)(MODEM()        _q,
+                              unsigned int * _comp,
+                              T *            _sign,
+                              unsigned int * _m,
+                              T *            _alpha)
+{
+    if (liquid_modem_is_qam(_q->scheme)) {
+        _comp[0] = 0; _sign[0] = 1; _m[0] = _q->data.qam.m_i; _alpha[0] = _q->data.qam.alpha;
+        _comp[1] = 1; _sign[1] = 1; _m[1] = _q->data.qam.m_q; _alpha[1] = _q->data.qam.alpha;
+        return 2;
+    } else if (liquid_modem_is_ask(_q->scheme)) {
+        _comp[0] = 0; _sign[0] = 1; _m[0] = _q->m; _alpha[0] = _q->data.ask.alpha;
+        return 1;
+    } else if (_q->scheme == LIQUID_MODEM_BPSK) {
+        // symbol 1 maps to -1
+        _comp[0] = 0; _sign[0] = -1; _m[0] = 1; _alpha[0] = 1.0f;
+        return 1;
+    } else if (_q->scheme == LIQUID_MODEM_QPSK) {
+        // most-significant bit on quadrature axis; bits set map to -1
+        _comp[0] = 1; _sign[0] = -1; _m[0] = 1; _alpha[0] = M_SQRT1_2;
+        _comp[1] = 0; _sign[1] = -1; _m[1] = 1; _alpha[1] = M_SQRT1_2;
+        return 2;
+    }
+    return 0;
+}
+
+// max-log LLRs for one axis of Gray-coded levels, portable version
+//  _x      :   input samples, interleaved complex [size: 2*_n x 1]
+//  _n      :   number of samples
+//  _comp   :   component of each sample to demodulate (0:real, 1:imag)
+//  _scale  :   input scaling (sign/alpha) to level units
+//  _m      :   bits on this axis
+//  _gain   :   alpha^2 / noise variance
+//  _llr    :   output; bit k of sample i at _llr[i*_stride + k]
+//  _stride :   output stride between samples
+void MODEM(_llr_pam_maxlog)(T *          _x,
+                            unsigned int _n,
+                            unsigned int _comp,
+                            T            _scale,
+                            unsigned int _m,
+                            T            _gain,
+                            T *          _llr,
+                            unsigned int _stride)
+{
+    T M = (T)(1 << _m);
+    unsigned int i, p;
+    for (i=0; i<_n; i++) {
+        T u = _x[2*i + _comp] * _scale;
+
+        // nearest level, and its distance
+        T j = floorf(0.5f*(u + M));
+        j = j < 0 ? 0 : (j > M - 1 ? M - 1 : j);
+        T e = u - (2*j - M + 1);
+        unsigned int s = (unsigned int)j;
+        s ^= s >> 1;
+
+        for (p=0; p<_m; p++) {
+            // decision boundaries of bit p lie at (2q+1)2^(p+1) - M
+            // for q in [0, M/2^(p+1)), spaced 2^(p+2) apart
+            T period = (T)(1 << (p+2));
+            T w = u - (T)(1 << (p+1)) + M;
+            T q = roundf(w / period);
+            T q_max = M / (T)(1 << (p+1)) - 1;
+            q = q < 0 ? 0 : (q > q_max ? q_max : q);
+            T d = fabsf(w - q*period) + 1.0f;
+
+            // nearest level with bit flipped is one unit past boundary
+            T llr = _gain * (d*d - e*e);
+            _llr[i*_stride + _m - p - 1] = ((s >> p) & 1) ? llr : -llr;
+        }
+    }
+}
+
+#if LIQUID_SIMD_DISPATCH
+// max-log LLRs for one axis of Gray-coded levels, eight samples at a
+// time; returns number of samples processed (multiple of 8)
+__attribute__((target("avx2,fma")))
+unsigned int MODEM(_llr_pam_maxlog_avx2)(T *          _x,
+                                         unsigned int _n,
+                                         unsigned int _comp,
+                                         T            _scale,
+                                         unsigned int _m,
+                                         T            _gain,
+                                         T *          _llr,
+                                         unsigned int _stride)
+{
+    T M = (T)(1 << _m);
+    __m256 vM     = _mm256_set1_ps(M);
+    __m256 vMm1   = _mm256_set1_ps(M - 1);
+    __m256 vzero  = _mm256_setzero_ps();
+    __m256 vhalf  = _mm256_set1_ps(0.5f);
+    __m256 vone   = _mm256_set1_ps(1.0f);
+    __m256 vscale = _mm256_set1_ps(_scale);
+    __m256 vgain  = _mm256_set1_ps(_gain);
+    __m256 vsign  = _mm256_set1_ps(-0.0f);
+    __m256i vone_i = _mm256_set1_epi32(1);
+
+    T llr[8] __attribute__((aligned(32)));
+    unsigned int i, p, t;
+    for (i=0; i+8<=_n; i+=8) {
+        // load eight samples and keep one component, in order
+        __m256 x0 = _mm256_loadu_ps(_x + 2*i);
+        __m256 x1 = _mm256_loadu_ps(_x + 2*i + 8);
+        __m256 u  = _comp ? _mm256_shuffle_ps(x0, x1, _MM_SHUFFLE(3,1,3,1))
+                          : _mm256_shuffle_ps(x0, x1, _MM_SHUFFLE(2,0,2,0));
+        u = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(u), 0xd8));
+        u = _mm256_mul_ps(u, vscale);
+
+        // nearest level, and its distance
+        __m256 j = _mm256_floor_ps(_mm256_mul_ps(vhalf, _mm256_add_ps(u, vM)));
+        j = _mm256_min_ps(_mm256_max_ps(j, vzero), vMm1);
+        __m256 e = _mm256_sub_ps(u, _mm256_add_ps(_mm256_sub_ps(_mm256_add_ps(j, j), vM), vone));
+        __m256 e2 = _mm256_mul_ps(e, e);
+        __m256i s = _mm256_cvttps_epi32(j);
+        s = _mm256_xor_si256(s, _mm256_srli_epi32(s, 1));
+
+        for (p=0; p<_m; p++) {
+            __m256 period = _mm256_set1_ps((T)(1 << (p+2)));
+            __m256 w = _mm256_add_ps(u, _mm256_set1_ps(M - (T)(1 << (p+1))));
+            __m256 q = _mm256_round_ps(_mm256_mul_ps(w, _mm256_set1_ps(1.0f / (T)(1 << (p+2)))),
+                                       _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            q = _mm256_min_ps(_mm256_max_ps(q, vzero), _mm256_set1_ps(M / (T)(1 << (p+1)) - 1));
+            __m256 d = _mm256_add_ps(_mm256_andnot_ps(vsign, _mm256_fnmadd_ps(q, period, w)), vone);
+            __m256 v = _mm256_mul_ps(vgain, _mm256_fmsub_ps(d, d, e2));
+
+            // negate where bit is clear
+            __m256i bit = _mm256_and_si256(_mm256_srli_epi32(s, p), vone_i);
+            __m256 neg = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_xor_si256(bit, vone_i), 31));
+            _mm256_store_ps(llr, _mm256_xor_ps(v, neg));
+
+            for (t=0; t<8; t++)
+                _llr[(i+t)*_stride + _m - p - 1] = llr[t];
+        }
+    }
+    return i;
+}
+#endif
+
+// exact LLRs for one axis of Gray-coded levels (see _llr_pam_maxlog)
+void MODEM(_llr_pam_exact)(T *          _x,
+                           unsigned int _n,
+                           unsigned int _comp,
+                           T            _scale,
+                           unsigned int _m,
+                           T            _gain,
+                           T *          _llr,
+                           unsigned int _stride)
+{
+    unsigned int M = 1 << _m;
+    T d[M];
+    unsigned int i, j, p;
+    for (i=0; i<_n; i++) {
+        T u = _x[2*i + _comp] * _scale;
+
+        // squared distance to each level
+        T dmin = 1e30f;
+        for (j=0; j<M; j++) {
+            T e = u - (T)(2*(int)j - (int)M + 1);
+            d[j] = e*e;
+            dmin = d[j] < dmin ? d[j] : dmin;
+        }
+
+        // accumulate likelihoods relative to the nearest level
+        T p0[8] = {0,0,0,0,0,0,0,0};
+        T p1[8] = {0,0,0,0,0,0,0,0};
+        for (j=0; j<M; j++) {
+            T l = expf(-_gain*(d[j] - dmin));
+            unsigned int s = j ^ (j >> 1);
+            for (p=0; p<_m; p++) {
+                if ((s >> p) & 1) p1[p] += l;
+                else              p0[p] += l;
+            }
+        }
+        for (p=0; p<_m; p++)
+            _llr[i*_stride + _m - p - 1] = logf(p1[p]) - logf(p0[p]);
+    }
+}
+
+// max-log LLRs for PSK with Gray-coded phase index
+//  _x      :   input samples [size: _n x 1]
+//  _n      :   number of samples
+//  _m      :   bits per symbol
+//  _gain   :   1 / noise variance
+//  _llr    :   output LLRs [size: _m*_n x 1]
+void MODEM(_llr_psk_maxlog)(TC *         _x,
+                            unsigned int _n,
+                            unsigned int _m,
+                            T            _gain,
+                            T *          _llr)
+{
+    unsigned int M = 1 << _m;
+    T step = 2*M_PI / (T)M;
+
+    // points in order of phase index
+    TC c[M];
+    unsigned int i, p;
+    for (i=0; i<M; i++)
+        c[i] = liquid_cexpjf(i*step);
+
+    for (i=0; i<_n; i++) {
+        // phase in units of symbol spacing, [0,M)
+        T u = cargf(_x[i]) / step;
+        u += u < 0 ? M : 0;
+
+        // nearest point; |x-c|^2 = |x|^2 + 1 - 2 Re{x c*}
+        int j = (int)roundf(u);
+        unsigned int s = j & (M-1);
+        T r0 = crealf(_x[i])*crealf(c[s]) + cimagf(_x[i])*cimagf(c[s]);
+        s ^= s >> 1;
+
+        for (p=0; p<_m; p++) {
+            // boundaries of bit p lie at 2^p - 1/2 + k*period
+            // (index wraps from M-1 to 0 across the top bit)
+            T period = (T)(p < _m-1 ? 1 << (p+1) : 1 << p);
+            T o = (T)(1 << p) - 0.5f;
+            T b = o + period*roundf((u - o) / period);
+
+            // nearest point with bit flipped lies just past boundary
+            unsigned int k = ((int)(b + (u < b ? 0.5f : -0.5f))) & (M-1);
+            T r1 = crealf(_x[i])*crealf(c[k]) + cimagf(_x[i])*cimagf(c[k]);
+            T llr = 2*_gain*(r0 - r1);
+            _llr[i*_m + _m - p - 1] = ((s >> p) & 1) ? llr : -llr;
+        }
+    }
+}
+
+// LLRs by evaluating distance to every constellation point
+//  _c      :   constellation [size: 2^_m x 1]
+//  _m      :   bits per symbol
+//  _x      :   input samples [size: _n x 1]
+//  _n      :   number of samples
+//  _gain   :   1 / noise variance
+//  _method :   max-log or exact
+//  _llr    :   output LLRs [size: _m*_n x 1]
+void MODEM(_llr_search)(TC *             _c,
+                        unsigned int     _m,
+                        TC *             _x,
+                        unsigned int     _n,
+                        T                _gain,
+                        liquid_modem_llr _method,
+                        T *              _llr)
+{
+    unsigned int M = 1 << _m;
+    T d[M];
+    unsigned int i, j, p;
+    for (i=0; i<_n; i++) {
+        T dmin = 1e30f;
+        for (j=0; j<M; j++) {
+            T er = crealf(_x[i]) - crealf(_c[j]);
+            T ei = cimagf(_x[i]) - cimagf(_c[j]);
+            d[j] = er*er + ei*ei;
+            dmin = d[j] < dmin ? d[j] : dmin;
+        }
+
+        T v0[8], v1[8];
+        for (p=0; p<_m; p++) {
+            v0[p] = _method == LIQUID_MODEM_LLR_EXACT ? 0.0f : 1e30f;
+            v1[p] = v0[p];
+        }
+        for (j=0; j<M; j++) {
+            if (_method == LIQUID_MODEM_LLR_EXACT) {
+                T l = expf(-_gain*(d[j] - dmin));
+                for (p=0; p<_m; p++) {
+                    if ((j >> p) & 1) v1[p] += l;
+                    else              v0[p] += l;
+                }
+            } else {
+                for (p=0; p<_m; p++) {
+                    if ((j >> p) & 1) v1[p] = d[j] < v1[p] ? d[j] : v1[p];
+                    else              v0[p] = d[j] < v0[p] ? d[j] : v0[p];
+                }
+            }
+        }
+        for (p=0; p<_m; p++) {
+            _llr[i*_m + _m - p - 1] = _method == LIQUID_MODEM_LLR_EXACT ?
+                logf(v1[p]) - logf(v0[p]) : _gain*(v0[p] - v1[p]);
+        }
+    }
+}
+
+// soft-decision demodulation of a block of samples to log-likelihood
+// ratios, ln(P(b=1)/P(b=0)), most-significant bit first
+//  _q          :   modem object
+//  _x          :   input samples [size: _n x 1]
+//  _n          :   number of input samples
+//  _noise_var  :   noise variance, E{|n|^2}
+//  _method     :   max-log or exact log-MAP
+//  _llr        :   output LLRs [size: _n*bps x 1]
+void MODEM(_demodulate_llr)(MODEM()          _q,
+                            TC *             _x,
+                            unsigned int     _n,
+                            T                _noise_var,
+                            liquid_modem_llr _method,
+                            T *              _llr)
+{
+    // validate input
+    if (_noise_var <= 0.0f) {
+        fprintf(stderr,"error: modem_demodulate_llr(), noise variance must be greater than zero\n");
+        exit(1);
+    } else if (_method != LIQUID_MODEM_LLR_MAXLOG && _method != LIQUID_MODEM_LLR_EXACT) {
+        fprintf(stderr,"error: modem_demodulate_llr(), invalid method %d\n", _method);
+        exit(1);
+    }
+
+    // independent axes of Gray-coded levels
+    unsigned int comp[2], m[2];
+    T sign[2], alpha[2];
+    unsigned int num_axes = MODEM(_pam_axes)(_q, comp, sign, m, alpha);
+    if (num_axes > 0) {
+        unsigned int a, offset = 0;
+        for (a=0; a<num_axes; a++) {
+            T scale = sign[a] / alpha[a];
+            T gain  = alpha[a]*alpha[a] / _noise_var;
+            if (_method == LIQUID_MODEM_LLR_EXACT) {
+                MODEM(_llr_pam_exact)((T*)_x, _n, comp[a], scale, m[a], gain, _llr + offset, _q->m);
+            } else {
+                unsigned int i = 0;
+#if LIQUID_SIMD_DISPATCH
+                if (_q->level >= LIQUID_SIMD_AVX2)
+                    i = MODEM(_llr_pam_maxlog_avx2)((T*)_x, _n, comp[a], scale, m[a], gain, _llr + offset, _q->m);
+#endif
+                MODEM(_llr_pam_maxlog)((T*)(_x + i), _n - i, comp[a], scale, m[a], gain,
+                                       _llr + offset + i*_q->m, _q->m);
+            }
+            offset += m[a];
+        }
+        return;
+    }
+
+    // reference constellation (PSK also used for differential input)
+    unsigned int i;
+    TC c[_q->M];
+    if (liquid_modem_is_psk(_q->scheme) || liquid_modem_is_dpsk(_q->scheme)) {
+        for (i=0; i<_q->M; i++)
+            c[i] = liquid_cexpjf(2*M_PI*(T)gray_decode(i) / (T)_q->M);
+    } else if (_q->symbol_map != NULL && _q->modulate_using_map) {
+        memmove(c, _q->symbol_map, _q->M*sizeof(TC));
+    } else {
+        for (i=0; i<_q->M; i++)
+            _q->modulate_func(_q, i, &c[i]);
+    }
+
+    if (liquid_modem_is_dpsk(_q->scheme)) {
+        // demodulate phase difference to previous sample
+        unsigned int k;
+        for (i=0; i<_n; i+=k) {
+            TC y[MODEM_LLR_BLOCK_LEN];
+            for (k=0; k<MODEM_LLR_BLOCK_LEN && i+k<_n; k++) {
+                T theta = cargf(_x[i+k]);
+                y[k] = _x[i+k] * liquid_cexpjf(-_q->data.dpsk.phi);
+                _q->data.dpsk.phi = theta;
+            }
+            if (_method == LIQUID_MODEM_LLR_EXACT)
+                MODEM(_llr_search)(c, _q->m, y, k, 1.0f / _noise_var, _method, _llr + i*_q->m);
+            else
+                MODEM(_llr_psk_maxlog)(y, k, _q->m, 1.0f / _noise_var, _llr + i*_q->m);
+        }
+    } else if (liquid_modem_is_psk(_q->scheme) && _method == LIQUID_MODEM_LLR_MAXLOG) {
+        MODEM(_llr_psk_maxlog)(_x, _n, _q->m, 1.0f / _noise_var, _llr);
+    } else {
+        MODEM(_llr_search)(c, _q->m, _x, _n, 1.0f / _noise_var, _method, _llr);
+    }
+}
+
+// soft-decision demodulation of a block of samples to 8-bit
+// log-likelihood ratios: round(_scale*LLR) saturated to [-127,127]
+//  _q          :   modem object
+//  _x          :   input samples [size: _n x 1]
+//  _n          :   number of input samples
+//  _noise_var  :   noise variance, E{|n|^2}
+//  _method     :   max-log or exact log-MAP
+//  _scale      :   LLR scaling before quantization
+//  _llr        :   output LLRs [size: _n*bps x 1]
+void MODEM(_demodulate_llr8)(MODEM()          _q,
+                             TC *             _x,
+                             unsigned int     _n,
+                             T                _noise_var,
+                             liquid_modem_llr _method,
+                             T                _scale,
+                             signed char *    _llr)
+{
+    T llr[MODEM_LLR_BLOCK_LEN*MAX_MOD_BITS_PER_SYMBOL];
+    unsigned int i, k;
+    for (i=0; i<_n; i+=MODEM_LLR_BLOCK_LEN) {
+        unsigned int n = _n - i < MODEM_LLR_BLOCK_LEN ? _n - i : MODEM_LLR_BLOCK_LEN;
+        MODEM(_demodulate_llr)(_q, _x + i, n, _noise_var, _method, llr);
+
+        signed char * y = _llr + i*_q->m;
+        for (k=0; k<n*_q->m; k++) {
+            T v = llr[k] * _scale;
+            v = v > 127.0f ? 127.0f : (v < -127.0f ? -127.0f : v);
+            y[k] = (signed char) lrintf(v);
+        }
+    }
+}
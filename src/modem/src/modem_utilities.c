@@ -306,7 +306,38 @@ void liquid_unpack_soft_bits(unsigned int _sym_in,
 
     unsigned int i;
     for (i=0; i<_bps; i++)
-        _soft_bits[i] = ((_sym_in >> (_bps-i-1)) & 0x0001) ? LIQUID_SOFTBIT_1 : LIQUID_SOFTBIT_0;
+        _soft_bits[i] = LIQUID_SOFTBIT_0 +
+            ((_sym_in >> (_bps-i-1)) & 0x0001) * (LIQUID_SOFTBIT_1 - LIQUID_SOFTBIT_0);
+}
+
+// unpack block of symbols into soft bits
+//  _sym_in     :   input symbols, values in [0,2^_bps) [size: _n x 1]
+//  _n          :   number of input symbols
+//  _bps        :   bits per symbol
+//  _soft_bits  :   soft output bits [size: _n*_bps x 1]
+void liquid_unpack_soft_bits_block(unsigned int *  _sym_in,
+                                   unsigned int    _n,
+                                   unsigned int    _bps,
+                                   unsigned char * _soft_bits)
+{
+    // validate input
+    if (_bps > MAX_MOD_BITS_PER_SYMBOL) {
+        fprintf(stderr,"error: liquid_unpack_soft_bits_block(), bits/symbol exceeds maximum (%u)\n", MAX_MOD_BITS_PER_SYMBOL);
+        exit(1);
+    }
+
+    // spread each symbol (left-aligned in a byte) into eight soft bits
+    // and write the whole word, letting the next symbol overwrite the
+    // unused tail; the last symbol(s) are written bit by bit
+    unsigned int i;
+    for (i=0; _bps > 0 && i*_bps + 8 <= _n*_bps; i++) {
+        uint64_t v = liquid_spread_bits_uint8((unsigned char)(_sym_in[i] << (8-_bps)));
+        liquid_store_le64(&_soft_bits[i*_bps],
+                          0x0101010101010101ULL*LIQUID_SOFTBIT_0 +
+                          v*(LIQUID_SOFTBIT_1 - LIQUID_SOFTBIT_0));
+    }
+    for (; i<_n; i++)
+        liquid_unpack_soft_bits(_sym_in[i], _bps, &_soft_bits[i*_bps]);
 }
 
 
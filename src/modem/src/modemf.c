@@ -59,6 +59,12 @@
 // arbitary modems
 #include "modem_arb.c"
 
+// block soft demodulation
+#include "modem_llr.c"
+
+// block modulation and hard-decision demodulation
+#include "modem_block.c"
+
 // analog modems
 #include "freqmod.c"
 #include "freqdem.c"
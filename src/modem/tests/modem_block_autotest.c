@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// block modulation and hard-decision demodulation tests
+//
+
+#include <stdlib.h>
+#include <math.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// compare block methods against one symbol at a time, both for exact
+// constellation points and samples in noise
+void modem_test_block(modulation_scheme _ms)
+{
+    modem mod0   = modem_create(_ms);
+    modem mod1   = modem_create(_ms);
+    modem demod0 = modem_create(_ms);
+    modem demod1 = modem_create(_ms);
+    unsigned int M = 1 << modem_get_bps(mod0);
+
+    unsigned int num_symbols = 203;
+    unsigned int sym_in[num_symbols];
+    unsigned int i;
+    for (i=0; i<num_symbols; i++)
+        sym_in[i] = rand() % M;
+
+    // modulate
+    float complex x0[num_symbols];
+    float complex x1[num_symbols];
+    for (i=0; i<num_symbols; i++)
+        modem_modulate(mod0, sym_in[i], &x0[i]);
+    modem_modulate_block(mod1, sym_in, num_symbols, x1);
+    for (i=0; i<num_symbols; i++)
+        CONTEND_DELTA(cabsf(x1[i] - x0[i]), 0.0f, 1e-6f);
+
+    // demodulate noise-free samples in two blocks
+    unsigned int sym_out[num_symbols];
+    modem_demodulate_block(demod1, x1,    37,             sym_out,    NULL, NULL);
+    modem_demodulate_block(demod1, x1+37, num_symbols-37, sym_out+37, NULL, NULL);
+    for (i=0; i<num_symbols; i++)
+        CONTEND_EQUALITY(sym_out[i], sym_in[i]);
+
+    // add noise and compare decisions and error statistics
+    float complex y[num_symbols];
+    for (i=0; i<num_symbols; i++)
+        y[i] = x0[i] + 0.1f*(randnf() + _Complex_I*randnf());
+    float phase_error[num_symbols];
+    float evm[num_symbols];
+    modem_reset(demod0);
+    modem_reset(demod1);
+    modem_demodulate_block(demod1, y, num_symbols, sym_out, phase_error, evm);
+    for (i=0; i<num_symbols; i++) {
+        unsigned int s;
+        modem_demodulate(demod0, y[i], &s);
+        CONTEND_EQUALITY(sym_out[i], s);
+        CONTEND_DELTA(phase_error[i], modem_get_demodulator_phase_error(demod0), 1e-5f);
+        CONTEND_DELTA(evm[i],         modem_get_demodulator_evm(demod0),         1e-5f);
+    }
+
+    // state reflects last sample
+    CONTEND_DELTA(modem_get_demodulator_phase_error(demod1),
+                  modem_get_demodulator_phase_error(demod0), 1e-5f);
+    CONTEND_DELTA(modem_get_demodulator_evm(demod1),
+                  modem_get_demodulator_evm(demod0), 1e-5f);
+
+    modem_destroy(mod0);
+    modem_destroy(mod1);
+    modem_destroy(demod0);
+    modem_destroy(demod1);
+}
+
+// AUTOTESTS: generic PSK
+void autotest_modem_block_psk2()    { modem_test_block(LIQUID_MODEM_PSK2);    }
+void autotest_modem_block_psk8()    { modem_test_block(LIQUID_MODEM_PSK8);    }
+void autotest_modem_block_psk64()   { modem_test_block(LIQUID_MODEM_PSK64);   }
+void autotest_modem_block_psk256()  { modem_test_block(LIQUID_MODEM_PSK256);  }
+
+// AUTOTESTS: generic differential PSK
+void autotest_modem_block_dpsk4()   { modem_test_block(LIQUID_MODEM_DPSK4);   }
+void autotest_modem_block_dpsk16()  { modem_test_block(LIQUID_MODEM_DPSK16);  }
+
+// AUTOTESTS: generic ASK
+void autotest_modem_block_ask2()    { modem_test_block(LIQUID_MODEM_ASK2);    }
+void autotest_modem_block_ask8()    { modem_test_block(LIQUID_MODEM_ASK8);    }
+void autotest_modem_block_ask64()   { modem_test_block(LIQUID_MODEM_ASK64);   }
+
+// AUTOTESTS: generic QAM
+void autotest_modem_block_qam4()    { modem_test_block(LIQUID_MODEM_QAM4);    }
+void autotest_modem_block_qam8()    { modem_test_block(LIQUID_MODEM_QAM8);    }
+void autotest_modem_block_qam32()   { modem_test_block(LIQUID_MODEM_QAM32);   }
+void autotest_modem_block_qam64()   { modem_test_block(LIQUID_MODEM_QAM64);   }
+void autotest_modem_block_qam256()  { modem_test_block(LIQUID_MODEM_QAM256);  }
+
+// AUTOTESTS: generic APSK
+void autotest_modem_block_apsk4()   { modem_test_block(LIQUID_MODEM_APSK4);   }
+void autotest_modem_block_apsk16()  { modem_test_block(LIQUID_MODEM_APSK16);  }
+void autotest_modem_block_apsk64()  { modem_test_block(LIQUID_MODEM_APSK64);  }
+void autotest_modem_block_apsk256() { modem_test_block(LIQUID_MODEM_APSK256); }
+
+// AUTOTESTS: specific modems
+void autotest_modem_block_bpsk()    { modem_test_block(LIQUID_MODEM_BPSK);    }
+void autotest_modem_block_qpsk()    { modem_test_block(LIQUID_MODEM_QPSK);    }
+void autotest_modem_block_ook()     { modem_test_block(LIQUID_MODEM_OOK);     }
+void autotest_modem_block_sqam32()  { modem_test_block(LIQUID_MODEM_SQAM32);  }
+void autotest_modem_block_sqam128() { modem_test_block(LIQUID_MODEM_SQAM128); }
+
+// AUTOTESTS: arbitrary modems
+void autotest_modem_block_V29()     { modem_test_block(LIQUID_MODEM_V29);     }
+void autotest_modem_block_arb64vt() { modem_test_block(LIQUID_MODEM_ARB64VT); }
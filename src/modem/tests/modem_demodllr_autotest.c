@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// block soft demodulation (log-likelihood ratio) tests
+//
+
+#include <stdlib.h>
+#include <math.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// compare block LLRs against a direct evaluation over all
+// constellation points, and check signs for noise-free input
+void modem_test_demodllr(modulation_scheme _ms,
+                         liquid_modem_llr  _method)
+{
+    modem mod   = modem_create(_ms);
+    modem demod = modem_create(_ms);
+    unsigned int bps = modem_get_bps(demod);
+    unsigned int M = 1 << bps;
+
+    // constellation
+    float complex c[M];
+    unsigned int i, j, k;
+    for (i=0; i<M; i++)
+        modem_modulate(mod, i, &c[i]);
+
+    // random symbols in noise, some well outside the constellation
+    unsigned int num_symbols = 203;
+    float noise_var = 0.05f;
+    float complex x[num_symbols];
+    float llr[num_symbols*bps];
+    for (i=0; i<num_symbols; i++) {
+        float sigma = (i % 5) == 0 ? 0.5f : 0.1f;
+        x[i] = c[rand() % M] + sigma*(randnf() + _Complex_I*randnf());
+    }
+    modem_demodulate_llr(demod, x, num_symbols, noise_var, _method, llr);
+
+    float d[M];
+    for (i=0; i<num_symbols; i++) {
+        float dmin = 1e30f;
+        for (j=0; j<M; j++) {
+            d[j] = crealf((x[i]-c[j])*conjf(x[i]-c[j]));
+            dmin = d[j] < dmin ? d[j] : dmin;
+        }
+        for (k=0; k<bps; k++) {
+            float v0 = _method == LIQUID_MODEM_LLR_EXACT ? 0.0f : 1e30f;
+            float v1 = v0;
+            for (j=0; j<M; j++) {
+                unsigned int bit = (j >> (bps-k-1)) & 1;
+                float v = _method == LIQUID_MODEM_LLR_EXACT ? expf(-(d[j]-dmin)/noise_var) : d[j];
+                if (_method == LIQUID_MODEM_LLR_EXACT) {
+                    if (bit) v1 += v; else v0 += v;
+                } else {
+                    if (bit) v1 = v < v1 ? v : v1; else v0 = v < v0 ? v : v0;
+                }
+            }
+            float llr_ref = _method == LIQUID_MODEM_LLR_EXACT ?
+                logf(v1) - logf(v0) : (v0 - v1) / noise_var;
+            float tol = 1e-3f*(1.0f + fabsf(llr_ref));
+            if (liquid_autotest_verbose && fabsf(llr[i*bps+k] - llr_ref) > tol)
+                printf("  %3u/%u : %12.6f (expected %12.6f)\n", i, k, llr[i*bps+k], llr_ref);
+            CONTEND_DELTA(llr[i*bps+k], llr_ref, tol);
+        }
+    }
+
+    // noise-free constellation points decode with correct signs
+    float llr_c[M*bps];
+    modem_demodulate_llr(demod, c, M, noise_var, _method, llr_c);
+    for (i=0; i<M; i++) {
+        for (k=0; k<bps; k++) {
+            unsigned int bit = (i >> (bps-k-1)) & 1;
+            CONTEND_EQUALITY(llr_c[i*bps+k] > 0, bit);
+        }
+    }
+
+    modem_destroy(mod);
+    modem_destroy(demod);
+}
+
+// differential schemes: decode noise-free sequence
+void modem_test_demodllr_dpsk(modulation_scheme _ms)
+{
+    modem mod   = modem_create(_ms);
+    modem demod = modem_create(_ms);
+    unsigned int bps = modem_get_bps(demod);
+
+    unsigned int num_symbols = 100;
+    unsigned int s[num_symbols];
+    float complex x[num_symbols];
+    float llr[num_symbols*bps];
+    unsigned int i, k;
+    for (i=0; i<num_symbols; i++) {
+        s[i] = modem_gen_rand_sym(mod);
+        modem_modulate(mod, s[i], &x[i]);
+    }
+
+    // demodulate in two blocks; state carries across
+    modem_demodulate_llr(demod, x,    37,             0.1f, LIQUID_MODEM_LLR_MAXLOG, llr);
+    modem_demodulate_llr(demod, x+37, num_symbols-37, 0.1f, LIQUID_MODEM_LLR_MAXLOG, llr+37*bps);
+    for (i=0; i<num_symbols; i++) {
+        for (k=0; k<bps; k++)
+            CONTEND_EQUALITY(llr[i*bps+k] > 0, (s[i] >> (bps-k-1)) & 1);
+    }
+
+    modem_destroy(mod);
+    modem_destroy(demod);
+}
+
+// AUTOTESTS: max-log
+void autotest_demodllr_maxlog_bpsk()    { modem_test_demodllr(LIQUID_MODEM_BPSK,    LIQUID_MODEM_LLR_MAXLOG); }
+void autotest_demodllr_maxlog_qpsk()    { modem_test_demodllr(LIQUID_MODEM_QPSK,    LIQUID_MODEM_LLR_MAXLOG); }
+void autotest_demodllr_maxlog_ask4()    { modem_test_demodllr(LIQUID_MODEM_ASK4,    LIQUID_MODEM_LLR_MAXLOG); }
+void autotest_demodllr_maxlog_ask16()   { modem_test_demodllr(LIQUID_MODEM_ASK16,   LIQUID_MODEM_LLR_MAXLOG); }
+void autotest_demodllr_maxlog_qam4()    { modem_test_demodllr(LIQUID_MODEM_QAM4,    LIQUID_MODEM_LLR_MAXLOG); }
+void autotest_demodllr_maxlog_qam8()    { modem_test_demodllr(LIQUID_MODEM_QAM8,    LIQUID_MODEM_LLR_MAXLOG); }
+void autotest_demodllr_maxlog_qam16()   { modem_test_demodllr(LIQUID_MODEM_QAM16,   LIQUID_MODEM_LLR_MAXLOG); }
+void autotest_demodllr_maxlog_qam32()   { modem_test_demodllr(LIQUID_MODEM_QAM32,   LIQUID_MODEM_LLR_MAXLOG); }
+void autotest_demodllr_maxlog_qam64()   { modem_test_demodllr(LIQUID_MODEM_QAM64,   LIQUID_MODEM_LLR_MAXLOG); }
+void autotest_demodllr_maxlog_qam256()  { modem_test_demodllr(LIQUID_MODEM_QAM256,  LIQUID_MODEM_LLR_MAXLOG); }
+void autotest_demodllr_maxlog_psk2()    { modem_test_demodllr(LIQUID_MODEM_PSK2,    LIQUID_MODEM_LLR_MAXLOG); }
+void autotest_demodllr_maxlog_psk8()    { modem_test_demodllr(LIQUID_MODEM_PSK8,    LIQUID_MODEM_LLR_MAXLOG); }
+void autotest_demodllr_maxlog_psk32()   { modem_test_demodllr(LIQUID_MODEM_PSK32,   LIQUID_MODEM_LLR_MAXLOG); }
+void autotest_demodllr_maxlog_apsk32()  { modem_test_demodllr(LIQUID_MODEM_APSK32,  LIQUID_MODEM_LLR_MAXLOG); }
+void autotest_demodllr_maxlog_sqam32()  { modem_test_demodllr(LIQUID_MODEM_SQAM32,  LIQUID_MODEM_LLR_MAXLOG); }
+void autotest_demodllr_maxlog_arb16opt(){ modem_test_demodllr(LIQUID_MODEM_ARB16OPT,LIQUID_MODEM_LLR_MAXLOG); }
+
+// AUTOTESTS: exact log-MAP
+void autotest_demodllr_exact_qpsk()     { modem_test_demodllr(LIQUID_MODEM_QPSK,    LIQUID_MODEM_LLR_EXACT);  }
+void autotest_demodllr_exact_ask8()     { modem_test_demodllr(LIQUID_MODEM_ASK8,    LIQUID_MODEM_LLR_EXACT);  }
+void autotest_demodllr_exact_qam16()    { modem_test_demodllr(LIQUID_MODEM_QAM16,   LIQUID_MODEM_LLR_EXACT);  }
+void autotest_demodllr_exact_qam128()   { modem_test_demodllr(LIQUID_MODEM_QAM128,  LIQUID_MODEM_LLR_EXACT);  }
+void autotest_demodllr_exact_psk16()    { modem_test_demodllr(LIQUID_MODEM_PSK16,   LIQUID_MODEM_LLR_EXACT);  }
+void autotest_demodllr_exact_apsk16()   { modem_test_demodllr(LIQUID_MODEM_APSK16,  LIQUID_MODEM_LLR_EXACT);  }
+
+// AUTOTESTS: differential PSK
+void autotest_demodllr_dpsk2()          { modem_test_demodllr_dpsk(LIQUID_MODEM_DPSK2);  }
+void autotest_demodllr_dpsk8()          { modem_test_demodllr_dpsk(LIQUID_MODEM_DPSK8);  }
+
+// 8-bit output matches scaled, rounded, saturated LLRs
+void autotest_demodllr8()
+{
+    modem q = modem_create(LIQUID_MODEM_QAM64);
+    unsigned int bps = modem_get_bps(q);
+    unsigned int i, n = 150;    // more than one internal block
+    float complex x[n];
+    for (i=0; i<n; i++)
+        x[i] = 1.2f*(randnf() + _Complex_I*randnf());
+
+    float       llr[n*bps];
+    signed char llr8[n*bps];
+    float scale = 4.0f;
+    modem_demodulate_llr (q, x, n, 0.1f, LIQUID_MODEM_LLR_MAXLOG, llr);
+    modem_demodulate_llr8(q, x, n, 0.1f, LIQUID_MODEM_LLR_MAXLOG, scale, llr8);
+    for (i=0; i<n*bps; i++) {
+        float v = scale*llr[i];
+        v = v > 127 ? 127 : (v < -127 ? -127 : v);
+        CONTEND_DELTA((float)llr8[i], v, 0.5001f);
+    }
+    modem_destroy(q);
+}
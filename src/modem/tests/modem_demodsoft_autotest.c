@@ -24,6 +24,7 @@
 // soft demodulation tests
 //
 
+#include <stdlib.h>
 #include "autotest/autotest.h"
 #include "liquid.h"
 
@@ -128,3 +129,25 @@ void autotest_demodsoft_arb128opt() { modem_test_demodsoft(LIQUID_MODEM_ARB128OP
 void autotest_demodsoft_arb256opt() { modem_test_demodsoft(LIQUID_MODEM_ARB256OPT); }
 void autotest_demodsoft_arb64vt()   { modem_test_demodsoft(LIQUID_MODEM_ARB64VT);   }
 
+
+// unpack block of symbols into soft bits and compare against
+// symbol-by-symbol unpacking
+void autotest_unpack_soft_bits_block()
+{
+    unsigned int n = 37;
+    unsigned int sym_in[n];
+    unsigned char soft_block[8*n];
+    unsigned char soft_test [8*n];
+
+    unsigned int bps, i;
+    for (bps=1; bps<=8; bps++) {
+        for (i=0; i<n; i++)
+            sym_in[i] = rand() & ((1 << bps) - 1);
+
+        liquid_unpack_soft_bits_block(sym_in, n, bps, soft_block);
+        for (i=0; i<n; i++)
+            liquid_unpack_soft_bits(sym_in[i], bps, &soft_test[i*bps]);
+
+        CONTEND_SAME_DATA(soft_block, soft_test, n*bps);
+    }
+}
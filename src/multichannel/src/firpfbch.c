@@ -33,6 +33,13 @@
 
 #include "liquid.internal.h"
 
+#if LIQUID_SIMD_DISPATCH
+#include <immintrin.h>  // AVX2 (selected at run time)
+#endif
+
+// number of frames processed together by block methods
+#define FIRPFBCH_BLOCK  (16)
+
 // firpfbch object structure definition
 struct FIRPFBCH(_s) {
     int type;                   // synthesis/analysis
@@ -43,26 +50,49 @@ struct FIRPFBCH(_s) {
     unsigned int h_len;         // filter length
     TC * h;                     // filter coefficients
     
-    // create separate bank of dotprod and window objects
-    DOTPROD() * dp;             // dot product object array
-    WINDOW() * w;               // window buffer object array
-    unsigned int filter_index;  // running filter index (analysis)
-
-    // fft plan
-    FFT_PLAN fft;               // fft|ifft object
+    // polyphase filter bank, transposed so that tap k of every branch
+    // is contiguous: hb[k*M + i] multiplies column i of state row k
+    TC * hb;                    // [size: p x num_channels]
+
+    // polyphase state: one row of num_channels samples (one per branch)
+    // per frame, oldest first; rows are appended until the buffer is
+    // full and the most recent p-1 rows are then moved to the front
+    T * v;                      // [size: (p-1+FIRPFBCH_BLOCK) x num_channels]
+    unsigned int v_index;       // rows written since last shift
+
+    // fft plans
+    FFT_PLAN fft;               // fft|ifft object (single frame)
+    FFT_PLAN fft_block;         // fft|ifft object (FIRPFBCH_BLOCK frames)
     TO * x;                     // fft|ifft transform input array
     TO * X;                     // fft|ifft transform output array
+
+    // SIMD extension level for inner products, selected at run time
+    liquid_simd_level level;
 };
 
 // 
 // forward declaration of internal methods
 //
 
-void FIRPFBCH(_analyzer_push)(FIRPFBCH() _q, TI _x);
-
-void FIRPFBCH(_analyzer_run)(FIRPFBCH()   _q,
-                             unsigned int _k,
-                             TO *         _X);
+T * FIRPFBCH(_write_frames)(FIRPFBCH()   _q,
+                            T *          _x,
+                            unsigned int _n);
+
+void FIRPFBCH(_dotprod_rows)(liquid_simd_level _level,
+                             TC *              _h,
+                             T *               _v,
+                             unsigned int      _n,
+                             unsigned int      _stride,
+                             unsigned int      _p,
+                             TO *              _y);
+#if LIQUID_SIMD_DISPATCH
+unsigned int FIRPFBCH(_dotprod_rows_avx2)(TC *         _h,
+                                          T *          _v,
+                                          unsigned int _n,
+                                          unsigned int _stride,
+                                          unsigned int _p,
+                                          TO *         _y);
+#endif
 
 
 // create FIR polyphase filterbank channelizer object
@@ -98,41 +128,42 @@ FIRPFBCH() FIRPFBCH(_create)(int          _type,
     // derived values
     q->h_len = q->num_channels * q->p;
 
-    // create bank of filters
-    q->dp = (DOTPROD()*) malloc((q->num_channels)*sizeof(DOTPROD()));
-    q->w  = (WINDOW()*)  malloc((q->num_channels)*sizeof(WINDOW()));
-
     // copy filter coefficients
     q->h = (TC*) malloc((q->h_len)*sizeof(TC));
     unsigned int i;
     for (i=0; i<q->h_len; i++)
         q->h[i] = _h[i];
 
-    // generate bank of sub-samped filters
-    unsigned int n;
-    unsigned int h_sub_len = q->p;
-    TC h_sub[h_sub_len];
-    for (i=0; i<q->num_channels; i++) {
-        // sub-sample prototype filter, loading coefficients in reverse order
-        for (n=0; n<h_sub_len; n++) {
-            h_sub[h_sub_len-n-1] = q->h[i + n*(q->num_channels)];
-        }
-        // create window buffer and dotprod object (coefficients
-        // loaded in reverse order)
-        q->dp[i] = DOTPROD(_create)(h_sub,h_sub_len);
-        q->w[i]  = WINDOW(_create)(h_sub_len);
+    // generate bank of sub-sampled filters, coefficients in reverse
+    // order; the analyzer reads its input frame in reverse so column
+    // i of the state is branch M-i-1
+    unsigned int M = q->num_channels;
+    unsigned int k;
+    q->hb = (TC*) malloc((q->h_len)*sizeof(TC));
+    for (i=0; i<M; i++) {
+        unsigned int branch = (q->type == LIQUID_ANALYZER) ? M-i-1 : i;
+        for (k=0; k<q->p; k++)
+            q->hb[k*M + i] = q->h[branch + (q->p-k-1)*M];
     }
 
+    // allocate polyphase state
+    q->v = (T*) malloc((q->p-1+FIRPFBCH_BLOCK)*M*sizeof(T));
+
     // allocate memory for buffers
     // TODO : use fftw_malloc if HAVE_FFTW3_H
-    q->x = (T*) malloc((q->num_channels)*sizeof(T));
-    q->X = (T*) malloc((q->num_channels)*sizeof(T));
+    q->x = (T*) malloc(FIRPFBCH_BLOCK*M*sizeof(T));
+    q->X = (T*) malloc(FIRPFBCH_BLOCK*M*sizeof(T));
+
+    // create fft plans
+    int dir = (q->type == LIQUID_ANALYZER) ? FFT_DIR_FORWARD : FFT_DIR_BACKWARD;
+    q->fft       = FFT_CREATE_PLAN(M, q->X, q->x, dir, FFT_METHOD);
+    q->fft_block = FFT_CREATE_PLAN_BATCH(M, FIRPFBCH_BLOCK, q->X, q->x, dir, FFT_METHOD);
 
-    // create fft plan
-    if (q->type == LIQUID_ANALYZER)
-        q->fft = FFT_CREATE_PLAN(q->num_channels, q->X, q->x, FFT_DIR_FORWARD, FFT_METHOD);
-    else
-        q->fft = FFT_CREATE_PLAN(q->num_channels, q->X, q->x, FFT_DIR_BACKWARD, FFT_METHOD);
+    // select inner product kernel
+    q->level = LIQUID_SIMD_BASELINE;
+#if LIQUID_SIMD_DISPATCH
+    q->level = liquid_simd_get_level();
+#endif
 
     // reset filterbank object
     FIRPFBCH(_reset)(q);
@@ -258,21 +289,14 @@ FIRPFBCH() FIRPFBCH(_create_rnyquist)(int          _type,
 // destroy firpfbch object
 void FIRPFBCH(_destroy)(FIRPFBCH() _q)
 {
-    unsigned int i;
-
-    // free dot product, window objects and arrays
-    for (i=0; i<_q->num_channels; i++) {
-        DOTPROD(_destroy)(_q->dp[i]);
-        WINDOW(_destroy)(_q->w[i]);
-    }
-    free(_q->dp);
-    free(_q->w);
-
-    // free transform object
+    // free transform objects
     FFT_DESTROY_PLAN(_q->fft);
+    FFT_DESTROY_PLAN(_q->fft_block);
 
     // free additional arrays
     free(_q->h);
+    free(_q->hb);
+    free(_q->v);
     free(_q->x);
     free(_q->X);
 
@@ -283,13 +307,11 @@ void FIRPFBCH(_destroy)(FIRPFBCH() _q)
 // clear/reset firpfbch object internals
 void FIRPFBCH(_reset)(FIRPFBCH() _q)
 {
-    unsigned int i;
-    for (i=0; i<_q->num_channels; i++) {
-        WINDOW(_clear)(_q->w[i]);
-        _q->x[i] = 0;
-        _q->X[i] = 0;
-    }
-    _q->filter_index = _q->num_channels-1;
+    unsigned int M = _q->num_channels;
+    memset(_q->v, 0x00, (_q->p-1+FIRPFBCH_BLOCK)*M*sizeof(T));
+    memset(_q->x, 0x00, FIRPFBCH_BLOCK*M*sizeof(T));
+    memset(_q->X, 0x00, FIRPFBCH_BLOCK*M*sizeof(T));
+    _q->v_index = 0;
 }
 
 // print firpfbch object
@@ -315,23 +337,43 @@ void FIRPFBCH(_synthesizer_execute)(FIRPFBCH() _q,
                                     TI * _x,
                                     TO * _y)
 {
-    unsigned int i;
-
-    // copy channelized symbols to transform input
-    memmove(_q->X, _x, _q->num_channels*sizeof(TI));
-
-    // execute inverse DFT, store result in buffer 'x'
-    FFT_EXECUTE(_q->fft);
+    FIRPFBCH(_synthesizer_execute_block)(_q, _x, 1, _y);
+}
 
-    // push samples into filter bank and execute
-    T * r;      // read pointer
-    for (i=0; i<_q->num_channels; i++) {
-        WINDOW(_push)(_q->w[i], _q->x[i]);
-        WINDOW(_read)(_q->w[i], &r);
-        DOTPROD(_execute)(_q->dp[i], r, &_y[i]);
+// execute filterbank as synthesizer on many frames
+//  _q      :   filterbank channelizer object
+//  _x      :   channelized input, [size: _n*num_channels x 1]
+//  _n      :   number of frames
+//  _y      :   output time series, [size: _n*num_channels x 1]
+void FIRPFBCH(_synthesizer_execute_block)(FIRPFBCH()   _q,
+                                          TI *         _x,
+                                          unsigned int _n,
+                                          TO *         _y)
+{
+    unsigned int M = _q->num_channels;
+    unsigned int i;
+    T * r;  // state read pointer
+    while (_n >= FIRPFBCH_BLOCK) {
+        // execute inverse DFTs, store result in buffer 'x'
+        memmove(_q->X, _x, FIRPFBCH_BLOCK*M*sizeof(TI));
+        FFT_EXECUTE(_q->fft_block);
+
+        // append to state and run filter bank on each frame
+        r = FIRPFBCH(_write_frames)(_q, _q->x, FIRPFBCH_BLOCK);
+        for (i=0; i<FIRPFBCH_BLOCK; i++)
+            FIRPFBCH(_dotprod_rows)(_q->level, _q->hb, r + i*M, M, M, _q->p, _y + i*M);
+
+        _x += FIRPFBCH_BLOCK*M;
+        _y += FIRPFBCH_BLOCK*M;
+        _n -= FIRPFBCH_BLOCK;
+    }
 
-        // normalize by DFT scaling factor
-        //_y[i] /= (float) (_q->num_channels);
+    // remaining frames, one at a time
+    for (i=0; i<_n; i++) {
+        memmove(_q->X, _x + i*M, M*sizeof(TI));
+        FFT_EXECUTE(_q->fft);
+        r = FIRPFBCH(_write_frames)(_q, _q->x, 1);
+        FIRPFBCH(_dotprod_rows)(_q->level, _q->hb, r, M, M, _q->p, _y + i*M);
     }
 }
 
@@ -347,65 +389,156 @@ void FIRPFBCH(_analyzer_execute)(FIRPFBCH() _q,
                                  TI * _x,
                                  TO * _y)
 {
-    unsigned int i;
+    FIRPFBCH(_analyzer_execute_block)(_q, _x, 1, _y);
+}
 
-    // push samples into buffers
-    for (i=0; i<_q->num_channels; i++)
-        FIRPFBCH(_analyzer_push)(_q, _x[i]);
+// execute filterbank as analyzer on many frames
+//  _q      :   filterbank channelizer object
+//  _x      :   input time series, [size: _n*num_channels x 1]
+//  _n      :   number of frames
+//  _y      :   channelized output, [size: _n*num_channels x 1]
+void FIRPFBCH(_analyzer_execute_block)(FIRPFBCH()   _q,
+                                       TI *         _x,
+                                       unsigned int _n,
+                                       TO *         _y)
+{
+    unsigned int M = _q->num_channels;
+    unsigned int i;
+    T * r;  // state read pointer
+    while (_n >= FIRPFBCH_BLOCK) {
+        // append input to state and run filter bank on each frame,
+        // storing result in transform input buffer
+        r = FIRPFBCH(_write_frames)(_q, _x, FIRPFBCH_BLOCK);
+        for (i=0; i<FIRPFBCH_BLOCK; i++)
+            FIRPFBCH(_dotprod_rows)(_q->level, _q->hb, r + i*M, M, M, _q->p, _q->X + i*M);
+
+        // execute DFTs, store result in buffer 'x'
+        FFT_EXECUTE(_q->fft_block);
+        memmove(_y, _q->x, FIRPFBCH_BLOCK*M*sizeof(TO));
+
+        _x += FIRPFBCH_BLOCK*M;
+        _y += FIRPFBCH_BLOCK*M;
+        _n -= FIRPFBCH_BLOCK;
+    }
 
-    // execute analysis filters on the given input starting
-    // with filterbank at index zero
-    FIRPFBCH(_analyzer_run)(_q, 0, _y);
+    // remaining frames, one at a time
+    for (i=0; i<_n; i++) {
+        r = FIRPFBCH(_write_frames)(_q, _x + i*M, 1);
+        FIRPFBCH(_dotprod_rows)(_q->level, _q->hb, r, M, M, _q->p, _q->X);
+        FFT_EXECUTE(_q->fft);
+        memmove(_y + i*M, _q->x, M*sizeof(TO));
+    }
 }
 
 // 
 // internal methods
 //
 
-// push single sample into analysis filterbank, updating index
-// counter appropriately
+// append frames to polyphase state, shifting history to the front of
+// the buffer when it is full
 //  _q      :   filterbank channelizer object
-//  _x      :   input sample
-void FIRPFBCH(_analyzer_push)(FIRPFBCH() _q,
-                              TI _x)
+//  _x      :   frames to append, [size: _n*num_channels x 1]
+//  _n      :   number of frames, _n <= FIRPFBCH_BLOCK
+//  returns pointer to oldest state row seen by first frame
+T * FIRPFBCH(_write_frames)(FIRPFBCH()   _q,
+                            T *          _x,
+                            unsigned int _n)
 {
-    // push sample into filter
-    WINDOW(_push)(_q->w[_q->filter_index], _x);
-
-    // decrement filter index
-    _q->filter_index = (_q->filter_index + _q->num_channels - 1) % _q->num_channels;
+    unsigned int M = _q->num_channels;
+    if (_q->v_index + _n > FIRPFBCH_BLOCK) {
+        memmove(_q->v, _q->v + _q->v_index*M, (_q->p-1)*M*sizeof(T));
+        _q->v_index = 0;
+    }
+    T * r = _q->v + _q->v_index*M;
+    memmove(r + (_q->p-1)*M, _x, _n*M*sizeof(T));
+    _q->v_index += _n;
+    return r;
 }
 
-// run filterbank analyzer dot products, DFT
-//  _q      :   filterbank channelizer object
-//  _k      :   filterbank alignment index
-//  _y      :   output array, [size: num_channels x 1]
-void FIRPFBCH(_analyzer_run)(FIRPFBCH() _q,
-                             unsigned int _k,
-                             TO * _y)
+#if LIQUID_SIMD_DISPATCH
+// inner products for groups of four branches, returning number of
+// branches processed
+__attribute__((target("avx2,fma")))
+unsigned int FIRPFBCH(_dotprod_rows_avx2)(TC *         _h,
+                                          T *          _v,
+                                          unsigned int _n,
+                                          unsigned int _stride,
+                                          unsigned int _p,
+                                          TO *         _y)
 {
-    unsigned int i;
-
-    // execute filter outputs, reversing order of output (not
-    // sure why this is necessary)
-    T * r;  // read pointer
-    unsigned int index;
-    for (i=0; i<_q->num_channels; i++) {
-        // compute appropriate index
-        index = (i+_k) % _q->num_channels;
-
-        // read buffer at specified index
-        WINDOW(_read)(_q->w[index], &r);
-
-        // compute dot product
-        DOTPROD(_execute)(_q->dp[i], r, &_q->X[_q->num_channels-i-1]);
+    unsigned int i, k;
+    for (i=0; i+4<=_n; i+=4) {
+#if TC_COMPLEX
+        // accumulate real and cross terms separately, combine at end
+        __m256 acc0 = _mm256_setzero_ps();
+        __m256 acc1 = _mm256_setzero_ps();
+        for (k=0; k<_p; k++) {
+            __m256 v  = _mm256_loadu_ps((float*)(_v + k*_stride + i));
+            __m256 h  = _mm256_loadu_ps((float*)(_h + k*_n      + i));
+            __m256 vs = _mm256_permute_ps(v, 0xb1);
+            acc0 = _mm256_fmadd_ps(_mm256_moveldup_ps(h), v,  acc0);
+            acc1 = _mm256_fmadd_ps(_mm256_movehdup_ps(h), vs, acc1);
+        }
+        _mm256_storeu_ps((float*)(_y + i), _mm256_addsub_ps(acc0, acc1));
+#else
+        // duplicate real coefficients across real/imaginary lanes
+        __m256i dup = _mm256_setr_epi32(0,0,1,1,2,2,3,3);
+        __m256  acc = _mm256_setzero_ps();
+        for (k=0; k<_p; k++) {
+            __m256 v = _mm256_loadu_ps((float*)(_v + k*_stride + i));
+            __m256 h = _mm256_castps128_ps256(_mm_loadu_ps(_h + k*_n + i));
+            acc = _mm256_fmadd_ps(_mm256_permutevar8x32_ps(h, dup), v, acc);
+        }
+        _mm256_storeu_ps((float*)(_y + i), acc);
+#endif
+    }
+    return i;
+}
+#endif
+
+// inner products across all branches of one frame: tap k of every
+// branch is contiguous, so branches rather than taps are vectorized
+//  _level  :   SIMD extension level
+//  _h      :   coefficients, [size: _p x _n]
+//  _v      :   state; row k begins at _v + k*_stride
+//  _n      :   number of branches (columns)
+//  _stride :   distance between state rows
+//  _p      :   number of taps (rows)
+//  _y      :   output, [size: _n x 1]
+void FIRPFBCH(_dotprod_rows)(liquid_simd_level _level,
+                             TC *              _h,
+                             T *               _v,
+                             unsigned int      _n,
+                             unsigned int      _stride,
+                             unsigned int      _p,
+                             TO *              _y)
+{
+    unsigned int i = 0;
+#if LIQUID_SIMD_DISPATCH
+    // run vector kernel on groups of branches; remainder falls
+    // through to the portable loop below
+    if (_level >= LIQUID_SIMD_AVX2)
+        i = FIRPFBCH(_dotprod_rows_avx2)(_h, _v, _n, _stride, _p, _y);
+#endif
+
+    unsigned int k;
+    for ( ; i<_n; i++) {
+        float yr = 0.0f;
+        float yi = 0.0f;
+        for (k=0; k<_p; k++) {
+            float * v = (float*) (_v + k*_stride + i);
+#if TC_COMPLEX
+            float * h = (float*) (_h + k*_n + i);
+            yr += h[0]*v[0] - h[1]*v[1];
+            yi += h[0]*v[1] + h[1]*v[0];
+#else
+            TC h = _h[k*_n + i];
+            yr += h*v[0];
+            yi += h*v[1];
+#endif
+        }
+        float * y = (float*) (_y + i);
+        y[0] = yr;
+        y[1] = yi;
     }
-
-    // execute DFT, store result in buffer 'x'
-    FFT_EXECUTE(_q->fft);
-
-    // move to output array
-    memmove(_y, _q->x, _q->num_channels*sizeof(TO));
 }
-
-
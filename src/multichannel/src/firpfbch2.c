@@ -32,6 +32,14 @@
 #include <string.h>
 #include <math.h>
 
+// number of transforms processed together by block methods
+#define FIRPFBCH2_BLOCK (16)
+
+// with a channel mask, active channels are computed with a direct DFT
+// (one inner product per channel) rather than the full transform when
+// there are at most this many times log2(M) of them
+#define FIRPFBCH2_PRUNE_RATIO (2)
+
 // firpfbch2 object structure definition
 struct FIRPFBCH2(_s) {
     int type;           // synthesis/analysis
@@ -42,21 +50,49 @@ struct FIRPFBCH2(_s) {
     // filter
     unsigned int h_len; // prototype filter length: 2*M*m
     
-    // create separate bank of dotprod and window objects
-    DOTPROD() * dp;     // dot product object array
-
-    // inverse FFT plan
-    FFT_PLAN ifft;      // inverse FFT object
-    TO * X;             // IFFT input array  [size: M x 1]
-    TO * x;             // IFFT output array [size: M x 1]
-
-    // common data structures shared between analysis and
-    // synthesis algorithms
-    WINDOW() * w0;      // window buffer object array
-    WINDOW() * w1;      // window buffer object array (synthesizer only)
+    // polyphase filter bank, transposed so that each tap is contiguous
+    // across branches (see FIRPFBCH(_dotprod_rows))
+    //  analyzer:    [2m x M],  column i is branch M-i-1
+    //  synthesizer: [4m x M/2], taps alternate between branch i+M/2
+    //               (older buffer) and branch i (newer buffer)
+    TC * hb;
+    unsigned int num_taps;  // number of rows in hb
+
+    // inverse FFT plans
+    FFT_PLAN ifft;      // inverse FFT object (single transform)
+    FFT_PLAN ifft_block;// inverse FFT object (FIRPFBCH2_BLOCK transforms)
+    TO * X;             // IFFT input array  [size: FIRPFBCH2_BLOCK*M x 1]
+    TO * x;             // IFFT output array [size: FIRPFBCH2_BLOCK*M x 1]
+
+    // polyphase state: the analyzer keeps its input stream (the branches
+    // of one output are M contiguous samples, 2m rows M samples apart),
+    // the synthesizer one row of M transform outputs per input; history
+    // is moved to the front of the buffer once it is full
+    T * v;              // state buffer
+    unsigned int v_len; // history length (samples)
+    unsigned int v_hop; // samples written per execution
+    unsigned int v_index;   // executions since last shift
     int flag;           // flag indicating filter/buffer alignment
+
+    // SIMD extension level for inner products, selected at run time
+    liquid_simd_level level;
+
+    // channel mask: only active channels are produced (analyzer) or
+    // accepted (synthesizer), packed in increasing channel order
+    int masked;                 // fewer than M channels active?
+    unsigned int num_active;    // number of active channels
+    unsigned int * active;      // active channel indices [size: M x 1]
+    int pruned;                 // use direct DFT for active channels?
+    T * dft_w;                  // DFT twiddles [size: num_active x M]
+    DOTPROD_T() * dft;          // analyzer DFT, one per active channel
 };
 
+// append input of _n executions to state, returning pointer to the
+// oldest sample used by the first execution
+T * FIRPFBCH2(_write)(FIRPFBCH2()  _q,
+                      T *          _x,
+                      unsigned int _n);
+
 // create firpfbch2 object
 //  _type   :   channelizer type (e.g. LIQUID_ANALYZER)
 //  _M      :   number of channels (must be even)
@@ -92,35 +128,53 @@ FIRPFBCH2() FIRPFBCH2(_create)(int          _type,
     q->h_len    = 2*q->M*q->m;  // prototype filter length
     q->M2       = q->M / 2;     // number of channels / 2
 
-    // generate bank of sub-samped filters
-    q->dp = (DOTPROD()*) malloc((q->M)*sizeof(DOTPROD()));
-    unsigned int i;
-    unsigned int n;
-    unsigned int h_sub_len = 2 * q->m;
-    TC h_sub[h_sub_len];
-    for (i=0; i<q->M; i++) {
-        // sub-sample prototype filter, loading coefficients
-        // in reverse order
-        for (n=0; n<h_sub_len; n++)
-            h_sub[h_sub_len-n-1] = _h[i + n*(q->M)];
-
-        // create dotprod object
-        q->dp[i] = DOTPROD(_create)(h_sub,h_sub_len);
+    // generate bank of sub-sampled filters, loading coefficients
+    // in reverse order, hr(j,k) = h[j + (2m-k-1)*M]
+    unsigned int M  = q->M;
+    unsigned int M2 = q->M2;
+    unsigned int p  = 2*q->m;
+    unsigned int i, k;
+    q->hb = (TC*) malloc(q->h_len*sizeof(TC));
+    if (q->type == LIQUID_ANALYZER) {
+        q->num_taps = p;
+        for (i=0; i<M; i++) {
+            for (k=0; k<p; k++)
+                q->hb[k*M + i] = _h[(M-i-1) + (p-k-1)*M];
+        }
+    } else {
+        q->num_taps = 2*p;
+        for (i=0; i<M2; i++) {
+            for (k=0; k<p; k++) {
+                q->hb[(2*k  )*M2 + i] = _h[(i+M2) + (p-k-1)*M];
+                q->hb[(2*k+1)*M2 + i] = _h[ i     + (p-k-1)*M];
+            }
+        }
     }
 
-    // create FFT plan (inverse transform)
+    // create FFT plans (inverse transform)
     // TODO : use fftw_malloc if HAVE_FFTW3_H
-    q->X = (T*) malloc((q->M)*sizeof(T));   // IFFT input
-    q->x = (T*) malloc((q->M)*sizeof(T));   // IFFT output
-    q->ifft = FFT_CREATE_PLAN(q->M, q->X, q->x, FFT_DIR_BACKWARD, FFT_METHOD);
-
-    // create buffer objects
-    q->w0 = (WINDOW()*) malloc((q->M)*sizeof(WINDOW()));
-    q->w1 = (WINDOW()*) malloc((q->M)*sizeof(WINDOW()));
-    for (i=0; i<q->M; i++) {
-        q->w0[i] = WINDOW(_create)(h_sub_len);
-        q->w1[i] = WINDOW(_create)(h_sub_len);
-    }
+    q->X = (T*) malloc(FIRPFBCH2_BLOCK*M*sizeof(T));   // IFFT input
+    q->x = (T*) malloc(FIRPFBCH2_BLOCK*M*sizeof(T));   // IFFT output
+    q->ifft       = FFT_CREATE_PLAN(M, q->X, q->x, FFT_DIR_BACKWARD, FFT_METHOD);
+    q->ifft_block = FFT_CREATE_PLAN_BATCH(M, FIRPFBCH2_BLOCK, q->X, q->x,
+                                          FFT_DIR_BACKWARD, FFT_METHOD);
+
+    // create state buffer
+    q->v_hop = (q->type == LIQUID_ANALYZER) ? M2 : M;
+    q->v_len = (q->type == LIQUID_ANALYZER) ? p*M - M2 : (2*p-1)*M;
+    q->v = (T*) malloc((q->v_len + FIRPFBCH2_BLOCK*q->v_hop)*sizeof(T));
+
+    // select inner product kernel
+    q->level = LIQUID_SIMD_BASELINE;
+#if LIQUID_SIMD_DISPATCH
+    q->level = liquid_simd_get_level();
+#endif
+
+    // all channels active
+    q->active = (unsigned int*) malloc(M*sizeof(unsigned int));
+    q->dft_w  = NULL;
+    q->dft    = NULL;
+    FIRPFBCH2(_set_channel_mask)(q, NULL);
 
     // reset filterbank object and return
     FIRPFBCH2(_reset)(q);
@@ -185,25 +239,19 @@ FIRPFBCH2() FIRPFBCH2(_create_kaiser)(int          _type,
 // destroy firpfbch2 object, freeing internal memory
 void FIRPFBCH2(_destroy)(FIRPFBCH2() _q)
 {
-    unsigned int i;
-
-    // free dotprod objects
-    for (i=0; i<_q->M; i++)
-        DOTPROD(_destroy)(_q->dp[i]);
-    free(_q->dp);
-
-    // free transform object and arrays
+    // free transform objects and arrays
     FFT_DESTROY_PLAN(_q->ifft);
+    FFT_DESTROY_PLAN(_q->ifft_block);
     free(_q->X);
     free(_q->x);
     
-    // free window objects (buffers)
-    for (i=0; i<_q->M; i++) {
-        WINDOW(_destroy)(_q->w0[i]);
-        WINDOW(_destroy)(_q->w1[i]);
-    }
-    free(_q->w0);
-    free(_q->w1);
+    // free filter bank and state
+    free(_q->hb);
+    free(_q->v);
+
+    // free channel mask and pruned transform
+    FIRPFBCH2(_set_channel_mask)(_q, NULL);
+    free(_q->active);
 
     // free main object memory
     free(_q);
@@ -212,13 +260,9 @@ void FIRPFBCH2(_destroy)(FIRPFBCH2() _q)
 // reset firpfbch2 object internals
 void FIRPFBCH2(_reset)(FIRPFBCH2() _q)
 {
-    unsigned int i;
-
-    // clear window buffers
-    for (i=0; i<_q->M; i++) {
-        WINDOW(_clear)(_q->w0[i]);
-        WINDOW(_clear)(_q->w1[i]);
-    }
+    // clear state
+    memset(_q->v, 0x00, (_q->v_len + FIRPFBCH2_BLOCK*_q->v_hop)*sizeof(T));
+    _q->v_index = 0;
 
     // reset filter/buffer alignment flag
     _q->flag = 0;
@@ -231,112 +275,151 @@ void FIRPFBCH2(_print)(FIRPFBCH2() _q)
     printf("    channels    :   %u\n", _q->M);
     printf("    h_len       :   %u\n", _q->h_len);
     printf("    semi-length :   %u\n", _q->m);
+    printf("    active      :   %u%s\n", _q->num_active,
+            _q->pruned ? " (direct DFT)" : "");
+}
 
-    // TODO: print filter coefficients...
-    unsigned int i;
-    for (i=0; i<_q->M; i++)
-        DOTPROD(_print)(_q->dp[i]);
+// set channel mask; only channels with a non-zero entry are produced
+// by the analyzer or accepted by the synthesizer, packed in increasing
+// channel order, and the transform is pruned when few are active
+//  _q      :   filterbank object
+//  _mask   :   channel mask [size: M x 1], NULL enables all channels
+void FIRPFBCH2(_set_channel_mask)(FIRPFBCH2()     _q,
+                                  unsigned char * _mask)
+{
+    unsigned int M = _q->M;
+    unsigned int i, j;
+
+    // free existing pruned transform
+    if (_q->dft != NULL) {
+        for (j=0; j<_q->num_active; j++)
+            DOTPROD_T(_destroy)(_q->dft[j]);
+        free(_q->dft);
+        _q->dft = NULL;
+    }
+    free(_q->dft_w);
+    _q->dft_w = NULL;
+
+    // build list of active channels
+    _q->num_active = 0;
+    for (i=0; i<M; i++) {
+        if (_mask == NULL || _mask[i])
+            _q->active[_q->num_active++] = i;
+    }
+    _q->masked = _q->num_active < M;
+
+    // use direct DFT when few channels are active; cost is roughly
+    // num_active inner products of length M against one transform
+    _q->pruned = _q->masked &&
+                 _q->num_active <= FIRPFBCH2_PRUNE_RATIO*liquid_msb_index(M);
+    if (!_q->pruned)
+        return;
+
+    // twiddles for inverse transform, exp(j 2 pi k n / M) for each
+    // active channel n; reduce k*n modulo M for accuracy
+    _q->dft_w = (T*) malloc(_q->num_active*M*sizeof(T));
+    for (j=0; j<_q->num_active; j++) {
+        for (i=0; i<M; i++) {
+            double theta = 2*M_PI*(double)((i*_q->active[j]) % M) / (double)M;
+            _q->dft_w[j*M + i] = cos(theta) + _Complex_I*sin(theta);
+        }
+    }
+    if (_q->type == LIQUID_ANALYZER) {
+        _q->dft = (DOTPROD_T()*) malloc(_q->num_active*sizeof(DOTPROD_T()));
+        for (j=0; j<_q->num_active; j++)
+            _q->dft[j] = DOTPROD_T(_create)(&_q->dft_w[j*M], M);
+    }
+}
+
+// get number of active channels
+unsigned int FIRPFBCH2(_get_num_active)(FIRPFBCH2() _q)
+{
+    return _q->num_active;
 }
 
 // execute filterbank channelizer (analyzer)
 //  _x      :   channelizer input,  [size: M/2 x 1]
-//  _y      :   channelizer output, [size: M   x 1]
+//  _y      :   channelizer output, [size: K   x 1] (K active channels)
 void FIRPFBCH2(_execute_analyzer)(FIRPFBCH2() _q,
                                   TI *        _x,
                                   TO *        _y)
 {
-    unsigned int i;
-
-    // load buffers in blocks of num_channels/2 starting
-    // in the middle of the filter bank and moving in the
-    // negative direction
-    unsigned int base_index = _q->flag ? _q->M : _q->M2;
-    for (i=0; i<_q->M2; i++) {
-        // push sample into buffer at filter index
-        WINDOW(_push)(_q->w0[base_index-i-1], _x[i]);
-    }
-
-    // execute filter outputs
-    unsigned int offset = _q->flag ? _q->M2 : 0;
-    TI * r;      // buffer read pointer
-    for (i=0; i<_q->M; i++) {
-        // compute buffer index
-        unsigned int buffer_index  = (offset+i)%(_q->M);
-
-        // read buffer at index
-        WINDOW(_read)(_q->w0[buffer_index], &r);
+    FIRPFBCH2(_execute_block)(_q, _x, 1, _y);
+}
 
-        // run dot product storing result in IFFT input buffer
-        DOTPROD(_execute)(_q->dp[i], r, &_q->X[buffer_index]);
+// run analysis filter bank on _n executions, storing IFFT input
+//  _r      :   state read pointer returned by FIRPFBCH2(_write)
+//  _n      :   number of executions
+void FIRPFBCH2(_analyzer_run)(FIRPFBCH2()  _q,
+                              T *          _r,
+                              unsigned int _n)
+{
+    unsigned int M = _q->M;
+    unsigned int i, t;
+    for (t=0; t<_n; t++) {
+        // branches of this output are the M samples starting at
+        // _r + t*M/2, with taps every M samples
+        TO * X = _q->X + t*M;
+        FIRPFBCH(_dotprod_rows)(_q->level, _q->hb, _r + t*_q->M2, M, M,
+                                _q->num_taps, X);
+
+        // column i is channel M-i-1, rotated by M/2 on alternating runs;
+        // the permutation is its own inverse so swap pairs in place
+        unsigned int offset = _q->flag ? _q->M2 : 0;
+        for (i=0; i<M; i++) {
+            unsigned int j = (M - i - 1 + offset) % M;
+            if (i < j) {
+                TO tmp = X[i];
+                X[i] = X[j];
+                X[j] = tmp;
+            }
+        }
+
+        // update flag
+        _q->flag = 1 - _q->flag;
     }
-
-    // execute IFFT, store result in buffer 'x'
-    FFT_EXECUTE(_q->ifft);
-
-    // scale result by 1/num_channels (C transform)
-    for (i=0; i<_q->M; i++)
-        _y[i] = _q->x[i] / (float)(_q->M);
-
-    // update flag
-    _q->flag = 1 - _q->flag;
 }
 
 // execute filterbank channelizer (synthesizer)
-//  _x      :   channelizer input,  [size: M   x 1]
+//  _x      :   channelizer input,  [size: K   x 1] (K active channels)
 //  _y      :   channelizer output, [size: M/2 x 1]
 void FIRPFBCH2(_execute_synthesizer)(FIRPFBCH2() _q,
                                      TI *        _x,
                                      TO *        _y)
 {
-    unsigned int i;
+    FIRPFBCH2(_execute_block)(_q, _x, 1, _y);
+}
 
-    // copy input array to internal IFFT input buffer
-    memmove(_q->X, _x, _q->M * sizeof(TI));
-
-    // execute IFFT, store result in buffer 'x'
-    FFT_EXECUTE(_q->ifft);
-
-    // TODO: ignore this scaling
-    // scale result by 1/num_channels (C transform)
-    for (i=0; i<_q->M; i++)
-        _q->x[i] *= 1.0f / (float)(_q->M);
-    // scale result by num_channels/2
-    for (i=0; i<_q->M; i++)
-        _q->x[i] *= (float)(_q->M2);
-
-    // push samples into appropriate buffer
-    WINDOW() * buffer = (_q->flag == 0 ? _q->w1 : _q->w0);
-    for (i=0; i<_q->M; i++)
-        WINDOW(_push)(buffer[i], _q->x[i]);
-
-    // compute filter outputs
-    TO * r0, * r1;  // buffer read pointers
-    TO   y0,   y1;  // dotprod outputs
-    for (i=0; i<_q->M2; i++) {
-        // buffer index
-        unsigned int b = (_q->flag == 0) ? i : i+_q->M2;
-
-        // read buffer with index offset
-        WINDOW(_read)(_q->w0[b], &r0);
-        WINDOW(_read)(_q->w1[b], &r1);
-
-        // swap buffer outputs on alternating runs
-        TO * p0 = _q->flag ? r0 : r1;
-        TO * p1 = _q->flag ? r1 : r0;
-
-        // run dot products
-        DOTPROD(_execute)(_q->dp[i],        p0, &y0);
-        DOTPROD(_execute)(_q->dp[i+_q->M2], p1, &y1);
-
-        // save output
-        _y[i] = y0 + y1;
+// run synthesis filter bank on _n executions of IFFT output 'x'
+//  _n      :   number of executions
+//  _y      :   channelizer output, [size: _n*M/2 x 1]
+void FIRPFBCH2(_synthesizer_run)(FIRPFBCH2()  _q,
+                                 unsigned int _n,
+                                 TO *         _y)
+{
+    unsigned int M = _q->M;
+    unsigned int i, t;
+
+    // scale result by 1/num_channels (C transform) and by num_channels/2
+    float g = (float)(_q->M2) / (float)(M);
+    for (i=0; i<_n*M; i++)
+        _q->x[i] *= g;
+
+    // append to state and compute filter outputs; output i combines
+    // columns i (or i+M/2 on alternating runs) of the last 4m rows
+    T * r = FIRPFBCH2(_write)(_q, _q->x, _n);
+    for (t=0; t<_n; t++) {
+        unsigned int offset = _q->flag ? _q->M2 : 0;
+        FIRPFBCH(_dotprod_rows)(_q->level, _q->hb, r + t*M + offset, _q->M2, M,
+                                _q->num_taps, _y + t*_q->M2);
+        _q->flag = 1 - _q->flag;
     }
-    _q->flag = 1 - _q->flag;
 }
 
 // execute filterbank channelizer
-// LIQUID_ANALYZER:     input: M/2, output: M
-// LIQUID_SYNTHESIZER:  input: M,   output: M/2
+// LIQUID_ANALYZER:     input: M/2, output: K
+// LIQUID_SYNTHESIZER:  input: K,   output: M/2
+// where K is the number of active channels (M without a channel mask)
 //  _x      :   channelizer input
 //  _y      :   channelizer output
 void FIRPFBCH2(_execute)(FIRPFBCH2() _q,
@@ -356,3 +439,107 @@ void FIRPFBCH2(_execute)(FIRPFBCH2() _q,
     }
 }
 
+// execute filterbank channelizer on many inputs
+// LIQUID_ANALYZER:     input: _n*M/2, output: _n*K
+// LIQUID_SYNTHESIZER:  input: _n*K,   output: _n*M/2
+// where K is the number of active channels (M without a channel mask)
+//  _x      :   channelizer input
+//  _n      :   number of executions
+//  _y      :   channelizer output
+void FIRPFBCH2(_execute_block)(FIRPFBCH2()  _q,
+                               TI *         _x,
+                               unsigned int _n,
+                               TO *         _y)
+{
+    unsigned int M  = _q->M;
+    unsigned int M2 = _q->M2;
+    unsigned int K  = _q->num_active;
+    float        g  = 1.0f / (float)M;
+    unsigned int i, j, t;
+    for (t=0; t<_n; ) {
+        // use batched transform on full blocks
+        unsigned int n = (_n - t >= FIRPFBCH2_BLOCK) ? FIRPFBCH2_BLOCK : 1;
+        FFT_PLAN ifft  = (n == FIRPFBCH2_BLOCK) ? _q->ifft_block : _q->ifft;
+
+        if (_q->type == LIQUID_ANALYZER) {
+            // filter, storing result in IFFT input buffer 'X'
+            T * r = FIRPFBCH2(_write)(_q, _x + t*M2, n);
+            FIRPFBCH2(_analyzer_run)(_q, r, n);
+
+            // compute active channels, scale result by 1/num_channels
+            // (C transform)
+            TO * y = _y + t*K;
+            if (_q->pruned) {
+                for (i=0; i<n; i++) {
+                    for (j=0; j<K; j++) {
+                        DOTPROD_T(_execute)(_q->dft[j], _q->X + i*M, &y[i*K + j]);
+                        y[i*K + j] *= g;
+                    }
+                }
+            } else if (_q->masked) {
+                FFT_EXECUTE(ifft);
+                for (i=0; i<n; i++) {
+                    for (j=0; j<K; j++)
+                        y[i*K + j] = _q->x[i*M + _q->active[j]] * g;
+                }
+            } else {
+                FFT_EXECUTE(ifft);
+                for (i=0; i<n*M; i++)
+                    y[i] = _q->x[i] * g;
+            }
+        } else {
+            // compute IFFT of active channels, store result in buffer
+            // 'x', filter
+            TI * x = _x + t*K;
+            if (_q->pruned) {
+                memset(_q->x, 0x00, n*M*sizeof(T));
+                for (i=0; i<n; i++) {
+                    for (j=0; j<K; j++) {
+                        // accumulate channel j onto all outputs
+                        float   a  = crealf(x[i*K + j]);
+                        float   b  = cimagf(x[i*K + j]);
+                        float * w  = (float*) &_q->dft_w[j*M];
+                        float * xi = (float*) (_q->x + i*M);
+                        unsigned int k;
+                        for (k=0; k<M; k++) {
+                            float wr = w[0];
+                            float wi = w[1];
+                            xi[0] += a*wr - b*wi;
+                            xi[1] += a*wi + b*wr;
+                            xi += 2;
+                            w  += 2;
+                        }
+                    }
+                }
+            } else if (_q->masked) {
+                memset(_q->X, 0x00, n*M*sizeof(T));
+                for (i=0; i<n; i++) {
+                    for (j=0; j<K; j++)
+                        _q->X[i*M + _q->active[j]] = x[i*K + j];
+                }
+                FFT_EXECUTE(ifft);
+            } else {
+                memmove(_q->X, x, n*M*sizeof(TI));
+                FFT_EXECUTE(ifft);
+            }
+            FIRPFBCH2(_synthesizer_run)(_q, n, _y + t*M2);
+        }
+        t += n;
+    }
+}
+
+// append input of _n executions to state, returning pointer to the
+// oldest sample used by the first execution
+T * FIRPFBCH2(_write)(FIRPFBCH2()  _q,
+                      T *          _x,
+                      unsigned int _n)
+{
+    if (_q->v_index + _n > FIRPFBCH2_BLOCK) {
+        memmove(_q->v, _q->v + _q->v_index*_q->v_hop, _q->v_len*sizeof(T));
+        _q->v_index = 0;
+    }
+    T * r = _q->v + _q->v_index*_q->v_hop;
+    memmove(r + _q->v_len, _x, _n*_q->v_hop*sizeof(T));
+    _q->v_index += _n;
+    return r;
+}
@@ -40,6 +40,7 @@
 #define TI                  float complex   // input
 #define WINDOW(name)        LIQUID_CONCAT(windowcf,name)
 #define DOTPROD(name)       LIQUID_CONCAT(dotprod_crcf,name)
+#define DOTPROD_T(name)     LIQUID_CONCAT(dotprod_cccf,name)    // T coefficients
 
 #define TO_COMPLEX          1
 #define TC_COMPLEX          0
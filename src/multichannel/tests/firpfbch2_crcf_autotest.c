@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  */
 
+#include <stdlib.h>
 #include <assert.h>
 #include "autotest/autotest.h"
 #include "liquid.h"
@@ -97,3 +98,208 @@ void autotest_firpfbch2_crcf_n16()   { firpfbch2_crcf_runtest(  16, 5, 60.0f); }
 void autotest_firpfbch2_crcf_n32()   { firpfbch2_crcf_runtest(  32, 5, 60.0f); }
 void autotest_firpfbch2_crcf_n64()   { firpfbch2_crcf_runtest(  64, 5, 60.0f); }
 
+
+// Helper function: compare masked channelizer against full channelizer
+// at active channels
+void firpfbch2_crcf_mask_runtest(int          _type,
+                                 unsigned int _M,
+                                 unsigned int _num_active)
+{
+    float tol = 1e-4f;
+    unsigned int i, j;
+    unsigned int m = 3;
+    unsigned int num_runs = 40;
+
+    // enable channels spread across band
+    unsigned char mask[_M];
+    unsigned int active[_M];
+    for (i=0; i<_M; i++) mask[i] = 0;
+    for (j=0; j<_num_active; j++) {
+        active[j] = 1 + j*(_M-1)/_num_active;
+        mask[active[j]] = 1;
+    }
+
+    firpfbch2_crcf q0 = firpfbch2_crcf_create_kaiser(_type, _M, m, 60.0f);
+    firpfbch2_crcf q1 = firpfbch2_crcf_create_kaiser(_type, _M, m, 60.0f);
+    firpfbch2_crcf_set_channel_mask(q1, mask);
+    CONTEND_EQUALITY( firpfbch2_crcf_get_num_active(q1), _num_active );
+
+    float complex x [_M];               // full input
+    float complex xa[_M];               // active-channel input
+    float complex y0[_M];               // full output
+    float complex y1[_M];               // masked output
+    for (i=0; i<num_runs; i++) {
+        if (_type == LIQUID_ANALYZER) {
+            for (j=0; j<_M/2; j++)
+                x[j] = randnf() + _Complex_I*randnf();
+            firpfbch2_crcf_execute(q0, x, y0);
+            firpfbch2_crcf_execute(q1, x, y1);
+            for (j=0; j<_num_active; j++) {
+                CONTEND_DELTA( crealf(y1[j]), crealf(y0[active[j]]), tol );
+                CONTEND_DELTA( cimagf(y1[j]), cimagf(y0[active[j]]), tol );
+            }
+        } else {
+            for (j=0; j<_M; j++)
+                x[j] = 0.0f;
+            for (j=0; j<_num_active; j++) {
+                xa[j] = randnf() + _Complex_I*randnf();
+                x[active[j]] = xa[j];
+            }
+            firpfbch2_crcf_execute(q0, x,  y0);
+            firpfbch2_crcf_execute(q1, xa, y1);
+            for (j=0; j<_M/2; j++) {
+                CONTEND_DELTA( crealf(y1[j]), crealf(y0[j]), tol );
+                CONTEND_DELTA( cimagf(y1[j]), cimagf(y0[j]), tol );
+            }
+        }
+    }
+
+    firpfbch2_crcf_destroy(q0);
+    firpfbch2_crcf_destroy(q1);
+}
+
+// channel masks: few active channels (direct DFT) and many (full transform)
+void autotest_firpfbch2_crcf_mask_analyzer_few()    { firpfbch2_crcf_mask_runtest(LIQUID_ANALYZER,    64,  3); }
+void autotest_firpfbch2_crcf_mask_analyzer_many()   { firpfbch2_crcf_mask_runtest(LIQUID_ANALYZER,    64, 40); }
+void autotest_firpfbch2_crcf_mask_synthesizer_few() { firpfbch2_crcf_mask_runtest(LIQUID_SYNTHESIZER, 64,  3); }
+void autotest_firpfbch2_crcf_mask_synthesizer_many(){ firpfbch2_crcf_mask_runtest(LIQUID_SYNTHESIZER, 64, 40); }
+
+
+// Helper function: compare masked channelizer against full channelizer
+// at active channels, executing irregular blocks (single and batched
+// transforms)
+void firpfbch2_crcf_mask_block_runtest(int          _type,
+                                       unsigned int _M,
+                                       unsigned int _num_active)
+{
+    float tol = 1e-4f;
+    unsigned int i, j, k;
+    unsigned int m = 3;
+    unsigned int block_len[5] = {1, 16, 3, 33, 17};
+    unsigned int num_runs = 70;     // sum of block lengths
+
+    // enable channels spread across band
+    unsigned char mask[_M];
+    unsigned int active[_M];
+    for (i=0; i<_M; i++) mask[i] = 0;
+    for (j=0; j<_num_active; j++) {
+        active[j] = 1 + j*(_M-1)/_num_active;
+        mask[active[j]] = 1;
+    }
+
+    firpfbch2_crcf q0 = firpfbch2_crcf_create_kaiser(_type, _M, m, 60.0f);
+    firpfbch2_crcf q1 = firpfbch2_crcf_create_kaiser(_type, _M, m, 60.0f);
+    firpfbch2_crcf_set_channel_mask(q1, mask);
+
+    float complex * x  = (float complex*) malloc(num_runs*_M*sizeof(float complex));
+    float complex * xa = (float complex*) malloc(num_runs*_M*sizeof(float complex));
+    float complex * y0 = (float complex*) malloc(num_runs*_M*sizeof(float complex));
+    float complex * y1 = (float complex*) malloc(num_runs*_M*sizeof(float complex));
+    if (_type == LIQUID_ANALYZER) {
+        for (i=0; i<num_runs*_M/2; i++)
+            x[i] = randnf() + _Complex_I*randnf();
+    } else {
+        for (i=0; i<num_runs*_M; i++)
+            x[i] = 0.0f;
+        for (i=0; i<num_runs; i++) {
+            for (j=0; j<_num_active; j++) {
+                xa[i*_num_active + j] = randnf() + _Complex_I*randnf();
+                x[i*_M + active[j]]   = xa[i*_num_active + j];
+            }
+        }
+    }
+
+    // run unmasked object one execution at a time, masked in blocks
+    unsigned int t = 0;
+    for (k=0; k<5; k++) {
+        unsigned int n = block_len[k];
+        if (_type == LIQUID_ANALYZER) {
+            for (i=t; i<t+n; i++)
+                firpfbch2_crcf_execute(q0, x + i*_M/2, y0 + i*_M);
+            firpfbch2_crcf_execute_block(q1, x + t*_M/2, n, y1 + t*_num_active);
+        } else {
+            for (i=t; i<t+n; i++)
+                firpfbch2_crcf_execute(q0, x + i*_M, y0 + i*_M/2);
+            firpfbch2_crcf_execute_block(q1, xa + t*_num_active, n, y1 + t*_M/2);
+        }
+        t += n;
+    }
+
+    for (i=0; i<num_runs; i++) {
+        if (_type == LIQUID_ANALYZER) {
+            for (j=0; j<_num_active; j++) {
+                CONTEND_DELTA( crealf(y1[i*_num_active + j]), crealf(y0[i*_M + active[j]]), tol );
+                CONTEND_DELTA( cimagf(y1[i*_num_active + j]), cimagf(y0[i*_M + active[j]]), tol );
+            }
+        } else {
+            for (j=0; j<_M/2; j++) {
+                CONTEND_DELTA( crealf(y1[i*_M/2 + j]), crealf(y0[i*_M/2 + j]), tol );
+                CONTEND_DELTA( cimagf(y1[i*_M/2 + j]), cimagf(y0[i*_M/2 + j]), tol );
+            }
+        }
+    }
+
+    firpfbch2_crcf_destroy(q0);
+    firpfbch2_crcf_destroy(q1);
+    free(x);
+    free(xa);
+    free(y0);
+    free(y1);
+}
+
+// channel masks with block execution
+void autotest_firpfbch2_crcf_mask_block_analyzer_few()    { firpfbch2_crcf_mask_block_runtest(LIQUID_ANALYZER,    64,  3); }
+void autotest_firpfbch2_crcf_mask_block_analyzer_many()   { firpfbch2_crcf_mask_block_runtest(LIQUID_ANALYZER,    64, 40); }
+void autotest_firpfbch2_crcf_mask_block_synthesizer_few() { firpfbch2_crcf_mask_block_runtest(LIQUID_SYNTHESIZER, 64,  3); }
+void autotest_firpfbch2_crcf_mask_block_synthesizer_many(){ firpfbch2_crcf_mask_block_runtest(LIQUID_SYNTHESIZER, 64, 40); }
+
+// Helper function: clearing the channel mask (NULL) restores all
+// channels, with output identical to that of an unmasked object; the
+// analyzer state is its input stream, so the mask may be cleared
+// after running
+void firpfbch2_crcf_mask_clear_runtest(int _type)
+{
+    unsigned int M = 32;
+    unsigned int m = 3;
+    unsigned int num_runs = 40;
+    unsigned int i, j;
+
+    unsigned char mask[M];
+    for (i=0; i<M; i++)
+        mask[i] = (i % 7) == 2;
+
+    firpfbch2_crcf q0 = firpfbch2_crcf_create_kaiser(_type, M, m, 60.0f);
+    firpfbch2_crcf q1 = firpfbch2_crcf_create_kaiser(_type, M, m, 60.0f);
+    firpfbch2_crcf_set_channel_mask(q1, mask);
+
+    float complex x [M];
+    float complex y0[M];
+    float complex y1[M];
+    if (_type == LIQUID_ANALYZER) {
+        for (i=0; i<num_runs; i++) {
+            for (j=0; j<M/2; j++)
+                x[j] = randnf() + _Complex_I*randnf();
+            firpfbch2_crcf_execute(q0, x, y0);
+            firpfbch2_crcf_execute(q1, x, y1);
+        }
+    }
+
+    firpfbch2_crcf_set_channel_mask(q1, NULL);
+    CONTEND_EQUALITY( firpfbch2_crcf_get_num_active(q1), M );
+
+    unsigned int nx = _type == LIQUID_ANALYZER ? M/2 : M;
+    unsigned int ny = _type == LIQUID_ANALYZER ? M   : M/2;
+    for (i=0; i<num_runs; i++) {
+        for (j=0; j<nx; j++)
+            x[j] = randnf() + _Complex_I*randnf();
+        firpfbch2_crcf_execute(q0, x, y0);
+        firpfbch2_crcf_execute(q1, x, y1);
+        CONTEND_SAME_DATA(y0, y1, ny*sizeof(float complex));
+    }
+
+    firpfbch2_crcf_destroy(q0);
+    firpfbch2_crcf_destroy(q1);
+}
+
+void autotest_firpfbch2_crcf_mask_clear_analyzer()    { firpfbch2_crcf_mask_clear_runtest(LIQUID_ANALYZER);    }
+void autotest_firpfbch2_crcf_mask_clear_synthesizer() { firpfbch2_crcf_mask_clear_runtest(LIQUID_SYNTHESIZER); }
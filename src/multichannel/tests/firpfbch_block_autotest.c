@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// generate pseudo-random complex input
+static void firpfbch_block_autotest_input(float complex * _x,
+                                          unsigned int    _n)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        _x[i] = randnf() + _Complex_I*randnf();
+}
+
+// Helper function: run firpfbch_crcf on frames one at a time and in
+// blocks of varying size and compare outputs
+void firpfbch_crcf_block_runtest(int          _type,
+                                 unsigned int _M,
+                                 unsigned int _m)
+{
+    float tol = 1e-5f;
+    unsigned int i;
+
+    // call sizes: single frames, partial and full internal blocks
+    unsigned int block[6] = {1, 3, 16, 20, 1, 37};
+    unsigned int num_frames = 0;
+    for (i=0; i<6; i++) num_frames += block[i];
+    unsigned int num_samples = num_frames * _M;
+
+    float complex x [num_samples];
+    float complex y0[num_samples];
+    float complex y1[num_samples];
+    firpfbch_block_autotest_input(x, num_samples);
+
+    firpfbch_crcf q0 = firpfbch_crcf_create_kaiser(_type, _M, _m, 60.0f);
+    firpfbch_crcf q1 = firpfbch_crcf_create_kaiser(_type, _M, _m, 60.0f);
+
+    // run one frame at a time
+    for (i=0; i<num_frames; i++) {
+        if (_type == LIQUID_ANALYZER)
+            firpfbch_crcf_analyzer_execute(q0, &x[i*_M], &y0[i*_M]);
+        else
+            firpfbch_crcf_synthesizer_execute(q0, &x[i*_M], &y0[i*_M]);
+    }
+
+    // run in blocks
+    unsigned int n = 0;
+    for (i=0; i<6; i++) {
+        if (_type == LIQUID_ANALYZER)
+            firpfbch_crcf_analyzer_execute_block(q1, &x[n*_M], block[i], &y1[n*_M]);
+        else
+            firpfbch_crcf_synthesizer_execute_block(q1, &x[n*_M], block[i], &y1[n*_M]);
+        n += block[i];
+    }
+
+    for (i=0; i<num_samples; i++) {
+        CONTEND_DELTA( crealf(y1[i]), crealf(y0[i]), tol );
+        CONTEND_DELTA( cimagf(y1[i]), cimagf(y0[i]), tol );
+    }
+
+    firpfbch_crcf_destroy(q0);
+    firpfbch_crcf_destroy(q1);
+}
+
+// Helper function: run firpfbch2_crcf one execution at a time and in
+// blocks of varying size and compare outputs
+void firpfbch2_crcf_block_runtest(int          _type,
+                                  unsigned int _M,
+                                  unsigned int _m)
+{
+    float tol = 1e-5f;
+    unsigned int i;
+
+    unsigned int block[6] = {1, 3, 16, 20, 1, 37};
+    unsigned int num_runs = 0;
+    for (i=0; i<6; i++) num_runs += block[i];
+    unsigned int nx = (_type == LIQUID_ANALYZER) ? _M/2 : _M;
+    unsigned int ny = (_type == LIQUID_ANALYZER) ? _M   : _M/2;
+
+    float complex x [num_runs*nx];
+    float complex y0[num_runs*ny];
+    float complex y1[num_runs*ny];
+    firpfbch_block_autotest_input(x, num_runs*nx);
+
+    firpfbch2_crcf q0 = firpfbch2_crcf_create_kaiser(_type, _M, _m, 60.0f);
+    firpfbch2_crcf q1 = firpfbch2_crcf_create_kaiser(_type, _M, _m, 60.0f);
+
+    for (i=0; i<num_runs; i++)
+        firpfbch2_crcf_execute(q0, &x[i*nx], &y0[i*ny]);
+
+    unsigned int n = 0;
+    for (i=0; i<6; i++) {
+        firpfbch2_crcf_execute_block(q1, &x[n*nx], block[i], &y1[n*ny]);
+        n += block[i];
+    }
+
+    for (i=0; i<num_runs*ny; i++) {
+        CONTEND_DELTA( crealf(y1[i]), crealf(y0[i]), tol );
+        CONTEND_DELTA( cimagf(y1[i]), cimagf(y0[i]), tol );
+    }
+
+    firpfbch2_crcf_destroy(q0);
+    firpfbch2_crcf_destroy(q1);
+}
+
+void autotest_firpfbch_crcf_block_analyzer_n8()     { firpfbch_crcf_block_runtest (LIQUID_ANALYZER,     8, 3); }
+void autotest_firpfbch_crcf_block_analyzer_n10()    { firpfbch_crcf_block_runtest (LIQUID_ANALYZER,    10, 2); }
+void autotest_firpfbch_crcf_block_synthesizer_n8()  { firpfbch_crcf_block_runtest (LIQUID_SYNTHESIZER,  8, 3); }
+void autotest_firpfbch_crcf_block_synthesizer_n10() { firpfbch_crcf_block_runtest (LIQUID_SYNTHESIZER, 10, 2); }
+void autotest_firpfbch2_crcf_block_analyzer_n8()    { firpfbch2_crcf_block_runtest(LIQUID_ANALYZER,     8, 3); }
+void autotest_firpfbch2_crcf_block_analyzer_n10()   { firpfbch2_crcf_block_runtest(LIQUID_ANALYZER,    10, 2); }
+void autotest_firpfbch2_crcf_block_synthesizer_n8() { firpfbch2_crcf_block_runtest(LIQUID_SYNTHESIZER,  8, 3); }
+void autotest_firpfbch2_crcf_block_synthesizer_n10(){ firpfbch2_crcf_block_runtest(LIQUID_SYNTHESIZER, 10, 2); }
+
@@ -99,3 +99,28 @@ void benchmark_nco_mix_block_up(struct rusage *_start,
     nco_crcf_destroy(p);
 }
 
+
+void benchmark_nco_mix_block_up_interp(struct rusage *_start,
+                                       struct rusage *_finish,
+                                       unsigned long int *_num_iterations)
+{
+    float complex x[16], y[16];
+    memset(x, 0, 16*sizeof(float complex));
+
+    nco_crcf p = nco_crcf_create(LIQUID_NCO);
+    nco_crcf_set_table(p, 12, 1);
+    nco_crcf_set_phase(p, 0.0f);
+    nco_crcf_set_frequency(p, 0.1f);
+
+    unsigned int i;
+
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        nco_crcf_mix_block_up(p, x, y, 16);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+
+    *_num_iterations *= 16;
+    nco_crcf_destroy(p);
+}
+
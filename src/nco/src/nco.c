@@ -28,42 +28,114 @@
 #include <math.h>
 #include <stdlib.h>
 #include <stdio.h>
-#include <assert.h>
+#include <string.h>
+
+#if LIQUID_SIMD_DISPATCH
+#include <immintrin.h>  // AVX2 (selected at run time)
+#endif
 
 #define NCO_PLL_BANDWIDTH_DEFAULT   (0.1)
 #define NCO_PLL_GAIN_DEFAULT        (1000)
 
+// default sine table length (log2)
+#define NCO_TABLE_BITS_DEFAULT      (10)
+
+// fixed-point phase to radians, 2 pi / 2^32
+#define NCO_PHASE_SCALE             (6.283185307179586 / 4294967296.0)
+
 #define LIQUID_DEBUG_NCO            (0)
 
+// forward declaration of internal methods
+void NCO(_mix_block)(NCO()        _q,
+                     TC *         _x,
+                     TC *         _y,
+                     unsigned int _n,
+                     int          _down);
+#if LIQUID_SIMD_DISPATCH
+unsigned int NCO(_mix_block_avx2)(NCO()        _q,
+                                  TC *         _x,
+                                  TC *         _y,
+                                  unsigned int _n,
+                                  int          _down);
+#endif
+
 struct NCO(_s) {
     liquid_ncotype type;
-    T theta;            // NCO phase
-    T d_theta;          // NCO frequency
-    T sintab[256];      // sine table
-    unsigned int index; // table index
+    uint32_t theta;         // NCO phase, fixed point (2^32 : 2 pi)
+    uint32_t d_theta;       // NCO frequency, fixed point
+    T * sintab;             // sine table [size: 2^tab_bits x 1]
+    T * sindiff;            // sine table first difference [size: 2^tab_bits x 1]
+    unsigned int tab_bits;  // sine table length (log2)
+    int tab_interp;         // interpolate between table entries?
+    T tab_frac;             // fractional table index scaling, 2^-(32-tab_bits)
     T sine;
     T cosine;
     void (*compute_sincos)(NCO() _q);
 
+    // SIMD extension level for block mixing, selected at run time
+    liquid_simd_level level;
+
     // phase-locked loop
     T alpha;
     T beta;
 };
 
+// compute sine and cosine of fixed-point phase; these are shared by
+// the single-sample and block methods so that the results are always
+// identical (the vector kernels evaluate the same operations in order)
+
+// table lookup, rounding to nearest entry
+static inline void NCO(_sincos_table)(NCO()    _q,
+                                      uint32_t _theta,
+                                      T *      _s,
+                                      T *      _c)
+{
+    unsigned int shift = 32 - _q->tab_bits;
+    uint32_t     mask  = (1u << _q->tab_bits) - 1;
+    uint32_t     i     = ((_theta + (1u << (shift-1))) >> shift) & mask;
+    *_s = _q->sintab[i];
+    *_c = _q->sintab[(i + (1u << (_q->tab_bits-2))) & mask];
+}
+
+// table lookup with linear interpolation between entries
+static inline void NCO(_sincos_interp)(NCO()    _q,
+                                       uint32_t _theta,
+                                       T *      _s,
+                                       T *      _c)
+{
+    unsigned int shift = 32 - _q->tab_bits;
+    uint32_t     mask  = (1u << _q->tab_bits) - 1;
+    uint32_t     i     = _theta >> shift;
+    uint32_t     j     = (i + (1u << (_q->tab_bits-2))) & mask;
+    T            f     = (T)(int32_t)(_theta & ((1u << shift)-1)) * _q->tab_frac;
+    *_s = _q->sintab[i] + f*_q->sindiff[i];
+    *_c = _q->sintab[j] + f*_q->sindiff[j];
+}
+
+// nearest table entry, corrected by the residual phase r using
+// sin(r) ~ r - r^3/6 and cos(r) ~ 1 - r^2/2 (|r| <= pi/1024)
+static inline void NCO(_sincos_vco)(NCO()    _q,
+                                    uint32_t _theta,
+                                    T *      _s,
+                                    T *      _c)
+{
+    uint32_t i  = ((_theta + (1u << 21)) >> 22) & 0x3ff;
+    T r  = (T)(int32_t)(_theta - (i << 22)) * (T)NCO_PHASE_SCALE;
+    T r2 = r*r;
+    T sr = r + (r*r2)*(T)(-1.0/6.0);
+    T cr = 1 + r2*(T)(-0.5);
+    T sh = _q->sintab[i];
+    T ch = _q->sintab[(i + 256) & 0x3ff];
+    *_s = sh*cr + ch*sr;
+    *_c = ch*cr - sh*sr;
+}
+
 // create nco/vco object
 NCO() NCO(_create)(liquid_ncotype _type)
 {
     NCO() q = (NCO()) malloc(sizeof(struct NCO(_s)));
     q->type = _type;
 
-    // initialize sine table
-    unsigned int i;
-    for (i=0; i<256; i++)
-        q->sintab[i] = SIN(2.0f*M_PI*(float)(i)/256.0f);
-
-    // set default pll bandwidth
-    NCO(_pll_set_bandwidth)(q, NCO_PLL_BANDWIDTH_DEFAULT);
-
     // set internal method
     if (q->type == LIQUID_NCO) {
         q->compute_sincos = &NCO(_compute_sincos_nco);
@@ -74,6 +146,22 @@ NCO() NCO(_create)(liquid_ncotype _type)
         exit(1);
     }
 
+    // initialize sine table (fixed size for VCO type)
+    q->sintab  = NULL;
+    q->sindiff = NULL;
+    q->tab_bits   = 0;
+    q->tab_interp = 0;
+    NCO(_set_table)(q, NCO_TABLE_BITS_DEFAULT, 0);
+
+    // select block mixing kernel
+    q->level = LIQUID_SIMD_BASELINE;
+#if LIQUID_SIMD_DISPATCH
+    q->level = liquid_simd_get_level();
+#endif
+
+    // set default pll bandwidth
+    NCO(_pll_set_bandwidth)(q, NCO_PLL_BANDWIDTH_DEFAULT);
+
     // reset object and return
     NCO(_reset)(q);
     return q;
@@ -82,18 +170,63 @@ NCO() NCO(_create)(liquid_ncotype _type)
 // destroy nco object
 void NCO(_destroy)(NCO() _q)
 {
+    free(_q->sintab);
+    free(_q->sindiff);
     free(_q);
 }
 
+// print nco object
+void NCO(_print)(NCO() _q)
+{
+    printf("nco [%s, phase=%12.8f, freq=%12.8f, table: %u entries%s]\n",
+            _q->type == LIQUID_NCO ? "nco" : "vco",
+            NCO(_get_phase)(_q),
+            NCO(_get_frequency)(_q),
+            1u << _q->tab_bits,
+            _q->tab_interp ? ", interpolated" : "");
+}
+
+// set sine table size and interpolation (LIQUID_NCO type only)
+//  _q      :   nco object
+//  _nbits  :   table length is 2^_nbits, 4 <= _nbits <= 16
+//  _interp :   linearly interpolate between entries?
+void NCO(_set_table)(NCO()        _q,
+                     unsigned int _nbits,
+                     int          _interp)
+{
+    // validate input
+    if (_nbits < 4 || _nbits > 16) {
+        fprintf(stderr,"error: nco_set_table(), table size (2^%u) out of range\n", _nbits);
+        exit(1);
+    } else if (_q->type == LIQUID_VCO && _q->sintab != NULL) {
+        fprintf(stderr,"warning: nco_set_table(), table cannot be set for VCO type; ignoring\n");
+        return;
+    }
+
+    // re-allocate tables
+    unsigned int n = 1u << _nbits;
+    if (_nbits != _q->tab_bits) {
+        _q->sintab  = (T*) realloc(_q->sintab,  n*sizeof(T));
+        _q->sindiff = (T*) realloc(_q->sindiff, n*sizeof(T));
+
+        unsigned int i;
+        for (i=0; i<n; i++)
+            _q->sintab[i] = (T) sin(2.0*M_PI*(double)i/(double)n);
+        for (i=0; i<n; i++)
+            _q->sindiff[i] = _q->sintab[(i+1)&(n-1)] - _q->sintab[i];
+    }
+
+    _q->tab_bits   = _nbits;
+    _q->tab_interp = _interp ? 1 : 0;
+    _q->tab_frac   = (T) ldexp(1.0, -(int)(32 - _nbits));
+}
+
 // reset internal state of nco object
 void NCO(_reset)(NCO() _q)
 {
     _q->theta = 0;
     _q->d_theta = 0;
 
-    // reset sine table index
-    _q->index = 0;
-
     // set internal sine, cosine values
     _q->sine = 0;
     _q->cosine = 1;
@@ -106,47 +239,45 @@ void NCO(_reset)(NCO() _q)
 void NCO(_set_frequency)(NCO() _q,
                          T _f)
 {
-    _q->d_theta = _f;
+    _q->d_theta = NCO(_constrain)(_f);
 }
 
 // adjust frequency of nco object
 void NCO(_adjust_frequency)(NCO() _q,
                             T _df)
 {
-    _q->d_theta += _df;
+    _q->d_theta += NCO(_constrain)(_df);
 }
 
 // set phase of nco object, constraining phase
 void NCO(_set_phase)(NCO() _q, T _phi)
 {
-    _q->theta = _phi;
-    NCO(_constrain_phase)(_q);
+    _q->theta = NCO(_constrain)(_phi);
 }
 
 // adjust phase of nco object, constraining phase
 void NCO(_adjust_phase)(NCO() _q, T _dphi)
 {
-    _q->theta += _dphi;
-    NCO(_constrain_phase)(_q);
+    _q->theta += NCO(_constrain)(_dphi);
 }
 
 // increment internal phase of nco object
 void NCO(_step)(NCO() _q)
 {
+    // phase wraps naturally with integer overflow
     _q->theta += _q->d_theta;
-    NCO(_constrain_phase)(_q);
 }
 
-// get phase
+// get phase [radians], in [-pi,pi)
 T NCO(_get_phase)(NCO() _q)
 {
-    return _q->theta;
+    return (T) ((int32_t)_q->theta * NCO_PHASE_SCALE);
 }
 
-// ge frequency
+// get frequency [radians/sample], in [-pi,pi)
 T NCO(_get_frequency)(NCO() _q)
 {
-    return _q->d_theta;
+    return (T) ((int32_t)_q->d_theta * NCO_PHASE_SCALE);
 }
 
 
@@ -225,9 +356,6 @@ void NCO(_pll_step)(NCO() _q,
 
     // increase phase proportional to error
     NCO(_adjust_phase)(_q, _dphi*_q->beta);
-
-    // constrain frequency
-    //NCO(_constrain_frequency)(_q);
 }
 
 // mixing functions
@@ -245,7 +373,11 @@ void NCO(_mix_up)(NCO() _q,
     _q->compute_sincos(_q);
 
     // multiply _x by [cos(theta) + _Complex_I*sin(theta)]
-    *_y = _x * (_q->cosine + _Complex_I*(_q->sine));
+    T xr = crealf(_x);
+    T xi = cimagf(_x);
+    T * y = (T*) _y;
+    y[0] = xr*_q->cosine - xi*_q->sine;
+    y[1] = xr*_q->sine   + xi*_q->cosine;
 }
 
 // Rotate input vector down by NCO angle, y = x exp{-j theta}
@@ -260,13 +392,16 @@ void NCO(_mix_down)(NCO() _q,
     _q->compute_sincos(_q);
 
     // multiply _x by [cos(-theta) + _Complex_I*sin(-theta)]
-    *_y = _x * (_q->cosine - _Complex_I*(_q->sine));
+    T xr = crealf(_x);
+    T xi = cimagf(_x);
+    T * y = (T*) _y;
+    y[0] = xr*_q->cosine + xi*_q->sine;
+    y[1] = xi*_q->cosine - xr*_q->sine;
 }
 
 
 // Rotate input vector array up by NCO angle:
 //      y(t) = x(t) exp{+j (f*t + theta)}
-// TODO : implement NCO/VCO-specific versions
 //  _q      :   nco object
 //  _x      :   input array [size: _n x 1]
 //  _y      :   output sample [size: _n x 1]
@@ -276,34 +411,11 @@ void NCO(_mix_block_up)(NCO() _q,
                         TC *_y,
                         unsigned int _n)
 {
-    unsigned int i;
-    // FIXME: this method should be more efficient but is causing occasional
-    //        errors so instead favor slower but more reliable algorithm
-#if 0
-    T theta =   _q->theta;
-    T d_theta = _q->d_theta;
-    for (i=0; i<_n; i++) {
-        // multiply _x[i] by [cos(theta) + _Complex_I*sin(theta)]
-        _y[i] = _x[i] * liquid_cexpjf(theta);
-        
-        theta += d_theta;
-    }
-
-    NCO(_set_phase)(_q, theta);
-#else
-    for (i=0; i<_n; i++) {
-        // mix single sample up
-        NCO(_mix_up)(_q, _x[i], &_y[i]);
-
-        // step NCO phase
-        NCO(_step)(_q);
-    }
-#endif
+    NCO(_mix_block)(_q, _x, _y, _n, 0);
 }
 
 // Rotate input vector array down by NCO angle:
 //      y(t) = x(t) exp{-j (f*t + theta)}
-// TODO : implement NCO/VCO-specific versions
 //  _q      :   nco object
 //  _x      :   input array [size: _n x 1]
 //  _y      :   output sample [size: _n x 1]
@@ -313,73 +425,186 @@ void NCO(_mix_block_down)(NCO() _q,
                           TC *_y,
                           unsigned int _n)
 {
-    unsigned int i;
-    // FIXME: this method should be more efficient but is causing occasional
-    //        errors so instead favor slower but more reliable algorithm
-#if 0
-    T theta =   _q->theta;
-    T d_theta = _q->d_theta;
-    for (i=0; i<_n; i++) {
-        // multiply _x[i] by [cos(-theta) + _Complex_I*sin(-theta)]
-        _y[i] = _x[i] * liquid_cexpjf(-theta);
-        
-        theta += d_theta;
-    }
-
-    NCO(_set_phase)(_q, theta);
-#else
-    for (i=0; i<_n; i++) {
-        // mix single sample down
-        NCO(_mix_down)(_q, _x[i], &_y[i]);
-
-        // step NCO phase
-        NCO(_step)(_q);
-    }
-#endif
+    NCO(_mix_block)(_q, _x, _y, _n, 1);
 }
 
 //
 // internal methods
 //
 
-// constrain frequency of NCO object to be in (-pi,pi)
-void NCO(_constrain_frequency)(NCO() _q)
+// convert phase [radians] to fixed-point value, wrapping to [0,2 pi)
+uint32_t NCO(_constrain)(T _theta)
 {
-    if (_q->d_theta > M_PI)
-        _q->d_theta -= 2*M_PI;
-    else if (_q->d_theta < -M_PI)
-        _q->d_theta += 2*M_PI;
-}
+    // divide by 2 pi and retain fractional part in (-1,1)
+    double p = fmod((double)_theta / (2.0*M_PI), 1.0);
 
-// constrain phase of NCO object to be in (-pi,pi)
-void NCO(_constrain_phase)(NCO() _q)
-{
-    if (_q->theta > M_PI)
-        _q->theta -= 2*M_PI;
-    else if (_q->theta < -M_PI)
-        _q->theta += 2*M_PI;
+    // scale to 2^32 and round; negative values wrap as expected
+    int64_t v = (int64_t) floor(p*4294967296.0 + 0.5);
+    return (uint32_t) v;
 }
 
 // compute sin, cos of internal phase of nco
 void NCO(_compute_sincos_nco)(NCO() _q)
 {
-    // assume phase is constrained to be in (-pi,pi)
-
-    // compute index
-    // NOTE : 40.743665 ~ 256 / (2*pi)
-    // NOTE : add 512 to ensure positive value, add 0.5 for rounding precision
-    // TODO : move away from floating-point specific code
-    _q->index = ((unsigned int)((_q->theta)*40.743665f + 512.0f + 0.5f))&0xff;
-    assert(_q->index < 256);
-    
-    _q->sine = _q->sintab[_q->index];
-    _q->cosine = _q->sintab[(_q->index+64)&0xff];
+    if (_q->tab_interp)
+        NCO(_sincos_interp)(_q, _q->theta, &_q->sine, &_q->cosine);
+    else
+        NCO(_sincos_table)(_q, _q->theta, &_q->sine, &_q->cosine);
 }
 
 // compute sin, cos of internal phase of vco
 void NCO(_compute_sincos_vco)(NCO() _q)
 {
-    _q->sine   = SIN(_q->theta);
-    _q->cosine = COS(_q->theta);
+    NCO(_sincos_vco)(_q, _q->theta, &_q->sine, &_q->cosine);
+}
+
+// rotate input array by NCO angle, stepping phase after each sample
+//  _q      :   nco object
+//  _x      :   input array [size: _n x 1]
+//  _y      :   output sample [size: _n x 1]
+//  _n      :   number of input, output samples
+//  _down   :   rotate down (conjugate) rather than up?
+void NCO(_mix_block)(NCO()        _q,
+                     TC *         _x,
+                     TC *         _y,
+                     unsigned int _n,
+                     int          _down)
+{
+    unsigned int i = 0;
+#if LIQUID_SIMD_DISPATCH
+    // run vector kernel on groups of 8 samples; remainder falls
+    // through to the portable loop below
+    if (_q->level >= LIQUID_SIMD_AVX2)
+        i = NCO(_mix_block_avx2)(_q, _x, _y, _n, _down);
+#endif
+
+    uint32_t theta = _q->theta;
+    T s, c;
+    for ( ; i<_n; i++) {
+        // compute sine, cosine of current phase
+        if (_q->type == LIQUID_VCO)
+            NCO(_sincos_vco)(_q, theta, &s, &c);
+        else if (_q->tab_interp)
+            NCO(_sincos_interp)(_q, theta, &s, &c);
+        else
+            NCO(_sincos_table)(_q, theta, &s, &c);
+
+        // rotate sample
+        T xr = crealf(_x[i]);
+        T xi = cimagf(_x[i]);
+        T * y = (T*) &_y[i];
+        if (_down) {
+            y[0] = xr*c + xi*s;
+            y[1] = xi*c - xr*s;
+        } else {
+            y[0] = xr*c - xi*s;
+            y[1] = xr*s + xi*c;
+        }
+
+        // step phase
+        theta += _q->d_theta;
+    }
+    _q->theta = theta;
+}
+
+#if LIQUID_SIMD_DISPATCH
+// compute sine and cosine of eight fixed-point phases, matching the
+// single-sample methods exactly (no fused multiply-add)
+__attribute__((target("avx2"), always_inline))
+static inline void NCO(_sincos8_avx2)(NCO()   _q,
+                                      __m256i _theta,
+                                      __m256 * _s,
+                                      __m256 * _c)
+{
+    if (_q->type == LIQUID_VCO) {
+        __m256i mask = _mm256_set1_epi32(0x3ff);
+        __m256i i    = _mm256_and_si256(_mm256_srli_epi32(
+                            _mm256_add_epi32(_theta, _mm256_set1_epi32(1 << 21)), 22), mask);
+        __m256i j    = _mm256_and_si256(_mm256_add_epi32(i, _mm256_set1_epi32(256)), mask);
+        __m256  r    = _mm256_mul_ps(_mm256_cvtepi32_ps(
+                            _mm256_sub_epi32(_theta, _mm256_slli_epi32(i, 22))),
+                            _mm256_set1_ps((T)NCO_PHASE_SCALE));
+        __m256  r2   = _mm256_mul_ps(r, r);
+        __m256  sr   = _mm256_add_ps(r, _mm256_mul_ps(_mm256_mul_ps(r, r2),
+                                                      _mm256_set1_ps((T)(-1.0/6.0))));
+        __m256  cr   = _mm256_add_ps(_mm256_set1_ps(1.0f),
+                                     _mm256_mul_ps(r2, _mm256_set1_ps((T)(-0.5))));
+        __m256  sh   = _mm256_i32gather_ps(_q->sintab, i, 4);
+        __m256  ch   = _mm256_i32gather_ps(_q->sintab, j, 4);
+        *_s = _mm256_add_ps(_mm256_mul_ps(sh, cr), _mm256_mul_ps(ch, sr));
+        *_c = _mm256_sub_ps(_mm256_mul_ps(ch, cr), _mm256_mul_ps(sh, sr));
+    } else {
+        unsigned int shift = 32 - _q->tab_bits;
+        __m128i count = _mm_cvtsi32_si128(shift);
+        __m256i mask  = _mm256_set1_epi32((1u << _q->tab_bits) - 1);
+        __m256i qtr   = _mm256_set1_epi32(1u << (_q->tab_bits-2));
+        if (_q->tab_interp) {
+            __m256i i = _mm256_srl_epi32(_theta, count);
+            __m256i j = _mm256_and_si256(_mm256_add_epi32(i, qtr), mask);
+            __m256  f = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_theta,
+                            _mm256_set1_epi32((1u << shift)-1))), _mm256_set1_ps(_q->tab_frac));
+            *_s = _mm256_add_ps(_mm256_i32gather_ps(_q->sintab, i, 4),
+                                _mm256_mul_ps(f, _mm256_i32gather_ps(_q->sindiff, i, 4)));
+            *_c = _mm256_add_ps(_mm256_i32gather_ps(_q->sintab, j, 4),
+                                _mm256_mul_ps(f, _mm256_i32gather_ps(_q->sindiff, j, 4)));
+        } else {
+            __m256i i = _mm256_and_si256(_mm256_srl_epi32(_mm256_add_epi32(_theta,
+                            _mm256_set1_epi32(1u << (shift-1))), count), mask);
+            __m256i j = _mm256_and_si256(_mm256_add_epi32(i, qtr), mask);
+            *_s = _mm256_i32gather_ps(_q->sintab, i, 4);
+            *_c = _mm256_i32gather_ps(_q->sintab, j, 4);
+        }
+    }
+}
+
+// rotate groups of eight samples, returning number of samples processed
+__attribute__((target("avx2")))
+unsigned int NCO(_mix_block_avx2)(NCO()        _q,
+                                  TC *         _x,
+                                  TC *         _y,
+                                  unsigned int _n,
+                                  int          _down)
+{
+    // de-interleaving two registers of input samples leaves the real
+    // and imaginary components in the order {0,1,4,5,2,3,6,7}, so
+    // phases are computed in the same order
+    uint32_t d = _q->d_theta;
+    __m256i theta = _mm256_add_epi32(_mm256_set1_epi32(_q->theta),
+                        _mm256_setr_epi32(0, d, 4*d, 5*d, 2*d, 3*d, 6*d, 7*d));
+    __m256i step  = _mm256_set1_epi32(8*d);
+
+    unsigned int i;
+    for (i=0; i+8<=_n; i+=8) {
+        __m256 s, c;
+        NCO(_sincos8_avx2)(_q, theta, &s, &c);
+
+        // load and de-interleave inputs
+        __m256 x0 = _mm256_loadu_ps((float*)&_x[i  ]);
+        __m256 x1 = _mm256_loadu_ps((float*)&_x[i+4]);
+        __m256 xr = _mm256_shuffle_ps(x0, x1, _MM_SHUFFLE(2,0,2,0));
+        __m256 xi = _mm256_shuffle_ps(x0, x1, _MM_SHUFFLE(3,1,3,1));
+
+        // rotate
+        __m256 yr, yi;
+        if (_down) {
+            yr = _mm256_add_ps(_mm256_mul_ps(xr, c), _mm256_mul_ps(xi, s));
+            yi = _mm256_sub_ps(_mm256_mul_ps(xi, c), _mm256_mul_ps(xr, s));
+        } else {
+            yr = _mm256_sub_ps(_mm256_mul_ps(xr, c), _mm256_mul_ps(xi, s));
+            yi = _mm256_add_ps(_mm256_mul_ps(xr, s), _mm256_mul_ps(xi, c));
+        }
+
+        // interleave and store outputs
+        _mm256_storeu_ps((float*)&_y[i  ], _mm256_unpacklo_ps(yr, yi));
+        _mm256_storeu_ps((float*)&_y[i+4], _mm256_unpackhi_ps(yr, yi));
+
+        // step phase
+        theta = _mm256_add_epi32(theta, step);
+    }
+
+    // update phase
+    _q->theta += i*d;
+    return i;
 }
+#endif
 
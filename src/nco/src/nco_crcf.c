@@ -30,7 +30,4 @@
 #define T           float
 #define TC          float complex
 
-#define SIN         sinf
-#define COS         cosf
-
 #include "nco.c"
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include <complex.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// autotest helper function: block mixing matches stepping one sample
+// at a time exactly
+//  _type       :   NCO type (e.g. LIQUID_NCO)
+//  _nbits      :   table size (log2), 0 for default
+//  _interp     :   interpolate between table entries?
+//  _down       :   mix down rather than up?
+void nco_crcf_mix_block_test(int          _type,
+                             unsigned int _nbits,
+                             int          _interp,
+                             int          _down)
+{
+    unsigned int n = 203;
+    float complex x[n], y0[n], y1[n];
+    unsigned int i;
+    for (i=0; i<n; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // create objects
+    nco_crcf q0 = nco_crcf_create(_type);
+    nco_crcf q1 = nco_crcf_create(_type);
+    if (_nbits > 0) {
+        nco_crcf_set_table(q0, _nbits, _interp);
+        nco_crcf_set_table(q1, _nbits, _interp);
+    }
+    nco_crcf_set_phase    (q0, 2.1f);
+    nco_crcf_set_phase    (q1, 2.1f);
+    nco_crcf_set_frequency(q0,-0.5123f);
+    nco_crcf_set_frequency(q1,-0.5123f);
+
+    // mix in blocks of irregular size
+    unsigned int k;
+    for (i=0; i<n; i+=k) {
+        k = 1 + (i % 37);
+        if (i + k > n) k = n - i;
+        if (_down) nco_crcf_mix_block_down(q0, &x[i], &y0[i], k);
+        else       nco_crcf_mix_block_up  (q0, &x[i], &y0[i], k);
+    }
+
+    // mix one sample at a time
+    for (i=0; i<n; i++) {
+        if (_down) nco_crcf_mix_down(q1, x[i], &y1[i]);
+        else       nco_crcf_mix_up  (q1, x[i], &y1[i]);
+        nco_crcf_step(q1);
+    }
+
+    CONTEND_SAME_DATA(y0, y1, n*sizeof(float complex));
+    CONTEND_EQUALITY(nco_crcf_get_phase(q0), nco_crcf_get_phase(q1));
+
+    // destroy objects
+    nco_crcf_destroy(q0);
+    nco_crcf_destroy(q1);
+}
+
+void autotest_nco_crcf_mix_block_nco()    { nco_crcf_mix_block_test(LIQUID_NCO,  0, 0, 0); }
+void autotest_nco_crcf_mix_block_interp() { nco_crcf_mix_block_test(LIQUID_NCO, 12, 1, 0); }
+void autotest_nco_crcf_mix_block_vco()    { nco_crcf_mix_block_test(LIQUID_VCO,  0, 0, 0); }
+void autotest_nco_crcf_mix_block_down()   { nco_crcf_mix_block_test(LIQUID_VCO,  0, 0, 1); }
+
+// autotest helper function: sine/cosine error over many phases
+//  _type       :   NCO type (e.g. LIQUID_NCO)
+//  _nbits      :   table size (log2), 0 for default
+//  _interp     :   interpolate between table entries?
+//  _tol        :   error tolerance
+void nco_crcf_accuracy_test(int          _type,
+                            unsigned int _nbits,
+                            int          _interp,
+                            float        _tol)
+{
+    nco_crcf q = nco_crcf_create(_type);
+    if (_nbits > 0)
+        nco_crcf_set_table(q, _nbits, _interp);
+
+    // phases scattered over [0,2 pi)
+    unsigned int i;
+    float emax = 0.0f;
+    for (i=0; i<4096; i++) {
+        float theta = 2*M_PI*(float)(i*1048573u % 4194304u) / 4194304.0f;
+        nco_crcf_set_phase(q, theta);
+        float s, c;
+        nco_crcf_sincos(q, &s, &c);
+        float e = fabs(s - sin(theta)) + fabs(c - cos(theta));
+        emax = e > emax ? e : emax;
+    }
+    CONTEND_LESS_THAN(emax, _tol);
+
+    nco_crcf_destroy(q);
+}
+
+void autotest_nco_crcf_accuracy_nco()    { nco_crcf_accuracy_test(LIQUID_NCO,  0, 0, 4e-3f); }
+void autotest_nco_crcf_accuracy_interp() { nco_crcf_accuracy_test(LIQUID_NCO, 16, 1, 1e-6f); }
+void autotest_nco_crcf_accuracy_vco()    { nco_crcf_accuracy_test(LIQUID_VCO,  0, 0, 5e-7f); }
+
+// phase and frequency wrap to [-pi,pi)
+void autotest_nco_crcf_constrain()
+{
+    float tol = 1e-5f;
+    nco_crcf q = nco_crcf_create(LIQUID_VCO);
+
+    nco_crcf_set_phase(q, 7.0f);
+    CONTEND_DELTA(nco_crcf_get_phase(q), 7.0f - 2*M_PI, tol);
+
+    nco_crcf_set_phase(q, -20.0f);
+    CONTEND_DELTA(nco_crcf_get_phase(q), -20.0f + 6*M_PI, tol);
+
+    nco_crcf_set_frequency(q, 3.0f);
+    nco_crcf_step(q);
+    nco_crcf_step(q);
+    CONTEND_DELTA(nco_crcf_get_phase(q), -20.0f + 6*M_PI + 6.0f - 2*M_PI, tol);
+
+    nco_crcf_adjust_frequency(q, 0.5f);
+    CONTEND_DELTA(nco_crcf_get_frequency(q), 3.5f - 2*M_PI, tol);
+
+    nco_crcf_destroy(q);
+}
+
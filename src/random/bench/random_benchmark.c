@@ -153,3 +153,51 @@ void benchmark_random_ricek(struct rusage *_start,
     *_num_iterations *= 4;
 }
 
+
+// 
+// BENCHMARK: reentrant generator, block of Gauss random numbers
+//
+void benchmark_randgen_gauss_block(struct rusage *_start,
+                                   struct rusage *_finish,
+                                   unsigned long int *_num_iterations)
+{
+    // normalize number of iterations
+    *_num_iterations /= 64;
+
+    float x[256];
+    randgen q = randgen_create(0);
+    unsigned long int i;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        randgen_gauss_block(q, x, 256);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 256;
+
+    randgen_destroy(q);
+}
+
+// 
+// BENCHMARK: reentrant generator, block of complex Gauss random numbers
+//
+void benchmark_randgen_cgauss_block(struct rusage *_start,
+                                    struct rusage *_finish,
+                                    unsigned long int *_num_iterations)
+{
+    // normalize number of iterations
+    *_num_iterations /= 128;
+
+    float complex x[256];
+    randgen q = randgen_create(0);
+    unsigned long int i;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++)
+        randgen_cgauss_block(q, x, 256);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 256;
+
+    randgen_destroy(q);
+}
@@ -0,0 +1,364 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Reentrant pseudo-random number generator object
+//
+// Each object holds its own xoshiro256** state (seeded through splitmix64)
+// so that independent simulations can run on separate threads without
+// sharing the global rand() state. Gaussian variates use the ziggurat
+// method with 128 layers; the layer tables are stored with the object.
+//
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "liquid.internal.h"
+
+// ziggurat: right-most layer boundary and layer area
+#define RANDGEN_ZIGGURAT_R  (3.442619855899)
+#define RANDGEN_ZIGGURAT_V  (9.91256303526217e-3)
+
+struct randgen_s {
+    uint64_t     s[4];          // xoshiro256** state
+    unsigned int seed;          // initial seed
+
+    // ziggurat tables
+    uint32_t     kn[128];       // acceptance thresholds
+    float        wn[128];       // layer widths (scaled)
+    float        fn[128];       // density at layer boundaries
+};
+
+// advance generator, returning 64 random bits (xoshiro256**)
+static inline uint64_t randgen_next(randgen _q)
+{
+    uint64_t * s = _q->s;
+    uint64_t t = s[1] * 5;
+    uint64_t r = ((t << 7) | (t >> 57)) * 9;
+    t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = (s[3] << 45) | (s[3] >> 19);
+    return r;
+}
+
+// convert upper 24 bits of 32-bit value to uniform float in (0,1]
+static inline float randgen_u32_to_float(uint32_t _x)
+{
+    return (float)((_x >> 8) + 1) * (1.0f / 16777216.0f);
+}
+
+// magnitude of signed 32-bit value
+static inline uint32_t randgen_abs32(int32_t _x)
+{
+    uint32_t v = (uint32_t)_x;
+    return _x < 0 ? 0u - v : v;
+}
+
+// ziggurat tail and wedge handling (rare)
+static float randgen_gauss_fix(randgen _q,
+                               int32_t _hz,
+                               unsigned int _iz)
+{
+    float x;
+    while (1) {
+        x = _hz * _q->wn[_iz];
+
+        // base strip: sample from tail beyond R
+        if (_iz == 0) {
+            float y;
+            do {
+                uint64_t v = randgen_next(_q);
+                x = -logf(randgen_u32_to_float((uint32_t)(v >> 32))) / RANDGEN_ZIGGURAT_R;
+                y = -logf(randgen_u32_to_float((uint32_t)(v      )));
+            } while (y+y < x*x);
+            return _hz > 0 ? RANDGEN_ZIGGURAT_R + x : -RANDGEN_ZIGGURAT_R - x;
+        }
+
+        // wedge: accept with probability of density under the curve
+        float u = randgen_u32_to_float((uint32_t)(randgen_next(_q) >> 32));
+        if (_q->fn[_iz] + u*(_q->fn[_iz-1] - _q->fn[_iz]) < expf(-0.5f*x*x))
+            return x;
+
+        // draw again
+        uint64_t v = randgen_next(_q);
+        _hz = (int32_t)(v >> 32);
+        _iz = v & 127;
+        if (randgen_abs32(_hz) < _q->kn[_iz])
+            return _hz * _q->wn[_iz];
+    }
+    return 0.0f;
+}
+
+// generate Gaussian variate N(0,1)
+static inline float randgen_gauss_inline(randgen _q)
+{
+    uint64_t v = randgen_next(_q);
+    int32_t hz = (int32_t)(v >> 32);    // signed magnitude
+    unsigned int iz = v & 127;          // layer index
+    if (randgen_abs32(hz) < _q->kn[iz])
+        return hz * _q->wn[iz];
+    return randgen_gauss_fix(_q, hz, iz);
+}
+
+// generate Gamma(alpha,1) variate, alpha >= 1 (Marsaglia-Tsang)
+static float randgen_gamma(randgen _q,
+                           float   _d,
+                           float   _c)
+{
+    while (1) {
+        float x = randgen_gauss_inline(_q);
+        float v = 1.0f + _c*x;
+        if (v <= 0.0f)
+            continue;
+        v = v*v*v;
+        float u = randgen_uniform(_q);
+        float x2 = x*x;
+        if (u < 1.0f - 0.0331f*x2*x2)
+            return _d*v;
+        if (logf(u) < 0.5f*x2 + _d*(1.0f - v + logf(v)))
+            return _d*v;
+    }
+    return 0.0f;
+}
+
+// create random number generator object
+//  _seed   :   initial seed
+randgen randgen_create(unsigned int _seed)
+{
+    randgen q = (randgen) malloc(sizeof(struct randgen_s));
+
+    // generate ziggurat tables (Marsaglia and Tsang, 2000)
+    double m1 = 2147483648.0;
+    double dn = RANDGEN_ZIGGURAT_R;
+    double tn = dn;
+    double vn = RANDGEN_ZIGGURAT_V;
+    double r  = vn / exp(-0.5*dn*dn);
+    q->kn[0]   = (uint32_t)((dn/r)*m1);
+    q->kn[1]   = 0;
+    q->wn[0]   = (float)(r/m1);
+    q->wn[127] = (float)(dn/m1);
+    q->fn[0]   = 1.0f;
+    q->fn[127] = (float)exp(-0.5*dn*dn);
+    int i;
+    for (i=126; i>=1; i--) {
+        dn = sqrt(-2.0*log(vn/dn + exp(-0.5*dn*dn)));
+        q->kn[i+1] = (uint32_t)((dn/tn)*m1);
+        tn = dn;
+        q->fn[i] = (float)exp(-0.5*dn*dn);
+        q->wn[i] = (float)(dn/m1);
+    }
+
+    randgen_set_seed(q, _seed);
+    return q;
+}
+
+// destroy random number generator object
+void randgen_destroy(randgen _q)
+{
+    free(_q);
+}
+
+// print random number generator object
+void randgen_print(randgen _q)
+{
+    printf("randgen [xoshiro256**, seed=%u]\n", _q->seed);
+}
+
+// reset generator to its initial seed
+void randgen_reset(randgen _q)
+{
+    randgen_set_seed(_q, _q->seed);
+}
+
+// set generator seed
+void randgen_set_seed(randgen      _q,
+                      unsigned int _seed)
+{
+    // expand seed with splitmix64
+    _q->seed = _seed;
+    uint64_t z = _seed;
+    unsigned int i;
+    for (i=0; i<4; i++) {
+        z += 0x9e3779b97f4a7c15ULL;
+        uint64_t t = z;
+        t = (t ^ (t >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        t = (t ^ (t >> 27)) * 0x94d049bb133111ebULL;
+        _q->s[i] = t ^ (t >> 31);
+    }
+}
+
+// advance generator by 2^128 steps; copies of one generator which are
+// jumped different numbers of times produce non-overlapping streams
+void randgen_jump(randgen _q)
+{
+    static const uint64_t jump[4] = {
+        0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+        0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+    uint64_t s[4] = {0, 0, 0, 0};
+    unsigned int i, b;
+    for (i=0; i<4; i++) {
+        for (b=0; b<64; b++) {
+            if (jump[i] & (1ULL << b)) {
+                s[0] ^= _q->s[0];
+                s[1] ^= _q->s[1];
+                s[2] ^= _q->s[2];
+                s[3] ^= _q->s[3];
+            }
+            randgen_next(_q);
+        }
+    }
+    for (i=0; i<4; i++)
+        _q->s[i] = s[i];
+}
+
+// generate random 32-bit value
+unsigned int randgen_uint(randgen _q)
+{
+    return (unsigned int)(randgen_next(_q) >> 32);
+}
+
+// generate uniform random number in (0,1]
+float randgen_uniform(randgen _q)
+{
+    return randgen_u32_to_float((uint32_t)(randgen_next(_q) >> 32));
+}
+
+// generate Gaussian random number, N(0,1)
+float randgen_gauss(randgen _q)
+{
+    return randgen_gauss_inline(_q);
+}
+
+// generate circular complex Gaussian random number, CN(0,1), i.e.
+// independent real and imaginary components each with variance 1/2
+float complex randgen_cgauss(randgen _q)
+{
+    float vr = randgen_gauss_inline(_q) * (float)M_SQRT1_2;
+    float vi = randgen_gauss_inline(_q) * (float)M_SQRT1_2;
+    return vr + _Complex_I*vi;
+}
+
+// generate block of uniform random numbers in (0,1]
+void randgen_uniform_block(randgen      _q,
+                           float *      _x,
+                           unsigned int _n)
+{
+    // two samples per generator output
+    unsigned int i;
+    for (i=0; i+2<=_n; i+=2) {
+        uint64_t v = randgen_next(_q);
+        _x[i  ] = randgen_u32_to_float((uint32_t)(v >> 32));
+        _x[i+1] = randgen_u32_to_float((uint32_t)(v      ));
+    }
+    if (i < _n)
+        _x[i] = randgen_uniform(_q);
+}
+
+// generate block of Gaussian random numbers, N(0,1)
+void randgen_gauss_block(randgen      _q,
+                         float *      _x,
+                         unsigned int _n)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        _x[i] = randgen_gauss_inline(_q);
+}
+
+// generate block of circular complex Gaussian random numbers, CN(0,1)
+void randgen_cgauss_block(randgen         _q,
+                          float complex * _x,
+                          unsigned int    _n)
+{
+    float * x = (float*) _x;
+    unsigned int i;
+    for (i=0; i<2*_n; i++)
+        x[i] = randgen_gauss_inline(_q) * (float)M_SQRT1_2;
+}
+
+// generate block of Rice-K random numbers
+//  _K      :   shape parameter, K >= 0
+//  _omega  :   spread parameter, omega > 0
+void randgen_ricek_block(randgen      _q,
+                         float        _K,
+                         float        _omega,
+                         float *      _x,
+                         unsigned int _n)
+{
+    // validate input
+    if (_K < 0.0f) {
+        fprintf(stderr,"error: randgen_ricek_block(), K must be greater than or equal to zero\n");
+        exit(1);
+    } else if (_omega <= 0.0f) {
+        fprintf(stderr,"error: randgen_ricek_block(), omega must be greater than zero\n");
+        exit(1);
+    }
+
+    // line-of-sight component and diffuse standard deviation
+    float s   = sqrtf((_omega*_K)/(_K+1));
+    float sig = sqrtf(0.5f*_omega/(_K+1));
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        float vr = randgen_gauss_inline(_q)*sig + s;
+        float vi = randgen_gauss_inline(_q)*sig;
+        _x[i] = sqrtf(vr*vr + vi*vi);
+    }
+}
+
+// generate block of Nakagami-m random numbers
+//  _m      :   shape parameter, m >= 0.5
+//  _omega  :   spread parameter, omega > 0
+void randgen_nakm_block(randgen      _q,
+                        float        _m,
+                        float        _omega,
+                        float *      _x,
+                        unsigned int _n)
+{
+    // validate input
+    if (_m < 0.5f) {
+        fprintf(stderr,"error: randgen_nakm_block(), m cannot be less than 0.5\n");
+        exit(1);
+    } else if (_omega <= 0.0f) {
+        fprintf(stderr,"error: randgen_nakm_block(), omega must be greater than zero\n");
+        exit(1);
+    }
+
+    // sqrt(x) ~ Nakagami(m,omega) for x ~ Gamma(m, omega/m); shape
+    // parameters below one are boosted: Gamma(m) = Gamma(m+1) u^(1/m)
+    int   boost = _m < 1.0f;
+    float alpha = boost ? _m + 1.0f : _m;
+    float d     = alpha - 1.0f/3.0f;
+    float c     = 1.0f / sqrtf(9.0f*d);
+    float scale = _omega / _m;
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        float g = randgen_gamma(_q, d, c);
+        if (boost)
+            g *= powf(randgen_uniform(_q), 1.0f/_m);
+        _x[i] = sqrtf(g*scale);
+    }
+}
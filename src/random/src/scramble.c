@@ -26,30 +26,55 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 #include "liquid.internal.h"
 
-void scramble_data(unsigned char * _x,
-                   unsigned int _n)
-{
-    // t = 4*(floor(_n/4))
-    unsigned int t = (_n>>2)<<2;
+// scrambling mask repeated over a 64-bit word
+static const unsigned char liquid_scramble_mask[8] = {
+    LIQUID_SCRAMBLE_MASK0, LIQUID_SCRAMBLE_MASK1,
+    LIQUID_SCRAMBLE_MASK2, LIQUID_SCRAMBLE_MASK3,
+    LIQUID_SCRAMBLE_MASK0, LIQUID_SCRAMBLE_MASK1,
+    LIQUID_SCRAMBLE_MASK2, LIQUID_SCRAMBLE_MASK3,
+};
+
+// scrambling mask expanded to soft bits: inverting a soft bit (255-x)
+// is the same as xor with 0xff, so each mask bit becomes a full byte
+#define LIQUID_SCRAMBLE_SOFT(M) \
+    (M)&0x80?0xff:0, (M)&0x40?0xff:0, (M)&0x20?0xff:0, (M)&0x10?0xff:0, \
+    (M)&0x08?0xff:0, (M)&0x04?0xff:0, (M)&0x02?0xff:0, (M)&0x01?0xff:0
+static const unsigned char liquid_scramble_mask_soft[32] = {
+    LIQUID_SCRAMBLE_SOFT(LIQUID_SCRAMBLE_MASK0),
+    LIQUID_SCRAMBLE_SOFT(LIQUID_SCRAMBLE_MASK1),
+    LIQUID_SCRAMBLE_SOFT(LIQUID_SCRAMBLE_MASK2),
+    LIQUID_SCRAMBLE_SOFT(LIQUID_SCRAMBLE_MASK3),
+};
 
-    // apply static masks
+// apply mask with period _p (multiple of 8) bytes, one word at a time
+static void liquid_scramble_xor(unsigned char *       _x,
+                                unsigned int          _n,
+                                const unsigned char * _mask,
+                                unsigned int          _p)
+{
     unsigned int i;
-    for (i=0; i<t; i+=4) {
-        _x[i  ] ^= LIQUID_SCRAMBLE_MASK0;
-        _x[i+1] ^= LIQUID_SCRAMBLE_MASK1;
-        _x[i+2] ^= LIQUID_SCRAMBLE_MASK2;
-        _x[i+3] ^= LIQUID_SCRAMBLE_MASK3;
+    for (i=0; i+8<=_n; i+=8) {
+        uint64_t x, m;
+        memcpy(&x, &_x[i], sizeof(uint64_t));
+        memcpy(&m, &_mask[i % _p], sizeof(uint64_t));
+        x ^= m;
+        memcpy(&_x[i], &x, sizeof(uint64_t));
     }
 
     // clean up remainder of elements
-    if ( (i+0) < _n ) _x[i+0] ^= LIQUID_SCRAMBLE_MASK0;
-    if ( (i+1) < _n ) _x[i+1] ^= LIQUID_SCRAMBLE_MASK1;
-    if ( (i+2) < _n ) _x[i+2] ^= LIQUID_SCRAMBLE_MASK2;
-    if ( (i+3) < _n ) _x[i+3] ^= LIQUID_SCRAMBLE_MASK3;
+    for ( ; i<_n; i++)
+        _x[i] ^= _mask[i % _p];
+}
+
+void scramble_data(unsigned char * _x,
+                   unsigned int _n)
+{
+    liquid_scramble_xor(_x, _n, liquid_scramble_mask, 8);
 }
 
 void unscramble_data(unsigned char * _x,
@@ -65,36 +90,6 @@ void unscramble_data(unsigned char * _x,
 void unscramble_data_soft(unsigned char * _x,
                           unsigned int _n)
 {
-    // bit mask
-    unsigned char mask = 0x00;
-
-    // apply static masks
-    unsigned int i;
-    for (i=0; i<_n; i++) {
-        switch ( i % 4 ) {
-        case 0: mask = LIQUID_SCRAMBLE_MASK0; break;
-        case 1: mask = LIQUID_SCRAMBLE_MASK1; break;
-        case 2: mask = LIQUID_SCRAMBLE_MASK2; break;
-        case 3: mask = LIQUID_SCRAMBLE_MASK3; break;
-        default:;
-        }
-
-#if 0
-        unsigned int j;
-        for (j=0; j<8; j++) {
-            if ( (mask >> (8-j-1)) & 0x01 )
-                _x[8*i+j] = 255 - _x[8*i+j];
-        }
-#else
-        if ( mask & 0x80 ) _x[8*i+0] = 255 - _x[8*i+0];
-        if ( mask & 0x40 ) _x[8*i+1] = 255 - _x[8*i+1];
-        if ( mask & 0x20 ) _x[8*i+2] = 255 - _x[8*i+2];
-        if ( mask & 0x10 ) _x[8*i+3] = 255 - _x[8*i+3];
-        if ( mask & 0x08 ) _x[8*i+4] = 255 - _x[8*i+4];
-        if ( mask & 0x04 ) _x[8*i+5] = 255 - _x[8*i+5];
-        if ( mask & 0x02 ) _x[8*i+6] = 255 - _x[8*i+6];
-        if ( mask & 0x01 ) _x[8*i+7] = 255 - _x[8*i+7];
-#endif
-    }
+    liquid_scramble_xor(_x, 8*_n, liquid_scramble_mask_soft, 32);
 }
 
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+#define RANDGEN_AUTOTEST_NUM_TRIALS (200000)
+
+// 
+// AUTOTEST: sequences repeat for same seed, differ otherwise
+//
+void autotest_randgen_seed()
+{
+    randgen q0 = randgen_create(1234);
+    randgen q1 = randgen_create(1234);
+    randgen q2 = randgen_create(1235);
+
+    unsigned int i, num_diff = 0;
+    unsigned int v[100];
+    for (i=0; i<100; i++) {
+        v[i] = randgen_uint(q0);
+        CONTEND_EQUALITY(v[i], randgen_uint(q1));
+        num_diff += v[i] != randgen_uint(q2);
+    }
+    CONTEND_GREATER_THAN(num_diff, 95);
+
+    // reset restores initial seed
+    randgen_reset(q0);
+    for (i=0; i<100; i++)
+        CONTEND_EQUALITY(randgen_uint(q0), v[i]);
+
+    // jumped generator produces different sequence
+    randgen_reset(q1);
+    randgen_jump(q1);
+    num_diff = 0;
+    for (i=0; i<100; i++)
+        num_diff += v[i] != randgen_uint(q1);
+    CONTEND_GREATER_THAN(num_diff, 95);
+
+    randgen_destroy(q0);
+    randgen_destroy(q1);
+    randgen_destroy(q2);
+}
+
+//
+// AUTOTEST: block and single-value methods produce the same sequence
+//
+void autotest_randgen_block()
+{
+    randgen q = randgen_create(77);
+    float x[257];
+    unsigned int i;
+
+    randgen_gauss_block(q, x, 257);
+    randgen_reset(q);
+    for (i=0; i<257; i++)
+        CONTEND_EQUALITY(x[i], randgen_gauss(q));
+
+    randgen_reset(q);
+    float complex y[100];
+    randgen_cgauss_block(q, y, 100);
+    randgen_reset(q);
+    for (i=0; i<100; i++) {
+        float complex v = randgen_cgauss(q);
+        CONTEND_EQUALITY(crealf(y[i]), crealf(v));
+        CONTEND_EQUALITY(cimagf(y[i]), cimagf(v));
+    }
+
+    randgen_destroy(q);
+}
+
+// helper: compute first, second, and fourth moments of array
+void randgen_autotest_moments(float * _x,
+                              unsigned int _n,
+                              float * _m1,
+                              float * _m2,
+                              float * _m4)
+{
+    double m1=0, m2=0, m4=0;
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        double v = _x[i];
+        m1 += v;
+        m2 += v*v;
+        m4 += v*v*v*v;
+    }
+    *_m1 = m1 / _n;
+    *_m2 = m2 / _n;
+    *_m4 = m4 / _n;
+}
+
+void autotest_randgen_uniform()
+{
+    unsigned int n = RANDGEN_AUTOTEST_NUM_TRIALS;
+    float * x = (float*) malloc(n*sizeof(float));
+    randgen q = randgen_create(1);
+    randgen_uniform_block(q, x, n);
+
+    unsigned int i;
+    for (i=0; i<n; i++) {
+        if (x[i] <= 0.0f || x[i] > 1.0f)
+            CONTEND_EXPRESSION(0);
+    }
+
+    float m1, m2, m4;
+    randgen_autotest_moments(x, n, &m1, &m2, &m4);
+    CONTEND_DELTA(m1,       0.5f,     0.01f);
+    CONTEND_DELTA(m2-m1*m1, 1/12.0f,  0.005f);
+
+    randgen_destroy(q);
+    free(x);
+}
+
+void autotest_randgen_gauss()
+{
+    unsigned int n = RANDGEN_AUTOTEST_NUM_TRIALS;
+    float * x = (float*) malloc(n*sizeof(float));
+    randgen q = randgen_create(2);
+    randgen_gauss_block(q, x, n);
+
+    float m1, m2, m4;
+    randgen_autotest_moments(x, n, &m1, &m2, &m4);
+    CONTEND_DELTA(m1, 0.0f, 0.01f);
+    CONTEND_DELTA(m2, 1.0f, 0.02f);
+    CONTEND_DELTA(m4, 3.0f, 0.1f);
+
+    // tail probabilities, P(|x| > 3) = 2.700e-3, P(|x| > 4) = 6.334e-5
+    unsigned int i, n3=0, n4=0;
+    for (i=0; i<n; i++) {
+        n3 += fabsf(x[i]) > 3.0f;
+        n4 += fabsf(x[i]) > 4.0f;
+    }
+    CONTEND_DELTA((float)n3 / (float)n, 2.700e-3f, 0.4e-3f);
+    CONTEND_DELTA((float)n4 / (float)n, 6.334e-5f, 4.0e-5f);
+
+    randgen_destroy(q);
+    free(x);
+}
+
+void autotest_randgen_cgauss()
+{
+    unsigned int n = RANDGEN_AUTOTEST_NUM_TRIALS / 2;
+    float complex * x = (float complex*) malloc(n*sizeof(float complex));
+    randgen q = randgen_create(3);
+    randgen_cgauss_block(q, x, n);
+
+    unsigned int i;
+    float complex m1 = 0;
+    float m2 = 0;
+    for (i=0; i<n; i++) {
+        m1 += x[i];
+        m2 += crealf(x[i]*conjf(x[i]));
+    }
+    CONTEND_DELTA(cabsf(m1) / n, 0.0f, 0.01f);
+    CONTEND_DELTA(m2 / n,        1.0f, 0.02f);
+
+    randgen_destroy(q);
+    free(x);
+}
+
+void autotest_randgen_ricek()
+{
+    unsigned int n = RANDGEN_AUTOTEST_NUM_TRIALS;
+    float * x = (float*) malloc(n*sizeof(float));
+    randgen q = randgen_create(4);
+
+    // E{x^2} = omega
+    float K = 2.0f, omega = 1.5f;
+    randgen_ricek_block(q, K, omega, x, n);
+    float m1, m2, m4;
+    randgen_autotest_moments(x, n, &m1, &m2, &m4);
+    CONTEND_DELTA(m2, omega, 0.03f);
+
+    // K=0 is Rayleigh: E{x} = sqrt(pi*omega/4)
+    randgen_ricek_block(q, 0.0f, omega, x, n);
+    randgen_autotest_moments(x, n, &m1, &m2, &m4);
+    CONTEND_DELTA(m1, sqrtf(M_PI*omega/4), 0.01f);
+
+    randgen_destroy(q);
+    free(x);
+}
+
+void autotest_randgen_nakm()
+{
+    unsigned int n = RANDGEN_AUTOTEST_NUM_TRIALS;
+    float * x = (float*) malloc(n*sizeof(float));
+    randgen q = randgen_create(5);
+
+    // E{x^2} = omega, Var{x^2} = omega^2 / m for m in both regimes
+    float m_values[3] = {0.7f, 1.0f, 3.0f};
+    float omega = 2.0f;
+    unsigned int k;
+    for (k=0; k<3; k++) {
+        float m = m_values[k];
+        randgen_nakm_block(q, m, omega, x, n);
+        float m1, m2, m4;
+        randgen_autotest_moments(x, n, &m1, &m2, &m4);
+        CONTEND_DELTA(m2,       omega,           0.04f);
+        CONTEND_DELTA(m4-m2*m2, omega*omega / m, 0.15f);
+    }
+
+    randgen_destroy(q);
+    free(x);
+}
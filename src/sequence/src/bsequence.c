@@ -33,15 +33,52 @@
 
 #include "liquid.internal.h"
 
+#if LIQUID_SIMD_DISPATCH
+#include <immintrin.h>  // POPCNT (selected at run time)
+#endif
+
+// number of bits in each block
+#define BSEQUENCE_BLOCK_BITS (64)
+
 // 
 struct bsequence_s {
-    unsigned int * s;           // sequence array, memory pointer
+    uint64_t * s;               // sequence array, memory pointer
     unsigned int num_bits;      // number of bits in sequence
     unsigned int num_bits_msb;  // number of bits in most-significant block
-    unsigned int bit_mask_msb;  // bit mask for most-significant block
+    uint64_t bit_mask_msb;      // bit mask for most-significant block
     unsigned int s_len;         // length of array, number of allocated blocks
+
+    // count matching bits between two arrays of blocks
+    unsigned int (*match_func)(uint64_t *, uint64_t *, unsigned int);
 };
 
+// count matching bits between two arrays of blocks
+static unsigned int bsequence_match_port(uint64_t *   _x,
+                                         uint64_t *   _y,
+                                         unsigned int _n)
+{
+    unsigned int i;
+    unsigned int r = 0;
+    for (i=0; i<_n; i++)
+        r += liquid_count_ones_uint64(~(_x[i] ^ _y[i]));
+    return r;
+}
+
+#if LIQUID_SIMD_DISPATCH
+// count matching bits between two arrays of blocks (hardware popcount)
+__attribute__((target("popcnt")))
+static unsigned int bsequence_match_popcnt(uint64_t *   _x,
+                                           uint64_t *   _y,
+                                           unsigned int _n)
+{
+    unsigned int i;
+    unsigned int r = 0;
+    for (i=0; i<_n; i++)
+        r += (unsigned int)_mm_popcnt_u64(~(_x[i] ^ _y[i]));
+    return r;
+}
+#endif
+
 // Create a binary sequence of a specific length
 bsequence bsequence_create(unsigned int _num_bits)
 {
@@ -56,25 +93,28 @@ bsequence bsequence_create(unsigned int _num_bits)
     bs->num_bits = _num_bits;
     
     // initialize array length
-    div_t d = div( bs->num_bits, sizeof(unsigned int)*8 );
+    div_t d = div( bs->num_bits, BSEQUENCE_BLOCK_BITS );
     bs->s_len = d.quot;
     bs->s_len += (d.rem > 0) ? 1 : 0;
 
     // number of bits in MSB block
-    bs->num_bits_msb = (d.rem == 0) ? 8*sizeof(unsigned int) : (unsigned int) d.rem;
+    bs->num_bits_msb = (d.rem == 0) ? BSEQUENCE_BLOCK_BITS : (unsigned int) d.rem;
 
     // bit mask for MSB block
-    unsigned int i;
-    bs->bit_mask_msb = 0;
-    for (i=0; i<bs->num_bits_msb; i++) {
-        bs->bit_mask_msb <<= 1;
-        bs->bit_mask_msb |=  1;
-    }
+    bs->bit_mask_msb = bs->num_bits_msb == BSEQUENCE_BLOCK_BITS ?
+        ~(uint64_t)0 : (((uint64_t)1 << bs->num_bits_msb) - 1);
 
     // initialze array with zeros
-    bs->s = (unsigned int*) malloc( bs->s_len * sizeof(unsigned int) );
+    bs->s = (uint64_t*) malloc( bs->s_len * sizeof(uint64_t) );
     bsequence_clear(bs);
 
+    // select correlation kernel
+    bs->match_func = bsequence_match_port;
+#if LIQUID_SIMD_DISPATCH
+    if (liquid_simd_has_popcnt())
+        bs->match_func = bsequence_match_popcnt;
+#endif
+
     return bs;
 }
 
@@ -87,26 +127,33 @@ void bsequence_destroy(bsequence _bs)
 
 void bsequence_clear(bsequence _bs)
 {
-    memset( _bs->s, 0x00, (_bs->s_len)*sizeof(unsigned int) );
+    memset( _bs->s, 0x00, (_bs->s_len)*sizeof(uint64_t) );
 }
 
 // initialize sequence on external array
 void bsequence_init(bsequence _bs,
                     unsigned char * _v)
 {
-    // push single bit at a time
+    // the first bit of the array ends up in the most-significant
+    // position of the first block, as if pushed one at a time; fill
+    // blocks from the last (least significant) one whole bytes at a time
     unsigned int i;
-    unsigned int k=0;
-    unsigned char byte = 0x00;
-    unsigned char mask = 0x80;
+    unsigned int j;
+    bsequence_clear(_bs);
     for (i=0; i<_bs->num_bits; i++) {
-        if ( (i%8)==0 ) {
-            byte = _v[k++];
-            mask = 0x80;
+        // bit position counted from the end of the sequence
+        unsigned int p = _bs->num_bits - 1 - i;
+        unsigned int k = _bs->s_len - 1 - p / BSEQUENCE_BLOCK_BITS;
+        unsigned int b = p % BSEQUENCE_BLOCK_BITS;
+
+        // copy remainder of this byte (and block) at once when aligned
+        if ( (i%8)==0 && b >= 7 && i+8 <= _bs->num_bits ) {
+            _bs->s[k] |= (uint64_t)_v[i/8] << (b-7);
+            i += 7;
+            continue;
         }
-
-        bsequence_push(_bs, byte & mask ? 1 : 0);
-        mask >>= 1;
+        j = (_v[i/8] >> (7 - i%8)) & 0x01;
+        _bs->s[k] |= (uint64_t)j << b;
     }
 }
 
@@ -114,8 +161,8 @@ void bsequence_init(bsequence _bs,
 void bsequence_print(bsequence _bs)
 {
     unsigned int i, j;
-    unsigned int chunk;
-    unsigned int p = 8*sizeof(unsigned int);
+    uint64_t chunk;
+    unsigned int p = BSEQUENCE_BLOCK_BITS;
 
     printf("bsequence[%6u]:     ", _bs->num_bits);
     for (i=0; i<_bs->s_len; i++) {
@@ -139,9 +186,9 @@ void bsequence_print(bsequence _bs)
 void bsequence_push(bsequence _bs,
                     unsigned int _bit)
 {
-    unsigned int overflow;
+    uint64_t overflow;
     unsigned int i;
-    unsigned int p = 8*sizeof(unsigned int);
+    unsigned int p = BSEQUENCE_BLOCK_BITS;
 
     // shift first block
     _bs->s[0] <<= 1;
@@ -159,15 +206,14 @@ void bsequence_push(bsequence _bs,
     }
 
     // apply input bit to LSB of last block
-    _bs->s[_bs->s_len-1] |= ( _bit & 1 );
+    _bs->s[_bs->s_len-1] |= (uint64_t)( _bit & 1 );
 }
 
 // circular shift (left)
 void bsequence_circshift(bsequence _bs)
 {
     // extract most-significant (left-most) bit
-    unsigned int msb_mask = 1 << (_bs->num_bits_msb-1);
-    unsigned int b = (_bs->s[0] & msb_mask) >> (_bs->num_bits_msb-1);
+    unsigned int b = (unsigned int)(_bs->s[0] >> (_bs->num_bits_msb-1)) & 1;
 
     // push bit into sequence
     bsequence_push(_bs, b);
@@ -177,26 +223,16 @@ void bsequence_circshift(bsequence _bs)
 signed int bsequence_correlate(bsequence _bs1,
                                bsequence _bs2)
 {
-    signed int rxy = 0;
-    unsigned int i;
-    
     if ( _bs1->s_len != _bs2->s_len ) {
         printf("error: bsequence_correlate(), binary sequences must be the same length!\n");
         exit(-1);
     }
     
-    unsigned int chunk;
-
-    for (i=0; i<_bs1->s_len; i++) {
-        //
-        chunk = _bs1->s[i] ^ _bs2->s[i];
-        chunk = ~chunk;
-
-        rxy += liquid_count_ones(chunk);
-    }
+    // count matching bits (complement of xor) over all blocks
+    signed int rxy = _bs1->match_func(_bs1->s, _bs2->s, _bs1->s_len);
 
     // compensate for most-significant block and return
-    rxy -= 8*sizeof(unsigned int) - _bs1->num_bits_msb;
+    rxy -= BSEQUENCE_BLOCK_BITS - _bs1->num_bits_msb;
     return rxy;
 }
 
@@ -251,7 +287,7 @@ unsigned int bsequence_accumulate(bsequence _bs)
     unsigned int r=0;
 
     for (i=0; i<_bs->s_len; i++)
-        r += liquid_count_ones(_bs->s[i]);
+        r += liquid_count_ones_uint64(_bs->s[i]);
 
     return r;
 }
@@ -270,13 +306,13 @@ unsigned int bsequence_index(bsequence _bs,
         fprintf(stderr,"error: bsequence_index(), invalid index %u\n", _i);
         exit(-1);
     }
-    div_t d = div( _i, 8*sizeof(unsigned int) );
+    div_t d = div( _i, BSEQUENCE_BLOCK_BITS );
 
-    // compute byte index
+    // compute block index
     unsigned int k = _bs->s_len - d.quot - 1;
 
-    // return particular bit at byte index
-    return (_bs->s[k] >> d.rem ) & 1;
+    // return particular bit at block index
+    return (unsigned int)(_bs->s[k] >> d.rem ) & 1;
 }
 
 // intialize two sequences to complementary codes.  sequences must
@@ -34,6 +34,9 @@
 #define LIQUID_MIN_MSEQUENCE_M  2
 #define LIQUID_MAX_MSEQUENCE_M  15
 
+// compute tables for generating 64 bits at a time
+void msequence_init_jump(msequence _ms);
+
 // msequence structure
 //  Note that 'g' is stored as the default polynomial shifted to the
 //  right by one bit; this bit is implied and not actually used in
@@ -94,6 +97,7 @@ msequence msequence_create(unsigned int _m,
     ms->v = ms->a;      // shift register
     ms->b = 0;          // return bit
 
+    msequence_init_jump(ms);
     return ms;
 }
 
@@ -132,13 +136,14 @@ msequence msequence_create_default(unsigned int _m)
     // copy default sequence
     memmove(ms, &msequence_default[_m], sizeof(struct msequence_s));
 
-    // return
+    msequence_init_jump(ms);
     return ms;
 }
 
 // destroy an msequence object, freeing all internal memory
 void msequence_destroy(msequence _ms)
 {
+    free(_ms->jump);
     free(_ms);
 }
 
@@ -183,15 +188,62 @@ unsigned int msequence_advance(msequence _ms)
 unsigned int msequence_generate_symbol(msequence _ms,
                                        unsigned int _bps)
 {
-    unsigned int i;
-    unsigned int s = 0;
-    for (i=0; i<_bps; i++) {
-        s <<= 1;
-        s |= msequence_advance(_ms);
+    if (_bps == 0 || _bps > 32) {
+        unsigned int i;
+        unsigned int s = 0;
+        for (i=0; i<_bps; i++) {
+            s <<= 1;
+            s |= msequence_advance(_ms);
+        }
+        return s;
     }
+
+    // take leading bits of next word, then shift them into the register
+    uint64_t w = _ms->jump[      _ms->v       & 0xff] ^
+                 _ms->jump[256 + ((_ms->v >> 8) & 0xff)];
+    unsigned int s = (unsigned int)(w >> (64 - _bps));
+    _ms->v = (unsigned int)((((uint64_t)_ms->v << _bps) | s) & _ms->n);
+    _ms->b = s & 1;
     return s;
 }
 
+// generate next 64 bits of sequence, first bit in most-significant
+// position; equivalent to 64 calls to msequence_advance()
+uint64_t msequence_generate_word(msequence _ms)
+{
+    uint64_t w = _ms->jump[      _ms->v       & 0xff] ^
+                 _ms->jump[256 + ((_ms->v >> 8) & 0xff)];
+
+    // register holds the most recent m <= 15 output bits
+    _ms->v = (unsigned int)(w & _ms->n);
+    _ms->b = (unsigned int)(w & 1);
+    return w;
+}
+
+// generate block of sequence bits packed into bytes (msb first)
+//  _ms     :   m-sequence object
+//  _y      :   output bytes [size: _n x 1]
+//  _n      :   number of bytes to generate
+void msequence_generate_block(msequence      _ms,
+                              unsigned char * _y,
+                              unsigned int    _n)
+{
+    unsigned int i;
+    for (i=0; i+8<=_n; i+=8) {
+        uint64_t w = msequence_generate_word(_ms);
+        _y[i+0] = (unsigned char)(w >> 56);
+        _y[i+1] = (unsigned char)(w >> 48);
+        _y[i+2] = (unsigned char)(w >> 40);
+        _y[i+3] = (unsigned char)(w >> 32);
+        _y[i+4] = (unsigned char)(w >> 24);
+        _y[i+5] = (unsigned char)(w >> 16);
+        _y[i+6] = (unsigned char)(w >>  8);
+        _y[i+7] = (unsigned char)(w      );
+    }
+    for ( ; i<_n; i++)
+        _y[i] = msequence_generate_symbol(_ms, 8);
+}
+
 // reset msequence shift register to original state, typically '1'
 void msequence_reset(msequence _ms)
 {
@@ -211,12 +263,36 @@ void bsequence_init_msequence(bsequence _bs,
     }
 #endif
 
-    // clear binary sequence
-    bsequence_clear(_bs);
+    // as with clearing the binary sequence and pushing the n bits of
+    // the m-sequence, the last (up to) L bits end up at the end of the
+    // length-L binary sequence, preceded by zeros
+    unsigned int L = bsequence_get_length(_bs);
+    unsigned int num_skip = _ms->n > L ? _ms->n - L : 0;
+    unsigned int num_bits = _ms->n - num_skip;
+    unsigned int offset   = L - num_bits;
+
+    // advance past skipped bits
+    while (num_skip >= 32) {
+        msequence_generate_symbol(_ms, 32);
+        num_skip -= 32;
+    }
+    msequence_generate_symbol(_ms, num_skip);
 
+    // write remaining bits into zero-padded array, offset from start
+    unsigned int num_bytes = (L + 7) / 8;
+    unsigned char * v = (unsigned char*) calloc(num_bytes, sizeof(unsigned char));
     unsigned int i;
-    for (i=0; i<(_ms->n); i++)
-        bsequence_push(_bs, msequence_advance(_ms));
+    for (i=0; i<num_bits; i+=32) {
+        unsigned int k = num_bits - i < 32 ? num_bits - i : 32;
+        unsigned int s = msequence_generate_symbol(_ms, k);
+        unsigned int j;
+        for (j=0; j<k; j++) {
+            unsigned int p = offset + i + j;
+            v[p/8] |= ((s >> (k-j-1)) & 1) << (7 - p%8);
+        }
+    }
+    bsequence_init(_bs, v);
+    free(v);
 }
 
 // get the length of the sequence
@@ -241,3 +317,35 @@ void msequence_set_state(msequence    _ms,
     _ms->v = _a;
 }
 
+//
+// internal methods
+//
+
+// compute tables for generating 64 bits at a time: since the sequence
+// is linear in the shift register, the next 64 output bits for any
+// state are the sum of those for each of its set bits
+void msequence_init_jump(msequence _ms)
+{
+    _ms->jump = (uint64_t*) malloc(2*256*sizeof(uint64_t));
+
+    // output for each single-bit state
+    uint64_t basis[16];
+    unsigned int k, i;
+    for (k=0; k<16; k++) {
+        unsigned int v = (1u << k) & _ms->n;
+        basis[k] = 0;
+        for (i=0; i<64; i++) {
+            unsigned int b = liquid_bdotprod(v, _ms->g);
+            v = ((v << 1) | b) & _ms->n;
+            basis[k] = (basis[k] << 1) | b;
+        }
+    }
+
+    // combine for each byte value of the register
+    _ms->jump[0] = _ms->jump[256] = 0;
+    for (i=1; i<256; i++) {
+        unsigned int t = liquid_msb_index(i) - 1;
+        _ms->jump[      i] = _ms->jump[      i ^ (1u << t)] ^ basis[t];
+        _ms->jump[256 + i] = _ms->jump[256 + (i ^ (1u << t))] ^ basis[t+8];
+    }
+}
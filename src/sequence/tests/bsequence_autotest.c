@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  */
 
+#include <stdlib.h>
 #include "autotest/autotest.h"
 #include "liquid.h"
 
@@ -201,4 +202,52 @@ void autotest_bsequence_accumulate()
     bsequence_destroy(q);
 }
 
-
+// 
+// test initialization and correlation of sequences spanning several
+// blocks against bit-by-bit computation
+//
+void autotest_bsequence_correlate_long()
+{
+    unsigned int lengths[5] = {63, 64, 65, 130, 1000};
+    unsigned int i, j;
+    for (i=0; i<5; i++) {
+        unsigned int n = lengths[i];
+        unsigned char v0[(n+7)/8];
+        unsigned char v1[(n+7)/8];
+        for (j=0; j<(n+7)/8; j++) {
+            v0[j] = rand() & 0xff;
+            v1[j] = rand() & 0xff;
+        }
+
+        bsequence q0 = bsequence_create(n);
+        bsequence q1 = bsequence_create(n);
+        bsequence q2 = bsequence_create(n);
+        bsequence_init(q0,v0);
+        for (j=0; j<n; j++)
+            bsequence_push(q2, (v0[j/8] >> (7-j%8)) & 1);
+
+        // index n-1 is the first bit of the array
+        int rxy = 0;
+        unsigned int num_ones = 0;
+        for (j=0; j<n; j++) {
+            unsigned int b0 = (v0[j/8] >> (7-j%8)) & 1;
+            unsigned int b1 = (v1[j/8] >> (7-j%8)) & 1;
+            CONTEND_EQUALITY( bsequence_index(q0,n-1-j), b0 );
+            CONTEND_EQUALITY( bsequence_index(q2,n-1-j), b0 );
+            rxy      += b0 == b1;
+            num_ones += b0;
+        }
+        bsequence_init(q1,v1);
+        CONTEND_EQUALITY( bsequence_correlate(q0,q1), rxy );
+        CONTEND_EQUALITY( bsequence_accumulate(q0), num_ones );
+
+        // circular shift by full length returns to original
+        for (j=0; j<n; j++)
+            bsequence_circshift(q2);
+        CONTEND_EQUALITY( bsequence_correlate(q0,q2), n );
+
+        bsequence_destroy(q0);
+        bsequence_destroy(q1);
+        bsequence_destroy(q2);
+    }
+}
@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  */
 
+#include <stdlib.h>
 #include "autotest/autotest.h"
 #include "liquid.h"
 
@@ -92,3 +93,74 @@ void autotest_msequence_m10()   {   msequence_test_autocorrelation(10); }   // n
 void autotest_msequence_m11()   {   msequence_test_autocorrelation(11); }   // n = 2047
 void autotest_msequence_m12()   {   msequence_test_autocorrelation(12); }   // n = 4095
 
+// helper function to test block generation against single-bit advance
+void msequence_test_generate(unsigned int _m)
+{
+    msequence q0 = msequence_create_default(_m);
+    msequence q1 = msequence_create_default(_m);
+
+    // symbols of varying size
+    unsigned int i, j;
+    for (i=0; i<200; i++) {
+        unsigned int bps = 1 + (i % 32);
+        unsigned int s0 = 0;
+        for (j=0; j<bps; j++)
+            s0 = (s0 << 1) | msequence_advance(q0);
+        unsigned int s1 = msequence_generate_symbol(q1, bps);
+        CONTEND_EQUALITY( s1, s0 );
+        CONTEND_EQUALITY( msequence_get_state(q1), msequence_get_state(q0) );
+    }
+
+    // packed block of bytes, including partial word
+    unsigned char y0[37];
+    unsigned char y1[37];
+    for (i=0; i<37; i++)
+        y0[i] = msequence_generate_symbol(q0, 8);
+    msequence_generate_block(q1, y1, 37);
+    CONTEND_SAME_DATA( y1, y0, 37 );
+    CONTEND_EQUALITY( msequence_get_state(q1), msequence_get_state(q0) );
+
+    msequence_destroy(q0);
+    msequence_destroy(q1);
+}
+
+void autotest_msequence_generate_m2()  { msequence_test_generate(2);  }
+void autotest_msequence_generate_m5()  { msequence_test_generate(5);  }
+void autotest_msequence_generate_m8()  { msequence_test_generate(8);  }
+void autotest_msequence_generate_m9()  { msequence_test_generate(9);  }
+void autotest_msequence_generate_m15() { msequence_test_generate(15); }
+
+// initialize binary sequences of various lengths on m-sequence and
+// compare against clearing and pushing bits one at a time; any prior
+// contents of the binary sequence are discarded
+void autotest_bsequence_init_msequence_length()
+{
+    unsigned int lengths[6] = {5, 31, 63, 64, 65, 200};
+    unsigned int i, j;
+    for (i=0; i<6; i++) {
+        msequence q0 = msequence_create_default(5);
+        msequence q1 = msequence_create_default(5);
+        msequence_generate_symbol(q0, 3);
+        msequence_generate_symbol(q1, 3);
+
+        bsequence b0 = bsequence_create(lengths[i]);
+        bsequence b1 = bsequence_create(lengths[i]);
+        for (j=0; j<lengths[i]; j++) {
+            bsequence_push(b0, 1);
+            bsequence_push(b1, 1);
+        }
+        bsequence_clear(b0);
+        for (j=0; j<msequence_get_length(q0); j++)
+            bsequence_push(b0, msequence_advance(q0));
+        bsequence_init_msequence(b1, q1);
+
+        for (j=0; j<lengths[i]; j++)
+            CONTEND_EQUALITY( bsequence_index(b1,j), bsequence_index(b0,j) );
+        CONTEND_EQUALITY( msequence_get_state(q1), msequence_get_state(q0) );
+
+        bsequence_destroy(b0);
+        bsequence_destroy(b1);
+        msequence_destroy(q0);
+        msequence_destroy(q1);
+    }
+}
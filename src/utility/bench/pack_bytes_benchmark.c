@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small
+void repack_bytes_bench(struct rusage *_start,
+                        struct rusage *_finish,
+                        unsigned long int *_num_iterations,
+                        unsigned int _bps)
+{
+    // normalize number of iterations
+    *_num_iterations *= 10;
+
+    unsigned int n = 1024;      // number of input bytes
+    unsigned int num_symbols = (8*n + _bps - 1) / _bps;
+    unsigned char x[n];
+    unsigned char y[num_symbols];
+    unsigned int num_written;
+
+    unsigned long int i;
+    for (i=0; i<n; i++)
+        x[i] = rand() & 0xff;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        liquid_repack_bytes(x, 8, n, y, _bps, num_symbols, &num_written);
+        liquid_repack_bytes(y, _bps, num_symbols, x, 8, n, &num_written);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 2;
+}
+
+// pack symbols into array one at a time or as a block
+void pack_array_bench(struct rusage *_start,
+                      struct rusage *_finish,
+                      unsigned long int *_num_iterations,
+                      unsigned int _bps,
+                      int _block)
+{
+    // normalize number of iterations
+    *_num_iterations *= 10;
+
+    unsigned int n = 1024;      // number of array bytes
+    unsigned int num_symbols = 8*n / _bps;
+    unsigned char x[n];
+    unsigned char s[num_symbols];
+
+    unsigned long int i;
+    unsigned int j;
+    for (j=0; j<num_symbols; j++)
+        s[j] = rand() & ((1 << _bps) - 1);
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        if (_block) {
+            liquid_pack_array_block(x, n, 0, _bps, s, num_symbols);
+        } else {
+            for (j=0; j<num_symbols; j++)
+                liquid_pack_array(x, n, j*_bps, _bps, s[j]);
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+}
+
+#define REPACK_BYTES_BENCHMARK_API(BPS)     \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ repack_bytes_bench(_start, _finish, _num_iterations, BPS); }
+
+#define PACK_ARRAY_BENCHMARK_API(BPS,BLOCK) \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ pack_array_bench(_start, _finish, _num_iterations, BPS, BLOCK); }
+
+// 
+void benchmark_repack_bytes_bps1    REPACK_BYTES_BENCHMARK_API(1)
+void benchmark_repack_bytes_bps2    REPACK_BYTES_BENCHMARK_API(2)
+void benchmark_repack_bytes_bps3    REPACK_BYTES_BENCHMARK_API(3)
+void benchmark_repack_bytes_bps4    REPACK_BYTES_BENCHMARK_API(4)
+void benchmark_repack_bytes_bps5    REPACK_BYTES_BENCHMARK_API(5)
+void benchmark_repack_bytes_bps6    REPACK_BYTES_BENCHMARK_API(6)
+
+void benchmark_pack_array_bps3      PACK_ARRAY_BENCHMARK_API(3,0)
+void benchmark_pack_array_block_bps3 PACK_ARRAY_BENCHMARK_API(3,1)
+
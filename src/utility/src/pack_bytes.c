@@ -28,6 +28,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "liquid.internal.h"
 
@@ -52,59 +53,17 @@ void liquid_pack_array(unsigned char * _src,
         exit(1);
     }
 
-    // find base index
-    unsigned int i0 = _k / 8;       // byte index
-    unsigned int b0 = _k - 8*i0;    // bit index
-    //printf("base index : %2u, %2u\n", i0, b0);
-
-    // determine if index spans multiple bytes
-    if (b0 + _b > 8) {
-        // compute number of bits in each symbol
-        unsigned int n0 = 8 - b0;
-        unsigned int n1 = _b - n0;
-
-        // generate mask for each symbol
-        unsigned char mask_0 =  0xff >> (8-n0);
-        unsigned char mask_1 = (0xff >> (8-n1)) << (8-n1);
-
-        // shift then mask
-        unsigned char sym_0 = (_sym_in >>    n1 ) & mask_0;
-        unsigned char sym_1 = (_sym_in << (8-n1)) & mask_1;
-
-        // mask and pack first byte
-        _src[i0] &= ~mask_0;        // clear relevant bits
-        _src[i0] |= sym_0;          // set relevant bits
-
-        // mask and pack second byte (if not exceeding array size)
-        if (i0 < _n-1) {
-            _src[i0+1] &= ~mask_1;  // clear relevant bits
-            _src[i0+1] |= sym_1;    // set relevant bits
-        }
+    // place symbol within 16-bit window spanning bytes i0 and i0+1
+    unsigned int i0   = _k >> 3;
+    unsigned int s    = 16 - (_k & 7) - _b;
+    unsigned int mask = ((1u << _b) - 1) << s;
+    unsigned int sym  = ((unsigned int)_sym_in << s) & mask;
 
-#if 0
-        printf("  output symbol spans multiple bytes\n");
-        printf("  n0    : %u\n", n0);
-        printf("  n1    : %u\n", n1);
-        printf("  mask0 : 0x%.2x\n", mask_0);
-        printf("  mask1 : 0x%.2x\n", mask_1);
-        printf("  sym 0 : 0x%.2x\n", sym_0);
-        printf("  sym 1 : 0x%.2x\n", sym_1);
-#endif
-    } else {
-        // compute mask
-        unsigned char mask_0 = (0xff >> (8-_b)) << (8-_b-b0);
-        unsigned char sym_0  = (_sym_in << (8-_b-b0)) & mask_0;
-
-        // shift then mask
-        _src[i0] &= ~mask_0;    // clear relevant bits
-        _src[i0] |= sym_0;      // set relevant bits
-
-#if 0
-        printf("  _b   : %u\n", _b);
-        printf("  b0   : %u\n", b0);
-        printf("  mask : 0x%.2x\n", mask_0);
-#endif
-    }
+    _src[i0] = (_src[i0] & ~(mask >> 8)) | (sym >> 8);
+
+    // second byte (if not exceeding array size)
+    if (i0 < _n-1)
+        _src[i0+1] = (_src[i0+1] & ~mask) | (sym & 0xff);
 }
 
 // unpack symbols from binary array
@@ -128,54 +87,136 @@ void liquid_unpack_array(unsigned char * _src,
         exit(1);
     }
 
-    // find base index
-    unsigned int i0 = _k / 8;       // byte index
-    unsigned int b0 = _k - 8*i0;    // bit index
-    //printf("base index : %2u, %2u\n", i0, b0);
-
-    // determine if index spans multiple bytes
-    if (b0 + _b > 8) {
-        // compute number of bits in each symbol
-        unsigned int n0 = 8 - b0;
-        unsigned int n1 = _b - n0;
-
-        // generate mask for each symbol
-        unsigned char mask_0 = 0xff >> (8-n0);
-        unsigned char mask_1 = 0xff >> (8-n1);
-
-        // shift then mask
-        unsigned char sym_0 = _src[i0] & mask_0;
-        unsigned char sym_1 = (i0==_n-1) ? 0x00 : (_src[i0+1] >> (8-n1)) & mask_1;
-
-        // concatenate output symbols
-        *_sym_out = (sym_0 << n1) | sym_1;
-
-#if 0
-        printf("  output symbol spans multiple bytes\n");
-        printf("  n0    : %u\n", n0);
-        printf("  n1    : %u\n", n1);
-        printf("  mask0 : 0x%.2x\n", mask_0);
-        printf("  mask1 : 0x%.2x\n", mask_1);
-        printf("  sym 0 : 0x%.2x\n", sym_0);
-        printf("  sym 1 : 0x%.2x\n", sym_1);
-#endif
-    } else {
-        // compute mask
-        unsigned char mask_0 = ((1 << _b) - 1);
-
-        // shift then mask
-        *_sym_out = (_src[i0] >> (8-_b-b0)) & mask_0;
-
-#if 0
-        printf("  _b   : %u\n", _b);
-        printf("  b0   : %u\n", b0);
-        printf("  mask : 0x%.2x\n", mask_0);
-#endif
+    // read 16-bit window spanning bytes i0 and i0+1
+    unsigned int i0 = _k >> 3;
+    unsigned int w  = ((unsigned int)_src[i0] << 8) | (i0 < _n-1 ? _src[i0+1] : 0);
+
+    *_sym_out = (w >> (16 - (_k & 7) - _b)) & ((1u << _b) - 1);
+}
+
+// pack block of symbols into binary array; bits beyond the end of
+// the array are discarded
+//  _src        :   source array [size: _n x 1]
+//  _n          :   input source array length
+//  _k          :   bit index of first symbol in _src
+//  _b          :   number of bits in each input symbol
+//  _sym_in     :   input symbols [size: _num_symbols x 1]
+//  _num_symbols:   number of input symbols
+void liquid_pack_array_block(unsigned char * _src,
+                             unsigned int    _n,
+                             unsigned int    _k,
+                             unsigned int    _b,
+                             unsigned char * _sym_in,
+                             unsigned int    _num_symbols)
+{
+    // validate input
+    if (_k >= 8*_n) {
+        fprintf(stderr,"error: liquid_pack_array_block(), bit index exceeds array length\n");
+        exit(1);
+    } else if (_b > 8) {
+        fprintf(stderr,"error: liquid_pack_array_block(), symbol size cannot exceed 8 bits\n");
+        exit(1);
+    }
+
+    unsigned int mask = (1u << _b) - 1;
+    unsigned int p    = _k >> 3;    // output byte index
+    unsigned int b0   = _k & 7;     // bits already in first byte
+
+    // seed accumulator with leading bits of first byte
+    uint64_t     acc   = _src[p] >> (8 - b0);
+    unsigned int nbits = b0;
+
+    unsigned int i;
+    for (i=0; i<_num_symbols; i++) {
+        acc = (acc << _b) | (_sym_in[i] & mask);
+        nbits += _b;
+
+        // flush 32 bits at a time
+        if (nbits >= 32) {
+            nbits -= 32;
+            uint32_t w = (uint32_t)(acc >> nbits);
+            if (p + 4 <= _n) {
+                _src[p  ] = (unsigned char)(w >> 24);
+                _src[p+1] = (unsigned char)(w >> 16);
+                _src[p+2] = (unsigned char)(w >>  8);
+                _src[p+3] = (unsigned char)(w      );
+            } else {
+                unsigned int j;
+                for (j=0; j<4 && p+j<_n; j++)
+                    _src[p+j] = (unsigned char)(w >> (24-8*j));
+            }
+            p += 4;
+        }
+    }
+
+    // flush remaining full bytes
+    while (nbits >= 8) {
+        nbits -= 8;
+        if (p < _n)
+            _src[p] = (unsigned char)(acc >> nbits);
+        p++;
+    }
+
+    // merge partial byte, retaining trailing bits already in array
+    if (nbits > 0 && p < _n) {
+        unsigned char m = 0xff >> nbits;
+        _src[p] = ((unsigned char)(acc << (8 - nbits)) & ~m) | (_src[p] & m);
     }
 }
 
+// unpack block of symbols from binary array; bits beyond the end of
+// the array are read as zeros
+//  _src        :   source array [size: _n x 1]
+//  _n          :   input source array length
+//  _k          :   bit index of first symbol in _src
+//  _b          :   number of bits in each output symbol
+//  _sym_out    :   output symbols [size: _num_symbols x 1]
+//  _num_symbols:   number of output symbols
+void liquid_unpack_array_block(unsigned char * _src,
+                               unsigned int    _n,
+                               unsigned int    _k,
+                               unsigned int    _b,
+                               unsigned char * _sym_out,
+                               unsigned int    _num_symbols)
+{
+    // validate input
+    if (_k >= 8*_n) {
+        fprintf(stderr,"error: liquid_unpack_array_block(), bit index exceeds array length\n");
+        exit(1);
+    } else if (_b > 8) {
+        fprintf(stderr,"error: liquid_unpack_array_block(), symbol size cannot exceed 8 bits\n");
+        exit(1);
+    }
 
+    unsigned int mask = (1u << _b) - 1;
+    unsigned int p    = _k >> 3;    // input byte index
 
+    // seed accumulator with trailing bits of first byte
+    uint64_t     acc   = _src[p++] & (0xff >> (_k & 7));
+    unsigned int nbits = 8 - (_k & 7);
+
+    unsigned int i;
+    for (i=0; i<_num_symbols; i++) {
+        // refill 32 bits at a time
+        if (nbits < _b) {
+            uint32_t w = 0;
+            if (p + 4 <= _n) {
+                w = ((uint32_t)_src[p  ] << 24) | ((uint32_t)_src[p+1] << 16) |
+                    ((uint32_t)_src[p+2] <<  8) | ((uint32_t)_src[p+3]      );
+            } else {
+                unsigned int j;
+                for (j=0; j<4; j++)
+                    w = (w << 8) | (p+j < _n ? _src[p+j] : 0);
+            }
+            acc = (acc << 32) | w;
+            nbits += 32;
+            p += 4;
+        }
+
+        nbits -= _b;
+        _sym_out[i] = (unsigned char)((acc >> nbits) & mask);
+    }
+}
 
 // pack one-bit symbols into bytes (8-bit symbols)
 //  _sym_in             :   input symbols array [size: _sym_in_len x 1]
@@ -196,30 +237,24 @@ void liquid_pack_bytes(unsigned char * _sym_in,
         fprintf(stderr,"error: pack_bytes(), output too short\n");
         exit(-1);
     }
-    
+
+    // gather eight one-bit symbols at a time
     unsigned int i;
-    unsigned int N = 0;         // number of bytes written to output
-    unsigned char byte = 0;
-    
-    for (i=0; i<_sym_in_len; i++) {
-        byte |= _sym_in[i] & 0x01;
-        
-        if ( (i+1)%8 == 0 ) {
-            _sym_out[N++] = byte;
-            byte = 0;
-        } else {
-            byte <<= 1;
-        }
+    unsigned int N = _sym_in_len >> 3;  // number of full bytes
+    for (i=0; i<N; i++)
+        _sym_out[i] = liquid_gather_bits_uint64(liquid_load_le64(&_sym_in[8*i]));
+
+    // remaining bits are right-aligned in last byte
+    if (_sym_in_len & 7) {
+        unsigned char byte = 0;
+        for (i=8*N; i<_sym_in_len; i++)
+            byte = (byte << 1) | (_sym_in[i] & 0x01);
+        _sym_out[N++] = byte;
     }
 
-    if ( i%8 != 0 )
-        _sym_out[N++] = byte >> 1;
-    
     *_num_written = N;
 }
 
-
-
 // unpack 8-bit symbols (full bytes) into one-bit symbols
 //  _sym_in             :   input symbols array [size: _sym_in_len x 1]
 //  _sym_in_len         :   number of input symbols
@@ -232,31 +267,95 @@ void liquid_unpack_bytes(unsigned char * _sym_in,
                          unsigned int _sym_out_len,
                          unsigned int * _num_written)
 {
-    unsigned int i;
-    unsigned int n = 0;
-    unsigned char byte;
-
     if ( _sym_out_len < 8*_sym_in_len ) {
         fprintf(stderr,"error: unpack_bytes(), output too short\n");
         exit(-1);
     }
-    
-    for (i=0; i<_sym_in_len; i++) {
-        // read input byte
-        byte = _sym_in[i];
-
-        // unpack byte into 8 one-bit symbols
-        _sym_out[n++] = (byte >> 7) & 0x01;
-        _sym_out[n++] = (byte >> 6) & 0x01;
-        _sym_out[n++] = (byte >> 5) & 0x01;
-        _sym_out[n++] = (byte >> 4) & 0x01;
-        _sym_out[n++] = (byte >> 3) & 0x01;
-        _sym_out[n++] = (byte >> 2) & 0x01;
-        _sym_out[n++] = (byte >> 1) & 0x01;
-        _sym_out[n++] =  byte       & 0x01;
+
+    // unpack each byte into 8 one-bit symbols
+    unsigned int i;
+    for (i=0; i<_sym_in_len; i++)
+        liquid_store_le64(&_sym_out[8*i], liquid_spread_bits_uint8(_sym_in[i]));
+
+    *_num_written = 8*_sym_in_len;
+}
+
+// split 8-bit symbols into _b-bit symbols, _b in {2,3,4,6}, one group
+// of lcm(_b,8) bits at a time; returns number of input bytes consumed
+static inline unsigned int liquid_repack_split(unsigned char * _x,
+                                               unsigned int    _n,
+                                               unsigned char * _y,
+                                               unsigned int    _b)
+{
+    unsigned int g    = (_b == 3 || _b == 6) ? 3 : 1;   // bytes per group
+    unsigned int ns   = 8*g / _b;                       // symbols per group
+    unsigned int mask = (1u << _b) - 1;
+
+    unsigned int i, j;
+    for (i=0; i+g<=_n; i+=g) {
+        uint32_t w = (g == 3) ? ((uint32_t)_x[i] << 16) | ((uint32_t)_x[i+1] << 8) | _x[i+2]
+                              : _x[i];
+        for (j=0; j<ns; j++)
+            *_y++ = (unsigned char)((w >> (8*g - _b*(j+1))) & mask);
     }
+    return i;
+}
 
-    *_num_written = n;
+// merge _b-bit symbols, _b in {2,3,4,6}, into 8-bit symbols, one group
+// of lcm(_b,8) bits at a time; returns number of input symbols consumed
+static inline unsigned int liquid_repack_merge(unsigned char * _x,
+                                               unsigned int    _n,
+                                               unsigned char * _y,
+                                               unsigned int    _b)
+{
+    unsigned int g    = (_b == 3 || _b == 6) ? 3 : 1;   // bytes per group
+    unsigned int ns   = 8*g / _b;                       // symbols per group
+    unsigned int mask = (1u << _b) - 1;
+
+    unsigned int i, j;
+    for (i=0; i+ns<=_n; i+=ns) {
+        uint32_t w = 0;
+        for (j=0; j<ns; j++)
+            w = (w << _b) | (_x[i+j] & mask);
+        if (g == 3) {
+            *_y++ = (unsigned char)(w >> 16);
+            *_y++ = (unsigned char)(w >>  8);
+        }
+        *_y++ = (unsigned char)w;
+    }
+    return i;
+}
+
+// repack arbitrary symbol sizes through a bit-stream accumulator,
+// zero-padding the final output symbol; returns number of output
+// symbols written
+static unsigned int liquid_repack_stream(unsigned char * _x,
+                                         unsigned int    _x_bps,
+                                         unsigned int    _n,
+                                         unsigned char * _y,
+                                         unsigned int    _y_bps)
+{
+    unsigned int mask_x = (1u << _x_bps) - 1;
+    unsigned int mask_y = (1u << _y_bps) - 1;
+
+    uint64_t     acc   = 0;
+    unsigned int nbits = 0;
+    unsigned int num_written = 0;
+
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        acc = (acc << _x_bps) | (_x[i] & mask_x);
+        nbits += _x_bps;
+        while (nbits >= _y_bps) {
+            nbits -= _y_bps;
+            _y[num_written++] = (unsigned char)((acc >> nbits) & mask_y);
+        }
+    }
+
+    if (nbits > 0)
+        _y[num_written++] = (unsigned char)((acc << (_y_bps - nbits)) & mask_y);
+
+    return num_written;
 }
 
 // repack bytes with arbitrary symbol sizes
@@ -275,6 +374,12 @@ void liquid_repack_bytes(unsigned char * _sym_in,
                          unsigned int _sym_out_len,
                          unsigned int * _num_written)
 {
+    // validate input
+    if (_sym_in_bps == 0 || _sym_in_bps > 8 || _sym_out_bps == 0 || _sym_out_bps > 8) {
+        fprintf(stderr,"error: repack_bytes(), symbol size must be in [1,8]\n");
+        exit(-1);
+    }
+
     // compute number of output symbols and determine if output array
     // is sufficiently sized
     div_t d = div(_sym_in_len*_sym_in_bps,_sym_out_bps);
@@ -287,54 +392,47 @@ void liquid_repack_bytes(unsigned char * _sym_in,
                 _sym_out_len, _sym_out_bps);
         exit(-1);
     }
-    
+
+    // fast paths for common symbol sizes to/from full bytes; each
+    // consumes whole groups of lcm(bps,8) bits leaving the remainder
+    // to the generic bit-stream
     unsigned int i;
-    unsigned char s_in = 0;     // input symbol
-    unsigned char s_out = 0;    // output symbol
-
-    // there is probably a more efficient way to do this, but...
-    unsigned int total_bits = _sym_in_len*_sym_in_bps;
-    unsigned int i_in = 0;  // input index counter
-    unsigned int i_out = 0; // output index counter
-    unsigned int k=0;       // input symbol enable
-    unsigned int n=0;       // output symbol enable
-    unsigned int v;         // bit mask
-
-    for (i=0; i<total_bits; i++) {
-        // shift output symbol by one bit
-        s_out <<= 1;
-
-        // pop input if necessary
-        if ( k == 0 ) {
-            //printf("\n\n_sym_in[%d] = %d", i_in, _sym_in[i_in]);
-            s_in = _sym_in[i_in++];
+    unsigned int n = 0;     // number of input symbols consumed
+    if (_sym_in_bps == 8) {
+        switch (_sym_out_bps) {
+        case 1:
+            for (n=0; n<_sym_in_len; n++)
+                liquid_store_le64(&_sym_out[8*n], liquid_spread_bits_uint8(_sym_in[n]));
+            break;
+        case 2: n = liquid_repack_split(_sym_in, _sym_in_len, _sym_out, 2); break;
+        case 3: n = liquid_repack_split(_sym_in, _sym_in_len, _sym_out, 3); break;
+        case 4: n = liquid_repack_split(_sym_in, _sym_in_len, _sym_out, 4); break;
+        case 6: n = liquid_repack_split(_sym_in, _sym_in_len, _sym_out, 6); break;
+        case 8:
+            memmove(_sym_out, _sym_in, _sym_in_len);
+            n = _sym_in_len;
+            break;
+        default:;
         }
-
-        // compute shift amount and append input bit at index
-        // to output symbol
-        v = _sym_in_bps - k - 1;
-        s_out |= (s_in >> v) & 0x01;
-        //printf("\n    b = %d, v = %d, s_in = %d, sym_out = %d", (sym_in >> v) & 0x01, v, s_in, sym_out );
-
-        // push output if available    
-        if ( n == _sym_out_bps-1 ) {
-            //printf("\n  _sym_out[%d] = %d", i_out, sym_out);
-            _sym_out[i_out++] = s_out;
-            s_out = 0;
+    } else if (_sym_out_bps == 8) {
+        switch (_sym_in_bps) {
+        case 1:
+            for (i=0; 8*i+8<=_sym_in_len; i++)
+                _sym_out[i] = liquid_gather_bits_uint64(liquid_load_le64(&_sym_in[8*i]));
+            n = 8*i;
+            break;
+        case 2: n = liquid_repack_merge(_sym_in, _sym_in_len, _sym_out, 2); break;
+        case 3: n = liquid_repack_merge(_sym_in, _sym_in_len, _sym_out, 3); break;
+        case 4: n = liquid_repack_merge(_sym_in, _sym_in_len, _sym_out, 4); break;
+        case 6: n = liquid_repack_merge(_sym_in, _sym_in_len, _sym_out, 6); break;
+        default:;
         }
-
-        // update input/output symbol pop/push flags
-        k = (k+1) % _sym_in_bps;
-        n = (n+1) % _sym_out_bps;
     }
 
-    // if uneven, push zeros into remaining output symbol
-    if (i_out != req__sym_out_len) {
-        for (i=n; i<_sym_out_bps; i++)
-            s_out <<= 1;
-        _sym_out[i_out++] = s_out;
-    }
-    
-    *_num_written = i_out;
-}
+    // remaining symbols (group-aligned, so stream starts empty)
+    unsigned int num_written = n*_sym_in_bps / _sym_out_bps;
+    num_written += liquid_repack_stream(_sym_in  + n, _sym_in_bps, _sym_in_len - n,
+                                        _sym_out + num_written, _sym_out_bps);
 
+    *_num_written = num_written;
+}
@@ -21,6 +21,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include "autotest/autotest.h"
 #include "liquid.internal.h"
 
@@ -293,3 +294,111 @@ void autotest_repack_bytes_04_uneven() {
 
 
 
+
+//
+// AUTOTEST : pack_array_block, unpack_array_block
+//
+
+// compare block packing against symbol-by-symbol packing, starting at
+// bit index _k with symbols overrunning the end of the array
+void pack_array_block_test(unsigned int _k,
+                           unsigned int _b)
+{
+    unsigned int n = 23;                // array size (bytes)
+    unsigned int num_symbols = (8*n - _k + _b - 1) / _b;
+    unsigned char sym_in[num_symbols];
+    unsigned char sym_out[num_symbols];
+    unsigned char sym_test[num_symbols];
+    unsigned char buf_block[n];
+    unsigned char buf_test[n];
+
+    unsigned int i;
+    for (i=0; i<num_symbols; i++)
+        sym_in[i] = rand() & 0xff;      // upper bits must be ignored
+    for (i=0; i<n; i++)
+        buf_block[i] = buf_test[i] = rand() & 0xff;
+
+    // pack
+    liquid_pack_array_block(buf_block, n, _k, _b, sym_in, num_symbols);
+    for (i=0; i<num_symbols; i++)
+        liquid_pack_array(buf_test, n, _k + i*_b, _b, sym_in[i]);
+    CONTEND_SAME_DATA(buf_block, buf_test, n);
+
+    // unpack
+    liquid_unpack_array_block(buf_test, n, _k, _b, sym_out, num_symbols);
+    for (i=0; i<num_symbols; i++)
+        liquid_unpack_array(buf_test, n, _k + i*_b, _b, &sym_test[i]);
+    CONTEND_SAME_DATA(sym_out, sym_test, num_symbols);
+}
+
+void autotest_pack_array_block()
+{
+    unsigned int k, b;
+    for (b=1; b<=8; b++) {
+        for (k=0; k<11; k++)
+            pack_array_block_test(k, b);
+    }
+}
+
+//
+// AUTOTEST : pack_bytes, unpack_bytes (random round trip)
+//
+void autotest_pack_bytes_random()
+{
+    unsigned int n = 91;                // number of one-bit symbols
+    unsigned char bits[n];
+    unsigned char bits_test[8*n];
+    unsigned char bytes[n];
+    unsigned int num_written;
+
+    unsigned int i;
+    for (i=0; i<n; i++)
+        bits[i] = rand() & 0x01;
+
+    // pack, then check each (right-aligned) partial byte separately
+    liquid_pack_bytes(bits, n, bytes, n, &num_written);
+    CONTEND_EQUALITY(num_written, (n+7)/8);
+    for (i=0; i<n; i++) {
+        unsigned int r = (i < 8*(n/8)) ? 7 - (i%8) : (n%8) - 1 - (i%8);
+        CONTEND_EQUALITY((bytes[i/8] >> r) & 0x01, bits[i]);
+    }
+
+    // unpack full bytes
+    liquid_unpack_bytes(bytes, n/8, bits_test, 8*n, &num_written);
+    CONTEND_EQUALITY(num_written, 8*(n/8));
+    CONTEND_SAME_DATA(bits, bits_test, 8*(n/8));
+}
+
+//
+// AUTOTEST : repack_bytes against bit-by-bit reference for all
+//            combinations of input/output symbol sizes
+//
+void autotest_repack_bytes_random()
+{
+    unsigned int n = 29;                // number of input symbols
+    unsigned char sym_in[n];
+    unsigned char sym_out[8*n];
+    unsigned char sym_test[8*n];
+
+    unsigned int bps_in, bps_out, i, j;
+    for (bps_in=1; bps_in<=8; bps_in++) {
+        for (bps_out=1; bps_out<=8; bps_out++) {
+            for (i=0; i<n; i++)
+                sym_in[i] = rand() & ((1 << bps_in) - 1);
+
+            // reference: unpack all bits, re-pack, zero-pad final symbol
+            unsigned int num_bits = n*bps_in;
+            unsigned int num_test = (num_bits + bps_out - 1) / bps_out;
+            memset(sym_test, 0x00, num_test);
+            for (j=0; j<num_bits; j++) {
+                unsigned int bit = (sym_in[j/bps_in] >> (bps_in - 1 - j%bps_in)) & 0x01;
+                sym_test[j/bps_out] |= bit << (bps_out - 1 - j%bps_out);
+            }
+
+            unsigned int num_written;
+            liquid_repack_bytes(sym_in, bps_in, n, sym_out, bps_out, 8*n, &num_written);
+            CONTEND_EQUALITY(num_written, num_test);
+            CONTEND_SAME_DATA(sym_out, sym_test, num_test);
+        }
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2007 - 2015 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Split-complex (planar) vector conversion
+//
+
+#include "liquid.internal.h"
+
+// split complex vector into separate real and imaginary arrays
+//  _x      :   input array [size: _n x 1]
+//  _n      :   array length
+//  _xi     :   output array, real part [size: _n x 1]
+//  _xq     :   output array, imaginary part [size: _n x 1]
+void liquid_vectorcf_split(float complex * _x,
+                           unsigned int    _n,
+                           float *         _xi,
+                           float *         _xq)
+{
+    // t = 4*(floor(_n/4))
+    unsigned int t=(_n>>2)<<2; 
+
+    // compute in groups of 4
+    unsigned int i;
+    for (i=0; i<t; i+=4) {
+        _xi[i  ] = crealf(_x[i  ]);
+        _xi[i+1] = crealf(_x[i+1]);
+        _xi[i+2] = crealf(_x[i+2]);
+        _xi[i+3] = crealf(_x[i+3]);
+
+        _xq[i  ] = cimagf(_x[i  ]);
+        _xq[i+1] = cimagf(_x[i+1]);
+        _xq[i+2] = cimagf(_x[i+2]);
+        _xq[i+3] = cimagf(_x[i+3]);
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++) {
+        _xi[i] = crealf(_x[i]);
+        _xq[i] = cimagf(_x[i]);
+    }
+}
+
+// join separate real and imaginary arrays into complex vector
+//  _xi     :   input array, real part [size: _n x 1]
+//  _xq     :   input array, imaginary part [size: _n x 1]
+//  _n      :   array length
+//  _x      :   output array [size: _n x 1]
+void liquid_vectorcf_join(float *         _xi,
+                          float *         _xq,
+                          unsigned int    _n,
+                          float complex * _x)
+{
+    // t = 4*(floor(_n/4))
+    unsigned int t=(_n>>2)<<2; 
+
+    // compute in groups of 4
+    unsigned int i;
+    for (i=0; i<t; i+=4) {
+        _x[i  ] = _xi[i  ] + _Complex_I*_xq[i  ];
+        _x[i+1] = _xi[i+1] + _Complex_I*_xq[i+1];
+        _x[i+2] = _xi[i+2] + _Complex_I*_xq[i+2];
+        _x[i+3] = _xi[i+3] + _Complex_I*_xq[i+3];
+    }
+
+    // clean up remaining
+    for ( ; i<_n; i++)
+        _x[i] = _xi[i] + _Complex_I*_xq[i];
+}
+